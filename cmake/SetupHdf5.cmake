@@ -128,6 +128,26 @@ else()
     "https://github.com/HDFGroup/hdf5/blob/develop/doc/file-locking.md")
 endif()
 
+# Optionally support writing volume data from all nodes collectively to a
+# single file with HDF5's MPI-IO driver instead of writing one file per node,
+# which is then enabled with the `Observers.CollectiveVolumeOutput` option. This
+# needs an HDF5 built with MPI support and Charm++ built on the MPI layer with
+# one process per node.
+option(SPECTRE_PARALLEL_HDF5
+  "Support writing volume data collectively to a single file using MPI-IO" OFF)
+if(SPECTRE_PARALLEL_HDF5)
+  if(NOT HDF5_IS_PARALLEL OR NOT MPI_FOUND)
+    message(FATAL_ERROR "SPECTRE_PARALLEL_HDF5 requires an HDF5 library that "
+      "is built with MPI support, and MPI. HDF5 is parallel: "
+      "'${HDF5_IS_PARALLEL}'. MPI found: '${MPI_FOUND}'.")
+  endif()
+  set_property(
+    TARGET hdf5::hdf5 HDF5::HDF5
+    APPEND PROPERTY INTERFACE_COMPILE_DEFINITIONS
+    SPECTRE_PARALLEL_HDF5)
+  message(STATUS "Volume data can be written collectively with MPI-IO")
+endif()
+
 include(CheckCXXSourceRuns)
 set(CMAKE_REQUIRED_LIBRARIES HDF5::HDF5)
 # Logic from src/Utilities/ErrorHandling/FloatingPointExceptions.cpp
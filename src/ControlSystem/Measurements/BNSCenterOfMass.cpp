@@ -4,6 +4,21 @@
 #include "BNSCenterOfMass.hpp"
 
 namespace control_system::measurements {
+namespace {
+// Integrate `integrand` and its first moment over the element, using `buffer`
+// for the first moment integrands
+void integrate_mass_and_first_moment(
+    const gsl::not_null<double*> mass,
+    const gsl::not_null<std::array<double, 3>*> first_moment,
+    const gsl::not_null<DataVector*> buffer, const DataVector& integrand,
+    const Mesh<3>& mesh, const tnsr::I<DataVector, 3, Frame::Grid>& x_grid) {
+  (*mass) = definite_integral(integrand, mesh);
+  for (size_t i = 0; i < 3; i++) {
+    *buffer = integrand * x_grid.get(i);
+    gsl::at(*first_moment, i) = definite_integral(*buffer, mesh);
+  }
+}
+}  // namespace
 
 void center_of_mass_integral_on_element(
     const gsl::not_null<double*> mass_a, const gsl::not_null<double*> mass_b,
@@ -12,23 +27,39 @@ void center_of_mass_integral_on_element(
     const Mesh<3>& mesh, const Scalar<DataVector>& inv_det_jacobian,
     const Scalar<DataVector>& tilde_d,
     const tnsr::I<DataVector, 3, Frame::Grid>& x_grid) {
-  // Get Jacobian and mask for left/right stars
-  const DataVector det_jacobian = 1. / get(inv_det_jacobian);
-  const DataVector positive_x = step_function(get<0>(x_grid));
-  const DataVector negative_x = (1.0 - positive_x);
-
   // Integrals of the density and its first moment (on local element).
   // Suffix A/B for positive/negative x-coordinate (proxy for stars A and B)
-  const DataVector integrand_a = det_jacobian * positive_x * get(tilde_d);
-  const DataVector integrand_b = det_jacobian * negative_x * get(tilde_d);
+  DataVector integrand = get(tilde_d) / get(inv_det_jacobian);
+  DataVector buffer(integrand.size());
 
-  (*mass_a) = definite_integral(integrand_a, mesh);
-  (*mass_b) = definite_integral(integrand_b, mesh);
-  for (size_t i = 0; i < 3; i++) {
-    gsl::at(*first_moment_a, i) =
-        definite_integral(integrand_a * x_grid.get(i), mesh);
-    gsl::at(*first_moment_b, i) =
-        definite_integral(integrand_b * x_grid.get(i), mesh);
+  // Most elements lie entirely on one side of x = 0, so only the integrals of
+  // that side are nonzero. The step function is 1 at x = 0, so points at x = 0
+  // belong to star A.
+  if (min(get<0>(x_grid)) >= 0.) {
+    integrate_mass_and_first_moment(mass_a, first_moment_a,
+                                    make_not_null(&buffer), integrand, mesh,
+                                    x_grid);
+    (*mass_b) = 0.;
+    (*first_moment_b) = {0., 0., 0.};
+    return;
+  }
+  if (max(get<0>(x_grid)) < 0.) {
+    integrate_mass_and_first_moment(mass_b, first_moment_b,
+                                    make_not_null(&buffer), integrand, mesh,
+                                    x_grid);
+    (*mass_a) = 0.;
+    (*first_moment_a) = {0., 0., 0.};
+    return;
   }
+
+  const DataVector positive_x = step_function(get<0>(x_grid));
+  const DataVector integrand_b = (1.0 - positive_x) * integrand;
+  integrand *= positive_x;
+  integrate_mass_and_first_moment(mass_a, first_moment_a,
+                                  make_not_null(&buffer), integrand, mesh,
+                                  x_grid);
+  integrate_mass_and_first_moment(mass_b, first_moment_b,
+                                  make_not_null(&buffer), integrand_b, mesh,
+                                  x_grid);
 }
 }  // namespace control_system::measurements
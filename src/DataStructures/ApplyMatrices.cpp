@@ -8,11 +8,11 @@
 #include <cstddef>
 #include <memory>
 
+#include "DataStructures/ApplyMatrixInFirstDimension.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Transpose.hpp"
-#include "Utilities/Blas.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 
@@ -21,18 +21,7 @@ void multiply_in_first_dimension(const gsl::not_null<double*> result,
                                  const gsl::not_null<size_t*> data_size,
                                  const Matrix& matrix, const double* data) {
   *data_size /= matrix.columns();
-  dgemm_<true>('N', 'N',
-               matrix.rows(),     // rows of matrix and result
-               *data_size,        // columns of result and u
-               matrix.columns(),  // columns of matrix and rows of u
-               1.0,               // overall multiplier
-               matrix.data(),     // matrix
-               matrix.spacing(),  // rows of matrix including padding
-               data,              // u
-               matrix.columns(),  // rows of u
-               0.0,               // multiplier for unused term
-               result.get(),      // result
-               matrix.rows());    // rows of result
+  apply_matrix_in_first_dimension(result, matrix, data, *data_size);
   *data_size *= matrix.rows();
 }
 
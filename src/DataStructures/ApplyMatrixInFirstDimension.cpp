@@ -0,0 +1,214 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/ApplyMatrixInFirstDimension.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/Matrix.hpp"
+#include "Utilities/Blas.hpp"
+#include "Utilities/Gsl.hpp"
+
+// The range of extents is set by CMake. If it is not, no fixed-size kernels
+// are compiled.
+#ifndef SPECTRE_MIN_SPECIALIZED_EXTENT
+#define SPECTRE_MIN_SPECIALIZED_EXTENT 1
+#define SPECTRE_MAX_SPECIALIZED_EXTENT 0
+#endif
+
+namespace {
+constexpr size_t min_extent = SPECTRE_MIN_SPECIALIZED_EXTENT;
+constexpr size_t max_extent = SPECTRE_MAX_SPECIALIZED_EXTENT;
+constexpr size_t number_of_extents =
+    max_extent >= min_extent ? max_extent - min_extent + 1 : 0;
+
+// The matrix is copied so that its extents and spacing are known at compile
+// time, and each column of the result is accumulated in registers.
+template <size_t Rows, size_t Columns>
+void fixed_size_apply(double* const result, const Matrix& matrix,
+                      const double* const data, const size_t number_of_columns,
+                      const bool add_to_result) {
+  std::array<double, Rows * Columns> fixed_matrix{};
+  for (size_t k = 0; k < Columns; ++k) {
+    for (size_t i = 0; i < Rows; ++i) {
+      gsl::at(fixed_matrix, i + Rows * k) = matrix(i, k);
+    }
+  }
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t n = 0; n < number_of_columns; ++n) {
+    const double* const data_column = data + Columns * n;
+    double* const result_column = result + Rows * n;
+    std::array<double, Rows> column{};
+    if (add_to_result) {
+      for (size_t i = 0; i < Rows; ++i) {
+        gsl::at(column, i) = result_column[i];
+      }
+    }
+    for (size_t k = 0; k < Columns; ++k) {
+      const double value = data_column[k];
+      for (size_t i = 0; i < Rows; ++i) {
+        gsl::at(column, i) += gsl::at(fixed_matrix, i + Rows * k) * value;
+      }
+    }
+    for (size_t i = 0; i < Rows; ++i) {
+      result_column[i] = gsl::at(column, i);
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+// Each row of the result in a block is a linear combination of the
+// contiguous rows of `stride` values of the data, so the innermost loop runs
+// over contiguous memory.
+template <size_t Rows, size_t Columns>
+void fixed_size_strided_apply(double* const result, const Matrix& matrix,
+                              const double* const data, const size_t stride,
+                              const size_t number_of_blocks,
+                              const bool add_to_result) {
+  std::array<double, Rows * Columns> fixed_matrix{};
+  for (size_t k = 0; k < Columns; ++k) {
+    for (size_t i = 0; i < Rows; ++i) {
+      gsl::at(fixed_matrix, i + Rows * k) = matrix(i, k);
+    }
+  }
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t block = 0; block < number_of_blocks; ++block) {
+    const double* const data_block = data + Columns * stride * block;
+    double* const result_block = result + Rows * stride * block;
+    for (size_t i = 0; i < Rows; ++i) {
+      double* const result_row = result_block + stride * i;
+      if (not add_to_result) {
+        std::fill(result_row, result_row + stride, 0.0);
+      }
+      for (size_t k = 0; k < Columns; ++k) {
+        const double factor = gsl::at(fixed_matrix, i + Rows * k);
+        const double* const data_row = data_block + stride * k;
+        for (size_t s = 0; s < stride; ++s) {
+          result_row[s] += factor * data_row[s];
+        }
+      }
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+using Kernel = void (*)(double*, const Matrix&, const double*, size_t, bool);
+using StridedKernel = void (*)(double*, const Matrix&, const double*, size_t,
+                               size_t, bool);
+
+template <size_t... Is>
+constexpr std::array<Kernel, sizeof...(Is)> make_kernels(
+    std::index_sequence<Is...> /*meta*/) {
+  return {{&fixed_size_apply<min_extent + Is / number_of_extents,
+                             min_extent + Is % number_of_extents>...}};
+}
+
+template <size_t... Is>
+constexpr std::array<StridedKernel, sizeof...(Is)> make_strided_kernels(
+    std::index_sequence<Is...> /*meta*/) {
+  return {{&fixed_size_strided_apply<min_extent + Is / number_of_extents,
+                                     min_extent + Is % number_of_extents>...}};
+}
+
+// Indexed by `(rows - min_extent) * number_of_extents + columns - min_extent`
+constexpr auto kernels = make_kernels(
+    std::make_index_sequence<number_of_extents * number_of_extents>{});
+constexpr auto strided_kernels = make_strided_kernels(
+    std::make_index_sequence<number_of_extents * number_of_extents>{});
+
+size_t kernel_index(const Matrix& matrix) {
+  return (matrix.rows() - min_extent) * number_of_extents + matrix.columns() -
+         min_extent;
+}
+}  // namespace
+
+bool has_fixed_size_kernel(const Matrix& matrix) {
+  const auto in_range = [](const size_t extent) {
+    return extent >= min_extent and extent <= max_extent;
+  };
+  return in_range(matrix.rows()) and in_range(matrix.columns());
+}
+
+template <bool UseFixedSizeKernels>
+void apply_matrix_in_first_dimension(const gsl::not_null<double*> result,
+                                     const Matrix& matrix,
+                                     const double* const data,
+                                     const size_t number_of_columns,
+                                     const bool add_to_result) {
+  if constexpr (UseFixedSizeKernels and number_of_extents > 0) {
+    if (has_fixed_size_kernel(matrix)) {
+      gsl::at(kernels, kernel_index(matrix))(result, matrix, data,
+                                             number_of_columns, add_to_result);
+      return;
+    }
+  }
+  dgemm_<true>('N', 'N',
+               matrix.rows(),              // rows of matrix and result
+               number_of_columns,          // columns of result and data
+               matrix.columns(),           // columns of matrix and rows of data
+               1.0,                        // overall multiplier
+               matrix.data(),              // matrix
+               matrix.spacing(),           // rows of matrix including padding
+               data,                       // data
+               matrix.columns(),           // rows of data
+               add_to_result ? 1.0 : 0.0,  // overwrite or add to result
+               result,                     // result
+               matrix.rows());             // rows of result
+}
+
+template <bool UseFixedSizeKernels>
+void apply_matrix_in_strided_dimension(const gsl::not_null<double*> result,
+                                       const Matrix& matrix,
+                                       const double* const data,
+                                       const size_t stride,
+                                       const size_t number_of_blocks,
+                                       const bool add_to_result) {
+  if constexpr (UseFixedSizeKernels and number_of_extents > 0) {
+    if (has_fixed_size_kernel(matrix)) {
+      gsl::at(strided_kernels, kernel_index(matrix))(
+          result, matrix, data, stride, number_of_blocks, add_to_result);
+      return;
+    }
+  }
+  // Each block of the result is the block of the data, viewed as a
+  // column-major `stride` by `matrix.columns()` matrix, times the transpose of
+  // the matrix
+  for (size_t block = 0; block < number_of_blocks; ++block) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const double* const data_block = data + matrix.columns() * stride * block;
+    double* const result_block = result.get() + matrix.rows() * stride * block;
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    dgemm_<true>('N', 'T',
+                 stride,                     // rows of data and result
+                 matrix.rows(),              // columns of result
+                 matrix.columns(),           // columns of data
+                 1.0,                        // overall multiplier
+                 data_block,                 // data
+                 stride,                     // rows of data
+                 matrix.data(),              // matrix
+                 matrix.spacing(),           // rows of matrix including padding
+                 add_to_result ? 1.0 : 0.0,  // overwrite or add to result
+                 result_block,               // result
+                 stride);                    // rows of result
+  }
+}
+
+template void apply_matrix_in_first_dimension<true>(gsl::not_null<double*>,
+                                                    const Matrix&,
+                                                    const double*, size_t,
+                                                    bool);
+template void apply_matrix_in_first_dimension<false>(gsl::not_null<double*>,
+                                                     const Matrix&,
+                                                     const double*, size_t,
+                                                     bool);
+template void apply_matrix_in_strided_dimension<true>(gsl::not_null<double*>,
+                                                      const Matrix&,
+                                                      const double*, size_t,
+                                                      size_t, bool);
+template void apply_matrix_in_strided_dimension<false>(gsl::not_null<double*>,
+                                                       const Matrix&,
+                                                       const double*, size_t,
+                                                       size_t, bool);
@@ -0,0 +1,67 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines functions apply_matrix_in_first_dimension and
+/// apply_matrix_in_strided_dimension
+
+#pragma once
+
+#include <cstddef>
+
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class Matrix;
+/// \endcond
+
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Multiply the `matrix` into the first dimension of the column-major
+ * `data` with `matrix.columns()` rows and `number_of_columns` columns.
+ *
+ * The `result` has `matrix.rows()` rows and `number_of_columns` columns. If
+ * `add_to_result` is true the product is added to the `result`, otherwise it
+ * overwrites it.
+ *
+ * This is the kernel of `apply_matrices` and the logical derivatives. If
+ * `UseFixedSizeKernels` is true and both extents of the `matrix` are in the
+ * range set by the `SPECTRE_MIN_SPECIALIZED_EXTENT` and
+ * `SPECTRE_MAX_SPECIALIZED_EXTENT` CMake options, the multiplication is done
+ * by a kernel that is compiled for these extents so that the compiler can
+ * unroll and vectorize the loops over the matrix. Otherwise the general
+ * `dgemm_` is used, which is also what `UseFixedSizeKernels = false` forces,
+ * e.g. to benchmark the two paths against each other.
+ */
+template <bool UseFixedSizeKernels = true>
+void apply_matrix_in_first_dimension(gsl::not_null<double*> result,
+                                     const Matrix& matrix, const double* data,
+                                     size_t number_of_columns,
+                                     bool add_to_result = false);
+
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Multiply the `matrix` into a strided dimension of the `data`, without
+ * transposing it.
+ *
+ * The `data` consists of `number_of_blocks` contiguous blocks of
+ * `matrix.columns()` rows of `stride` contiguous values, e.g. the
+ * \f$\eta\f$ dimension of a 3D mesh has `stride` \f$n_\xi\f$ and
+ * \f$n_\zeta\f$ times the number of components blocks. The `result` has the
+ * same layout with `matrix.rows()` rows per block. For `stride = 1` this is
+ * `apply_matrix_in_first_dimension`.
+ *
+ * The fixed-size kernels are used for the same extents as in
+ * `apply_matrix_in_first_dimension`, and their innermost loop runs over the
+ * contiguous `stride` values. The general path multiplies each block with the
+ * transposed matrix with `dgemm_`.
+ */
+template <bool UseFixedSizeKernels = true>
+void apply_matrix_in_strided_dimension(gsl::not_null<double*> result,
+                                       const Matrix& matrix, const double* data,
+                                       size_t stride, size_t number_of_blocks,
+                                       bool add_to_result = false);
+
+/// Whether `apply_matrix_in_first_dimension` uses a fixed-size kernel for the
+/// `matrix`
+bool has_fixed_size_kernel(const Matrix& matrix);
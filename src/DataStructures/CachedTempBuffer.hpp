@@ -4,9 +4,11 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 #include "DataStructures/TempBuffer.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -24,6 +26,11 @@
  * \snippet Test_CachedTempBuffer.cpp alias
  * the function used to compute `Tags::Scalar2<DataType>` is
  * \snippet Test_CachedTempBuffer.cpp compute_func
+ *
+ * Unlike a `TempBuffer`, a `CachedTempBuffer` is often stored beyond the
+ * function that created it (e.g. to reuse the intermediates of an analytic
+ * solution across calls), so its memory is taken from the heap rather than
+ * from the per-thread `ScratchArena`.
  */
 template <typename... Tags>
 class CachedTempBuffer {
@@ -34,6 +41,18 @@ class CachedTempBuffer {
   /// to the underlying `TempBuffer` constructor.
   CachedTempBuffer(const size_t size) : data_(size) {}
 
+  /// Discard all cached values and resize the buffer to `size` points. The
+  /// memory is reused if the size does not change.
+  void reinitialize(const size_t size) {
+    if constexpr (not is_fundamental) {
+      data_.initialize(size);
+    } else {
+      (void)size;
+    }
+    computed_flags_ = tuples::TaggedTuple<Computed<Tags>...>{
+        ((void)Tags{}, false)...};
+  }
+
   /// Obtain a value from the buffer, computing it if necessary.
   template <typename Computer, typename Tag>
   const typename Tag::type& get_var(const Computer& computer, Tag /*meta*/) {
@@ -58,7 +77,13 @@ class CachedTempBuffer {
     using type = bool;
   };
 
-  TempBuffer<tmpl::list<Tags...>> data_;
+  static constexpr bool is_fundamental = std::is_fundamental_v<
+      typename tmpl::front<tmpl::list<Tags...>>::type::value_type>;
+
+  tmpl::conditional_t<is_fundamental,
+                      TempBuffer<tmpl::list<Tags...>, true>,
+                      Variables<tmpl::list<Tags...>>>
+      data_;
   tuples::TaggedTuple<Computed<Tags>...> computed_flags_{
       ((void)Tags{}, false)...};
 };
@@ -0,0 +1,66 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/DataBox/ComputeItemProfile.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace db {
+namespace {
+std::mutex compute_item_profile_mutex{};
+std::map<std::string, ComputeItemStats> compute_item_profile_data{};
+}  // namespace
+
+std::map<std::string, ComputeItemStats> compute_item_profile() {
+  const std::lock_guard lock(compute_item_profile_mutex);
+  return compute_item_profile_data;
+}
+
+std::string compute_item_profile_summary() {
+  auto profile = compute_item_profile();
+  std::vector<std::pair<std::string, ComputeItemStats>> sorted_profile(
+      std::make_move_iterator(profile.begin()),
+      std::make_move_iterator(profile.end()));
+  std::sort(sorted_profile.begin(), sorted_profile.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.second.evaluation_time > rhs.second.evaluation_time;
+            });
+  std::ostringstream ss{};
+  ss << std::setw(16) << "Time (s)" << std::setw(14) << "Evaluations"
+     << std::setw(14) << "Resets"
+     << "  Compute tag\n";
+  for (const auto& [tag_name, stats] : sorted_profile) {
+    ss << std::setw(16) << std::setprecision(6) << stats.evaluation_time
+       << std::setw(14) << stats.evaluations << std::setw(14) << stats.resets
+       << "  " << tag_name << "\n";
+  }
+  return ss.str();
+}
+
+void clear_compute_item_profile() {
+  const std::lock_guard lock(compute_item_profile_mutex);
+  compute_item_profile_data.clear();
+}
+
+namespace detail {
+void record_compute_item_evaluation(const std::string& tag_name,
+                                    const double evaluation_time) {
+  const std::lock_guard lock(compute_item_profile_mutex);
+  auto& stats = compute_item_profile_data[tag_name];
+  ++stats.evaluations;
+  stats.evaluation_time += evaluation_time;
+}
+
+void record_compute_item_reset(const std::string& tag_name) {
+  const std::lock_guard lock(compute_item_profile_mutex);
+  ++compute_item_profile_data[tag_name].resets;
+}
+}  // namespace detail
+}  // namespace db
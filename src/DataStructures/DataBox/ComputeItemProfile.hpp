@@ -0,0 +1,57 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace db {
+/*!
+ * \ingroup DataBoxGroup
+ * \brief How often a compute tag was evaluated and reset, and how long its
+ * evaluations took
+ *
+ * \details The statistics are only recorded in builds with `ENABLE_PROFILING`
+ * turned on (which defines `SPECTRE_PROFILING`). They are accumulated over all
+ * DataBoxes in the process, so in SMP builds they are aggregated over all
+ * elements on the node.
+ *
+ * - `evaluations`: number of times the compute tag's `function` was called.
+ * - `evaluation_time`: total wall time in seconds spent in the `function`.
+ * - `resets`: number of times the compute item was reset by `db::mutate` after
+ *   it had been evaluated.
+ *
+ * Since compute items are evaluated lazily, every evaluation is triggered by a
+ * retrieval, so there are no evaluations whose result is never used. A number
+ * of evaluations close to the number of resets indicates a compute item whose
+ * value is discarded after every use, so it may be cheaper to compute it where
+ * it is needed instead.
+ */
+struct ComputeItemStats {
+  size_t evaluations = 0;
+  double evaluation_time = 0.0;
+  size_t resets = 0;
+};
+
+/// \ingroup DataBoxGroup
+/// The `db::ComputeItemStats` of all compute tags that were evaluated or reset
+/// in this process, keyed by `db::tag_name`. Empty unless `SPECTRE_PROFILING`
+/// is defined.
+std::map<std::string, ComputeItemStats> compute_item_profile();
+
+/// \ingroup DataBoxGroup
+/// A table of the `db::compute_item_profile()`, sorted by total evaluation time
+std::string compute_item_profile_summary();
+
+/// \ingroup DataBoxGroup
+/// Clear the `db::compute_item_profile()`
+void clear_compute_item_profile();
+
+namespace detail {
+void record_compute_item_evaluation(const std::string& tag_name,
+                                    double evaluation_time);
+void record_compute_item_reset(const std::string& tag_name);
+}  // namespace detail
+}  // namespace db
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <exception>
 #include <functional>
@@ -18,6 +19,7 @@
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/Access.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
@@ -407,16 +409,29 @@ class DataBox<tmpl::list<Tags...>> : public Access,
         mutate_mutable_subitems_functions{};
     std::unordered_map<std::string, void (DataBox::*)()>
         reset_compute_items_after_mutate_functions{};
+    // The reset functions of all items that (directly or indirectly) depend
+    // on each mutable tag
+    std::unordered_map<std::string, std::vector<bool (DataBox::*)()>>
+        reset_functions_after_mutate{};
   };
 
   /// \cond
   static const TagGraphs tag_graphs_;
   /// \endcond
   static TagGraphs compute_tag_graphs();
-  void reset_parent(const std::string& item_name,
-                    const std::string& skip_this_subitem);
-  void reset_compute_items(const std::string& item_name);
-  template <typename MutatedTag>
+  static void collect_dependent_item(
+      gsl::not_null<std::vector<std::string>*> dependent_items,
+      const TagGraphs& tag_graphs, const std::string& item_name);
+  static void collect_subitem_dependents(
+      gsl::not_null<std::vector<std::string>*> dependent_items,
+      const TagGraphs& tag_graphs, const std::string& item_name,
+      const std::string& skip_this_subitem);
+  static void collect_dependents(
+      gsl::not_null<std::vector<std::string>*> dependent_items,
+      const TagGraphs& tag_graphs, const std::string& item_name);
+  static std::vector<std::string> collect_dependents_after_mutate(
+      const TagGraphs& tag_graphs, const std::string& mutated_tag);
+  template <typename... MutatedTags>
   void reset_compute_items_after_mutate();
   void mutate_mutable_subitems(const std::string& tag_name) override;
   void reset_compute_items_after_mutate(const std::string& tag_name) override;
@@ -838,136 +853,174 @@ auto DataBox<tmpl::list<Tags...>>::compute_tag_graphs() -> TagGraphs {
       result.reset_compute_items_after_mutate_functions[tag_name] = nullptr;
     }
   });
+
+  // Collect the items that have to be reset when a tag is mutated, so a
+  // mutation doesn't have to walk the graphs above
+  for (const auto& mutated_tag_and_function :
+       result.reset_compute_items_after_mutate_functions) {
+    const std::string& mutated_tag = mutated_tag_and_function.first;
+    auto& reset_functions = result.reset_functions_after_mutate[mutated_tag];
+    for (const std::string& dependent_item_name :
+         collect_dependents_after_mutate(result, mutated_tag)) {
+      ASSERT(result.tags_and_reset_functions.find(dependent_item_name) !=
+                 result.tags_and_reset_functions.end(),
+             "Item " << dependent_item_name
+                     << " does not have a reset function.");
+      reset_functions.push_back(
+          result.tags_and_reset_functions.at(dependent_item_name));
+    }
+  }
   return result;
 }
 
+// The functions below collect all items that may have to be reset when a tag
+// is mutated. An item only has to be reset if it was evaluated, and items that
+// depend on an item that wasn't evaluated can't have been evaluated either.
+// Therefore, mutations only have to reset items until they encounter one that
+// wasn't evaluated. Resetting all items that depend on the mutated tag instead
+// resets the same evaluated items, but with a single pass over a precomputed
+// list rather than recursive lookups in the tag graphs.
+template <typename... Tags>
+void DataBox<tmpl::list<Tags...>>::collect_dependent_item(
+    const gsl::not_null<std::vector<std::string>*> dependent_items,
+    const TagGraphs& tag_graphs, const std::string& item_name) {
+  if (std::find(dependent_items->begin(), dependent_items->end(),
+                item_name) != dependent_items->end()) {
+    // Items that depend on this one were already collected
+    return;
+  }
+  dependent_items->push_back(item_name);
+  if (tag_graphs.tags_and_dependents.find(item_name) !=
+      tag_graphs.tags_and_dependents.end()) {
+    collect_dependents(dependent_items, tag_graphs, item_name);
+  }
+  collect_subitem_dependents(dependent_items, tag_graphs, item_name, "");
+  if (const auto parent_it = tag_graphs.subitem_to_parent_tag.find(item_name);
+      parent_it != tag_graphs.subitem_to_parent_tag.end()) {
+    collect_subitem_dependents(dependent_items, tag_graphs, parent_it->second,
+                               item_name);
+  }
+}
+
 template <typename... Tags>
-void DataBox<tmpl::list<Tags...>>::reset_parent(
-    const std::string& item_name, const std::string& skip_this_subitem) {
+void DataBox<tmpl::list<Tags...>>::collect_subitem_dependents(
+    const gsl::not_null<std::vector<std::string>*> dependent_items,
+    const TagGraphs& tag_graphs, const std::string& item_name,
+    const std::string& skip_this_subitem) {
   if (const auto parent_tag_it =
-          tag_graphs_.parent_to_subitem_tags.find(item_name);
-      parent_tag_it != tag_graphs_.parent_to_subitem_tags.end()) {
+          tag_graphs.parent_to_subitem_tags.find(item_name);
+      parent_tag_it != tag_graphs.parent_to_subitem_tags.end()) {
     for (const auto& subitem_tag : parent_tag_it->second) {
       if (subitem_tag == skip_this_subitem) {
         continue;
       }
       const auto dependent_items_it =
-          tag_graphs_.tags_and_dependents.find(subitem_tag);
-      if (dependent_items_it == tag_graphs_.tags_and_dependents.end()) {
+          tag_graphs.tags_and_dependents.find(subitem_tag);
+      if (dependent_items_it == tag_graphs.tags_and_dependents.end()) {
         continue;
       }
       for (const std::string& dependent_item_name :
            dependent_items_it->second) {
-        ASSERT(tag_graphs_.tags_and_reset_functions.find(dependent_item_name) !=
-                   tag_graphs_.tags_and_reset_functions.end(),
-               "Item " << dependent_item_name
-                       << " does not have a reset function.");
-        if ((this->*(tag_graphs_.tags_and_reset_functions)
-                        .at(dependent_item_name))()) {
-          if (tag_graphs_.tags_and_dependents.find(dependent_item_name) !=
-              tag_graphs_.tags_and_dependents.end()) {
-            // If the compute tag was evaluated, then we need to check the
-            // items that depend on it.
-            reset_compute_items(dependent_item_name);
-          }
-          reset_parent(dependent_item_name, "");
-          if (const auto parent_it =
-                  tag_graphs_.subitem_to_parent_tag.find(dependent_item_name);
-              parent_it != tag_graphs_.subitem_to_parent_tag.end()) {
-            reset_parent(parent_it->second, dependent_item_name);
-          }
-        }
+        collect_dependent_item(dependent_items, tag_graphs,
+                               dependent_item_name);
       }
     }
   }
 }
 
 template <typename... Tags>
-void DataBox<tmpl::list<Tags...>>::reset_compute_items(
-    const std::string& item_name) {
-  // If the compute tag was evaluated before reset, then we reset dependent
-  // compute tags.
-  ASSERT(tag_graphs_.tags_and_dependents.find(item_name) !=
-             tag_graphs_.tags_and_dependents.end(),
+void DataBox<tmpl::list<Tags...>>::collect_dependents(
+    const gsl::not_null<std::vector<std::string>*> dependent_items,
+    const TagGraphs& tag_graphs, const std::string& item_name) {
+  ASSERT(tag_graphs.tags_and_dependents.find(item_name) !=
+             tag_graphs.tags_and_dependents.end(),
          "Item " << item_name << " does not have any dependents.");
   for (const std::string& dependent_item_name :
-       tag_graphs_.tags_and_dependents.at(item_name)) {
-    ASSERT(
-        tag_graphs_.tags_and_reset_functions.find(dependent_item_name) !=
-            tag_graphs_.tags_and_reset_functions.end(),
-        "Item " << dependent_item_name << " does not have a reset function.");
-    if ((this->*(tag_graphs_.tags_and_reset_functions)
-                    .at(dependent_item_name))()) {
-      reset_parent(dependent_item_name, "");
-      if (const auto parent_it =
-              tag_graphs_.subitem_to_parent_tag.find(dependent_item_name);
-          parent_it != tag_graphs_.subitem_to_parent_tag.end()) {
-        reset_parent(parent_it->second, dependent_item_name);
-      }
-      if (tag_graphs_.tags_and_dependents.find(dependent_item_name) !=
-          tag_graphs_.tags_and_dependents.end()) {
-        // If the compute tag was evaluated, then we need to check the items
-        // that depend on it.
-        reset_compute_items(dependent_item_name);
-      }
-    }
+       tag_graphs.tags_and_dependents.at(item_name)) {
+    collect_dependent_item(dependent_items, tag_graphs, dependent_item_name);
   }
-  // If this tag is a parent tag, reset subitems and their dependents
-  reset_parent(item_name, "");
-  // If this tag is a subitem, reset parent and other subitem dependents
-  if (const auto parent_it = tag_graphs_.subitem_to_parent_tag.find(item_name);
-      parent_it != tag_graphs_.subitem_to_parent_tag.end()) {
-    reset_parent(parent_it->second, item_name);
+  // If this tag is a parent tag, collect dependents of subitems
+  collect_subitem_dependents(dependent_items, tag_graphs, item_name, "");
+  // If this tag is a subitem, collect dependents of parent and other subitems
+  if (const auto parent_it = tag_graphs.subitem_to_parent_tag.find(item_name);
+      parent_it != tag_graphs.subitem_to_parent_tag.end()) {
+    collect_subitem_dependents(dependent_items, tag_graphs, parent_it->second,
+                               item_name);
   }
 }
 
 template <typename... Tags>
-template <typename MutatedTag>
-void DataBox<tmpl::list<Tags...>>::reset_compute_items_after_mutate() {
-  static const std::string mutated_tag = pretty_type::get_name<MutatedTag>();
-  if (tag_graphs_.tags_and_dependents.find(mutated_tag) !=
-      tag_graphs_.tags_and_dependents.end()) {
-    reset_compute_items(mutated_tag);
+std::vector<std::string>
+DataBox<tmpl::list<Tags...>>::collect_dependents_after_mutate(
+    const TagGraphs& tag_graphs, const std::string& mutated_tag) {
+  std::vector<std::string> dependent_items{};
+  const auto has_dependents = [&tag_graphs](const std::string& item_name) {
+    return tag_graphs.tags_and_dependents.find(item_name) !=
+           tag_graphs.tags_and_dependents.end();
+  };
+  if (has_dependents(mutated_tag)) {
+    collect_dependents(make_not_null(&dependent_items), tag_graphs,
+                       mutated_tag);
   }
-
-  // Handled subitems
-  if constexpr (detail::has_subitems<MutatedTag>::value) {
-    ASSERT(tag_graphs_.parent_to_subitem_tags.find(mutated_tag) !=
-               tag_graphs_.parent_to_subitem_tags.end(),
-           "The parent tag "
-               << mutated_tag
-               << " is not in the set of parent_to_subitem_tags_. This is "
-                  "an internal inconsistency bug.\n");
-    for (const auto& subitem_name :
-         tag_graphs_.parent_to_subitem_tags.at(mutated_tag)) {
-      if (tag_graphs_.tags_and_dependents.find(subitem_name) !=
-          tag_graphs_.tags_and_dependents.end()) {
-        reset_compute_items(subitem_name);
+  // Handle subitems
+  if (const auto subitems_it =
+          tag_graphs.parent_to_subitem_tags.find(mutated_tag);
+      subitems_it != tag_graphs.parent_to_subitem_tags.end()) {
+    for (const auto& subitem_name : subitems_it->second) {
+      if (has_dependents(subitem_name)) {
+        collect_dependents(make_not_null(&dependent_items), tag_graphs,
+                           subitem_name);
       }
     }
   }
   // Handle parent tags
-  if constexpr (tmpl::list_contains_v<mutable_subitem_tags, MutatedTag>) {
-    ASSERT(tag_graphs_.subitem_to_parent_tag.find(mutated_tag) !=
-               tag_graphs_.subitem_to_parent_tag.end(),
-           "Expected to find a parent tag of "
-               << mutated_tag
-               << " but did not. This is an internal inconsistency bug.");
-    const auto& parent_tag_name =
-        tag_graphs_.subitem_to_parent_tag.at(mutated_tag);
-    if (tag_graphs_.tags_and_dependents.find(parent_tag_name) !=
-        tag_graphs_.tags_and_dependents.end()) {
-      reset_compute_items(parent_tag_name);
+  if (const auto parent_it = tag_graphs.subitem_to_parent_tag.find(mutated_tag);
+      parent_it != tag_graphs.subitem_to_parent_tag.end()) {
+    const auto& parent_tag_name = parent_it->second;
+    if (has_dependents(parent_tag_name)) {
+      collect_dependents(make_not_null(&dependent_items), tag_graphs,
+                         parent_tag_name);
     }
     for (const auto& subitem_name :
-         tag_graphs_.parent_to_subitem_tags.at(parent_tag_name)) {
-      if (tag_graphs_.tags_and_dependents.find(subitem_name) !=
-              tag_graphs_.tags_and_dependents.end() and
-          subitem_name != mutated_tag) {
-        reset_compute_items(subitem_name);
+         tag_graphs.parent_to_subitem_tags.at(parent_tag_name)) {
+      if (has_dependents(subitem_name) and subitem_name != mutated_tag) {
+        collect_dependents(make_not_null(&dependent_items), tag_graphs,
+                           subitem_name);
       }
     }
   }
+  return dependent_items;
+}
+
+// When several tags are mutated at once, the items that depend on them are
+// reset together after the mutation. The union of their reset functions is
+// collected once for each combination of mutated tags, so items that depend on
+// more than one of them are reset only once.
+template <typename... Tags>
+template <typename... MutatedTags>
+void DataBox<tmpl::list<Tags...>>::reset_compute_items_after_mutate() {
+  static const std::vector<bool (DataBox::*)()> reset_functions = []() {
+    std::vector<bool (DataBox::*)()> result{};
+    for (const std::string& mutated_tag :
+         {pretty_type::get_name<MutatedTags>()...}) {
+      ASSERT(tag_graphs_.reset_functions_after_mutate.find(mutated_tag) !=
+                 tag_graphs_.reset_functions_after_mutate.end(),
+             "The mutated tag " << mutated_tag
+                                << " has no list of items to reset. This is "
+                                   "an internal inconsistency bug.\n");
+      for (const auto reset_function :
+           tag_graphs_.reset_functions_after_mutate.at(mutated_tag)) {
+        if (std::find(result.begin(), result.end(), reset_function) ==
+            result.end()) {
+          result.push_back(reset_function);
+        }
+      }
+    }
+    return result;
+  }();
+  for (const auto reset_function : reset_functions) {
+    (this->*reset_function)();
+  }
 }
 
 template <typename... Tags>
@@ -1121,6 +1174,11 @@ db::DataBox<tmpl::list<Tags...>>::reset_all_subitems() {
  * The `invokable` may have function return values, and any returns are
  * forwarded as returns to the `db::mutate` call.
  *
+ * The items that depend on any of the `MutateTags` are reset once after the
+ * `invokable` returns, so an item that depends on several of them is reset
+ * only once. Actions that mutate several items should therefore mutate them
+ * in a single call, e.g. with `db::mutate_apply`, rather than one at a time.
+ *
  * For convenience in generic programming, if `::Tags::DataBox` is
  * passed as the sole `MutateTags` parameter, this function will
  * simply call its first argument with its remaining arguments.
@@ -1166,9 +1224,8 @@ decltype(auto) mutate(Invokable&& invokable,
       box->mutate_locked_box_ = false;
       EXPAND_PACK_LEFT_TO_RIGHT(
           box->template mutate_mutable_subitems<MutateTags>());
-      EXPAND_PACK_LEFT_TO_RIGHT(
-          box->template reset_compute_items_after_mutate<
-              detail::first_matching_tag<TagList, MutateTags>>());
+      box->template reset_compute_items_after_mutate<
+          detail::first_matching_tag<TagList, MutateTags>...>();
     };
     box->mutate_locked_box_ = true;
     return invokable(
@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <pup.h>
+#include <string>
 #include <utility>
 
+#include "DataStructures/DataBox/ComputeItemProfile.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataBox/TagTraits.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
@@ -106,12 +110,30 @@ class Item<Tag, ItemType::Compute> {
 
   bool evaluated() const { return evaluated_; }
 
-  void reset() { evaluated_ = false; }
+  void reset() {
+#ifdef SPECTRE_PROFILING
+    if (evaluated_) {
+      static const std::string name = db::tag_name<Tag>();
+      record_compute_item_reset(name);
+    }
+#endif  // SPECTRE_PROFILING
+    evaluated_ = false;
+  }
 
   template <typename... Args>
   void evaluate(const Args&... args) const {
+#ifdef SPECTRE_PROFILING
+    const auto start_time = std::chrono::steady_clock::now();
+#endif  // SPECTRE_PROFILING
     Tag::function(make_not_null(&value_), args...);
     evaluated_ = true;
+#ifdef SPECTRE_PROFILING
+    static const std::string name = db::tag_name<Tag>();
+    record_compute_item_evaluation(
+        name, std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                            start_time)
+                  .count());
+#endif  // SPECTRE_PROFILING
   }
 
  private:
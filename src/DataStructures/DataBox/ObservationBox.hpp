@@ -73,7 +73,18 @@ class ObservationBox<tmpl::list<ComputeTags...>, DataBoxType>
   /// Reset all the compute items, forcing reevaluation.
   void reset();
 
+  /// Reset the compute items that depend on any of the tags in
+  /// `MutatedTagsList`, forcing their reevaluation. The tags must be items of
+  /// the underlying DataBox that were mutated. All other compute items keep
+  /// their values, so they are shared by everything that uses this
+  /// ObservationBox.
+  template <typename MutatedTagsList>
+  void reset_items_depending_on();
+
  private:
+  template <typename Tag, typename... MutatedTags>
+  static constexpr bool depends_on(tmpl::list<MutatedTags...> /*meta*/);
+
   template <typename Tag>
   const auto& get_item() const {
     return static_cast<const db::detail::Item<Tag>&>(*this);
@@ -160,6 +171,41 @@ void ObservationBox<tmpl::list<ComputeTags...>, DataBoxType>::reset() {
       });
 }
 
+template <typename DataBoxType, typename... ComputeTags>
+template <typename MutatedTagsList>
+void ObservationBox<tmpl::list<ComputeTags...>,
+                    DataBoxType>::reset_items_depending_on() {
+  tmpl::for_each<
+      tmpl::filter<tmpl::list<ComputeTags...>, db::is_compute_tag<tmpl::_1>>>(
+      [this](auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        if constexpr (depends_on<tag>(MutatedTagsList{})) {
+          static_cast<db::detail::Item<tag>&>(*this).reset();
+        }
+      });
+}
+
+template <typename DataBoxType, typename... ComputeTags>
+template <typename Tag, typename... MutatedTags>
+constexpr bool
+ObservationBox<tmpl::list<ComputeTags...>, DataBoxType>::depends_on(
+    tmpl::list<MutatedTags...> /*meta*/) {
+  if constexpr (std::is_same_v<Tag, ::Tags::DataBox> or
+                std::is_same_v<Tag, ::Tags::ObservationBox>) {
+    // The item can retrieve anything from the boxes
+    return true;
+  } else if constexpr (db::tag_is_retrievable_v<Tag, DataBoxType>) {
+    return (... or db::tag_depends_on_v<Tag, MutatedTags, DataBoxType>);
+  } else {
+    using item_tag = db::detail::first_matching_tag<compute_item_tags, Tag>;
+    return tmpl::as_pack<typename item_tag::argument_tags>(
+        [](auto... argument_tags_v) {
+          return (... or depends_on<tmpl::type_from<decltype(argument_tags_v)>>(
+                             tmpl::list<MutatedTags...>{}));
+        });
+  }
+}
+
 template <typename DataBoxType, typename... ComputeTags>
 template <typename ComputeTag, typename... ArgumentTags>
 void ObservationBox<tmpl::list<ComputeTags...>, DataBoxType>::
@@ -217,9 +263,8 @@ decltype(auto) mutate_apply(
     Args&&... args) {
   const CleanupRoutine reset_items = [&]() {
     if constexpr (sizeof...(ReturnTags) != 0) {
-      // Not ideal, but doing a more granular reset is not worth the
-      // trouble.
-      observation_box->reset();
+      observation_box->template reset_items_depending_on<
+          tmpl::list<ReturnTags...>>();
     }
   };
   return db::mutate_apply<tmpl::list<ReturnTags...>, tmpl::list<>>(
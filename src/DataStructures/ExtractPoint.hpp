@@ -4,12 +4,14 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \ingroup DataStructuresGroup
@@ -74,6 +76,31 @@ Variables<tmpl::list<Tags...>> extract_point(
 }
 /// @}
 
+#ifdef SPECTRE_USE_XSIMD
+/// \ingroup DataStructuresGroup
+/// Load the `simd::size<simd::batch<...>>()` consecutive points starting at
+/// `index` of each component of a `Tensor<DataVector>` into a
+/// `Tensor<simd::batch<double>>`.
+///
+/// \see overwrite_point, for_each_simd_batch
+template <typename VectorType, typename Arch, typename... Structure>
+void extract_point(
+    const gsl::not_null<
+        Tensor<simd::batch<typename VectorType::value_type, Arch>,
+               Structure...>*>
+        destination,
+    const Tensor<VectorType, Structure...>& source, const size_t index) {
+  ASSERT(index + simd::size<simd::batch<typename VectorType::value_type,
+                                        Arch>>() <=
+             source.begin()->size(),
+         "Cannot load a batch starting at point "
+             << index << " from " << source.begin()->size() << " points.");
+  for (size_t i = 0; i < destination->size(); ++i) {
+    (*destination)[i] = simd::load_unaligned<Arch>(&source[i][index]);
+  }
+}
+#endif  // SPECTRE_USE_XSIMD
+
 /// \ingroup DataStructuresGroup
 /// Copy a `Tensor<double>`, single point `Tensor<DataVector>`, or
 /// single-point `Variables<DataVector>` into the given index of each
@@ -113,3 +140,70 @@ void overwrite_point(
                0)...);
 }
 /// @}
+
+#ifdef SPECTRE_USE_XSIMD
+/// \ingroup DataStructuresGroup
+/// Store a `Tensor<simd::batch<double>>` into the
+/// `simd::size<simd::batch<...>>()` consecutive points starting at `index` of
+/// each component of a `Tensor<DataVector>`.
+///
+/// \see extract_point, for_each_simd_batch
+template <typename VectorType, typename Arch, typename... Structure>
+void overwrite_point(
+    const gsl::not_null<Tensor<VectorType, Structure...>*> destination,
+    const Tensor<simd::batch<typename VectorType::value_type, Arch>,
+                 Structure...>& source,
+    const size_t index) {
+  ASSERT(index + simd::size<simd::batch<typename VectorType::value_type,
+                                        Arch>>() <=
+             destination->begin()->size(),
+         "Cannot store a batch starting at point "
+             << index << " into " << destination->begin()->size()
+             << " points.");
+  for (size_t i = 0; i < destination->size(); ++i) {
+    simd::store_unaligned(&(*destination)[i][index], source[i]);
+  }
+}
+#endif  // SPECTRE_USE_XSIMD
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief Evaluate a pointwise computation over `number_of_points` grid points
+ * in SIMD batches.
+ *
+ * Calls `f(index, std::true_type{})` for each full `simd::batch<double>` of
+ * points starting at `index`, and `f(index, std::false_type{})` for each of
+ * the remaining points. The `std::integral_constant` argument selects the
+ * type `f` operates on (`simd::batch<double>` or `double`), so the usual
+ * pattern is
+ *
+ * \code
+ * for_each_simd_batch(size, [&](const size_t index, auto use_simd) {
+ *   using T = tmpl::conditional_t<decltype(use_simd)::value,
+ *                                 simd::batch<double>, double>;
+ *   Scalar<T> lapse{};
+ *   extract_point(make_not_null(&lapse), lapse_dv, index);
+ *   ...
+ *   overwrite_point(make_not_null(&result_dv), result, index);
+ * });
+ * \endcode
+ *
+ * This allows a whole chain of pointwise functions (e.g. the GR functions in
+ * `PointwiseFunctions/GeneralRelativity`) to be evaluated for a batch of
+ * points held in registers, instead of making one pass through memory per
+ * tensor component per function. Without xsimd all points are evaluated with
+ * `double`.
+ */
+template <typename F>
+void for_each_simd_batch(const size_t number_of_points, F&& f) {
+  size_t index = 0;
+#ifdef SPECTRE_USE_XSIMD
+  constexpr size_t simd_width = simd::size<simd::batch<double>>();
+  for (; index + simd_width <= number_of_points; index += simd_width) {
+    f(index, std::true_type{});
+  }
+#endif  // SPECTRE_USE_XSIMD
+  for (; index < number_of_points; ++index) {
+    f(index, std::false_type{});
+  }
+}
@@ -0,0 +1,191 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/ScratchArena.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace ScratchArena {
+namespace {
+// Cache-line alignment so that different allocations never share a line
+constexpr size_t alignment = 64;
+// Requests above this size are always served by the heap so that a single
+// very large temporary does not pin that much memory to every thread.
+constexpr size_t maximum_capacity = 256 * 1024 * 1024;
+
+size_t round_up(const size_t bytes) {
+  return (bytes + alignment - 1) / alignment * alignment;
+}
+
+void* aligned_new(const size_t bytes) {
+  return ::operator new(bytes, std::align_val_t{alignment});
+}
+
+void aligned_delete(void* const ptr) {
+  ::operator delete(ptr, std::align_val_t{alignment});
+}
+
+struct Counters {
+  std::atomic<size_t> bytes_from_arena{0};
+  std::atomic<size_t> bytes_from_heap{0};
+  std::atomic<size_t> allocations_from_arena{0};
+  std::atomic<size_t> allocations_from_heap{0};
+
+  void add_to(const gsl::not_null<Statistics*> result) const;
+  void reset();
+};
+
+void Counters::add_to(const gsl::not_null<Statistics*> result) const {
+  result->bytes_from_arena += bytes_from_arena.load(std::memory_order_relaxed);
+  result->bytes_from_heap += bytes_from_heap.load(std::memory_order_relaxed);
+  result->allocations_from_arena +=
+      allocations_from_arena.load(std::memory_order_relaxed);
+  result->allocations_from_heap +=
+      allocations_from_heap.load(std::memory_order_relaxed);
+}
+
+void Counters::reset() {
+  bytes_from_arena.store(0, std::memory_order_relaxed);
+  bytes_from_heap.store(0, std::memory_order_relaxed);
+  allocations_from_arena.store(0, std::memory_order_relaxed);
+  allocations_from_heap.store(0, std::memory_order_relaxed);
+}
+
+class ThreadArena;
+
+// All live thread arenas, plus the counters of arenas whose threads have
+// exited, so that the statistics can be aggregated over the whole process.
+struct Registry {
+  std::mutex mutex{};
+  std::vector<ThreadArena*> arenas{};
+  Statistics retired{};
+};
+
+Registry& registry() {
+  static Registry result{};
+  return result;
+}
+
+class ThreadArena {
+ public:
+  ThreadArena() {
+    const std::lock_guard lock(registry().mutex);
+    registry().arenas.push_back(this);
+  }
+
+  ThreadArena(const ThreadArena&) = delete;
+  ThreadArena& operator=(const ThreadArena&) = delete;
+  ThreadArena(ThreadArena&&) = delete;
+  ThreadArena& operator=(ThreadArena&&) = delete;
+
+  ~ThreadArena() {
+    ASSERT(outstanding_ == 0, "A thread exited with "
+                                  << outstanding_
+                                  << " scratch arena allocations outstanding.");
+    {
+      const std::lock_guard lock(registry().mutex);
+      auto& arenas = registry().arenas;
+      arenas.erase(std::find(arenas.begin(), arenas.end(), this));
+      counters.add_to(make_not_null(&registry().retired));
+    }
+    if (storage_ != nullptr) {
+      aligned_delete(storage_);
+    }
+  }
+
+  detail::Block allocate(const size_t bytes) {
+    const size_t padded_bytes = round_up(bytes);
+    ++outstanding_;
+    requested_ += padded_bytes;
+    if (offset_ + padded_bytes <= capacity_) {
+      void* const result = storage_ + offset_;  // NOLINT
+      offset_ += padded_bytes;
+      counters.bytes_from_arena.fetch_add(bytes, std::memory_order_relaxed);
+      counters.allocations_from_arena.fetch_add(1, std::memory_order_relaxed);
+      return {result, true};
+    }
+    counters.bytes_from_heap.fetch_add(bytes, std::memory_order_relaxed);
+    counters.allocations_from_heap.fetch_add(1, std::memory_order_relaxed);
+    return {aligned_new(padded_bytes), false};
+  }
+
+  void deallocate(const detail::Block& block) {
+    ASSERT(outstanding_ > 0,
+           "Releasing more scratch arena allocations than were made. Scratch "
+           "memory must be released on the thread that allocated it.");
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    ASSERT(not block.from_arena or
+               (block.data >= storage_ and block.data < storage_ + capacity_),
+           "Releasing scratch arena memory on a thread other than the one that "
+           "allocated it.");
+    if (not block.from_arena) {
+      aligned_delete(block.data);
+    }
+    --outstanding_;
+    if (outstanding_ == 0) {
+      rewind();
+    }
+  }
+
+  Counters counters{};
+
+ private:
+  // Called once nothing is allocated from the arena. Grows the storage so that
+  // everything requested since the last rewind would have fit.
+  void rewind() {
+    offset_ = 0;
+    if (requested_ > capacity_ and requested_ <= maximum_capacity) {
+      if (storage_ != nullptr) {
+        aligned_delete(storage_);
+      }
+      storage_ = static_cast<std::byte*>(aligned_new(requested_));
+      capacity_ = requested_;
+    }
+    requested_ = 0;
+  }
+
+  std::byte* storage_{nullptr};
+  size_t capacity_{0};
+  size_t offset_{0};
+  size_t outstanding_{0};
+  size_t requested_{0};
+};
+
+ThreadArena& local_arena() {
+  thread_local ThreadArena arena{};
+  return arena;
+}
+}  // namespace
+
+Statistics statistics() {
+  const std::lock_guard lock(registry().mutex);
+  Statistics result = registry().retired;
+  for (const ThreadArena* const arena : registry().arenas) {
+    arena->counters.add_to(make_not_null(&result));
+  }
+  return result;
+}
+
+void reset_statistics() {
+  const std::lock_guard lock(registry().mutex);
+  registry().retired = Statistics{};
+  for (ThreadArena* const arena : registry().arenas) {
+    // The counters are atomic, so resetting them from another thread is safe.
+    arena->counters.reset();
+  }
+}
+
+namespace detail {
+Block allocate(const size_t bytes) { return local_arena().allocate(bytes); }
+
+void deallocate(const Block& block) { local_arena().deallocate(block); }
+}  // namespace detail
+}  // namespace ScratchArena
@@ -0,0 +1,118 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief A per-thread bump allocator for short-lived scratch memory.
+ *
+ * \details Each thread owns a single contiguous block of memory. Allocations
+ * are served by bumping an offset into that block, and the block is rewound
+ * once every allocation made from it has been released. Since scratch buffers
+ * (e.g. `TempBuffer`s and the temporaries in the DG time derivative) only live
+ * for the duration of a single action, the arena is effectively reset at the
+ * end of each action and the same memory is reused for every element and
+ * substep handled by the thread, avoiding calls to `malloc`/`free` and the
+ * associated allocator contention between threads.
+ *
+ * When a request does not fit in the remaining space of the block it is served
+ * from the heap instead. The amount of memory requested between two rewinds is
+ * tracked, and the block is grown to that size on the next rewind so that
+ * subsequent identical workloads are served entirely from the arena.
+ *
+ * Memory must be released on the thread that allocated it, and allocations
+ * should not be stored beyond the scope of the function that requested them,
+ * since any outstanding allocation prevents the arena from being rewound.
+ */
+namespace ScratchArena {
+/// Number of bytes and allocations served from the arenas and from the heap,
+/// summed over all threads since the last call to `reset_statistics()`.
+struct Statistics {
+  size_t bytes_from_arena{0};
+  size_t bytes_from_heap{0};
+  size_t allocations_from_arena{0};
+  size_t allocations_from_heap{0};
+};
+
+/// The statistics accumulated over all threads in this process.
+Statistics statistics();
+
+/// Zero the statistics of all threads in this process.
+void reset_statistics();
+
+namespace detail {
+struct Block {
+  void* data{nullptr};
+  bool from_arena{false};
+};
+
+Block allocate(size_t bytes);
+
+void deallocate(const Block& block);
+}  // namespace detail
+
+/*!
+ * \brief Uninitialized storage for `size` objects of type `T` obtained from the
+ * calling thread's arena.
+ *
+ * The memory is returned to the arena when the `Allocation` is destroyed.
+ */
+template <typename T>
+class Allocation {
+  static_assert(std::is_trivially_destructible_v<T>,
+                "ScratchArena::Allocation only holds trivially destructible "
+                "types since no destructors are run on the storage.");
+
+ public:
+  Allocation() = default;
+  explicit Allocation(const size_t size)
+      : block_(size == 0 ? detail::Block{}
+                         : detail::allocate(sizeof(T) * size)),
+        size_(size) {}
+  Allocation(const Allocation&) = delete;
+  Allocation& operator=(const Allocation&) = delete;
+  Allocation(Allocation&& rhs) : block_(rhs.block_), size_(rhs.size_) {
+    rhs.block_ = detail::Block{};
+    rhs.size_ = 0;
+  }
+  Allocation& operator=(Allocation&& rhs) {
+    if (this != &rhs) {
+      release();
+      block_ = rhs.block_;
+      size_ = rhs.size_;
+      rhs.block_ = detail::Block{};
+      rhs.size_ = 0;
+    }
+    return *this;
+  }
+  ~Allocation() { release(); }
+
+  T* data() { return static_cast<T*>(block_.data); }
+  const T* data() const { return static_cast<const T*>(block_.data); }
+  size_t size() const { return size_; }
+  /// Whether the memory was served from the arena rather than the heap
+  bool from_arena() const { return block_.from_arena; }
+
+  T& operator[](const size_t i) {
+    return data()[i];  // NOLINT
+  }
+  const T& operator[](const size_t i) const {
+    return data()[i];  // NOLINT
+  }
+
+ private:
+  void release() {
+    if (block_.data != nullptr) {
+      detail::deallocate(block_);
+      block_ = detail::Block{};
+    }
+  }
+
+  detail::Block block_{};
+  size_t size_{0};
+};
+}  // namespace ScratchArena
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <limits>
@@ -84,3 +85,77 @@ auto volume_and_slice_indices(const Index<VolumeDim>& extents)
                  std::array<std::pair<gsl::span<std::pair<size_t, size_t>>,
                                       gsl::span<std::pair<size_t, size_t>>>,
                             VolumeDim>>;
+
+/// @{
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief Copy (or add) the points on a codimension 1 slice between volume and
+ * slice data of `number_of_components` contiguous components.
+ *
+ * \details The slice has a constant logical coordinate `fixed_index` in
+ * direction `sliced_dim`. The volume components have `extents.product()`
+ * points each and the slice components
+ * `extents.slice_away(sliced_dim).product()` points each. This gives the same
+ * result as iterating a `SliceIterator` over every component, but the slice is
+ * visited as runs of points that are contiguous in the volume, one component
+ * at a time. This needs no index computations per point and lets the copies
+ * vectorize, except when slicing away the fastest-varying dimension, where each
+ * run is a single point.
+ *
+ * The data are passed as raw pointers since they are `nullptr` for empty
+ * `Variables`.
+ */
+template <size_t Dim, typename T>
+void copy_volume_to_slice(T* const slice_data,
+                          const T* const volume_data, const Index<Dim>& extents,
+                          const size_t sliced_dim, const size_t fixed_index,
+                          const size_t number_of_components) {
+  size_t run_length = 1;
+  for (size_t d = 0; d < sliced_dim; ++d) {
+    run_length *= extents[d];
+  }
+  const size_t volume_size = extents.product();
+  const size_t run_stride = run_length * extents[sliced_dim];
+  const size_t number_of_runs = volume_size / run_stride;
+  const size_t slice_size = run_length * number_of_runs;
+  for (size_t component = 0; component < number_of_components; ++component) {
+    const size_t volume_offset =
+        component * volume_size + fixed_index * run_length;
+    const size_t slice_offset = component * slice_size;
+    for (size_t run = 0; run < number_of_runs; ++run) {
+      // clang-tidy: do not use pointer arithmetic
+      std::copy_n(volume_data + volume_offset + run * run_stride,  // NOLINT
+                  run_length,
+                  slice_data + slice_offset +  // NOLINT
+                      run * run_length);
+    }
+  }
+}
+
+template <size_t Dim, typename T>
+void add_slice_to_volume(T* const volume_data,
+                         const T* const slice_data, const Index<Dim>& extents,
+                         const size_t sliced_dim, const size_t fixed_index,
+                         const size_t number_of_components) {
+  size_t run_length = 1;
+  for (size_t d = 0; d < sliced_dim; ++d) {
+    run_length *= extents[d];
+  }
+  const size_t volume_size = extents.product();
+  const size_t run_stride = run_length * extents[sliced_dim];
+  const size_t number_of_runs = volume_size / run_stride;
+  const size_t slice_size = run_length * number_of_runs;
+  for (size_t component = 0; component < number_of_components; ++component) {
+    const size_t volume_offset =
+        component * volume_size + fixed_index * run_length;
+    const size_t slice_offset = component * slice_size;
+    for (size_t run = 0; run < number_of_runs; ++run) {
+      for (size_t i = 0; i < run_length; ++i) {
+        // clang-tidy: do not use pointer arithmetic
+        volume_data[volume_offset + run * run_stride + i] +=  // NOLINT
+            slice_data[slice_offset + run * run_length + i];        // NOLINT
+      }
+    }
+  }
+}
+/// @}
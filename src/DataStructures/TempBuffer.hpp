@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Utilities/MakeSignalingNan.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -23,6 +26,11 @@
  * Variables.  If DataType is a fundamental type, then TempBuffer is a
  * TaggedTuple.
  *
+ * The memory of a Variables-based TempBuffer is taken from the calling
+ * thread's `ScratchArena`, so constructing one in a function called for every
+ * element does not allocate once the arena has grown to the required size.
+ * As a consequence, a TempBuffer can be neither copied nor moved and should
+ * not outlive the function that created it.
  */
 template <typename TagList,
           bool is_fundamental = std::is_fundamental_v<
@@ -37,7 +45,45 @@ struct TempBuffer<TagList, true> : tuples::tagged_tuple_from_typelist<TagList> {
   static size_t number_of_grid_points() { return 1; }
 };
 
+namespace TempBuffer_detail {
+// Holds the arena memory so that it is acquired before, and released after,
+// the non-owning Variables that points into it.
 template <typename TagList>
-struct TempBuffer<TagList, false> : Variables<TagList> {
-  using Variables<TagList>::Variables;
+struct ArenaStorage {
+  explicit ArenaStorage(const size_t number_of_grid_points)
+      : allocation(Variables<TagList>::number_of_independent_components *
+                   number_of_grid_points) {}
+
+  ScratchArena::Allocation<typename Variables<TagList>::value_type> allocation;
+};
+}  // namespace TempBuffer_detail
+
+template <typename TagList>
+struct TempBuffer<TagList, false> : private TempBuffer_detail::ArenaStorage<
+                                        TagList>,
+                                    Variables<TagList> {
+  explicit TempBuffer(const size_t number_of_grid_points)
+      : TempBuffer_detail::ArenaStorage<TagList>(number_of_grid_points),
+        Variables<TagList>(this->allocation.data(), this->allocation.size()) {
+#if defined(SPECTRE_DEBUG) || defined(SPECTRE_NAN_INIT)
+    std::fill(
+        this->allocation.data(),
+        this->allocation.data() + this->allocation.size(),  // NOLINT
+        make_signaling_NaN<typename Variables<TagList>::value_type>());
+#endif  // SPECTRE_DEBUG
+  }
+
+  TempBuffer(const size_t number_of_grid_points,
+             const typename Variables<TagList>::value_type value)
+      : TempBuffer(number_of_grid_points) {
+    std::fill(this->allocation.data(),
+              this->allocation.data() + this->allocation.size(),  // NOLINT
+              value);
+  }
+
+  TempBuffer(const TempBuffer&) = delete;
+  TempBuffer& operator=(const TempBuffer&) = delete;
+  TempBuffer(TempBuffer&&) = delete;
+  TempBuffer& operator=(TempBuffer&&) = delete;
+  ~TempBuffer() = default;
 };
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <blaze/math/Subvector.h>
 #include <complex>
 #include <cstddef>
 #include <type_traits>
@@ -30,6 +32,11 @@
 
 namespace tenex {
 namespace detail {
+// Number of grid points for which all LHS components are evaluated before
+// moving on to the next block of grid points, see `evaluate_impl`. A block of
+// this size of a few tensor components fits in the L1 cache.
+constexpr size_t evaluation_block_size = 256;
+
 template <size_t NumIndices>
 constexpr bool contains_indices_to_contract(
     const std::array<size_t, NumIndices>& tensorindices) {
@@ -269,24 +276,79 @@ void evaluate_impl(
   using rhs_expression_type =
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
 
+  // Computes the RHS multi-index that corresponds to the LHS multi-index
+  const auto get_rhs_multi_index =
+      [&index_transformation, &lhs_spatial_spacetime_index_positions,
+       &rhs_spatial_spacetime_index_positions](auto lhs_multi_index) {
+        for (size_t j = 0; j < lhs_spatial_spacetime_index_positions.size();
+             j++) {
+          gsl::at(lhs_multi_index,
+                  gsl::at(lhs_spatial_spacetime_index_positions, j)) -= 1;
+        }
+        auto rhs_multi_index =
+            transform_multi_index(lhs_multi_index, index_transformation);
+        for (size_t j = 0; j < rhs_spatial_spacetime_index_positions.size();
+             j++) {
+          gsl::at(rhs_multi_index,
+                  gsl::at(rhs_spatial_spacetime_index_positions, j)) += 1;
+        }
+        return rhs_multi_index;
+      };
+
+  // When the expression is not split up and the components are long vectors,
+  // evaluate all LHS components for one block of grid points at a time. This
+  // way the RHS tensor components that are shared between LHS components are
+  // still in cache when they are reused, instead of streaming through memory
+  // once per LHS component.
+  if constexpr (not EvaluateSubtrees and
+                is_derived_of_vector_impl_v<LhsDataType> and
+                is_derived_of_vector_impl_v<RhsDataType> and
+                lhs_tensor_type::size() > 1) {
+    const size_t component_size =
+        (~rhs_tensorexpression).get_rhs_tensor_component_size();
+    if (component_size > evaluation_block_size) {
+      if (component_size != (*lhs_tensor)[0].size()) {
+        for (auto& lhs_component : *lhs_tensor) {
+          lhs_component = LhsDataType(component_size);
+        }
+      }
+      std::array<bool, lhs_tensor_type::size()> is_evaluated{};
+      std::array<std::array<size_t, num_rhs_indices>, lhs_tensor_type::size()>
+          rhs_multi_indices{};
+      for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
+        const auto lhs_multi_index =
+            lhs_tensor_type::structure::get_canonical_tensor_index(i);
+        gsl::at(is_evaluated, i) = is_evaluated_lhs_multi_index(
+            lhs_multi_index, lhs_spatial_spacetime_index_positions,
+            lhs_time_index_positions);
+        if (gsl::at(is_evaluated, i)) {
+          gsl::at(rhs_multi_indices, i) = get_rhs_multi_index(lhs_multi_index);
+        }
+      }
+      for (size_t offset = 0; offset < component_size;
+           offset += evaluation_block_size) {
+        const size_t block_size =
+            std::min(evaluation_block_size, component_size - offset);
+        for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
+          if (gsl::at(is_evaluated, i)) {
+            blaze::subvector((*lhs_tensor)[i], offset, block_size) =
+                blaze::subvector(
+                    (~rhs_tensorexpression).get(gsl::at(rhs_multi_indices, i)),
+                    offset, block_size);
+          }
+        }
+      }
+      return;
+    }
+  }
+
   for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
-    auto lhs_multi_index =
+    const auto lhs_multi_index =
         lhs_tensor_type::structure::get_canonical_tensor_index(i);
     if (is_evaluated_lhs_multi_index(lhs_multi_index,
                                      lhs_spatial_spacetime_index_positions,
                                      lhs_time_index_positions)) {
-      for (size_t j = 0; j < lhs_spatial_spacetime_index_positions.size();
-           j++) {
-        gsl::at(lhs_multi_index,
-                gsl::at(lhs_spatial_spacetime_index_positions, j)) -= 1;
-      }
-      auto rhs_multi_index =
-          transform_multi_index(lhs_multi_index, index_transformation);
-      for (size_t j = 0; j < rhs_spatial_spacetime_index_positions.size();
-           j++) {
-        gsl::at(rhs_multi_index,
-                gsl::at(rhs_spatial_spacetime_index_positions, j)) += 1;
-      }
+      const auto rhs_multi_index = get_rhs_multi_index(lhs_multi_index);
 
       // The expression will either be evaluated as one whole expression
       // or it will be split up into subtrees that are evaluated one at a time.
@@ -113,11 +113,17 @@ void bind_tensor_impl(py::module& m, const std::string& name) {  // NOLINT
               // Keep object alive while iterator exists
               py::keep_alive<0, 1>())
           .def("__len__", [](const TensorType& t) { return t.size(); })
-          .def("__getitem__",
-               [](const TensorType& t, const size_t i) {
-                 bounds_check(t, i);
-                 return t[i];
-               })
+          // Components are returned as views into the tensor's data rather
+          // than copies, so e.g. `np.asarray(tensor[i])` doesn't copy. The
+          // tensor is kept alive while a view exists.
+          .def(
+              "__getitem__",
+              [](TensorType& t,
+                 const size_t i) -> typename TensorType::reference {
+                bounds_check(t, i);
+                return t[i];
+              },
+              py::return_value_policy::reference_internal)
           .def("__setitem__",
                [](TensorType& t, const size_t i,
                   const typename TensorType::type& v) {
@@ -136,7 +142,8 @@ void bind_tensor_impl(py::module& m, const std::string& name) {  // NOLINT
                 return t.component_suffix(storage_index);
               },
               py::arg("storage_index"))
-          .def("get", &GetImpl<TensorType>::get)
+          .def("get", &GetImpl<TensorType>::get,
+               py::return_value_policy::reference_internal)
           .def("get_storage_index", &GetImpl<TensorType>::get_storage_index)
           // NOLINTNEXTLINE(misc-redundant-expression)
           .def(py::self == py::self)
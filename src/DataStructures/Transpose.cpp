@@ -2,6 +2,8 @@
 // See LICENSE.txt for details.
 
 #include "DataStructures/Transpose.hpp"
+
+#include <algorithm>
 #include <type_traits>
 
 #if defined(__SSE2__)
@@ -314,63 +316,82 @@ void transpose_block<1, 1>(double* __restrict__ matrix_transpose,
   *matrix_transpose = *matrix;
 }
 
+// The number of columns of the matrix that are transposed together. Each
+// column is a row of the transpose, so this bounds the number of output
+// streams that have to stay in cache while the rows of the matrix are read.
+constexpr int32_t column_tile_size = 32;
+
 template <int32_t BlockSize, int32_t RowExcess, int32_t ColumnExcess>
 void transpose_impl(double* __restrict__ matrix_transpose,  //
                     const double* __restrict__ const matrix,
                     const int32_t in_number_of_rows,
                     const int32_t in_number_of_columns) {
+  static_assert(column_tile_size % BlockSize == 0);
   const int32_t bound_on_rows = in_number_of_rows - RowExcess;
   const int32_t bound_on_columns = in_number_of_columns - ColumnExcess;
 
-  for (int32_t row_index = 0UL; row_index < bound_on_rows;
-       row_index += BlockSize) {
-    for (int32_t column_index = 0UL; column_index < bound_on_columns;
-         column_index += BlockSize) {
-      if constexpr (BlockSize != 1) {
-        transpose_block<BlockSize, BlockSize>(
-            matrix_transpose + row_index + in_number_of_rows * column_index,
-            matrix + column_index + in_number_of_columns * row_index,
-            in_number_of_columns, in_number_of_rows);
-      } else {
-        static_assert(BlockSize == 1);
-        static_assert(RowExcess == 0);
-        static_assert(ColumnExcess == 0);
-        transpose_block<1, 1>(
+  // The excess columns are handled with the last tile. There is always at
+  // least one tile, even if there are only excess columns.
+  for (int32_t tile_begin = 0;
+       tile_begin == 0 or tile_begin < bound_on_columns;
+       tile_begin += column_tile_size) {
+    const int32_t tile_end =
+        std::min(tile_begin + column_tile_size, bound_on_columns);
+    const bool is_last_tile = tile_end == bound_on_columns;
+    for (int32_t row_index = 0; row_index < bound_on_rows;
+         row_index += BlockSize) {
+      for (int32_t column_index = tile_begin; column_index < tile_end;
+           column_index += BlockSize) {
+        if constexpr (BlockSize != 1) {
+          transpose_block<BlockSize, BlockSize>(
+              matrix_transpose + row_index + in_number_of_rows * column_index,
+              matrix + column_index + in_number_of_columns * row_index,
+              in_number_of_columns, in_number_of_rows);
+        } else {
+          static_assert(BlockSize == 1);
+          static_assert(RowExcess == 0);
+          static_assert(ColumnExcess == 0);
+          transpose_block<1, 1>(
+              matrix_transpose + row_index + in_number_of_rows * column_index,
+              matrix + column_index + in_number_of_columns * row_index,
+              in_number_of_columns, in_number_of_rows);
+        }
+      }
+      // Handle remainder in row, that is, deal with extra columns.
+      if constexpr (BlockSize > 1 and ColumnExcess != 0) {
+        if (is_last_tile) {
+          const int32_t column_index = bound_on_columns;
+          transpose_block<BlockSize, ColumnExcess>(
+              matrix_transpose + row_index + in_number_of_rows * column_index,
+              matrix + column_index + in_number_of_columns * row_index,
+              in_number_of_columns, in_number_of_rows);
+        }
+      }
+    }
+
+    // Now deal with excess in either the columns or rows.
+    //
+    // We have the choice of either having the extra loops of the inner index
+    // (currently row_index)  inside the main loop above or down below. This is
+    // a tradeoff between data cache and instruction cache.
+    if constexpr (BlockSize > 1 and RowExcess != 0) {
+      const int32_t row_index = bound_on_rows;
+      for (int32_t column_index = tile_begin; column_index < tile_end;
+           column_index += BlockSize) {
+        transpose_block<RowExcess, BlockSize>(
             matrix_transpose + row_index + in_number_of_rows * column_index,
             matrix + column_index + in_number_of_columns * row_index,
             in_number_of_columns, in_number_of_rows);
       }
-    }
-    // Handle remainder in row, that is, deal with extra columns.
-    if constexpr (BlockSize > 1 and ColumnExcess != 0) {
-      const int32_t column_index = bound_on_columns;
-      transpose_block<BlockSize, ColumnExcess>(
-          matrix_transpose + row_index + in_number_of_rows * column_index,
-          matrix + column_index + in_number_of_columns * row_index,
-          in_number_of_columns, in_number_of_rows);
-    }
-  }
-
-  // Now deal with excess in either the columns or rows.
-  //
-  // We have the choice of either having the extra loops of the inner index
-  // (currently row_index)  inside the main loop above or down below. This is a
-  // tradeoff between data cache and instruction cache.
-  if constexpr (BlockSize > 1 and RowExcess != 0) {
-    const int32_t row_index = bound_on_rows;
-    for (int32_t column_index = 0UL; column_index < bound_on_columns;
-         column_index += BlockSize) {
-      transpose_block<RowExcess, BlockSize>(
-          matrix_transpose + row_index + in_number_of_rows * column_index,
-          matrix + column_index + in_number_of_columns * row_index,
-          in_number_of_columns, in_number_of_rows);
-    }
-    if constexpr (ColumnExcess != 0) {
-      const int32_t column_index = bound_on_columns;
-      transpose_block<RowExcess, ColumnExcess>(
-          matrix_transpose + row_index + in_number_of_rows * column_index,
-          matrix + column_index + in_number_of_columns * row_index,
-          in_number_of_columns, in_number_of_rows);
+      if constexpr (ColumnExcess != 0) {
+        if (is_last_tile) {
+          const int32_t column_index = bound_on_columns;
+          transpose_block<RowExcess, ColumnExcess>(
+              matrix_transpose + row_index + in_number_of_rows * column_index,
+              matrix + column_index + in_number_of_columns * row_index,
+              in_number_of_columns, in_number_of_rows);
+        }
+      }
     }
   }
 }
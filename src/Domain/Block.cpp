@@ -11,12 +11,15 @@
 #include <typeinfo>
 #include <utility>
 
+#include "Domain/CoordinateMaps/Composition.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/Structure/BlockNeighbor.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionMap.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/TMPL.hpp"
 
 template <size_t VolumeDim>
 Block<VolumeDim>::Block(
@@ -36,6 +39,7 @@ Block<VolumeDim>::Block(
       external_boundaries_.emplace(direction);
     }
   }
+  make_element_block_maps();
 }
 
 template <size_t VolumeDim>
@@ -114,6 +118,27 @@ void Block<VolumeDim>::inject_time_dependent_map(
   moving_mesh_distorted_to_inertial_map_ =
       std::move(moving_mesh_distorted_to_inertial_map);
   stationary_map_ = nullptr;
+  make_element_block_maps();
+}
+
+template <size_t VolumeDim>
+void Block<VolumeDim>::make_element_block_maps() {
+  if (stationary_map_ == nullptr and
+      moving_mesh_logical_to_grid_map_ == nullptr) {
+    element_block_map_to_grid_ = nullptr;
+    element_block_map_to_inertial_ = nullptr;
+  } else if (is_time_dependent()) {
+    using CompositionType = domain::CoordinateMaps::Composition<
+        tmpl::list<Frame::BlockLogical, Frame::Grid, Frame::Inertial>,
+        VolumeDim>;
+    element_block_map_to_grid_ = moving_mesh_logical_to_grid_map_->get_clone();
+    element_block_map_to_inertial_ = std::make_shared<const CompositionType>(
+        moving_mesh_logical_to_grid_map_->get_clone(),
+        moving_mesh_grid_to_inertial_map_->get_clone());
+  } else {
+    element_block_map_to_grid_ = stationary_map_->get_to_grid_frame();
+    element_block_map_to_inertial_ = stationary_map_->get_clone();
+  }
 }
 
 template <size_t VolumeDim>
@@ -136,6 +161,9 @@ void Block<VolumeDim>::pup(PUP::er& p) {
   if (version >= 1) {
     p | name_;
   }
+  if (p.isUnpacking()) {
+    make_element_block_maps();
+  }
 }
 
 template <size_t VolumeDim>
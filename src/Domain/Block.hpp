@@ -10,6 +10,7 @@
 #include <iosfwd>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
 
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"
@@ -101,6 +102,28 @@ class Block {
   const domain::CoordinateMapBase<Frame::Distorted, Frame::Inertial, VolumeDim>&
   moving_mesh_distorted_to_inertial_map() const;
 
+  /// \brief The map from the block logical frame to `TargetFrame`, which is
+  /// `Frame::Grid` or `Frame::Inertial`, that the `ElementMap`s of all
+  /// elements in this block share.
+  ///
+  /// \details For time-dependent blocks the map to the inertial frame is the
+  /// composition of moving_mesh_logical_to_grid_map() and
+  /// moving_mesh_grid_to_inertial_map(). Since the map is immutable, elements
+  /// on the same node share it instead of each holding a clone.
+  template <typename TargetFrame>
+  const std::shared_ptr<const domain::CoordinateMapBase<
+      Frame::BlockLogical, TargetFrame, VolumeDim>>&
+  element_block_map() const {
+    static_assert(std::is_same_v<TargetFrame, Frame::Grid> or
+                      std::is_same_v<TargetFrame, Frame::Inertial>,
+                  "The element block map goes to the grid or inertial frame.");
+    if constexpr (std::is_same_v<TargetFrame, Frame::Grid>) {
+      return element_block_map_to_grid_;
+    } else {
+      return element_block_map_to_inertial_;
+    }
+  }
+
   /// \brief Returns `true` if the block has time-dependent maps.
   bool is_time_dependent() const { return stationary_map_ == nullptr; }
 
@@ -164,6 +187,8 @@ class Block {
   void pup(PUP::er& p);
 
  private:
+  void make_element_block_maps();
+
   template <size_t LocalVolumeDim>
   // NOLINTNEXTLINE(readability-redundant-declaration)
   friend bool operator==(const Block<LocalVolumeDim>& lhs,
@@ -184,6 +209,14 @@ class Block {
   std::unique_ptr<
       domain::CoordinateMapBase<Frame::Distorted, Frame::Inertial, VolumeDim>>
       moving_mesh_distorted_to_inertial_map_{nullptr};
+  // Not serialized but recreated from the maps above by
+  // `make_element_block_maps()`
+  std::shared_ptr<const domain::CoordinateMapBase<Frame::BlockLogical,
+                                                  Frame::Grid, VolumeDim>>
+      element_block_map_to_grid_{nullptr};
+  std::shared_ptr<const domain::CoordinateMapBase<Frame::BlockLogical,
+                                                  Frame::Inertial, VolumeDim>>
+      element_block_map_to_inertial_{nullptr};
 
   size_t id_{0};
   DirectionMap<VolumeDim, BlockNeighbor<VolumeDim>> neighbors_;
@@ -3,19 +3,60 @@
 
 #include "Domain/BlockLogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Block.hpp"
+#include "Domain/BlockSearchTree.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/InverseWithInitialGuess.hpp"
 #include "Domain/Domain.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/Structure/BlockId.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Returns `false` if the point is outside the block-logical cube
+template <size_t Dim>
+bool clamp_to_logical_cube(
+    const gsl::not_null<tnsr::I<double, Dim, ::Frame::BlockLogical>*>
+        logical_point) {
+  for (size_t d = 0; d < Dim; ++d) {
+    // Map inverses may report logical coordinates outside [-1, 1] due to
+    // numerical roundoff error. In that case we clamp them to -1 or 1 so
+    // that a consistent block is chosen here independent of roundoff error.
+    // Without this correction, points on block boundaries where both blocks
+    // report logical coordinates outside [-1, 1] by roundoff error would
+    // not be assigned to any block at all, even though they lie in the
+    // domain.
+    if (equal_within_roundoff(logical_point->get(d), 1.0)) {
+      logical_point->get(d) = 1.0;
+      continue;
+    }
+    if (equal_within_roundoff(logical_point->get(d), -1.0)) {
+      logical_point->get(d) = -1.0;
+      continue;
+    }
+    if (abs(logical_point->get(d)) > 1.0) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
 
 template <size_t Dim, typename Fr>
 std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>>
@@ -109,25 +150,8 @@ block_logical_coordinates_single_point(
     return std::nullopt;
   }
 
-  for (size_t d = 0; d < Dim; ++d) {
-    // Map inverses may report logical coordinates outside [-1, 1] due to
-    // numerical roundoff error. In that case we clamp them to -1 or 1 so
-    // that a consistent block is chosen here independent of roundoff error.
-    // Without this correction, points on block boundaries where both blocks
-    // report logical coordinates outside [-1, 1] by roundoff error would
-    // not be assigned to any block at all, even though they lie in the
-    // domain.
-    if (equal_within_roundoff(logical_point->get(d), 1.0)) {
-      logical_point->get(d) = 1.0;
-      continue;
-    }
-    if (equal_within_roundoff(logical_point->get(d), -1.0)) {
-      logical_point->get(d) = -1.0;
-      continue;
-    }
-    if (abs(logical_point->get(d)) > 1.0) {
-      return std::nullopt;
-    }
+  if (not clamp_to_logical_cube(make_not_null(&logical_point.value()))) {
+    return std::nullopt;
   }
 
   return logical_point;
@@ -139,25 +163,61 @@ std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
     const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
   const size_t num_pts = get<0>(x).size();
   std::vector<BlockLogicalCoords<Dim>> block_coord_holders(num_pts);
+  // Narrowing down the candidate blocks with a search tree pays off once
+  // there are more points than the tree maps to the frame in each block
+  std::optional<domain::BlockSearchTree<Dim, Fr>> search_tree{};
+  if (domain.blocks().size() > 1 and
+      num_pts >= domain::BlockSearchTree<Dim, Fr>::samples_per_block) {
+    search_tree.emplace(domain, time, functions_of_time);
+  }
+  std::vector<size_t> candidate_block_ids{};
   for (size_t s = 0; s < num_pts; ++s) {
     tnsr::I<double, Dim, Fr> x_frame(0.0);
     for (size_t d = 0; d < Dim; ++d) {
       x_frame.get(d) = x.get(d)[s];
     }
-    // Check which block this point is in. Each point will be in one
-    // and only one block, unless it is on a shared boundary.  In that
-    // case, choose the first matching block (and this block will have
-    // the smallest block_id).
-    for (const auto& block : domain.blocks()) {
+    const auto is_in_block = [&block_coord_holders, &s, &x_frame, &time,
+                              &functions_of_time](const Block<Dim>& block) {
       std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>> x_logical =
           block_logical_coordinates_single_point(x_frame, block, time,
                                                  functions_of_time);
-
       if (x_logical.has_value()) {
-        // Point is in this block.  Don't bother checking subsequent
-        // blocks.
         block_coord_holders[s] = make_id_pair(domain::BlockId(block.id()),
                                               std::move(x_logical.value()));
+        return true;
+      }
+      return false;
+    };
+    // Check which block this point is in. Each point will be in one
+    // and only one block, unless it is on a shared boundary.  In that
+    // case, choose the first matching block (and this block will have
+    // the smallest block_id).
+    if (not search_tree.has_value()) {
+      for (const auto& block : domain.blocks()) {
+        if (is_in_block(block)) {
+          // Point is in this block.  Don't bother checking subsequent
+          // blocks.
+          break;
+        }
+      }
+      continue;
+    }
+    search_tree->candidate_blocks(make_not_null(&candidate_block_ids),
+                                  x_frame);
+    const bool found_in_candidate = alg::any_of(
+        candidate_block_ids, [&domain, &is_in_block](const size_t block_id) {
+          return is_in_block(domain.blocks()[block_id]);
+        });
+    if (found_in_candidate) {
+      continue;
+    }
+    // The bounding boxes in the search tree are not guaranteed to enclose
+    // the blocks, so check the other blocks as well before concluding that
+    // the point is outside the domain
+    for (const auto& block : domain.blocks()) {
+      if (not std::binary_search(candidate_block_ids.begin(),
+                                 candidate_block_ids.end(), block.id()) and
+          is_in_block(block)) {
         break;
       }
     }
@@ -165,6 +225,123 @@ std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
   return block_coord_holders;
 }
 
+template <size_t Dim, typename Fr>
+std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Fr>& x,
+    const std::vector<BlockLogicalCoords<Dim>>& initial_guess,
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+  const size_t num_pts = get<0>(x).size();
+  ASSERT(initial_guess.size() == num_pts,
+         "The initial guess has " << initial_guess.size()
+                                  << " points but there are " << num_pts
+                                  << " points.");
+  std::vector<BlockLogicalCoords<Dim>> block_coord_holders(num_pts);
+  // Points are first inverted in the block of their initial guess
+  std::vector<std::vector<size_t>> points_in_blocks(domain.blocks().size());
+  std::vector<size_t> remaining_points{};
+  for (size_t s = 0; s < num_pts; ++s) {
+    if (initial_guess[s].has_value()) {
+      points_in_blocks[initial_guess[s]->id.get_index()].push_back(s);
+    } else {
+      remaining_points.push_back(s);
+    }
+  }
+  for (const auto& block : domain.blocks()) {
+    const auto& points_in_block = points_in_blocks[block.id()];
+    const size_t num_pts_in_block = points_in_block.size();
+    if (num_pts_in_block == 0) {
+      continue;
+    }
+    if constexpr (std::is_same_v<Fr, ::Frame::Distorted>) {
+      if (not block.has_distorted_frame()) {
+        remaining_points.insert(remaining_points.end(),
+                                points_in_block.begin(),
+                                points_in_block.end());
+        continue;
+      }
+    }
+    tnsr::I<DataVector, Dim, Fr> x_in_block{num_pts_in_block};
+    tnsr::I<DataVector, Dim, ::Frame::BlockLogical> x_logical{
+        num_pts_in_block};
+    for (size_t i = 0; i < num_pts_in_block; ++i) {
+      const size_t s = points_in_block[i];
+      for (size_t d = 0; d < Dim; ++d) {
+        x_in_block.get(d)[i] = x.get(d)[s];
+        x_logical.get(d)[i] = initial_guess[s]->data.get(d);
+      }
+    }
+    std::vector<bool> converged{};
+    if (block.is_time_dependent()) {
+      if constexpr (std::is_same_v<Fr, ::Frame::Grid>) {
+        converged = domain::inverse_with_initial_guess(
+            make_not_null(&x_logical), block.moving_mesh_logical_to_grid_map(),
+            x_in_block);
+      } else {
+        // Invert the time-dependent map first, starting at the grid
+        // coordinates of the initial guess, and then the map to the grid
+        auto x_grid = block.moving_mesh_logical_to_grid_map()(x_logical);
+        if constexpr (std::is_same_v<Fr, ::Frame::Inertial>) {
+          converged = domain::inverse_with_initial_guess(
+              make_not_null(&x_grid), block.moving_mesh_grid_to_inertial_map(),
+              x_in_block, time, functions_of_time);
+        } else {
+          converged = domain::inverse_with_initial_guess(
+              make_not_null(&x_grid),
+              block.moving_mesh_grid_to_distorted_map(), x_in_block, time,
+              functions_of_time);
+        }
+        const auto converged_to_logical = domain::inverse_with_initial_guess(
+            make_not_null(&x_logical), block.moving_mesh_logical_to_grid_map(),
+            x_grid);
+        for (size_t i = 0; i < num_pts_in_block; ++i) {
+          converged[i] = converged[i] and converged_to_logical[i];
+        }
+      }
+    } else {
+      // The grid, distorted and inertial frames are the same for
+      // time-independent maps
+      tnsr::I<DataVector, Dim, ::Frame::Inertial> x_inertial{};
+      for (size_t d = 0; d < Dim; ++d) {
+        x_inertial.get(d) = x_in_block.get(d);
+      }
+      converged = domain::inverse_with_initial_guess(
+          make_not_null(&x_logical), block.stationary_map(), x_inertial);
+    }
+    for (size_t i = 0; i < num_pts_in_block; ++i) {
+      const size_t s = points_in_block[i];
+      tnsr::I<double, Dim, ::Frame::BlockLogical> x_logical_point{};
+      for (size_t d = 0; d < Dim; ++d) {
+        x_logical_point.get(d) = x_logical.get(d)[i];
+      }
+      if (converged[i] and
+          clamp_to_logical_cube(make_not_null(&x_logical_point))) {
+        block_coord_holders[s] = make_id_pair(domain::BlockId(block.id()),
+                                              std::move(x_logical_point));
+      } else {
+        remaining_points.push_back(s);
+      }
+    }
+  }
+  if (remaining_points.empty()) {
+    return block_coord_holders;
+  }
+  // Search all blocks for the points without an initial guess, and for those
+  // that have moved out of the block of their initial guess
+  tnsr::I<DataVector, Dim, Fr> remaining_x{remaining_points.size()};
+  for (size_t i = 0; i < remaining_points.size(); ++i) {
+    for (size_t d = 0; d < Dim; ++d) {
+      remaining_x.get(d)[i] = x.get(d)[remaining_points[i]];
+    }
+  }
+  auto remaining_block_coord_holders =
+      block_logical_coordinates(domain, remaining_x, time, functions_of_time);
+  for (size_t i = 0; i < remaining_points.size(); ++i) {
+    block_coord_holders[remaining_points[i]] =
+        std::move(remaining_block_coord_holders[i]);
+  }
+  return block_coord_holders;
+}
+
 // Explicit instantiations
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
@@ -179,6 +356,13 @@ std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
   block_logical_coordinates(                                                   \
       const Domain<DIM(data)>& domain,                                         \
       const tnsr::I<DataVector, DIM(data), FRAME(data)>& x, const double time, \
+      const domain::FunctionsOfTimeMap& functions_of_time);                    \
+  template std::vector<BlockLogicalCoords<DIM(data)>>                          \
+  block_logical_coordinates(                                                   \
+      const Domain<DIM(data)>& domain,                                         \
+      const tnsr::I<DataVector, DIM(data), FRAME(data)>& x,                    \
+      const std::vector<BlockLogicalCoords<DIM(data)>>& initial_guess,         \
+      const double time,                                                       \
       const domain::FunctionsOfTimeMap& functions_of_time);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
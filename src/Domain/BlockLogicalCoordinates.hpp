@@ -48,6 +48,11 @@ using BlockLogicalCoords = std::optional<
 /// that point. It will return a `std::nullopt` if it can't find the point in
 /// that block.
 ///
+/// For many points in a domain with many blocks, the
+/// `block_logical_coordinates` function first narrows down the blocks that
+/// may contain each point with a `domain::BlockSearchTree`, and tries the other
+/// blocks only if none of these candidates contain the point.
+///
 /// \warning Since map inverses can involve numerical roundoff error, care must
 /// be taken with points on shared block boundaries. They will be assigned to
 /// the first block (by block ID) that contains the point _within roundoff
@@ -69,6 +74,22 @@ auto block_logical_coordinates(
     const domain::FunctionsOfTimeMap& functions_of_time = {})
     -> std::vector<BlockLogicalCoords<Dim>>;
 
+/// The overload that takes an `initial_guess` for the block logical
+/// coordinates, e.g. from the previous time step of points on a moving
+/// surface, first inverts the map of the guessed block at each point with
+/// Newton-Raphson iterations that start at the guess and run on all points in
+/// the block at once (see `domain::inverse_with_initial_guess`). Points
+/// without a guess, and points that are no longer in the guessed block, are
+/// searched for in all blocks. Points on a shared boundary of blocks stay in
+/// the guessed block.
+template <size_t Dim, typename Fr>
+auto block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Fr>& x,
+    const std::vector<BlockLogicalCoords<Dim>>& initial_guess,
+    double time = std::numeric_limits<double>::signaling_NaN(),
+    const domain::FunctionsOfTimeMap& functions_of_time = {})
+    -> std::vector<BlockLogicalCoords<Dim>>;
+
 template <size_t Dim, typename Fr>
 std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>>
 block_logical_coordinates_single_point(
@@ -0,0 +1,216 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/BlockSearchTree.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain {
+namespace {
+// Blocks in a leaf are checked one by one
+constexpr size_t max_blocks_per_leaf = 2;
+
+template <size_t Dim>
+tnsr::I<DataVector, Dim, Frame::BlockLogical> sample_points(
+    const size_t samples_per_dim) {
+  size_t num_points = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    num_points *= samples_per_dim;
+  }
+  tnsr::I<DataVector, Dim, Frame::BlockLogical> points{num_points};
+  for (size_t i = 0; i < num_points; ++i) {
+    size_t index = i;
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto sample_index = static_cast<double>(index % samples_per_dim);
+      points.get(d)[i] =
+          -1. + 2. * sample_index / static_cast<double>(samples_per_dim - 1);
+      index /= samples_per_dim;
+    }
+  }
+  return points;
+}
+
+// Maps the block-logical `points` to the frame `Fr`, or returns `false` if
+// the block has no such frame
+template <size_t Dim, typename Fr>
+bool map_to_frame(
+    const gsl::not_null<tnsr::I<DataVector, Dim, Fr>*> mapped_points,
+    const Block<Dim>& block,
+    const tnsr::I<DataVector, Dim, Frame::BlockLogical>& points,
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+  if (block.is_time_dependent()) {
+    const auto grid_points = block.moving_mesh_logical_to_grid_map()(points);
+    if constexpr (std::is_same_v<Fr, Frame::Inertial>) {
+      *mapped_points = block.moving_mesh_grid_to_inertial_map()(
+          grid_points, time, functions_of_time);
+    } else if constexpr (std::is_same_v<Fr, Frame::Distorted>) {
+      if (not block.has_distorted_frame()) {
+        return false;
+      }
+      *mapped_points = block.moving_mesh_grid_to_distorted_map()(
+          grid_points, time, functions_of_time);
+    } else {
+      static_assert(std::is_same_v<Fr, Frame::Grid>,
+                    "Cannot convert from given frame to Grid frame");
+      *mapped_points = grid_points;
+    }
+  } else {
+    // The grid, distorted and inertial frames are the same for
+    // time-independent maps
+    const auto inertial_points = block.stationary_map()(points);
+    for (size_t d = 0; d < Dim; ++d) {
+      mapped_points->get(d) = inertial_points.get(d);
+    }
+  }
+  return true;
+}
+}  // namespace
+
+template <size_t Dim, typename Fr>
+bool BlockSearchTree<Dim, Fr>::BoundingBox::contains(
+    const tnsr::I<double, Dim, Fr>& point) const {
+  for (size_t d = 0; d < Dim; ++d) {
+    if (point.get(d) < gsl::at(lower, d) or point.get(d) > gsl::at(upper, d)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <size_t Dim, typename Fr>
+BlockSearchTree<Dim, Fr>::BlockSearchTree(
+    const Domain<Dim>& domain, const double time,
+    const domain::FunctionsOfTimeMap& functions_of_time) {
+  const auto block_logical_samples = sample_points<Dim>(samples_per_dim);
+  tnsr::I<DataVector, Dim, Fr> mapped_samples{samples_per_block};
+  block_boxes_.resize(domain.blocks().size());
+  block_ids_.reserve(domain.blocks().size());
+  for (const auto& block : domain.blocks()) {
+    if (not map_to_frame(make_not_null(&mapped_samples), block,
+                         block_logical_samples, time, functions_of_time)) {
+      continue;
+    }
+    auto& box = block_boxes_[block.id()];
+    double max_width = 0.;
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(box.lower, d) = min(mapped_samples.get(d));
+      gsl::at(box.upper, d) = max(mapped_samples.get(d));
+      max_width =
+          std::max(max_width, gsl::at(box.upper, d) - gsl::at(box.lower, d));
+    }
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(box.lower, d) -= padding * max_width;
+      gsl::at(box.upper, d) += padding * max_width;
+    }
+    block_ids_.push_back(block.id());
+  }
+  if (not block_ids_.empty()) {
+    build(0, block_ids_.size());
+  }
+}
+
+template <size_t Dim, typename Fr>
+void BlockSearchTree<Dim, Fr>::build(const size_t begin, const size_t end) {
+  ASSERT(end > begin, "Can't build a node without blocks.");
+  const size_t node_index = nodes_.size();
+  nodes_.push_back({block_boxes_[block_ids_[begin]], begin, end, 0});
+  auto& box = nodes_[node_index].box;
+  for (size_t i = begin + 1; i < end; ++i) {
+    const auto& block_box = block_boxes_[block_ids_[i]];
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(box.lower, d) =
+          std::min(gsl::at(box.lower, d), gsl::at(block_box.lower, d));
+      gsl::at(box.upper, d) =
+          std::max(gsl::at(box.upper, d), gsl::at(block_box.upper, d));
+    }
+  }
+  if (end - begin <= max_blocks_per_leaf) {
+    return;
+  }
+  // Split the blocks at the median of their box centers along the dimension
+  // in which the node is widest
+  size_t split_dim = 0;
+  for (size_t d = 1; d < Dim; ++d) {
+    if (gsl::at(box.upper, d) - gsl::at(box.lower, d) >
+        gsl::at(box.upper, split_dim) - gsl::at(box.lower, split_dim)) {
+      split_dim = d;
+    }
+  }
+  const size_t middle = begin + (end - begin) / 2;
+  std::nth_element(
+      block_ids_.begin() + static_cast<std::ptrdiff_t>(begin),
+      block_ids_.begin() + static_cast<std::ptrdiff_t>(middle),
+      block_ids_.begin() + static_cast<std::ptrdiff_t>(end),
+      [this, &split_dim](const size_t lhs, const size_t rhs) {
+        const auto& lhs_box = block_boxes_[lhs];
+        const auto& rhs_box = block_boxes_[rhs];
+        return gsl::at(lhs_box.lower, split_dim) +
+                   gsl::at(lhs_box.upper, split_dim) <
+               gsl::at(rhs_box.lower, split_dim) +
+                   gsl::at(rhs_box.upper, split_dim);
+      });
+  // Don't hold on to `box` here, because building the children reallocates
+  // the `nodes_`
+  build(begin, middle);
+  nodes_[node_index].right_child = nodes_.size();
+  build(middle, end);
+}
+
+template <size_t Dim, typename Fr>
+void BlockSearchTree<Dim, Fr>::candidate_blocks(
+    const gsl::not_null<std::vector<size_t>*> block_ids,
+    const tnsr::I<double, Dim, Fr>& point) const {
+  block_ids->clear();
+  if (nodes_.empty()) {
+    return;
+  }
+  // Depth-first traversal, skipping the subtrees whose boxes don't contain the
+  // point
+  std::vector<size_t> nodes_to_visit{0};
+  while (not nodes_to_visit.empty()) {
+    const size_t node_index = nodes_to_visit.back();
+    nodes_to_visit.pop_back();
+    const auto& node = nodes_[node_index];
+    if (not node.box.contains(point)) {
+      continue;
+    }
+    if (node.right_child == 0) {
+      for (size_t i = node.begin; i < node.end; ++i) {
+        if (block_boxes_[block_ids_[i]].contains(point)) {
+          block_ids->push_back(block_ids_[i]);
+        }
+      }
+    } else {
+      nodes_to_visit.push_back(node.right_child);
+      nodes_to_visit.push_back(node_index + 1);
+    }
+  }
+  std::sort(block_ids->begin(), block_ids->end());
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+
+#define INSTANTIATE(_, data) \
+  template class BlockSearchTree<DIM(data), FRAME(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
+                        (::Frame::Grid, ::Frame::Distorted, ::Frame::Inertial))
+
+#undef FRAME
+#undef DIM
+#undef INSTANTIATE
+}  // namespace domain
@@ -0,0 +1,87 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+template <size_t VolumeDim>
+class Domain;
+/// \endcond
+
+namespace domain {
+
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief A bounding volume hierarchy over the `Block`s of a `Domain` in the
+ * frame `Fr`, used to narrow down the blocks that may contain a point.
+ *
+ * \details Inverting block maps is expensive, so finding the block that
+ * contains a point by trying every block in turn is slow for domains with many
+ * blocks (e.g. `BinaryCompactObject`) and many points (e.g. horizon, worldtube
+ * or importer target points). This tree holds an axis-aligned bounding box for
+ * each block and returns the few blocks whose boxes contain the point.
+ *
+ * The bounding box of a block is computed by mapping
+ * `samples_per_dim` points per dimension of the block-logical cube (including
+ * its boundaries) to the frame `Fr`, and padding the box that encloses them by
+ * `padding` times its largest width to account for curved block boundaries
+ * between the samples. The boxes are therefore not guaranteed to enclose the
+ * blocks, so callers should fall back to checking the other blocks when none
+ * of the candidates contain the point (see `block_logical_coordinates`).
+ *
+ * For time-dependent maps the boxes are computed at the `time` passed to the
+ * constructor, so a tree is only valid at that time. Blocks without a
+ * distorted frame are excluded from a tree in the `Frame::Distorted`.
+ */
+template <size_t Dim, typename Fr>
+class BlockSearchTree {
+ public:
+  static constexpr size_t samples_per_dim = 5;
+  static constexpr size_t samples_per_block = pow<Dim>(samples_per_dim);
+  static constexpr double padding = 0.1;
+
+  BlockSearchTree(const Domain<Dim>& domain,
+                  double time = std::numeric_limits<double>::signaling_NaN(),
+                  const domain::FunctionsOfTimeMap& functions_of_time = {});
+
+  /// The IDs of the blocks whose bounding boxes contain the `point`, in
+  /// ascending order
+  void candidate_blocks(gsl::not_null<std::vector<size_t>*> block_ids,
+                        const tnsr::I<double, Dim, Fr>& point) const;
+
+ private:
+  struct BoundingBox {
+    std::array<double, Dim> lower{};
+    std::array<double, Dim> upper{};
+
+    bool contains(const tnsr::I<double, Dim, Fr>& point) const;
+  };
+
+  // Nodes are stored depth-first. Each node covers the `block_ids_` in
+  // [begin,end). Leaves have no children, and the left child of a node
+  // directly follows it.
+  struct Node {
+    BoundingBox box{};
+    size_t begin = 0;
+    size_t end = 0;
+    size_t right_child = 0;
+  };
+
+  void build(size_t begin, size_t end);
+
+  std::vector<BoundingBox> block_boxes_{};
+  std::vector<size_t> block_ids_{};
+  std::vector<Node> nodes_{};
+};
+
+}  // namespace domain
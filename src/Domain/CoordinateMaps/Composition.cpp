@@ -57,6 +57,16 @@ bool Composition<Frames, Dim,
   return result;
 }
 
+template <typename Frames, size_t Dim, size_t... Is>
+bool Composition<Frames, Dim,
+                 std::index_sequence<Is...>>::jacobian_is_spatially_uniform()
+    const {
+  bool result = true;
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      (result = result and get<Is>(maps_)->jacobian_is_spatially_uniform()));
+  return result;
+}
+
 template <typename Frames, size_t Dim, size_t... Is>
 tnsr::I<double, Dim, tmpl::back<Frames>>
 Composition<Frames, Dim, std::index_sequence<Is...>>::operator()(
@@ -116,6 +116,8 @@ struct Composition<Frames, Dim, std::index_sequence<Is...>>
 
   bool jacobian_is_time_dependent() const override;
 
+  bool jacobian_is_spatially_uniform() const override;
+
   const std::unordered_set<std::string>& function_of_time_names()
       const override {
     return function_of_time_names_;
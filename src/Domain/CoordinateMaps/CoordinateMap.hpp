@@ -84,6 +84,11 @@ class CoordinateMapBase : public PUP::able {
   /// Returns `true` if the Jacobian depends on time.
   virtual bool jacobian_is_time_dependent() const = 0;
 
+  /// Returns `true` if the Jacobian is the same at all points, e.g. for a
+  /// rigid rotation, a uniform expansion or a translation. Then the Jacobian
+  /// can be evaluated at a single point and applied to all points.
+  virtual bool jacobian_is_spatially_uniform() const = 0;
+
   /// Get a set of all FunctionOfTime names used in this mapping
   virtual const std::unordered_set<std::string>& function_of_time_names()
       const = 0;
@@ -294,6 +299,12 @@ class CoordinateMap
   /// Returns `true` if the Jacobian depends on time.
   bool jacobian_is_time_dependent() const override;
 
+  /// Returns `true` if the Jacobians of all `Maps` are spatially uniform.
+  /// Maps report this with a `jacobian_is_spatially_uniform()` member
+  /// function. Maps without this member function are assumed to have a
+  /// spatially varying Jacobian unless they are the identity.
+  bool jacobian_is_spatially_uniform() const override;
+
   /// Get a set of all FunctionOfTime names from `Maps`
   const std::unordered_set<std::string>& function_of_time_names()
       const override {
@@ -41,6 +41,8 @@ namespace domain {
 namespace CoordinateMap_detail {
 CREATE_IS_CALLABLE(function_of_time_names)
 CREATE_IS_CALLABLE_V(function_of_time_names)
+CREATE_IS_CALLABLE(jacobian_is_spatially_uniform)
+CREATE_IS_CALLABLE_V(jacobian_is_spatially_uniform)
 
 template <typename T>
 struct map_type {
@@ -111,6 +113,36 @@ bool CoordinateMap<SourceFrame, TargetFrame, Maps...>::is_identity() const {
       maps_, std::make_index_sequence<sizeof...(Maps)>{});
 }
 
+namespace CoordinateMap_detail {
+template <typename... Maps, size_t... Is>
+bool jacobian_is_spatially_uniform_impl(const std::tuple<Maps...>& maps,
+                                        std::index_sequence<Is...> /*meta*/) {
+  bool is_uniform = true;
+  const auto check_map_is_uniform = [&is_uniform, &maps](auto index) {
+    const auto& map = std::get<decltype(index)::value>(maps);
+    using Map = std::decay_t<decltype(map)>;
+    if (is_uniform) {
+      if constexpr (is_jacobian_is_spatially_uniform_callable_v<Map>) {
+        is_uniform = map.jacobian_is_spatially_uniform();
+      } else {
+        is_uniform = map.is_identity();
+      }
+    }
+    return '0';
+  };
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      check_map_is_uniform(std::integral_constant<size_t, Is>{}));
+  return is_uniform;
+}
+}  // namespace CoordinateMap_detail
+
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+bool CoordinateMap<SourceFrame, TargetFrame,
+                   Maps...>::jacobian_is_spatially_uniform() const {
+  return CoordinateMap_detail::jacobian_is_spatially_uniform_impl(
+      maps_, std::make_index_sequence<sizeof...(Maps)>{});
+}
+
 template <typename SourceFrame, typename TargetFrame, typename... Maps>
 bool CoordinateMap<SourceFrame, TargetFrame,
                    Maps...>::inv_jacobian_is_time_dependent() const {
@@ -284,8 +316,11 @@ void multiply_jacobian(
             noframe_jac.get(target, dummy) * jac->get(dummy, source);
       }
     }
+    // Swap instead of moving so the buffers of the previous product are
+    // reused for the next column rather than reallocated
     for (size_t target = 0; target < Dim; ++target) {
-      jac->get(target, source) = std::move(gsl::at(temp, target));
+      using std::swap;
+      swap(gsl::at(temp, target), jac->get(target, source));
     }
   }
 }
@@ -304,8 +339,10 @@ void multiply_inv_jacobian(
             inv_jac->get(source, dummy) * noframe_inv_jac.get(dummy, target);
       }
     }
+    // Swap to reuse the buffers, as in `multiply_jacobian`
     for (size_t target = 0; target < Dim; ++target) {
-      inv_jac->get(source, target) = std::move(gsl::at(temp, target));
+      using std::swap;
+      swap(gsl::at(temp, target), inv_jac->get(source, target));
     }
   }
 }
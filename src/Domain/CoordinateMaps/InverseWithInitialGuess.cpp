@@ -0,0 +1,89 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/CoordinateMaps/InverseWithInitialGuess.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain {
+template <typename SourceFrame, typename TargetFrame, size_t Dim>
+std::vector<bool> inverse_with_initial_guess(
+    const gsl::not_null<tnsr::I<DataVector, Dim, SourceFrame>*> source_points,
+    const CoordinateMapBase<SourceFrame, TargetFrame, Dim>& map,
+    const tnsr::I<DataVector, Dim, TargetFrame>& target_points,
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time,
+    const size_t max_iterations, const double tolerance) {
+  const size_t num_points = get<0>(target_points).size();
+  ASSERT(get<0>(*source_points).size() == num_points,
+         "The initial guess has " << get<0>(*source_points).size()
+                                  << " points but there are " << num_points
+                                  << " target points.");
+  DataVector max_residual{num_points};
+  DataVector residual_tolerance(num_points, 1.);
+  for (size_t d = 0; d < Dim; ++d) {
+    residual_tolerance = max(residual_tolerance, abs(target_points.get(d)));
+  }
+  residual_tolerance *= tolerance;
+  std::vector<bool> converged(num_points, false);
+  for (size_t iteration = 0;; ++iteration) {
+    auto residual = map(*source_points, time, functions_of_time);
+    max_residual = 0.;
+    for (size_t d = 0; d < Dim; ++d) {
+      residual.get(d) -= target_points.get(d);
+      max_residual = max(max_residual, abs(residual.get(d)));
+    }
+    bool all_converged = true;
+    for (size_t i = 0; i < num_points; ++i) {
+      // Written so NaN residuals don't count as converged
+      converged[i] = max_residual[i] <= residual_tolerance[i];
+      all_converged = all_converged and converged[i];
+    }
+    if (all_converged or iteration == max_iterations) {
+      break;
+    }
+    const auto inv_jacobian =
+        map.inv_jacobian(*source_points, time, functions_of_time);
+    for (size_t i = 0; i < Dim; ++i) {
+      for (size_t j = 0; j < Dim; ++j) {
+        source_points->get(i) -= inv_jacobian.get(i, j) * residual.get(j);
+      }
+    }
+  }
+  return converged;
+}
+
+#define SOURCE_FRAME(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define TARGET_FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+#define DIM(data) BOOST_PP_TUPLE_ELEM(2, data)
+
+#define INSTANTIATE(_, data)                                                  \
+  template std::vector<bool> inverse_with_initial_guess(                      \
+      gsl::not_null<tnsr::I<DataVector, DIM(data), SOURCE_FRAME(data)>*>      \
+          source_points,                                                      \
+      const CoordinateMapBase<SOURCE_FRAME(data), TARGET_FRAME(data),         \
+                              DIM(data)>& map,                                \
+      const tnsr::I<DataVector, DIM(data), TARGET_FRAME(data)>& target_points, \
+      double time, const domain::FunctionsOfTimeMap& functions_of_time,       \
+      size_t max_iterations, double tolerance);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (Frame::BlockLogical),
+                        (Frame::Grid, Frame::Inertial), (1, 2, 3))
+GENERATE_INSTANTIATIONS(INSTANTIATE, (Frame::Grid),
+                        (Frame::Inertial, Frame::Distorted), (1, 2, 3))
+
+#undef INSTANTIATE
+#undef DIM
+#undef TARGET_FRAME
+#undef SOURCE_FRAME
+}  // namespace domain
@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class DataVector;
+namespace domain {
+template <typename SourceFrame, typename TargetFrame, size_t Dim>
+class CoordinateMapBase;
+}  // namespace domain
+/// \endcond
+
+namespace domain {
+/*!
+ * \ingroup CoordinateMapsGroup
+ * \brief Invert the `map` at a batch of `target_points` with Newton-Raphson
+ * iterations that start at an initial guess.
+ *
+ * \details The `source_points` hold the initial guess on input, e.g. the
+ * source coordinates of points on a surface that moved only a little since
+ * they were last inverted. The iterations
+ *
+ * \f{equation}
+ * \xi^i \leftarrow \xi^i - \frac{\partial \xi^i}{\partial x^j}
+ * \left(x^j(\xi) - x^j_\mathrm{target}\right)
+ * \f}
+ *
+ * run on all points at once using the `DataVector` overloads of the map and
+ * its inverse Jacobian, so they vectorize across points. They stop when all
+ * points have converged, i.e. when their residual
+ * \f$\max_j |x^j(\xi) - x^j_\mathrm{target}|\f$ is below
+ * `tolerance * max(1, max_j |x^j_\mathrm{target}|)`, or after
+ * `max_iterations`.
+ *
+ * \returns Whether each point converged. On output, the `source_points` hold
+ * the inverse at the converged points and are unspecified at the others, e.g.
+ * if the initial guess was too far from the solution or the map is singular
+ * there. Callers should fall back to `CoordinateMapBase::inverse` for these
+ * points. Note that convergence doesn't imply that the source points lie
+ * within the domain the map is defined on.
+ */
+template <typename SourceFrame, typename TargetFrame, size_t Dim>
+std::vector<bool> inverse_with_initial_guess(
+    gsl::not_null<tnsr::I<DataVector, Dim, SourceFrame>*> source_points,
+    const CoordinateMapBase<SourceFrame, TargetFrame, Dim>& map,
+    const tnsr::I<DataVector, Dim, TargetFrame>& target_points,
+    double time = std::numeric_limits<double>::signaling_NaN(),
+    const domain::FunctionsOfTimeMap& functions_of_time = {},
+    size_t max_iterations = 20, double tolerance = 1.e-12);
+}  // namespace domain
@@ -334,6 +334,13 @@ class RotScaleTrans {
 
   static bool is_identity() { return false; }
 
+  /// The Jacobian is uniform except in the `BlockRegion::Transition` where the
+  /// expansion and translation fall off radially
+  bool jacobian_is_spatially_uniform() const {
+    return region_ != BlockRegion::Transition or
+           not(scale_f_of_t_a_.has_value() or trans_f_of_t_.has_value());
+  }
+
   const std::unordered_set<std::string>& function_of_time_names() const {
     return f_of_t_names_;
   }
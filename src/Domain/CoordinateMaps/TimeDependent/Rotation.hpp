@@ -215,6 +215,8 @@ class Rotation {
 
   static bool is_identity() { return false; }
 
+  static bool jacobian_is_spatially_uniform() { return true; }
+
   const std::unordered_set<std::string>& function_of_time_names() const {
     return f_of_t_names_;
   }
@@ -220,6 +220,11 @@ class Translation {
 
   static bool is_identity() { return false; }
 
+  /// The Jacobian is uniform unless the translation falls off radially
+  bool jacobian_is_spatially_uniform() const {
+    return not inner_radius_.has_value() and f_of_r_ == nullptr;
+  }
+
   const std::unordered_set<std::string>& function_of_time_names() const {
     return f_of_t_names_;
   }
@@ -3,10 +3,12 @@
 
 #include "Domain/ElementDistribution.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
@@ -16,13 +18,13 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"
 #include "Domain/Block.hpp"
-#include "Domain/CreateInitialElement.hpp"
-#include "Domain/ElementMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/MinimumGridSpacing.hpp"
 #include "Domain/Structure/CreateInitialMesh.hpp"
-#include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Structure/Side.hpp"
 #include "Domain/Structure/ZCurve.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -55,23 +57,38 @@ namespace {
 // spacing in the denominator of the cost is that it was found experimentally
 // that using the square root yielded faster BBH simulation runtimes when using
 // local time stepping.
+//
+// This is evaluated for every element on a single process when the elements
+// are distributed, so the block map is applied directly rather than through an
+// `ElementMap`, which would clone it.
 template <size_t Dim>
 double get_num_points_and_grid_spacing_cost(
     const ElementId<Dim>& element_id, const Block<Dim>& block,
-    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
     const std::vector<std::array<size_t, Dim>>& initial_extents,
     const Spectral::Quadrature quadrature) {
-  Mesh<Dim> mesh = ::domain::Initialization::create_initial_mesh(
+  const Mesh<Dim> mesh = ::domain::Initialization::create_initial_mesh(
       initial_extents, element_id, quadrature);
-  Element<Dim> element = ::domain::Initialization::create_initial_element(
-      element_id, block, initial_refinement_levels);
-  ElementMap<Dim, Frame::Grid> element_map{element_id, block};
-  const tnsr::I<DataVector, Dim, Frame::ElementLogical> logical_coords =
-      logical_coordinates(mesh);
-  const tnsr::I<DataVector, Dim, Frame::Grid> grid_coords =
-      element_map(logical_coords);
+  tnsr::I<DataVector, Dim, Frame::BlockLogical> block_logical_coords{};
+  {
+    const tnsr::I<DataVector, Dim, Frame::ElementLogical> logical_coords =
+        logical_coordinates(mesh);
+    for (size_t d = 0; d < Dim; ++d) {
+      const SegmentId& segment_id = element_id.segment_id(d);
+      const double lower = segment_id.endpoint(Side::Lower);
+      const double upper = segment_id.endpoint(Side::Upper);
+      block_logical_coords.get(d) =
+          0.5 * (upper - lower) * logical_coords.get(d) + 0.5 * (upper + lower);
+    }
+  }
+  // Time-independent blocks have the same grid and inertial coordinates
   const double min_grid_spacing =
-      minimum_grid_spacing(mesh.extents(), grid_coords);
+      block.is_time_dependent()
+          ? minimum_grid_spacing(mesh.extents(),
+                                 block.moving_mesh_logical_to_grid_map()(
+                                     std::move(block_logical_coords)))
+          : minimum_grid_spacing(
+                mesh.extents(),
+                block.stationary_map()(std::move(block_logical_coords)));
 
   return mesh.number_of_grid_points() / sqrt(min_grid_spacing);
 }
@@ -98,6 +115,12 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
     const ElementWeight element_weight,
     const std::optional<Spectral::Quadrature>& quadrature) {
   std::unordered_map<ElementId<Dim>, double> element_costs{};
+  size_t num_elements = 0;
+  for (const auto& initial_ref_levs : initial_refinement_levels) {
+    num_elements += two_to_the(
+        alg::accumulate(initial_ref_levs, 0_st, std::plus<size_t>()));
+  }
+  element_costs.reserve(num_elements);
 
   for (size_t block_number = 0; block_number < blocks.size(); block_number++) {
     const auto& block = blocks[block_number];
@@ -121,9 +144,9 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
                "have a value");
 
         element_costs.insert(
-            {element_id, get_num_points_and_grid_spacing_cost(
-                             element_id, block, initial_refinement_levels,
-                             initial_extents, quadrature.value())});
+            {element_id,
+             get_num_points_and_grid_spacing_cost(
+                 element_id, block, initial_extents, quadrature.value())});
       }
     }
   }
@@ -170,13 +193,20 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
   std::vector<std::vector<ElementId<Dim>>> initial_element_ids_by_block(
       num_blocks);
   for (size_t i = 0; i < num_blocks; i++) {
-    initial_element_ids_by_block[i].reserve(num_elements_by_block[i]);
-    initial_element_ids_by_block[i] =
-        initial_element_ids(blocks[i].id(), initial_refinement_levels[i]);
-    alg::sort(initial_element_ids_by_block[i],
-              [](const ElementId<Dim>& lhs, const ElementId<Dim>& rhs) {
-                return z_curve_index(lhs) < z_curve_index(rhs);
-              });
+    // The Z-curve index of the elements in a uniformly refined block is a
+    // permutation of 0, ..., N-1, so we can place each element at its index
+    // instead of sorting by (repeatedly computed) Z-curve indices
+    auto& element_ids_in_z_curve_order = initial_element_ids_by_block[i];
+    element_ids_in_z_curve_order.resize(num_elements_by_block[i]);
+    for (auto& element_id :
+         initial_element_ids(blocks[i].id(), initial_refinement_levels[i])) {
+      const size_t index = z_curve_index(element_id);
+      ASSERT(index < num_elements_by_block[i],
+             "Z-curve index " << index << " of element " << element_id
+                              << " is out of bounds for block with "
+                              << num_elements_by_block[i] << " elements.");
+      element_ids_in_z_curve_order[index] = std::move(element_id);
+    }
   }
 
   double total_cost = 0.0;
@@ -297,20 +327,34 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
             std::make_pair(global_proc_number, num_elements_current_block));
     current_block_num++;
   }
+
+  block_element_allowance_ends_.resize(num_blocks);
+  for (size_t i = 0; i < num_blocks; ++i) {
+    auto& allowance_ends = block_element_allowance_ends_[i];
+    allowance_ends.reserve(block_element_distribution_[i].size());
+    size_t total_so_far = 0;
+    for (const auto& element_allowance : block_element_distribution_[i]) {
+      total_so_far += element_allowance.second;
+      allowance_ends.push_back(total_so_far);
+    }
+  }
 }
 
 template <size_t Dim>
 size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
     const ElementId<Dim>& element_id) const {
   const size_t element_order_index = z_curve_index(element_id);
-  size_t total_so_far = 0;
-  for (const std::pair<size_t, size_t>& element_info :
-       gsl::at(block_element_distribution_, element_id.block_id())) {
-    if (total_so_far <= element_order_index and
-        element_info.second + total_so_far > element_order_index) {
-      return element_info.first;
-    }
-    total_so_far += element_info.second;
+  const auto& allowance_ends =
+      gsl::at(block_element_allowance_ends_, element_id.block_id());
+  // Allowances without elements end at the same index as the previous one, so
+  // they are skipped by looking for the first end past the element
+  const auto allowance = std::upper_bound(
+      allowance_ends.begin(), allowance_ends.end(), element_order_index);
+  if (allowance != allowance_ends.end()) {
+    const auto allowance_index =
+        static_cast<size_t>(std::distance(allowance_ends.begin(), allowance));
+    return block_element_distribution_[element_id.block_id()][allowance_index]
+        .first;
   }
   ERROR(
       "Processor not successfully chosen. This indicates a flaw in the logic "
@@ -324,8 +368,6 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
   double get_num_points_and_grid_spacing_cost(                               \
       const ElementId<GET_DIM(data)>& element_id,                            \
       const Block<GET_DIM(data)>& block,                                     \
-      const std::vector<std::array<size_t, GET_DIM(data)>>&                  \
-          initial_refinement_levels,                                         \
       const std::vector<std::array<size_t, GET_DIM(data)>>& initial_extents, \
       Spectral::Quadrature quadrature);                                      \
   template std::unordered_map<ElementId<GET_DIM(data)>, double>              \
@@ -173,6 +173,10 @@ struct BlockZCurveProcDistribution {
   //   elements in the allowance
   std::vector<std::vector<std::pair<size_t, size_t>>>
       block_element_distribution_;
+  // For each block, the Z-curve index one past the last element of each
+  // element allowance in `block_element_distribution_`, so the allowance of an
+  // element can be found by bisection
+  std::vector<std::vector<size_t>> block_element_allowance_ends_;
 };
 }  // namespace domain
 
@@ -202,7 +206,7 @@ struct Options::create_from_yaml<domain::ElementWeight> {
       return domain::ElementWeight::NumGridPointsAndGridSpacing;
     }
     PARSE_ERROR(options.context(),
-                "ElementWeight must be 'Uniform', 'NumGridPoints', or, "
+                "ElementWeight must be 'Uniform', 'NumGridPoints', or "
                 "'NumGridPointsAndGridSpacing'");
   }
 };
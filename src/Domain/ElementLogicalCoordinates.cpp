@@ -68,6 +68,16 @@ element_logical_coordinates(
   std::vector<std::array<std::vector<double>, Dim>> x_element_logical(
       element_ids.size());
   std::vector<std::vector<size_t>> offsets(element_ids.size());
+  // Group the elements by block, so each point is only checked against the
+  // elements in its own block instead of all elements
+  std::vector<std::vector<size_t>> elements_in_block{};
+  for (size_t index = 0; index < element_ids.size(); ++index) {
+    const size_t block_id = element_ids[index].block_id();
+    if (block_id >= elements_in_block.size()) {
+      elements_in_block.resize(block_id + 1);
+    }
+    elements_in_block[block_id].push_back(index);
+  }
 
   // Loop over points
   for (size_t offset = 0; offset < block_coord_holders.size(); ++offset) {
@@ -78,38 +88,38 @@ element_logical_coordinates(
 
     const auto& block_id = block_coord_holders[offset].value().id;
     const auto& x_block_logical = block_coord_holders[offset].value().data;
+    if (block_id.get_index() >= elements_in_block.size()) {
+      continue;
+    }
     // Need to loop over elements, because the block doesn't know
     // things like the refinement_level of each element.
-    for (size_t index = 0; index < element_ids.size(); ++index) {
+    for (const size_t index : elements_in_block[block_id.get_index()]) {
       const auto& element_id = element_ids[index];
-      if (element_id.block_id() == block_id.get_index()) {
-        // This element is in this block; now check if the point is in
-        // this element.
-        const auto x_elem =
-            element_logical_coordinates(x_block_logical, element_id);
-        if (not x_elem.has_value()) {
-          continue;
+      // Now check if the point is in this element.
+      const auto x_elem =
+          element_logical_coordinates(x_block_logical, element_id);
+      if (not x_elem.has_value()) {
+        continue;
+      }
+      // Disambiguate points on shared element boundaries
+      bool is_contained = true;
+      for (size_t d = 0; d < Dim; ++d) {
+        const double up = element_id.segment_id(d).endpoint(Side::Upper);
+        const double lo = element_id.segment_id(d).endpoint(Side::Lower);
+        const double x_block_log = x_block_logical.get(d);
+        if (not segment_contains(x_block_log, lo, up)) {
+          is_contained = false;
+          break;
         }
-        // Disambiguate points on shared element boundaries
-        bool is_contained = true;
+      }
+      if (is_contained) {
         for (size_t d = 0; d < Dim; ++d) {
-          const double up = element_id.segment_id(d).endpoint(Side::Upper);
-          const double lo = element_id.segment_id(d).endpoint(Side::Lower);
-          const double x_block_log = x_block_logical.get(d);
-          if (not segment_contains(x_block_log, lo, up)) {
-            is_contained = false;
-            break;
-          }
-        }
-        if (is_contained) {
-          for (size_t d = 0; d < Dim; ++d) {
-            gsl::at(x_element_logical[index], d).push_back(x_elem->get(d));
-          }
-          offsets[index].push_back(offset);
-          // Found a matching element, so we don't need to check other
-          // elements.
-          break;
+          gsl::at(x_element_logical[index], d).push_back(x_elem->get(d));
         }
+        offsets[index].push_back(offset);
+        // Found a matching element, so we don't need to check other
+        // elements.
+        break;
       }
     }
   }
@@ -3,7 +3,10 @@
 
 #include "Domain/ElementMap.hpp"
 
-#include "Domain/CoordinateMaps/Composition.hpp"
+#include <memory>
+#include <pup.h>
+#include <utility>
+
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/Structure/Side.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -16,6 +19,17 @@ ElementMap<Dim, TargetFrame>::ElementMap(
     std::unique_ptr<
         domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
         block_map)
+    : ElementMap(element_id,
+                 std::shared_ptr<const domain::CoordinateMapBase<
+                     Frame::BlockLogical, TargetFrame, Dim>>(
+                     std::move(block_map))) {}
+
+template <size_t Dim, typename TargetFrame>
+ElementMap<Dim, TargetFrame>::ElementMap(
+    const ElementId<Dim>& element_id,
+    std::shared_ptr<
+        const domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
+        block_map)
     : block_map_(std::move(block_map)),
       map_slope_{[](const ElementId<Dim>& id) {
         std::array<double, Dim> result{};
@@ -37,43 +51,28 @@ ElementMap<Dim, TargetFrame>::ElementMap(
         return result;
       }(element_id)} {}
 
-// We could refactor the ElementMap class to use a `Composition` internally also
-// for the element-to-block-logical map, so the whole map is just one
-// composition.
 template <size_t Dim, typename TargetFrame>
 ElementMap<Dim, TargetFrame>::ElementMap(const ElementId<Dim>& element_id,
                                          const Block<Dim>& block)
-    : ElementMap(
-          element_id,
-          [&block]() -> std::unique_ptr<domain::CoordinateMapBase<
-                         Frame::BlockLogical, TargetFrame, Dim>> {
-            if constexpr (std::is_same_v<TargetFrame, Frame::Inertial>) {
-              if (block.is_time_dependent()) {
-                using CompositionType = domain::CoordinateMaps::Composition<
-                    tmpl::list<Frame::BlockLogical, Frame::Grid,
-                               Frame::Inertial>,
-                    Dim>;
-                return std::make_unique<CompositionType>(
-                    block.moving_mesh_logical_to_grid_map().get_clone(),
-                    block.moving_mesh_grid_to_inertial_map().get_clone());
-              } else {
-                return block.stationary_map().get_clone();
-              }
-            } else if constexpr (std::is_same_v<TargetFrame, Frame::Grid>) {
-              if (block.is_time_dependent()) {
-                return block.moving_mesh_logical_to_grid_map().get_clone();
-              } else {
-                return block.stationary_map().get_to_grid_frame();
-              }
-            }
-          }()) {
+    : ElementMap(element_id, block.template element_block_map<TargetFrame>()) {
   ASSERT(element_id.block_id() == block.id(),
          "Element " << element_id << " is not in block " << block.id() << ".");
 }
 
 template <size_t Dim, typename TargetFrame>
 void ElementMap<Dim, TargetFrame>::pup(PUP::er& p) {
-  p | block_map_;
+  // The map is serialized through a raw pointer, so it isn't cloned when
+  // packing. Packing and sizing only read the map.
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto* block_map = p.isUnpacking()
+                        ? nullptr
+                        : const_cast<domain::CoordinateMapBase<
+                              Frame::BlockLogical, TargetFrame, Dim>*>(
+                              block_map_.get());
+  p | block_map;
+  if (p.isUnpacking()) {
+    block_map_.reset(block_map);
+  }
   p | map_slope_;
   p | map_offset_;
 }
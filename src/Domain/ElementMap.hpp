@@ -47,12 +47,24 @@ class ElementMap {
                                                        TargetFrame, Dim>>
                  block_map);
 
+  /// Construct from an `element_id` and a `block_map` that may be shared with
+  /// other elements in the same block.
+  ElementMap(const ElementId<Dim>& element_id,
+             std::shared_ptr<const domain::CoordinateMapBase<
+                 Frame::BlockLogical, TargetFrame, Dim>>
+                 block_map);
+
   /// Construct from an `element_id` within the `block`. The (affine)
   /// ElementLogical to BlockLogical map is determined by the `element_id`. The
   /// BlockLogical to TargetFrame map is determined by the `block`:
   /// - If the block is time-independent: the `block.stationary_map()` is used.
   /// - If the block is time-dependent: The `block.moving_mesh_*_map()` maps
   ///   are used. Which maps are used depends on the TargetFrame.
+  ///
+  /// The block map is shared with the block (see `Block::element_block_map()`),
+  /// so all elements constructed from the same block reference the same map
+  /// instead of holding a clone. Elements that are deserialized, e.g. after
+  /// migrating to another node, hold their own copy.
   ElementMap(const ElementId<Dim>& element_id, const Block<Dim>& block);
 
   const domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>&
@@ -141,8 +153,8 @@ class ElementMap {
     return block_source_point;
   }
 
-  std::unique_ptr<
-      domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
+  std::shared_ptr<
+      const domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
       block_map_{nullptr};
   // map_slope_[i] = 0.5 * (segment_ids[i].endpoint(Side::Upper) -
   //                        segment_ids[i].endpoint(Side::Lower))
@@ -105,34 +105,46 @@ void unnormalized_face_normal(
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time,
     const Direction<VolumeDim>& direction) {
-  auto logical_to_grid_inv_jac = logical_to_grid_map.inv_jacobian(
-      interface_logical_coordinates(interface_mesh, direction));
+  const auto logical_coords =
+      interface_logical_coordinates(interface_mesh, direction);
+  auto logical_to_grid_inv_jac =
+      logical_to_grid_map.inv_jacobian(logical_coords);
   ::InverseJacobian<DataVector, VolumeDim, Frame::ElementLogical,
                     Frame::Inertial>
       logical_to_inertial_inv_jac{};
 
+  const auto contract_inv_jacobians =
+      [&logical_to_inertial_inv_jac,
+       &logical_to_grid_inv_jac](const auto& grid_to_inertial_inv_jac) {
+        for (size_t logical_i = 0; logical_i < VolumeDim; ++logical_i) {
+          for (size_t inertial_i = 0; inertial_i < VolumeDim; ++inertial_i) {
+            logical_to_inertial_inv_jac.get(logical_i, inertial_i) =
+                logical_to_grid_inv_jac.get(logical_i, 0) *
+                grid_to_inertial_inv_jac.get(0, inertial_i);
+            for (size_t grid_i = 1; grid_i < VolumeDim; ++grid_i) {
+              logical_to_inertial_inv_jac.get(logical_i, inertial_i) +=
+                  logical_to_grid_inv_jac.get(logical_i, grid_i) *
+                  grid_to_inertial_inv_jac.get(grid_i, inertial_i);
+            }
+          }
+        }
+      };
+
   if (grid_to_inertial_map.is_identity()) {
     for (size_t i = 0; i < logical_to_inertial_inv_jac.size(); ++i) {
       logical_to_inertial_inv_jac[i] = std::move(logical_to_grid_inv_jac[i]);
     }
-  } else {
-    const auto grid_to_inertial_inv_jac = grid_to_inertial_map.inv_jacobian(
-        logical_to_grid_map(
-            interface_logical_coordinates(interface_mesh, direction)),
-        time, functions_of_time);
-
-    for (size_t logical_i = 0; logical_i < VolumeDim; ++logical_i) {
-      for (size_t inertial_i = 0; inertial_i < VolumeDim; ++inertial_i) {
-        logical_to_inertial_inv_jac.get(logical_i, inertial_i) =
-            logical_to_grid_inv_jac.get(logical_i, 0) *
-            grid_to_inertial_inv_jac.get(0, inertial_i);
-        for (size_t grid_i = 1; grid_i < VolumeDim; ++grid_i) {
-          logical_to_inertial_inv_jac.get(logical_i, inertial_i) +=
-              logical_to_grid_inv_jac.get(logical_i, grid_i) *
-              grid_to_inertial_inv_jac.get(grid_i, inertial_i);
-        }
-      }
+  } else if (grid_to_inertial_map.jacobian_is_spatially_uniform()) {
+    // Evaluate the Jacobian at a single point and apply it to all points
+    tnsr::I<double, VolumeDim, Frame::ElementLogical> first_logical_point{};
+    for (size_t d = 0; d < VolumeDim; ++d) {
+      first_logical_point.get(d) = logical_coords.get(d)[0];
     }
+    contract_inv_jacobians(grid_to_inertial_map.inv_jacobian(
+        logical_to_grid_map(first_logical_point), time, functions_of_time));
+  } else {
+    contract_inv_jacobians(grid_to_inertial_map.inv_jacobian(
+        logical_to_grid_map(logical_coords), time, functions_of_time));
   }
 
   unnormalized_face_normal(result, interface_mesh, logical_to_inertial_inv_jac,
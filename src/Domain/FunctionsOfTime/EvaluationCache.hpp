@@ -0,0 +1,156 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain::FunctionsOfTime::FunctionOfTimeHelpers {
+/*!
+ * \brief A lock-free cache of the most recent evaluations of a function of
+ * time, keyed on the time.
+ *
+ * \details Functions of time are shared by all elements on a node, and each
+ * element evaluates them at the same times, e.g. once per substep. A function
+ * of time holds this cache so that each time is evaluated once instead of once
+ * per element. This is worthwhile when the evaluation is expensive, such as the
+ * ODE solve of the `QuaternionFunctionOfTime`.
+ *
+ * The cache holds `NumberOfSlots` evaluations of up to `MaxValues` doubles in
+ * total. Each slot is a sequence lock: readers never wait, and a reader that
+ * overlaps with a writer of the same slot sees a miss and evaluates the
+ * function itself. A writer that finds its slot held by another writer skips
+ * storing its evaluation. Evaluations with more than `MaxValues` doubles are
+ * not cached.
+ *
+ * The cached values must not change over the lifetime of the function of
+ * time. This holds for functions of time because updates only extend the
+ * domain of validity. Copies and moves start with an empty cache since the
+ * cache isn't part of the state of the function of time.
+ */
+template <size_t MaxValues, size_t NumberOfSlots = 4>
+class EvaluationCache {
+ public:
+  EvaluationCache() = default;
+  EvaluationCache(const EvaluationCache& /*rhs*/) {}
+  EvaluationCache(EvaluationCache&& /*rhs*/) {}
+  EvaluationCache& operator=(const EvaluationCache& /*rhs*/) {
+    clear();
+    return *this;
+  }
+  EvaluationCache& operator=(EvaluationCache&& /*rhs*/) {
+    clear();
+    return *this;
+  }
+  ~EvaluationCache() = default;
+
+  /// Retrieve the cached values at time `t` into the `result`. Returns `false`
+  /// if they are not cached, or if fewer arrays than `NumArrays` are cached.
+  template <size_t NumArrays>
+  bool get(gsl::not_null<std::array<DataVector, NumArrays>*> result,
+           double t) const;
+
+  /// Cache the `values` at time `t`
+  template <size_t NumArrays>
+  void store(double t, const std::array<DataVector, NumArrays>& values);
+
+  /// Remove all cached values. Must not be called concurrently with other
+  /// operations.
+  void clear();
+
+ private:
+  struct Slot {
+    // Odd while a writer modifies the slot
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<double> time{std::numeric_limits<double>::quiet_NaN()};
+    std::atomic<size_t> num_arrays{0};
+    std::atomic<size_t> array_size{0};
+    std::array<std::atomic<double>, MaxValues> values{};
+  };
+
+  static size_t slot_index(double t) {
+    // Mix the bits of the time so subsequent times spread over the slots
+    const auto bits = std::bit_cast<uint64_t>(t);
+    return static_cast<size_t>((bits ^ (bits >> 29) ^ (bits >> 41)) %
+                               NumberOfSlots);
+  }
+
+  std::array<Slot, NumberOfSlots> slots_{};
+};
+
+template <size_t MaxValues, size_t NumberOfSlots>
+template <size_t NumArrays>
+bool EvaluationCache<MaxValues, NumberOfSlots>::get(
+    const gsl::not_null<std::array<DataVector, NumArrays>*> result,
+    const double t) const {
+  const Slot& slot = gsl::at(slots_, slot_index(t));
+  const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+  if (sequence % 2 == 1 or slot.time.load(std::memory_order_relaxed) != t) {
+    return false;
+  }
+  const size_t num_arrays = slot.num_arrays.load(std::memory_order_relaxed);
+  const size_t array_size = slot.array_size.load(std::memory_order_relaxed);
+  if (num_arrays < NumArrays or NumArrays * array_size > MaxValues) {
+    return false;
+  }
+  for (size_t i = 0; i < NumArrays; ++i) {
+    auto& array = gsl::at(*result, i);
+    if (array.size() != array_size) {
+      array.destructive_resize(array_size);
+    }
+    for (size_t j = 0; j < array_size; ++j) {
+      array[j] = gsl::at(slot.values, i * array_size + j)
+                     .load(std::memory_order_relaxed);
+    }
+  }
+  // The values are only valid if no writer modified the slot while reading
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+template <size_t MaxValues, size_t NumberOfSlots>
+template <size_t NumArrays>
+void EvaluationCache<MaxValues, NumberOfSlots>::store(
+    const double t, const std::array<DataVector, NumArrays>& values) {
+  const size_t array_size = values[0].size();
+  if (NumArrays * array_size > MaxValues) {
+    return;
+  }
+  Slot& slot = gsl::at(slots_, slot_index(t));
+  uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+  // Don't wait for another writer, just skip caching
+  if (sequence % 2 == 1 or
+      not slot.sequence.compare_exchange_strong(sequence, sequence + 1,
+                                                std::memory_order_acquire)) {
+    return;
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.time.store(t, std::memory_order_relaxed);
+  slot.num_arrays.store(NumArrays, std::memory_order_relaxed);
+  slot.array_size.store(array_size, std::memory_order_relaxed);
+  for (size_t i = 0; i < NumArrays; ++i) {
+    for (size_t j = 0; j < array_size; ++j) {
+      gsl::at(slot.values, i * array_size + j)
+          .store(gsl::at(values, i)[j], std::memory_order_relaxed);
+    }
+  }
+  slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+template <size_t MaxValues, size_t NumberOfSlots>
+void EvaluationCache<MaxValues, NumberOfSlots>::clear() {
+  for (auto& slot : slots_) {
+    slot.time.store(std::numeric_limits<double>::quiet_NaN(),
+                    std::memory_order_relaxed);
+    slot.num_arrays.store(0, std::memory_order_relaxed);
+  }
+}
+}  // namespace domain::FunctionsOfTime::FunctionOfTimeHelpers
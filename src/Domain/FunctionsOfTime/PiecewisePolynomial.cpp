@@ -73,12 +73,17 @@ template <size_t MaxDeriv>
 template <size_t MaxDerivReturned>
 std::array<DataVector, MaxDerivReturned + 1>
 PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const {
+  std::array<DataVector, MaxDerivReturned + 1> result{};
+  if (evaluation_cache_.get(make_not_null(&result), t)) {
+    return result;
+  }
+
   const auto deriv_info_at_t = deriv_info_at_update_times_(t);
   const double dt = t - deriv_info_at_t.update;
   const auto& coefs = deriv_info_at_t.data;
 
   // initialize result for the number of derivs requested
-  std::array<DataVector, MaxDerivReturned + 1> result =
+  result =
       make_array<MaxDerivReturned + 1>(DataVector(coefs.back().size(), 0.0));
 
   // evaluate the polynomial using ddpoly (Numerical Recipes sec 5.1)
@@ -97,6 +102,7 @@ PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const {
     gsl::at(result, j) *= fact;
   }
 
+  evaluation_cache_.store(t, result);
   return result;
 }
 
@@ -203,6 +209,10 @@ double PiecewisePolynomial<MaxDeriv>::expiration_after(
 template <size_t MaxDeriv>
 void PiecewisePolynomial<MaxDeriv>::pup(PUP::er& p) {
   FunctionOfTime::pup(p);
+  // The evaluation cache isn't serialized
+  if (p.isUnpacking()) {
+    evaluation_cache_.clear();
+  }
   size_t version = 4;
   p | version;
   // Remember to increment the version number when making changes to this
@@ -14,6 +14,7 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/EvaluationCache.hpp"
 #include "Domain/FunctionsOfTime/ThreadsafeList.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 
@@ -116,6 +117,8 @@ class PiecewisePolynomial : public FunctionOfTime {
   FunctionOfTimeHelpers::ThreadsafeList<std::array<DataVector, MaxDeriv + 1>>
       deriv_info_at_update_times_;
   std::map<double, std::pair<DataVector, double>> update_backlog_{};
+  // Holds e.g. three derivatives of a 3D translation
+  mutable FunctionOfTimeHelpers::EvaluationCache<16> evaluation_cache_{};
 };
 
 template <size_t MaxDeriv>
@@ -11,6 +11,7 @@
 #include <array>
 #include <boost/math/quaternion.hpp>
 #include <boost/numeric/odeint.hpp>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
@@ -21,6 +22,7 @@
 #include <ostream>
 #include <pup.h>
 #include <pup_stl.h>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -36,6 +38,43 @@
 #include "Utilities/StdHelpers.hpp"
 
 namespace domain::FunctionsOfTime {
+namespace {
+// Evaluates the Chebyshev fit of the interval from `t0` to `expiration` at
+// time `t` with the Clenshaw recurrence
+template <size_t NumCoefficients>
+boost::math::quaternion<double> evaluate_fit(
+    const std::vector<std::array<boost::math::quaternion<double>,
+                                 NumCoefficients>>& fit,
+    const double t0, const double expiration, const double t) {
+  const double segment_length =
+      (expiration - t0) / static_cast<double>(fit.size());
+  const double segments_before_t = std::max((t - t0) / segment_length, 0.0);
+  const size_t segment = std::min(static_cast<size_t>(segments_before_t),
+                                  fit.size() - 1);
+  const double x = std::clamp(
+      2.0 * (segments_before_t - static_cast<double>(segment)) - 1.0, -1.0,
+      1.0);
+  const auto& coefficients = fit[segment];
+  boost::math::quaternion<double> b1{0.0};
+  boost::math::quaternion<double> b2{0.0};
+  for (size_t j = NumCoefficients - 1; j > 0; --j) {
+    const boost::math::quaternion<double> b =
+        2.0 * x * b1 - b2 + coefficients[j];
+    b2 = b1;
+    b1 = b;
+  }
+  return x * b1 - b2 + coefficients[0];
+}
+}  // namespace
+
+template <size_t MaxDeriv>
+void QuaternionFunctionOfTime<MaxDeriv>::StoredQuaternion::pup(PUP::er& p) {
+  p | quaternion;
+  if (p.isUnpacking()) {
+    fit.clear();
+  }
+}
+
 template <size_t MaxDeriv>
 QuaternionFunctionOfTime<MaxDeriv>::QuaternionFunctionOfTime() = default;
 
@@ -65,8 +104,11 @@ QuaternionFunctionOfTime<MaxDeriv>::QuaternionFunctionOfTime(
     const double expiration_time)
     : stored_quaternions_and_times_(t),
       angle_f_of_t_(t, std::move(initial_angle_func), expiration_time) {
+  auto initial_quaternion = datavector_to_quaternion(initial_quat_func[0]);
+  auto fit = fit_quaternion(initial_quaternion, t, expiration_time);
   stored_quaternions_and_times_.insert(
-      t, datavector_to_quaternion(initial_quat_func[0]), expiration_time);
+      t, StoredQuaternion{initial_quaternion, std::move(fit)},
+      expiration_time);
 }
 
 template <size_t MaxDeriv>
@@ -94,6 +136,10 @@ double QuaternionFunctionOfTime<MaxDeriv>::expiration_after(
 template <size_t MaxDeriv>
 void QuaternionFunctionOfTime<MaxDeriv>::pup(PUP::er& p) {
   FunctionOfTime::pup(p);
+  // The evaluation cache isn't serialized
+  if (p.isUnpacking()) {
+    evaluation_cache_.clear();
+  }
   size_t version = 5;
   p | version;
   // Remember to increment the version number when making changes to this
@@ -102,15 +148,18 @@ void QuaternionFunctionOfTime<MaxDeriv>::pup(PUP::er& p) {
 
   if (version < 4) {
     unpack_old_version(p, version);
-    return;
-  }
+  } else {
+    p | stored_quaternions_and_times_;
+    p | angle_f_of_t_;
 
-  p | stored_quaternions_and_times_;
-  p | angle_f_of_t_;
+    // Just use empty map when unpacking version 4
+    if (version >= 5) {
+      p | update_backlog_;
+    }
+  }
 
-  // Just use empty map when unpacking version 4
-  if (version >= 5) {
-    p | update_backlog_;
+  if (p.isUnpacking()) {
+    fit_latest_interval();
   }
 }
 
@@ -187,15 +236,48 @@ void QuaternionFunctionOfTime<MaxDeriv>::unpack_old_version(
   for (size_t i = 0; i < quaternions.size() - 1; ++i) {
     stored_quaternions_and_times_.insert(
         quaternions[i].time,
-        datavector_to_quaternion(quaternions[i].stored_quantities[0]),
+        StoredQuaternion{
+            datavector_to_quaternion(quaternions[i].stored_quantities[0])},
         quaternions[i + 1].time);
   }
   stored_quaternions_and_times_.insert(
       quaternions.back().time,
-      datavector_to_quaternion(quaternions.back().stored_quantities[0]),
+      StoredQuaternion{
+          datavector_to_quaternion(quaternions.back().stored_quantities[0])},
       expiration_time);
 }
 
+template <size_t MaxDeriv>
+void QuaternionFunctionOfTime<MaxDeriv>::fit_latest_interval() {
+  // Earlier intervals are rarely evaluated after a restart, so they fall back
+  // to the ODE solve instead of paying for their fits up front
+  std::vector<std::tuple<double, boost::math::quaternion<double>, double>>
+      intervals{};
+  for (const auto& interval : stored_quaternions_and_times_) {
+    intervals.emplace_back(interval.update, interval.data.quaternion,
+                           interval.expiration);
+  }
+  if (intervals.empty()) {
+    return;
+  }
+  // The iteration goes from the latest interval to the earliest
+  std::reverse(intervals.begin(), intervals.end());
+
+  decltype(stored_quaternions_and_times_) fitted_intervals(
+      stored_quaternions_and_times_.initial_time());
+  for (size_t i = 0; i < intervals.size(); ++i) {
+    const auto& [update, quaternion, expiration] = intervals[i];
+    fitted_intervals.insert(
+        update,
+        StoredQuaternion{quaternion,
+                         i + 1 == intervals.size()
+                             ? fit_quaternion(quaternion, update, expiration)
+                             : std::vector<FitCoefficients>{}},
+        expiration);
+  }
+  stored_quaternions_and_times_ = std::move(fitted_intervals);
+}
+
 template <size_t MaxDeriv>
 void QuaternionFunctionOfTime<MaxDeriv>::update(
     const double time_of_update, DataVector updated_max_deriv,
@@ -223,15 +305,22 @@ void QuaternionFunctionOfTime<MaxDeriv>::update(
 
     const auto old_interval =
         stored_quaternions_and_times_(stored_time_of_update);
-    boost::math::quaternion<double> quaternion_to_integrate = old_interval.data;
+    boost::math::quaternion<double> quaternion_to_integrate =
+        old_interval.data.quaternion;
 
     solve_quaternion_ode(make_not_null(&quaternion_to_integrate),
                          old_interval.update, old_interval.expiration);
 
     normalize_quaternion(make_not_null(&quaternion_to_integrate));
 
+    // The angle is known over the whole new interval, so it can be fitted
+    // right away
+    auto fit = fit_quaternion(quaternion_to_integrate, stored_time_of_update,
+                              stored_expiration_time);
     stored_quaternions_and_times_.insert(
-        stored_time_of_update, quaternion_to_integrate, stored_expiration_time);
+        stored_time_of_update,
+        StoredQuaternion{quaternion_to_integrate, std::move(fit)},
+        stored_expiration_time);
 
     update_backlog_.erase(entry);
   }
@@ -277,12 +366,114 @@ void QuaternionFunctionOfTime<MaxDeriv>::solve_quaternion_ode(
       t0 / factor, t / factor, 1e-4);
 }
 
+template <size_t MaxDeriv>
+auto QuaternionFunctionOfTime<MaxDeriv>::fit_quaternion(
+    const boost::math::quaternion<double>& initial_quaternion, const double t0,
+    const double expiration) const -> std::vector<FitCoefficients> {
+  if (not std::isfinite(expiration)) {
+    return {};
+  }
+  // Rescale the times to order unity, see solve_quaternion_ode
+  const double factor = std::max(1.0, std::max(t0, expiration));
+  const auto quaternion_ode_system =
+      [this, &factor](const boost::math::quaternion<double>& state,
+                      boost::math::quaternion<double>& dt_state,
+                      const double time) {
+        const boost::math::quaternion<double> omega = datavector_to_quaternion(
+            angle_f_of_t_.func_and_deriv(time * factor)[1]);
+        dt_state = factor * 0.5 * state * omega;
+      };
+
+  // The fits sample the ODE solution at the Chebyshev-Gauss-Lobatto points
+  // x_k = -cos(pi k / N) of each segment, where
+  // T_j(x_k) = (-1)^j cos(pi j k / N)
+  constexpr size_t order = fit_order;
+  for (size_t number_of_segments = 1; number_of_segments <= max_fit_segments;
+       number_of_segments *= 2) {
+    const double segment_length =
+        (expiration - t0) / static_cast<double>(number_of_segments);
+    std::vector<double> times(number_of_segments * order + 1);
+    for (size_t segment = 0; segment < number_of_segments; ++segment) {
+      const double segment_start =
+          t0 + static_cast<double>(segment) * segment_length;
+      for (size_t k = 0; k < order; ++k) {
+        times[segment * order + k] =
+            (segment_start +
+             0.5 * segment_length *
+                 (1.0 - cos(M_PI * static_cast<double>(k) /
+                            static_cast<double>(order)))) /
+            factor;
+      }
+    }
+    times.back() = expiration / factor;
+
+    // Sample with tighter tolerances than the ODE solves so the fits resolve
+    // the quaternion to roundoff
+    std::vector<boost::math::quaternion<double>> samples{};
+    samples.reserve(times.size());
+    boost::math::quaternion<double> state = initial_quaternion;
+    auto dense_stepper = boost::numeric::odeint::make_dense_output(
+        1.0e-14, 1.0e-14,
+        boost::numeric::odeint::runge_kutta_dopri5<
+            boost::math::quaternion<double>, double,
+            boost::math::quaternion<double>, double,
+            boost::numeric::odeint::vector_space_algebra>{});
+    boost::numeric::odeint::integrate_times(
+        dense_stepper, quaternion_ode_system, state, times.begin(), times.end(),
+        1e-4,
+        [&samples](const boost::math::quaternion<double>& sample,
+                   const double /*time*/) { samples.push_back(sample); });
+
+    std::vector<FitCoefficients> fit(number_of_segments);
+    bool converged = true;
+    for (size_t segment = 0; segment < number_of_segments and converged;
+         ++segment) {
+      auto& coefficients = fit[segment];
+      for (size_t j = 0; j <= order; ++j) {
+        boost::math::quaternion<double> sum{0.0};
+        for (size_t k = 0; k <= order; ++k) {
+          const double weight = (k == 0 or k == order) ? 0.5 : 1.0;
+          sum += weight *
+                 cos(M_PI * static_cast<double>(j * k) /
+                     static_cast<double>(order)) *
+                 samples[segment * order + k];
+        }
+        coefficients[j] = ((j % 2 == 0) ? 2.0 : -2.0) *
+                          ((j == 0 or j == order) ? 0.5 : 1.0) * sum /
+                          static_cast<double>(order);
+      }
+      converged = sup(coefficients[order - 1]) + sup(coefficients[order]) <
+                  fit_tolerance;
+    }
+    if (converged) {
+      return fit;
+    }
+  }
+  return {};
+}
+
 template <size_t MaxDeriv>
 boost::math::quaternion<double> QuaternionFunctionOfTime<MaxDeriv>::setup_func(
     const double t) const {
   // Get quaternion and time at closest time before t
   const auto stored_info_at_t0 = stored_quaternions_and_times_(t);
-  boost::math::quaternion<double> quat_to_integrate = stored_info_at_t0.data;
+  if (not stored_info_at_t0.data.fit.empty()) {
+    boost::math::quaternion<double> quaternion =
+        evaluate_fit(stored_info_at_t0.data.fit, stored_info_at_t0.update,
+                     stored_info_at_t0.expiration, t);
+    normalize_quaternion(make_not_null(&quaternion));
+    return quaternion;
+  }
+
+  // The ODE solve is expensive, so reuse the quaternion at t if it was already
+  // integrated, e.g. by another element
+  std::array<DataVector, 1> cached_quaternion{};
+  if (evaluation_cache_.get(make_not_null(&cached_quaternion), t)) {
+    return datavector_to_quaternion(cached_quaternion[0]);
+  }
+
+  boost::math::quaternion<double> quat_to_integrate =
+      stored_info_at_t0.data.quaternion;
 
   // Solve the ode and store the result in quat_to_integrate
   solve_quaternion_ode(make_not_null(&quat_to_integrate),
@@ -291,6 +482,8 @@ boost::math::quaternion<double> QuaternionFunctionOfTime<MaxDeriv>::setup_func(
   // Make unit quaternion
   normalize_quaternion(make_not_null(&quat_to_integrate));
 
+  evaluation_cache_.store(t, std::array<DataVector, 1>{
+                                 quaternion_to_datavector(quat_to_integrate)});
   return quat_to_integrate;
 }
 
@@ -416,7 +609,7 @@ std::ostream& operator<<(
 
   os << "Quaternion:\n";
   for (const auto& entry : iters) {
-    os << "t=" << entry->update << ": " << entry->data << "\n";
+    os << "t=" << entry->update << ": " << entry->data.quaternion << "\n";
   }
   using ::operator<<;
   os << "backlog=" << quaternion_f_of_t.update_backlog_ << "\n";
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/EvaluationCache.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
 #include "Domain/FunctionsOfTime/ThreadsafeList.hpp"
@@ -42,6 +43,16 @@ namespace domain::FunctionsOfTime {
  * around the internal `PiecewisePolynomial::update` function with the addition
  * that it then updates the stored quaternions as well.
  *
+ * Because the elements evaluate the quaternion at every substep, `update`
+ * (and the constructor) also fits the quaternion over each new update interval
+ * with Chebyshev polynomials of degree `fit_order`, on as many equal segments
+ * as necessary to reach an accuracy of `fit_tolerance`. Evaluating the
+ * quaternion within the interval is then a polynomial evaluation instead of an
+ * ODE solve. The fits are not serialized. After deserialization only the
+ * latest interval is fitted again, and intervals without a fit (including
+ * intervals that never expire) fall back to solving the ODE from the start of
+ * the interval.
+ *
  * The angle PiecewisePolynomial is accessible through the `angle_func`,
  * `angle_func_and_deriv`, and `angle_func_and_2_derivs` functions which
  * correspond to the function calls of a normal PiecewisePolynomial except
@@ -61,6 +72,13 @@ namespace domain::FunctionsOfTime {
 template <size_t MaxDeriv>
 class QuaternionFunctionOfTime : public FunctionOfTime {
  public:
+  /// Polynomial degree of the fits of the quaternion
+  static constexpr size_t fit_order = 16;
+  /// Bound on the last two Chebyshev coefficients of each fit
+  static constexpr double fit_tolerance = 1.0e-13;
+  /// Intervals that need more segments than this aren't fitted
+  static constexpr size_t max_fit_segments = 256;
+
   QuaternionFunctionOfTime();
   QuaternionFunctionOfTime(QuaternionFunctionOfTime&&);
   QuaternionFunctionOfTime(const QuaternionFunctionOfTime&);
@@ -165,10 +183,36 @@ class QuaternionFunctionOfTime : public FunctionOfTime {
       std::ostream& os,
       const QuaternionFunctionOfTime<LocalMaxDeriv>& quaternion_f_of_t);
 
-  FunctionOfTimeHelpers::ThreadsafeList<boost::math::quaternion<double>>
+  using FitCoefficients =
+      std::array<boost::math::quaternion<double>, fit_order + 1>;
+
+  struct StoredQuaternion {
+    // The quaternion at the start of the interval
+    boost::math::quaternion<double> quaternion{};
+    // Chebyshev coefficients of the quaternion on equal segments of the
+    // interval, or empty if the interval isn't fitted
+    std::vector<FitCoefficients> fit{};
+
+    // Only the quaternion is serialized
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+
+    friend bool operator==(const StoredQuaternion& lhs,
+                           const StoredQuaternion& rhs) {
+      return lhs.quaternion == rhs.quaternion;
+    }
+    friend bool operator!=(const StoredQuaternion& lhs,
+                           const StoredQuaternion& rhs) {
+      return not(lhs == rhs);
+    }
+  };
+
+  FunctionOfTimeHelpers::ThreadsafeList<StoredQuaternion>
       stored_quaternions_and_times_{};
   domain::FunctionsOfTime::PiecewisePolynomial<MaxDeriv> angle_f_of_t_{};
   std::map<double, double> update_backlog_{};
+  // Holds the integrated quaternions
+  mutable FunctionOfTimeHelpers::EvaluationCache<4> evaluation_cache_{};
 
   void unpack_old_version(PUP::er& p, size_t version);
 
@@ -179,6 +223,17 @@ class QuaternionFunctionOfTime : public FunctionOfTime {
       gsl::not_null<boost::math::quaternion<double>*> quaternion_to_integrate,
       double t0, double t) const;
 
+  /// Fits the solution of the ODE from time `t0` to the `expiration` time,
+  /// starting at the `initial_quaternion`. Returns an empty fit if the interval
+  /// never expires or needs more than `max_fit_segments` segments.
+  std::vector<FitCoefficients> fit_quaternion(
+      const boost::math::quaternion<double>& initial_quaternion, double t0,
+      double expiration) const;
+
+  /// Replaces the stored intervals after deserialization, fitting the latest
+  /// one
+  void fit_latest_interval();
+
   /// Does common operations to all the `func` functions such as updating stored
   /// info, solving the ODE, and returning the normalized quaternion as a boost
   /// quaternion for easy calculations
@@ -29,6 +29,16 @@ struct Interval;
 /// operations except for serialization can be safely performed in
 /// parallel with each other and with `insert` and will return a
 /// consistent state.
+///
+/// Lookups in the latest interval, and repeated lookups in the same
+/// earlier interval, take constant time regardless of the length of
+/// the list.  Other lookups search the list from the latest interval.
+/// Owners can bound the memory use by truncating old intervals with
+/// `truncate_at_time` or `truncate_to_length`, as
+/// `IntegratedFunctionOfTime` does on every update.  Truncated
+/// intervals are freed by the next truncation (or `clear`) rather
+/// than immediately, so lookups that are in flight during a
+/// truncation remain safe.
 template <typename T>
 class ThreadsafeList {
  private:
@@ -171,6 +181,10 @@ class ThreadsafeList {
   const Interval& find_interval(double time,
                                 bool interval_after_boundary) const;
 
+  // Detach the intervals before `interval` and free the ones detached by the
+  // previous truncation.
+  void retire_intervals_before(Interval* interval);
+
   alignas(64) std::atomic<double> initial_time_ =
       std::numeric_limits<double>::signaling_NaN();
   // Pad memory to avoid false-sharing when accessing initial_time_
@@ -183,6 +197,12 @@ class ThreadsafeList {
   char
       unused_padding_most_recent_interval_[64 - (sizeof(most_recent_interval_) %
                                                  64)] = {};
+  // The interval found by the last lookup that had to search the list
+  alignas(64) mutable std::atomic<const Interval*> lookup_hint_{};
+  // Pad memory to avoid false-sharing when accessing lookup_hint_
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  char unused_padding_lookup_hint_[64 - (sizeof(lookup_hint_) % 64)] = {};
+  std::unique_ptr<Interval> retired_intervals_{};
 };
 
 template <typename T>
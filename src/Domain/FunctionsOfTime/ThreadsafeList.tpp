@@ -20,11 +20,16 @@ namespace ThreadsafeList_detail {
 template <typename T>
 struct Interval {
   Interval() = default;
-  Interval(double in_expiration, T in_data,
+  Interval(double in_update, double in_expiration, T in_data,
            std::unique_ptr<Interval> in_previous)
-      : expiration(in_expiration),
+      : update(in_update),
+        expiration(in_expiration),
         data(std::move(in_data)),
         previous(std::move(in_previous)) {}
+  // The update time is stored so that lookups can check an interval without
+  // accessing the previous one, which may be truncated concurrently.  It is
+  // not serialized, but restored from the previous expiration.
+  double update{};
   double expiration{};
   T data{};
   std::unique_ptr<Interval> previous{};
@@ -63,6 +68,9 @@ auto ThreadsafeList<T>::operator=(ThreadsafeList&& other) -> ThreadsafeList& {
   interval_list_ = std::move(other.interval_list_);
   most_recent_interval_.store(interval_list_.get(), std::memory_order_release);
   other.most_recent_interval_.store(nullptr, std::memory_order_release);
+  lookup_hint_.store(nullptr, std::memory_order_release);
+  other.lookup_hint_.store(nullptr, std::memory_order_release);
+  retired_intervals_.reset();
   return *this;
 }
 
@@ -79,11 +87,13 @@ auto ThreadsafeList<T>::operator=(const ThreadsafeList& other)
   for (auto&& entry : other) {
     // make_unique doesn't work on aggregates until C++20
     previous_pointer->reset(
-        new Interval{entry.expiration, entry.data, nullptr});
+        new Interval{entry.update, entry.expiration, entry.data, nullptr});
     previous_pointer = &(*previous_pointer)->previous;
   }
 
   most_recent_interval_.store(interval_list_.get(), std::memory_order_release);
+  lookup_hint_.store(nullptr, std::memory_order_release);
+  retired_intervals_.reset();
   return *this;
 }
 
@@ -111,8 +121,9 @@ void ThreadsafeList<T>::insert(const double update_time, T data,
                              << update_time);
   }
   // make_unique doesn't work on aggregates until C++20
-  std::unique_ptr<Interval> new_interval(new Interval{
-      expiration_time, std::move(data), std::move(interval_list_)});
+  std::unique_ptr<Interval> new_interval(
+      new Interval{update_time, expiration_time, std::move(data),
+                   std::move(interval_list_)});
   auto* const new_interval_p = new_interval.get();
   interval_list_ = std::move(new_interval);
   if (not most_recent_interval_.compare_exchange_strong(
@@ -172,7 +183,7 @@ void ThreadsafeList<T>::truncate_to_length(const size_t length) {
   }
 
   initial_time_.store(last_interval->previous->expiration);
-  last_interval->previous.reset();
+  retire_intervals_before(last_interval);
 }
 
 template <typename T>
@@ -198,7 +209,7 @@ void ThreadsafeList<T>::truncate_at_time(const double time) {
   }
 
   initial_time_.store(last_interval->previous->expiration);
-  last_interval->previous.reset();
+  retire_intervals_before(last_interval);
 }
 
 template <typename T>
@@ -210,7 +221,18 @@ void ThreadsafeList<T>::clear() {
   }
   initial_time_.store(interval_list_->expiration);
   most_recent_interval_.store(nullptr, std::memory_order_release);
+  lookup_hint_.store(nullptr, std::memory_order_release);
   interval_list_.reset();
+  retired_intervals_.reset();
+}
+
+template <typename T>
+void ThreadsafeList<T>::retire_intervals_before(Interval* const interval) {
+  // A reader may have loaded the hint just before it is reset, so the
+  // removed intervals are only freed by the next truncation, which is long
+  // after any such lookup has finished.
+  lookup_hint_.store(nullptr, std::memory_order_release);
+  retired_intervals_ = std::move(interval->previous);
 }
 
 template <typename T>
@@ -230,12 +252,20 @@ void ThreadsafeList<T>::pup(PUP::er& p) {
     bool empty{};
     p | empty;
     interval_list_.reset();
+    retired_intervals_.reset();
     if (not empty) {
       interval_list_ = std::make_unique<Interval>();
       p | *interval_list_;
     }
+    for (Interval* interval = interval_list_.get(); interval != nullptr;
+         interval = interval->previous.get()) {
+      interval->update = interval->previous != nullptr
+                             ? interval->previous->expiration
+                             : initial_time_.load(std::memory_order_acquire);
+    }
     most_recent_interval_.store(interval_list_.get(),
                                 std::memory_order_release);
+    lookup_hint_.store(nullptr, std::memory_order_release);
   } else {
     const Interval* const threadsafe_interval_list =
         most_recent_interval_.load(std::memory_order_acquire);
@@ -302,12 +332,27 @@ auto ThreadsafeList<T>::find_interval(const double time,
           << time << ", which is after the expiration time "
           << interval->expiration);
   }
+  // Most lookups are in the latest interval, or in the same interval as the
+  // previous lookup (e.g. when observing at an earlier time), so check those
+  // before searching the list.  Boundary points are left to the search.
+  if (time > interval->update) {
+    return *interval;
+  }
+  const Interval* const hint = lookup_hint_.load(std::memory_order_acquire);
+  if (hint != nullptr and time > hint->update and time < hint->expiration) {
+    return *hint;
+  }
   // Loop over the intervals until we find the one containing `time`,
   // possibly at the endpoint determined by `interval_after_boundary`.
   for (;;) {
     auto* const previous_interval = interval->previous.get();
     if (previous_interval == nullptr or time > previous_interval->expiration or
         (interval_after_boundary and time == previous_interval->expiration)) {
+      // Only write the hint when it changes so that concurrent lookups of
+      // the same interval don't contend for its cache line.
+      if (interval != hint) {
+        lookup_hint_.store(interval, std::memory_order_release);
+      }
       return *interval;
     }
     interval = previous_interval;
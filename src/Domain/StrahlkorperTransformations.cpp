@@ -5,9 +5,11 @@
 
 #include <cmath>
 #include <cstddef>
+#include <limits>
 #include <optional>
 #include <stdexcept>
 #include <tuple>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
@@ -25,6 +27,7 @@
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Tags.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
@@ -34,10 +37,18 @@ namespace {
 // Transforms cartesian coordinates of a strahlkorper
 // from one frame to another, by calling block_logical_coordinates and
 // calling the correct map functions.
+//
+// If `block_logical_coords` holds the block logical coordinates of a nearby
+// surface with the same number of points, e.g. of the same surface at an
+// earlier time, they are used as initial guess. On return,
+// `block_logical_coords` holds the block logical coordinates of the
+// `src_cartesian_coords`.
 template <typename SrcFrame, typename DestFrame>
 void coords_to_different_frame(
     const gsl::not_null<tnsr::I<DataVector, 3, DestFrame>*>
         dest_cartesian_coords,
+    const gsl::not_null<std::vector<BlockLogicalCoords<3>>*>
+        block_logical_coords,
     const tnsr::I<DataVector, 3, SrcFrame>& src_cartesian_coords,
     const Domain<3>& domain,
     const std::unordered_map<
@@ -49,8 +60,15 @@ void coords_to_different_frame(
   static_assert(std::is_same_v<SrcFrame, ::Frame::Grid> or
                     std::is_same_v<SrcFrame, ::Frame::Inertial>,
                 "Source frame must currently be Grid frame or Inertial frame");
-  const auto block_logical_coords = block_logical_coordinates(
-      domain, src_cartesian_coords, time, functions_of_time);
+  if (block_logical_coords->size() == get<0>(src_cartesian_coords).size()) {
+    *block_logical_coords =
+        block_logical_coordinates(domain, src_cartesian_coords,
+                                  *block_logical_coords, time,
+                                  functions_of_time);
+  } else {
+    *block_logical_coords = block_logical_coordinates(
+        domain, src_cartesian_coords, time, functions_of_time);
+  }
 
   tnsr::I<double, 3, DestFrame> x_dest{};
   tnsr::I<double, 3, SrcFrame> x_src{};
@@ -61,12 +79,12 @@ void coords_to_different_frame(
 
     // If this doesn't have a value, then the point isn't in the domain which is
     // really bad.
-    if (UNLIKELY(not block_logical_coords[s].has_value())) {
+    if (UNLIKELY(not(*block_logical_coords)[s].has_value())) {
       ERROR("A point on the Strahlkorper in the "
             << SrcFrame{} << " could not be mapped to a block: " << x_src);
     }
 
-    const auto& block_id_and_coords = block_logical_coords[s].value();
+    const auto& block_id_and_coords = (*block_logical_coords)[s].value();
     const auto& block = domain.blocks()[block_id_and_coords.id.get_index()];
 
     if constexpr (std::is_same_v<DestFrame, ::Frame::Distorted> and
@@ -106,25 +124,33 @@ void coords_to_different_frame(
     get<2>(*dest_cartesian_coords)[s] = get<2>(x_dest);
   }
 }
-}  // namespace
+// Memory and angular quantities that `transform_strahlkorper` reuses between
+// successive surfaces with the same resolution
+template <typename SrcFrame, typename DestFrame>
+struct TransformWorkspace {
+  size_t l_max = std::numeric_limits<size_t>::max();
+  size_t m_max = std::numeric_limits<size_t>::max();
+  Variables<
+      tmpl::list<::Tags::Tempi<0, 2, ::Frame::Spherical<SrcFrame>>,
+                 ::Tags::Tempi<1, 3, SrcFrame>, ::Tags::TempI<2, 3, SrcFrame>,
+                 ::Tags::TempI<3, 3, DestFrame>, ::Tags::TempScalar<4>,
+                 ::Tags::TempScalar<5>, ::Tags::TempScalar<6>,
+                 ::Tags::TempScalar<7>, ::Tags::TempScalar<8>>>
+      temp_buffer{};
+  std::vector<BlockLogicalCoords<3>> block_logical_coords{};
+};
 
 template <typename SrcFrame, typename DestFrame>
-void strahlkorper_in_different_frame(
+void transform_strahlkorper(
     const gsl::not_null<ylm::Strahlkorper<DestFrame>*> dest_strahlkorper,
+    const gsl::not_null<TransformWorkspace<SrcFrame, DestFrame>*> workspace,
     const ylm::Strahlkorper<SrcFrame>& src_strahlkorper,
     const Domain<3>& domain,
     const std::unordered_map<
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time,
     const double time) {
-  // Temporary storage; reduce the number of allocations.
-  Variables<
-      tmpl::list<::Tags::Tempi<0, 2, ::Frame::Spherical<SrcFrame>>,
-                 ::Tags::Tempi<1, 3, SrcFrame>, ::Tags::TempI<2, 3, SrcFrame>,
-                 ::Tags::TempI<3, 3, DestFrame>, ::Tags::TempScalar<4>,
-                 ::Tags::TempScalar<5>, ::Tags::TempScalar<6>,
-                 ::Tags::TempScalar<7>, ::Tags::TempScalar<8>>>
-      temp_buffer(src_strahlkorper.ylm_spherepack().physical_size());
+  auto& temp_buffer = workspace->temp_buffer;
   auto& src_theta_phi =
       get<::Tags::Tempi<0, 2, ::Frame::Spherical<SrcFrame>>>(temp_buffer);
   auto& r_hat = get<::Tags::Tempi<1, 3, SrcFrame>>(temp_buffer);
@@ -136,16 +162,25 @@ void strahlkorper_in_different_frame(
   auto& f_bracket_r_min = get<::Tags::TempScalar<7>>(temp_buffer);
   auto& f_bracket_r_max = get<::Tags::TempScalar<8>>(temp_buffer);
 
-  ylm::theta_phi(make_not_null(&src_theta_phi), src_strahlkorper);
-  // r_hat doesn't depend on the actual surface (that is, it is
-  // identical for the src and dest surfaces), so we use
-  // src_strahlkorper to compute it because it has a sensible max Ylm l.
-  ylm::rhat(make_not_null(&r_hat), src_theta_phi);
+  // The angles of the collocation points only depend on the resolution
+  if (src_strahlkorper.l_max() != workspace->l_max or
+      src_strahlkorper.m_max() != workspace->m_max) {
+    workspace->l_max = src_strahlkorper.l_max();
+    workspace->m_max = src_strahlkorper.m_max();
+    temp_buffer.initialize(src_strahlkorper.ylm_spherepack().physical_size());
+    workspace->block_logical_coords.clear();
+    ylm::theta_phi(make_not_null(&src_theta_phi), src_strahlkorper);
+    // r_hat doesn't depend on the actual surface (that is, it is
+    // identical for the src and dest surfaces), so we use
+    // src_strahlkorper to compute it because it has a sensible max Ylm l.
+    ylm::rhat(make_not_null(&r_hat), src_theta_phi);
+  }
   ylm::radius(make_not_null(&src_radius), src_strahlkorper);
   ylm::cartesian_coords(make_not_null(&src_cartesian_coords), src_strahlkorper,
                         src_radius, r_hat);
 
   coords_to_different_frame(make_not_null(&dest_cartesian_coords),
+                            make_not_null(&workspace->block_logical_coords),
                             src_cartesian_coords, domain, functions_of_time,
                             time);
 
@@ -286,6 +321,43 @@ void strahlkorper_in_different_frame(
       src_strahlkorper.l_max(), src_strahlkorper.m_max(), radius_at_each_angle,
       center_dest);
 }
+}  // namespace
+
+template <typename SrcFrame, typename DestFrame>
+void strahlkorper_in_different_frame(
+    const gsl::not_null<ylm::Strahlkorper<DestFrame>*> dest_strahlkorper,
+    const ylm::Strahlkorper<SrcFrame>& src_strahlkorper,
+    const Domain<3>& domain,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time,
+    const double time) {
+  TransformWorkspace<SrcFrame, DestFrame> workspace{};
+  transform_strahlkorper(dest_strahlkorper, make_not_null(&workspace),
+                         src_strahlkorper, domain, functions_of_time, time);
+}
+
+template <typename SrcFrame, typename DestFrame>
+void strahlkorpers_in_different_frame(
+    const gsl::not_null<std::vector<ylm::Strahlkorper<DestFrame>>*>
+        dest_strahlkorpers,
+    const std::vector<ylm::Strahlkorper<SrcFrame>>& src_strahlkorpers,
+    const std::vector<double>& times, const Domain<3>& domain,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) {
+  ASSERT(src_strahlkorpers.size() == times.size(),
+         "Need one time for each of the " << src_strahlkorpers.size()
+                                          << " Strahlkorpers, but got "
+                                          << times.size() << " times.");
+  dest_strahlkorpers->resize(src_strahlkorpers.size());
+  TransformWorkspace<SrcFrame, DestFrame> workspace{};
+  for (size_t i = 0; i < src_strahlkorpers.size(); ++i) {
+    transform_strahlkorper(make_not_null(&(*dest_strahlkorpers)[i]),
+                           make_not_null(&workspace), src_strahlkorpers[i],
+                           domain, functions_of_time, times[i]);
+  }
+}
 
 template <typename SrcFrame, typename DestFrame>
 void strahlkorper_in_different_frame_aligned(
@@ -318,7 +390,9 @@ void strahlkorper_in_different_frame_aligned(
   ylm::cartesian_coords(make_not_null(&src_cartesian_coords), src_strahlkorper,
                         radius, r_hat);
 
+  std::vector<BlockLogicalCoords<3>> block_logical_coords{};
   coords_to_different_frame(make_not_null(&dest_cartesian_coords),
+                            make_not_null(&block_logical_coords),
                             src_cartesian_coords, domain, functions_of_time,
                             time);
 
@@ -433,6 +507,21 @@ void strahlkorper_coords_in_different_frame(
 GENERATE_INSTANTIATIONS(INSTANTIATEGENERAL, (::Frame::Grid),
                         (::Frame::Inertial))
 
+#define INSTANTIATEBATCHED(_, data)                                         \
+  template void strahlkorpers_in_different_frame(                           \
+      const gsl::not_null<std::vector<ylm::Strahlkorper<DESTFRAME(data)>>*> \
+          dest_strahlkorpers,                                               \
+      const std::vector<ylm::Strahlkorper<SRCFRAME(data)>>&                 \
+          src_strahlkorpers,                                                \
+      const std::vector<double>& times, const Domain<3>& domain,            \
+      const std::unordered_map<                                             \
+          std::string,                                                      \
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&        \
+          functions_of_time);
+
+GENERATE_INSTANTIATIONS(INSTANTIATEBATCHED, (::Frame::Grid),
+                        (::Frame::Inertial))
+
 // Generate a specific instantiation: inertial -> distorted
 // (needed, e.g., for initializing a binary-black-hole ringdown).
 // Don't just add to GENERATE_INSTANTIATIONS above, to avoid also generating
@@ -446,6 +535,14 @@ template void strahlkorper_in_different_frame(
         std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
         functions_of_time,
     const double time);
+template void strahlkorpers_in_different_frame(
+    const gsl::not_null<std::vector<ylm::Strahlkorper<::Frame::Distorted>>*>
+        dest_strahlkorpers,
+    const std::vector<ylm::Strahlkorper<::Frame::Inertial>>& src_strahlkorpers,
+    const std::vector<double>& times, const Domain<3>& domain,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time);
 
 #define INSTANTIATEALIGNED(_, data)                                  \
   template void strahlkorper_in_different_frame_aligned(             \
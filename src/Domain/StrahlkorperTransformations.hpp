@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 
@@ -55,6 +56,29 @@ void strahlkorper_in_different_frame(
         functions_of_time,
     double time);
 
+/// \brief Transforms a series of Strahlkorpers from SrcFrame to DestFrame,
+/// each at the corresponding of the `times`.
+///
+/// This gives the same result as calling strahlkorper_in_different_frame for
+/// each Strahlkorper, but it is faster for a series of nearby surfaces, e.g.
+/// a horizon at successive times. The angular collocation quantities and the
+/// temporary buffers are computed once for all Strahlkorpers with the same
+/// resolution, and the block logical coordinates of each surface are the
+/// initial guess for the next one, so most points skip the search over all
+/// blocks.
+///
+/// \note strahlkorpers_in_different_frame is instantiated for the same frames
+/// as strahlkorper_in_different_frame.
+template <typename SrcFrame, typename DestFrame>
+void strahlkorpers_in_different_frame(
+    gsl::not_null<std::vector<ylm::Strahlkorper<DestFrame>>*>
+        dest_strahlkorpers,
+    const std::vector<ylm::Strahlkorper<SrcFrame>>& src_strahlkorpers,
+    const std::vector<double>& times, const Domain<3>& domain,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time);
+
 /// \brief Transforms a Strahlkorper from SrcFrame to DestFrame, for easy maps.
 ///
 /// This is a simplified version of strahlkorper_in_different_frame
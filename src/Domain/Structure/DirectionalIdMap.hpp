@@ -3,33 +3,540 @@
 
 #pragma once
 
-#include <boost/functional/hash.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <optional>
+#include <ostream>
 #include <pup.h>
+#include <pup_stl.h>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
-#include "DataStructures/FixedHashMap.hpp"
+#include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionalId.hpp"
 #include "Domain/Structure/MaxNumberOfNeighbors.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/ForceInline.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/PrintHelpers.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
 
-/// An optimized map with DirectionalId keys
+namespace domain {
+/*!
+ * \brief Computes an index in `[0, maximum_number_of_neighbors(Dim))` for the
+ * `directional_id` of a neighbor.
+ *
+ * The index is computed as
+ * \f{align}{
+ * 2^D d + 2^{D-1} s + e
+ * \f}
+ * where \f$D\f$ is the number of spatial dimensions, \f$d\f$ is the logical
+ * dimension of the direction to the neighbor, \f$s\f$ is the side in the
+ * logical dimension \f$d\f$ with a value of 1 for upper and 0 for lower, and
+ * \f$e\f$ is a hash of the index of the `SegmentId`'s of the neighbor's
+ * `ElementId` for the dimensions other than \f$d\f$. In particular: for
+ * \f$D=2\f$, \f$e\f$ is 0 (1) if the `SegmentId` index along the face is even
+ * (odd); and for \f$D = 3\f$ \f$e\f$ is 0 (1, 2, 3) if the `SegmentId` indices
+ * along the face are both even (lower dim odd, higher dim odd, both dims odd).
+ * The element segment hash is computed as the logical `and` of the
+ * `SegmentID`'s index in that direction, left shifted by which direction on
+ * the face it is.
+ *
+ * This is a perfect hash of the neighbors of an element with at most 2-to-1
+ * refinement if the neighbor's `ElementId` has been re-oriented into the block
+ * frame of the element. Otherwise, neighbors across a block boundary may share
+ * an index.
+ */
+template <size_t Dim>
+SPECTRE_ALWAYS_INLINE size_t
+directional_id_index(const DirectionalId<Dim>& directional_id) {
+  const Direction<Dim> direction = directional_id.direction();
+  const size_t side_offset = direction.side() == Side::Lower ? 0 : 1;
+  if constexpr (Dim == 1) {
+    return side_offset;
+  } else {
+    const ElementId<Dim> id = directional_id.id();
+    size_t result = 0;
+    for (size_t i = 0, j = 0; i < Dim; ++i) {
+      if (i == direction.dimension()) {
+        continue;
+      }
+      result = result | (id.segment_id(i).index() & 1) << j;
+      ++j;
+    }
+    return two_to_the(Dim) * direction.dimension() +
+           two_to_the(Dim - 1) * side_offset + result;
+  }
+}
+}  // namespace domain
+
+/*!
+ * \brief An optimized map with DirectionalId keys
+ *
+ * The entries are stored contiguously in insertion order in an inline buffer
+ * that can hold all `maximum_number_of_neighbors(Dim)` neighbors of an
+ * element, so iterating over the map touches only the stored entries. A lookup
+ * goes through a table of one-byte slots that is addressed by
+ * `domain::directional_id_index` and resolves collisions by linear probing.
+ * The table is a perfect hash for the neighbors of an element in its block
+ * frame, so lookups usually take one probe.
+ *
+ * The interface is that of `std::unordered_map`. Inserting does not invalidate
+ * iterators or references, but erasing moves the last entry into the place of
+ * the erased one, so it invalidates iterators and references to the last and
+ * the erased entries. Erasing while iterating with `it = map.erase(it)` visits
+ * all entries.
+ */
 template <size_t Dim, typename T>
-class DirectionalIdMap : public FixedHashMap<maximum_number_of_neighbors(Dim),
-                                             DirectionalId<Dim>, T> {
+class DirectionalIdMap {
+  static constexpr size_t max_size_ = maximum_number_of_neighbors(Dim);
+  static constexpr uint8_t empty_slot_ = 255;
+  static_assert(max_size_ < empty_slot_);
+
  public:
-  using base =
-      FixedHashMap<maximum_number_of_neighbors(Dim), DirectionalId<Dim>, T>;
-  using base::base;
+  using key_type = DirectionalId<Dim>;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = value_type*;
+  using const_iterator = const value_type*;
+
+  DirectionalIdMap() { slots_.fill(empty_slot_); }
+  DirectionalIdMap(std::initializer_list<value_type> init);
+  DirectionalIdMap(const DirectionalIdMap& rhs);
+  DirectionalIdMap& operator=(const DirectionalIdMap& rhs);
+  DirectionalIdMap(DirectionalIdMap&& rhs) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  DirectionalIdMap& operator=(DirectionalIdMap&& rhs) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~DirectionalIdMap() { clear(); }
+
+  iterator begin() { return data(); }
+  const_iterator begin() const { return data(); }
+  const_iterator cbegin() const { return begin(); }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  iterator end() { return data() + size_; }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  const_iterator end() const { return data() + size_; }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+  void clear();
+
+  /// @{
+  /// Inserts the element if it does not exists.
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return insert(value_type(value));
+  }
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return insert_or_assign_impl<false>(
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        const_cast<key_type&&>(value.first), std::move(value.second));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+  /// @}
+  /// @{
+  /// Inserts the element if it does not exists, otherwise assigns to it the new
+  /// value.
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+    return insert_or_assign(key_type{key}, std::forward<M>(obj));
+  }
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj) {
+    return insert_or_assign_impl<true>(std::move(key), std::forward<M>(obj));
+  }
+  /// @}
+
+  iterator erase(const const_iterator& pos);
+  size_t erase(const key_type& key);
+
+  mapped_type& at(const key_type& key);
+  const mapped_type& at(const key_type& key) const;
+  mapped_type& operator[](const key_type& key);
+
+  size_t count(const key_type& key) const {
+    return find_slot(key) == max_size_ ? 0 : 1;
+  }
+  iterator find(const key_type& key) {
+    const size_t slot = find_slot(key);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return slot == max_size_ ? end() : data() + gsl::at(slots_, slot);
+  }
+  const_iterator find(const key_type& key) const {
+    const size_t slot = find_slot(key);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return slot == max_size_ ? end() : data() + gsl::at(slots_, slot);
+  }
+
+  /// Check if `key` is in the map
+  bool contains(const key_type& key) const {
+    return find_slot(key) != max_size_;
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  template <bool Assign, class M>
+  std::pair<iterator, bool> insert_or_assign_impl(key_type&& key, M&& obj);
+
+  // Returns the slot that refers to the `key`, or `max_size_` if the `key` is
+  // not in the map
+  SPECTRE_ALWAYS_INLINE size_t find_slot(const key_type& key) const {
+    size_t slot = domain::directional_id_index(key);
+    for (size_t probe = 0; probe < max_size_; ++probe) {
+      const uint8_t entry = gsl::at(slots_, slot);
+      if (entry == empty_slot_) {
+        return max_size_;
+      }
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      if (data()[entry].first == key) {
+        return slot;
+      }
+      slot = slot + 1 == max_size_ ? 0 : slot + 1;
+    }
+    return max_size_;
+  }
+
+  // Points the first free slot at or after the hashed slot of the `key` to the
+  // entry with index `entry`
+  void insert_slot(const key_type& key, size_t entry);
+
+  // Destroys the entry with index `entry` and moves the last entry into its
+  // place
+  void erase_entry(size_t entry);
+
+  value_type* data() {
+    return std::launder(reinterpret_cast<value_type*>(storage_.data()));
+  }
+  const value_type* data() const {
+    return std::launder(
+        reinterpret_cast<const value_type*>(storage_.data()));
+  }
+
+  uint8_t size_ = 0;
+  std::array<uint8_t, max_size_> slots_;
+  alignas(value_type) std::array<std::byte, max_size_ * sizeof(value_type)>
+      storage_;
 };
 
+template <size_t Dim, typename T>
+DirectionalIdMap<Dim, T>::DirectionalIdMap(
+    std::initializer_list<value_type> init)
+    : DirectionalIdMap() {
+  for (const auto& entry : init) {
+    insert(entry);
+  }
+}
+
+template <size_t Dim, typename T>
+DirectionalIdMap<Dim, T>::DirectionalIdMap(const DirectionalIdMap& rhs)
+    : slots_(rhs.slots_) {
+  for (; size_ < rhs.size_; ++size_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    new (data() + size_) value_type(rhs.data()[size_]);
+  }
+}
+
+template <size_t Dim, typename T>
+DirectionalIdMap<Dim, T>& DirectionalIdMap<Dim, T>::operator=(
+    const DirectionalIdMap& rhs) {
+  if (this == &rhs) {
+    return *this;
+  }
+  clear();
+  for (; size_ < rhs.size_; ++size_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    new (data() + size_) value_type(rhs.data()[size_]);
+  }
+  slots_ = rhs.slots_;
+  return *this;
+}
+
+template <size_t Dim, typename T>
+DirectionalIdMap<Dim, T>::DirectionalIdMap(DirectionalIdMap&& rhs) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : slots_(rhs.slots_) {
+  for (; size_ < rhs.size_; ++size_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    new (data() + size_) value_type(std::move(rhs.data()[size_]));
+  }
+  rhs.clear();
+}
+
+template <size_t Dim, typename T>
+DirectionalIdMap<Dim, T>& DirectionalIdMap<Dim, T>::operator=(
+    DirectionalIdMap&& rhs) noexcept(std::is_nothrow_move_constructible_v<T>) {
+  if (this == &rhs) {
+    return *this;
+  }
+  clear();
+  for (; size_ < rhs.size_; ++size_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    new (data() + size_) value_type(std::move(rhs.data()[size_]));
+  }
+  slots_ = rhs.slots_;
+  rhs.clear();
+  return *this;
+}
+
+template <size_t Dim, typename T>
+void DirectionalIdMap<Dim, T>::clear() {
+  for (size_t i = 0; i < size_; ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::destroy_at(data() + i);
+  }
+  size_ = 0;
+  slots_.fill(empty_slot_);
+}
+
+template <size_t Dim, typename T>
+template <bool Assign, class M>
+auto DirectionalIdMap<Dim, T>::insert_or_assign_impl(key_type&& key,
+                                                     M&& obj)
+    -> std::pair<iterator, bool> {
+  const size_t slot = find_slot(key);
+  if (slot != max_size_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    value_type* const entry = data() + gsl::at(slots_, slot);
+    if constexpr (Assign) {
+      // The key is const, so replace the entry instead of assigning to it
+      std::destroy_at(entry);
+      new (entry) value_type(std::move(key), std::forward<M>(obj));
+    }
+    return {entry, false};
+  }
+  if (UNLIKELY(size_ == max_size_)) {
+    ERROR("Unable to insert " << key
+                              << " into DirectionalIdMap of maximum size "
+                              << max_size_ << " because it is full.");
+  }
+  insert_slot(key, size_);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  value_type* const entry = data() + size_;
+  new (entry) value_type(std::move(key), std::forward<M>(obj));
+  ++size_;
+  return {entry, true};
+}
+
+template <size_t Dim, typename T>
+void DirectionalIdMap<Dim, T>::insert_slot(const key_type& key,
+                                           const size_t entry) {
+  size_t slot = domain::directional_id_index(key);
+  ASSERT(slot < max_size_, "The index " << slot << " of " << key
+                                        << " is out of bounds.");
+  while (gsl::at(slots_, slot) != empty_slot_) {
+    slot = slot + 1 == max_size_ ? 0 : slot + 1;
+  }
+  gsl::at(slots_, slot) = static_cast<uint8_t>(entry);
+}
+
+template <size_t Dim, typename T>
+void DirectionalIdMap<Dim, T>::erase_entry(const size_t entry) {
+  const auto last = static_cast<size_t>(size_ - 1);
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  std::destroy_at(data() + entry);
+  if (entry != last) {
+    new (data() + entry) value_type(std::move(data()[last]));
+    std::destroy_at(data() + last);
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  --size_;
+  // Erasing is rare, so rebuild the slots instead of shifting the probe
+  // sequences
+  slots_.fill(empty_slot_);
+  for (size_t i = 0; i < size_; ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    insert_slot(data()[i].first, i);
+  }
+}
+
+template <size_t Dim, typename T>
+auto DirectionalIdMap<Dim, T>::erase(const const_iterator& pos) -> iterator {
+  ASSERT(pos >= begin() and pos < end(),
+         "Tried to erase an iterator that does not point into the map.");
+  const auto entry = static_cast<size_t>(pos - begin());
+  erase_entry(entry);
+  // The last entry has been moved into the place of the erased one, or the
+  // erased entry was the last one and this is `end()`
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  return data() + entry;
+}
+
+template <size_t Dim, typename T>
+size_t DirectionalIdMap<Dim, T>::erase(const key_type& key) {
+  const size_t slot = find_slot(key);
+  if (slot == max_size_) {
+    return 0;
+  }
+  erase_entry(gsl::at(slots_, slot));
+  return 1;
+}
+
+template <size_t Dim, typename T>
+auto DirectionalIdMap<Dim, T>::at(const key_type& key) -> mapped_type& {
+  const size_t slot = find_slot(key);
+  if (slot == max_size_) {
+    // Use `ERROR_AS` instead of `throw` to print a backtrace.
+    ERROR_AS(get_output(key) + " not in DirectionalIdMap", std::out_of_range);
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  return data()[gsl::at(slots_, slot)].second;
+}
+
+template <size_t Dim, typename T>
+auto DirectionalIdMap<Dim, T>::at(const key_type& key) const
+    -> const mapped_type& {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  return const_cast<DirectionalIdMap&>(*this).at(key);
+}
+
+template <size_t Dim, typename T>
+auto DirectionalIdMap<Dim, T>::operator[](const key_type& key)
+    -> mapped_type& {
+  const size_t slot = find_slot(key);
+  if (slot != max_size_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return data()[gsl::at(slots_, slot)].second;
+  }
+  return insert_or_assign_impl<false>(key_type{key}, mapped_type{})
+      .first->second;
+}
+
+template <size_t Dim, typename T>
+void DirectionalIdMap<Dim, T>::pup(PUP::er& p) {
+  // Remember to increment the version number when making changes to this
+  // function. Retain support for unpacking data written by previous versions
+  // whenever possible. See `Domain` docs for details.
+  //
+  // Versions 0 and 1 were written by the `FixedHashMap` that this class was
+  // previously derived from.
+  const uint8_t current_version = 2;
+  if (p.isUnpacking()) {
+    clear();
+    uint8_t version_read{0};
+    p | version_read;
+    if (LIKELY(version_read >= 2)) {
+      uint8_t size_read{0};
+      p | size_read;
+      for (size_t i = 0; i < size_read; ++i) {
+        key_type key{};
+        mapped_type value{};
+        p | key;
+        p | value;
+        insert_or_assign_impl<false>(std::move(key), std::move(value));
+      }
+    } else {
+      std::array<std::optional<value_type>, max_size_> legacy_data{};
+      if (version_read == 1) {
+        p | legacy_data;
+        uint8_t legacy_size{0};
+        p | legacy_size;
+      } else {
+        // Read next 3 bytes.
+        p | version_read;
+        p | version_read;
+        p | version_read;
+        // Read "bottom" of version
+        uint32_t old_version{0};
+        p | old_version;
+        if (UNLIKELY(old_version > 0)) {
+          ERROR(
+              "Incompatible version format for DirectionalIdMap. Expected to "
+              "receive version 0 but got "
+              << old_version);
+        }
+        p | legacy_data;
+        size_t legacy_size{0};
+        p | legacy_size;
+      }
+      for (auto& entry : legacy_data) {
+        if (entry.has_value()) {
+          insert(std::move(*entry));
+        }
+      }
+    }
+  } else {
+    uint8_t version_write = current_version;
+    p | version_write;
+    p | size_;
+    for (size_t i = 0; i < size_; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      value_type& entry = data()[i];
+      key_type key = entry.first;
+      p | key;
+      p | entry.second;
+    }
+  }
+}
+
+template <size_t Dim, typename T>
+bool operator==(const DirectionalIdMap<Dim, T>& a,
+                const DirectionalIdMap<Dim, T>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (const auto& [key, value] : a) {
+    const auto found_in_b = b.find(key);
+    if (found_in_b == b.end() or found_in_b->second != value) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <size_t Dim, typename T>
+bool operator!=(const DirectionalIdMap<Dim, T>& a,
+                const DirectionalIdMap<Dim, T>& b) {
+  return not(a == b);
+}
+
+template <size_t Dim, typename T>
+std::ostream& operator<<(std::ostream& os, const DirectionalIdMap<Dim, T>& m) {
+  unordered_print_helper(
+      os, std::begin(m), std::end(m),
+      [](std::ostream& out,
+         const typename DirectionalIdMap<Dim, T>::value_type& entry) {
+        out << "[";
+        print_value(out, entry.first);
+        out << ",";
+        print_value(out, entry.second);
+        out << "]";
+      });
+  return os;
+}
+
 namespace PUP {
 template <size_t Dim, typename T>
 // NOLINTNEXTLINE(google-runtime-references)
 void pup(PUP::er& p, DirectionalIdMap<Dim, T>& t) {
-  pup(p, static_cast<typename DirectionalIdMap<Dim, T>::base&>(t));
+  t.pup(p);
 }
 
 template <size_t Dim, typename T>
 // NOLINTNEXTLINE(google-runtime-references)
 void operator|(PUP::er& p, DirectionalIdMap<Dim, T>& t) {
-  p | static_cast<typename DirectionalIdMap<Dim, T>::base&>(t);
+  t.pup(p);
 }
 }  // namespace PUP
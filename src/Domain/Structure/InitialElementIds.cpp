@@ -70,11 +70,21 @@ std::vector<ElementId<VolumeDim>> initial_element_ids(
     const std::vector<std::array<size_t, VolumeDim>>& initial_refinement_levels,
     const size_t grid_index) {
   std::vector<ElementId<VolumeDim>> element_ids;
+  // Reserve the memory for all elements at once, instead of growing the
+  // vector block by block
+  size_t num_elements = 0;
+  for (const auto& initial_ref_levs : initial_refinement_levels) {
+    size_t num_elements_in_block = 1;
+    for (const size_t ref_lev : initial_ref_levs) {
+      num_elements_in_block *= two_to_the(ref_lev);
+    }
+    num_elements += num_elements_in_block;
+  }
+  element_ids.reserve(num_elements);
   for (size_t block_id = 0; block_id < initial_refinement_levels.size();
        ++block_id) {
     auto ids_for_block = initial_element_ids(
         block_id, initial_refinement_levels[block_id], grid_index);
-    element_ids.reserve(element_ids.size() + ids_for_block.size());
     std::move(ids_for_block.begin(), ids_for_block.end(),
               std::back_inserter(element_ids));
   }
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <numeric>
+#include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -16,6 +17,7 @@
 #include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/Side.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/TypeTraits.hpp"
@@ -23,25 +25,28 @@
 namespace {
 
 // 1D data can be aligned or anti-aligned
-std::vector<size_t> compute_offset_permutation(
-    const Index<1>& extents, const bool neighbor_axis_is_aligned) {
-  std::vector<size_t> oriented_offsets(extents.product());
+void compute_offset_permutation(
+    const gsl::not_null<std::vector<size_t>*> result, const Index<1>& extents,
+    const bool neighbor_axis_is_aligned) {
+  std::vector<size_t>& oriented_offsets = *result;
+  oriented_offsets.resize(extents.product());
   std::iota(oriented_offsets.begin(), oriented_offsets.end(), 0);
   if (not neighbor_axis_is_aligned) {
     std::reverse(oriented_offsets.begin(), oriented_offsets.end());
   }
-  return oriented_offsets;
 }
 
 // 2D data can have 8 different data-storage orders relative to the neighbor.
 // These are determined by whether the new data-storage order varies fastest by
 // the lowest dim or the highest dim, and by whether each axis is aligned or
 // anti-aligned.
-std::vector<size_t> compute_offset_permutation(
-    const Index<2>& extents, const bool neighbor_first_axis_is_aligned,
+void compute_offset_permutation(
+    const gsl::not_null<std::vector<size_t>*> result, const Index<2>& extents,
+    const bool neighbor_first_axis_is_aligned,
     const bool neighbor_second_axis_is_aligned,
     const bool neighbor_axes_are_transposed) {
-  std::vector<size_t> oriented_offsets(extents.product());
+  std::vector<size_t>& oriented_offsets = *result;
+  oriented_offsets.resize(extents.product());
   // Reduce the number of cases to explicitly write out by 4, by encoding the
   // (anti-)alignment of each axis as numerical factors ("offset" and "step")
   // that then contribute in identically-structured loops.
@@ -74,7 +79,6 @@ std::vector<size_t> compute_offset_permutation(
       }
     }
   }
-  return oriented_offsets;
 }
 
 // 3D data can have 48 (!) different data-storage orders relative to the
@@ -82,12 +86,14 @@ std::vector<size_t> compute_offset_permutation(
 // dimensions can be ordered from fastest to slowest varying. The remaining
 // factor of 8 arises from having two possible directions (aligned or
 // anti-aligned) for each of the three axes.
-std::vector<size_t> compute_offset_permutation(
-    const Index<3>& extents, const bool neighbor_first_axis_is_aligned,
+void compute_offset_permutation(
+    const gsl::not_null<std::vector<size_t>*> result, const Index<3>& extents,
+    const bool neighbor_first_axis_is_aligned,
     const bool neighbor_second_axis_is_aligned,
     const bool neighbor_third_axis_is_aligned,
     const std::array<size_t, 3>& neighbor_axis_permutation) {
-  std::vector<size_t> oriented_offsets(extents.product());
+  std::vector<size_t>& oriented_offsets = *result;
+  oriented_offsets.resize(extents.product());
   // Reduce the number of cases to explicitly write out by 8, by encoding the
   // (anti-)alignment of each axis as numerical factors ("offset" and "step")
   // that then contribute in identically-structured loops.
@@ -199,19 +205,20 @@ std::vector<size_t> compute_offset_permutation(
       }
     }
   }
-  return oriented_offsets;
 }
 
-std::vector<size_t> oriented_offset(
-    const Index<1>& extents, const OrientationMap<1>& orientation_of_neighbor) {
+void oriented_offset(const gsl::not_null<std::vector<size_t>*> result,
+                     const Index<1>& extents,
+                     const OrientationMap<1>& orientation_of_neighbor) {
   const Direction<1> neighbor_axis =
       orientation_of_neighbor(Direction<1>::upper_xi());
   const bool is_aligned = (neighbor_axis.side() == Side::Upper);
-  return compute_offset_permutation(extents, is_aligned);
+  compute_offset_permutation(result, extents, is_aligned);
 }
 
-std::vector<size_t> oriented_offset(
-    const Index<2>& extents, const OrientationMap<2>& orientation_of_neighbor) {
+void oriented_offset(const gsl::not_null<std::vector<size_t>*> result,
+                     const Index<2>& extents,
+                     const OrientationMap<2>& orientation_of_neighbor) {
   const Direction<2> neighbor_first_axis =
       orientation_of_neighbor(Direction<2>::upper_xi());
   const Direction<2> neighbor_second_axis =
@@ -223,13 +230,14 @@ std::vector<size_t> oriented_offset(
   const bool neighbor_second_axis_is_aligned =
       (Side::Upper == neighbor_second_axis.side());
 
-  return compute_offset_permutation(extents, neighbor_first_axis_is_aligned,
-                                    neighbor_second_axis_is_aligned,
-                                    axes_are_transposed);
+  compute_offset_permutation(result, extents, neighbor_first_axis_is_aligned,
+                             neighbor_second_axis_is_aligned,
+                             axes_are_transposed);
 }
 
-std::vector<size_t> oriented_offset(
-    const Index<3>& extents, const OrientationMap<3>& orientation_of_neighbor) {
+void oriented_offset(const gsl::not_null<std::vector<size_t>*> result,
+                     const Index<3>& extents,
+                     const OrientationMap<3>& orientation_of_neighbor) {
   const Direction<3> neighbor_first_axis =
       orientation_of_neighbor(Direction<3>::upper_xi());
   const Direction<3> neighbor_second_axis =
@@ -248,19 +256,22 @@ std::vector<size_t> oriented_offset(
       neighbor_first_axis.dimension(), neighbor_second_axis.dimension(),
       neighbor_third_axis.dimension());
 
-  return compute_offset_permutation(
-      extents, neighbor_first_axis_is_aligned, neighbor_second_axis_is_aligned,
-      neighbor_third_axis_is_aligned, neighbor_axis_permutation);
+  compute_offset_permutation(
+      result, extents, neighbor_first_axis_is_aligned,
+      neighbor_second_axis_is_aligned, neighbor_third_axis_is_aligned,
+      neighbor_axis_permutation);
 }
 
-std::vector<size_t> oriented_offset_on_slice(
+void oriented_offset_on_slice(
+    const gsl::not_null<std::vector<size_t>*> result,
     const Index<0>& /*slice_extents*/, const size_t /*sliced_dim*/,
     const OrientationMap<1>& /*orientation_of_neighbor*/) {
   // There is only one point on a slice of a 1D mesh
-  return {0};
+  result->assign(1, 0);
 }
 
-std::vector<size_t> oriented_offset_on_slice(
+void oriented_offset_on_slice(
+    const gsl::not_null<std::vector<size_t>*> result,
     const Index<1>& slice_extents, const size_t sliced_dim,
     const OrientationMap<2>& orientation_of_neighbor) {
   const Direction<2> my_slice_axis =
@@ -268,10 +279,11 @@ std::vector<size_t> oriented_offset_on_slice(
   const Direction<2> neighbor_slice_axis =
       orientation_of_neighbor(my_slice_axis);
   const bool is_aligned = (neighbor_slice_axis.side() == Side::Upper);
-  return compute_offset_permutation(slice_extents, is_aligned);
+  compute_offset_permutation(result, slice_extents, is_aligned);
 }
 
-std::vector<size_t> oriented_offset_on_slice(
+void oriented_offset_on_slice(
+    const gsl::not_null<std::vector<size_t>*> result,
     const Index<2>& slice_extents, const size_t sliced_dim,
     const OrientationMap<3>& orientation_of_neighbor) {
   const std::array<size_t, 2> dims_of_slice =
@@ -290,9 +302,18 @@ std::vector<size_t> oriented_offset_on_slice(
   const bool neighbor_second_axis_is_aligned =
       (Side::Upper == neighbor_second_axis.side());
 
-  return compute_offset_permutation(
-      slice_extents, neighbor_first_axis_is_aligned,
-      neighbor_second_axis_is_aligned, neighbor_axes_are_transposed);
+  compute_offset_permutation(result, slice_extents,
+                             neighbor_first_axis_is_aligned,
+                             neighbor_second_axis_is_aligned,
+                             neighbor_axes_are_transposed);
+}
+
+// The offsets are computed into a per-thread buffer, since orienting the data
+// sent to every non-aligned neighbor would otherwise allocate a new vector of
+// offsets each time
+std::vector<size_t>& oriented_offset_buffer() {
+  thread_local std::vector<size_t> buffer{};
+  return buffer;
 }
 
 template <typename T>
@@ -360,12 +381,13 @@ void orient_variables(
     return;
   }
 
-  const auto oriented_extents =
-      oriented_offset(extents, orientation_of_neighbor);
+  std::vector<size_t>& oriented_offsets = oriented_offset_buffer();
+  oriented_offset(make_not_null(&oriented_offsets), extents,
+                  orientation_of_neighbor);
   auto oriented_vars_view = gsl::make_span(result->data(), result->size());
   orient_each_component(make_not_null(&oriented_vars_view),
                         gsl::make_span(variables.data(), variables.size()),
-                        number_of_grid_points, oriented_extents);
+                        number_of_grid_points, oriented_offsets);
 }
 
 template <typename VectorType, size_t VolumeDim>
@@ -389,8 +411,9 @@ void orient_variables_on_slice(
     return;
   }
 
-  const auto oriented_offset = oriented_offset_on_slice(
-      slice_extents, sliced_dim, orientation_of_neighbor);
+  std::vector<size_t>& oriented_offset = oriented_offset_buffer();
+  oriented_offset_on_slice(make_not_null(&oriented_offset), slice_extents,
+                           sliced_dim, orientation_of_neighbor);
 
   auto oriented_vars_view = gsl::make_span(result->data(), result->size());
   orient_each_component(
@@ -3,14 +3,78 @@
 
 #include "Domain/TagsTimeDependent.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/Domain.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 
 namespace domain::Tags {
+namespace detail {
+template <size_t Dim>
+void uniform_coords_frame_velocity_jacobians(
+    const gsl::not_null<
+        typename CoordinatesMeshVelocityAndJacobians<Dim>::type*>
+        result,
+    const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, Dim>&
+        grid_to_inertial_map,
+    const tnsr::I<DataVector, Dim, Frame::Grid>& source_coords,
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) {
+  const size_t num_points = get<0>(source_coords).size();
+  tnsr::I<double, Dim, Frame::Grid> first_point{};
+  for (size_t d = 0; d < Dim; ++d) {
+    first_point.get(d) = source_coords.get(d)[0];
+  }
+  const auto first_point_quantities =
+      grid_to_inertial_map.coords_frame_velocity_jacobians(
+          first_point, time, functions_of_time);
+  const auto& first_inv_jacobian = std::get<1>(first_point_quantities);
+  const auto& first_jacobian = std::get<2>(first_point_quantities);
+  const auto& first_velocity = std::get<3>(first_point_quantities);
+
+  if (not result->has_value()) {
+    result->emplace();
+  }
+  auto& [coords, inv_jacobian, jacobian, velocity] = result->value();
+  coords = grid_to_inertial_map(source_coords, time, functions_of_time);
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = 0; j < Dim; ++j) {
+      inv_jacobian.get(i, j).destructive_resize(num_points);
+      inv_jacobian.get(i, j) = first_inv_jacobian.get(i, j);
+      jacobian.get(i, j).destructive_resize(num_points);
+      jacobian.get(i, j) = first_jacobian.get(i, j);
+    }
+  }
+  // The mesh velocity of an affine map is v(x) = v(x_0) + dv/dx (x - x_0),
+  // where the columns of dv/dx are the velocity differences along unit offsets
+  for (size_t d = 0; d < Dim; ++d) {
+    velocity.get(d).destructive_resize(num_points);
+    velocity.get(d) = first_velocity.get(d);
+  }
+  for (size_t k = 0; k < Dim; ++k) {
+    auto offset_point = first_point;
+    offset_point.get(k) += 1.;
+    const auto offset_velocity = std::get<3>(
+        grid_to_inertial_map.coords_frame_velocity_jacobians(
+            offset_point, time, functions_of_time));
+    for (size_t d = 0; d < Dim; ++d) {
+      velocity.get(d) += (offset_velocity.get(d) - first_velocity.get(d)) *
+                         (source_coords.get(k) - first_point.get(k));
+    }
+  }
+}
+}  // namespace detail
+
 template <size_t Dim>
 void InertialFromGridCoordinatesCompute<Dim>::function(
     const gsl::not_null<tnsr::I<DataVector, Dim, Frame::Inertial>*>
@@ -142,10 +206,22 @@ void InertialMeshVelocityCompute<Dim>::function(
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATE(_, data)                                     \
-  template struct InertialFromGridCoordinatesCompute<DIM(data)>; \
-  template struct ElementToInertialInverseJacobian<DIM(data)>;   \
-  template struct InertialMeshVelocityCompute<DIM(data)>;        \
+#define INSTANTIATE(_, data)                                                  \
+  template void detail::uniform_coords_frame_velocity_jacobians(              \
+      gsl::not_null<                                                          \
+          typename CoordinatesMeshVelocityAndJacobians<DIM(data)>::type*>     \
+          result,                                                             \
+      const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial,           \
+                                      DIM(data)>& grid_to_inertial_map,       \
+      const tnsr::I<DataVector, DIM(data), Frame::Grid>& source_coords,       \
+      double time,                                                            \
+      const std::unordered_map<                                               \
+          std::string,                                                        \
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&          \
+          functions_of_time);                                                 \
+  template struct InertialFromGridCoordinatesCompute<DIM(data)>;              \
+  template struct ElementToInertialInverseJacobian<DIM(data)>;                \
+  template struct InertialMeshVelocityCompute<DIM(data)>;                     \
   template struct GridToInertialInverseJacobian<DIM(data)>;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
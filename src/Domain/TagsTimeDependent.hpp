@@ -49,9 +49,30 @@ struct CoordinatesMeshVelocityAndJacobians : db::SimpleTag {
       tnsr::I<DataVector, Dim, Frame::Inertial>>>;
 };
 
+namespace detail {
+// Evaluates the coordinates, Jacobians and mesh velocity of a map with a
+// spatially uniform Jacobian. The Jacobians are evaluated at a single point and
+// broadcast to all points. Since such a map is affine its mesh velocity is
+// affine as well, so it is reconstructed from Dim + 1 evaluations.
+template <size_t Dim>
+void uniform_coords_frame_velocity_jacobians(
+    gsl::not_null<typename CoordinatesMeshVelocityAndJacobians<Dim>::type*>
+        result,
+    const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, Dim>&
+        grid_to_inertial_map,
+    const tnsr::I<DataVector, Dim, Frame::Grid>& source_coords, double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time);
+}  // namespace detail
+
 /// Computes the Inertial coordinates, the inverse Jacobian from the Grid to the
 /// Inertial frame, the Jacobian from the Grid to the Inertial frame, and the
 /// Inertial mesh velocity.
+///
+/// If the Jacobian of the map is spatially uniform, e.g. for rigid rotations
+/// and uniform expansions, it is evaluated only once and broadcast to all
+/// points instead of being recomputed at every point.
 template <typename MapTagGridToInertial>
 struct CoordinatesMeshVelocityAndJacobiansCompute
     : CoordinatesMeshVelocityAndJacobians<MapTagGridToInertial::dim>,
@@ -72,11 +93,16 @@ struct CoordinatesMeshVelocityAndJacobiansCompute
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
           functions_of_time) {
     // Use identity to signal time-independent
-    if (not grid_to_inertial_map.is_identity()) {
+    if (grid_to_inertial_map.is_identity()) {
+      *result = std::nullopt;
+    } else if (grid_to_inertial_map.jacobian_is_spatially_uniform() and
+               get<0>(source_coords).size() > 0) {
+      detail::uniform_coords_frame_velocity_jacobians(
+          result, grid_to_inertial_map, source_coords, time,
+          functions_of_time);
+    } else {
       *result = grid_to_inertial_map.coords_frame_velocity_jacobians(
           source_coords, time, functions_of_time);
-    } else {
-      *result = std::nullopt;
     }
   }
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <string>
 #include <tuple>
@@ -609,6 +610,27 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
     // into the DataBox to keep them around permanently. The latter should be
     // informed by profiling.
 
+    // The volume quantities are computed in a single memory buffer that is
+    // allocated once per operator application: the first part holds the
+    // lifted auxiliary boundary corrections (and before that the logical
+    // fluxes for the StrongLogical formulation), and the second part is
+    // scratch space for the sources and the massless auxiliary boundary
+    // corrections.
+    using LiftedAuxTags = tmpl::list<transform::Tags::TransformedFirstIndex<
+        PrimalFluxesVars, Frame::ElementLogical>...>;
+    using OperatorVars = Variables<tmpl::list<OperatorTags...>>;
+    Variables<tmpl::append<LiftedAuxTags, tmpl::list<OperatorTags...>>>
+        volume_buffer{num_points, 0.};
+    Variables<LiftedAuxTags> lifted_logical_aux_boundary_corrections{};
+    lifted_logical_aux_boundary_corrections.set_data_ref(
+        volume_buffer.data(),
+        Variables<LiftedAuxTags>::number_of_independent_components *
+            num_points);
+    OperatorVars scratch{};
+    scratch.set_data_ref(
+        volume_buffer.data() + lifted_logical_aux_boundary_corrections.size(),
+        OperatorVars::number_of_independent_components * num_points);
+
     // Compute volume terms: -div(F) + S
     if (local_data_is_zero) {
       operator_applied_to_vars->initialize(num_points, 0.);
@@ -629,9 +651,15 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
       } else if (formulation == ::dg::Formulation::StrongLogical) {
         // Strong divergence but with the Jacobian moved into the divergence:
         //   div(F) = 1/J_p \sum_q (D_\hat{i})_pq J_q (J^\hat{i}_i)_q (F^i)_q.
-        const auto logical_fluxes = transform::first_index_to_different_frame(
+        transform::first_index_to_different_frame(
+            make_not_null(&lifted_logical_aux_boundary_corrections),
             primal_fluxes, det_times_inv_jacobian);
-        logical_divergence(operator_applied_to_vars, logical_fluxes, mesh);
+        logical_divergence(operator_applied_to_vars,
+                           lifted_logical_aux_boundary_corrections, mesh);
+        std::fill(lifted_logical_aux_boundary_corrections.data(),
+                  lifted_logical_aux_boundary_corrections.data() +
+                      lifted_logical_aux_boundary_corrections.size(),
+                  0.);
         if (massive) {
           *operator_applied_to_vars *= -1.;
         } else {
@@ -653,7 +681,7 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
                  "StrongLogical.");
       }
       if constexpr (not std::is_same_v<SourcesComputer, void>) {
-        Variables<tmpl::list<OperatorTags...>> sources{num_points, 0.};
+        auto& sources = scratch;
         std::apply(
             [&sources, &primal_vars,
              &primal_fluxes](const auto&... expanded_sources_args) {
@@ -677,9 +705,6 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
     // Keeping track if any corrections were applied here, for an optimization
     // below
     bool has_any_boundary_corrections = false;
-    Variables<tmpl::list<transform::Tags::TransformedFirstIndex<
-        PrimalFluxesVars, Frame::ElementLogical>...>>
-        lifted_logical_aux_boundary_corrections{num_points, 0.};
     for (auto& [mortar_id, mortar_data] : *all_mortar_data) {
       const auto& direction = mortar_id.direction();
       const auto& neighbor_id = mortar_id.id();
@@ -976,10 +1001,8 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
                               lifted_logical_aux_boundary_corrections, mesh,
                               true);
     } else {
-      // Possible optimization: eliminate this allocation by building the
-      // inverse mass matrix into `logical_weak_divergence`
-      Variables<tmpl::list<OperatorTags...>> massless_aux_boundary_corrections{
-          num_points};
+      // The scratch space is free again after computing the sources
+      auto& massless_aux_boundary_corrections = scratch;
       logical_weak_divergence(make_not_null(&massless_aux_boundary_corrections),
                               lifted_logical_aux_boundary_corrections, mesh);
       massless_aux_boundary_corrections *= get(det_inv_jacobian);
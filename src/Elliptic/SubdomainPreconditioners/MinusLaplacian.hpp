@@ -28,6 +28,7 @@
 #include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
 #include "NumericalAlgorithms/LinearSolver/Gmres.hpp"
 #include "NumericalAlgorithms/LinearSolver/LinearSolver.hpp"
+#include "NumericalAlgorithms/LinearSolver/LuFactorization.hpp"
 #include "Options/Auto.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/ElementCenteredSubdomainData.hpp"
@@ -55,7 +56,8 @@ template <size_t Dim, typename OptionsGroup,
               ::LinearSolver::Serial::Registrars::Gmres<
                   ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
                       Dim, tmpl::list<Poisson::Tags::Field<DataVector>>>>,
-              ::LinearSolver::Serial::Registrars::ExplicitInverse<double>>>>
+              ::LinearSolver::Serial::Registrars::ExplicitInverse<double>,
+              ::LinearSolver::Serial::Registrars::LuFactorization<double>>>>
 struct MinusLaplacian {
   template <typename LinearSolverRegistrars>
   using f = subdomain_preconditioners::MinusLaplacian<Dim, OptionsGroup, Solver,
@@ -97,7 +99,8 @@ template <size_t Dim, typename OptionsGroup,
               ::LinearSolver::Serial::Registrars::Gmres<
                   ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
                       Dim, tmpl::list<Poisson::Tags::Field<DataVector>>>>,
-              ::LinearSolver::Serial::Registrars::ExplicitInverse<double>>>,
+              ::LinearSolver::Serial::Registrars::ExplicitInverse<double>,
+              ::LinearSolver::Serial::Registrars::LuFactorization<double>>>,
           typename LinearSolverRegistrars =
               tmpl::list<Registrars::MinusLaplacian<Dim, OptionsGroup, Solver>>>
 class MinusLaplacian
@@ -7,6 +7,7 @@
 #include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
 #include "NumericalAlgorithms/LinearSolver/Gmres.hpp"
 #include "NumericalAlgorithms/LinearSolver/LinearSolver.hpp"
+#include "NumericalAlgorithms/LinearSolver/LuFactorization.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/ElementCenteredSubdomainData.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 #include "Utilities/TMPL.hpp"
@@ -19,7 +20,8 @@ void register_derived_with_charm_impl() {
           ::LinearSolver::Serial::Registrars::Gmres<
               ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
                   Dim, tmpl::list<Poisson::Tags::Field<DataVector>>>>,
-          ::LinearSolver::Serial::Registrars::ExplicitInverse<double>>>>();
+          ::LinearSolver::Serial::Registrars::ExplicitInverse<double>,
+          ::LinearSolver::Serial::Registrars::LuFactorization<double>>>>();
 }
 }  // namespace
 
@@ -109,6 +109,54 @@ void add_linearized_distortion_hamiltonian_sources(
       get(conformal_factor_correction);
 }
 
+template <int ConformalMatterScale>
+void add_linearized_hamiltonian_and_distortion_sources(
+    const gsl::not_null<Scalar<DataVector>*> linearized_hamiltonian_constraint,
+    const Scalar<DataVector>& conformal_energy_density,
+    const Scalar<DataVector>& extrinsic_curvature_trace,
+    const Scalar<DataVector>&
+        longitudinal_shift_minus_dt_conformal_metric_over_lapse_square,
+    const Scalar<DataVector>& conformal_factor_minus_one,
+    const Scalar<DataVector>& conformal_factor_correction) {
+  const DataVector& distortion =
+      get(longitudinal_shift_minus_dt_conformal_metric_over_lapse_square);
+  // Note: 0.15625 = 5 / 32
+  get(*linearized_hamiltonian_constraint) +=
+      ((5. / 12.) * square(get(extrinsic_curvature_trace)) -
+       2. * (5. - ConformalMatterScale) * M_PI * get(conformal_energy_density) /
+           pow<ConformalMatterScale>(get(conformal_factor_minus_one) + 1.) -
+       0.15625 * distortion) *
+      pow<4>(get(conformal_factor_minus_one) + 1.) *
+      get(conformal_factor_correction);
+}
+
+template <int ConformalMatterScale>
+void linearized_hamiltonian_sources_coefficient(
+    const gsl::not_null<Scalar<DataVector>*> coefficient,
+    const Scalar<DataVector>& conformal_energy_density,
+    const Scalar<DataVector>& extrinsic_curvature_trace,
+    const Scalar<DataVector>&
+        longitudinal_shift_minus_dt_conformal_metric_over_lapse_square,
+    const Scalar<DataVector>& conformal_factor_minus_one) {
+  const DataVector& distortion =
+      get(longitudinal_shift_minus_dt_conformal_metric_over_lapse_square);
+  // Note: 0.15625 = 5 / 32
+  get(*coefficient) =
+      ((5. / 12.) * square(get(extrinsic_curvature_trace)) -
+       2. * (5. - ConformalMatterScale) * M_PI * get(conformal_energy_density) /
+           pow<ConformalMatterScale>(get(conformal_factor_minus_one) + 1.) -
+       0.15625 * distortion) *
+      pow<4>(get(conformal_factor_minus_one) + 1.);
+}
+
+void add_linearized_hamiltonian_sources_from_coefficient(
+    const gsl::not_null<Scalar<DataVector>*> linearized_hamiltonian_constraint,
+    const Scalar<DataVector>& coefficient,
+    const Scalar<DataVector>& conformal_factor_correction) {
+  get(*linearized_hamiltonian_constraint) +=
+      get(coefficient) * get(conformal_factor_correction);
+}
+
 void add_curved_hamiltonian_or_lapse_sources(
     const gsl::not_null<Scalar<DataVector>*> hamiltonian_or_lapse_equation,
     const Scalar<DataVector>& conformal_ricci_scalar,
@@ -700,6 +748,23 @@ void add_flat_cartesian_linearized_momentum_sources(
       const Scalar<DataVector>& extrinsic_curvature_trace,                    \
       const Scalar<DataVector>& conformal_factor_minus_one,                   \
       const Scalar<DataVector>& conformal_factor_correction);                 \
+  template void                                                               \
+  add_linearized_hamiltonian_and_distortion_sources<CONF_MATTER_SCALE(data)>( \
+      gsl::not_null<Scalar<DataVector>*> linearized_hamiltonian_constraint,   \
+      const Scalar<DataVector>& conformal_energy_density,                     \
+      const Scalar<DataVector>& extrinsic_curvature_trace,                    \
+      const Scalar<DataVector>&                                               \
+          longitudinal_shift_minus_dt_conformal_metric_over_lapse_square,     \
+      const Scalar<DataVector>& conformal_factor_minus_one,                   \
+      const Scalar<DataVector>& conformal_factor_correction);                 \
+  template void                                                               \
+  linearized_hamiltonian_sources_coefficient<CONF_MATTER_SCALE(data)>(        \
+      gsl::not_null<Scalar<DataVector>*> coefficient,                         \
+      const Scalar<DataVector>& conformal_energy_density,                     \
+      const Scalar<DataVector>& extrinsic_curvature_trace,                    \
+      const Scalar<DataVector>&                                               \
+          longitudinal_shift_minus_dt_conformal_metric_over_lapse_square,     \
+      const Scalar<DataVector>& conformal_factor_minus_one);                  \
   template void add_lapse_sources<CONF_MATTER_SCALE(data)>(                   \
       gsl::not_null<Scalar<DataVector>*> lapse_equation,                      \
       const Scalar<DataVector>& conformal_energy_density,                     \
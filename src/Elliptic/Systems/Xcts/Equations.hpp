@@ -82,6 +82,51 @@ void add_linearized_distortion_hamiltonian_sources(
     const Scalar<DataVector>& conformal_factor_minus_one,
     const Scalar<DataVector>& conformal_factor_correction);
 
+/*!
+ * \brief The combined `add_linearized_hamiltonian_sources` and
+ * `add_linearized_distortion_hamiltonian_sources`, evaluated in a single pass
+ * over the grid points
+ */
+template <int ConformalMatterScale>
+void add_linearized_hamiltonian_and_distortion_sources(
+    gsl::not_null<Scalar<DataVector>*> linearized_hamiltonian_constraint,
+    const Scalar<DataVector>& conformal_energy_density,
+    const Scalar<DataVector>& extrinsic_curvature_trace,
+    const Scalar<DataVector>&
+        longitudinal_shift_minus_dt_conformal_metric_over_lapse_square,
+    const Scalar<DataVector>& conformal_factor_minus_one,
+    const Scalar<DataVector>& conformal_factor_correction);
+
+/*!
+ * \brief The coefficient \f$c\f$ of the conformal factor correction in the
+ * linearized sources `add_linearized_hamiltonian_and_distortion_sources`
+ *
+ * Computes \f$c = \psi^4\left(\frac{5}{12}K^2 - 2\pi(5-n)\psi^{-n}
+ * \bar{\rho} - \frac{5}{32}\frac{1}{\alpha^2}\left[(\bar{L}\beta)^{ij} -
+ * \bar{u}^{ij}\right]^2\right)\f$. The coefficient only depends on the
+ * background fields and the conformal factor of the nonlinear solution, so it
+ * is constant while solving the linearized equations for a Newton-Raphson
+ * correction. It can be computed once per Newton-Raphson step and applied to
+ * every correction with `add_linearized_hamiltonian_sources_from_coefficient`.
+ * On a curved background the linear term \f$\frac{1}{8}\bar{R}\f$ of
+ * `add_curved_hamiltonian_or_lapse_sources` can be added to the coefficient.
+ */
+template <int ConformalMatterScale>
+void linearized_hamiltonian_sources_coefficient(
+    gsl::not_null<Scalar<DataVector>*> coefficient,
+    const Scalar<DataVector>& conformal_energy_density,
+    const Scalar<DataVector>& extrinsic_curvature_trace,
+    const Scalar<DataVector>&
+        longitudinal_shift_minus_dt_conformal_metric_over_lapse_square,
+    const Scalar<DataVector>& conformal_factor_minus_one);
+
+/// Add the linearized Hamiltonian constraint sources \f$c\,\delta\psi\f$
+/// with the precomputed `linearized_hamiltonian_sources_coefficient`
+void add_linearized_hamiltonian_sources_from_coefficient(
+    gsl::not_null<Scalar<DataVector>*> linearized_hamiltonian_constraint,
+    const Scalar<DataVector>& coefficient,
+    const Scalar<DataVector>& conformal_factor_correction);
+
 /*!
  * \brief Add the contributions from a curved background geometry to the
  * Hamiltonian constraint or lapse equation
@@ -481,12 +481,9 @@ void LinearizedSources<Equations::Hamiltonian, Geometry::FlatCartesian,
           const Scalar<DataVector>& conformal_factor_correction,
           const tnsr::I<DataVector, 3>&
           /*conformal_factor_flux_correction*/) {
-  add_linearized_hamiltonian_sources<ConformalMatterScale>(
+  add_linearized_hamiltonian_and_distortion_sources<ConformalMatterScale>(
       linearized_hamiltonian_constraint, conformal_energy_density,
-      extrinsic_curvature_trace, conformal_factor_minus_one,
-      conformal_factor_correction);
-  add_linearized_distortion_hamiltonian_sources(
-      linearized_hamiltonian_constraint,
+      extrinsic_curvature_trace,
       longitudinal_shift_minus_dt_conformal_metric_over_lapse_square,
       conformal_factor_minus_one, conformal_factor_correction);
 }
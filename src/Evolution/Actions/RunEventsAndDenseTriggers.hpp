@@ -61,6 +61,10 @@ namespace evolution::Actions {
 /// provided for convenience to provide an `is_ready` function when a
 /// pure mutate-apply is desired.
 ///
+/// If several dense triggers fire at the same time, the dense output
+/// and postprocessing are only performed once and the result is
+/// shared by all their events.
+///
 /// At the end of the action, the values of the time, evolved
 /// variables, and anything appearing in the `return_tags` of the \p
 /// Postprocessors will be restored to their initial values.
@@ -222,6 +226,11 @@ struct RunEventsAndDenseTriggers {
     StateRestorer<DbTags, postprocessor_restore_tags> postprocessor_restorer(
         make_not_null(&box));
 
+    // Time of the dense output and postprocessing currently in the
+    // box.  Events don't modify the box, so this can be reused for
+    // other triggers at the same time.
+    std::optional<double> dense_output_time{};
+
     for (;;) {
       const double next_trigger = events_and_dense_triggers.next_trigger(box);
       if (before_equal(step_end.value(), next_trigger)) {
@@ -245,6 +254,9 @@ struct RunEventsAndDenseTriggers {
         case TriggeringState::NotReady:
           return {Parallel::AlgorithmExecution::Retry, std::nullopt};
         case TriggeringState::NeedsEvolvedVariables: {
+          if (dense_output_time == next_trigger) {
+            break;
+          }
           using history_tag = ::Tags::HistoryEvolvedVariables<variables_tag>;
           bool dense_output_succeeded = false;
           variables_restorer.save();
@@ -285,6 +297,7 @@ struct RunEventsAndDenseTriggers {
             using postprocessor = tmpl::type_from<decltype(postprocessor_v)>;
             db::mutate_apply<postprocessor>(make_not_null(&box));
           });
+          dense_output_time.emplace(next_trigger);
         }
           [[fallthrough]];
         default:
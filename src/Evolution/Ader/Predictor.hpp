@@ -0,0 +1,118 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Evolution/Ader/Matrices.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace ader::dg {
+/*!
+ * \brief Computes the local space-time predictor of an element over a step
+ *
+ * \details The predictor solves the element-local space-time problem
+ * \f$\partial_t q = L(q)\f$ over a step of size \f$\Delta t\f$, where
+ * \f$L\f$ is the volume part of the time derivative, i.e. without the
+ * boundary corrections that couple the element to its neighbors. The solution
+ * is represented at the Legendre-Gauss-Lobatto points \f$\tau_a\f$ mapped to
+ * the step, and is found with the Picard iteration
+ *
+ * \f{align}{
+ * q^{k+1}_a = q^0 + \frac{\Delta t}{2} S_{ab} L(q^k_b),
+ * \f}
+ *
+ * where \f$q^0\f$ is the state at the start of the step and \f$S_{ab}\f$ is
+ * the `ader::dg::predictor_inverse_temporal_matrix`. Each iteration gains one
+ * order of accuracy in \f$\Delta t\f$, so `number_of_iterations` is typically
+ * `num_temporal_points`. Since the predictor involves no communication, an
+ * ADER-DG step needs a single exchange of boundary data between elements: the
+ * corrector adds the time integral of the volume terms and of the boundary
+ * corrections, computed from the predictor (see `ader::dg::time_average`), to
+ * the state at the start of the step.
+ *
+ * The `initial_vars` and the time derivatives must store their data
+ * contiguously (e.g. `Variables` or `DataVector`), with the time derivatives
+ * in the same order as the variables. The `compute_time_derivative` is invoked
+ * as `compute_time_derivative(dt_vars, vars, time_offset)`, where `dt_vars` is
+ * a `gsl::not_null<DtVarsType*>` with the size of the `initial_vars` and
+ * `time_offset` is the time since the start of the step.
+ */
+template <typename DtVarsType, typename VarsType, typename TimeDerivative>
+void spacetime_predictor(
+    const gsl::not_null<std::vector<VarsType>*> predicted_vars,
+    const VarsType& initial_vars, const double time_step,
+    const size_t num_temporal_points,
+    const TimeDerivative& compute_time_derivative,
+    const size_t number_of_iterations) {
+  const Matrix& predictor_matrix =
+      predictor_inverse_temporal_matrix<Spectral::Basis::Legendre,
+                                        Spectral::Quadrature::GaussLobatto>(
+          num_temporal_points);
+  const DataVector& temporal_points =
+      Spectral::collocation_points<Spectral::Basis::Legendre,
+                                   Spectral::Quadrature::GaussLobatto>(
+          num_temporal_points);
+  const size_t size = initial_vars.size();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  const DataVector initial_view{const_cast<double*>(initial_vars.data()),
+                                size};
+
+  predicted_vars->assign(num_temporal_points, initial_vars);
+  std::vector<DtVarsType> dt_vars(num_temporal_points);
+  for (size_t iteration = 0; iteration < number_of_iterations; ++iteration) {
+    for (size_t b = 0; b < num_temporal_points; ++b) {
+      compute_time_derivative(make_not_null(&dt_vars[b]), (*predicted_vars)[b],
+                              0.5 * (1.0 + temporal_points[b]) * time_step);
+      ASSERT(dt_vars[b].size() == size,
+             "The time derivative has size " << dt_vars[b].size()
+                                             << " but the variables have size "
+                                             << size);
+    }
+    for (size_t a = 0; a < num_temporal_points; ++a) {
+      DataVector predicted_view{(*predicted_vars)[a].data(), size};
+      predicted_view = initial_view;
+      for (size_t b = 0; b < num_temporal_points; ++b) {
+        predicted_view += (0.5 * time_step * predictor_matrix(a, b)) *
+                          DataVector{dt_vars[b].data(), size};
+      }
+    }
+  }
+}
+
+/*!
+ * \brief The average over the step of the `values` at the temporal points of
+ * the `ader::dg::spacetime_predictor`
+ *
+ * \details For a linear system, the corrector can evaluate the volume terms
+ * and the boundary corrections once, on the time-averaged predictor, so that
+ * each element sends a single set of boundary data per step.
+ */
+template <typename VarsType>
+void time_average(const gsl::not_null<VarsType*> result,
+                  const std::vector<VarsType>& values) {
+  ASSERT(not values.empty(), "Need the values at the temporal points.");
+  const DataVector& weights =
+      Spectral::quadrature_weights<Spectral::Basis::Legendre,
+                                   Spectral::Quadrature::GaussLobatto>(
+          values.size());
+  *result = values[0];
+  const size_t size = result->size();
+  DataVector result_view{result->data(), size};
+  result_view *= 0.5 * weights[0];
+  for (size_t a = 1; a < values.size(); ++a) {
+    result_view +=
+        (0.5 * weights[a]) *
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        DataVector{const_cast<double*>(values[a].data()), size};
+  }
+}
+}  // namespace ader::dg
@@ -0,0 +1,95 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+
+namespace evolution::conservative {
+/// The relative tolerance to which the conserved variables computed from the
+/// current primitive variables must reproduce the evolved conserved variables
+/// for the recovery of the primitives to be skipped at a point. See
+/// `evolution::conservative::primitives_are_current`.
+constexpr double round_trip_tolerance = 1.0e-13;
+
+/*!
+ * \brief Whether a conserved variable computed from the current primitive
+ * variables at a point agrees with the evolved one
+ *
+ * \details Recovering the primitive variables from the conserved variables
+ * requires a root find for most hydro systems, while the conserved variables
+ * follow from the primitives in closed form. Where the closed-form conserved
+ * variables computed from the primitives already in the DataBox reproduce all
+ * evolved conserved variables, e.g. in an atmosphere that didn't change over
+ * the substep, these primitives solve the recovery problem and are kept in
+ * place. Since the criterion only depends on the current state, no copy of the
+ * conserved variables at the last recovery is stored, and skipping is valid
+ * wherever the primitives came from.
+ *
+ * The difference is compared to `tolerance` times the `scale` of the point,
+ * which should be a typical magnitude of the conserved variables there, so
+ * that components that vanish (e.g. a momentum density at rest) don't need to
+ * agree to a relative tolerance. A NaN difference never agrees.
+ */
+inline bool primitives_are_current(
+    const double conservative, const double conservative_from_primitives,
+    const double scale, const double tolerance = round_trip_tolerance) {
+  return std::abs(conservative - conservative_from_primitives) <=
+         tolerance * scale;
+}
+
+/*!
+ * \brief Number of points at which the primitive variables were recovered on
+ * this process
+ *
+ * \details The primitive recovery records every element-wide call with the
+ * number of points of the element and the number of points at which a recovery
+ * actually ran, i.e. those at which the primitives were neither current (see
+ * `evolution::conservative::primitives_are_current`) nor set by an atmosphere
+ * treatment. The ratio of the two measures how much of the recovery cost
+ * skipping saves, and the recovered points per call the cost per element.
+ *
+ * All member functions are thread-safe.
+ */
+class RecoveryStatistics {
+ public:
+  /// The record of this process
+  static RecoveryStatistics& local() {
+    static RecoveryStatistics statistics{};
+    return statistics;
+  }
+
+  void record(const size_t number_of_points,
+              const size_t number_of_recovered_points) {
+    number_of_calls_.fetch_add(1, std::memory_order_relaxed);
+    number_of_points_.fetch_add(number_of_points, std::memory_order_relaxed);
+    number_of_recovered_points_.fetch_add(number_of_recovered_points,
+                                          std::memory_order_relaxed);
+  }
+
+  size_t number_of_calls() const {
+    return number_of_calls_.load(std::memory_order_relaxed);
+  }
+
+  size_t number_of_points() const {
+    return number_of_points_.load(std::memory_order_relaxed);
+  }
+
+  size_t number_of_recovered_points() const {
+    return number_of_recovered_points_.load(std::memory_order_relaxed);
+  }
+
+  void reset() {
+    number_of_calls_.store(0, std::memory_order_relaxed);
+    number_of_points_.store(0, std::memory_order_relaxed);
+    number_of_recovered_points_.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<size_t> number_of_calls_{0};
+  std::atomic<size_t> number_of_points_{0};
+  std::atomic<size_t> number_of_recovered_points_{0};
+};
+}  // namespace evolution::conservative
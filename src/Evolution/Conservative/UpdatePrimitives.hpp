@@ -27,6 +27,12 @@ namespace Actions {
 /// \note `Metavariables` must specify an
 /// `ordered_list_of_primitive_recovery_schemes`.
 ///
+/// The primitive variables are updated in place in the DataBox. Recovery
+/// schemes that require a root find skip points at which the current primitives
+/// already reproduce the conserved variables and record the number of points
+/// they recovered, see `evolution::conservative::primitives_are_current` and
+/// `evolution::conservative::RecoveryStatistics`.
+///
 /// Uses:
 /// - DataBox: Items in system::primitive_from_conservative::argument_tags
 ///
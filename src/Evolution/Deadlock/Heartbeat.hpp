@@ -0,0 +1,231 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <charm++.h>
+#include <cstddef>
+#include <iomanip>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Parallel/Printf/Printf.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace deadlock {
+/*!
+ * \brief Record of the step progress of the elements on this process
+ *
+ * \details Elements record a beat when they start the work of a step with
+ * `deadlock::Actions::RecordHeartbeat` and pause their heartbeat when they
+ * finished the step with `deadlock::Actions::PauseHeartbeat`. A beat holds the
+ * time of the element, the number of entries in its inboxes, and the wall
+ * time. An element that is stepping is considered stalled when it hasn't
+ * finished its step after `stall_factor` times its average wall time per step,
+ * but at least after `minimum_stall_time` seconds. The threshold therefore
+ * adapts to the cost of each element. Element times that lag behind the other
+ * elements on the process point to stragglers.
+ *
+ * Elements whose heartbeat is paused are not monitored. These are the elements
+ * that halted for a phase change (e.g. to write a checkpoint, to balance the
+ * load, or to adjust the domain) or that completed the evolution. Elements
+ * that were destroyed, e.g. by AMR or after they migrated to another process,
+ * are removed with `forget`, which `deadlock::HeartbeatRegistration` does when
+ * the element is destroyed.
+ *
+ * Once `start_monitor` was called, the process checks its elements every
+ * `check_interval` seconds and prints a report when elements are stalled. The
+ * check stops once no element on the process is stepping, and is started
+ * again by the next call to `start_monitor`. A stalled element is reported
+ * once, and again only after it recorded another beat.
+ *
+ * All member functions are thread-safe.
+ */
+template <typename ArrayIndex>
+class Heartbeat {
+ public:
+  static constexpr double check_interval = 60.0;
+  static constexpr double stall_factor = 20.0;
+  static constexpr double minimum_stall_time = 300.0;
+
+  struct Beat {
+    double time{};
+    size_t inbox_size{};
+    double wall_time{};
+    double average_step_wall_time{};
+    size_t number_of_steps{};
+    bool stepping{false};
+    bool reported{false};
+  };
+
+  struct Statistics {
+    size_t number_of_elements{};
+    double earliest_time{};
+    double latest_time{};
+    /// The element with the largest average wall time per step
+    std::optional<ArrayIndex> slowest_element{};
+    double slowest_average_step_wall_time{};
+  };
+
+  Heartbeat() = default;
+
+  /// The record of this process
+  static Heartbeat& local() {
+    static Heartbeat heartbeat{};
+    return heartbeat;
+  }
+
+  /// Record that the element starts the work of a step
+  void beat(const ArrayIndex& array_index, const double time,
+            const size_t inbox_size, const double wall_time) {
+    const std::lock_guard lock{mutex_};
+    Beat& beat = beats_[array_index];
+    beat.time = time;
+    beat.inbox_size = inbox_size;
+    beat.wall_time = wall_time;
+    beat.stepping = true;
+    beat.reported = false;
+  }
+
+  /// Record that the element finished the work of its step, so it isn't
+  /// monitored until its next beat
+  void pause(const ArrayIndex& array_index, const double wall_time) {
+    const std::lock_guard lock{mutex_};
+    const auto it = beats_.find(array_index);
+    if (it == beats_.end() or not it->second.stepping) {
+      return;
+    }
+    Beat& beat = it->second;
+    ++beat.number_of_steps;
+    beat.average_step_wall_time +=
+        (wall_time - beat.wall_time - beat.average_step_wall_time) /
+        static_cast<double>(beat.number_of_steps);
+    beat.stepping = false;
+  }
+
+  /// Remove the element, e.g. because it was destroyed or migrated to another
+  /// process
+  void forget(const ArrayIndex& array_index) {
+    const std::lock_guard lock{mutex_};
+    beats_.erase(array_index);
+  }
+
+  /// The elements that are stalled at the `wall_time` with their last beat
+  std::vector<std::pair<ArrayIndex, Beat>> stalled_elements(
+      const double wall_time) const {
+    const std::lock_guard lock{mutex_};
+    std::vector<std::pair<ArrayIndex, Beat>> result{};
+    for (const auto& [array_index, beat] : beats_) {
+      if (beat.stepping and
+          wall_time - beat.wall_time >
+          std::max(stall_factor * beat.average_step_wall_time,
+                   minimum_stall_time)) {
+        result.emplace_back(array_index, beat);
+      }
+    }
+    return result;
+  }
+
+  Statistics statistics() const {
+    const std::lock_guard lock{mutex_};
+    Statistics result{};
+    result.number_of_elements = beats_.size();
+    bool first = true;
+    for (const auto& [array_index, beat] : beats_) {
+      result.earliest_time =
+          first ? beat.time : std::min(result.earliest_time, beat.time);
+      result.latest_time =
+          first ? beat.time : std::max(result.latest_time, beat.time);
+      first = false;
+      if (not result.slowest_element.has_value() or
+          beat.average_step_wall_time > result.slowest_average_step_wall_time) {
+        result.slowest_element = array_index;
+        result.slowest_average_step_wall_time = beat.average_step_wall_time;
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * \brief Describes the elements that stalled since the last report
+   *
+   * Returns `std::nullopt` if no element stalled since the last report.
+   */
+  std::optional<std::string> report(const double wall_time) {
+    const auto stalled = stalled_elements(wall_time);
+    std::stringstream ss{};
+    ss << std::scientific << std::setprecision(6);
+    size_t number_of_new_reports = 0;
+    {
+      const std::lock_guard lock{mutex_};
+      for (const auto& [array_index, beat] : stalled) {
+        Beat& recorded_beat = beats_.at(array_index);
+        if (recorded_beat.reported) {
+          continue;
+        }
+        recorded_beat.reported = true;
+        ++number_of_new_reports;
+        ss << " Element " << array_index << " at time " << beat.time
+           << " with " << beat.inbox_size << " inbox entries made no progress "
+           << "for " << wall_time - beat.wall_time << "s (average step "
+           << beat.average_step_wall_time << "s)\n";
+      }
+    }
+    if (number_of_new_reports == 0) {
+      return std::nullopt;
+    }
+    const auto stats = statistics();
+    std::stringstream header{};
+    header << std::scientific << std::setprecision(6);
+    header << "Heartbeat on node " << sys::my_node() << ": "
+           << number_of_new_reports << " of " << stats.number_of_elements
+           << " elements stalled, likely because of a deadlock or a "
+              "straggler. Element times range from "
+           << stats.earliest_time << " to " << stats.latest_time;
+    if (stats.slowest_element.has_value()) {
+      header << ", slowest element " << *stats.slowest_element << " ("
+             << stats.slowest_average_step_wall_time << "s per step)";
+    }
+    header << ".\n" << ss.str();
+    return header.str();
+  }
+
+  /// Check the elements of this process every `check_interval` seconds until
+  /// no element is stepping. Has no effect while the check is scheduled.
+  void start_monitor() {
+    const std::lock_guard lock{mutex_};
+    if (not monitor_scheduled_) {
+      monitor_scheduled_ = true;
+      CcdCallFnAfter(&Heartbeat::monitor, this, 1000.0 * check_interval);
+    }
+  }
+
+ private:
+  static void monitor(void* heartbeat_ptr, double /*current_wall_time*/) {
+    auto& heartbeat = *static_cast<Heartbeat*>(heartbeat_ptr);
+    if (const auto report = heartbeat.report(sys::wall_time());
+        report.has_value()) {
+      Parallel::printf("%s", *report);
+    }
+    const std::lock_guard lock{heartbeat.mutex_};
+    if (alg::any_of(heartbeat.beats_,
+                    [](const auto& entry) { return entry.second.stepping; })) {
+      CcdCallFnAfter(&Heartbeat::monitor, heartbeat_ptr,
+                     1000.0 * check_interval);
+    } else {
+      heartbeat.monitor_scheduled_ = false;
+    }
+  }
+
+  mutable std::mutex mutex_{};
+  std::unordered_map<ArrayIndex, Beat> beats_{};
+  bool monitor_scheduled_{false};
+};
+}  // namespace deadlock
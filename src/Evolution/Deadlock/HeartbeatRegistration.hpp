@@ -0,0 +1,78 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <functional>
+#include <utility>
+
+#include "Evolution/Deadlock/Heartbeat.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace deadlock {
+/*!
+ * \brief Removes an element from the `deadlock::Heartbeat` of its process when
+ * the element is destroyed
+ *
+ * \details Elements are destroyed when AMR removes them and after they
+ * migrated to another process during load balancing. The registration is
+ * owned by the element, so copies are not registered. Serializing the
+ * registration is a no-op because the heartbeat is local to the process: a
+ * deserialized element registers with its next beat.
+ */
+class HeartbeatRegistration {
+ public:
+  HeartbeatRegistration() = default;
+  HeartbeatRegistration(const HeartbeatRegistration& /*rhs*/) {}
+  HeartbeatRegistration& operator=(const HeartbeatRegistration& rhs) {
+    if (this != &rhs) {
+      release();
+    }
+    return *this;
+  }
+  HeartbeatRegistration(HeartbeatRegistration&& rhs) noexcept
+      : forget_(std::move(rhs.forget_)) {
+    rhs.forget_ = nullptr;
+  }
+  HeartbeatRegistration& operator=(HeartbeatRegistration&& rhs) noexcept {
+    if (this != &rhs) {
+      release();
+      forget_ = std::move(rhs.forget_);
+      rhs.forget_ = nullptr;
+    }
+    return *this;
+  }
+  ~HeartbeatRegistration() { release(); }
+
+  /// Remove the element `array_index` from the `Heartbeat` of this process
+  /// when the registration is destroyed. Only the first call has an effect.
+  template <typename ArrayIndex>
+  void register_element(const ArrayIndex& array_index) {
+    if (forget_ == nullptr) {
+      forget_ = [array_index]() {
+        Heartbeat<ArrayIndex>::local().forget(array_index);
+      };
+    }
+  }
+
+  bool is_registered() const { return forget_ != nullptr; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& /*p*/) {}
+
+ private:
+  void release() {
+    if (forget_ != nullptr) {
+      forget_();
+      forget_ = nullptr;
+    }
+  }
+
+  std::function<void()> forget_{};
+};
+}  // namespace deadlock
@@ -0,0 +1,44 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <optional>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Evolution/Deadlock/Heartbeat.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace deadlock::Actions {
+/*!
+ * \brief Pauses the heartbeat of the element in the `deadlock::Heartbeat` of
+ * its process until its next beat
+ *
+ * \details Place this action at the end of the step actions, right before
+ * `PhaseControl::Actions::ExecutePhaseChange`. Elements that halt for a phase
+ * change are then not reported as stalled while the other phases run. See
+ * `deadlock::Actions::RecordHeartbeat`.
+ *
+ * DataBox changes:
+ * - Adds: nothing
+ * - Removes: nothing
+ * - Modifies: nothing
+ */
+struct PauseHeartbeat {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTags>& /*box*/,
+      tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& array_index, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    Heartbeat<ArrayIndex>::local().pause(array_index, sys::wall_time());
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+}  // namespace deadlock::Actions
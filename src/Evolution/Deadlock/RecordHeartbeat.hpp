@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Evolution/Deadlock/Heartbeat.hpp"
+#include "Evolution/Deadlock/HeartbeatRegistration.hpp"
+#include "Evolution/Deadlock/Tags.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Time/Tags/Time.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace deadlock::Actions {
+/*!
+ * \brief Records a beat of the element in the `deadlock::Heartbeat` of its
+ * process and starts monitoring the process
+ *
+ * \details Place this action after `evolution::Actions::RunEventsAndTriggers`,
+ * which halts elements that completed the evolution, and place
+ * `deadlock::Actions::PauseHeartbeat` before
+ * `PhaseControl::Actions::ExecutePhaseChange`, which halts elements for phase
+ * changes. The element is then only monitored while it works on a step.
+ * Recording a beat only takes a lock and a map lookup, so this is cheap enough
+ * to run in production. The inbox size is the number of entries in all inboxes
+ * of the element that have a `size()`.
+ *
+ * Uses:
+ * - DataBox:
+ *   - `Tags::Time`
+ *
+ * DataBox changes:
+ * - Adds:
+ *   - `deadlock::Tags::HeartbeatRegistration`
+ * - Removes: nothing
+ * - Modifies:
+ *   - `deadlock::Tags::HeartbeatRegistration`
+ */
+struct RecordHeartbeat {
+  using simple_tags = tmpl::list<Tags::HeartbeatRegistration>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTags>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& array_index, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const auto inbox_size = [](const auto& inbox) -> size_t {
+      if constexpr (requires { inbox.size(); }) {
+        return inbox.size();
+      } else {
+        return 0;
+      }
+    };
+    if (not db::get<Tags::HeartbeatRegistration>(box).is_registered()) {
+      db::mutate<Tags::HeartbeatRegistration>(
+          [&array_index](
+              const gsl::not_null<HeartbeatRegistration*> registration) {
+            registration->register_element(array_index);
+          },
+          make_not_null(&box));
+    }
+    auto& heartbeat = Heartbeat<ArrayIndex>::local();
+    heartbeat.beat(array_index, db::get<::Tags::Time>(box),
+                   (0_st + ... + inbox_size(tuples::get<InboxTags>(inboxes))),
+                   sys::wall_time());
+    heartbeat.start_monitor();
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+}  // namespace deadlock::Actions
@@ -0,0 +1,15 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Evolution/Deadlock/HeartbeatRegistration.hpp"
+
+namespace deadlock::Tags {
+/// The registration of the element with the `deadlock::Heartbeat` of its
+/// process
+struct HeartbeatRegistration : db::SimpleTag {
+  using type = deadlock::HeartbeatRegistration;
+};
+}  // namespace deadlock::Tags
@@ -30,6 +30,7 @@
 #include "Evolution/DgSubcell/Tags/Interpolators.hpp"
 #include "Evolution/DgSubcell/Tags/Jacobians.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
+#include "Evolution/DgSubcell/Tags/RdmpProjections.hpp"
 #include "Evolution/DgSubcell/Tags/ReconstructionOrder.hpp"
 #include "Evolution/DgSubcell/Tags/StepsSinceTciCall.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
@@ -72,6 +73,8 @@ namespace evolution::dg::subcell::Actions {
  *   - `subcell::Tags::DidRollback`
  *   - `subcell::Tags::TciGridHistory`
  *   - `subcell::Tags::TciCallsSinceRollback`
+ *   - `subcell::Tags::RdmpProjectionsEvaluated`
+ *   - `subcell::Tags::RdmpProjectionsSkipped`
  *   - `subcell::Tags::GhostDataForReconstruction<Dim>`
  *   - `subcell::Tags::TciDecision`
  *   - `subcell::Tags::DataForRdmpTci`
@@ -94,6 +97,7 @@ struct SetSubcellGrid {
   using simple_tags = tmpl::list<
       Tags::ActiveGrid, Tags::DidRollback, Tags::TciGridHistory,
       Tags::TciCallsSinceRollback, Tags::StepsSinceTciCall,
+      Tags::RdmpProjectionsEvaluated, Tags::RdmpProjectionsSkipped,
       Tags::GhostDataForReconstruction<Dim>, Tags::TciDecision,
       Tags::NeighborTciDecisions<Dim>, Tags::DataForRdmpTci,
       subcell::Tags::CellCenteredFlux<typename System::flux_variables, Dim>,
@@ -188,7 +192,9 @@ struct SetSubcellGrid {
         tmpl::list<Tags::ActiveGrid, Tags::DidRollback,
                    typename System::variables_tag, subcell::Tags::TciDecision,
                    subcell::Tags::TciCallsSinceRollback,
-                   subcell::Tags::StepsSinceTciCall>,
+                   subcell::Tags::StepsSinceTciCall,
+                   subcell::Tags::RdmpProjectionsEvaluated,
+                   subcell::Tags::RdmpProjectionsSkipped>,
         tmpl::list<>>(
         [&cell_is_not_on_external_boundary, &dg_mesh,
          subcell_allowed_in_element, &subcell_mesh](
@@ -197,7 +203,9 @@ struct SetSubcellGrid {
             const auto active_vars_ptr,
             const gsl::not_null<int*> tci_decision_ptr,
             const gsl::not_null<size_t*> tci_calls_since_rollback_ptr,
-            const gsl::not_null<size_t*> steps_since_tci_call_ptr) {
+            const gsl::not_null<size_t*> steps_since_tci_call_ptr,
+            const gsl::not_null<size_t*> rdmp_projections_evaluated_ptr,
+            const gsl::not_null<size_t*> rdmp_projections_skipped_ptr) {
           // We don't consider setting the initial grid to subcell as rolling
           // back. Since no time step is undone, we just continue on the
           // subcells as a normal solve.
@@ -216,6 +224,8 @@ struct SetSubcellGrid {
           *tci_decision_ptr = 0;
           *tci_calls_since_rollback_ptr = 0;
           *steps_since_tci_call_ptr = 0;
+          *rdmp_projections_evaluated_ptr = 0;
+          *rdmp_projections_skipped_ptr = 0;
         },
         make_not_null(&box));
     if constexpr (System::has_primitive_and_conservative_vars) {
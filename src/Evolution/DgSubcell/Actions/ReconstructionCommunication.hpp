@@ -158,11 +158,9 @@ struct SendDataForReconstruction {
         db::get<evolution::dg::subcell::Tags::Reconstructor>(box)
             .ghost_zone_size();
 
-    // Optimization note: could save a copy+allocation if we moved
-    // all_sliced_data when possible before sending.
-    //
-    // Note: RDMP size doesn't help here since we need to slice data after
-    // anyway, so no way to save an allocation through that.
+    const RdmpTciData& rdmp_tci_data = db::get<Tags::DataForRdmpTci>(box);
+    const size_t rdmp_size = rdmp_tci_data.max_variables_values.size() +
+                             rdmp_tci_data.min_variables_values.size();
     const auto& cell_centered_flux =
         db::get<Tags::CellCenteredFlux<flux_variables, Dim>>(box);
     DataVector volume_data_to_slice = db::mutate_apply(
@@ -180,16 +178,17 @@ struct SendDataForReconstruction {
               static_cast<std::ptrdiff_t>(volume_data_to_slice.size() -
                                           cell_centered_flux.value().size())));
     }
-    const DirectionMap<Dim, DataVector> all_sliced_data = slice_data(
+    // The sliced data has room for the RDMP data at the end so that it can be
+    // moved into the messages without another allocation and copy.
+    DirectionMap<Dim, DataVector> all_sliced_data = slice_data(
         volume_data_to_slice, subcell_mesh.extents(), ghost_zone_size,
-        element.internal_boundaries(), 0,
+        element.internal_boundaries(), rdmp_size,
         db::get<
             evolution::dg::subcell::Tags::InterpolatorsFromFdToNeighborFd<Dim>>(
             box));
 
     auto& receiver_proxy =
         Parallel::get_parallel_component<ParallelComponent>(cache);
-    const RdmpTciData& rdmp_tci_data = db::get<Tags::DataForRdmpTci>(box);
     const TimeStepId& time_step_id = db::get<::Tags::TimeStepId>(box);
     const TimeStepId& next_time_step_id = [&box]() {
       if (LocalTimeStepping) {
@@ -211,13 +210,20 @@ struct SendDataForReconstruction {
              "condition could be relaxed to support AMR only where the "
              "evolution is using DG without any changes to subcell.");
 
+      DataVector& sliced_data_in_direction = all_sliced_data.at(direction);
+      // Copy rdmp data to end of the sliced data
+      std::copy(rdmp_tci_data.max_variables_values.cbegin(),
+                rdmp_tci_data.max_variables_values.cend(),
+                std::prev(sliced_data_in_direction.end(),
+                          static_cast<int>(rdmp_size)));
+      std::copy(rdmp_tci_data.min_variables_values.cbegin(),
+                rdmp_tci_data.min_variables_values.cend(),
+                std::prev(sliced_data_in_direction.end(),
+                          static_cast<int>(
+                              rdmp_tci_data.min_variables_values.size())));
+      size_t neighbor_count = 0;
       for (const ElementId<Dim>& neighbor : neighbors_in_direction) {
-        const size_t rdmp_size = rdmp_tci_data.max_variables_values.size() +
-                                 rdmp_tci_data.min_variables_values.size();
-        const auto& sliced_data_in_direction = all_sliced_data.at(direction);
-        // Allocate with subcell data and rdmp data
-        DataVector subcell_data_to_send{sliced_data_in_direction.size() +
-                                        rdmp_size};
+        ++neighbor_count;
         // Note: Currently we interpolate our solution to our neighbor FD grid
         // even when grid points align but are oriented differently. There's a
         // possible optimization for the rare (almost never?) edge case where
@@ -242,19 +248,12 @@ struct SendDataForReconstruction {
         //                  orientation);
         // } else { std::copy(...); }
         //
-        // Copy over data since it's already oriented from interpolation
-        std::copy(sliced_data_in_direction.begin(),
-                  sliced_data_in_direction.end(), subcell_data_to_send.begin());
-        // Copy rdmp data to end of subcell_data_to_send
-        std::copy(
-            rdmp_tci_data.max_variables_values.cbegin(),
-            rdmp_tci_data.max_variables_values.cend(),
-            std::prev(subcell_data_to_send.end(), static_cast<int>(rdmp_size)));
-        std::copy(rdmp_tci_data.min_variables_values.cbegin(),
-                  rdmp_tci_data.min_variables_values.cend(),
-                  std::prev(subcell_data_to_send.end(),
-                            static_cast<int>(
-                                rdmp_tci_data.min_variables_values.size())));
+        // The data is already oriented from interpolation. Move instead of
+        // copy for the last neighbor in the direction.
+        DataVector subcell_data_to_send =
+            neighbor_count == neighbors_in_direction.size()
+                ? std::move(sliced_data_in_direction)
+                : sliced_data_in_direction;
 
         evolution::dg::BoundaryData<Dim> data{
             subcell_mesh,
@@ -26,6 +26,7 @@
 #include "Evolution/DgSubcell/Actions/Labels.hpp"
 #include "Evolution/DgSubcell/ActiveGrid.hpp"
 #include "Evolution/DgSubcell/GhostData.hpp"
+#include "Evolution/DgSubcell/HighestModesIndicator.hpp"
 #include "Evolution/DgSubcell/NeighborRdmpAndVolumeData.hpp"
 #include "Evolution/DgSubcell/Projection.hpp"
 #include "Evolution/DgSubcell/RdmpTci.hpp"
@@ -38,6 +39,7 @@
 #include "Evolution/DgSubcell/Tags/GhostDataForReconstruction.hpp"
 #include "Evolution/DgSubcell/Tags/Interpolators.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
+#include "Evolution/DgSubcell/Tags/RdmpProjections.hpp"
 #include "Evolution/DgSubcell/Tags/Reconstructor.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
@@ -81,6 +83,20 @@ namespace evolution::dg::subcell::Actions {
  * condition. Note that the evolved variables are projected to the subcells
  * _after_ the TCI is called and marks the cell as troubled.
  *
+ * The `TciMutator` is passed `rdmp_needs_projection` as its last argument. To
+ * compute the RDMP TCI data the mutators take the max and min of the candidate
+ * solution over both the DG grid and its projection to the subcells. If
+ * `subcell_options.rdmp_projection_threshold()` is set, the
+ * `evolution::dg::subcell::highest_modes_indicator` of every component of the
+ * evolved variables is computed first. Only if it exceeds the threshold for
+ * any component is `rdmp_needs_projection` `true`. Otherwise the solution is
+ * smooth enough that the projection can't change the max and min
+ * significantly, and the mutator uses the max and min over the DG grid only.
+ * The RDMP TCI data sent to the neighbors is always that of the current
+ * candidate solution. The number of TCI calls with and without the projection
+ * are counted in `subcell::Tags::RdmpProjectionsEvaluated` and
+ * `subcell::Tags::RdmpProjectionsSkipped`.
+ *
  * After rollback, the subcell scheme must project the DG boundary corrections
  * \f$G\f$ to the subcells for the scheme to be conservative. The subcell
  * actions know if a rollback was done because the local mortar data would
@@ -164,6 +180,31 @@ struct TciAndRollback {
                                element.id().block_id()) and
         not bordering_dg_block;
 
+    // Decide whether the TciMutator must project the candidate solution to
+    // the subcells to compute the RDMP TCI data. See the documentation above.
+    const bool rdmp_needs_projection = [&box, &dg_mesh, &subcell_options]() {
+      if (not subcell_options.rdmp_projection_threshold().has_value()) {
+        return true;
+      }
+      const auto& evolved_vars = db::get<variables_tag>(box);
+      const size_t number_of_grid_points = dg_mesh.number_of_grid_points();
+      for (size_t i = 0; i < evolved_vars.number_of_independent_components;
+           ++i) {
+        const DataVector component{
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            const_cast<double*>(evolved_vars.data()) +
+                i * number_of_grid_points,
+            number_of_grid_points};
+        if (highest_modes_indicator(
+                component, dg_mesh,
+                subcell_options.persson_num_highest_modes()) >
+            subcell_options.rdmp_projection_threshold().value()) {
+          return true;
+        }
+      }
+      return false;
+    }();
+
     // The reason we pass in the persson_exponent explicitly instead of
     // leaving it to the user is because the value of the exponent that
     // should be used to decide if it is safe to switch back to DG should be
@@ -174,7 +215,18 @@ struct TciAndRollback {
     // consistent, we also pass the exponent in separately here.
     std::tuple<int, RdmpTciData> tci_result = db::mutate_apply<TciMutator>(
         make_not_null(&box), subcell_options.persson_exponent(),
-        not subcell_allowed_in_element);
+        not subcell_allowed_in_element, rdmp_needs_projection);
+    db::mutate<Tags::RdmpProjectionsEvaluated, Tags::RdmpProjectionsSkipped>(
+        [&rdmp_needs_projection](
+            const gsl::not_null<size_t*> projections_evaluated_ptr,
+            const gsl::not_null<size_t*> projections_skipped_ptr) {
+          if (rdmp_needs_projection) {
+            ++(*projections_evaluated_ptr);
+          } else {
+            ++(*projections_skipped_ptr);
+          }
+        },
+        make_not_null(&box));
 
     const int tci_decision = std::get<0>(tci_result);
     db::mutate<Tags::TciDecision>(
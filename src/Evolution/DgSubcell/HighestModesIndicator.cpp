@@ -0,0 +1,73 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/HighestModesIndicator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace evolution::dg::subcell {
+template <size_t Dim>
+double highest_modes_indicator(const DataVector& component,
+                               const Mesh<Dim>& dg_mesh,
+                               const size_t num_highest_modes) {
+  ASSERT(component.size() == dg_mesh.number_of_grid_points(),
+         "The component must have the same number of grid points as the DG "
+         "mesh. The component has "
+             << component.size() << " grid points while the DG mesh has "
+             << dg_mesh.number_of_grid_points() << " grid points.");
+  const double component_norm = l2Norm(component);
+  if (component_norm == 0.0) {
+    return 0.0;
+  }
+
+  double indicator = 0.0;
+  size_t stride = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    const size_t extent = dg_mesh.extents(d);
+    ASSERT(num_highest_modes < extent,
+           "Can't monitor the " << num_highest_modes
+                                << " highest modes of a mesh with " << extent
+                                << " grid points in dimension " << d);
+    const Matrix& to_modal =
+        Spectral::nodal_to_modal_matrix(dg_mesh.slice_through(d));
+    const size_t number_of_lines = component.size() / extent;
+    double highest_modes_norm_squared = 0.0;
+    for (size_t line = 0; line < number_of_lines; ++line) {
+      const size_t offset = line % stride + (line / stride) * stride * extent;
+      for (size_t mode = extent - num_highest_modes; mode < extent; ++mode) {
+        double coefficient = 0.0;
+        for (size_t i = 0; i < extent; ++i) {
+          coefficient += to_modal(mode, i) * component[offset + i * stride];
+        }
+        highest_modes_norm_squared += square(coefficient);
+      }
+    }
+    indicator = std::max(
+        indicator, std::sqrt(highest_modes_norm_squared) / component_norm);
+    stride *= extent;
+  }
+  return indicator;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                            \
+  template double highest_modes_indicator(const DataVector& component,    \
+                                          const Mesh<DIM(data)>& dg_mesh, \
+                                          size_t num_highest_modes);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg::subcell
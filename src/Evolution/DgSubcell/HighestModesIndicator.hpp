@@ -0,0 +1,42 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+/// \cond
+class DataVector;
+template <size_t Dim>
+class Mesh;
+/// \endcond
+
+namespace evolution::dg::subcell {
+/*!
+ * \brief A cheap measure of how much of `component` is in its highest modes.
+ *
+ * Let \f$c_{i}\f$ be the 1d spectral coefficients of `component` along the
+ * dimension \f$d\f$ on one line of grid points through the element. The
+ * indicator in dimension \f$d\f$ is
+ *
+ * \f{align*}{
+ *   \sigma_d = \frac{\sqrt{\sum_{\text{lines}}\sum_{i=N_d-M}^{N_d-1}c_i^2}}
+ *              {\sqrt{\sum_{j} u_j^2}},
+ * \f}
+ *
+ * where \f$N_d\f$ is the number of grid points in dimension \f$d\f$, \f$M\f$
+ * is `num_highest_modes`, and the \f$u_j\f$ are the nodal values of
+ * `component`. The largest \f$\sigma_d\f$ is returned.
+ *
+ * Only the \f$M\f$ highest spectral coefficients along each line are
+ * computed, so this is much cheaper than a full transform to spectral
+ * coefficients or a projection to the subcells. Unlike `persson_tci`, which
+ * decides if a cell is troubled, this is used to decide whether the solution
+ * is smooth enough that the RDMP TCI can skip the projection to the subcells.
+ * A component that vanishes everywhere has an indicator of zero.
+ */
+template <size_t Dim>
+double highest_modes_indicator(const DataVector& component,
+                               const Mesh<Dim>& dg_mesh,
+                               size_t num_highest_modes);
+}  // namespace evolution::dg::subcell
@@ -426,6 +426,93 @@ const Matrix& reconstruction_matrix(const Mesh<Dim>& dg_mesh,
   };
 }
 
+namespace {
+ReconstructionMatrixFactors reconstruction_matrix_factors_impl(
+    const Mesh<1>& dg_mesh, const size_t subcell_extents) {
+  const Matrix& proj_matrix = projection_matrix(
+      dg_mesh, subcell_extents, Spectral::Quadrature::CellCentered);
+  const Matrix inv_normal_matrix =
+      inv(Matrix(trans(proj_matrix) * proj_matrix));
+  const DataVector& weights = Spectral::quadrature_weights(dg_mesh);
+  const size_t num_pts = dg_mesh.extents(0);
+
+  ReconstructionMatrixFactors result{};
+  result.least_squares = Matrix(inv_normal_matrix * trans(proj_matrix));
+  result.constraint_correction = Matrix(num_pts, 1, 0.0);
+  result.dg_weights = Matrix(1, num_pts);
+  double normalization = 0.0;
+  for (size_t i = 0; i < num_pts; ++i) {
+    result.dg_weights(0, i) = weights[i];
+    for (size_t j = 0; j < num_pts; ++j) {
+      result.constraint_correction(i, 0) +=
+          inv_normal_matrix(i, j) * weights[j];
+    }
+    normalization += weights[i] * result.constraint_correction(i, 0);
+  }
+  result.constraint_correction /= normalization;
+  result.subcell_weights = Matrix(1, subcell_extents);
+  for (size_t i = 0; i < subcell_extents; ++i) {
+    result.subcell_weights(0, i) =
+        2.0 / static_cast<double>(subcell_extents) *
+        get_sixth_order_integration_coefficient(subcell_extents, i);
+  }
+  return result;
+}
+}  // namespace
+
+const ReconstructionMatrixFactors& reconstruction_matrix_factors(
+    const Mesh<1>& dg_mesh, const size_t subcell_extents) {
+  ASSERT(dg_mesh.basis(0) == Spectral::Basis::Legendre,
+         "FD Subcell reconstruction only supports Legendre basis right now.");
+  switch (dg_mesh.quadrature(0)) {
+    case Spectral::Quadrature::GaussLobatto: {
+      static const auto cache_gl = make_static_cache<
+          CacheRange<
+              Spectral::minimum_number_of_points<
+                  Spectral::Basis::Legendre,
+                  Spectral::Quadrature::GaussLobatto>,
+              Spectral::maximum_number_of_points<Spectral::Basis::Legendre> +
+                  1>,
+          CacheRange<Spectral::minimum_number_of_points<
+                         Spectral::Basis::FiniteDifference,
+                         Spectral::Quadrature::CellCentered>,
+                     Spectral::maximum_number_of_points<
+                         Spectral::Basis::FiniteDifference> +
+                         1>>([](const size_t local_num_dg_points,
+                                const size_t local_num_fd_points) {
+        return reconstruction_matrix_factors_impl(
+            Mesh<1>{local_num_dg_points, Spectral::Basis::Legendre,
+                    Spectral::Quadrature::GaussLobatto},
+            local_num_fd_points);
+      });
+      return cache_gl(dg_mesh.extents(0), subcell_extents);
+    }
+    case Spectral::Quadrature::Gauss: {
+      static const auto cache_g = make_static_cache<
+          CacheRange<
+              Spectral::minimum_number_of_points<Spectral::Basis::Legendre,
+                                                 Spectral::Quadrature::Gauss>,
+              Spectral::maximum_number_of_points<Spectral::Basis::Legendre> +
+                  1>,
+          CacheRange<Spectral::minimum_number_of_points<
+                         Spectral::Basis::FiniteDifference,
+                         Spectral::Quadrature::CellCentered>,
+                     Spectral::maximum_number_of_points<
+                         Spectral::Basis::FiniteDifference> +
+                         1>>([](const size_t local_num_dg_points,
+                                const size_t local_num_fd_points) {
+        return reconstruction_matrix_factors_impl(
+            Mesh<1>{local_num_dg_points, Spectral::Basis::Legendre,
+                    Spectral::Quadrature::Gauss},
+            local_num_fd_points);
+      });
+      return cache_g(dg_mesh.extents(0), subcell_extents);
+    }
+    default:
+      ERROR("Unsupported quadrature type in FD subcell reconstruction matrix");
+  };
+}
+
 const Matrix& projection_matrix(const Mesh<1>& dg_mesh,
                                 const size_t subcell_extents,
                                 const size_t ghost_zone_size, const Side side) {
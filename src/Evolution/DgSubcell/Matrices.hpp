@@ -5,11 +5,12 @@
 #include <cstddef>
 #include <cstdint>
 
+#include "DataStructures/Matrix.hpp"
+
 /// \cond
 class DataVector;
 template <size_t Dim>
 class Index;
-class Matrix;
 template <size_t Dim>
 class Mesh;
 enum class Side : uint8_t;
@@ -80,6 +81,47 @@ template <size_t Dim>
 const Matrix& reconstruction_matrix(const Mesh<Dim>& dg_mesh,
                                     const Index<Dim>& subcell_extents);
 
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief The 1d factors of the `reconstruction_matrix` in each dimension.
+ *
+ * Since the projection matrix is a tensor product of 1d matrices, the
+ * reconstruction matrix splits into the unconstrained least-squares
+ * reconstruction \f$R^0=(\mathcal{P}^T\mathcal{P})^{-1}\mathcal{P}^T\f$,
+ * which is a tensor product of 1d matrices, and a rank-one correction that
+ * enforces the integral constraint,
+ *
+ * \f{align*}{
+ *   u = R^0\underline{u} + \vec{v} \left(\vec{\underline{w}}\cdot
+ *   \underline{u} - \vec{w}\cdot R^0\underline{u}\right),
+ *   \quad
+ *   \vec{v} = \frac{(\mathcal{P}^T\mathcal{P})^{-1}\vec{w}}
+ *   {\vec{w}\cdot(\mathcal{P}^T\mathcal{P})^{-1}\vec{w}},
+ * \f}
+ *
+ * where \f$\vec{v}\f$, \f$\vec{w}\f$, and \f$\vec{\underline{w}}\f$ are
+ * tensor products of 1d vectors as well. Applying the factors dimension by
+ * dimension gives the same result as the `reconstruction_matrix` at a
+ * fraction of the cost and memory footprint.
+ */
+struct ReconstructionMatrixFactors {
+  /// \f$R^0\f$, with the DG points as rows and the subcells as columns
+  Matrix least_squares{};
+  /// \f$\vec{v}\f$ as a column vector
+  Matrix constraint_correction{};
+  /// The DG integration weights \f$\vec{w}\f$ as a row vector
+  Matrix dg_weights{};
+  /// The subcell integration weights \f$\vec{\underline{w}}\f$ as a row
+  /// vector
+  Matrix subcell_weights{};
+};
+
+/// \ingroup DgSubcellGroup
+/// \brief The 1d factors of the `reconstruction_matrix`, see
+/// `ReconstructionMatrixFactors`.
+const ReconstructionMatrixFactors& reconstruction_matrix_factors(
+    const Mesh<1>& dg_mesh, size_t subcell_extents);
+
 /*!
  * \ingroup DgSubcellGroup
  * \brief Computes the projection matrix in 1 dimension going from a DG
@@ -9,10 +9,10 @@
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "Evolution/DgSubcell/Matrices.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
-#include "Utilities/Blas.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
@@ -27,16 +27,37 @@ void reconstruct_impl(
     const gsl::span<const double> subcell_u_times_projected_det_jac,
     const Mesh<Dim>& dg_mesh, const Index<Dim>& subcell_extents,
     const ReconstructionMethod reconstruction_method) {
-  const size_t number_of_components =
-      dg_u.size() / dg_mesh.number_of_grid_points();
+  DataVector result{dg_u.data(), dg_u.size()};
+  const DataVector u{
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      const_cast<double*>(subcell_u_times_projected_det_jac.data()),
+      subcell_u_times_projected_det_jac.size()};
   if (reconstruction_method == ReconstructionMethod::AllDimsAtOnce) {
-    const Matrix& recons_matrix =
-        reconstruction_matrix(dg_mesh, subcell_extents);
-    dgemm_<true>(
-        'N', 'N', recons_matrix.rows(), number_of_components,
-        recons_matrix.columns(), 1.0, recons_matrix.data(),
-        recons_matrix.spacing(), subcell_u_times_projected_det_jac.data(),
-        recons_matrix.columns(), 0.0, dg_u.data(), recons_matrix.rows());
+    // Apply the reconstruction_matrix using its 1d factors, which is much
+    // cheaper than the dense matrix in 2d and 3d.
+    const Matrix empty{};
+    auto least_squares = make_array<Dim>(std::cref(empty));
+    auto constraint_correction = make_array<Dim>(std::cref(empty));
+    auto dg_weights = make_array<Dim>(std::cref(empty));
+    auto subcell_weights = make_array<Dim>(std::cref(empty));
+    for (size_t d = 0; d < Dim; d++) {
+      const auto& factors = reconstruction_matrix_factors(
+          dg_mesh.slice_through(d), subcell_extents[d]);
+      gsl::at(least_squares, d) = std::cref(factors.least_squares);
+      gsl::at(constraint_correction, d) =
+          std::cref(factors.constraint_correction);
+      gsl::at(dg_weights, d) = std::cref(factors.dg_weights);
+      gsl::at(subcell_weights, d) = std::cref(factors.subcell_weights);
+    }
+    apply_matrices(make_not_null(&result), least_squares, u, subcell_extents);
+    // The integrals over the subcells and over the DG element of each
+    // component differ by the residual of the integral constraint
+    DataVector constraint_residual =
+        apply_matrices(subcell_weights, u, subcell_extents);
+    constraint_residual -=
+        apply_matrices(dg_weights, result, dg_mesh.extents());
+    result += apply_matrices(constraint_correction, constraint_residual,
+                             Index<Dim>{1});
   } else {
     ASSERT(reconstruction_method == ReconstructionMethod::DimByDim,
            "reconstruction_method must be either DimByDim or AllDimsAtOnce");
@@ -49,11 +70,6 @@ void reconstruct_impl(
       gsl::at(recons_matrices, d) = std::cref(reconstruction_matrix(
           dg_mesh.slice_through(d), Index<1>{subcell_extents[d]}));
     }
-    DataVector result{dg_u.data(), dg_u.size()};
-    const DataVector u{
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-        const_cast<double*>(subcell_u_times_projected_det_jac.data()),
-        subcell_u_times_projected_det_jac.size()};
     apply_matrices(make_not_null(&result), recons_matrices, u, subcell_extents);
   }
 }
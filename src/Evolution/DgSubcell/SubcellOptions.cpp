@@ -29,7 +29,8 @@ SubcellOptions::SubcellOptions(
     ::fd::DerivativeOrder finite_difference_derivative_order,
     const size_t number_of_steps_between_tci_calls,
     const size_t min_tci_calls_after_rollback,
-    const size_t min_clear_tci_before_dg)
+    const size_t min_clear_tci_before_dg,
+    const std::optional<double> rdmp_projection_threshold)
     : persson_exponent_(persson_exponent),
       persson_num_highest_modes_(persson_num_highest_modes),
       rdmp_delta0_(rdmp_delta0),
@@ -41,7 +42,8 @@ SubcellOptions::SubcellOptions(
       finite_difference_derivative_order_(finite_difference_derivative_order),
       number_of_steps_between_tci_calls_(number_of_steps_between_tci_calls),
       min_tci_calls_after_rollback_(min_tci_calls_after_rollback),
-      min_clear_tci_before_dg_(min_clear_tci_before_dg) {
+      min_clear_tci_before_dg_(min_clear_tci_before_dg),
+      rdmp_projection_threshold_(rdmp_projection_threshold) {
   if (not only_dg_block_and_group_names_.has_value()) {
     only_dg_block_ids_ = std::vector<size_t>{};
   }
@@ -91,6 +93,7 @@ void SubcellOptions::pup(PUP::er& p) {
   p | number_of_steps_between_tci_calls_;
   p | min_tci_calls_after_rollback_;
   p | min_clear_tci_before_dg_;
+  p | rdmp_projection_threshold_;
 }
 
 bool operator==(const SubcellOptions& lhs, const SubcellOptions& rhs) {
@@ -110,7 +113,8 @@ bool operator==(const SubcellOptions& lhs, const SubcellOptions& rhs) {
              rhs.number_of_steps_between_tci_calls_ and
          lhs.min_tci_calls_after_rollback_ ==
              rhs.min_tci_calls_after_rollback_ and
-         lhs.min_clear_tci_before_dg_ == rhs.min_clear_tci_before_dg_;
+         lhs.min_clear_tci_before_dg_ == rhs.min_clear_tci_before_dg_ and
+         lhs.rdmp_projection_threshold_ == rhs.rdmp_projection_threshold_;
 }
 
 bool operator!=(const SubcellOptions& lhs, const SubcellOptions& rhs) {
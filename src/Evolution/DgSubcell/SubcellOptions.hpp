@@ -90,6 +90,21 @@ class SubcellOptions {
     static type upper_bound() { return 1.0; }
     using group = RdmpTci;
   };
+  /// \brief The threshold of the highest-modes indicator below which the RDMP
+  /// TCI on the DG grid doesn't project the solution to the subcells.
+  ///
+  /// See `evolution::dg::subcell::Actions::TciAndRollback` for details. Set to
+  /// `None` to always project.
+  struct RdmpProjectionThreshold {
+    static std::string name() { return "ProjectionThreshold"; }
+    using type = Options::Auto<double, Options::AutoLabel::None>;
+    static constexpr Options::String help{
+        "The RDMP TCI on the DG grid only projects the solution to the "
+        "subcells if the fraction of the solution in the highest modes "
+        "exceeds this threshold for any evolved variable. Otherwise the max "
+        "and min over the DG grid are used. Set to 'None' to always project."};
+    using group = RdmpTci;
+  };
   /// If true, then we always use the subcell method, not DG.
   struct AlwaysUseSubcells {
     static constexpr Options::String help{
@@ -193,7 +208,8 @@ class SubcellOptions {
       PerssonExponent, PerssonNumHighestModes, RdmpDelta0, RdmpEpsilon,
       AlwaysUseSubcells, SubcellToDgReconstructionMethod, UseHalo,
       OnlyDgBlocksAndGroups, FiniteDifferenceDerivativeOrder,
-      NumberOfStepsBetweenTciCalls, MinTciCallsAfterRollback, MinimumClearTcis>;
+      NumberOfStepsBetweenTciCalls, MinTciCallsAfterRollback, MinimumClearTcis,
+      RdmpProjectionThreshold>;
 
   static constexpr Options::String help{
       "System-agnostic options for the DG-subcell method."};
@@ -206,7 +222,8 @@ class SubcellOptions {
       std::optional<std::vector<std::string>> only_dg_block_and_group_names,
       ::fd::DerivativeOrder finite_difference_derivative_order,
       size_t number_of_steps_between_tci_calls,
-      size_t min_tci_calls_after_rollback, size_t min_clear_tci_before_dg);
+      size_t min_tci_calls_after_rollback, size_t min_clear_tci_before_dg,
+      std::optional<double> rdmp_projection_threshold = std::nullopt);
 
   /// \brief Given an existing SubcellOptions that was created from block and
   /// group names, create one that stores block IDs.
@@ -276,6 +293,13 @@ class SubcellOptions {
   /// `0 means
   size_t min_clear_tci_before_dg() const { return min_clear_tci_before_dg_; }
 
+  /// The threshold of the highest-modes indicator above which the RDMP TCI on
+  /// the DG grid projects the solution to the subcells. If `std::nullopt`
+  /// then the solution is always projected.
+  const std::optional<double>& rdmp_projection_threshold() const {
+    return rdmp_projection_threshold_;
+  }
+
  private:
   friend bool operator==(const SubcellOptions& lhs, const SubcellOptions& rhs);
 
@@ -294,6 +318,7 @@ class SubcellOptions {
   size_t number_of_steps_between_tci_calls_{1};
   size_t min_tci_calls_after_rollback_{1};
   size_t min_clear_tci_before_dg_{0};
+  std::optional<double> rdmp_projection_threshold_{};
 };
 
 bool operator!=(const SubcellOptions& lhs, const SubcellOptions& rhs);
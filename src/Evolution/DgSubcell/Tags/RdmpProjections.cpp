@@ -0,0 +1,40 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/Tags/RdmpProjections.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "Evolution/DgSubcell/ActiveGrid.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace evolution::dg::subcell::Tags {
+template <size_t Dim>
+void SkippedRdmpProjectionFractionCompute<Dim>::function(
+    const gsl::not_null<return_type*> result,
+    const size_t projections_evaluated, const size_t projections_skipped,
+    const subcell::ActiveGrid active_grid, const ::Mesh<Dim>& subcell_mesh,
+    const ::Mesh<Dim>& dg_mesh) {
+  get(*result).destructive_resize(active_grid == subcell::ActiveGrid::Dg
+                                      ? dg_mesh.number_of_grid_points()
+                                      : subcell_mesh.number_of_grid_points());
+  const size_t tci_calls = projections_evaluated + projections_skipped;
+  get(*result) = tci_calls == 0
+                     ? 0.0
+                     : static_cast<double>(projections_skipped) /
+                           static_cast<double>(tci_calls);
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data) \
+  template class SkippedRdmpProjectionFractionCompute<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg::subcell::Tags
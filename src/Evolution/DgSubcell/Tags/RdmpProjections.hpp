@@ -0,0 +1,67 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/Tags.hpp"
+#include "Evolution/DgSubcell/ActiveGrid.hpp"
+#include "Evolution/DgSubcell/Tags/ActiveGrid.hpp"
+#include "Evolution/DgSubcell/Tags/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+template <size_t Dim>
+class Mesh;
+/// \endcond
+
+namespace evolution::dg::subcell::Tags {
+/// \brief The number of calls to the TCI on the DG grid in which the candidate
+/// solution was projected to the subcells to compute the RDMP TCI data.
+///
+/// See `evolution::dg::subcell::Actions::TciAndRollback` for details.
+struct RdmpProjectionsEvaluated : db::SimpleTag {
+  using type = size_t;
+};
+
+/// \brief The number of calls to the TCI on the DG grid in which the
+/// projection to the subcells was skipped because the highest-modes indicator
+/// was below `SubcellOptions::rdmp_projection_threshold()`.
+///
+/// See `evolution::dg::subcell::Actions::TciAndRollback` for details.
+struct RdmpProjectionsSkipped : db::SimpleTag {
+  using type = size_t;
+};
+
+/// \brief The fraction of the TCI calls on the DG grid in which the projection
+/// to the subcells was skipped, as a `Scalar<DataVector>` so it can be
+/// observed.
+struct SkippedRdmpProjectionFraction : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+/// Compute tag to get a `SkippedRdmpProjectionFraction` from the
+/// `RdmpProjectionsEvaluated` and `RdmpProjectionsSkipped` counts.
+///
+/// The fraction is zero if the TCI has not been called on the DG grid yet.
+template <size_t Dim>
+struct SkippedRdmpProjectionFractionCompute : db::ComputeTag,
+                                              SkippedRdmpProjectionFraction {
+  using base = SkippedRdmpProjectionFraction;
+  using return_type = typename base::type;
+  using argument_tags =
+      tmpl::list<Tags::RdmpProjectionsEvaluated, Tags::RdmpProjectionsSkipped,
+                 Tags::ActiveGrid, Tags::Mesh<Dim>, ::domain::Tags::Mesh<Dim>>;
+  static void function(gsl::not_null<return_type*> result,
+                       size_t projections_evaluated,
+                       size_t projections_skipped,
+                       subcell::ActiveGrid active_grid,
+                       const ::Mesh<Dim>& subcell_mesh,
+                       const ::Mesh<Dim>& dg_mesh);
+};
+}  // namespace evolution::dg::subcell::Tags
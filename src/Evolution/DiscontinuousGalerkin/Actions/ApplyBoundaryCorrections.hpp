@@ -723,6 +723,7 @@ struct ApplyBoundaryCorrections {
           // Variables for reusing allocations.  The actual values are
           // not reused.
           DtVariables dt_boundary_correction_on_mortar{};
+          DtVariables dt_boundary_correction_projected_onto_face{};
           DtVariables volume_dt_correction{};
           // These variables may change size for each mortar and require
           // a new memory allocation, but they may also happen to need
@@ -753,7 +754,9 @@ struct ApplyBoundaryCorrections {
 
             const auto compute_correction_coupling =
                 [&typed_boundary_correction, &direction, dg_formulation,
-                 &dt_boundary_correction_on_mortar, &face_det_jacobian,
+                 &dt_boundary_correction_on_mortar,
+                 &dt_boundary_correction_projected_onto_face,
+                 &face_det_jacobian,
                  &face_mesh, &face_normal_covector_and_magnitude,
                  &local_data_on_mortar, &mortar_id, &mortar_meshes,
                  &mortar_sizes, &neighbor_data_on_mortar,
@@ -807,20 +810,21 @@ struct ApplyBoundaryCorrections {
               const std::array<Spectral::MortarSize, volume_dim - 1>&
                   mortar_size = mortar_sizes.at(mortar_id);
 
-              // This cannot reuse an allocation because it is initialized
-              // via move-assignment.  (If it is used at all.)
-              DtVariables dt_boundary_correction_projected_onto_face{};
               auto& dt_boundary_correction =
                   [&dt_boundary_correction_on_mortar,
                    &dt_boundary_correction_projected_onto_face, &face_mesh,
                    &mortar_mesh, &mortar_size]() -> DtVariables& {
                 if (Spectral::needs_projection(face_mesh, mortar_mesh,
                                                mortar_size)) {
-                  dt_boundary_correction_projected_onto_face =
-                      ::dg::project_from_mortar(
-                          dt_boundary_correction_on_mortar, face_mesh,
-                          mortar_mesh, mortar_size);
-                  return dt_boundary_correction_projected_onto_face;
+                  // Project into the reused buffer instead of a new
+                  // Variables for every mortar
+                  auto& projected = dt_boundary_correction_projected_onto_face;
+                  projected.initialize(face_mesh.number_of_grid_points());
+                  ::dg::project_from_mortar(make_not_null(&projected),
+                                            dt_boundary_correction_on_mortar,
+                                            face_mesh, mortar_mesh,
+                                            mortar_size);
+                  return projected;
                 }
                 return dt_boundary_correction_on_mortar;
               }();
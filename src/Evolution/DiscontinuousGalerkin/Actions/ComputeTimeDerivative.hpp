@@ -14,6 +14,7 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
@@ -50,6 +51,7 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
+#include "Parallel/ArrayCollection/SendAggregatedMessages.hpp"
 #include "Parallel/ArrayCollection/SendDataToElement.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
@@ -61,6 +63,7 @@
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
 
 /// \cond
 namespace Tags {
@@ -103,6 +106,19 @@ struct get_primitive_tags_for_face {
   using type = typename get_primitive_vars<
       System::has_primitive_and_conservative_vars>::template f<T>;
 };
+
+CREATE_HAS_STATIC_MEMBER_VARIABLE(send_boundary_data_before_flux_divergence)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(send_boundary_data_before_flux_divergence)
+
+template <typename Metavariables>
+constexpr bool send_boundary_data_before_flux_divergence() {
+  if constexpr (has_send_boundary_data_before_flux_divergence_v<Metavariables,
+                                                                bool>) {
+    return Metavariables::send_boundary_data_before_flux_divergence;
+  } else {
+    return true;
+  }
+}
 }  // namespace detail
 
 /*!
@@ -245,6 +261,18 @@ struct get_primitive_tags_for_face {
  *     DirectionsTag, db::add_tag_prefix<Tags::NormalDotFlux, variables_tag>>
  *   - `Tags::Mortars<typename BoundaryScheme::mortar_data_tag, VolumeDim>`
  *
+ * ### Overlapping communication with the volume terms
+ *
+ * With global time stepping the boundary data is sent to the neighbors as soon
+ * as it is packaged, which only needs the evolved variables, fluxes and
+ * temporaries. The flux divergence and the external boundary conditions are
+ * computed afterwards, which hides part of the communication latency behind
+ * the remaining volume work and gives identical results. Set
+ * `static constexpr bool send_boundary_data_before_flux_divergence = false;`
+ * in the metavariables to compute the complete time derivative before sending.
+ * With local time stepping the step must be taken before sending, which
+ * requires the complete time derivative, so the option has no effect.
+ *
  * ### Internal Boundary Terms
  *
  * Internal boundary terms are computed from the
@@ -515,7 +543,10 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping,
       (VarsFaceTemporaries::number_of_independent_components +
        DgPackagedDataVarsOnFace::number_of_independent_components) *
           num_face_temporary_grid_points;
-  auto buffer = cpp20::make_unique_for_overwrite<double[]>(buffer_size);
+  // The buffer is only needed for the duration of this action, so take it
+  // from the thread's scratch arena to avoid a heap allocation per element
+  // per substep.
+  ScratchArena::Allocation<double> buffer{buffer_size};
 #ifdef SPECTRE_DEBUG
   std::fill(&buffer[0], &buffer[buffer_size],
             std::numeric_limits<double>::signaling_NaN());
@@ -572,32 +603,47 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping,
           box);
     }
   }
-  db::mutate_apply<
-      tmpl::list<dt_variables_tag>,
-      typename compute_volume_time_derivative_terms::argument_tags>(
-      [&dg_formulation, &div_fluxes, &det_inverse_jacobian,
-       &div_mesh_velocity = db::get<::domain::Tags::DivMeshVelocity>(box),
-       &evolved_variables = db::get<variables_tag>(box),
-       &inertial_coordinates =
-           db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box),
-       &logical_to_inertial_inv_jacobian =
-           db::get<::domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
-                                                   Frame::Inertial>>(box),
-       &mesh, &mesh_velocity = db::get<::domain::Tags::MeshVelocity<Dim>>(box),
-       &partial_derivs, &temporaries, &volume_fluxes](
-          const gsl::not_null<Variables<
-              db::wrap_tags_in<::Tags::dt, typename variables_tag::tags_list>>*>
-              dt_vars_ptr,
-          const auto&... time_derivative_args) {
-        detail::volume_terms<compute_volume_time_derivative_terms>(
-            dt_vars_ptr, make_not_null(&volume_fluxes),
-            make_not_null(&partial_derivs), make_not_null(&temporaries),
-            make_not_null(&div_fluxes), evolved_variables, dg_formulation, mesh,
-            inertial_coordinates, logical_to_inertial_inv_jacobian,
-            det_inverse_jacobian, mesh_velocity, div_mesh_velocity,
-            time_derivative_args...);
-      },
-      make_not_null(&box));
+  constexpr bool send_before_flux_divergence =
+      not LocalTimeStepping and
+      detail::send_boundary_data_before_flux_divergence<Metavariables>();
+  const auto compute_volume_terms =
+      [&box, &dg_formulation, &det_inverse_jacobian, &div_fluxes, &mesh,
+       &partial_derivs, &temporaries,
+       &volume_fluxes](const detail::VolumeTermsStage stage) {
+        db::mutate_apply<
+            tmpl::list<dt_variables_tag>,
+            typename compute_volume_time_derivative_terms::argument_tags>(
+            [&dg_formulation, &div_fluxes, &det_inverse_jacobian,
+             &div_mesh_velocity = db::get<::domain::Tags::DivMeshVelocity>(box),
+             &evolved_variables = db::get<variables_tag>(box),
+             &inertial_coordinates =
+                 db::get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box),
+             &logical_to_inertial_inv_jacobian =
+                 db::get<::domain::Tags::InverseJacobian<
+                     Dim, Frame::ElementLogical, Frame::Inertial>>(box),
+             &mesh,
+             &mesh_velocity = db::get<::domain::Tags::MeshVelocity<Dim>>(box),
+             &partial_derivs, &stage, &temporaries, &volume_fluxes](
+                const gsl::not_null<Variables<db::wrap_tags_in<
+                    ::Tags::dt, typename variables_tag::tags_list>>*>
+                    dt_vars_ptr,
+                const auto&... time_derivative_args) {
+              detail::volume_terms<compute_volume_time_derivative_terms>(
+                  dt_vars_ptr, make_not_null(&volume_fluxes),
+                  make_not_null(&partial_derivs), make_not_null(&temporaries),
+                  make_not_null(&div_fluxes), evolved_variables,
+                  dg_formulation, mesh, inertial_coordinates,
+                  logical_to_inertial_inv_jacobian, det_inverse_jacobian,
+                  mesh_velocity, div_mesh_velocity, stage,
+                  time_derivative_args...);
+            },
+            make_not_null(&box));
+      };
+  // With the boundary data sent first, only the terms needed to package it are
+  // computed here and the flux divergence is added once the data is sent.
+  compute_volume_terms(send_before_flux_divergence
+                           ? detail::VolumeTermsStage::BeforeFluxDivergence
+                           : detail::VolumeTermsStage::All);
 
   const Variables<detail::get_primitive_vars_tags_from_system<EvolutionSystem>>*
       primitive_vars{nullptr};
@@ -631,21 +677,42 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping,
               primitive_vars,
               typename DerivedCorrection::dg_package_data_volume_tags{});
 
-          detail::apply_boundary_conditions_on_all_external_faces<
-              EvolutionSystem, Dim>(
-              make_not_null(&box),
-              dynamic_cast<const DerivedCorrection&>(boundary_correction),
-              temporaries, volume_fluxes, partial_derivs, primitive_vars);
+          if constexpr (not send_before_flux_divergence) {
+            detail::apply_boundary_conditions_on_all_external_faces<
+                EvolutionSystem, Dim>(
+                make_not_null(&box),
+                dynamic_cast<const DerivedCorrection&>(boundary_correction),
+                temporaries, volume_fluxes, partial_derivs, primitive_vars);
+          }
         }
       });
 
-  if constexpr (LocalTimeStepping) {
-    take_step<EvolutionSystem, LocalTimeStepping, DgStepChoosers>(
-        make_not_null(&box));
-  }
+  if constexpr (send_before_flux_divergence) {
+    send_data_for_fluxes<ParallelComponent>(make_not_null(&cache),
+                                            make_not_null(&box), volume_fluxes);
+    compute_volume_terms(detail::VolumeTermsStage::FluxDivergence);
+    tmpl::for_each<derived_boundary_corrections>(
+        [&boundary_correction, &box, &partial_derivs, &primitive_vars,
+         &temporaries, &volume_fluxes](auto derived_correction_v) {
+          using DerivedCorrection =
+              tmpl::type_from<decltype(derived_correction_v)>;
+          if (typeid(boundary_correction) == typeid(DerivedCorrection)) {
+            detail::apply_boundary_conditions_on_all_external_faces<
+                EvolutionSystem, Dim>(
+                make_not_null(&box),
+                dynamic_cast<const DerivedCorrection&>(boundary_correction),
+                temporaries, volume_fluxes, partial_derivs, primitive_vars);
+          }
+        });
+  } else {
+    if constexpr (LocalTimeStepping) {
+      take_step<EvolutionSystem, LocalTimeStepping, DgStepChoosers>(
+          make_not_null(&box));
+    }
 
-  send_data_for_fluxes<ParallelComponent>(make_not_null(&cache),
-                                          make_not_null(&box), volume_fluxes);
+    send_data_for_fluxes<ParallelComponent>(make_not_null(&cache),
+                                            make_not_null(&box), volume_fluxes);
+  }
   return {Parallel::AlgorithmExecution::Continue, std::nullopt};
 }
 
@@ -772,6 +839,16 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
       ++neighbor_count;
     }
   }
+  if constexpr (Parallel::is_dg_element_collection_v<ParallelComponent>) {
+    // Send the data for neighbors on other nodes that was buffered to
+    // aggregate it into fewer messages
+    Parallel::local_synchronous_action<
+        Parallel::Actions::SendAggregatedMessages>(
+        receiver_proxy, cache,
+        evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<
+            Dim, UseNodegroupDgElements>{},
+        element);
+  }
 
   if constexpr (LocalTimeStepping) {
     using variables_tag = typename EvolutionSystem::variables_tag;
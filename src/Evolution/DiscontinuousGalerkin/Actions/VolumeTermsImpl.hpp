@@ -19,6 +19,17 @@
 #include "Utilities/TMPL.hpp"
 
 namespace evolution::dg::Actions::detail {
+/// Which steps of `volume_terms()` to do
+enum class VolumeTermsStage {
+  /// All steps
+  All,
+  /// Everything except adding the flux divergence to the time derivatives
+  BeforeFluxDivergence,
+  /// Only add the flux divergence. The other steps must have been done before
+  /// with the same arguments.
+  FluxDivergence
+};
+
 /*
  * Computes the volume terms for a discontinuous Galerkin scheme.
  *
@@ -58,6 +69,11 @@ namespace evolution::dg::Actions::detail {
  *    Note that the computation of the flux divergence and adding that to the
  *    time derivative must be done *after* the mesh velocity is subtracted
  *    from the fluxes.
+ *
+ * The `stage` selects whether all steps are done, only steps 1-3, or only
+ * step 4. Steps 1-3 compute everything needed for the boundary data, so the
+ * boundary data can be sent to the neighbors before the flux divergence is
+ * computed. The results don't depend on the split.
  */
 template <typename ComputeVolumeTimeDerivativeTerms, size_t Dim,
           typename... TimeDerivativeArguments, typename... VariablesTags,
@@ -90,5 +106,6 @@ void volume_terms(
     const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
         mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
+    VolumeTermsStage stage,
     const TimeDerivativeArguments&... time_derivative_args);
 }  // namespace evolution::dg::Actions::detail
@@ -14,6 +14,7 @@
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Evolution/DiscontinuousGalerkin/Actions/VolumeTermsImpl.hpp"
 #include "Evolution/PassVariables.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MetricIdentityJacobian.hpp"
@@ -68,6 +69,11 @@ namespace evolution::dg::Actions::detail {
  *    Note that the computation of the flux divergence and adding that to the
  *    time derivative must be done *after* the mesh velocity is subtracted
  *    from the fluxes.
+ *
+ * The `stage` selects whether all steps are done, only steps 1-3, or only
+ * step 4. Steps 1-3 compute everything needed for the boundary data, so the
+ * boundary data can be sent to the neighbors before the flux divergence is
+ * computed. The results don't depend on the split.
  */
 template <typename ComputeVolumeTimeDerivativeTerms, size_t Dim,
           typename... TimeDerivativeArguments, typename... VariablesTags,
@@ -100,6 +106,7 @@ void volume_terms(
     const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
         mesh_velocity,
     const std::optional<Scalar<DataVector>>& div_mesh_velocity,
+    const VolumeTermsStage stage,
     const TimeDerivativeArguments&... time_derivative_args) {
   static constexpr bool has_partial_derivs = sizeof...(PartialDerivTags) != 0;
   static constexpr bool has_fluxes = sizeof...(FluxVariablesTags) != 0;
@@ -115,123 +122,129 @@ void volume_terms(
   using flux_variables =
       tmpl::list<FluxVariablesTags...>;
 
-  // Compute d_i u_\alpha for nonconservative products
-  if constexpr (has_partial_derivs) {
-    partial_derivatives(partial_derivs, evolved_vars, mesh,
-                        logical_to_inertial_inverse_jacobian);
-  }
+  if (stage != VolumeTermsStage::FluxDivergence) {
+    // Compute d_i u_\alpha for nonconservative products
+    if constexpr (has_partial_derivs) {
+      partial_derivatives(partial_derivs, evolved_vars, mesh,
+                          logical_to_inertial_inverse_jacobian);
+    }
 
-  // For now just zero dt_vars. If this is a performance bottle neck we
-  // can re-evaluate in the future.
-  dt_vars_ptr->initialize(mesh.number_of_grid_points(), 0.0);
+    // For now just zero dt_vars. If this is a performance bottle neck we
+    // can re-evaluate in the future.
+    dt_vars_ptr->initialize(mesh.number_of_grid_points(), 0.0);
 
-  // Compute volume du/dt and fluxes
-  if constexpr (std::is_base_of_v<evolution::PassVariables,
-                                  ComputeVolumeTimeDerivativeTerms>) {
-    if constexpr (sizeof...(FluxVariablesTags) != 0) {
-      ComputeVolumeTimeDerivativeTerms::apply(
-          dt_vars_ptr, volume_fluxes, temporaries,
-          get<::Tags::deriv<PartialDerivTags, tmpl::size_t<Dim>,
-                            Frame::Inertial>>(*partial_derivs)...,
-          time_derivative_args...);
+    // Compute volume du/dt and fluxes
+    if constexpr (std::is_base_of_v<evolution::PassVariables,
+                                    ComputeVolumeTimeDerivativeTerms>) {
+      if constexpr (sizeof...(FluxVariablesTags) != 0) {
+        ComputeVolumeTimeDerivativeTerms::apply(
+            dt_vars_ptr, volume_fluxes, temporaries,
+            get<::Tags::deriv<PartialDerivTags, tmpl::size_t<Dim>,
+                              Frame::Inertial>>(*partial_derivs)...,
+            time_derivative_args...);
+      } else {
+        ComputeVolumeTimeDerivativeTerms::apply(
+            dt_vars_ptr, temporaries,
+            get<::Tags::deriv<PartialDerivTags, tmpl::size_t<Dim>,
+                              Frame::Inertial>>(*partial_derivs)...,
+            time_derivative_args...);
+      }
     } else {
       ComputeVolumeTimeDerivativeTerms::apply(
-          dt_vars_ptr, temporaries,
+          make_not_null(&get<::Tags::dt<VariablesTags>>(*dt_vars_ptr))...,
+          make_not_null(&get<::Tags::Flux<FluxVariablesTags, tmpl::size_t<Dim>,
+                                          Frame::Inertial>>(*volume_fluxes))...,
+          make_not_null(&get<TemporaryTags>(*temporaries))...,
           get<::Tags::deriv<PartialDerivTags, tmpl::size_t<Dim>,
                             Frame::Inertial>>(*partial_derivs)...,
           time_derivative_args...);
     }
-  } else {
-    ComputeVolumeTimeDerivativeTerms::apply(
-        make_not_null(&get<::Tags::dt<VariablesTags>>(*dt_vars_ptr))...,
-        make_not_null(&get<::Tags::Flux<FluxVariablesTags, tmpl::size_t<Dim>,
-                                        Frame::Inertial>>(*volume_fluxes))...,
-        make_not_null(&get<TemporaryTags>(*temporaries))...,
-        get<::Tags::deriv<PartialDerivTags, tmpl::size_t<Dim>,
-                          Frame::Inertial>>(*partial_derivs)...,
-        time_derivative_args...);
-  }
 
-  // Add volume terms for moving meshes
-  if (mesh_velocity.has_value()) {
-    tmpl::for_each<flux_variables>([&div_mesh_velocity, &dt_vars_ptr,
-                                    &evolved_vars, &mesh_velocity,
-                                    &volume_fluxes](auto tag_v) {
-      // Modify fluxes for moving mesh
-      using var_tag = typename decltype(tag_v)::type;
-      using flux_var_tag =
-          db::add_tag_prefix<::Tags::Flux, var_tag, tmpl::size_t<Dim>,
-                             Frame::Inertial>;
-      auto& flux_var = get<flux_var_tag>(*volume_fluxes);
-      // Loop over all independent components of flux_var
-      for (size_t flux_var_storage_index = 0;
-           flux_var_storage_index < flux_var.size(); ++flux_var_storage_index) {
-        // Get the flux variable's tensor index, e.g. (i,j) for a F^i of
-        // the spatial velocity (or some other spatial tensor).
-        const auto flux_var_tensor_index =
-            flux_var.get_tensor_index(flux_var_storage_index);
-        // Remove the first index from the flux tensor index, gets back
-        // (j)
-        const auto var_tensor_index =
-            all_but_specified_element_of(flux_var_tensor_index, 0);
-        // Set flux_index to (i)
-        const size_t flux_index = gsl::at(flux_var_tensor_index, 0);
+    // Add volume terms for moving meshes
+    if (mesh_velocity.has_value()) {
+      tmpl::for_each<flux_variables>([&div_mesh_velocity, &dt_vars_ptr,
+                                      &evolved_vars, &mesh_velocity,
+                                      &volume_fluxes](auto tag_v) {
+        // Modify fluxes for moving mesh
+        using var_tag = typename decltype(tag_v)::type;
+        using flux_var_tag =
+            db::add_tag_prefix<::Tags::Flux, var_tag, tmpl::size_t<Dim>,
+                               Frame::Inertial>;
+        auto& flux_var = get<flux_var_tag>(*volume_fluxes);
+        // Loop over all independent components of flux_var
+        for (size_t flux_var_storage_index = 0;
+             flux_var_storage_index < flux_var.size();
+             ++flux_var_storage_index) {
+          // Get the flux variable's tensor index, e.g. (i,j) for a F^i of
+          // the spatial velocity (or some other spatial tensor).
+          const auto flux_var_tensor_index =
+              flux_var.get_tensor_index(flux_var_storage_index);
+          // Remove the first index from the flux tensor index, gets back
+          // (j)
+          const auto var_tensor_index =
+              all_but_specified_element_of(flux_var_tensor_index, 0);
+          // Set flux_index to (i)
+          const size_t flux_index = gsl::at(flux_var_tensor_index, 0);
 
-        // We now need to index flux(i,j) -= u(j) * v_g(i)
-        flux_var[flux_var_storage_index] -=
-            get<var_tag>(evolved_vars).get(var_tensor_index) *
-            mesh_velocity->get(flux_index);
-      }
+          // We now need to index flux(i,j) -= u(j) * v_g(i)
+          flux_var[flux_var_storage_index] -=
+              get<var_tag>(evolved_vars).get(var_tensor_index) *
+              mesh_velocity->get(flux_index);
+        }
 
-      // Modify time derivative (i.e. source terms) for moving mesh
-      auto& dt_var = get<::Tags::dt<var_tag>>(*dt_vars_ptr);
-      for (size_t dt_var_storage_index = 0;
-           dt_var_storage_index < dt_var.size(); ++dt_var_storage_index) {
-        // This is S -> S - u d_i v^i_g
-        dt_var[dt_var_storage_index] -=
-            get<var_tag>(evolved_vars)[dt_var_storage_index] *
-            get(*div_mesh_velocity);
-      }
-    });
+        // Modify time derivative (i.e. source terms) for moving mesh
+        auto& dt_var = get<::Tags::dt<var_tag>>(*dt_vars_ptr);
+        for (size_t dt_var_storage_index = 0;
+             dt_var_storage_index < dt_var.size(); ++dt_var_storage_index) {
+          // This is S -> S - u d_i v^i_g
+          dt_var[dt_var_storage_index] -=
+              get<var_tag>(evolved_vars)[dt_var_storage_index] *
+              get(*div_mesh_velocity);
+        }
+      });
 
-    // We add the mesh velocity to all equations that don't have flux terms.
-    // This doesn't need to be equal to the equations that have partial
-    // derivatives. For example, the scalar field evolution equation in
-    // first-order form does not have any partial derivatives but still needs
-    // the velocity term added. This is because the velocity term arises from
-    // transforming the time derivative.
-    using non_flux_tags =
-        tmpl::list_difference<tmpl::list<VariablesTags...>, flux_variables>;
+      // We add the mesh velocity to all equations that don't have flux terms.
+      // This doesn't need to be equal to the equations that have partial
+      // derivatives. For example, the scalar field evolution equation in
+      // first-order form does not have any partial derivatives but still needs
+      // the velocity term added. This is because the velocity term arises from
+      // transforming the time derivative.
+      using non_flux_tags =
+          tmpl::list_difference<tmpl::list<VariablesTags...>, flux_variables>;
 
-    tmpl::for_each<non_flux_tags>([&dt_vars_ptr, &mesh_velocity,
-                                   &partial_derivs](auto var_tag_v) {
-      using var_tag = typename decltype(var_tag_v)::type;
-      using dt_var_tag = ::Tags::dt<var_tag>;
-      using deriv_var_tag =
-          ::Tags::deriv<var_tag, tmpl::size_t<Dim>, Frame::Inertial>;
+      tmpl::for_each<non_flux_tags>([&dt_vars_ptr, &mesh_velocity,
+                                     &partial_derivs](auto var_tag_v) {
+        using var_tag = typename decltype(var_tag_v)::type;
+        using dt_var_tag = ::Tags::dt<var_tag>;
+        using deriv_var_tag =
+            ::Tags::deriv<var_tag, tmpl::size_t<Dim>, Frame::Inertial>;
 
-      const auto& deriv_var = get<deriv_var_tag>(*partial_derivs);
-      auto& dt_var = get<dt_var_tag>(*dt_vars_ptr);
+        const auto& deriv_var = get<deriv_var_tag>(*partial_derivs);
+        auto& dt_var = get<dt_var_tag>(*dt_vars_ptr);
 
-      // Loop over all independent components of the derivative of the
-      // variable.
-      for (size_t deriv_var_storage_index = 0;
-           deriv_var_storage_index < deriv_var.size();
-           ++deriv_var_storage_index) {
-        // We grab the `deriv_tensor_index`, which would be e.g.
-        // `(i, a, b)`, so `(0, 2, 3)`
-        const auto deriv_var_tensor_index =
-            deriv_var.get_tensor_index(deriv_var_storage_index);
-        // Then we drop the derivative index (the first entry) to get
-        // `(a, b)` (or `(2, 3)`)
-        const auto dt_var_tensor_index =
-            all_but_specified_element_of(deriv_var_tensor_index, 0);
-        // Set `deriv_index` to `i` (or `0` in the example)
-        const size_t deriv_index = gsl::at(deriv_var_tensor_index, 0);
-        dt_var.get(dt_var_tensor_index) += mesh_velocity->get(deriv_index) *
-                                           deriv_var[deriv_var_storage_index];
-      }
-    });
+        // Loop over all independent components of the derivative of the
+        // variable.
+        for (size_t deriv_var_storage_index = 0;
+             deriv_var_storage_index < deriv_var.size();
+             ++deriv_var_storage_index) {
+          // We grab the `deriv_tensor_index`, which would be e.g.
+          // `(i, a, b)`, so `(0, 2, 3)`
+          const auto deriv_var_tensor_index =
+              deriv_var.get_tensor_index(deriv_var_storage_index);
+          // Then we drop the derivative index (the first entry) to get
+          // `(a, b)` (or `(2, 3)`)
+          const auto dt_var_tensor_index =
+              all_but_specified_element_of(deriv_var_tensor_index, 0);
+          // Set `deriv_index` to `i` (or `0` in the example)
+          const size_t deriv_index = gsl::at(deriv_var_tensor_index, 0);
+          dt_var.get(dt_var_tensor_index) += mesh_velocity->get(deriv_index) *
+                                             deriv_var[deriv_var_storage_index];
+        }
+      });
+    }
+  }
+  if (stage == VolumeTermsStage::BeforeFluxDivergence) {
+    return;
   }
 
   // Add the flux divergence term to du_\alpha/dt, which must be done
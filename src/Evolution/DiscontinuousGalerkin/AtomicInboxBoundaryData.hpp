@@ -34,6 +34,13 @@ namespace evolution::dg {
  * local time stepping, since not every message entry "counts" since it
  * depends on the time level of neighboring elements.
  *
+ * Data sent between elements on the same node is moved into the queue and
+ * from the queue into the receiver's mortar data, so the `DataVector`s
+ * allocated by the sender are handed to the receiver without their contents
+ * being copied. The only copy of the face data is the one the sender makes
+ * when it packages its mortar data for the neighbor, since the sender keeps its
+ * own copy for computing its boundary correction.
+ *
  * \warning Only `AtomicInboxBoundaryData` with zero messages can be move
  * constructed. A non-zero number of neighbors is allowed. This is necessary
  * in order to be able to serialize a
@@ -56,21 +63,7 @@ struct AtomicInboxBoundaryData {
    * `OrientationMap` to be put in the same block frame as the element that is
    * receiving the data (i.e. that whose inbox this is being inserted into).
    *
-   * The hash is computed as
-   * \f{align}{
-   * 2^D d + 2^{D-1} s + e
-   * \f}
-   * where \f$D\f$ is the number of spatial dimensions, \f$d\f$ is the logical
-   * dimension of the direction to the neighbor from the element whose inbox
-   * this is, \f$s\f$ is the side in the logical dimension \f$d\f$ with a value
-   * of 1 for upper and 0 for lower, and \f$e\f$ is a hash of the index of the
-   * `SegmentId`'s of the neighbor's `ElementId` for the dimensions other than
-   * \f$d\f$. In particular: for \f$d=1\f$, \f$e\f$ is 0 (1) if
-   * the `SegmentId` index along the face is even (odd); and for \f$d = 3\f$
-   * \f$e\f$ is 0 (1, 2, 3) if the `SegmentId` indices along the face are both
-   * even (lower dim odd, higher dim odd, both dims odd). The element segment
-   * hash is computed as the logical `and` of the `SegmentID`'s index in that
-   * direction, left shifted by which direction on the face it is.
+   * See `domain::directional_id_index` for how the index is computed.
    */
   static size_t index(const DirectionalId<Dim>& directional_id);
 
@@ -358,8 +358,13 @@ bool Minmod<VolumeDim, tmpl::list<Tags...>>::operator()(
     return false;
   }
 
-  DataVector u_lin_buffer(mesh.number_of_grid_points());
-  Minmod_detail::BufferWrapper<VolumeDim> buffer(mesh);
+  // The buffers are reused across invocations on this thread, so limiting the
+  // elements of a node one after another does not allocate
+  thread_local DataVector u_lin_buffer{};
+  if (u_lin_buffer.size() != mesh.number_of_grid_points()) {
+    u_lin_buffer.destructive_resize(mesh.number_of_grid_points());
+  }
+  auto& buffer = Minmod_detail::thread_local_buffer(mesh);
 
   bool limiter_activated = false;
   const auto wrap_minmod_impl = [this, &limiter_activated, &element, &mesh,
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <memory>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/SliceIterator.hpp"
@@ -64,6 +65,17 @@ BufferWrapper<VolumeDim>::BufferWrapper(const Mesh<VolumeDim>& mesh)
   }
 }
 
+template <size_t VolumeDim>
+BufferWrapper<VolumeDim>& thread_local_buffer(const Mesh<VolumeDim>& mesh) {
+  thread_local Mesh<VolumeDim> buffer_mesh{};
+  thread_local std::unique_ptr<BufferWrapper<VolumeDim>> buffer{};
+  if (buffer == nullptr or buffer_mesh != mesh) {
+    buffer = std::make_unique<BufferWrapper<VolumeDim>>(mesh);
+    buffer_mesh = mesh;
+  }
+  return *buffer;
+}
+
 template <size_t VolumeDim>
 double effective_difference_to_neighbor(
     const double u_mean, const Element<VolumeDim>& element,
@@ -87,6 +99,8 @@ double effective_difference_to_neighbor(
 
 #define INSTANTIATE(_, data)                                                   \
   template class Minmod_detail::BufferWrapper<DIM(data)>;                      \
+  template BufferWrapper<DIM(data)>& thread_local_buffer(                      \
+      const Mesh<DIM(data)>&);                                                 \
   template double effective_difference_to_neighbor<DIM(data)>(                 \
       double, const Element<DIM(data)>&, const std::array<double, DIM(data)>&, \
       size_t, const Side&, const DirectionMap<DIM(data), double>&,             \
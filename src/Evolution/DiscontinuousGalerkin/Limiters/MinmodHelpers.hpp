@@ -44,8 +44,9 @@ MinmodResult tvb_corrected_minmod(double a, double b, double c,
                                   double tvb_scale);
 
 // Holds various optimization-related allocations for the Minmod TCI.
-// There is no pup::er, because these allocations should be short-lived (i.e.,
-// scoped within a single limiter invocation).
+// There is no pup::er, because these allocations should not outlive the
+// process (i.e., they are scoped within a single limiter invocation, or reused
+// across invocations on one thread through `thread_local_buffer`).
 template <size_t VolumeDim>
 class BufferWrapper {
  public:
@@ -67,6 +68,14 @@ class BufferWrapper {
                    VolumeDim>& volume_and_slice_indices{};
 };
 
+// Returns a `BufferWrapper` for the `mesh` that is owned by the calling thread.
+// The buffer is reused by consecutive limiter invocations on the same thread
+// and only reallocated when the mesh changes, so limiting many elements with
+// the same mesh does not allocate. The returned reference is invalidated by the
+// next call on this thread with a different mesh.
+template <size_t VolumeDim>
+BufferWrapper<VolumeDim>& thread_local_buffer(const Mesh<VolumeDim>& mesh);
+
 // In each direction, average the size of all different neighbors in that
 // direction. Note that only the component of neighor_size that is normal
 // to the face is needed (and, therefore, computed).
@@ -46,6 +46,20 @@ bool tvb_minmod_indicator(
         *std::max_element(element_size.begin(), element_size.end());
     return tvb_constant * square(max_h);
   }();
+
+  // Cheap pre-screen: on an LGL mesh the cell mean and the boundary means are
+  // weighted averages of the nodal values with positive weights, so they all
+  // lie within [min(u), max(u)]. If that range fits within the TVB scale, then
+  // every mean-to-boundary difference is below the TVB scale and the minmod
+  // function cannot activate in any direction. This skips the boundary means
+  // for smooth cells. On an LG mesh the boundary values are extrapolated and
+  // may overshoot the nodal values, so the pre-screen does not apply.
+  if (mesh.quadrature() ==
+          make_array<VolumeDim>(Spectral::Quadrature::GaussLobatto) and
+      max(u) - min(u) <= tvb_scale) {
+    return false;
+  }
+
   const double u_mean = mean_value(u, mesh);
 
   const auto difference_to_neighbor =
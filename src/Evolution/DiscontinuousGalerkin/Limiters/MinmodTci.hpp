@@ -56,7 +56,7 @@ bool tvb_minmod_indicator(
     const std::unordered_map<DirectionalId<VolumeDim>, PackagedData,
                              boost::hash<DirectionalId<VolumeDim>>>&
         neighbor_data) {
-  Minmod_detail::BufferWrapper<VolumeDim> buffer(mesh);
+  auto& buffer = Minmod_detail::thread_local_buffer(mesh);
   const auto effective_neighbor_sizes =
       Minmod_detail::compute_effective_neighbor_sizes(element, neighbor_data);
 
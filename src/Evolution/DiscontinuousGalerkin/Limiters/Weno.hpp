@@ -412,7 +412,7 @@ bool Weno<VolumeDim, tmpl::list<Tags...>>::operator()(
 
   } else if (weno_type_ == WenoType::SimpleWeno) {
     // Buffers and pre-computations for TCI
-    Minmod_detail::BufferWrapper<VolumeDim> tci_buffer(mesh);
+    auto& tci_buffer = Minmod_detail::thread_local_buffer(mesh);
     const auto effective_neighbor_sizes =
         Minmod_detail::compute_effective_neighbor_sizes(element, neighbor_data);
 
@@ -32,7 +32,10 @@
 #include "Evolution/Actions/RunEventsAndDenseTriggers.hpp"
 #include "Evolution/Actions/RunEventsAndTriggers.hpp"
 #include "Evolution/ComputeTags.hpp"
+#include "Evolution/Deadlock/PauseHeartbeat.hpp"
 #include "Evolution/Deadlock/PrintDgElementArray.hpp"
+#include "Evolution/Deadlock/RecordHeartbeat.hpp"
+#include "Evolution/Deadlock/Tags.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ApplyBoundaryCorrections.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ComputeTimeDerivative.hpp"
 #include "Evolution/DiscontinuousGalerkin/DgElementArray.hpp"
@@ -390,8 +393,8 @@ struct EvolutionMetavars {
               gh::Tags::GaugeConstraint<DataVector, volume_dim>>,
           ::Tags::PointwiseL2NormCompute<
               gh::Tags::TwoIndexConstraint<DataVector, volume_dim>>,
-          ::Tags::PointwiseL2NormCompute<
-              gh::Tags::ThreeIndexConstraint<DataVector, volume_dim>>,
+          gh::Tags::ThreeIndexConstraintPointwiseL2NormCompute<
+              volume_dim, ::Frame::Inertial>,
           ::domain::Tags::Coordinates<volume_dim, Frame::Grid>,
           ::domain::Tags::Coordinates<volume_dim, Frame::Inertial>>,
       // The 4-index constraint is only implemented in 3d
@@ -533,6 +536,13 @@ struct EvolutionMetavars {
                  Parallel::Phase::Evolve,
                  Parallel::Phase::Exit};
 
+  // Without local time stepping these are filtered as part of the update,
+  // while the variables are still in cache
+  using filtered_tags =
+      tmpl::list<gr::Tags::SpacetimeMetric<DataVector, volume_dim>,
+                 gh::Tags::Pi<DataVector, volume_dim>,
+                 gh::Tags::Phi<DataVector, volume_dim>>;
+
   using step_actions = tmpl::list<
       evolution::dg::Actions::ComputeTimeDerivative<
           volume_dim, system, AllStepChoosers, local_time_stepping,
@@ -545,7 +555,9 @@ struct EvolutionMetavars {
                          evolution::dg::ApplyBoundaryCorrections<
                              local_time_stepping, system, volume_dim, true>>>,
                      evolution::dg::Actions::ApplyLtsBoundaryCorrections<
-                         system, volume_dim, false, use_dg_element_collection>>,
+                         system, volume_dim, false, use_dg_element_collection>,
+                     dg::Actions::Filter<Filters::Exponential<0>,
+                                         filtered_tags>>,
           tmpl::list<
               evolution::dg::Actions::ApplyBoundaryCorrectionsToTimeDerivative<
                   system, volume_dim, false, use_dg_element_collection>,
@@ -554,13 +566,9 @@ struct EvolutionMetavars {
                   ::domain::CheckFunctionsOfTimeAreReadyPostprocessor<
                       volume_dim>>>,
               control_system::Actions::LimitTimeStep<control_systems>,
-              Actions::UpdateU<system>>>,
-      Actions::CleanHistory<system, local_time_stepping>,
-      dg::Actions::Filter<
-          Filters::Exponential<0>,
-          tmpl::list<gr::Tags::SpacetimeMetric<DataVector, volume_dim>,
-                     gh::Tags::Pi<DataVector, volume_dim>,
-                     gh::Tags::Phi<DataVector, volume_dim>>>>;
+              dg::Actions::UpdateUAndFilter<system, Filters::Exponential<0>,
+                                            filtered_tags>>>,
+      Actions::CleanHistory<system, local_time_stepping>>;
 
   using initialization_actions = tmpl::list<
       Initialization::Actions::InitializeItems<
@@ -617,7 +625,9 @@ struct EvolutionMetavars {
               tmpl::list<
                   ::domain::Actions::CheckFunctionsOfTimeAreReady<volume_dim>,
                   evolution::Actions::RunEventsAndTriggers,
-                  Actions::ChangeSlabSize, step_actions, Actions::AdvanceTime,
+                  deadlock::Actions::RecordHeartbeat, Actions::ChangeSlabSize,
+                  step_actions, Actions::AdvanceTime,
+                  deadlock::Actions::PauseHeartbeat,
                   PhaseControl::Actions::ExecutePhaseChange>>>>>;
 
   struct BondiSachs : tt::ConformsTo<intrp::protocols::InterpolationTargetTag> {
@@ -700,7 +710,8 @@ struct EvolutionMetavars {
             SelfStart::Tags::InitialValue<typename system::variables_tag>,
             SelfStart::Tags::InitialValue<Tags::TimeStep>,
             SelfStart::Tags::InitialValue<Tags::Next<Tags::TimeStep>>,
-            evolution::dg::Tags::BoundaryData<volume_dim>>,
+            evolution::dg::Tags::BoundaryData<volume_dim>,
+            deadlock::Tags::HeartbeatRegistration>,
         ::amr::projectors::CopyFromCreatorOrLeaveAsIs<tmpl::push_back<
             typename control_system::Actions::InitializeMeasurements<
                 control_systems>::simple_tags,
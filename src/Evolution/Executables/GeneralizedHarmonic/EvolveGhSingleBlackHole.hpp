@@ -22,7 +22,10 @@
 #include "Domain/FunctionsOfTime/Tags.hpp"
 #include "Domain/Structure/ObjectLabel.hpp"
 #include "Evolution/Actions/RunEventsAndTriggers.hpp"
+#include "Evolution/Deadlock/PauseHeartbeat.hpp"
 #include "Evolution/Deadlock/PrintDgElementArray.hpp"
+#include "Evolution/Deadlock/RecordHeartbeat.hpp"
+#include "Evolution/Deadlock/Tags.hpp"
 #include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
 #include "Evolution/Executables/GeneralizedHarmonic/GeneralizedHarmonicBase.hpp"
 #include "Evolution/Systems/Cce/Callbacks/DumpBondiSachsOnWorldtube.hpp"
@@ -261,7 +264,9 @@ struct EvolutionMetavars : public GeneralizedHarmonicTemplateBase<3, UseLts> {
               tmpl::list<
                   ::domain::Actions::CheckFunctionsOfTimeAreReady<volume_dim>,
                   evolution::Actions::RunEventsAndTriggers,
-                  Actions::ChangeSlabSize, step_actions, Actions::AdvanceTime,
+                  deadlock::Actions::RecordHeartbeat, Actions::ChangeSlabSize,
+                  step_actions, Actions::AdvanceTime,
+                  deadlock::Actions::PauseHeartbeat,
                   PhaseControl::Actions::ExecutePhaseChange>>>>>;
 
   struct amr : tt::ConformsTo<::amr::protocols::AmrMetavariables> {
@@ -285,7 +290,8 @@ struct EvolutionMetavars : public GeneralizedHarmonicTemplateBase<3, UseLts> {
             SelfStart::Tags::InitialValue<typename system::variables_tag>,
             SelfStart::Tags::InitialValue<Tags::TimeStep>,
             SelfStart::Tags::InitialValue<Tags::Next<Tags::TimeStep>>,
-            evolution::dg::Tags::BoundaryData<volume_dim>>,
+            evolution::dg::Tags::BoundaryData<volume_dim>,
+            deadlock::Tags::HeartbeatRegistration>,
         ::amr::projectors::CopyFromCreatorOrLeaveAsIs<tmpl::push_back<
             typename control_system::Actions::InitializeMeasurements<
                 control_systems>::simple_tags,
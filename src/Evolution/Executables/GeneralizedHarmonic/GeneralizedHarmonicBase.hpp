@@ -217,8 +217,8 @@ struct ObserverTags {
               gh::Tags::GaugeConstraint<DataVector, volume_dim>>,
           ::Tags::PointwiseL2NormCompute<
               gh::Tags::TwoIndexConstraint<DataVector, volume_dim>>,
-          ::Tags::PointwiseL2NormCompute<
-              gh::Tags::ThreeIndexConstraint<DataVector, volume_dim>>,
+          gh::Tags::ThreeIndexConstraintPointwiseL2NormCompute<
+              volume_dim, Frame::Inertial>,
           ::domain::Tags::Coordinates<volume_dim, Frame::Grid>,
           ::domain::Tags::Coordinates<volume_dim, Frame::Inertial>>,
       error_tags,
@@ -369,6 +369,13 @@ struct GeneralizedHarmonicTemplateBase {
                  Parallel::Phase::Evolve,
                  Parallel::Phase::Exit};
 
+  // Without local time stepping these are filtered as part of the update,
+  // while the variables are still in cache
+  using filtered_tags =
+      tmpl::list<gr::Tags::SpacetimeMetric<DataVector, volume_dim>,
+                 gh::Tags::Pi<DataVector, volume_dim>,
+                 gh::Tags::Phi<DataVector, volume_dim>>;
+
   template <typename ControlSystems>
   using step_actions = tmpl::list<
       evolution::dg::Actions::ComputeTimeDerivative<
@@ -382,20 +389,18 @@ struct GeneralizedHarmonicTemplateBase {
                          evolution::dg::ApplyBoundaryCorrections<
                              local_time_stepping, system, volume_dim, true>>>,
                      evolution::dg::Actions::ApplyLtsBoundaryCorrections<
-                         system, volume_dim, false, use_dg_element_collection>>,
+                         system, volume_dim, false, use_dg_element_collection>,
+                     dg::Actions::Filter<Filters::Exponential<0>,
+                                         filtered_tags>>,
           tmpl::list<
               evolution::dg::Actions::ApplyBoundaryCorrectionsToTimeDerivative<
                   system, volume_dim, false, use_dg_element_collection>,
               Actions::RecordTimeStepperData<system>,
               evolution::Actions::RunEventsAndDenseTriggers<tmpl::list<>>,
               control_system::Actions::LimitTimeStep<ControlSystems>,
-              Actions::UpdateU<system>>>,
-      Actions::CleanHistory<system, local_time_stepping>,
-      dg::Actions::Filter<
-          Filters::Exponential<0>,
-          tmpl::list<gr::Tags::SpacetimeMetric<DataVector, volume_dim>,
-                     gh::Tags::Pi<DataVector, volume_dim>,
-                     gh::Tags::Phi<DataVector, volume_dim>>>>;
+              dg::Actions::UpdateUAndFilter<system, Filters::Exponential<0>,
+                                            filtered_tags>>>,
+      Actions::CleanHistory<system, local_time_stepping>>;
 
   template <typename DerivedMetavars, bool UseControlSystems>
   using initialization_actions = tmpl::list<
@@ -25,7 +25,6 @@
 #include "Evolution/Actions/RunEventsAndDenseTriggers.hpp"
 #include "Evolution/Actions/RunEventsAndTriggers.hpp"
 #include "Evolution/ComputeTags.hpp"
-#include "Evolution/Conservative/UpdateConservatives.hpp"
 #include "Evolution/Conservative/UpdatePrimitives.hpp"
 #include "Evolution/DgSubcell/Actions/Initialize.hpp"
 #include "Evolution/DgSubcell/Actions/Labels.hpp"
@@ -45,6 +44,7 @@
 #include "Evolution/DgSubcell/Tags/ObserverCoordinates.hpp"
 #include "Evolution/DgSubcell/Tags/ObserverMesh.hpp"
 #include "Evolution/DgSubcell/Tags/ObserverMeshVelocity.hpp"
+#include "Evolution/DgSubcell/Tags/RdmpProjections.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/DgSubcell/TwoMeshRdmpTci.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ApplyBoundaryCorrections.hpp"
@@ -95,6 +95,7 @@
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryConditions/Factory.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/Factory.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/FixConservatives.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/FixPrimitivesAndComputeConservatives.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
@@ -288,10 +289,8 @@ struct GhValenciaDivCleanDefaults {
       Initialization::Actions::AddComputeTags<
           tmpl::list<gr::Tags::SqrtDetSpatialMetricCompute<
               DataVector, volume_dim, domain_frame>>>,
-      VariableFixing::Actions::FixVariables<
-          VariableFixing::FixToAtmosphere<volume_dim>>,
-      VariableFixing::Actions::FixVariables<VariableFixing::LimitLorentzFactor>,
-      Actions::UpdateConservatives,
+      Actions::MutateApply<
+          grmhd::ValenciaDivClean::FixPrimitivesAndComputeConservatives>,
       tmpl::conditional_t<
           UseDgSubcell,
           tmpl::list<
@@ -310,11 +309,8 @@ struct GhValenciaDivCleanDefaults {
                   grmhd::GhValenciaDivClean::subcell::ResizeAndComputePrims<
                       ordered_list_of_primitive_recovery_schemes>>,
 
-              VariableFixing::Actions::FixVariables<
-                  VariableFixing::FixToAtmosphere<volume_dim>>,
-              VariableFixing::Actions::FixVariables<
-                  VariableFixing::LimitLorentzFactor>,
-              Actions::UpdateConservatives,
+              Actions::MutateApply<grmhd::ValenciaDivClean::
+                  FixPrimitivesAndComputeConservatives>,
               Actions::MutateApply<
                   grmhd::GhValenciaDivClean::SetPiAndPhiFromConstraints>>,
           tmpl::list<>>,
@@ -454,8 +450,8 @@ struct GhValenciaDivCleanTemplateBase<
               gh::Tags::GaugeConstraint<DataVector, volume_dim, domain_frame>>,
           ::Tags::PointwiseL2NormCompute<
               gh::Tags::TwoIndexConstraint<DataVector, volume_dim>>,
-          ::Tags::PointwiseL2NormCompute<
-              gh::Tags::ThreeIndexConstraint<DataVector, volume_dim>>,
+          gh::Tags::ThreeIndexConstraintPointwiseL2NormCompute<
+              volume_dim, ::Frame::Inertial>,
           ::Tags::PointwiseL2NormCompute<
               gh::Tags::FourIndexConstraint<DataVector, 3>>,
           gh::Tags::ConstraintEnergyCompute<3, ::Frame::Inertial>,
@@ -501,6 +497,8 @@ struct GhValenciaDivCleanTemplateBase<
       tmpl::conditional_t<
           use_dg_subcell,
           tmpl::list<evolution::dg::subcell::Tags::TciStatusCompute<volume_dim>,
+                     evolution::dg::subcell::Tags::
+                         SkippedRdmpProjectionFractionCompute<volume_dim>,
                      evolution::dg::subcell::Tags::ObserverCoordinatesCompute<
                          volume_dim, Frame::ElementLogical>,
                      evolution::dg::subcell::Tags::ObserverCoordinatesCompute<
@@ -655,6 +653,8 @@ struct GhValenciaDivCleanTemplateBase<
               ::Tags::VariableFixer<grmhd::ValenciaDivClean::FixConservatives>,
               grmhd::ValenciaDivClean::subcell::Tags::TciOptions>,
           tmpl::list<>>,
+      ::Tags::VariableFixer<VariableFixing::FixToAtmosphere<volume_dim>>,
+      ::Tags::VariableFixer<VariableFixing::LimitLorentzFactor>,
       grmhd::ValenciaDivClean::Tags::PrimitiveFromConservativeOptions,
       gh::gauges::Tags::GaugeCondition, initial_data_tag,
       grmhd::ValenciaDivClean::Tags::ConstraintDampingParameter,
@@ -754,10 +754,8 @@ struct GhValenciaDivCleanTemplateBase<
           grmhd::GhValenciaDivClean::subcell::TciOnDgGrid<
               tmpl::front<ordered_list_of_primitive_recovery_schemes>>>,
       Actions::CleanHistory<system, local_time_stepping>,
-      VariableFixing::Actions::FixVariables<
-          VariableFixing::FixToAtmosphere<volume_dim>>,
-      VariableFixing::Actions::FixVariables<VariableFixing::LimitLorentzFactor>,
-      Actions::UpdateConservatives,
+      Actions::MutateApply<
+          grmhd::ValenciaDivClean::FixPrimitivesAndComputeConservatives>,
       Actions::Goto<evolution::dg::subcell::Actions::Labels::EndOfSolvers>,
 
       Actions::Label<evolution::dg::subcell::Actions::Labels::BeginSubcell>,
@@ -787,10 +785,8 @@ struct GhValenciaDivCleanTemplateBase<
       Actions::MutateApply<
           grmhd::GhValenciaDivClean::subcell::ResizeAndComputePrims<
               ordered_list_of_primitive_recovery_schemes>>,
-      VariableFixing::Actions::FixVariables<
-          VariableFixing::FixToAtmosphere<volume_dim>>,
-      VariableFixing::Actions::FixVariables<VariableFixing::LimitLorentzFactor>,
-      Actions::UpdateConservatives,
+      Actions::MutateApply<
+          grmhd::ValenciaDivClean::FixPrimitivesAndComputeConservatives>,
 
       Actions::Label<evolution::dg::subcell::Actions::Labels::EndOfSolvers>>>;
 
@@ -859,11 +855,8 @@ struct GhValenciaDivCleanTemplateBase<
               Parallel::Phase::Evolve,
               tmpl::list<
                   ::domain::Actions::CheckFunctionsOfTimeAreReady<volume_dim>,
-                  VariableFixing::Actions::FixVariables<
-                      VariableFixing::FixToAtmosphere<volume_dim>>,
-                  VariableFixing::Actions::FixVariables<
-                      VariableFixing::LimitLorentzFactor>,
-                  Actions::UpdateConservatives,
+                  Actions::MutateApply<grmhd::ValenciaDivClean::
+                      FixPrimitivesAndComputeConservatives>,
                   evolution::Actions::RunEventsAndTriggers,
                   Actions::ChangeSlabSize, step_actions, Actions::AdvanceTime,
                   PhaseControl::Actions::ExecutePhaseChange>>,
@@ -34,6 +34,7 @@
 #include "Evolution/DgSubcell/Tags/MethodOrder.hpp"
 #include "Evolution/DgSubcell/Tags/ObserverCoordinates.hpp"
 #include "Evolution/DgSubcell/Tags/ObserverMesh.hpp"
+#include "Evolution/DgSubcell/Tags/RdmpProjections.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/DgSubcell/TwoMeshRdmpTci.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ApplyBoundaryCorrections.hpp"
@@ -276,6 +277,8 @@ struct EvolutionMetavars<tmpl::list<InterpolationTargetTags...>,
               use_dg_subcell,
               tmpl::list<
                   evolution::dg::subcell::Tags::TciStatusCompute<volume_dim>,
+                  evolution::dg::subcell::Tags::
+                      SkippedRdmpProjectionFractionCompute<volume_dim>,
                   evolution::dg::subcell::Tags::MethodOrderCompute<volume_dim>>,
               tmpl::list<>>>,
       tmpl::conditional_t<
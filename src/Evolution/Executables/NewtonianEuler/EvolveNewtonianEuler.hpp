@@ -28,6 +28,7 @@
 #include "Evolution/DgSubcell/PrepareNeighborData.hpp"
 #include "Evolution/DgSubcell/Tags/ObserverCoordinates.hpp"
 #include "Evolution/DgSubcell/Tags/ObserverMesh.hpp"
+#include "Evolution/DgSubcell/Tags/RdmpProjections.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ApplyBoundaryCorrections.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ComputeTimeDerivative.hpp"
@@ -161,10 +162,13 @@ struct EvolutionMetavars {
       tmpl::append<
           typename system::variables_tag::tags_list,
           typename system::primitive_variables_tag::tags_list, error_tags,
-          tmpl::conditional_t<use_dg_subcell,
-                              tmpl::list<evolution::dg::subcell::Tags::
-                                             TciStatusCompute<volume_dim>>,
-                              tmpl::list<>>>,
+          tmpl::conditional_t<
+              use_dg_subcell,
+              tmpl::list<evolution::dg::subcell::Tags::TciStatusCompute<
+                             volume_dim>,
+                         evolution::dg::subcell::Tags::
+                             SkippedRdmpProjectionFractionCompute<volume_dim>>,
+              tmpl::list<>>>,
       tmpl::conditional_t<
           use_dg_subcell,
           evolution::dg::subcell::Tags::ObserverCoordinatesCompute<
@@ -26,6 +26,7 @@
 #include "Evolution/DgSubcell/PrepareNeighborData.hpp"
 #include "Evolution/DgSubcell/Tags/ObserverCoordinates.hpp"
 #include "Evolution/DgSubcell/Tags/ObserverMesh.hpp"
+#include "Evolution/DgSubcell/Tags/RdmpProjections.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ApplyBoundaryCorrections.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ComputeTimeDerivative.hpp"
@@ -148,10 +149,13 @@ struct EvolutionMetavars {
   using observe_fields = tmpl::push_back<
       tmpl::append<
           typename system::variables_tag::tags_list, error_tags,
-          tmpl::conditional_t<use_dg_subcell,
-                              tmpl::list<evolution::dg::subcell::Tags::
-                                             TciStatusCompute<volume_dim>>,
-                              tmpl::list<>>>,
+          tmpl::conditional_t<
+              use_dg_subcell,
+              tmpl::list<evolution::dg::subcell::Tags::TciStatusCompute<
+                             volume_dim>,
+                         evolution::dg::subcell::Tags::
+                             SkippedRdmpProjectionFractionCompute<volume_dim>>,
+              tmpl::list<>>>,
       tmpl::conditional_t<
           use_dg_subcell,
           evolution::dg::subcell::Tags::ObserverCoordinatesCompute<
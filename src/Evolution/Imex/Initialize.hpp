@@ -5,6 +5,7 @@
 
 #include "Evolution/Imex/Protocols/ImexSystem.hpp"
 #include "Evolution/Imex/Tags/ImplicitHistory.hpp"
+#include "Evolution/Imex/Tags/JacobianEvaluations.hpp"
 #include "Evolution/Imex/Tags/Mode.hpp"
 #include "Evolution/Imex/Tags/SolveFailures.hpp"
 #include "Evolution/Imex/Tags/SolveTolerance.hpp"
@@ -32,7 +33,8 @@ struct Initialize<System, tmpl::list<Sectors...>> {
   using mutable_global_cache_tags = tmpl::list<>;
   using simple_tags_from_options = tmpl::list<>;
   using simple_tags = tmpl::list<Tags::ImplicitHistory<Sectors>...,
-                                 Tags::SolveFailures<Sectors>...>;
+                                 Tags::SolveFailures<Sectors>...,
+                                 Tags::JacobianEvaluations<Sectors>...>;
   using compute_tags = tmpl::list<>;
 
   using return_tags = simple_tags;
@@ -44,6 +46,8 @@ struct Initialize<System, tmpl::list<Sectors...>> {
           typename Tags::ImplicitHistory<Sectors>::type*>... histories,
       const gsl::not_null<
           typename Tags::SolveFailures<Sectors>::type*>... solve_failures,
+      const gsl::not_null<typename Tags::JacobianEvaluations<
+          Sectors>::type*>... jacobian_evaluations,
       const TimeSteppers::History<typename System::variables_tag::type>&
           explicit_history,
       const typename example_tensor_tag::type& example_tensor) {
@@ -51,6 +55,8 @@ struct Initialize<System, tmpl::list<Sectors...>> {
     expand_pack((histories->integration_order(order), 0)...);
     expand_pack(*solve_failures = make_with_value<Scalar<DataVector>>(
                     example_tensor, 0.0)...);
+    expand_pack(*jacobian_evaluations = make_with_value<Scalar<DataVector>>(
+                    example_tensor, 0.0)...);
   }
 };
 /// \endcond
@@ -31,6 +31,8 @@ class History;
 namespace imex::Tags {
 template <typename ImplicitSector>
 struct ImplicitHistory;
+template <typename Sector>
+struct JacobianEvaluations;
 struct Mode;
 template <typename Sector>
 struct SolveFailures;
@@ -55,6 +57,10 @@ using ForwardTuple = tmpl::wrap<
 /// variables used for the explicit portion of the time derivative,
 /// which may still undergo variable-fixing-like corrections.
 ///
+/// The number of evaluations of the Jacobian at each point is stored
+/// in `imex::Tags::JacobianEvaluations` as a measure of the cost of
+/// the solve.
+///
 /// \warning
 /// This will use the value of `::Tags::Time` from the DataBox.  Most
 /// of the time, the value appropriate for evaluating the explicit RHS
@@ -91,6 +97,7 @@ struct SolveImplicitSector {
   static void apply_impl(
       gsl::not_null<SystemVariables*> system_variables,
       gsl::not_null<Scalar<DataVector>*> solve_failures,
+      gsl::not_null<Scalar<DataVector>*> jacobian_evaluations,
       const ImexTimeStepper& time_stepper, const TimeDelta& time_step,
       const TimeSteppers::History<SectorVariables>& implicit_history,
       Mode implicit_solve_mode, double implicit_solve_tolerance,
@@ -98,7 +105,8 @@ struct SolveImplicitSector {
 
  public:
   using return_tags =
-      tmpl::list<SystemVariablesTag, Tags::SolveFailures<ImplicitSector>>;
+      tmpl::list<SystemVariablesTag, Tags::SolveFailures<ImplicitSector>,
+                 Tags::JacobianEvaluations<ImplicitSector>>;
   using argument_tags = tmpl::append<
       tmpl::list<::Tags::TimeStepper<ImexTimeStepper>, ::Tags::TimeStep,
                  imex::Tags::ImplicitHistory<ImplicitSector>, Tags::Mode,
@@ -109,12 +117,14 @@ struct SolveImplicitSector {
   static void apply(
       const gsl::not_null<SystemVariables*> system_variables,
       const gsl::not_null<Scalar<DataVector>*> solve_failures,
+      const gsl::not_null<Scalar<DataVector>*> jacobian_evaluations,
       const ImexTimeStepper& time_stepper, const TimeDelta& time_step,
       const TimeSteppers::History<SectorVariables>& implicit_history,
       const Mode implicit_solve_mode, const double implicit_solve_tolerance,
       const ForwardArgs&... forward_args) {
-    apply_impl(system_variables, solve_failures, time_stepper, time_step,
-               implicit_history, implicit_solve_mode, implicit_solve_tolerance,
+    apply_impl(system_variables, solve_failures, jacobian_evaluations,
+               time_stepper, time_step, implicit_history, implicit_solve_mode,
+               implicit_solve_tolerance,
                std::forward_as_tuple(forward_args...));
   }
 };
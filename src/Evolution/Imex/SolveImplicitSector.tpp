@@ -253,6 +253,10 @@ class ImplicitSolver {
         make_not_null(&solve_box_));
   }
 
+  /// The number of calls to `jacobian` since the last call to
+  /// `set_index`.
+  size_t jacobian_evaluations() const { return jacobian_evaluations_; }
+
   void set_index(const size_t index) {
     db::mutate<SolverPointIndex>(
         [&index](const gsl::not_null<size_t*> box_index) {
@@ -264,6 +268,7 @@ class ImplicitSolver {
                   implicit_equation_->inhomogeneous_terms(), index);
 
     completed_mutators_ = decltype(completed_mutators_){};
+    jacobian_evaluations_ = 0;
   }
 
   std::array<double, solve_dimension> operator()(
@@ -287,6 +292,7 @@ class ImplicitSolver {
       const std::array<double, solve_dimension>& sector_variables_array) const {
     ASSERT(implicit_equation_->implicit_weight() != 0.0,
            "Should not be performing solves on explicit substeps");
+    ++jacobian_evaluations_;
     set_sector_variables(sector_variables_array);
     run_mutators<tmpl::push_back<typename SolveAttempt::jacobian_prep,
                                  typename SolveAttempt::jacobian>>();
@@ -401,6 +407,8 @@ class ImplicitSolver {
   mutable tuples::tagged_tuple_from_typelist<
       tmpl::transform<all_mutators, tmpl::bind<RanMutator, tmpl::_1>>>
       completed_mutators_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t jacobian_evaluations_{0};
 };
 }  // namespace solve_implicit_sector_detail
 
@@ -408,11 +416,13 @@ template <typename SystemVariablesTag, typename ImplicitSector>
 void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
     const gsl::not_null<SystemVariables*> system_variables,
     const gsl::not_null<Scalar<DataVector>*> solve_failures,
+    const gsl::not_null<Scalar<DataVector>*> jacobian_evaluations,
     const ImexTimeStepper& time_stepper, const TimeDelta& time_step,
     const TimeSteppers::History<SectorVariables>& implicit_history,
     const Mode implicit_solve_mode, const double implicit_solve_tolerance,
     const EvolutionDataTuple& joined_evolution_data) {
   get(*solve_failures) = 0.0;
+  get(*jacobian_evaluations) = 0.0;
 
   const auto evolution_data = split_tuple<
       tmpl::transform<evolution_data_tags, tmpl::bind<tmpl::size, tmpl::_1>>>(
@@ -469,6 +479,10 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
       SectorVariables pointwise_vars(pointwise_vars_array.data(),
                                      pointwise_vars_array.size());
       solver.set_index(point);
+      const auto record_jacobian_evaluations = [&]() {
+        get(*jacobian_evaluations)[point] +=
+            static_cast<double>(solver.jacobian_evaluations());
+      };
       std::array<double, solve_dimension> initial_guess;
       {
         SectorVariables guess_vars(initial_guess.data(), initial_guess.size());
@@ -488,6 +502,7 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
                 max_iterations);
           } catch (const convergence_error&) {
             if constexpr (have_fallback) {
+              record_jacobian_evaluations();
               ++get(*solve_failures)[point];
               solve_succeeded = false;
               continue;
@@ -518,6 +533,7 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
               ERROR("LAPACK invalid argument: " << -lapack_info);
             } else {
               if constexpr (have_fallback) {
+                record_jacobian_evaluations();
                 ++get(*solve_failures)[point];
                 solve_succeeded = false;
                 continue;
@@ -534,6 +550,8 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
           ERROR("Invalid implicit mode");
       }
 
+      record_jacobian_evaluations();
+
       // Write the result into the evolution variables.
       auto sector_reference = system_variables->template reference_subset<
           typename SectorVariables::tags_list>();
@@ -0,0 +1,27 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/PrettyType.hpp"
+
+namespace imex::Tags {
+/*!
+ * Tag for a count of the evaluations of the implicit Jacobian at each
+ * point during the most recent solve, summed over all solve attempts.
+ * A value of 0 means no solve was needed.  Each iteration of the
+ * nonlinear solve evaluates the Jacobian once, so this measures the
+ * cost of the solve and can be used to tune the initial guess and the
+ * solve tolerance.
+ */
+template <typename Sector>
+struct JacobianEvaluations : db::SimpleTag {
+  static std::string name() {
+    return "JacobianEvaluations(" + pretty_type::name<Sector>() + ")";
+  }
+  using type = Scalar<DataVector>;
+};
+}  // namespace imex::Tags
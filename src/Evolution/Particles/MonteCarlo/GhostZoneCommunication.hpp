@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <optional>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -137,7 +141,7 @@ struct GhostDataMcPackets {
         const Side side = max_distance_direction.value().side();
         packet.coordinates.get(d) += (side == Side::Lower) ? (2.0) : (-2.0);
         if (output.contains(max_distance_direction.value())) {
-          output[max_distance_direction.value()].push_back(packet);
+          output[max_distance_direction.value()].push_back(std::move(packet));
         }
         std::swap((*packets)[p], (*packets)[n_packets - 1]);
         packets->pop_back();
@@ -199,7 +203,7 @@ struct SendDataForMcCommunication {
         CommStep == Particles::MonteCarlo::CommunicationStep::PreStep
             ? db::mutate_apply(GhostDataMutatorPreStep{}, make_not_null(&box))
             : DataVector{};
-    const DirectionMap<Dim, DataVector> all_sliced_data =
+    DirectionMap<Dim, DataVector> all_sliced_data =
         CommStep == Particles::MonteCarlo::CommunicationStep::PreStep
             ? evolution::dg::subcell::slice_data(
                   volume_data_to_slice, subcell_mesh.extents(), ghost_zone_size,
@@ -208,7 +212,7 @@ struct SendDataForMcCommunication {
                               InterpolatorsFromFdToNeighborFd<Dim>>(box))
             : DirectionMap<Dim, DataVector>{};
 
-    const DirectionMap<Dim, std::vector<Particles::MonteCarlo::Packet>>
+    DirectionMap<Dim, std::vector<Particles::MonteCarlo::Packet>>
         all_packets_ghost_zone =
             CommStep == Particles::MonteCarlo::CommunicationStep::PostStep
                 ? db::mutate_apply(GhostDataMcPackets<Dim>{},
@@ -224,26 +228,38 @@ struct SendDataForMcCommunication {
          element.neighbors()) {
       const auto& orientation = neighbors_in_direction.orientation();
       const auto direction_from_neighbor = orientation(direction.opposite());
+      size_t neighbors_left = neighbors_in_direction.size();
       for (const ElementId<Dim>& neighbor : neighbors_in_direction) {
+        // The data for the last neighbor in a direction is moved into the
+        // message instead of copied, so with one neighbor per direction
+        // nothing is copied
+        const bool last_neighbor_in_direction = --neighbors_left == 0;
         std::optional<std::vector<Particles::MonteCarlo::Packet>>
             packets_to_send = std::nullopt;
         DataVector subcell_data_to_send{};
 
         if (CommStep == Particles::MonteCarlo::CommunicationStep::PreStep) {
-          const auto& sliced_data_in_direction = all_sliced_data.at(direction);
-          subcell_data_to_send = DataVector{sliced_data_in_direction.size()};
-          std::copy(sliced_data_in_direction.begin(),
-                    sliced_data_in_direction.end(),
-                    subcell_data_to_send.begin());
+          auto& sliced_data_in_direction = all_sliced_data.at(direction);
+          if (last_neighbor_in_direction) {
+            subcell_data_to_send = std::move(sliced_data_in_direction);
+          } else {
+            subcell_data_to_send = DataVector{sliced_data_in_direction.size()};
+            std::copy(sliced_data_in_direction.begin(),
+                      sliced_data_in_direction.end(),
+                      subcell_data_to_send.begin());
+          }
         }
         if (CommStep == Particles::MonteCarlo::CommunicationStep::PostStep) {
-          packets_to_send = all_packets_ghost_zone.at(direction);
-          if (packets_to_send.value().empty()) {
-            packets_to_send = std::nullopt;
+          auto& packets_in_direction = all_packets_ghost_zone.at(direction);
+          if (not packets_in_direction.empty()) {
+            packets_to_send = last_neighbor_in_direction
+                                  ? std::move(packets_in_direction)
+                                  : packets_in_direction;
           }
         }
 
-        McGhostZoneData<Dim> data{subcell_data_to_send, packets_to_send};
+        McGhostZoneData<Dim> data{std::move(subcell_data_to_send),
+                                  std::move(packets_to_send)};
 
         Parallel::receive_data<
             Particles::MonteCarlo::McGhostZoneDataInboxTag<Dim, CommStep>>(
@@ -363,7 +379,7 @@ struct ReceiveDataForMcCommunication {
                  element.neighbors()) {
               for (const auto& neighbor : neighbors_in_direction) {
                 DirectionalId<Dim> directional_element_id{direction, neighbor};
-                const std::optional<std::vector<Particles::MonteCarlo::Packet>>&
+                std::optional<std::vector<Particles::MonteCarlo::Packet>>&
                     received_data_packets =
                         received_data[directional_element_id]
                             .packets_entering_this_element;
@@ -373,10 +389,12 @@ struct ReceiveDataForMcCommunication {
                 if (received_data_packets == std::nullopt) {
                   continue;
                 } else {
-                  const size_t n_packets = received_data_packets.value().size();
-                  for (size_t p = 0; p < n_packets; p++) {
-                    packet_list->push_back(received_data_packets.value()[p]);
-                  }
+                  packet_list->insert(
+                      packet_list->end(),
+                      std::make_move_iterator(
+                          received_data_packets.value().begin()),
+                      std::make_move_iterator(
+                          received_data_packets.value().end()));
                 }
               }
             }
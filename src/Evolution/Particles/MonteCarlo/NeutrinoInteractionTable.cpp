@@ -3,10 +3,13 @@
 
 #include "Evolution/Particles/MonteCarlo/NeutrinoInteractionTable.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <hdf5.h>
 #include <string>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -17,7 +20,9 @@
 #include "IO/H5/OpenGroup.hpp"
 #include "IO/H5/Wrappers.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 
 using hydro::units::cgs::length_unit;
 using hydro::units::cgs::mass_unit;
@@ -301,56 +306,80 @@ void NeutrinoInteractionTable<EnergyBins, NeutrinoSpecies>::
         const Scalar<DataVector>& rest_mass_density,
         const Scalar<DataVector>& temperature,
         const double& minimum_temperature) const {
+  constexpr size_t number_of_variables = 3 * EnergyBins * NeutrinoSpecies;
+  const size_t number_of_points = get(electron_fraction).size();
   const size_t n_rho_points = table_log_density.size();
   const size_t n_temp_points = table_log_temperature.size();
   const size_t n_ye_points = table_electron_fraction.size();
-  double temperature_correction_factor = 0.0;
 
-  double ye = 0.0;
-  double log_rho = 0.0;
-  double log_temp = 0.0;
-  for (size_t p = 0; p < get(electron_fraction).size(); p++) {
-    ye = get(electron_fraction)[p];
-    log_rho = log(get(rest_mass_density)[p]);
-    log_temp = get(temperature)[p] > minimum_temperature
-                   ? log(get(temperature)[p])
-                   : log(minimum_temperature);
-    temperature_correction_factor =
-        get(temperature)[p] > minimum_temperature
-            ? 1.0
-            : get(temperature)[p] / minimum_temperature;
+  // Table coordinates of all points, clamped to the table bounds
+  DataVector log_rho{number_of_points};
+  DataVector log_temp{number_of_points};
+  DataVector ye{number_of_points};
+  // Powers of the correction factor T / minimum_temperature for points below
+  // the minimum temperature. Emissivities scale as T^6 and opacities as T^4.
+  DataVector emissivity_correction{number_of_points};
+  DataVector opacity_correction{number_of_points};
+  bool needs_temperature_correction = false;
+  for (size_t p = 0; p < number_of_points; p++) {
+    const double temp = get(temperature)[p];
+    const double temperature_correction_factor =
+        temp > minimum_temperature ? 1.0 : temp / minimum_temperature;
+    needs_temperature_correction |= temp <= minimum_temperature;
+    emissivity_correction[p] = square(cube(temperature_correction_factor));
+    opacity_correction[p] = square(square(temperature_correction_factor));
 
-    ye = std::clamp(ye, table_electron_fraction[0],
-                    table_electron_fraction[n_ye_points - 1]);
-    log_rho = std::clamp(log_rho, table_log_density[0],
-                         table_log_density[n_rho_points - 1]);
-    log_temp = std::clamp(log_temp, table_log_temperature[0],
-                          table_log_temperature[n_temp_points - 1]);
-
-    const auto weights = interpolator_.get_weights(log_rho, log_temp, ye);
+    ye[p] = std::clamp(get(electron_fraction)[p], table_electron_fraction[0],
+                       table_electron_fraction[n_ye_points - 1]);
+    log_rho[p] = std::clamp(log(get(rest_mass_density)[p]),
+                            table_log_density[0],
+                            table_log_density[n_rho_points - 1]);
+    log_temp[p] = std::clamp(log(std::max(temp, minimum_temperature)),
+                             table_log_temperature[0],
+                             table_log_temperature[n_temp_points - 1]);
+  }
 
+  // Interpolate all variables at once, vectorized over the points. The
+  // variables are ordered as emissivity, absorption and scattering, each with
+  // the energy bins varying fastest.
+  std::array<gsl::span<double>, number_of_variables> results{};
+  for (size_t ns = 0; ns < NeutrinoSpecies; ns++) {
     for (size_t ng = 0; ng < EnergyBins; ng++) {
-      for (size_t ns = 0; ns < NeutrinoSpecies; ns++) {
-        gsl::at(gsl::at(*emissivity_in_cell, ns), ng)[p] =
-            interpolator_.interpolate(weights, ns * EnergyBins + ng);
-        gsl::at(gsl::at(*absorption_opacity, ns), ng)[p] =
-            interpolator_.interpolate(
-                weights, ns * EnergyBins + ng + EnergyBins * NeutrinoSpecies);
-        gsl::at(gsl::at(*scattering_opacity, ns), ng)[p] =
-            interpolator_.interpolate(
-                weights,
-                ns * EnergyBins + ng + EnergyBins * NeutrinoSpecies * 2);
-      }
+      const size_t variable = ns * EnergyBins + ng;
+      gsl::at(gsl::at(*emissivity_in_cell, ns), ng)
+          .destructive_resize(number_of_points);
+      gsl::at(gsl::at(*absorption_opacity, ns), ng)
+          .destructive_resize(number_of_points);
+      gsl::at(gsl::at(*scattering_opacity, ns), ng)
+          .destructive_resize(number_of_points);
+      gsl::at(results, variable) = gsl::make_span(
+          gsl::at(gsl::at(*emissivity_in_cell, ns), ng).data(),
+          number_of_points);
+      gsl::at(results, variable + EnergyBins * NeutrinoSpecies) =
+          gsl::make_span(gsl::at(gsl::at(*absorption_opacity, ns), ng).data(),
+                         number_of_points);
+      gsl::at(results, variable + 2 * EnergyBins * NeutrinoSpecies) =
+          gsl::make_span(gsl::at(gsl::at(*scattering_opacity, ns), ng).data(),
+                         number_of_points);
     }
-    // Apply corrections for low-temperature points.
-    for (size_t ng = 0; ng < EnergyBins; ng++) {
-      for (size_t ns = 0; ns < NeutrinoSpecies; ns++) {
-        gsl::at(gsl::at(*emissivity_in_cell, ns), ng)[p] *=
-            square(cube(temperature_correction_factor));
-        gsl::at(gsl::at(*absorption_opacity, ns), ng)[p] *=
-            square(square(temperature_correction_factor));
-        gsl::at(gsl::at(*scattering_opacity, ns), ng)[p] *=
-            square(square(temperature_correction_factor));
+  }
+  [this, &results, &log_rho, &log_temp, &ye]<size_t... Variables>(
+      std::index_sequence<Variables...> /*meta*/) {
+    interpolator_.template interpolate<Variables...>(
+        make_not_null(&results),
+        {{gsl::make_span(log_rho.data(), log_rho.size()),
+          gsl::make_span(log_temp.data(), log_temp.size()),
+          gsl::make_span(ye.data(), ye.size())}});
+  }(std::make_index_sequence<number_of_variables>{});
+
+  // Apply corrections for low-temperature points.
+  if (needs_temperature_correction) {
+    for (size_t ns = 0; ns < NeutrinoSpecies; ns++) {
+      for (size_t ng = 0; ng < EnergyBins; ng++) {
+        gsl::at(gsl::at(*emissivity_in_cell, ns), ng) *=
+            emissivity_correction;
+        gsl::at(gsl::at(*absorption_opacity, ns), ng) *= opacity_correction;
+        gsl::at(gsl::at(*scattering_opacity, ns), ng) *= opacity_correction;
       }
     }
   }
@@ -44,6 +44,9 @@ class NeutrinoInteractionTable : public PUP::able {
 
   /// Interpolate interaction rates to given values of density,
   /// temperature and electron fraction.
+  ///
+  /// All species and energy bins are interpolated in a single pass over the
+  /// table, vectorized over the points.
   void get_neutrino_matter_interactions(
       gsl::not_null<
           std::array<std::array<DataVector, EnergyBins>, NeutrinoSpecies>*>
@@ -3,6 +3,13 @@
 
 #include "Evolution/Particles/MonteCarlo/Packet.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
 namespace Particles::MonteCarlo {
 
 void Packet::pup(PUP::er& p) {
@@ -48,4 +55,35 @@ double compute_fluid_frame_energy(
   return fluid_frame_energy;
 }
 
+void sort_packets_by_cell(const gsl::not_null<std::vector<Packet>*> packets) {
+  const auto by_cell = [](const Packet& lhs, const Packet& rhs) {
+    return lhs.index_of_closest_grid_point < rhs.index_of_closest_grid_point;
+  };
+  if (std::is_sorted(packets->begin(), packets->end(), by_cell)) {
+    return;
+  }
+  const size_t number_of_cells =
+      std::max_element(packets->begin(), packets->end(), by_cell)
+          ->index_of_closest_grid_point +
+      1;
+  // Offset of the first packet of each cell in the sorted vector
+  std::vector<size_t> offsets(number_of_cells + 1, 0);
+  for (const Packet& packet : *packets) {
+    ++offsets[packet.index_of_closest_grid_point + 1];
+  }
+  for (size_t cell = 0; cell < number_of_cells; ++cell) {
+    offsets[cell + 1] += offsets[cell];
+  }
+  std::vector<size_t> sorted_index(packets->size());
+  for (size_t p = 0; p < packets->size(); ++p) {
+    sorted_index[offsets[(*packets)[p].index_of_closest_grid_point]++] = p;
+  }
+  std::vector<Packet> sorted_packets{};
+  sorted_packets.reserve(packets->size());
+  for (const size_t p : sorted_index) {
+    sorted_packets.push_back(std::move((*packets)[p]));
+  }
+  *packets = std::move(sorted_packets);
+}
+
 }  // namespace Particles::MonteCarlo
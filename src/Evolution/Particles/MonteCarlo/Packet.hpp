@@ -118,4 +118,16 @@ double compute_fluid_frame_energy(
     const Scalar<DataVector>& lapse,
     const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric);
 
+/*!
+ * \brief Reorder the packets so that packets in the same cell are adjacent
+ *
+ * \details The packets are sorted by `Packet::index_of_closest_grid_point`,
+ * keeping the relative order of the packets within each cell. Propagating the
+ * packets in this order reads the fluid variables and opacities of each cell
+ * from contiguous memory instead of jumping around the grid. Packets move
+ * slowly between cells, so the sort is a counting sort in `O(N + number of
+ * cells)` and returns early when the packets are already in order.
+ */
+void sort_packets_by_cell(gsl::not_null<std::vector<Packet>*> packets);
+
 }  // namespace Particles::MonteCarlo
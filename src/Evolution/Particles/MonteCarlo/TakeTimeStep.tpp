@@ -10,6 +10,7 @@
 #include "Domain/Structure/DirectionalIdMap.hpp"
 #include "Evolution/Particles/MonteCarlo/CellVolume.hpp"
 #include "Evolution/Particles/MonteCarlo/NeutrinoInteractionTable.hpp"
+#include "Evolution/Particles/MonteCarlo/Packet.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -216,7 +217,9 @@ void TemplatedLocalFunctions<EnergyBins, NeutrinoSpecies>::
       lorentz_factor, lower_spatial_four_velocity, inertial_to_fluid_jacobian,
       inertial_to_fluid_inverse_jacobian, cell_proper_four_volume);
 
-  // Propagate packets
+  // Propagate packets cell by cell, so that the fluid data of each cell is
+  // read from contiguous memory
+  sort_packets_by_cell(packets);
   evolve_packets(
       packets, random_number_generator,
       &coupling_tilde_tau, &coupling_tilde_s, &coupling_rho_ye,
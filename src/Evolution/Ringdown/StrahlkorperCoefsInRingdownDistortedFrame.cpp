@@ -5,6 +5,7 @@
 #include <array>
 #include <cstddef>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/Matrix.hpp"
@@ -78,15 +79,16 @@ std::vector<DataVector> strahlkorper_coefs_in_ringdown_distorted_frame(
   const auto temporary_domain = domain_creator.create_domain();
   const auto functions_of_time = domain_creator.functions_of_time();
 
-  // Loop over the selected horizons, transforming each to the
-  // ringdown distorted frame
+  // Transform the selected horizons to the ringdown distorted frame in one
+  // pass, so the work shared by successive horizons is done only once
+  std::vector<ylm::Strahlkorper<Frame::Distorted>> ahc_ringdown_distorted{};
+  strahlkorpers_in_different_frame(make_not_null(&ahc_ringdown_distorted),
+                                   ahc_inertial_h5, ahc_times, temporary_domain,
+                                   functions_of_time);
   std::vector<DataVector> ahc_ringdown_distorted_coefs{};
-  ylm::Strahlkorper<Frame::Distorted> current_ahc;
-  for (size_t i = 0; i < requested_number_of_times_from_end; ++i) {
-    strahlkorper_in_different_frame(
-        make_not_null(&current_ahc), gsl::at(ahc_inertial_h5, i),
-        temporary_domain, functions_of_time, gsl::at(ahc_times, i));
-    ahc_ringdown_distorted_coefs.push_back(current_ahc.coefficients());
+  ahc_ringdown_distorted_coefs.reserve(ahc_ringdown_distorted.size());
+  for (auto& ahc : ahc_ringdown_distorted) {
+    ahc_ringdown_distorted_coefs.push_back(std::move(ahc.coefficients()));
   }
 
   return ahc_ringdown_distorted_coefs;
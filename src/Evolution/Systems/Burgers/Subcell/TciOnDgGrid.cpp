@@ -17,17 +17,22 @@ std::tuple<bool, evolution::dg::subcell::RdmpTciData> TciOnDgGrid::apply(
     const Mesh<1>& subcell_mesh,
     const evolution::dg::subcell::RdmpTciData& past_rdmp_tci_data,
     const evolution::dg::subcell::SubcellOptions& subcell_options,
-    double persson_exponent, [[maybe_unused]] const bool element_stays_on_dg) {
-  // Don't use buffer since we have only one memory allocation right now (until
-  // persson_tci can use a buffer)
-  const Scalar<DataVector> subcell_u{::evolution::dg::subcell::fd::project(
-      get(dg_u), dg_mesh, subcell_mesh.extents())};
-
+    double persson_exponent, [[maybe_unused]] const bool element_stays_on_dg,
+    const bool rdmp_needs_projection) {
   using std::max;
   using std::min;
-  evolution::dg::subcell::RdmpTciData rdmp_tci_data{
-      {max(max(get(dg_u)), max(get(subcell_u)))},
-      {min(min(get(dg_u)), min(get(subcell_u)))}};
+  evolution::dg::subcell::RdmpTciData rdmp_tci_data{{max(get(dg_u))},
+                                                    {min(get(dg_u))}};
+  if (rdmp_needs_projection) {
+    // Don't use buffer since we have only one memory allocation right now
+    // (until persson_tci can use a buffer)
+    const DataVector subcell_u = ::evolution::dg::subcell::fd::project(
+        get(dg_u), dg_mesh, subcell_mesh.extents());
+    rdmp_tci_data.max_variables_values[0] =
+        max(rdmp_tci_data.max_variables_values[0], max(subcell_u));
+    rdmp_tci_data.min_variables_values[0] =
+        min(rdmp_tci_data.min_variables_values[0], min(subcell_u));
+  }
 
   const bool cell_is_troubled =
       static_cast<bool>(evolution::dg::subcell::rdmp_tci(
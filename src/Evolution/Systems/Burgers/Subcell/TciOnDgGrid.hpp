@@ -26,7 +26,9 @@ namespace Burgers::subcell {
  * \brief The troubled-cell indicator run on the DG grid to check if the
  * solution is admissible.
  *
- * Applies the Persson and RDMP TCI to \f$U\f$.
+ * Applies the Persson and RDMP TCI to \f$U\f$. The candidate solution is
+ * only projected to the subcells for the RDMP TCI if `rdmp_needs_projection`
+ * is `true`, see `evolution::dg::subcell::Actions::TciAndRollback`.
  */
 struct TciOnDgGrid {
  public:
@@ -42,6 +44,7 @@ struct TciOnDgGrid {
       const Mesh<1>& subcell_mesh,
       const evolution::dg::subcell::RdmpTciData& past_rdmp_tci_data,
       const evolution::dg::subcell::SubcellOptions& subcell_options,
-      double persson_exponent, bool element_stays_on_dg);
+      double persson_exponent, bool element_stays_on_dg,
+      bool rdmp_needs_projection);
 };
 }  // namespace Burgers::subcell
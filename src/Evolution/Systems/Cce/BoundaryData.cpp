@@ -3,9 +3,13 @@
 
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 
+#include <array>
+#include <complex>
 #include <cstddef>
+#include <deque>
 
 #include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
@@ -13,13 +17,51 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "DataStructures/Variables.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshDerivatives.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
 #include "Utilities/ErrorHandling/CaptureForError.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
 
 namespace Cce {
+namespace {
+// Inverse transform the real parts of several sets of single-shell modes in a
+// single libsharp job by packing them as consecutive radial shells.
+template <size_t NumberOfTransforms>
+void real_inverse_transforms(
+    const gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
+        interpolation_modal_buffer,
+    const std::array<DataVector*, NumberOfTransforms>& results,
+    const std::array<const ComplexModalVector*, NumberOfTransforms>&
+        coefficients,
+    const size_t l_max) {
+  const size_t number_of_modes =
+      Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max);
+  const size_t number_of_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  auto& modal_buffer = get(*interpolation_modal_buffer).data();
+  modal_buffer.destructive_resize(NumberOfTransforms * number_of_modes);
+  for (size_t i = 0; i < NumberOfTransforms; ++i) {
+    ComplexModalVector shell_modes{modal_buffer.data() + i * number_of_modes,
+                                   number_of_modes};
+    shell_modes = *gsl::at(coefficients, i);
+  }
+  // Allocation
+  const auto interpolated = Spectral::Swsh::inverse_swsh_transform(
+      l_max, NumberOfTransforms, get(*interpolation_modal_buffer));
+  for (size_t i = 0; i < NumberOfTransforms; ++i) {
+    // clang-tidy: const-cast for a non-owning view of const data
+    const ComplexDataVector shell_values{
+        const_cast<std::complex<double>*>(  // NOLINT
+            interpolated.data().data() + i * number_of_points),
+        number_of_points};
+    *gsl::at(results, i) = real(shell_values);
+  }
+}
+}  // namespace
 
 void trigonometric_functions_on_swsh_collocation(
     const gsl::not_null<Scalar<DataVector>*> cos_phi,
@@ -99,6 +141,37 @@ void cartesian_to_spherical_coordinates_and_jacobians(
   get<2, 2>(*inverse_cartesian_to_spherical_jacobian) = 0.0;
 }
 
+WorldtubeAngularGeometry::WorldtubeAngularGeometry(
+    const size_t l_max_in, const double extraction_radius_in)
+    : l_max(l_max_in), extraction_radius(extraction_radius_in) {
+  trigonometric_functions_on_swsh_collocation(
+      make_not_null(&cos_phi), make_not_null(&cos_theta),
+      make_not_null(&sin_phi), make_not_null(&sin_theta), l_max);
+  cartesian_to_spherical_coordinates_and_jacobians(
+      make_not_null(&unit_cartesian_coords),
+      make_not_null(&cartesian_to_spherical_jacobian),
+      make_not_null(&inverse_cartesian_to_spherical_jacobian), cos_phi,
+      cos_theta, sin_phi, sin_theta, extraction_radius);
+}
+
+const WorldtubeAngularGeometry& cached_worldtube_angular_geometry(
+    const size_t l_max, const double extraction_radius) {
+  // Inserting and removing at the ends of a `std::deque` doesn't invalidate
+  // references to the other entries
+  constexpr size_t maximum_cached_geometries = 8;
+  thread_local std::deque<WorldtubeAngularGeometry> cache{};
+  for (const auto& geometry : cache) {
+    if (geometry.l_max == l_max and
+        geometry.extraction_radius == extraction_radius) {
+      return geometry;
+    }
+  }
+  if (cache.size() == maximum_cached_geometries) {
+    cache.pop_back();
+  }
+  return cache.emplace_front(l_max, extraction_radius);
+}
+
 void cartesian_spatial_metric_and_derivatives_from_modes(
     const gsl::not_null<tnsr::ii<DataVector, 3>*> cartesian_spatial_metric,
     const gsl::not_null<tnsr::II<DataVector, 3>*>
@@ -121,40 +194,34 @@ void cartesian_spatial_metric_and_derivatives_from_modes(
   set_number_of_grid_points(dt_cartesian_spatial_metric, size);
 
   set_number_of_grid_points(interpolation_buffer, size);
-  set_number_of_grid_points(interpolation_modal_buffer, size);
   set_number_of_grid_points(eth_buffer, size);
 
   // Allocation
   SphericaliCartesianjj spherical_d_cartesian_spatial_metric{size};
 
+  // interpolate the value and derivatives of all components at once
+  std::array<DataVector*, 18> interpolated{};
+  std::array<const ComplexModalVector*, 18> coefficients{};
+  size_t transform_index = 0;
   for (size_t i = 0; i < 3; ++i) {
     for (size_t j = i; j < 3; ++j) {
-      // copy the modes to a spin-weighted type for interpolation
-      get(*interpolation_modal_buffer).data() =
-          spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      cartesian_spatial_metric->get(i, j) =
-          real(get(*interpolation_buffer).data());
-
-      get(*interpolation_modal_buffer).data() =
-          dt_spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      dt_cartesian_spatial_metric->get(i, j) =
-          real(get(*interpolation_buffer).data());
-
-      get(*interpolation_modal_buffer).data() =
-          dr_spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      spherical_d_cartesian_spatial_metric.get(0, i, j) =
-          real(get(*interpolation_buffer).data());
+      gsl::at(interpolated, transform_index) =
+          &cartesian_spatial_metric->get(i, j);
+      gsl::at(coefficients, transform_index) =
+          &spatial_metric_coefficients.get(i, j);
+      gsl::at(interpolated, transform_index + 1) =
+          &dt_cartesian_spatial_metric->get(i, j);
+      gsl::at(coefficients, transform_index + 1) =
+          &dt_spatial_metric_coefficients.get(i, j);
+      gsl::at(interpolated, transform_index + 2) =
+          &spherical_d_cartesian_spatial_metric.get(0, i, j);
+      gsl::at(coefficients, transform_index + 2) =
+          &dr_spatial_metric_coefficients.get(i, j);
+      transform_index += 3;
     }
   }
+  real_inverse_transforms(interpolation_modal_buffer, interpolated,
+                          coefficients, l_max);
 
   *inverse_cartesian_spatial_metric =
       determinant_and_inverse(*cartesian_spatial_metric).second;
@@ -212,33 +279,24 @@ void cartesian_shift_and_derivatives_from_modes(
   set_number_of_grid_points(dt_cartesian_shift, size);
 
   set_number_of_grid_points(interpolation_buffer, size);
-  set_number_of_grid_points(interpolation_modal_buffer, size);
   set_number_of_grid_points(eth_buffer, size);
 
   // Allocation
   SphericaliCartesianJ spherical_d_cartesian_shift{size};
 
+  // interpolate the value and derivatives of all components at once
+  std::array<DataVector*, 9> interpolated{};
+  std::array<const ComplexModalVector*, 9> coefficients{};
   for (size_t i = 0; i < 3; ++i) {
-    // copy the modes to a spin-weighted type for interpolation
-    get(*interpolation_modal_buffer).data() = shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    cartesian_shift->get(i) = real(get(*interpolation_buffer).data());
-
-    get(*interpolation_modal_buffer).data() = dt_shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    dt_cartesian_shift->get(i) = real(get(*interpolation_buffer).data());
-
-    get(*interpolation_modal_buffer).data() = dr_shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    spherical_d_cartesian_shift.get(0, i) =
-        real(get(*interpolation_buffer).data());
+    gsl::at(interpolated, 3 * i) = &cartesian_shift->get(i);
+    gsl::at(coefficients, 3 * i) = &shift_coefficients.get(i);
+    gsl::at(interpolated, 3 * i + 1) = &dt_cartesian_shift->get(i);
+    gsl::at(coefficients, 3 * i + 1) = &dt_shift_coefficients.get(i);
+    gsl::at(interpolated, 3 * i + 2) = &spherical_d_cartesian_shift.get(0, i);
+    gsl::at(coefficients, 3 * i + 2) = &dr_shift_coefficients.get(i);
   }
+  real_inverse_transforms(interpolation_modal_buffer, interpolated,
+                          coefficients, l_max);
 
   for (size_t i = 0; i < 3; ++i) {
     // reusing the interpolation buffer for taking the angular derivatives
@@ -285,29 +343,17 @@ void cartesian_lapse_and_derivatives_from_modes(
   set_number_of_grid_points(dt_cartesian_lapse, size);
 
   set_number_of_grid_points(interpolation_buffer, size);
-  set_number_of_grid_points(interpolation_modal_buffer, size);
   set_number_of_grid_points(eth_buffer, size);
 
   // Allocation
   tnsr::i<DataVector, 3> spherical_d_cartesian_lapse{size};
-  // copy the modes to a spin-weighted type for interpolation
-  get(*interpolation_modal_buffer).data() = get(lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get(*cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  get(*interpolation_modal_buffer).data() = get(dt_lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get(*dt_cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  get(*interpolation_modal_buffer).data() = get(dr_lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get<0>(spherical_d_cartesian_lapse) = real(get(*interpolation_buffer).data());
+  real_inverse_transforms<3>(
+      interpolation_modal_buffer,
+      {{&get(*cartesian_lapse), &get(*dt_cartesian_lapse),
+        &get<0>(spherical_d_cartesian_lapse)}},
+      {{&get(lapse_coefficients), &get(dt_lapse_coefficients),
+        &get(dr_lapse_coefficients)}},
+      l_max);
 
   // reusing the interpolation buffer for taking the angular derivatives
   get(*interpolation_buffer) =
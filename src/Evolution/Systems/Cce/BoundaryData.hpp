@@ -11,6 +11,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/Cce/BoundaryDataTags.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
@@ -83,6 +84,43 @@ void cartesian_to_spherical_coordinates_and_jacobians(
     const Scalar<DataVector>& sin_phi, const Scalar<DataVector>& sin_theta,
     double extraction_radius);
 
+/*!
+ * \brief The angular geometry of a worldtube of radius `extraction_radius` on
+ * the libsharp collocation points for `l_max`.
+ *
+ * \details Holds the results of `trigonometric_functions_on_swsh_collocation()`
+ * and `cartesian_to_spherical_coordinates_and_jacobians()`. These depend only
+ * on `l_max` and the extraction radius, so they are the same at every time
+ * the boundary data is computed.
+ */
+struct WorldtubeAngularGeometry {
+  WorldtubeAngularGeometry(size_t l_max_in, double extraction_radius_in);
+
+  size_t l_max;
+  double extraction_radius;
+  Scalar<DataVector> cos_phi;
+  Scalar<DataVector> cos_theta;
+  Scalar<DataVector> sin_phi;
+  Scalar<DataVector> sin_theta;
+  tnsr::I<DataVector, 3> unit_cartesian_coords;
+  SphericaliCartesianJ cartesian_to_spherical_jacobian;
+  CartesianiSphericalJ inverse_cartesian_to_spherical_jacobian;
+};
+
+/*!
+ * \brief The `WorldtubeAngularGeometry` for `l_max` and `extraction_radius`,
+ * which is computed on the first call and reused afterwards.
+ *
+ * \details Each thread keeps the geometries of the few most recently computed
+ * combinations of `l_max` and `extraction_radius`, so worldtube boundary data
+ * at a fixed radius and resolution doesn't recompute the trigonometric
+ * functions and Jacobians every time. The returned reference remains valid
+ * until the calling thread has requested several other geometries, so it
+ * should not be stored.
+ */
+const WorldtubeAngularGeometry& cached_worldtube_angular_geometry(
+    size_t l_max, double extraction_radius);
+
 /*
  * \brief Compute \f$g_{i j}\f$, \f$g^{i j}\f$, \f$\partial_i g_{j k}\f$, and
  * \f$\partial_t g_{i j}\f$ from input libsharp-compatible modal spatial
@@ -804,10 +842,6 @@ void create_bondi_boundary_data(
   // identified as a point to optimize, those buffers may be allocated here and
   // passed as function arguments
   Variables<tmpl::list<
-      Tags::detail::CosPhi, Tags::detail::CosTheta, Tags::detail::SinPhi,
-      Tags::detail::SinTheta, Tags::detail::CartesianCoordinates,
-      Tags::detail::CartesianToSphericalJacobian,
-      Tags::detail::InverseCartesianToSphericalJacobian,
       gr::Tags::SpatialMetric<DataVector, 3>,
       gr::Tags::InverseSpatialMetric<DataVector, 3>,
       gr::Tags::Shift<DataVector, 3>,
@@ -840,13 +874,12 @@ void create_bondi_boundary_data(
                                       std::integral_constant<int, 1>>>>
       derivative_buffers{size};
 
-  auto& cos_phi = get<Tags::detail::CosPhi>(computation_variables);
-  auto& cos_theta = get<Tags::detail::CosTheta>(computation_variables);
-  auto& sin_phi = get<Tags::detail::SinPhi>(computation_variables);
-  auto& sin_theta = get<Tags::detail::SinTheta>(computation_variables);
-  trigonometric_functions_on_swsh_collocation(
-      make_not_null(&cos_phi), make_not_null(&cos_theta),
-      make_not_null(&sin_phi), make_not_null(&sin_theta), l_max);
+  const auto& angular_geometry =
+      cached_worldtube_angular_geometry(l_max, extraction_radius);
+  const auto& cos_phi = angular_geometry.cos_phi;
+  const auto& cos_theta = angular_geometry.cos_theta;
+  const auto& sin_phi = angular_geometry.sin_phi;
+  const auto& sin_theta = angular_geometry.sin_theta;
 
   // NOTE: to handle the singular values of polar coordinates, the phi
   // components of all tensors are scaled according to their sin(theta)
@@ -855,18 +888,10 @@ void create_bondi_boundary_data(
   // and any up-index component get<2>(A) represents sin(theta) A^\phi.
   // This holds for Jacobians, and so direct application of the Jacobians
   // brings the factors through.
-  auto& cartesian_coords =
-      get<Tags::detail::CartesianCoordinates>(computation_variables);
-  auto& cartesian_to_spherical_jacobian =
-      get<Tags::detail::CartesianToSphericalJacobian>(computation_variables);
-  auto& inverse_cartesian_to_spherical_jacobian =
-      get<Tags::detail::InverseCartesianToSphericalJacobian>(
-          computation_variables);
-  cartesian_to_spherical_coordinates_and_jacobians(
-      make_not_null(&cartesian_coords),
-      make_not_null(&cartesian_to_spherical_jacobian),
-      make_not_null(&inverse_cartesian_to_spherical_jacobian), cos_phi,
-      cos_theta, sin_phi, sin_theta, extraction_radius);
+  const auto& cartesian_to_spherical_jacobian =
+      angular_geometry.cartesian_to_spherical_jacobian;
+  const auto& inverse_cartesian_to_spherical_jacobian =
+      angular_geometry.inverse_cartesian_to_spherical_jacobian;
 
   auto& spatial_metric =
       get<gr::Tags::SpatialMetric<DataVector, 3>>(computation_variables);
@@ -1005,10 +1030,6 @@ void create_bondi_boundary_data(
   // identified as a point to optimize, those buffers may be allocated here and
   // passed as function arguments
   Variables<tmpl::list<
-      Tags::detail::CosPhi, Tags::detail::CosTheta, Tags::detail::SinPhi,
-      Tags::detail::SinTheta, Tags::detail::CartesianCoordinates,
-      Tags::detail::CartesianToSphericalJacobian,
-      Tags::detail::InverseCartesianToSphericalJacobian,
       gr::Tags::SpatialMetric<DataVector, 3>,
       gr::Tags::InverseSpatialMetric<DataVector, 3>,
       ::Tags::deriv<gr::Tags::SpatialMetric<DataVector, 3>, tmpl::size_t<3>,
@@ -1048,13 +1069,12 @@ void create_bondi_boundary_data(
                  ::Tags::SpinWeighted<::Tags::TempScalar<0, ComplexDataVector>,
                                       std::integral_constant<int, 1>>>>
       derivative_buffers{size};
-  auto& cos_phi = get<Tags::detail::CosPhi>(computation_variables);
-  auto& cos_theta = get<Tags::detail::CosTheta>(computation_variables);
-  auto& sin_phi = get<Tags::detail::SinPhi>(computation_variables);
-  auto& sin_theta = get<Tags::detail::SinTheta>(computation_variables);
-  trigonometric_functions_on_swsh_collocation(
-      make_not_null(&cos_phi), make_not_null(&cos_theta),
-      make_not_null(&sin_phi), make_not_null(&sin_theta), l_max);
+  const auto& angular_geometry =
+      cached_worldtube_angular_geometry(l_max, extraction_radius);
+  const auto& cos_phi = angular_geometry.cos_phi;
+  const auto& cos_theta = angular_geometry.cos_theta;
+  const auto& sin_phi = angular_geometry.sin_phi;
+  const auto& sin_theta = angular_geometry.sin_theta;
 
   // NOTE: to handle the singular values of polar coordinates, the phi
   // components of all tensors are scaled according to their sin(theta)
@@ -1063,18 +1083,10 @@ void create_bondi_boundary_data(
   // and any up-index component get<2>(A) represents sin(theta) A^\phi.
   // This holds for Jacobians, and so direct application of the Jacobians
   // brings the factors through.
-  auto& cartesian_coords =
-      get<Tags::detail::CartesianCoordinates>(computation_variables);
-  auto& cartesian_to_spherical_jacobian =
-      get<Tags::detail::CartesianToSphericalJacobian>(computation_variables);
-  auto& inverse_cartesian_to_spherical_jacobian =
-      get<Tags::detail::InverseCartesianToSphericalJacobian>(
-          computation_variables);
-  cartesian_to_spherical_coordinates_and_jacobians(
-      make_not_null(&cartesian_coords),
-      make_not_null(&cartesian_to_spherical_jacobian),
-      make_not_null(&inverse_cartesian_to_spherical_jacobian), cos_phi,
-      cos_theta, sin_phi, sin_theta, extraction_radius);
+  const auto& cartesian_to_spherical_jacobian =
+      angular_geometry.cartesian_to_spherical_jacobian;
+  const auto& inverse_cartesian_to_spherical_jacobian =
+      angular_geometry.inverse_cartesian_to_spherical_jacobian;
 
   auto& cartesian_spatial_metric =
       get<gr::Tags::SpatialMetric<DataVector, 3>>(computation_variables);
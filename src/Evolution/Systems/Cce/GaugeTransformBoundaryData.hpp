@@ -781,10 +781,10 @@ struct GaugeUpdateInterpolator {
       const tnsr::i<DataVector, 2, ::Frame::Spherical<::Frame::Inertial>>&
           angular_coordinates,
       const size_t l_max) {
-    // throw away the old interpolator and generate a new one for the current
-    // grid points.
-    *interpolator = Spectral::Swsh::SwshInterpolator(
-        get<0>(angular_coordinates), get<1>(angular_coordinates), l_max);
+    // reuse the allocations of the old interpolator. The angular functions
+    // are only recomputed if the coordinates changed.
+    interpolator->update_target_points(get<0>(angular_coordinates),
+                                       get<1>(angular_coordinates), l_max);
   }
 };
 
@@ -3,7 +3,10 @@
 
 #include "Evolution/Systems/Cce/LinearSolve.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <thread>
+#include <vector>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -87,6 +90,93 @@ Matrix q_integration_matrix(const size_t number_of_points) {
                                          Spectral::Quadrature::GaussLobatto>(
              number_of_points);
 }
+
+// Solves the linear systems for the H integration at the angular collocation
+// points in [first_offset, last_offset), placing the results in the
+// corresponding radial stripes of `linear_solve_buffer`. The systems at
+// different angular points are independent, so disjoint ranges may be solved
+// concurrently.
+void solve_bondi_h_radial_systems(
+    const gsl::not_null<DataVector*> linear_solve_buffer,
+    const size_t first_offset, const size_t last_offset,
+    const ComplexDataVector& linear_factor,
+    const ComplexDataVector& linear_factor_of_conjugate,
+    const ComplexDataVector& boundary, const ComplexDataVector& one_minus_y,
+    const Matrix& derivative_matrix, const size_t number_of_radial_points,
+    const size_t number_of_angular_points) {
+  Matrix operator_matrix(2 * number_of_radial_points,
+                         2 * number_of_radial_points);
+  for (size_t offset = first_offset; offset < last_offset; ++offset) {
+    // on repeated evaluations, the matrix gets permuted by the dgesv routine.
+    // We'll ignore its pivots and just overwrite the whole thing on each
+    // pass. There are probably optimizations that can be made which make use
+    // of the pivots.
+
+    // first we apply the (1 - y) \partial_y part of the matrix
+    // to the upper right (real-real) and lower left (imag-imag) part of the
+    // matrix
+    for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
+      for (size_t i = 0; i < number_of_radial_points; ++i) {
+        for (size_t j = 0; j < number_of_radial_points; ++j) {
+          operator_matrix(i + matrix_block * number_of_radial_points,
+                          j + matrix_block * number_of_radial_points) =
+              derivative_matrix(i, j) *
+              real(one_minus_y[i * number_of_angular_points]);
+        }
+      }
+    }
+
+    // zero out the lower left and upper right part of the matrix
+    for (size_t i = 0; i < number_of_radial_points; ++i) {
+      for (size_t j = 0; j < number_of_radial_points; ++j) {
+        operator_matrix(i + number_of_radial_points, j) = 0.0;
+        operator_matrix(i, j + number_of_radial_points) = 0.0;
+      }
+    }
+
+    // gather the contributions to the matrix blocks from the linear factors
+    // each, we zero the first row
+    for (size_t i = 0; i < number_of_radial_points; ++i) {
+      const size_t linear_factor_index = offset + i * number_of_angular_points;
+      // upper left
+      operator_matrix(i, i) +=
+          real(linear_factor[linear_factor_index] +
+               linear_factor_of_conjugate[linear_factor_index]);
+      operator_matrix(0, i) = 0.0;
+      // upper right
+      operator_matrix(i, number_of_radial_points + i) -=
+          imag(linear_factor[linear_factor_index] -
+               linear_factor_of_conjugate[linear_factor_index]);
+      operator_matrix(0, number_of_radial_points + i) = 0.0;
+      // lower left
+      operator_matrix(number_of_radial_points + i, i) +=
+          imag(linear_factor[linear_factor_index] +
+               linear_factor_of_conjugate[linear_factor_index]);
+      operator_matrix(number_of_radial_points, i) = 0.0;
+      // lower right
+      operator_matrix(number_of_radial_points + i,
+                      number_of_radial_points + i) +=
+          real(linear_factor[linear_factor_index] -
+               linear_factor_of_conjugate[linear_factor_index]);
+      operator_matrix(number_of_radial_points, number_of_radial_points + i) =
+          0.0;
+    }
+    operator_matrix(0, 0) = 1.0;
+    operator_matrix(number_of_radial_points, number_of_radial_points) = 1.0;
+    // put the data currently in integrand into a real DataVector of twice the
+    // length
+    (*linear_solve_buffer)[offset * 2 * number_of_radial_points] =
+        real(boundary[offset]);
+    (*linear_solve_buffer)[(offset * 2 + 1) * number_of_radial_points] =
+        imag(boundary[offset]);
+    DataVector linear_solve_buffer_view{
+        linear_solve_buffer->data() + offset * 2 * number_of_radial_points,
+        2 * number_of_radial_points};
+    lapack::general_matrix_linear_solve(
+        make_not_null(&linear_solve_buffer_view),
+        make_not_null(&operator_matrix));
+  }
+}
 }  // namespace
 
 const Matrix& precomputed_cce_q_integrator(
@@ -218,13 +308,11 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
         linear_factor_of_conjugate,
     const Scalar<SpinWeighted<ComplexDataVector, 2>>& boundary,
     const Scalar<SpinWeighted<ComplexDataVector, 0>>& one_minus_y,
-    const size_t l_max, const size_t number_of_radial_points) {
+    const size_t l_max, const size_t number_of_radial_points,
+    const size_t number_of_threads) {
   const size_t number_of_angular_points =
       Spectral::Swsh::number_of_swsh_collocation_points(l_max);
 
-  Matrix operator_matrix(2 * number_of_radial_points,
-                         2 * number_of_radial_points);
-
   ComplexDataVector integrand =
       get(pole_of_integrand).data() +
       get(one_minus_y).data() * get(regular_integrand).data();
@@ -242,79 +330,34 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
                 linear_solve_buffer.data(), number_of_radial_points,
                 2 * number_of_angular_points);
 
+  // the differentiation matrix is lazily cached, so must be retrieved before
+  // starting any threads
   const auto& derivative_matrix =
       Spectral::differentiation_matrix<Spectral::Basis::Legendre,
                                        Spectral::Quadrature::GaussLobatto>(
           number_of_radial_points);
-  for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
-    // on repeated evaluations, the matrix gets permuted by the dgesv routine.
-    // We'll ignore its pivots and just overwrite the whole thing on each
-    // pass. There are probably optimizations that can be made which make use
-    // of the pivots.
-
-    // first we apply the (1 - y) \partial_y part of the matrix
-    // to the upper right (real-real) and lower left (imag-imag) part of the
-    // matrix
-    for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
-      for (size_t i = 0; i < number_of_radial_points; ++i) {
-        for (size_t j = 0; j < number_of_radial_points; ++j) {
-          operator_matrix(i + matrix_block * number_of_radial_points,
-                          j + matrix_block * number_of_radial_points) =
-              derivative_matrix(i, j) *
-              real(get(one_minus_y).data()[i * number_of_angular_points]);
-        }
-      }
-    }
-
-    // zero out the lower left and upper right part of the matrix
-    for (size_t i = 0; i < number_of_radial_points; ++i) {
-      for (size_t j = 0; j < number_of_radial_points; ++j) {
-        operator_matrix(i + number_of_radial_points, j) = 0.0;
-        operator_matrix(i, j + number_of_radial_points) = 0.0;
-      }
-    }
-
-    // gather the contributions to the matrix blocks from the linear factors
-    // each, we zero the first row
-    for (size_t i = 0; i < number_of_radial_points; ++i) {
-      const size_t linear_factor_index = offset + i * number_of_angular_points;
-      // upper left
-      operator_matrix(i, i) +=
-          real(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, i) = 0.0;
-      // upper right
-      operator_matrix(i, number_of_radial_points + i) -=
-          imag(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, number_of_radial_points + i) = 0.0;
-      // lower left
-      operator_matrix(number_of_radial_points + i, i) +=
-          imag(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, i) = 0.0;
-      // lower right
-      operator_matrix(number_of_radial_points + i,
-                      number_of_radial_points + i) +=
-          real(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, number_of_radial_points + i) =
-          0.0;
-    }
-    operator_matrix(0, 0) = 1.0;
-    operator_matrix(number_of_radial_points, number_of_radial_points) = 1.0;
-    // put the data currently in integrand into a real DataVector of twice the
-    // length
-    linear_solve_buffer[offset * 2 * number_of_radial_points] =
-        real(get(boundary).data()[offset]);
-    linear_solve_buffer[(offset * 2 + 1) * number_of_radial_points] =
-        imag(get(boundary).data()[offset]);
-    DataVector linear_solve_buffer_view{
-        linear_solve_buffer.data() + offset * 2 * number_of_radial_points,
-        2 * number_of_radial_points};
-    lapack::general_matrix_linear_solve(
-        make_not_null(&linear_solve_buffer_view),
-        make_not_null(&operator_matrix));
+  const auto solve_range = [&](const size_t first_offset,
+                               const size_t last_offset) {
+    solve_bondi_h_radial_systems(
+        make_not_null(&linear_solve_buffer), first_offset, last_offset,
+        get(linear_factor).data(), get(linear_factor_of_conjugate).data(),
+        get(boundary).data(), get(one_minus_y).data(), derivative_matrix,
+        number_of_radial_points, number_of_angular_points);
+  };
+  const size_t used_threads =
+      std::clamp(number_of_threads, 1_st, number_of_angular_points);
+  const auto range_start = [&](const size_t thread) {
+    return thread * number_of_angular_points / used_threads;
+  };
+  std::vector<std::thread> threads{};
+  threads.reserve(used_threads - 1);
+  for (size_t thread = 1; thread < used_threads; ++thread) {
+    threads.emplace_back(solve_range, range_start(thread),
+                         range_start(thread + 1));
+  }
+  solve_range(0, range_start(1));
+  for (auto& thread : threads) {
+    thread.join();
   }
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
   raw_transpose(make_not_null(reinterpret_cast<double*>(
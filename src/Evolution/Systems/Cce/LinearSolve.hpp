@@ -93,6 +93,9 @@ void transpose_to_reals_then_imags_radial_stripes(
  * \f$L^\prime\f$ ensure that the only current method we have for evaluating the
  * \f$H\f$ hypersurface equation is a direct linear solve, rather than the
  * spectral matrix multiplications which are available for the other integrals.
+ * The linear systems at each angular collocation point are independent, so
+ * callers of `apply` may split them across `number_of_threads` threads. When
+ * used with `db::mutate_apply` the systems are solved on the calling thread.
  *
  * In each case, the boundary value at the world tube for the integration is
  * retrieved from `BoundaryPrefix<Tag>`.
@@ -190,7 +193,8 @@ struct RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH> {
           linear_factor_of_conjugate,
       const Scalar<SpinWeighted<ComplexDataVector, 2>>& boundary,
       const Scalar<SpinWeighted<ComplexDataVector, 0>>& one_minus_y,
-      size_t l_max, size_t number_of_radial_points);
+      size_t l_max, size_t number_of_radial_points,
+      size_t number_of_threads = 1);
 };
 /// @}
 }  // namespace Cce
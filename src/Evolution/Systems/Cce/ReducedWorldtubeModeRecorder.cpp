@@ -3,6 +3,7 @@
 
 #include "Evolution/Systems/Cce/ReducedWorldtubeModeRecorder.hpp"
 
+#include <algorithm>
 #include <cstddef>
 
 #include "DataStructures/ComplexModalVector.hpp"
@@ -31,8 +32,13 @@ void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
       }
     }
   }
-  auto& output_mode_dataset =
-      output_file_.try_insert<h5::Dat>(dataset_path, legend, 0);
+  // The worldtube data managers read windows of consecutive times, so chunk
+  // the rows such that each window touches only a few chunks. The target size
+  // matches the chunks of `h5::write_data`.
+  const size_t rows_per_chunk =
+      std::max(size_t{4}, size_t{131'072} / (sizeof(double) * legend.size()));
+  auto& output_mode_dataset = output_file_.try_insert<h5::Dat>(
+      dataset_path, legend, 0, rows_per_chunk);
   std::vector<double> data_to_write;
   if (is_real) {
     data_to_write.resize(output_size + 1);
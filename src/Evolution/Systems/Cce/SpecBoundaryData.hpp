@@ -175,10 +175,6 @@ void create_bondi_boundary_data_from_unnormalized_spec_modes(
   // identified as a point to optimize, those buffers may be allocated here and
   // passed as function arguments
   Variables<tmpl::list<
-      Tags::detail::CosPhi, Tags::detail::CosTheta, Tags::detail::SinPhi,
-      Tags::detail::SinTheta, Tags::detail::CartesianCoordinates,
-      Tags::detail::CartesianToSphericalJacobian,
-      Tags::detail::InverseCartesianToSphericalJacobian,
       gr::Tags::SpatialMetric<DataVector, 3>,
       gr::Tags::InverseSpatialMetric<DataVector, 3>,
       ::Tags::deriv<gr::Tags::SpatialMetric<DataVector, 3>, tmpl::size_t<3>,
@@ -219,13 +215,12 @@ void create_bondi_boundary_data_from_unnormalized_spec_modes(
                  ::Tags::SpinWeighted<::Tags::TempScalar<0, ComplexDataVector>,
                                       std::integral_constant<int, 1>>>>
       derivative_buffers{size};
-  auto& cos_phi = get<Tags::detail::CosPhi>(computation_variables);
-  auto& cos_theta = get<Tags::detail::CosTheta>(computation_variables);
-  auto& sin_phi = get<Tags::detail::SinPhi>(computation_variables);
-  auto& sin_theta = get<Tags::detail::SinTheta>(computation_variables);
-  trigonometric_functions_on_swsh_collocation(
-      make_not_null(&cos_phi), make_not_null(&cos_theta),
-      make_not_null(&sin_phi), make_not_null(&sin_theta), l_max);
+  const auto& angular_geometry =
+      cached_worldtube_angular_geometry(l_max, extraction_radius);
+  const auto& cos_phi = angular_geometry.cos_phi;
+  const auto& cos_theta = angular_geometry.cos_theta;
+  const auto& sin_phi = angular_geometry.sin_phi;
+  const auto& sin_theta = angular_geometry.sin_theta;
 
   // NOTE: to handle the singular values of polar coordinates, the phi
   // components of all tensors are scaled according to their sin(theta)
@@ -234,18 +229,11 @@ void create_bondi_boundary_data_from_unnormalized_spec_modes(
   // and any up-index component get<2>(A) represents sin(theta) A^\phi.
   // This holds for Jacobians, and so direct application of the Jacobians
   // brings the factors through.
-  auto& cartesian_coords =
-      get<Tags::detail::CartesianCoordinates>(computation_variables);
-  auto& cartesian_to_spherical_jacobian =
-      get<Tags::detail::CartesianToSphericalJacobian>(computation_variables);
-  auto& inverse_cartesian_to_spherical_jacobian =
-      get<Tags::detail::InverseCartesianToSphericalJacobian>(
-          computation_variables);
-  cartesian_to_spherical_coordinates_and_jacobians(
-      make_not_null(&cartesian_coords),
-      make_not_null(&cartesian_to_spherical_jacobian),
-      make_not_null(&inverse_cartesian_to_spherical_jacobian), cos_phi,
-      cos_theta, sin_phi, sin_theta, extraction_radius);
+  const auto& cartesian_to_spherical_jacobian =
+      angular_geometry.cartesian_to_spherical_jacobian;
+  const auto& inverse_cartesian_to_spherical_jacobian =
+      angular_geometry.inverse_cartesian_to_spherical_jacobian;
+  const auto& cartesian_coords = angular_geometry.unit_cartesian_coords;
 
   auto& cartesian_spatial_metric =
       get<gr::Tags::SpatialMetric<DataVector, 3>>(computation_variables);
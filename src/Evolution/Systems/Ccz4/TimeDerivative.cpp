@@ -3,8 +3,11 @@
 
 #include "Evolution/Systems/Ccz4/TimeDerivative.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <tuple>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
@@ -23,6 +26,41 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 
+namespace {
+// Points the components of `tensor` at consecutive chunks of
+// `number_of_points` values starting at `next`, and advances `next` past them
+template <typename TensorType>
+void point_to_buffer(const gsl::not_null<TensorType*> tensor,
+                     const gsl::not_null<double**> next,
+                     const size_t number_of_points) {
+  for (auto& component : *tensor) {
+    component.set_data_ref(*next, number_of_points);
+    *next += number_of_points;
+  }
+}
+
+// Makes the components of `view` refer to the points
+// [offset, offset + number_of_points) of the components of `tensor`
+template <typename TensorType>
+void make_block_view(const gsl::not_null<TensorType*> view,
+                     const gsl::not_null<TensorType*> tensor,
+                     const size_t offset, const size_t number_of_points) {
+  for (size_t i = 0; i < tensor->size(); ++i) {
+    (*view)[i].set_data_ref((*tensor)[i].data() + offset, number_of_points);
+  }
+}
+
+template <typename TensorType>
+void make_const_block_view(const gsl::not_null<TensorType*> view,
+                           const TensorType& tensor, const size_t offset,
+                           const size_t number_of_points) {
+  for (size_t i = 0; i < tensor.size(); ++i) {
+    make_const_view(make_not_null(&std::as_const((*view)[i])), tensor[i],
+                    offset, number_of_points);
+  }
+}
+}  // namespace
+
 namespace Ccz4 {
 template <size_t Dim>
 void TimeDerivative<Dim>::apply(
@@ -613,6 +651,242 @@ void TimeDerivative<Dim>::apply(
                  (*contracted_symmetrized_d_field_b)(ti::k)));
   }
 }
+
+template <size_t Dim>
+void TimeDerivative<Dim>::apply_in_blocks(
+    const gsl::not_null<tnsr::ii<DataVector, Dim>*> dt_conformal_spatial_metric,
+    const gsl::not_null<Scalar<DataVector>*> dt_ln_lapse,
+    const gsl::not_null<tnsr::I<DataVector, Dim>*> dt_shift,
+    const gsl::not_null<Scalar<DataVector>*> dt_ln_conformal_factor,
+    const gsl::not_null<tnsr::ii<DataVector, Dim>*> dt_a_tilde,
+    const gsl::not_null<Scalar<DataVector>*> dt_trace_extrinsic_curvature,
+    const gsl::not_null<Scalar<DataVector>*> dt_theta,
+    const gsl::not_null<tnsr::I<DataVector, Dim>*> dt_gamma_hat,
+    const gsl::not_null<tnsr::I<DataVector, Dim>*> dt_b,
+    const gsl::not_null<tnsr::i<DataVector, Dim>*> dt_field_a,
+    const gsl::not_null<tnsr::iJ<DataVector, Dim>*> dt_field_b,
+    const gsl::not_null<tnsr::ijj<DataVector, Dim>*> dt_field_d,
+    const gsl::not_null<tnsr::i<DataVector, Dim>*> dt_field_p,
+    const double c,
+    const double cleaning_speed,
+    const Scalar<DataVector>& eta,
+    const double f,
+    const Scalar<DataVector>& k_0,
+    const tnsr::i<DataVector, Dim>& d_k_0,
+    const double kappa_1,
+    const double kappa_2,
+    const double kappa_3,
+    const double mu,
+    const double one_over_relaxation_time,
+    const EvolveShift evolve_shift,
+    const SlicingConditionType slicing_condition_type,
+    const tnsr::ii<DataVector, Dim>& conformal_spatial_metric,
+    const Scalar<DataVector>& ln_lapse,
+    const tnsr::I<DataVector, Dim>& shift,
+    const Scalar<DataVector>& ln_conformal_factor,
+    const tnsr::ii<DataVector, Dim>& a_tilde,
+    const Scalar<DataVector>& trace_extrinsic_curvature,
+    const Scalar<DataVector>& theta,
+    const tnsr::I<DataVector, Dim>& gamma_hat,
+    const tnsr::I<DataVector, Dim>& b,
+    const tnsr::i<DataVector, Dim>& field_a,
+    const tnsr::iJ<DataVector, Dim>& field_b,
+    const tnsr::ijj<DataVector, Dim>& field_d,
+    const tnsr::i<DataVector, Dim>& field_p,
+    const tnsr::ijj<DataVector, Dim>& d_a_tilde,
+    const tnsr::i<DataVector, Dim>& d_trace_extrinsic_curvature,
+    const tnsr::i<DataVector, Dim>& d_theta,
+    const tnsr::iJ<DataVector, Dim>& d_gamma_hat,
+    const tnsr::iJ<DataVector, Dim>& d_b,
+    const tnsr::ij<DataVector, Dim>& d_field_a,
+    const tnsr::ijK<DataVector, Dim>& d_field_b,
+    const tnsr::ijkk<DataVector, Dim>& d_field_d,
+    const tnsr::ij<DataVector, Dim>& d_field_p) {
+  const size_t num_points = get_size(get(ln_conformal_factor));
+
+  // The temporaries of one block, in the order `apply` takes them
+  std::tuple<
+      Scalar<DataVector>, Scalar<DataVector>, tnsr::II<DataVector, Dim>,
+      tnsr::II<DataVector, Dim>, Scalar<DataVector>, Scalar<DataVector>,
+      Scalar<DataVector>, tnsr::II<DataVector, Dim>, tnsr::ij<DataVector, Dim>,
+      tnsr::ii<DataVector, Dim>, Scalar<DataVector>,
+      tnsr::ijK<DataVector, Dim>, tnsr::i<DataVector, Dim>,
+      tnsr::ijk<DataVector, Dim>, tnsr::i<DataVector, Dim>,
+      tnsr::I<DataVector, Dim>, Scalar<DataVector>, tnsr::ij<DataVector, Dim>,
+      tnsr::ijk<DataVector, Dim>, tnsr::ii<DataVector, Dim>,
+      tnsr::i<DataVector, Dim>, tnsr::I<DataVector, Dim>,
+      tnsr::iJ<DataVector, Dim>, tnsr::i<DataVector, Dim>,
+      tnsr::ij<DataVector, Dim>, Scalar<DataVector>, Scalar<DataVector>,
+      tnsr::ii<DataVector, Dim>, tnsr::ijj<DataVector, Dim>,
+      tnsr::i<DataVector, Dim>, tnsr::ii<DataVector, Dim>, Scalar<DataVector>,
+      Scalar<DataVector>, tnsr::I<DataVector, Dim>, tnsr::ii<DataVector, Dim>,
+      Scalar<DataVector>, tnsr::iJJ<DataVector, Dim>,
+      tnsr::Ijj<DataVector, Dim>, tnsr::iJkk<DataVector, Dim>,
+      tnsr::Ijj<DataVector, Dim>, tnsr::ii<DataVector, Dim>,
+      tnsr::ij<DataVector, Dim>, Scalar<DataVector>, tnsr::I<DataVector, Dim>,
+      tnsr::iJ<DataVector, Dim>, tnsr::i<DataVector, Dim>,
+      tnsr::I<DataVector, Dim>, tnsr::ij<DataVector, Dim>, Scalar<DataVector>>
+      temporaries{};
+  const size_t components_per_point = std::apply(
+      [](const auto&... temporary) { return (temporary.size() + ...); },
+      temporaries);
+  DataVector buffer(components_per_point * std::min(block_size, num_points));
+
+  // Views of the points of one block of the arguments
+  tnsr::ii<DataVector, Dim> dt_conformal_spatial_metric_block{};
+  Scalar<DataVector> dt_ln_lapse_block{};
+  tnsr::I<DataVector, Dim> dt_shift_block{};
+  Scalar<DataVector> dt_ln_conformal_factor_block{};
+  tnsr::ii<DataVector, Dim> dt_a_tilde_block{};
+  Scalar<DataVector> dt_trace_extrinsic_curvature_block{};
+  Scalar<DataVector> dt_theta_block{};
+  tnsr::I<DataVector, Dim> dt_gamma_hat_block{};
+  tnsr::I<DataVector, Dim> dt_b_block{};
+  tnsr::i<DataVector, Dim> dt_field_a_block{};
+  tnsr::iJ<DataVector, Dim> dt_field_b_block{};
+  tnsr::ijj<DataVector, Dim> dt_field_d_block{};
+  tnsr::i<DataVector, Dim> dt_field_p_block{};
+  Scalar<DataVector> eta_block{};
+  Scalar<DataVector> k_0_block{};
+  tnsr::i<DataVector, Dim> d_k_0_block{};
+  tnsr::ii<DataVector, Dim> conformal_spatial_metric_block{};
+  Scalar<DataVector> ln_lapse_block{};
+  tnsr::I<DataVector, Dim> shift_block{};
+  Scalar<DataVector> ln_conformal_factor_block{};
+  tnsr::ii<DataVector, Dim> a_tilde_block{};
+  Scalar<DataVector> trace_extrinsic_curvature_block{};
+  Scalar<DataVector> theta_block{};
+  tnsr::I<DataVector, Dim> gamma_hat_block{};
+  tnsr::I<DataVector, Dim> b_block{};
+  tnsr::i<DataVector, Dim> field_a_block{};
+  tnsr::iJ<DataVector, Dim> field_b_block{};
+  tnsr::ijj<DataVector, Dim> field_d_block{};
+  tnsr::i<DataVector, Dim> field_p_block{};
+  tnsr::ijj<DataVector, Dim> d_a_tilde_block{};
+  tnsr::i<DataVector, Dim> d_trace_extrinsic_curvature_block{};
+  tnsr::i<DataVector, Dim> d_theta_block{};
+  tnsr::iJ<DataVector, Dim> d_gamma_hat_block{};
+  tnsr::iJ<DataVector, Dim> d_b_block{};
+  tnsr::ij<DataVector, Dim> d_field_a_block{};
+  tnsr::ijK<DataVector, Dim> d_field_b_block{};
+  tnsr::ijkk<DataVector, Dim> d_field_d_block{};
+  tnsr::ij<DataVector, Dim> d_field_p_block{};
+
+  for (size_t offset = 0; offset < num_points; offset += block_size) {
+    const size_t points_in_block = std::min(block_size, num_points - offset);
+    double* next_temporary = buffer.data();
+    std::apply(
+        [&next_temporary, &points_in_block](auto&... temporary) {
+          (point_to_buffer(make_not_null(&temporary),
+                           make_not_null(&next_temporary), points_in_block),
+           ...);
+        },
+        temporaries);
+
+    make_block_view(make_not_null(&dt_conformal_spatial_metric_block),
+                    dt_conformal_spatial_metric, offset, points_in_block);
+    make_block_view(make_not_null(&dt_ln_lapse_block), dt_ln_lapse,
+                    offset, points_in_block);
+    make_block_view(make_not_null(&dt_shift_block), dt_shift,
+                    offset, points_in_block);
+    make_block_view(make_not_null(&dt_ln_conformal_factor_block),
+                    dt_ln_conformal_factor, offset, points_in_block);
+    make_block_view(make_not_null(&dt_a_tilde_block), dt_a_tilde,
+                    offset, points_in_block);
+    make_block_view(make_not_null(&dt_trace_extrinsic_curvature_block),
+                    dt_trace_extrinsic_curvature, offset, points_in_block);
+    make_block_view(make_not_null(&dt_theta_block), dt_theta,
+                    offset, points_in_block);
+    make_block_view(make_not_null(&dt_gamma_hat_block), dt_gamma_hat,
+                    offset, points_in_block);
+    make_block_view(make_not_null(&dt_b_block), dt_b, offset, points_in_block);
+    make_block_view(make_not_null(&dt_field_a_block), dt_field_a,
+                    offset, points_in_block);
+    make_block_view(make_not_null(&dt_field_b_block), dt_field_b,
+                    offset, points_in_block);
+    make_block_view(make_not_null(&dt_field_d_block), dt_field_d,
+                    offset, points_in_block);
+    make_block_view(make_not_null(&dt_field_p_block), dt_field_p,
+                    offset, points_in_block);
+    make_const_block_view(make_not_null(&eta_block), eta,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&k_0_block), k_0,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&d_k_0_block), d_k_0,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&conformal_spatial_metric_block),
+                          conformal_spatial_metric, offset, points_in_block);
+    make_const_block_view(make_not_null(&ln_lapse_block), ln_lapse,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&shift_block), shift,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&ln_conformal_factor_block),
+                          ln_conformal_factor, offset, points_in_block);
+    make_const_block_view(make_not_null(&a_tilde_block), a_tilde,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&trace_extrinsic_curvature_block),
+                          trace_extrinsic_curvature, offset, points_in_block);
+    make_const_block_view(make_not_null(&theta_block), theta,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&gamma_hat_block), gamma_hat,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&b_block), b, offset, points_in_block);
+    make_const_block_view(make_not_null(&field_a_block), field_a,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&field_b_block), field_b,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&field_d_block), field_d,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&field_p_block), field_p,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&d_a_tilde_block), d_a_tilde,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&d_trace_extrinsic_curvature_block),
+                          d_trace_extrinsic_curvature, offset, points_in_block);
+    make_const_block_view(make_not_null(&d_theta_block), d_theta,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&d_gamma_hat_block), d_gamma_hat,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&d_b_block), d_b,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&d_field_a_block), d_field_a,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&d_field_b_block), d_field_b,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&d_field_d_block), d_field_d,
+                          offset, points_in_block);
+    make_const_block_view(make_not_null(&d_field_p_block), d_field_p,
+                          offset, points_in_block);
+
+    std::apply(
+        [&](auto&... temporary) {
+          TimeDerivative<Dim>::apply(
+              make_not_null(&dt_conformal_spatial_metric_block),
+              make_not_null(&dt_ln_lapse_block),
+              make_not_null(&dt_shift_block),
+              make_not_null(&dt_ln_conformal_factor_block),
+              make_not_null(&dt_a_tilde_block),
+              make_not_null(&dt_trace_extrinsic_curvature_block),
+              make_not_null(&dt_theta_block),
+              make_not_null(&dt_gamma_hat_block), make_not_null(&dt_b_block),
+              make_not_null(&dt_field_a_block),
+              make_not_null(&dt_field_b_block),
+              make_not_null(&dt_field_d_block),
+              make_not_null(&dt_field_p_block), make_not_null(&temporary)...,
+              c, cleaning_speed, eta_block, f, k_0_block, d_k_0_block, kappa_1,
+              kappa_2, kappa_3, mu, one_over_relaxation_time, evolve_shift,
+              slicing_condition_type, conformal_spatial_metric_block,
+              ln_lapse_block, shift_block, ln_conformal_factor_block,
+              a_tilde_block, trace_extrinsic_curvature_block, theta_block,
+              gamma_hat_block, b_block, field_a_block, field_b_block,
+              field_d_block, field_p_block, d_a_tilde_block,
+              d_trace_extrinsic_curvature_block, d_theta_block,
+              d_gamma_hat_block, d_b_block, d_field_a_block, d_field_b_block,
+              d_field_d_block, d_field_p_block);
+        },
+        temporaries);
+  }
+}
 }  // namespace Ccz4
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -186,5 +186,69 @@ struct TimeDerivative {
       const tnsr::ijK<DataVector, Dim>& d_field_b,
       const tnsr::ijkk<DataVector, Dim>& d_field_d,
       const tnsr::ij<DataVector, Dim>& d_field_p);
+
+  /// The number of grid points evaluated together by `apply_in_blocks`
+  static constexpr size_t block_size = 64;
+
+  /*!
+   * \brief Compute the same RHS as `apply` in blocks of
+   * `Ccz4::TimeDerivative::block_size` grid points
+   *
+   * \details The temporaries and the identities (eq 13 - 27) are only
+   * allocated for one block and reused for every block, so they stay in cache
+   * while the block is evaluated and the memory needed for them does not grow
+   * with the number of grid points. The time derivatives are the same as the
+   * ones computed by `apply`.
+   */
+  static void apply_in_blocks(
+      const gsl::not_null<tnsr::ii<DataVector, Dim>*>
+          dt_conformal_spatial_metric,
+      const gsl::not_null<Scalar<DataVector>*> dt_ln_lapse,
+      const gsl::not_null<tnsr::I<DataVector, Dim>*> dt_shift,
+      const gsl::not_null<Scalar<DataVector>*> dt_ln_conformal_factor,
+      const gsl::not_null<tnsr::ii<DataVector, Dim>*> dt_a_tilde,
+      const gsl::not_null<Scalar<DataVector>*> dt_trace_extrinsic_curvature,
+      const gsl::not_null<Scalar<DataVector>*> dt_theta,
+      const gsl::not_null<tnsr::I<DataVector, Dim>*> dt_gamma_hat,
+      const gsl::not_null<tnsr::I<DataVector, Dim>*> dt_b,
+      const gsl::not_null<tnsr::i<DataVector, Dim>*> dt_field_a,
+      const gsl::not_null<tnsr::iJ<DataVector, Dim>*> dt_field_b,
+      const gsl::not_null<tnsr::ijj<DataVector, Dim>*> dt_field_d,
+      const gsl::not_null<tnsr::i<DataVector, Dim>*> dt_field_p,
+      const double c,
+      const double cleaning_speed,
+      const Scalar<DataVector>& eta,
+      const double f,
+      const Scalar<DataVector>& k_0,
+      const tnsr::i<DataVector, Dim>& d_k_0,
+      const double kappa_1,
+      const double kappa_2,
+      const double kappa_3,
+      const double mu,
+      const double one_over_relaxation_time,
+      const EvolveShift evolve_shift,
+      const SlicingConditionType slicing_condition_type,
+      const tnsr::ii<DataVector, Dim>& conformal_spatial_metric,
+      const Scalar<DataVector>& ln_lapse,
+      const tnsr::I<DataVector, Dim>& shift,
+      const Scalar<DataVector>& ln_conformal_factor,
+      const tnsr::ii<DataVector, Dim>& a_tilde,
+      const Scalar<DataVector>& trace_extrinsic_curvature,
+      const Scalar<DataVector>& theta,
+      const tnsr::I<DataVector, Dim>& gamma_hat,
+      const tnsr::I<DataVector, Dim>& b,
+      const tnsr::i<DataVector, Dim>& field_a,
+      const tnsr::iJ<DataVector, Dim>& field_b,
+      const tnsr::ijj<DataVector, Dim>& field_d,
+      const tnsr::i<DataVector, Dim>& field_p,
+      const tnsr::ijj<DataVector, Dim>& d_a_tilde,
+      const tnsr::i<DataVector, Dim>& d_trace_extrinsic_curvature,
+      const tnsr::i<DataVector, Dim>& d_theta,
+      const tnsr::iJ<DataVector, Dim>& d_gamma_hat,
+      const tnsr::iJ<DataVector, Dim>& d_b,
+      const tnsr::ij<DataVector, Dim>& d_field_a,
+      const tnsr::ijK<DataVector, Dim>& d_field_b,
+      const tnsr::ijkk<DataVector, Dim>& d_field_d,
+      const tnsr::ij<DataVector, Dim>& d_field_p);
 };
 }  // namespace Ccz4
@@ -43,7 +43,27 @@ void TimeDerivative<Dim>::apply(
   *result_inverse_spatial_metric = upper_spatial_metric;
   *result_gamma1 = gamma1;
   *result_gamma2 = gamma2;
+  compute_time_derivatives(dt_psi, dt_pi, dt_phi, d_psi, d_pi, d_phi, pi, phi,
+                           lapse, shift, deriv_lapse, deriv_shift,
+                           upper_spatial_metric, trace_spatial_christoffel,
+                           trace_extrinsic_curvature, gamma1, gamma2);
+}
 
+template <size_t Dim>
+void TimeDerivative<Dim>::compute_time_derivatives(
+    const gsl::not_null<Scalar<DataVector>*> dt_psi,
+    const gsl::not_null<Scalar<DataVector>*> dt_pi,
+    const gsl::not_null<tnsr::i<DataVector, Dim, Frame::Inertial>*> dt_phi,
+    const tnsr::i<DataVector, Dim>& d_psi, const tnsr::i<DataVector, Dim>& d_pi,
+    const tnsr::ij<DataVector, Dim>& d_phi, const Scalar<DataVector>& pi,
+    const tnsr::i<DataVector, Dim>& phi, const Scalar<DataVector>& lapse,
+    const tnsr::I<DataVector, Dim>& shift,
+    const tnsr::i<DataVector, Dim>& deriv_lapse,
+    const tnsr::iJ<DataVector, Dim>& deriv_shift,
+    const tnsr::II<DataVector, Dim>& upper_spatial_metric,
+    const tnsr::I<DataVector, Dim>& trace_spatial_christoffel,
+    const Scalar<DataVector>& trace_extrinsic_curvature,
+    const Scalar<DataVector>& gamma1, const Scalar<DataVector>& gamma2) {
   tenex::evaluate(dt_psi,
                   -lapse() * pi() + shift(ti::I) * d_psi(ti::i) +
                       gamma1() * shift(ti::J) * (d_psi(ti::j) - phi(ti::j)));
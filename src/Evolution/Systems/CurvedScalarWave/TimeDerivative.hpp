@@ -81,6 +81,26 @@ struct TimeDerivative {
       gsl::not_null<Scalar<DataVector>*> result_gamma1,
       gsl::not_null<Scalar<DataVector>*> result_gamma2,
 
+      const tnsr::i<DataVector, Dim>& d_psi,
+      const tnsr::i<DataVector, Dim>& d_pi,
+      const tnsr::ij<DataVector, Dim>& d_phi, const Scalar<DataVector>& pi,
+      const tnsr::i<DataVector, Dim>& phi, const Scalar<DataVector>& lapse,
+      const tnsr::I<DataVector, Dim>& shift,
+      const tnsr::i<DataVector, Dim>& deriv_lapse,
+      const tnsr::iJ<DataVector, Dim>& deriv_shift,
+      const tnsr::II<DataVector, Dim>& upper_spatial_metric,
+      const tnsr::I<DataVector, Dim>& trace_spatial_christoffel,
+      const Scalar<DataVector>& trace_extrinsic_curvature,
+      const Scalar<DataVector>& gamma1, const Scalar<DataVector>& gamma2);
+
+  /// Compute only the time derivatives, without copying the background into
+  /// the temporaries. Systems that evolve the background, such as
+  /// `ScalarTensor`, have already computed these quantities.
+  static void compute_time_derivatives(
+      gsl::not_null<Scalar<DataVector>*> dt_psi,
+      gsl::not_null<Scalar<DataVector>*> dt_pi,
+      gsl::not_null<tnsr::i<DataVector, Dim, Frame::Inertial>*> dt_phi,
+
       const tnsr::i<DataVector, Dim>& d_psi,
       const tnsr::i<DataVector, Dim>& d_pi,
       const tnsr::ij<DataVector, Dim>& d_phi, const Scalar<DataVector>& pi,
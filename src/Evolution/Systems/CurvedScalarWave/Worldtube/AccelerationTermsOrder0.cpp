@@ -45,7 +45,11 @@ void acceleration_terms_0(
 
   const double M = bh_mass;
 
-  DynamicBuffer<DataVector> temps(56, grid_size);
+  // Reuse the temporaries between calls on this thread
+  thread_local DynamicBuffer<DataVector> temps{};
+  if (temps.size() != 56 or temps[0].size() != grid_size) {
+    temps = DynamicBuffer<DataVector>(56, grid_size);
+  }
 
   const double d_0 = rp * rp * rp;
   const double d_1 = 1.0 / d_0;
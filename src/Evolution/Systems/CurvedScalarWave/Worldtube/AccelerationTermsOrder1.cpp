@@ -48,7 +48,11 @@ void acceleration_terms_1(
 
   const double M = bh_mass;
 
-  DynamicBuffer<DataVector> temps(307, grid_size);
+  // Reuse the temporaries between calls on this thread
+  thread_local DynamicBuffer<DataVector> temps{};
+  if (temps.size() != 307 or temps[0].size() != grid_size) {
+    temps = DynamicBuffer<DataVector>(307, grid_size);
+  }
 
   const double d_0 = rp * rp * rp;
   const double d_1 = 2 * M;
@@ -98,7 +98,7 @@ struct SendToWorldtube {
 
     Variables<tmpl::list<
         CurvedScalarWave::Tags::Psi, ::Tags::dt<CurvedScalarWave::Tags::Psi>,
-        ::Tags::TempScalar<0>, ::Tags::TempScalar<1>, ::Tags::TempScalar<2>>>
+        ::Tags::TempScalar<0>, ::Tags::TempScalar<1>>>
         temporaries(face_size);
     auto& psi_regular_times_det =
         get(get<CurvedScalarWave::Tags::Psi>(temporaries));
@@ -106,7 +106,6 @@ struct SendToWorldtube {
         get(get<::Tags::dt<CurvedScalarWave::Tags::Psi>>(temporaries));
     auto& theta = get(get<::Tags::TempScalar<0>>(temporaries));
     auto& phi = get(get<::Tags::TempScalar<1>>(temporaries));
-    auto& spherical_harmonic = get(get<::Tags::TempScalar<2>>(temporaries));
     const auto& face_quantities = db::get<Tags::FaceQuantities>(box).value();
     const auto& psi_numerical_face =
         get<CurvedScalarWave::Tags::Psi>(face_quantities);
@@ -140,12 +139,16 @@ struct SendToWorldtube {
     Variables<tags_to_send> Ylm_coefs(num_modes);
     theta = atan2(hypot(x, y), z);
     phi = atan2(y, x);
+    const DataVector spherical_harmonics =
+        ylm::real_spherical_harmonics(theta, phi, order);
     size_t index = 0;
     // project onto spherical harmonics
     for (size_t l = 0; l <= order; ++l) {
       // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
       for (int m = -l; m <= static_cast<int>(l); ++m, ++index) {
-        spherical_harmonic = ylm::real_spherical_harmonic(theta, phi, l, m);
+        const DataVector spherical_harmonic{};
+        make_const_view(make_not_null(&spherical_harmonic),
+                        spherical_harmonics, index * face_size, face_size);
         get(get<CurvedScalarWave::Tags::Psi>(Ylm_coefs)).at(index) =
             definite_integral(psi_regular_times_det * spherical_harmonic,
                               face_mesh);
@@ -44,7 +44,11 @@ void puncture_field_0(
 
   const double M = bh_mass;
 
-  DynamicBuffer<DataVector> temps(43, grid_size);
+  // Reuse the temporaries between calls on this thread
+  thread_local DynamicBuffer<DataVector> temps{};
+  if (temps.size() != 43 or temps[0].size() != grid_size) {
+    temps = DynamicBuffer<DataVector>(43, grid_size);
+  }
 
   const double d_0 = rp * rp * rp;
   const double d_1 = 2.0 * M;
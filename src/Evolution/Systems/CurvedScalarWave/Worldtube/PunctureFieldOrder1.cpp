@@ -45,7 +45,11 @@ void puncture_field_1(
 
   const double M = bh_mass;
 
-  DynamicBuffer<DataVector> temps(320, grid_size);
+  // Reuse the temporaries between calls on this thread
+  thread_local DynamicBuffer<DataVector> temps{};
+  if (temps.size() != 320 or temps[0].size() != grid_size) {
+    temps = DynamicBuffer<DataVector>(320, grid_size);
+  }
 
   const double d_0 = rp * rp * rp;
   const double d_1 = 2.0 * M;
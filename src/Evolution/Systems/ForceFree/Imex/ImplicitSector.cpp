@@ -0,0 +1,120 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/ForceFree/Imex/ImplicitSector.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Imex/GuessResult.hpp"
+#include "Evolution/Systems/ForceFree/ElectricCurrentDensity.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace ForceFree::Imex {
+void ParallelCurrentSource::apply(
+    const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+        source_tilde_e,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_e,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+    const Scalar<DataVector>& tilde_q, const double parallel_conductivity,
+    const Scalar<DataVector>& lapse,
+    const Scalar<DataVector>& sqrt_det_spatial_metric,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric) {
+  ComputeParallelTildeJ::apply(source_tilde_e, tilde_q, tilde_e, tilde_b,
+                               parallel_conductivity, lapse,
+                               sqrt_det_spatial_metric, spatial_metric);
+  for (size_t i = 0; i < 3; ++i) {
+    source_tilde_e->get(i) *= -1.0;
+  }
+}
+
+std::vector<imex::GuessResult> ParallelCurrentImplicitSolve::apply(
+    const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*> tilde_e,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+    const double parallel_conductivity, const Scalar<DataVector>& lapse,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+    const Variables<tmpl::list<Tags::TildeE>>& inhomogeneous_terms,
+    const double implicit_weight) {
+  const auto& inhomogeneous_e = get<Tags::TildeE>(inhomogeneous_terms);
+  const size_t number_of_points = get(lapse).size();
+
+  Variables<tmpl::list<::Tags::Tempi<0, 3>, ::Tags::TempScalar<0>,
+                       ::Tags::TempScalar<1>, ::Tags::TempScalar<2>,
+                       ::Tags::TempScalar<3>, ::Tags::TempScalar<4>,
+                       ::Tags::TempScalar<5>, ::Tags::TempScalar<6>>>
+      buffer{number_of_points};
+  auto& tilde_b_one_form = get<::Tags::Tempi<0, 3>>(buffer);
+  DataVector& tilde_b_squared = get(get<::Tags::TempScalar<0>>(buffer));
+  DataVector& x_dot_tilde_b = get(get<::Tags::TempScalar<1>>(buffer));
+  DataVector& x_parallel_squared = get(get<::Tags::TempScalar<2>>(buffer));
+  DataVector& x_perp_squared = get(get<::Tags::TempScalar<3>>(buffer));
+  DataVector& coupling = get(get<::Tags::TempScalar<4>>(buffer));
+  DataVector& ratio = get(get<::Tags::TempScalar<5>>(buffer));
+  DataVector& perp_factor = get(get<::Tags::TempScalar<6>>(buffer));
+
+  raise_or_lower_index(make_not_null(&tilde_b_one_form), tilde_b,
+                       spatial_metric);
+  dot_product(make_not_null(&get<::Tags::TempScalar<0>>(buffer)), tilde_b,
+              tilde_b_one_form);
+  dot_product(make_not_null(&get<::Tags::TempScalar<1>>(buffer)),
+              inhomogeneous_e, tilde_b_one_form);
+  dot_product(make_not_null(&get<::Tags::TempScalar<3>>(buffer)),
+              inhomogeneous_e, inhomogeneous_e, spatial_metric);
+  x_parallel_squared = square(x_dot_tilde_b) / tilde_b_squared;
+  x_perp_squared -= x_parallel_squared;
+  coupling = (implicit_weight * parallel_conductivity) * get(lapse);
+
+  // Only the points where the solution is not magnetically dominated need to
+  // iterate for the ratio r, everything else is vectorized.
+  ratio = 0.0;
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double k = coupling[s];
+    const double b_squared = tilde_b_squared[s];
+    const double x_par_sq = x_parallel_squared[s];
+    const double x_perp_sq = x_perp_squared[s];
+    if (x_par_sq / square(1.0 + k) + x_perp_sq <= b_squared) {
+      continue;
+    }
+    constexpr size_t max_iterations = 100;
+    size_t iteration = 0;
+    for (; iteration < max_iterations; ++iteration) {
+      const double par = 1.0 / (1.0 + k + k * ratio[s]);
+      const double perp = 1.0 / (1.0 + k * ratio[s]);
+      const double f = x_par_sq * square(par) + x_perp_sq * square(perp) -
+                       b_squared * (1.0 + ratio[s]);
+      const double df =
+          -2.0 * k * (x_par_sq * cube(par) + x_perp_sq * cube(perp)) -
+          b_squared;
+      const double delta = -f / df;
+      ratio[s] += delta;
+      if (delta <= 1.0e-14 * (1.0 + ratio[s])) {
+        break;
+      }
+    }
+    if (iteration == max_iterations) {
+      ERROR("The implicit solve for the parallel current did not converge. "
+            "B^2 = "
+            << b_squared << ", X_parallel^2 = " << x_par_sq
+            << ", X_perp^2 = " << x_perp_sq << ", k = " << k);
+    }
+  }
+
+  // E^i = perp X^i + (par - perp) (X_j B^j / B^2) B^i
+  perp_factor = 1.0 / (1.0 + coupling * ratio);
+  x_dot_tilde_b *= (1.0 / (1.0 + coupling * (1.0 + ratio)) - perp_factor) /
+                   tilde_b_squared;
+  for (size_t i = 0; i < 3; ++i) {
+    tilde_e->get(i) =
+        perp_factor * inhomogeneous_e.get(i) + x_dot_tilde_b * tilde_b.get(i);
+  }
+  return {number_of_points, imex::GuessResult::ExactSolution};
+}
+}  // namespace ForceFree::Imex
@@ -0,0 +1,119 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <vector>
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Imex/GuessResult.hpp"
+#include "Evolution/Imex/Protocols/ImplicitSector.hpp"
+#include "Evolution/Systems/ForceFree/Tags.hpp"
+#include "PointwiseFunctions/GeneralRelativity/TagsDeclarations.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
+namespace ForceFree::Imex {
+/*!
+ * \brief The stiff source \f$S(\tilde{E}^i) = -\tilde{J}^i_\mathrm{parallel}\f$
+ * of the electric field.
+ *
+ * See ComputeParallelTildeJ for the parallel current density.
+ */
+struct ParallelCurrentSource {
+  using return_tags = tmpl::list<::Tags::Source<Tags::TildeE>>;
+  using argument_tags =
+      tmpl::list<Tags::TildeE, Tags::TildeB, Tags::TildeQ,
+                 Tags::ParallelConductivity, gr::Tags::Lapse<DataVector>,
+                 gr::Tags::SqrtDetSpatialMetric<DataVector>,
+                 gr::Tags::SpatialMetric<DataVector, 3>>;
+
+  static void apply(
+      gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*> source_tilde_e,
+      const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_e,
+      const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+      const Scalar<DataVector>& tilde_q, double parallel_conductivity,
+      const Scalar<DataVector>& lapse,
+      const Scalar<DataVector>& sqrt_det_spatial_metric,
+      const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric);
+};
+
+/*!
+ * \brief Solves the implicit equation \f$\tilde{E}^i = X^i + w
+ * S(\tilde{E}^i)\f$ of the ParallelCurrentSource exactly at every point.
+ *
+ * \details With \f$k = w\alpha\eta\f$ and \f$\tilde{B}^2 =
+ * \tilde{B}_i\tilde{B}^i\f$, split the inhomogeneous term into the parts
+ * \f$X^i_\parallel = (X_j\tilde{B}^j)\tilde{B}^i/\tilde{B}^2\f$ and
+ * \f$X^i_\perp = X^i - X^i_\parallel\f$ parallel and perpendicular to the
+ * magnetic field, which does not change during the implicit solve. The
+ * solution is then
+ *
+ * \f{align*}
+ *  \tilde{E}^i = \frac{X^i_\parallel}{1 + k + kr} + \frac{X^i_\perp}{1 + kr},
+ * \f}
+ *
+ * where \f$r = \mathcal{R}(\tilde{E}^2 - \tilde{B}^2) / \tilde{B}^2\f$. If the
+ * solution with \f$r = 0\f$ is magnetically dominated it is the solution.
+ * Otherwise \f$r > 0\f$ is the unique root of the convex, decreasing function
+ *
+ * \f{align*}
+ *  f(r) = \frac{X_\parallel^2}{(1 + k + kr)^2} + \frac{X_\perp^2}{(1 + kr)^2}
+ *    - \tilde{B}^2 (1 + r),
+ * \f}
+ *
+ * which Newton's method starting from \f$r = 0\f$ converges to monotonically.
+ * Only those points need an iteration, so the implicit solve is skipped
+ * everywhere and no jacobian is needed.
+ */
+struct ParallelCurrentImplicitSolve {
+  using return_tags = tmpl::list<Tags::TildeE>;
+  using argument_tags =
+      tmpl::list<Tags::TildeB, Tags::ParallelConductivity,
+                 gr::Tags::Lapse<DataVector>,
+                 gr::Tags::SpatialMetric<DataVector, 3>>;
+
+  static std::vector<imex::GuessResult> apply(
+      gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*> tilde_e,
+      const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+      double parallel_conductivity, const Scalar<DataVector>& lapse,
+      const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+      const Variables<tmpl::list<Tags::TildeE>>& inhomogeneous_terms,
+      double implicit_weight);
+};
+
+/// \brief The implicit sector for the stiff parallel current density, which
+/// is solved exactly by ParallelCurrentImplicitSolve.
+struct ParallelCurrentSector : tt::ConformsTo<imex::protocols::ImplicitSector> {
+  using tensors = tmpl::list<Tags::TildeE>;
+  using initial_guess = ParallelCurrentImplicitSolve;
+
+  struct SolveAttempt {
+    using tags_from_evolution =
+        tmpl::list<Tags::TildeB, Tags::TildeQ, Tags::ParallelConductivity,
+                   gr::Tags::Lapse<DataVector>,
+                   gr::Tags::SqrtDetSpatialMetric<DataVector>,
+                   gr::Tags::SpatialMetric<DataVector, 3>>;
+    using simple_tags = tmpl::list<>;
+    using compute_tags = tmpl::list<>;
+
+    using source_prep = tmpl::list<>;
+    using jacobian_prep = tmpl::list<>;
+
+    using source = ParallelCurrentSource;
+    using jacobian = imex::NoJacobianBecauseSolutionIsAnalytic;
+  };
+
+  using solve_attempts = tmpl::list<SolveAttempt>;
+};
+}  // namespace ForceFree::Imex
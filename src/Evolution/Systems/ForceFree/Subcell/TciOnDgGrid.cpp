@@ -28,13 +28,15 @@ std::tuple<int, evolution::dg::subcell::RdmpTciData> TciOnDgGrid::apply(
     const evolution::dg::subcell::RdmpTciData& past_rdmp_tci_data,
     const TciOptions& tci_options,
     const evolution::dg::subcell::SubcellOptions& subcell_options,
-    const double persson_exponent, bool /*element_stays_on_dg*/) {
+    const double persson_exponent, bool /*element_stays_on_dg*/,
+    const bool rdmp_needs_projection) {
   evolution::dg::subcell::RdmpTciData rdmp_tci_data{};
 
   const size_t num_dg_pts = dg_mesh.number_of_grid_points();
   const size_t num_subcell_pts = subcell_mesh.number_of_grid_points();
 
-  DataVector temp_buffer{2 * num_dg_pts + 2 * num_subcell_pts};
+  DataVector temp_buffer{2 * num_dg_pts +
+                         (rdmp_needs_projection ? 2 * num_subcell_pts : 0)};
   size_t offset_into_temp_buffer = 0;
   const auto assign_data =
       [&temp_buffer, &offset_into_temp_buffer](
@@ -52,31 +54,46 @@ std::tuple<int, evolution::dg::subcell::RdmpTciData> TciOnDgGrid::apply(
   // then compute magnitudes of them.
 
   Scalar<DataVector> dg_mag_tilde_e{};
-  Scalar<DataVector> subcell_mag_tilde_e{};
   assign_data(make_not_null(&dg_mag_tilde_e), num_dg_pts);
   magnitude(make_not_null(&dg_mag_tilde_e), tilde_e);
-  assign_data(make_not_null(&subcell_mag_tilde_e), num_subcell_pts);
-  evolution::dg::subcell::fd::project(make_not_null(&get(subcell_mag_tilde_e)),
-                                      get(dg_mag_tilde_e), dg_mesh,
-                                      subcell_mesh.extents());
 
   Scalar<DataVector> dg_mag_tilde_b{};
-  Scalar<DataVector> subcell_mag_tilde_b{};
   assign_data(make_not_null(&dg_mag_tilde_b), num_dg_pts);
   magnitude(make_not_null(&dg_mag_tilde_b), tilde_b);
-  assign_data(make_not_null(&subcell_mag_tilde_b), num_subcell_pts);
-  evolution::dg::subcell::fd::project(make_not_null(&get(subcell_mag_tilde_b)),
-                                      get(dg_mag_tilde_b), dg_mesh,
-                                      subcell_mesh.extents());
 
   using std::max;
   using std::min;
   rdmp_tci_data.max_variables_values =
-      DataVector{max(max(get(subcell_mag_tilde_e)), max(get(dg_mag_tilde_e))),
-                 max(max(get(subcell_mag_tilde_b)), max(get(dg_mag_tilde_b)))};
+      DataVector{max(get(dg_mag_tilde_e)), max(get(dg_mag_tilde_b))};
   rdmp_tci_data.min_variables_values =
-      DataVector{min(min(get(subcell_mag_tilde_e)), min(get(dg_mag_tilde_e))),
-                 min(min(get(subcell_mag_tilde_b)), min(get(dg_mag_tilde_b)))};
+      DataVector{min(get(dg_mag_tilde_e)), min(get(dg_mag_tilde_b))};
+
+  if (rdmp_needs_projection) {
+    Scalar<DataVector> subcell_mag_tilde_e{};
+    assign_data(make_not_null(&subcell_mag_tilde_e), num_subcell_pts);
+    evolution::dg::subcell::fd::project(
+        make_not_null(&get(subcell_mag_tilde_e)), get(dg_mag_tilde_e), dg_mesh,
+        subcell_mesh.extents());
+
+    Scalar<DataVector> subcell_mag_tilde_b{};
+    assign_data(make_not_null(&subcell_mag_tilde_b), num_subcell_pts);
+    evolution::dg::subcell::fd::project(
+        make_not_null(&get(subcell_mag_tilde_b)), get(dg_mag_tilde_b), dg_mesh,
+        subcell_mesh.extents());
+
+    rdmp_tci_data.max_variables_values[0] =
+        max(rdmp_tci_data.max_variables_values[0],
+            max(get(subcell_mag_tilde_e)));
+    rdmp_tci_data.max_variables_values[1] =
+        max(rdmp_tci_data.max_variables_values[1],
+            max(get(subcell_mag_tilde_b)));
+    rdmp_tci_data.min_variables_values[0] =
+        min(rdmp_tci_data.min_variables_values[0],
+            min(get(subcell_mag_tilde_e)));
+    rdmp_tci_data.min_variables_values[1] =
+        min(rdmp_tci_data.min_variables_values[1],
+            min(get(subcell_mag_tilde_b)));
+  }
 
   if (evolution::dg::subcell::persson_tci(
           dg_mag_tilde_e, dg_mesh, persson_exponent,
@@ -71,6 +71,10 @@ namespace ForceFree::subcell {
  * squared, _not_ the square root of the scalar product using the spatial
  * metric.
  *
+ * The magnitudes are only projected to the subcells for the RDMP TCI if
+ * `rdmp_needs_projection` is `true`, see
+ * `evolution::dg::subcell::Actions::TciAndRollback`.
+ *
  * \note We adopt negative integers to mark TCI status from DG grid returned by
  * TciOnDgGrid class. Positive integers are used for TCIs on FD grid; see
  * TciOnFdGrid and its documentation.
@@ -94,7 +98,8 @@ class TciOnDgGrid {
       const evolution::dg::subcell::RdmpTciData& past_rdmp_tci_data,
       const TciOptions& tci_options,
       const evolution::dg::subcell::SubcellOptions& subcell_options,
-      double persson_exponent, bool /*element_stays_on_dg*/);
+      double persson_exponent, bool /*element_stays_on_dg*/,
+      bool rdmp_needs_projection);
 };
 
 }  // namespace ForceFree::subcell
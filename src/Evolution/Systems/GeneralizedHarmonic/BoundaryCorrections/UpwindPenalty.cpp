@@ -9,9 +9,9 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "DataStructures/Variables.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
@@ -90,13 +90,6 @@ double UpwindPenalty<Dim>::dg_package_data(
     get<3>(*packaged_char_speeds) -= get(*normal_dot_mesh_velocity);
   }
 
-  for (size_t a = 0; a < Dim + 1; ++a) {
-    for (size_t b = a; b < Dim + 1; ++b) {
-      packaged_char_speed_gamma2_v_spacetime_metric->get(a, b) =
-          get(constraint_gamma2) * spacetime_metric.get(a, b);
-    }
-  }
-
   // Computes the contribution to the boundary correction from one side of the
   // interface.
   //
@@ -104,52 +97,43 @@ double UpwindPenalty<Dim>::dg_package_data(
   // in its own packaged data to fill the interior fields, and its neighbor's
   // packaged data to fill the exterior fields. This introduces a sign flip for
   // each normal used in computing the exterior fields.
-  // Use v_psi allocation as n^i Phi_i
-  {
-    tnsr::aa<DataVector, Dim, Frame::Inertial>& normal_dot_phi =
-        *packaged_char_speed_v_spacetime_metric;
-    for (size_t a = 0; a < Dim + 1; ++a) {
-      for (size_t b = a; b < Dim + 1; ++b) {
-        normal_dot_phi.get(a, b) = get<0>(normal_vector) * phi.get(0, a, b);
-        for (size_t i = 1; i < Dim; ++i) {
-          normal_dot_phi.get(a, b) += normal_vector.get(i) * phi.get(i, a, b);
-        }
+  //
+  // All characteristic fields of a component are computed in a single pass so
+  // that n^i Phi_i and gamma_2 psi are used while they are still in cache,
+  // instead of sweeping over every packaged tensor several times. The
+  // v_spacetime_metric allocation holds n^i Phi_i until it is overwritten.
+  for (size_t a = 0; a < Dim + 1; ++a) {
+    for (size_t b = a; b < Dim + 1; ++b) {
+      DataVector& normal_dot_phi =
+          packaged_char_speed_v_spacetime_metric->get(a, b);
+      normal_dot_phi = get<0>(normal_vector) * phi.get(0, a, b);
+      for (size_t i = 1; i < Dim; ++i) {
+        normal_dot_phi += normal_vector.get(i) * phi.get(i, a, b);
       }
-    }
+      DataVector& gamma2_v_spacetime_metric =
+          packaged_char_speed_gamma2_v_spacetime_metric->get(a, b);
+      gamma2_v_spacetime_metric =
+          get(constraint_gamma2) * spacetime_metric.get(a, b);
 
-    for (size_t a = 0; a < Dim + 1; ++a) {
-      for (size_t b = a; b < Dim + 1; ++b) {
-        packaged_char_speed_v_plus->get(a, b) =
-            get<2>(*packaged_char_speeds) *
-            (pi.get(a, b) + normal_dot_phi.get(a, b) -
-             packaged_char_speed_gamma2_v_spacetime_metric->get(a, b));
-        packaged_char_speed_v_minus->get(a, b) =
-            get<3>(*packaged_char_speeds) *
-            (pi.get(a, b) - normal_dot_phi.get(a, b) -
-             packaged_char_speed_gamma2_v_spacetime_metric->get(a, b));
-
-        for (size_t i = 0; i < Dim; ++i) {
-          packaged_char_speed_v_zero->get(i, a, b) =
-              get<1>(*packaged_char_speeds) *
-              (phi.get(i, a, b) -
-               normal_covector.get(i) * normal_dot_phi.get(a, b));
-        }
+      DataVector& v_plus = packaged_char_speed_v_plus->get(a, b);
+      v_plus = get<2>(*packaged_char_speeds) *
+               (pi.get(a, b) + normal_dot_phi - gamma2_v_spacetime_metric);
+      DataVector& v_minus = packaged_char_speed_v_minus->get(a, b);
+      v_minus = get<3>(*packaged_char_speeds) *
+                (pi.get(a, b) - normal_dot_phi - gamma2_v_spacetime_metric);
+      for (size_t i = 0; i < Dim; ++i) {
+        packaged_char_speed_v_zero->get(i, a, b) =
+            get<1>(*packaged_char_speeds) *
+            (phi.get(i, a, b) - normal_covector.get(i) * normal_dot_phi);
+        packaged_char_speed_n_times_v_plus->get(i, a, b) =
+            v_plus * normal_covector.get(i);
+        packaged_char_speed_n_times_v_minus->get(i, a, b) =
+            v_minus * normal_covector.get(i);
       }
-    }
-  }
 
-  for (size_t a = 0; a < Dim + 1; ++a) {
-    for (size_t b = a; b < Dim + 1; ++b) {
-      for (size_t d = 0; d < Dim; ++d) {
-        packaged_char_speed_n_times_v_plus->get(d, a, b) =
-            packaged_char_speed_v_plus->get(a, b) * normal_covector.get(d);
-        packaged_char_speed_n_times_v_minus->get(d, a, b) =
-            packaged_char_speed_v_minus->get(a, b) * normal_covector.get(d);
-      }
-      packaged_char_speed_v_spacetime_metric->get(a, b) =
+      normal_dot_phi =
           get<0>(*packaged_char_speeds) * spacetime_metric.get(a, b);
-      packaged_char_speed_gamma2_v_spacetime_metric->get(a, b) *=
-          get<0>(*packaged_char_speeds);
+      gamma2_v_spacetime_metric *= get<0>(*packaged_char_speeds);
     }
   }
 
@@ -193,10 +177,12 @@ void UpwindPenalty<Dim>::dg_boundary_terms(
     const tnsr::a<DataVector, 3, Frame::Inertial>& char_speeds_ext,
     dg::Formulation /*dg_formulation*/) const {
   const size_t num_pts = char_speeds_int[0].size();
-  Variables<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
-                       ::Tags::TempScalar<2>, ::Tags::TempScalar<3>,
-                       ::Tags::TempScalar<4>, ::Tags::TempScalar<5>,
-                       ::Tags::TempScalar<6>, ::Tags::TempScalar<7>>>
+  // This is called for every mortar of every element, so take the buffer from
+  // the scratch arena instead of the heap
+  TempBuffer<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
+                        ::Tags::TempScalar<2>, ::Tags::TempScalar<3>,
+                        ::Tags::TempScalar<4>, ::Tags::TempScalar<5>,
+                        ::Tags::TempScalar<6>, ::Tags::TempScalar<7>>>
       buffer(num_pts);
   DataVector& weighted_lambda_spacetime_metric_int =
       get(get<::Tags::TempScalar<0>>(buffer));
@@ -3,6 +3,7 @@
 
 #include "Evolution/Systems/GeneralizedHarmonic/Constraints.hpp"
 
+#include <cmath>
 #include <cstddef>
 
 #include "DataStructures/LeviCivitaIterator.hpp"
@@ -961,6 +962,37 @@ void three_index_constraint(
   }
 }
 
+template <typename DataType, size_t SpatialDim, typename Frame>
+Scalar<DataType> three_index_constraint_pointwise_l2_norm(
+    const tnsr::iaa<DataType, SpatialDim, Frame>& d_spacetime_metric,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& phi) {
+  Scalar<DataType> norm{get_size(get<0, 0, 0>(phi))};
+  three_index_constraint_pointwise_l2_norm<DataType, SpatialDim, Frame>(
+      make_not_null(&norm), d_spacetime_metric, phi);
+  return norm;
+}
+
+template <typename DataType, size_t SpatialDim, typename Frame>
+void three_index_constraint_pointwise_l2_norm(
+    const gsl::not_null<Scalar<DataType>*> norm,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& d_spacetime_metric,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& phi) {
+  set_number_of_grid_points(norm, phi);
+  get(*norm) = 0.0;
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    for (size_t a = 0; a < SpatialDim + 1; ++a) {
+      get(*norm) += square(d_spacetime_metric.get(i, a, a) - phi.get(i, a, a));
+      // The off-diagonal components appear twice in the sum because of the
+      // symmetry in a and b
+      for (size_t b = a + 1; b < SpatialDim + 1; ++b) {
+        get(*norm) +=
+            2.0 * square(d_spacetime_metric.get(i, a, b) - phi.get(i, a, b));
+      }
+    }
+  }
+  get(*norm) = sqrt(get(*norm));
+}
+
 template <typename DataType, size_t SpatialDim, typename Frame>
 tnsr::a<DataType, SpatialDim, Frame> gauge_constraint(
     const tnsr::a<DataType, SpatialDim, Frame>& gauge_function,
@@ -1399,6 +1431,15 @@ void constraint_energy_normalization(
       const tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>&                   \
           d_spacetime_metric,                                                 \
       const tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>& phi);             \
+  template Scalar<DTYPE(data)> gh::three_index_constraint_pointwise_l2_norm(  \
+      const tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>&                   \
+          d_spacetime_metric,                                                 \
+      const tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>& phi);             \
+  template void gh::three_index_constraint_pointwise_l2_norm(                 \
+      const gsl::not_null<Scalar<DTYPE(data)>*> norm,                         \
+      const tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>&                   \
+          d_spacetime_metric,                                                 \
+      const tnsr::iaa<DTYPE(data), DIM(data), FRAME(data)>& phi);             \
   template tnsr::a<DTYPE(data), DIM(data), FRAME(data)> gh::gauge_constraint( \
       const tnsr::a<DTYPE(data), DIM(data), FRAME(data)>& gauge_function,     \
       const tnsr::a<DTYPE(data), DIM(data), FRAME(data)>&                     \
@@ -11,6 +11,7 @@
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/Norms.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
@@ -46,6 +47,29 @@ void three_index_constraint(
     const tnsr::iaa<DataType, SpatialDim, Frame>& phi);
 /// @}
 
+/// @{
+/*!
+ * \brief Computes the point-wise Euclidean \f$L^2\f$-norm of the
+ * generalized-harmonic 3-index constraint.
+ *
+ * \details Computes the same quantity as `pointwise_l2_norm()` of the result
+ * of `three_index_constraint()`, but accumulates the squares of the components
+ * \f$C_{iab} = \partial_i\psi_{ab} - \Phi_{iab}\f$ directly instead of
+ * storing the constraint tensor first. This is useful for monitoring the
+ * constraint, where only the norm is observed.
+ */
+template <typename DataType, size_t SpatialDim, typename Frame>
+Scalar<DataType> three_index_constraint_pointwise_l2_norm(
+    const tnsr::iaa<DataType, SpatialDim, Frame>& d_spacetime_metric,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& phi);
+
+template <typename DataType, size_t SpatialDim, typename Frame>
+void three_index_constraint_pointwise_l2_norm(
+    gsl::not_null<Scalar<DataType>*> norm,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& d_spacetime_metric,
+    const tnsr::iaa<DataType, SpatialDim, Frame>& phi);
+/// @}
+
 /// @{
 /*!
  * \brief Computes the generalized-harmonic gauge constraint.
@@ -746,6 +770,38 @@ struct ThreeIndexConstraintCompute
   using base = ThreeIndexConstraint<DataVector, SpatialDim, Frame>;
 };
 
+/*!
+ * \brief Compute item to get the point-wise Euclidean \f$L^2\f$-norm of the
+ * three-index constraint for the generalized harmonic evolution system.
+ *
+ * \details See `three_index_constraint_pointwise_l2_norm()`. Can be retrieved
+ * using `::Tags::PointwiseL2Norm<gh::Tags::ThreeIndexConstraint>`, so it can
+ * replace `::Tags::PointwiseL2NormCompute<gh::Tags::ThreeIndexConstraint>`
+ * when the constraint is observed through its norm. The derivative of the
+ * spacetime metric is the one already computed for the time derivative.
+ */
+template <size_t SpatialDim, typename Frame>
+struct ThreeIndexConstraintPointwiseL2NormCompute
+    : ::Tags::PointwiseL2Norm<
+          ThreeIndexConstraint<DataVector, SpatialDim, Frame>>,
+      db::ComputeTag {
+  using argument_tags = tmpl::list<
+      ::Tags::deriv<gr::Tags::SpacetimeMetric<DataVector, SpatialDim, Frame>,
+                    tmpl::size_t<SpatialDim>, Frame>,
+      Phi<DataVector, SpatialDim, Frame>>;
+
+  using return_type = Scalar<DataVector>;
+
+  static constexpr auto function = static_cast<void (*)(
+      gsl::not_null<Scalar<DataVector>*>,
+      const tnsr::iaa<DataVector, SpatialDim, Frame>&,
+      const tnsr::iaa<DataVector, SpatialDim, Frame>&)>(
+      &three_index_constraint_pointwise_l2_norm<DataVector, SpatialDim, Frame>);
+
+  using base = ::Tags::PointwiseL2Norm<
+      ThreeIndexConstraint<DataVector, SpatialDim, Frame>>;
+};
+
 /*!
  * \brief Compute item to get the four-index constraint for the
  * generalized harmonic evolution system.
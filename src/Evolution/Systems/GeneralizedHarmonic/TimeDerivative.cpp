@@ -6,8 +6,8 @@
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ExtractPoint.hpp"
 #include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
-#include "DataStructures/Tensor/EagerMath/Trace.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/DuDtTempTags.hpp"
@@ -25,6 +25,8 @@
 #include "PointwiseFunctions/GeneralRelativity/SpatialMetric.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace gh {
 template <size_t Dim>
@@ -95,8 +97,6 @@ void TimeDerivative<Dim>::apply(
                           spatial_metric);
   gr::shift(shift, spacetime_metric, *inverse_spatial_metric);
   gr::lapse(lapse, *shift, spacetime_metric);
-  gr::inverse_spacetime_metric(inverse_spacetime_metric, *lapse, *shift,
-                               *inverse_spatial_metric);
   // Compute the part of the dt_spacetime_metric equation that doesn't involve
   // constraints so we can use it for da_spacetime_metric to compute Christoffel
   // symbols.
@@ -122,11 +122,71 @@ void TimeDerivative<Dim>::apply(
     }
   }
 
-  gr::christoffel_first_kind(christoffel_first_kind,
-                             da_spacetime_metric.value());
-  trace_last_indices(trace_christoffel, *christoffel_first_kind,
-                     *inverse_spacetime_metric);
-  gr::spacetime_normal_vector(normal_spacetime_vector, *lapse, *shift);
+  // The inverse spacetime metric, the normal vector, and the Christoffel
+  // symbols with their trace and raised last index only depend on each other
+  // pointwise. They are evaluated for a SIMD batch of points at a time, so the
+  // intermediate results stay in registers instead of taking one pass through
+  // memory per tensor component.
+  for_each_simd_batch(
+      number_of_points, [&](const size_t index, const auto use_simd) {
+        using DataType = tmpl::conditional_t<decltype(use_simd)::value,
+                                             simd::batch<double>, double>;
+        Scalar<DataType> lapse_batch{};
+        tnsr::I<DataType, Dim> shift_batch{};
+        tnsr::II<DataType, Dim> inverse_spatial_metric_batch{};
+        tnsr::abb<DataType, Dim> da_spacetime_metric_batch{};
+        extract_point(make_not_null(&lapse_batch), *lapse, index);
+        extract_point(make_not_null(&shift_batch), *shift, index);
+        extract_point(make_not_null(&inverse_spatial_metric_batch),
+                      *inverse_spatial_metric, index);
+        extract_point(make_not_null(&da_spacetime_metric_batch),
+                      da_spacetime_metric.value(), index);
+
+        tnsr::AA<DataType, Dim> inverse_spacetime_metric_batch{};
+        gr::inverse_spacetime_metric(
+            make_not_null(&inverse_spacetime_metric_batch), lapse_batch,
+            shift_batch, inverse_spatial_metric_batch);
+        tnsr::A<DataType, Dim> normal_spacetime_vector_batch{};
+        gr::spacetime_normal_vector(
+            make_not_null(&normal_spacetime_vector_batch), lapse_batch,
+            shift_batch);
+        tnsr::abb<DataType, Dim> christoffel_first_kind_batch{};
+        gr::christoffel_first_kind(make_not_null(&christoffel_first_kind_batch),
+                                   da_spacetime_metric_batch);
+
+        tnsr::abC<DataType, Dim> christoffel_first_kind_3_up_batch{};
+        tnsr::a<DataType, Dim> trace_christoffel_batch{};
+        for (size_t mu = 0; mu < Dim + 1; ++mu) {
+          for (size_t nu = 0; nu < Dim + 1; ++nu) {
+            for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
+              christoffel_first_kind_3_up_batch.get(mu, nu, alpha) =
+                  inverse_spacetime_metric_batch.get(alpha, 0) *
+                  christoffel_first_kind_batch.get(mu, nu, 0);
+              for (size_t beta = 1; beta < Dim + 1; ++beta) {
+                christoffel_first_kind_3_up_batch.get(mu, nu, alpha) +=
+                    inverse_spacetime_metric_batch.get(alpha, beta) *
+                    christoffel_first_kind_batch.get(mu, nu, beta);
+              }
+            }
+          }
+          trace_christoffel_batch.get(mu) =
+              christoffel_first_kind_3_up_batch.get(mu, 0, 0);
+          for (size_t nu = 1; nu < Dim + 1; ++nu) {
+            trace_christoffel_batch.get(mu) +=
+                christoffel_first_kind_3_up_batch.get(mu, nu, nu);
+          }
+        }
+
+        overwrite_point(inverse_spacetime_metric,
+                        inverse_spacetime_metric_batch, index);
+        overwrite_point(normal_spacetime_vector, normal_spacetime_vector_batch,
+                        index);
+        overwrite_point(christoffel_first_kind, christoffel_first_kind_batch,
+                        index);
+        overwrite_point(christoffel_first_kind_3_up,
+                        christoffel_first_kind_3_up_batch, index);
+        overwrite_point(trace_christoffel, trace_christoffel_batch, index);
+      });
 
   get(*gamma1gamma2) = get(gamma1) * get(gamma2);
   const DataVector& gamma12 = get(*gamma1gamma2);
@@ -168,21 +228,6 @@ void TimeDerivative<Dim>::apply(
     }
   }
 
-  for (size_t mu = 0; mu < Dim + 1; ++mu) {
-    for (size_t nu = 0; nu < Dim + 1; ++nu) {
-      for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
-        christoffel_first_kind_3_up->get(mu, nu, alpha) =
-            inverse_spacetime_metric->get(alpha, 0) *
-            christoffel_first_kind->get(mu, nu, 0);
-        for (size_t beta = 1; beta < Dim + 1; ++beta) {
-          christoffel_first_kind_3_up->get(mu, nu, alpha) +=
-              inverse_spacetime_metric->get(alpha, beta) *
-              christoffel_first_kind->get(mu, nu, beta);
-        }
-      }
-    }
-  }
-
   for (size_t mu = 0; mu < Dim + 1; ++mu) {
     pi_one_normal->get(mu) = get<0>(*normal_spacetime_vector) * pi.get(0, mu);
     for (size_t nu = 1; nu < Dim + 1; ++nu) {
@@ -49,6 +49,7 @@
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&    \
           mesh_velocity,                                                       \
       const std::optional<Scalar<DataVector>>& div_mesh_velocity,              \
+      const VolumeTermsStage stage,                                            \
       const tnsr::aa<DataVector, DIM(data)>& spacetime_metric,                 \
       const tnsr::aa<DataVector, DIM(data)>& pi,                               \
       const tnsr::iaa<DataVector, DIM(data)>& phi,                             \
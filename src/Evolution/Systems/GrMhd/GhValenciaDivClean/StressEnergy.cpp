@@ -3,39 +3,17 @@
 
 #include "Evolution/Systems/GrMhd/GhValenciaDivClean/StressEnergy.hpp"
 
+#include <array>
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "PointwiseFunctions/Hydro/ComovingMagneticField.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/SetNumberOfGridPoints.hpp"
 
 namespace grmhd::GhValenciaDivClean {
 
-namespace {
-// spatial components of the four-velocity are:
-// u^i = W(v^i - \beta^i / \alpha)
-// so the down-index spatial components are
-// u_i = W v_i
-//
-// u_0 = - \alpha W + \beta^i u_i
-void four_velocity_one_form(
-    const gsl::not_null<tnsr::a<DataVector, 3>*> four_velocity_one_form_result,
-    const tnsr::i<DataVector, 3, Frame::Inertial>& spatial_velocity_one_form,
-    const Scalar<DataVector>& lorentz_factor,
-    const tnsr::I<DataVector, 3, Frame::Inertial>& shift,
-    const Scalar<DataVector>& lapse) {
-  get<0>(*four_velocity_one_form_result) = -get(lapse) * get(lorentz_factor);
-  for (size_t i = 0; i < 3; ++i) {
-    four_velocity_one_form_result->get(i + 1) =
-        get(lorentz_factor) * spatial_velocity_one_form.get(i);
-    get<0>(*four_velocity_one_form_result) +=
-        shift.get(i) * four_velocity_one_form_result->get(i + 1);
-  }
-}
-}  // namespace
-
 void add_stress_energy_term_to_dt_pi(
     const gsl::not_null<tnsr::aa<DataVector, 3>*> dt_pi,
     const tnsr::aa<DataVector, 3>& trace_reversed_stress_energy,
@@ -65,32 +43,57 @@ void trace_reversed_stress_energy(
     const tnsr::aa<DataVector, 3, Frame::Inertial>& spacetime_metric,
     const tnsr::I<DataVector, 3, Frame::Inertial>& shift,
     const Scalar<DataVector>& lapse) {
-  four_velocity_one_form(four_velocity_one_form_buffer,
-                         spatial_velocity_one_form, lorentz_factor, shift,
-                         lapse);
-
-  // 3,3 component will be the last component assigned, so we can use it as a
-  // temporary buffer
-  auto& modified_enthalpy_times_rest_mass = get<3, 3>(*stress_energy);
-  modified_enthalpy_times_rest_mass =
-      get(rest_mass_density) * (1.0 + get(specific_internal_energy)) +
-      get(pressure) + square(get(magnetic_field_dot_spatial_velocity)) +
-      get(magnetic_field_squared) * get(one_over_w_squared);
+  // All quantities are computed point by point in a single pass over the
+  // grid, so that no intermediate tensors are swept through memory. The four
+  // velocity and comoving magnetic field are still written to their buffers.
+  const size_t number_of_points = get(lapse).size();
+  set_number_of_grid_points(stress_energy, number_of_points);
+  set_number_of_grid_points(four_velocity_one_form_buffer, number_of_points);
+  set_number_of_grid_points(comoving_magnetic_field_one_form_buffer,
+                            number_of_points);
+  std::array<double, 4> four_velocity{};
+  std::array<double, 4> comoving_magnetic_field{};
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double w = get(lorentz_factor)[s];
+    const double b_dot_v = get(magnetic_field_dot_spatial_velocity)[s];
+    // spatial components of the four-velocity are:
+    // u^i = W(v^i - \beta^i / \alpha)
+    // so the down-index spatial components are
+    // u_i = W v_i
+    //
+    // u_0 = - \alpha W + \beta^i u_i
+    four_velocity[0] = -get(lapse)[s] * w;
+    comoving_magnetic_field[0] = four_velocity[0] * b_dot_v;
+    for (size_t i = 0; i < 3; ++i) {
+      const double v_i = spatial_velocity_one_form.get(i)[s];
+      gsl::at(four_velocity, i + 1) = w * v_i;
+      gsl::at(comoving_magnetic_field, i + 1) =
+          magnetic_field_one_form.get(i)[s] / w + w * b_dot_v * v_i;
+      four_velocity[0] += shift.get(i)[s] * gsl::at(four_velocity, i + 1);
+      comoving_magnetic_field[0] +=
+          shift.get(i)[s] * gsl::at(comoving_magnetic_field, i + 1);
+    }
+    for (size_t a = 0; a < 4; ++a) {
+      four_velocity_one_form_buffer->get(a)[s] = gsl::at(four_velocity, a);
+      comoving_magnetic_field_one_form_buffer->get(a)[s] =
+          gsl::at(comoving_magnetic_field, a);
+    }
 
-  hydro::comoving_magnetic_field_one_form(
-      comoving_magnetic_field_one_form_buffer, spatial_velocity_one_form,
-      magnetic_field_one_form, magnetic_field_dot_spatial_velocity,
-      lorentz_factor, shift, lapse);
-  for (size_t a = 0; a < 4; ++a) {
-    for (size_t b = a; b < 4; ++b) {
-      stress_energy->get(a, b) =
-          modified_enthalpy_times_rest_mass *
-              four_velocity_one_form_buffer->get(a) *
-              four_velocity_one_form_buffer->get(b) +
-          (0.5 * modified_enthalpy_times_rest_mass - get(pressure)) *
-              spacetime_metric.get(a, b) -
-          comoving_magnetic_field_one_form_buffer->get(a) *
-              comoving_magnetic_field_one_form_buffer->get(b);
+    const double modified_enthalpy_times_rest_mass =
+        get(rest_mass_density)[s] * (1.0 + get(specific_internal_energy)[s]) +
+        get(pressure)[s] + square(b_dot_v) +
+        get(magnetic_field_squared)[s] * get(one_over_w_squared)[s];
+    const double metric_factor =
+        0.5 * modified_enthalpy_times_rest_mass - get(pressure)[s];
+    for (size_t a = 0; a < 4; ++a) {
+      for (size_t b = a; b < 4; ++b) {
+        stress_energy->get(a, b)[s] =
+            modified_enthalpy_times_rest_mass * gsl::at(four_velocity, a) *
+                gsl::at(four_velocity, b) +
+            metric_factor * spacetime_metric.get(a, b)[s] -
+            gsl::at(comoving_magnetic_field, a) *
+                gsl::at(comoving_magnetic_field, b);
+      }
     }
   }
 }
@@ -96,6 +96,10 @@ void add_stress_energy_term_to_dt_pi(
  * = \rho h^* u_\mu u_\nu  + \left(\frac{1}{2} \rho h^* - p\right) g_{\mu \nu}
  *  - b_\mu b_\nu
  * \f]
+ *
+ * All quantities are computed point by point in a single pass over the grid.
+ * The four-velocity and comoving magnetic field one-forms are also written to
+ * the buffers passed in.
  */
 void trace_reversed_stress_energy(
     gsl::not_null<tnsr::aa<DataVector, 3>*> stress_energy,
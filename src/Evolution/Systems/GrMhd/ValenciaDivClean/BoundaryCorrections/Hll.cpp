@@ -9,6 +9,7 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
@@ -147,9 +148,10 @@ void Hll::dg_boundary_terms(
     const Scalar<DataVector>& largest_outgoing_char_speed_ext,
     const Scalar<DataVector>& largest_ingoing_char_speed_ext,
     const dg::Formulation dg_formulation) {
-  // Allocate a temp buffer with four tags.
-  Variables<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
-                       ::Tags::TempScalar<2>, ::Tags::TempScalar<3>>>
+  // Take a temp buffer with four tags from the scratch arena, since this is
+  // called for every mortar of every element.
+  TempBuffer<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
+                        ::Tags::TempScalar<2>, ::Tags::TempScalar<3>>>
       temps{get(tilde_d_int).size()};
 
   // Determine lambda_max and lambda_min from the characteristic speeds info
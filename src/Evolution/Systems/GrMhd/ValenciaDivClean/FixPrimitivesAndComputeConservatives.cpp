@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/FixPrimitivesAndComputeConservatives.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/System.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"
+#include "Evolution/VariableFixing/FixToAtmosphere.hpp"
+#include "Evolution/VariableFixing/LimitLorentzFactor.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
+#include "PointwiseFunctions/Hydro/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace grmhd::ValenciaDivClean {
+void FixPrimitivesAndComputeConservatives::apply(
+    const gsl::not_null<typename System::variables_tag::type*>
+        conserved_vars_ptr,
+    const gsl::not_null<Variables<hydro::grmhd_tags<DataVector>>*>
+        primitive_vars_ptr,
+    const VariableFixing::FixToAtmosphere<3>& fix_to_atmosphere,
+    const VariableFixing::LimitLorentzFactor& limit_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, 3>& eos,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+    const Scalar<DataVector>& sqrt_det_spatial_metric) {
+  const auto rest_mass_density = make_not_null(
+      &get<hydro::Tags::RestMassDensity<DataVector>>(*primitive_vars_ptr));
+  const auto specific_internal_energy =
+      make_not_null(&get<hydro::Tags::SpecificInternalEnergy<DataVector>>(
+          *primitive_vars_ptr));
+  const auto spatial_velocity = make_not_null(
+      &get<hydro::Tags::SpatialVelocity<DataVector, 3>>(*primitive_vars_ptr));
+  const auto lorentz_factor = make_not_null(
+      &get<hydro::Tags::LorentzFactor<DataVector>>(*primitive_vars_ptr));
+  const auto pressure = make_not_null(
+      &get<hydro::Tags::Pressure<DataVector>>(*primitive_vars_ptr));
+  const auto temperature = make_not_null(
+      &get<hydro::Tags::Temperature<DataVector>>(*primitive_vars_ptr));
+  const auto& electron_fraction =
+      get<hydro::Tags::ElectronFraction<DataVector>>(*primitive_vars_ptr);
+
+  const bool limit_lorentz_factor_enabled = limit_lorentz_factor.is_enabled();
+  const size_t number_of_grid_points =
+      primitive_vars_ptr->number_of_grid_points();
+  for (size_t i = 0; i < number_of_grid_points; ++i) {
+    const bool set_to_atmosphere = fix_to_atmosphere.fix_point(
+        rest_mass_density, specific_internal_energy, spatial_velocity,
+        lorentz_factor, pressure, temperature, electron_fraction,
+        spatial_metric, eos, i);
+    if (limit_lorentz_factor_enabled and not set_to_atmosphere) {
+      limit_lorentz_factor.limit_point(lorentz_factor, spatial_velocity,
+                                       *rest_mass_density, i);
+    }
+  }
+
+  ConservativeFromPrimitive::apply(
+      make_not_null(&get<Tags::TildeD>(*conserved_vars_ptr)),
+      make_not_null(&get<Tags::TildeYe>(*conserved_vars_ptr)),
+      make_not_null(&get<Tags::TildeTau>(*conserved_vars_ptr)),
+      make_not_null(&get<Tags::TildeS<Frame::Inertial>>(*conserved_vars_ptr)),
+      make_not_null(&get<Tags::TildeB<Frame::Inertial>>(*conserved_vars_ptr)),
+      make_not_null(&get<Tags::TildePhi>(*conserved_vars_ptr)),
+      *rest_mass_density, electron_fraction, *specific_internal_energy,
+      *pressure, *spatial_velocity, *lorentz_factor,
+      get<hydro::Tags::MagneticField<DataVector, 3>>(*primitive_vars_ptr),
+      sqrt_det_spatial_metric, spatial_metric,
+      get<hydro::Tags::DivergenceCleaningField<DataVector>>(
+          *primitive_vars_ptr));
+}
+}  // namespace grmhd::ValenciaDivClean
@@ -0,0 +1,62 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/System.hpp"
+#include "Evolution/VariableFixing/FixToAtmosphere.hpp"
+#include "Evolution/VariableFixing/LimitLorentzFactor.hpp"
+#include "Evolution/VariableFixing/Tags.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "PointwiseFunctions/Hydro/Tags.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+namespace EquationsOfState {
+template <bool IsRelativistic, size_t ThermodynamicDim>
+class EquationOfState;
+}  // namespace EquationsOfState
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+template <typename TagsList>
+class Variables;
+/// \endcond
+
+namespace grmhd::ValenciaDivClean {
+/*!
+ * \brief Fix the primitive variables to the atmosphere, limit the Lorentz
+ * factor, and compute the conservative variables from the fixed primitives.
+ *
+ * This is equivalent to applying `VariableFixing::FixToAtmosphere`,
+ * `VariableFixing::LimitLorentzFactor` and
+ * `grmhd::ValenciaDivClean::ConservativeFromPrimitive` in that order, but
+ * applies both fixes in a single pass over the points. Points that are set to
+ * the atmosphere skip the Lorentz factor limiting, since their velocity
+ * vanishes.
+ */
+struct FixPrimitivesAndComputeConservatives {
+  using return_tags = tmpl::list<typename System::variables_tag,
+                                 typename System::primitive_variables_tag>;
+  using argument_tags = tmpl::list<
+      ::Tags::VariableFixer<VariableFixing::FixToAtmosphere<3>>,
+      ::Tags::VariableFixer<VariableFixing::LimitLorentzFactor>,
+      hydro::Tags::GrmhdEquationOfState, gr::Tags::SpatialMetric<DataVector, 3>,
+      gr::Tags::SqrtDetSpatialMetric<DataVector>>;
+
+  static void apply(
+      gsl::not_null<typename System::variables_tag::type*> conserved_vars_ptr,
+      gsl::not_null<Variables<hydro::grmhd_tags<DataVector>>*>
+          primitive_vars_ptr,
+      const VariableFixing::FixToAtmosphere<3>& fix_to_atmosphere,
+      const VariableFixing::LimitLorentzFactor& limit_lorentz_factor,
+      const EquationsOfState::EquationOfState<true, 3>& eos,
+      const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+      const Scalar<DataVector>& sqrt_det_spatial_metric);
+};
+}  // namespace grmhd::ValenciaDivClean
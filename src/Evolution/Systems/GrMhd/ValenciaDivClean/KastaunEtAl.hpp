@@ -48,10 +48,27 @@ namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
  * field, and \f$\gamma\f$ and \f$\gamma^{kl}\f$ are the determinant and inverse
  * of the spatial metric \f$\gamma_{kl}\f$.
  *
- * \note This scheme does not use the initial guess for the pressure.
+ * The `initial_guess_pressure`, usually the pressure of the previous step, is
+ * used to warm-start the recovery: the guess
+ * \f$\mu_0 = 1 / (1 + q + p_0 / D - s / 2)\f$, which is exact for vanishing
+ * magnetic field or velocity, is enclosed in a small bracket that is widened a
+ * couple of times until it contains the root of the master function. Only if
+ * this fails, or if the root lies where the density is limited by the EOS, is
+ * the robust bracket of \cite Kastaun2020uxr constructed, which involves a
+ * separate root find. Pass a NaN guess to always use the robust bracket.
+ *
+ * The number of recoveries, warm starts, and master function evaluations on
+ * this thread are accumulated in `KastaunEtAl::statistics()`, so the average
+ * number of evaluations per point of e.g. an element is the difference of the
+ * `number_of_evaluations` before and after recovering its primitives divided
+ * by the difference of the `number_of_recoveries`.
  */
 class KastaunEtAl {
  public:
+  /// Whether `apply` can recover the primitives at a `simd::batch<double>` of
+  /// points at once.
+  static constexpr bool supports_simd_batches = false;
+
   template <bool EnforcePhysicality, typename EosType>
   static std::optional<PrimitiveRecoveryData> apply(
       double initial_guess_pressure, double tau,
@@ -64,11 +81,33 @@ class KastaunEtAl {
 
   static const std::string name() { return "KastaunEtAl"; }
 
+  /// Counts of the work done by `apply` on this thread
+  struct Statistics {
+    size_t number_of_recoveries = 0;
+    /// The number of recoveries that found the root in the bracket around the
+    /// initial guess
+    size_t number_of_warm_starts = 0;
+    /// The number of master function evaluations, excluding the evaluations
+    /// of the auxiliary functions needed for the robust bracket
+    size_t number_of_evaluations = 0;
+  };
+
+  /// The statistics of the recoveries on this thread since it started
+  static Statistics& statistics() {
+    thread_local Statistics statistics{};
+    return statistics;
+  }
+
  private:
   static constexpr size_t max_iterations_ = 100;
   static constexpr double absolute_tolerance_ =
       10.0 * std::numeric_limits<double>::epsilon();
   static constexpr double relative_tolerance_ =
       10.0 * std::numeric_limits<double>::epsilon();
+  // Relative half-width of the first bracket around the initial guess, and
+  // the factor by which it is widened if it does not contain the root
+  static constexpr double warm_start_half_width_ = 1.0e-3;
+  static constexpr double warm_start_widening_factor_ = 20.0;
+  static constexpr size_t warm_start_max_widenings_ = 2;
 };
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
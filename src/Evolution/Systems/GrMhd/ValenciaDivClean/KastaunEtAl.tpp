@@ -19,6 +19,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
 
@@ -175,6 +176,14 @@ class FunctionOfMu {
 
   bool state_is_unphysical() const { return state_is_unphysical_; }
 
+  std::optional<std::pair<double, double>> warm_start_bracket(
+      double initial_guess_pressure, double half_width, double widening_factor,
+      size_t max_widenings, gsl::not_null<double*> f_at_lower_bound,
+      gsl::not_null<double*> f_at_upper_bound,
+      gsl::not_null<size_t*> number_of_evaluations) const;
+
+  bool density_is_limited(double mu) const;
+
  private:
   double q_;
   double r_squared_;
@@ -266,6 +275,74 @@ FunctionOfMu<EnforcePhysicality, EosType>::root_bracket(
   return {lower_bound, upper_bound};
 }
 
+template <bool EnforcePhysicality, typename EosType>
+std::optional<std::pair<double, double>>
+FunctionOfMu<EnforcePhysicality, EosType>::warm_start_bracket(
+    const double initial_guess_pressure, const double half_width,
+    const double widening_factor, const size_t max_widenings,
+    const gsl::not_null<double*> f_at_lower_bound,
+    const gsl::not_null<double*> f_at_upper_bound,
+    const gsl::not_null<size_t*> number_of_evaluations) const {
+  if (std::isnan(initial_guess_pressure)) {
+    return std::nullopt;
+  }
+  // mu = D / (rho h W^2), and rho h W^2 = tau + D + p - B^2 / 2 for vanishing
+  // magnetic field or velocity, see Equations (25) and (26)
+  const double denominator =
+      1.0 + q_ - 0.5 * b_squared_ +
+      initial_guess_pressure / rest_mass_density_times_lorentz_factor_;
+  if (denominator <= 0.0) {
+    return std::nullopt;
+  }
+  const double mu_max = 1.0 / (h_0_ + std::numeric_limits<double>::min());
+  const double mu_guess = std::min(1.0 / denominator, mu_max);
+  double lower_bound = mu_guess * (1.0 - half_width);
+  double upper_bound = std::min(mu_guess * (1.0 + half_width), mu_max);
+  *f_at_lower_bound = (*this)(lower_bound);
+  *f_at_upper_bound = (*this)(upper_bound);
+  *number_of_evaluations += 2;
+  // The master function is negative below its unique root and positive above,
+  // so move the bracket towards the root until it is enclosed
+  double width = half_width * mu_guess;
+  for (size_t i = 0; i < max_widenings; ++i) {
+    if (*f_at_lower_bound * *f_at_upper_bound <= 0.0) {
+      break;
+    }
+    width *= widening_factor;
+    if (*f_at_upper_bound < 0.0) {
+      if (upper_bound == mu_max) {
+        return std::nullopt;
+      }
+      lower_bound = upper_bound;
+      *f_at_lower_bound = *f_at_upper_bound;
+      upper_bound = std::min(upper_bound + width, mu_max);
+      *f_at_upper_bound = (*this)(upper_bound);
+    } else {
+      upper_bound = lower_bound;
+      *f_at_upper_bound = *f_at_lower_bound;
+      lower_bound = std::max(lower_bound - width, 0.0);
+      *f_at_lower_bound = (*this)(lower_bound);
+    }
+    ++(*number_of_evaluations);
+  }
+  if (*f_at_lower_bound * *f_at_upper_bound > 0.0) {
+    return std::nullopt;
+  }
+  return std::pair{lower_bound, upper_bound};
+}
+
+template <bool EnforcePhysicality, typename EosType>
+bool FunctionOfMu<EnforcePhysicality, EosType>::density_is_limited(
+    const double mu) const {
+  // The robust bracket excludes the regions where Equation (41) produces a
+  // density outside the valid range of the EOS, see Appendix A
+  const double rest_mass_density = primitives(mu).rest_mass_density;
+  return rest_mass_density <=
+             equation_of_state_.rest_mass_density_lower_bound() or
+         rest_mass_density >=
+             equation_of_state_.rest_mass_density_upper_bound();
+}
+
 template <bool EnforcePhysicality, typename EosType>
 Primitives FunctionOfMu<EnforcePhysicality, EosType>::primitives(
     const double mu) const {
@@ -347,7 +424,7 @@ double FunctionOfMu<EnforcePhysicality, EosType>::operator()(
 
 template <bool EnforcePhysicality, typename EosType>
 std::optional<PrimitiveRecoveryData> KastaunEtAl::apply(
-    const double /*initial_guess_pressure*/, const double tau,
+    const double initial_guess_pressure, const double tau,
     const double momentum_density_squared,
     const double momentum_density_dot_magnetic_field,
     const double magnetic_field_squared,
@@ -369,24 +446,58 @@ std::optional<PrimitiveRecoveryData> KastaunEtAl::apply(
   if (f_of_mu.state_is_unphysical()) {
     return std::nullopt;
   }
+  auto& statistics = KastaunEtAl::statistics();
+  ++statistics.number_of_recoveries;
+  const auto counted_f_of_mu = [&f_of_mu, &statistics](const double mu) {
+    ++statistics.number_of_evaluations;
+    return f_of_mu(mu);
+  };
 
   // mu is 1 / (h W) see Equation (26)
   double one_over_specific_enthalpy_times_lorentz_factor =
       std::numeric_limits<double>::signaling_NaN();
   try {
-    // Bracket for master function, see Sec. II.F
-    const auto [lower_bound, upper_bound] = f_of_mu.root_bracket(
-        rest_mass_density_times_lorentz_factor, absolute_tolerance_,
-        relative_tolerance_, max_iterations_);
-
-    // Try to recover primitves
-    one_over_specific_enthalpy_times_lorentz_factor =
-        // NOLINTNEXTLINE(clang-analyzer-core)
-        RootFinder::toms748(f_of_mu, lower_bound, upper_bound,
-                            absolute_tolerance_, relative_tolerance_,
-                            max_iterations_);
+    // Warm start from the initial guess
+    double f_at_lower_bound = std::numeric_limits<double>::signaling_NaN();
+    double f_at_upper_bound = std::numeric_limits<double>::signaling_NaN();
+    const auto warm_start_bracket = f_of_mu.warm_start_bracket(
+        initial_guess_pressure, warm_start_half_width_,
+        warm_start_widening_factor_, warm_start_max_widenings_,
+        make_not_null(&f_at_lower_bound), make_not_null(&f_at_upper_bound),
+        make_not_null(&statistics.number_of_evaluations));
+    if (warm_start_bracket.has_value()) {
+      one_over_specific_enthalpy_times_lorentz_factor = RootFinder::toms748(
+          counted_f_of_mu, warm_start_bracket->first,
+          warm_start_bracket->second, f_at_lower_bound, f_at_upper_bound,
+          absolute_tolerance_, relative_tolerance_, max_iterations_);
+      if (f_of_mu.density_is_limited(
+              one_over_specific_enthalpy_times_lorentz_factor)) {
+        one_over_specific_enthalpy_times_lorentz_factor =
+            std::numeric_limits<double>::signaling_NaN();
+      } else {
+        ++statistics.number_of_warm_starts;
+      }
+    }
   } catch (std::exception& exception) {
-    return std::nullopt;
+    one_over_specific_enthalpy_times_lorentz_factor =
+        std::numeric_limits<double>::signaling_NaN();
+  }
+  if (std::isnan(one_over_specific_enthalpy_times_lorentz_factor)) {
+    try {
+      // Bracket for master function, see Sec. II.F
+      const auto [lower_bound, upper_bound] = f_of_mu.root_bracket(
+          rest_mass_density_times_lorentz_factor, absolute_tolerance_,
+          relative_tolerance_, max_iterations_);
+
+      // Try to recover primitves
+      one_over_specific_enthalpy_times_lorentz_factor =
+          // NOLINTNEXTLINE(clang-analyzer-core)
+          RootFinder::toms748(counted_f_of_mu, lower_bound, upper_bound,
+                              absolute_tolerance_, relative_tolerance_,
+                              max_iterations_);
+    } catch (std::exception& exception) {
+      return std::nullopt;
+    }
   }
 
   const auto [rest_mass_density, lorentz_factor, pressure,
@@ -49,6 +49,10 @@ struct PrimitiveRecoveryData;
  */
 class KastaunEtAlHydro {
  public:
+  /// Whether `apply` can recover the primitives at a `simd::batch<double>` of
+  /// points at once.
+  static constexpr bool supports_simd_batches = false;
+
   template <bool EnforcePhysicality, typename EosType>
   static std::optional<PrimitiveRecoveryData> apply(
       double initial_guess_pressure, double tau,
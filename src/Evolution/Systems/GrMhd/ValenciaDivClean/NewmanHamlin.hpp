@@ -51,6 +51,10 @@ namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
  */
 class NewmanHamlin {
  public:
+  /// Whether `apply` can recover the primitives at a `simd::batch<double>` of
+  /// points at once.
+  static constexpr bool supports_simd_batches = false;
+
   template <bool EnforcePhysicality, typename EosType>
   static std::optional<PrimitiveRecoveryData> apply(
       double initial_guess_for_pressure, double tau,
@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <optional>
 #include <string>
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 namespace EquationsOfState {
@@ -49,9 +51,20 @@ namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
  * density, momentum density, specific internal energy density, and magnetic
  * field, and \f$\gamma\f$ and \f$\gamma^{mn}\f$ are the determinant and inverse
  * of the spatial metric \f$\gamma_{mn}\f$.
+ *
+ * When built with xsimd the root find can also be done for a
+ * `simd::batch<double>` of points at once, see `supports_simd_batches`.
  */
 class PalenzuelaEtAl {
  public:
+  /// Whether `apply` can recover the primitives at a `simd::batch<double>` of
+  /// points at once.
+#ifdef SPECTRE_USE_XSIMD
+  static constexpr bool supports_simd_batches = true;
+#else
+  static constexpr bool supports_simd_batches = false;
+#endif
+
   template <bool EnforcePhysicality, typename EosType>
   static std::optional<PrimitiveRecoveryData> apply(
       double /*initial_guess_pressure*/, double tau,
@@ -62,6 +75,34 @@ class PalenzuelaEtAl {
       const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
           primitive_from_conservative_options);
 
+#ifdef SPECTRE_USE_XSIMD
+  /*!
+   * \brief Recover the primitives at `simd::size<simd::batch<double>>()`
+   * points at once.
+   *
+   * \details All lanes take the TOMS748 iterations together and lanes that
+   * have converged are masked out until the others have too. Lanes whose
+   * root is not bracketed are masked out from the start and return
+   * `std::nullopt`. If the iteration fails as a whole, e.g. because one lane
+   * does not converge, all lanes return `std::nullopt` so the caller can fall
+   * back to recovering each point separately. The equation of state is
+   * evaluated one lane at a time.
+   */
+  template <bool EnforcePhysicality, typename EosType>
+  static std::array<std::optional<PrimitiveRecoveryData>,
+                    simd::size<simd::batch<double>>()>
+  apply(const simd::batch<double>& /*initial_guess_pressure*/,
+        const simd::batch<double>& tau,
+        const simd::batch<double>& momentum_density_squared,
+        const simd::batch<double>& momentum_density_dot_magnetic_field,
+        const simd::batch<double>& magnetic_field_squared,
+        const simd::batch<double>& rest_mass_density_times_lorentz_factor,
+        const simd::batch<double>& electron_fraction,
+        const EosType& equation_of_state,
+        const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
+            primitive_from_conservative_options);
+#endif  // SPECTRE_USE_XSIMD
+
   static const std::string name() { return "PalenzuelaEtAl"; }
 
  private:
@@ -5,29 +5,82 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <exception>
 #include <limits>
+#include <type_traits>
 
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
 
 namespace PalenzuelaEtAl_detail {
+template <typename EosType>
+double pressure_from_density_and_energy(
+    const EosType& equation_of_state, const double rest_mass_density,
+    const double specific_internal_energy, const double electron_fraction) {
+  if constexpr (EosType::thermodynamic_dim == 1) {
+    return get(equation_of_state.pressure_from_density(
+        Scalar<double>(rest_mass_density)));
+  } else if constexpr (EosType::thermodynamic_dim == 2) {
+    return get(equation_of_state.pressure_from_density_and_energy(
+        Scalar<double>(rest_mass_density),
+        Scalar<double>(specific_internal_energy)));
+  } else {
+    static_assert(EosType::thermodynamic_dim == 3);
+    return get(equation_of_state.pressure_from_density_and_energy(
+        Scalar<double>(rest_mass_density),
+        Scalar<double>(specific_internal_energy),
+        Scalar<double>(electron_fraction)));
+  }
+}
 
-// note q,r,s,t,x are defined in the documentation
+#ifdef SPECTRE_USE_XSIMD
+// The equations of state are not vectorized, so each lane is evaluated
+// separately.
 template <typename EosType>
+simd::batch<double> pressure_from_density_and_energy(
+    const EosType& equation_of_state,
+    const simd::batch<double>& rest_mass_density,
+    const simd::batch<double>& specific_internal_energy,
+    const simd::batch<double>& electron_fraction) {
+  constexpr size_t width = simd::size<simd::batch<double>>();
+  alignas(64) std::array<double, width> rest_mass_density_lanes{};
+  alignas(64) std::array<double, width> specific_internal_energy_lanes{};
+  alignas(64) std::array<double, width> electron_fraction_lanes{};
+  alignas(64) std::array<double, width> pressure_lanes{};
+  simd::store_unaligned(rest_mass_density_lanes.data(), rest_mass_density);
+  simd::store_unaligned(specific_internal_energy_lanes.data(),
+                        specific_internal_energy);
+  simd::store_unaligned(electron_fraction_lanes.data(), electron_fraction);
+  for (size_t lane = 0; lane < width; ++lane) {
+    gsl::at(pressure_lanes, lane) = pressure_from_density_and_energy(
+        equation_of_state, gsl::at(rest_mass_density_lanes, lane),
+        gsl::at(specific_internal_energy_lanes, lane),
+        gsl::at(electron_fraction_lanes, lane));
+  }
+  return simd::load_unaligned(pressure_lanes.data());
+}
+#endif  // SPECTRE_USE_XSIMD
+
+// note q,r,s,t,x are defined in the documentation
+//
+// `T` is either a `double` or a `simd::batch<double>`
+template <typename EosType, typename T = double>
 class FunctionOfX {
  public:
-  FunctionOfX(const double tau, const double momentum_density_squared,
-              const double momentum_density_dot_magnetic_field,
-              const double magnetic_field_squared,
-              const double rest_mass_density_times_lorentz_factor,
-              const double electron_fraction, const EosType& equation_of_state)
+  FunctionOfX(const T& tau, const T& momentum_density_squared,
+              const T& momentum_density_dot_magnetic_field,
+              const T& magnetic_field_squared,
+              const T& rest_mass_density_times_lorentz_factor,
+              const T& electron_fraction, const EosType& equation_of_state)
       : q_(tau / rest_mass_density_times_lorentz_factor),
         r_(momentum_density_squared /
            square(rest_mass_density_times_lorentz_factor)),
@@ -39,48 +92,40 @@ class FunctionOfX {
         electron_fraction_(electron_fraction),
         equation_of_state_(equation_of_state) {}
 
-  double lorentz_factor(const double x) const {
+  T lorentz_factor(const T& x) const {
     static constexpr double v_maximum = 1.0 - 1.e-12;
     // Clamp v^2 to physical values.  This is needed because the bounds on
     // x used for the root solve do not guarantee a physical velocity.  Some
     // work would be needed to investigate whether better bounds could guarantee
     // a physical velocity.
-    const double v_squared = std::clamp(
-        (square(x) * r_ + (2 * x + s_) * t_squared_) / square(x * (x + s_)),
-        0.0, square(v_maximum));
+    const T unclamped_v_squared =
+        (square(x) * r_ + (2.0 * x + s_) * t_squared_) / square(x * (x + s_));
+    T v_squared{};
+    if constexpr (std::is_same_v<T, double>) {
+      v_squared = std::clamp(unclamped_v_squared, 0.0, square(v_maximum));
+    } else {
+      v_squared =
+          simd::clip(unclamped_v_squared, T(0.0), T(square(v_maximum)));
+    }
     return 1.0 / sqrt(1.0 - v_squared);
   }
 
-  double specific_internal_energy(const double x,
-                                  const double lorentz_factor) const {
+  T specific_internal_energy(const T& x, const T& lorentz_factor) const {
     return lorentz_factor - 1.0 +
            x * (1.0 - square(lorentz_factor)) / lorentz_factor +
            lorentz_factor * (q_ - s_ + 0.5 * t_squared_ / square(x) +
                              0.5 * s_ / square(lorentz_factor));
   }
 
-  double operator()(const double x) const {
-    const double current_lorentz_factor = lorentz_factor(x);
-    const double current_rest_mass_density =
+  T operator()(const T& x) const {
+    const T current_lorentz_factor = lorentz_factor(x);
+    const T current_rest_mass_density =
         rest_mass_density_times_lorentz_factor_ / current_lorentz_factor;
-    const double current_specific_internal_energy =
+    const T current_specific_internal_energy =
         specific_internal_energy(x, current_lorentz_factor);
-    double current_pressure = std::numeric_limits<double>::signaling_NaN();
-    if constexpr (EosType::thermodynamic_dim == 1) {
-      current_pressure = get(equation_of_state_.pressure_from_density(
-          Scalar<double>(current_rest_mass_density)));
-    } else if constexpr (EosType::thermodynamic_dim == 2) {
-      current_pressure =
-          get(equation_of_state_.pressure_from_density_and_energy(
-              Scalar<double>(current_rest_mass_density),
-              Scalar<double>(current_specific_internal_energy)));
-    } else if constexpr (EosType::thermodynamic_dim == 3) {
-      current_pressure =
-          get(equation_of_state_.pressure_from_density_and_energy(
-              Scalar<double>(current_rest_mass_density),
-              Scalar<double>(current_specific_internal_energy),
-              Scalar<double>(electron_fraction_)));
-    }
+    const T current_pressure = pressure_from_density_and_energy(
+        equation_of_state_, current_rest_mass_density,
+        current_specific_internal_energy, electron_fraction_);
 
     return x - (1.0 + current_specific_internal_energy +
                 current_pressure / current_rest_mass_density) *
@@ -88,14 +133,45 @@ class FunctionOfX {
   }
 
  private:
-  const double q_;
-  const double r_;
-  const double s_;
-  const double t_squared_;
-  const double rest_mass_density_times_lorentz_factor_;
-  const double electron_fraction_;
+  const T q_;
+  const T r_;
+  const T s_;
+  const T t_squared_;
+  const T rest_mass_density_times_lorentz_factor_;
+  const T electron_fraction_;
   const EosType& equation_of_state_;
 };
+
+// Compute the primitives from the root `x` of `f_of_x`
+template <typename EosType>
+PrimitiveRecoveryData primitive_recovery_data(
+    const FunctionOfX<EosType>& f_of_x,
+    const double specific_enthalpy_times_lorentz_factor,
+    const double rest_mass_density_times_lorentz_factor,
+    const double electron_fraction, const EosType& equation_of_state) {
+  const double lorentz_factor =
+      f_of_x.lorentz_factor(specific_enthalpy_times_lorentz_factor);
+  const double rest_mass_density =
+      rest_mass_density_times_lorentz_factor / lorentz_factor;
+  double specific_internal_energy = f_of_x.specific_internal_energy(
+      specific_enthalpy_times_lorentz_factor, lorentz_factor);
+  if constexpr (EosType::thermodynamic_dim == 1) {
+    specific_internal_energy =
+        get(equation_of_state.specific_internal_energy_from_density(
+            Scalar<double>(rest_mass_density)));
+  }
+  const double pressure = pressure_from_density_and_energy(
+      equation_of_state, rest_mass_density, specific_internal_energy,
+      electron_fraction);
+
+  return PrimitiveRecoveryData{rest_mass_density,
+                               lorentz_factor,
+                               pressure,
+                               specific_internal_energy,
+                               specific_enthalpy_times_lorentz_factor *
+                                   rest_mass_density_times_lorentz_factor,
+                               electron_fraction};
+}
 }  // namespace PalenzuelaEtAl_detail
 
 template <bool EnforcePhysicality, typename EosType>
@@ -133,36 +209,99 @@ std::optional<PrimitiveRecoveryData> PalenzuelaEtAl::apply(
   } catch (std::exception& exception) {
     return std::nullopt;
   }
-  const double lorentz_factor =
-      f_of_x.lorentz_factor(specific_enthalpy_times_lorentz_factor);
-  const double rest_mass_density =
-      rest_mass_density_times_lorentz_factor / lorentz_factor;
-  double pressure = std::numeric_limits<double>::signaling_NaN();
-  double specific_internal_energy = f_of_x.specific_internal_energy(
-      specific_enthalpy_times_lorentz_factor, lorentz_factor);
-  if constexpr (EosType::thermodynamic_dim == 1) {
-    pressure = get(equation_of_state.pressure_from_density(
-        Scalar<double>(rest_mass_density)));
-    specific_internal_energy =
-        get(equation_of_state.specific_internal_energy_from_density(
-            Scalar<double>(rest_mass_density)));
-  } else if constexpr (EosType::thermodynamic_dim == 2) {
-    pressure = get(equation_of_state.pressure_from_density_and_energy(
-        Scalar<double>(rest_mass_density),
-        Scalar<double>(specific_internal_energy)));
-  } else if constexpr (EosType::thermodynamic_dim == 3) {
-    pressure = get(equation_of_state.pressure_from_density_and_energy(
-        Scalar<double>(rest_mass_density),
-        Scalar<double>(specific_internal_energy),
-        Scalar<double>(electron_fraction)));
+  return PalenzuelaEtAl_detail::primitive_recovery_data(
+      f_of_x, specific_enthalpy_times_lorentz_factor,
+      rest_mass_density_times_lorentz_factor, electron_fraction,
+      equation_of_state);
+}
+
+#ifdef SPECTRE_USE_XSIMD
+template <bool EnforcePhysicality, typename EosType>
+std::array<std::optional<PrimitiveRecoveryData>,
+           simd::size<simd::batch<double>>()>
+PalenzuelaEtAl::apply(
+    const simd::batch<double>& /*initial_guess_pressure*/,
+    const simd::batch<double>& tau,
+    const simd::batch<double>& momentum_density_squared,
+    const simd::batch<double>& momentum_density_dot_magnetic_field,
+    const simd::batch<double>& magnetic_field_squared,
+    const simd::batch<double>& rest_mass_density_times_lorentz_factor,
+    const simd::batch<double>& electron_fraction,
+    const EosType& equation_of_state,
+    const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
+    /*primitive_from_conservative_options*/) {
+  using Batch = simd::batch<double>;
+  constexpr size_t width = simd::size<Batch>();
+  std::array<std::optional<PrimitiveRecoveryData>, width> result{};
+
+  const Batch lower_bound =
+      (tau - magnetic_field_squared) / rest_mass_density_times_lorentz_factor +
+      1.0;
+  const Batch upper_bound = (2.0 * tau - magnetic_field_squared) /
+                                rest_mass_density_times_lorentz_factor +
+                            2.0;
+  const auto f_of_x = PalenzuelaEtAl_detail::FunctionOfX<EosType, Batch>{
+      tau,
+      momentum_density_squared,
+      momentum_density_dot_magnetic_field,
+      magnetic_field_squared,
+      rest_mass_density_times_lorentz_factor,
+      electron_fraction,
+      equation_of_state};
+  const Batch f_at_lower_bound = f_of_x(lower_bound);
+  const Batch f_at_upper_bound = f_of_x(upper_bound);
+  // Mask out the lanes without a bracketed root. They are given opposite
+  // function values at the bounds so that the root finder accepts the
+  // bracket, and their result is discarded.
+  const auto not_bracketed =
+      not(f_at_lower_bound * f_at_upper_bound <= 0.0) or
+      not(lower_bound < upper_bound);
+  if (simd::all(not_bracketed)) {
+    return result;
+  }
+  Batch specific_enthalpy_times_lorentz_factor{};
+  try {
+    specific_enthalpy_times_lorentz_factor = RootFinder::toms748(
+        f_of_x, simd::select(not_bracketed, Batch(1.0), lower_bound),
+        simd::select(not_bracketed, Batch(2.0), upper_bound),
+        simd::select(not_bracketed, Batch(-1.0), f_at_lower_bound),
+        simd::select(not_bracketed, Batch(1.0), f_at_upper_bound),
+        absolute_tolerance_, relative_tolerance_, max_iterations_,
+        not_bracketed);
+  } catch (std::exception& exception) {
+    return result;
   }
 
-  return PrimitiveRecoveryData{rest_mass_density,
-                               lorentz_factor,
-                               pressure,
-                               specific_internal_energy,
-                               specific_enthalpy_times_lorentz_factor *
-                                   rest_mass_density_times_lorentz_factor,
-                               electron_fraction};
+  alignas(64) std::array<double, width> root_lanes{};
+  alignas(64) std::array<double, width> not_bracketed_lanes{};
+  alignas(64) std::array<std::array<double, width>, 6> input_lanes{};
+  simd::store_unaligned(root_lanes.data(),
+                        specific_enthalpy_times_lorentz_factor);
+  simd::store_unaligned(not_bracketed_lanes.data(),
+                        simd::select(not_bracketed, Batch(1.0), Batch(0.0)));
+  simd::store_unaligned(input_lanes[0].data(), tau);
+  simd::store_unaligned(input_lanes[1].data(), momentum_density_squared);
+  simd::store_unaligned(input_lanes[2].data(),
+                        momentum_density_dot_magnetic_field);
+  simd::store_unaligned(input_lanes[3].data(), magnetic_field_squared);
+  simd::store_unaligned(input_lanes[4].data(),
+                        rest_mass_density_times_lorentz_factor);
+  simd::store_unaligned(input_lanes[5].data(), electron_fraction);
+  for (size_t lane = 0; lane < width; ++lane) {
+    if (gsl::at(not_bracketed_lanes, lane) != 0.0) {
+      continue;
+    }
+    const auto scalar_f_of_x = PalenzuelaEtAl_detail::FunctionOfX<EosType>{
+        gsl::at(input_lanes[0], lane), gsl::at(input_lanes[1], lane),
+        gsl::at(input_lanes[2], lane), gsl::at(input_lanes[3], lane),
+        gsl::at(input_lanes[4], lane), gsl::at(input_lanes[5], lane),
+        equation_of_state};
+    gsl::at(result, lane) = PalenzuelaEtAl_detail::primitive_recovery_data(
+        scalar_f_of_x, gsl::at(root_lanes, lane),
+        gsl::at(input_lanes[4], lane), gsl::at(input_lanes[5], lane),
+        equation_of_state);
+  }
+  return result;
 }
+#endif  // SPECTRE_USE_XSIMD
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
@@ -3,11 +3,15 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <iomanip>
 #include <limits>
 #include <optional>
 #include <ostream>
 #include <type_traits>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
@@ -15,6 +19,7 @@
 #include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Evolution/Conservative/RoundTrip.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.tpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAlHydro.hpp"
@@ -33,6 +38,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace grmhd::ValenciaDivClean {
@@ -160,7 +166,156 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
   for (size_t s = 0; s < number_of_points; ++s) {
     get(*electron_fraction)[s] =
         std::min(0.5, std::max(get(tilde_ye)[s] / get(tilde_d)[s], 0.));
+  }
+
+  // Keep the primitives in place at points where they already reproduce the
+  // evolved conserved variables, e.g. in an atmosphere that didn't change over
+  // the substep. Only finite and bounded primitives are checked so that
+  // uninitialized primitives never enter the arithmetic.
+  std::vector<bool> keep_primitives(number_of_points, false);
+  size_t number_of_recovered_points = 0;
+  const auto bounded = [](const double value) {
+    return std::isfinite(value) and std::abs(value) < 1.0e50;
+  };
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double lorentz_factor_at_point = get(*lorentz_factor)[s];
+    const double rest_mass_density_at_point = get(*rest_mass_density)[s];
+    const double pressure_at_point = get(*pressure)[s];
+    const double specific_energy_at_point = get(*specific_internal_energy)[s];
+    bool check = bounded(lorentz_factor_at_point) and
+                 lorentz_factor_at_point >= 1.0 and
+                 bounded(rest_mass_density_at_point) and
+                 bounded(pressure_at_point) and
+                 bounded(specific_energy_at_point);
+    for (size_t i = 0; i < 3; ++i) {
+      check = check and bounded(spatial_velocity->get(i)[s]) and
+              bounded(magnetic_field->get(i)[s]);
+    }
+    if (check) {
+      const double sqrt_det = get(sqrt_det_spatial_metric)[s];
+      std::array<double, 3> velocity_one_form{};
+      std::array<double, 3> magnetic_field_one_form{};
+      double velocity_squared = 0.0;
+      double magnetic_field_dot_velocity = 0.0;
+      for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+          gsl::at(velocity_one_form, i) +=
+              spatial_metric.get(i, j)[s] * spatial_velocity->get(j)[s];
+          gsl::at(magnetic_field_one_form, i) +=
+              spatial_metric.get(i, j)[s] * magnetic_field->get(j)[s];
+        }
+        velocity_squared +=
+            gsl::at(velocity_one_form, i) * spatial_velocity->get(i)[s];
+        magnetic_field_dot_velocity +=
+            gsl::at(velocity_one_form, i) * magnetic_field->get(i)[s];
+      }
+      const double b_squared = get(magnetic_field_squared)[s];
+      const double scale =
+          std::abs(get(tilde_d)[s]) + std::abs(get(tilde_tau)[s]);
+      const double w_squared = square(lorentz_factor_at_point);
+      check = evolution::conservative::primitives_are_current(
+                  get(tilde_d)[s],
+                  sqrt_det * rest_mass_density_at_point *
+                      lorentz_factor_at_point,
+                  scale) and
+              evolution::conservative::primitives_are_current(
+                  get(tilde_tau)[s],
+                  sqrt_det *
+                      (w_squared * (rest_mass_density_at_point *
+                                        (specific_energy_at_point +
+                                         velocity_squared *
+                                             lorentz_factor_at_point /
+                                             (lorentz_factor_at_point + 1.0)) +
+                                    pressure_at_point * velocity_squared) +
+                       0.5 * b_squared * (1.0 + velocity_squared) -
+                       0.5 * square(magnetic_field_dot_velocity)),
+                  scale);
+      const double common_factor =
+          sqrt_det * (b_squared + w_squared * (rest_mass_density_at_point *
+                                                   (1.0 +
+                                                    specific_energy_at_point) +
+                                               pressure_at_point));
+      for (size_t i = 0; i < 3; ++i) {
+        check = check and evolution::conservative::primitives_are_current(
+                              tilde_s.get(i)[s],
+                              common_factor * gsl::at(velocity_one_form, i) -
+                                  sqrt_det * magnetic_field_dot_velocity *
+                                      gsl::at(magnetic_field_one_form, i),
+                              scale);
+      }
+    }
+    keep_primitives[s] = check;
+    if (not check and rest_mass_density_times_lorentz_factor[s] >= cutoffD) {
+      ++number_of_recovered_points;
+    }
+  }
+  evolution::conservative::RecoveryStatistics::local().record(
+      number_of_points, number_of_recovered_points);
 
+  // If the first scheme can recover the primitives at a batch of points at
+  // once, do so for all points that would otherwise be handed to it one at a
+  // time. Points at which the batched recovery fails go through the full list
+  // of schemes below.
+  std::vector<std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>>
+      batched_primitive_data{};
+#ifdef SPECTRE_USE_XSIMD
+  using first_scheme = tmpl::front<OrderedListOfPrimitiveRecoverySchemes>;
+  if constexpr (first_scheme::supports_simd_batches) {
+    constexpr size_t width = simd::size<simd::batch<double>>();
+    std::vector<size_t> batched_points{};
+    batched_points.reserve(number_of_points);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      if (not keep_primitives[s] and
+          rest_mass_density_times_lorentz_factor[s] >= cutoffD and
+          not(use_hydro_optimization and
+              (get(magnetic_field_squared)[s] <
+               100.0 * std::numeric_limits<double>::epsilon() * tau[s]))) {
+        batched_points.push_back(s);
+      }
+    }
+    if (batched_points.size() >= width) {
+      batched_primitive_data.resize(number_of_points);
+      const std::array<const DataVector*, 7> inputs{
+          {&get(*pressure), &tau, &get(momentum_density_squared),
+           &get(momentum_density_dot_magnetic_field),
+           &get(magnetic_field_squared),
+           &rest_mass_density_times_lorentz_factor, &get(*electron_fraction)}};
+      alignas(64) std::array<std::array<double, width>, 7> lanes{};
+      for (size_t first = 0; first < batched_points.size(); first += width) {
+        // Pad the last batch with its first point
+        for (size_t lane = 0; lane < width; ++lane) {
+          const size_t s = batched_points[first + lane < batched_points.size()
+                                              ? first + lane
+                                              : first];
+          for (size_t input = 0; input < inputs.size(); ++input) {
+            gsl::at(gsl::at(lanes, input), lane) =
+                (*gsl::at(inputs, input))[s];
+          }
+        }
+        const auto batch_primitive_data =
+            first_scheme::template apply<EnforcePhysicality>(
+                simd::load_unaligned(lanes[0].data()),
+                simd::load_unaligned(lanes[1].data()),
+                simd::load_unaligned(lanes[2].data()),
+                simd::load_unaligned(lanes[3].data()),
+                simd::load_unaligned(lanes[4].data()),
+                simd::load_unaligned(lanes[5].data()),
+                simd::load_unaligned(lanes[6].data()), equation_of_state,
+                primitive_from_conservative_options);
+        for (size_t lane = 0;
+             lane < width and first + lane < batched_points.size(); ++lane) {
+          batched_primitive_data[batched_points[first + lane]] =
+              gsl::at(batch_primitive_data, lane);
+        }
+      }
+    }
+  }
+#endif  // SPECTRE_USE_XSIMD
+
+  for (size_t s = 0; s < number_of_points; ++s) {
+    if (keep_primitives[s]) {
+      continue;
+    }
     std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>
         primitive_data = std::nullopt;
     // Quick exit from inversion in low-density regions where we will
@@ -191,6 +346,9 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
           get(*electron_fraction)[s]};
     } else {
       // not in atmosphere.
+      if (not batched_primitive_data.empty()) {
+        primitive_data = batched_primitive_data[s];
+      }
       auto apply_scheme = [&pressure, &primitive_data, &tau,
                            &momentum_density_squared,
                            &momentum_density_dot_magnetic_field,
@@ -41,6 +41,12 @@ namespace ValenciaDivClean {
  * If `EnforcePhysicality` is `false` then the hydrodynamic inversion will
  * return with an error if the input conservatives are unphysical, i.e., if no
  * solution exits. The exact behavior is governed by `ErrorOnFailure`.
+ *
+ * At points where the primitive variables passed in already reproduce the
+ * conserved variables (see `evolution::conservative::primitives_are_current`),
+ * e.g. in an atmosphere that didn't change over the substep, the root find is
+ * skipped and the primitives are kept in place. The number of points at which
+ * a root find ran is recorded in `evolution::conservative::RecoveryStatistics`.
  */
 template <typename OrderedListOfPrimitiveRecoverySchemes,
           bool ErrorOnFailure = true>
@@ -47,14 +47,16 @@ TciOnDgGrid<RecoveryScheme>::apply(
     const evolution::dg::subcell::SubcellOptions& subcell_options,
     const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
         primitive_from_conservative_options,
-    const double persson_exponent, const bool element_stays_on_dg) {
+    const double persson_exponent, const bool element_stays_on_dg,
+    const bool rdmp_needs_projection) {
   evolution::dg::subcell::RdmpTciData rdmp_tci_data{};
 
   using std::max;
   using std::min;
   const size_t num_dg_pts = dg_mesh.number_of_grid_points();
   const size_t num_subcell_pts = subcell_mesh.number_of_grid_points();
-  DataVector temp_buffer{4 * num_subcell_pts + num_dg_pts};
+  DataVector temp_buffer{(rdmp_needs_projection ? 4 * num_subcell_pts : 0) +
+                         num_dg_pts};
   size_t offset_into_temp_buffer = 0;
   const auto assign_data =
       [&temp_buffer, &offset_into_temp_buffer](
@@ -66,32 +68,36 @@ TciOnDgGrid<RecoveryScheme>::apply(
             .set_data_ref(temp_buffer.data() + offset_into_temp_buffer, size);
         offset_into_temp_buffer += size;
       };
+  // If we don't need to project, the "subcell" values refer to the values on
+  // the DG grid, so the checks below reduce to those on the DG grid.
+  const auto project_to_subcells =
+      [&assign_data, &dg_mesh, num_subcell_pts, rdmp_needs_projection,
+       &subcell_mesh](const gsl::not_null<Scalar<DataVector>*> subcell_var,
+                      const Scalar<DataVector>& dg_var) {
+        if (rdmp_needs_projection) {
+          assign_data(subcell_var, num_subcell_pts);
+          evolution::dg::subcell::fd::project(make_not_null(&get(*subcell_var)),
+                                              get(dg_var), dg_mesh,
+                                              subcell_mesh.extents());
+        } else {
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+          get(*subcell_var).set_data_ref(&const_cast<DataVector&>(get(dg_var)));
+        }
+      };
   Scalar<DataVector> subcell_tilde_d{};
-  assign_data(make_not_null(&subcell_tilde_d), num_subcell_pts);
-  evolution::dg::subcell::fd::project(make_not_null(&get(subcell_tilde_d)),
-                                      get(tilde_d), dg_mesh,
-                                      subcell_mesh.extents());
+  project_to_subcells(make_not_null(&subcell_tilde_d), tilde_d);
 
   Scalar<DataVector> subcell_tilde_ye{};
-  assign_data(make_not_null(&subcell_tilde_ye), num_subcell_pts);
-  evolution::dg::subcell::fd::project(make_not_null(&get(subcell_tilde_ye)),
-                                      get(tilde_ye), dg_mesh,
-                                      subcell_mesh.extents());
+  project_to_subcells(make_not_null(&subcell_tilde_ye), tilde_ye);
 
   Scalar<DataVector> subcell_tilde_tau{};
-  assign_data(make_not_null(&subcell_tilde_tau), num_subcell_pts);
-  evolution::dg::subcell::fd::project(make_not_null(&get(subcell_tilde_tau)),
-                                      get(tilde_tau), dg_mesh,
-                                      subcell_mesh.extents());
+  project_to_subcells(make_not_null(&subcell_tilde_tau), tilde_tau);
 
   Scalar<DataVector> mag_tilde_b{};
   assign_data(make_not_null(&mag_tilde_b), num_dg_pts);
   magnitude(make_not_null(&mag_tilde_b), tilde_b);
   Scalar<DataVector> subcell_mag_tilde_b{};
-  assign_data(make_not_null(&subcell_mag_tilde_b), num_subcell_pts);
-  evolution::dg::subcell::fd::project(make_not_null(&get(subcell_mag_tilde_b)),
-                                      get(mag_tilde_b), dg_mesh,
-                                      subcell_mesh.extents());
+  project_to_subcells(make_not_null(&subcell_mag_tilde_b), mag_tilde_b);
   const double max_mag_tilde_b = max(get(mag_tilde_b));
 
   rdmp_tci_data.max_variables_values =
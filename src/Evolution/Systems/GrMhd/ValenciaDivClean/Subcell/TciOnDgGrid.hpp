@@ -116,6 +116,11 @@ namespace grmhd::ValenciaDivClean::subcell {
  * If the cell is not flagged as troubled then the primitives are computed at
  * time level `n+1`.
  *
+ * The conserved variables are only projected to the subcells if
+ * `rdmp_needs_projection` is `true`, see
+ * `evolution::dg::subcell::Actions::TciAndRollback`. Otherwise the checks of
+ * the subcell values above and the RDMP TCI only use the values on the DG grid.
+ *
  * The second column of the table above denotes the value of an integer stored
  * as the first element of the returned `std::tuple`, which indicates the
  * particular kind of check that failed. For example, if the fifth check
@@ -168,6 +173,7 @@ class TciOnDgGrid {
       const evolution::dg::subcell::SubcellOptions& subcell_options,
       const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
           primitive_from_conservative_options,
-      double persson_exponent, bool element_stays_on_dg);
+      double persson_exponent, bool element_stays_on_dg,
+      bool rdmp_needs_projection);
 };
 }  // namespace grmhd::ValenciaDivClean::subcell
@@ -10,14 +10,15 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/NewtonianEuler/SoundSpeedSquared.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/NormalDotFlux.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace NewtonianEuler::BoundaryCorrections {
 template <size_t Dim>
@@ -133,9 +134,10 @@ void Hll<Dim>::dg_boundary_terms(
     const Scalar<DataVector>& largest_outgoing_char_speed_ext,
     const Scalar<DataVector>& largest_ingoing_char_speed_ext,
     const dg::Formulation dg_formulation) const {
-  // Allocate a temp buffer with four tags.
-  Variables<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
-                       ::Tags::TempScalar<2>, ::Tags::TempScalar<3>>>
+  // Take a temp buffer with four tags from the scratch arena, since this is
+  // called for every mortar of every element.
+  TempBuffer<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
+                        ::Tags::TempScalar<2>, ::Tags::TempScalar<3>>>
       temps{get(mass_density_int).size()};
 
   // Determine lambda_max and lambda_min from the characteristic speeds info
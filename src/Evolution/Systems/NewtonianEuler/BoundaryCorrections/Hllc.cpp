@@ -10,14 +10,15 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/NewtonianEuler/SoundSpeedSquared.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/NormalDotFlux.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace NewtonianEuler::BoundaryCorrections {
 template <size_t Dim>
@@ -154,11 +155,13 @@ void Hllc<Dim>::dg_boundary_terms(
     const Scalar<DataVector>& largest_outgoing_char_speed_ext,
     const Scalar<DataVector>& largest_ingoing_char_speed_ext,
     const dg::Formulation dg_formulation) const {
-  // Allocate a temp buffer
+  // Take a temp buffer from the scratch arena, since this is called for every
+  // mortar of every element.
   const size_t vector_size = get(mass_density_int).size();
-  Variables<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
-                       ::Tags::TempScalar<2>, ::Tags::TempScalar<3>,
-                       ::Tags::TempScalar<4>>>
+  TempBuffer<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
+                        ::Tags::TempScalar<2>, ::Tags::TempScalar<3>,
+                        ::Tags::TempScalar<4>, ::Tags::TempScalar<5>,
+                        ::Tags::TempScalar<6>, ::Tags::TempScalar<7>>>
       temps{vector_size};
 
   // Determine lambda_max and lambda_min from the characteristic speeds from
@@ -185,15 +188,19 @@ void Hllc<Dim>::dg_boundary_terms(
        get(mass_density_ext) * (lambda_max + get(normal_dot_velocity_ext)));
   const DataVector& lambda_star = get(get<::Tags::TempScalar<2>>(temps));
 
-  // Precompute common numerical factors for state variables in star region
-  // (cf. Eq 10.39 of Toro2009)
-  get(get<::Tags::TempScalar<3>>(temps)) =
-      (lambda_min - get(normal_dot_velocity_int)) / (lambda_min - lambda_star);
-  const DataVector& prefactor_int = get(get<::Tags::TempScalar<3>>(temps));
-  get(get<::Tags::TempScalar<4>>(temps)) =
-      (lambda_max + get(normal_dot_velocity_ext)) / (lambda_max - lambda_star);
-  const DataVector& prefactor_ext = get(get<::Tags::TempScalar<4>>(temps));
-
+  // Write the correction on either side of the contact wave as
+  //   G - F_int = c_int U_int + c_ext U_ext + d_int U'_int + d_ext U'_ext
+  //               - w_ext (F_int + F_ext),
+  // where U' holds the terms of U_* that are not proportional to U (cf. Eq
+  // 10.39 of Toro2009). Only the coefficients of the upwind side are nonzero,
+  // so they are selected point by point without branches and the correction
+  // of every component is a single vector expression. The coefficients of the
+  // other side are never evaluated, because their prefactor can be singular.
+  DataVector& exterior_weight = get(get<::Tags::TempScalar<3>>(temps));
+  DataVector& c_int = get(get<::Tags::TempScalar<4>>(temps));
+  DataVector& c_ext = get(get<::Tags::TempScalar<5>>(temps));
+  DataVector& d_int = get(get<::Tags::TempScalar<6>>(temps));
+  DataVector& d_ext = get(get<::Tags::TempScalar<7>>(temps));
   for (size_t i = 0; i < vector_size; ++i) {
     // check if lambda_star falls in the correct range [lambda_min,lambda_max]
     ASSERT(
@@ -201,98 +208,57 @@ void Hllc<Dim>::dg_boundary_terms(
         "lambda_star in HLLC boundary correction is not consistent : "
             << "\n lambda_min  = " << lambda_min[i] << "\n lambda_*    = "
             << lambda_star[i] << "\n lambda_max  = " << lambda_max[i]);
+    const bool use_interior = lambda_star[i] >= 0.0;
+    const double lambda = use_interior ? lambda_min[i] : lambda_max[i];
+    const double normal_velocity = use_interior
+                                       ? get(normal_dot_velocity_int)[i]
+                                       : -get(normal_dot_velocity_ext)[i];
+    const double mass_density =
+        use_interior ? get(mass_density_int)[i] : get(mass_density_ext)[i];
+    const double prefactor =
+        (lambda - normal_velocity) / (lambda - lambda_star[i]);
+    const double c = lambda * (prefactor - 1.0);
+    const double d =
+        lambda * prefactor * mass_density * (lambda_star[i] - normal_velocity);
+    exterior_weight[i] = use_interior ? 0.0 : 1.0;
+    c_int[i] = use_interior ? c : 0.0;
+    c_ext[i] = use_interior ? 0.0 : c;
+    d_int[i] = use_interior ? d : 0.0;
+    d_ext[i] = use_interior ? 0.0 : d;
+  }
 
-    if (dg_formulation == dg::Formulation::WeakInertial) {
-      // Compute intermediate flux F_star (cf. Eq 10.71 - 10.73 of Toro2009)
-      if (lambda_star[i] >= 0.0) {
-        get(*boundary_correction_mass_density)[i] =
-            get(normal_dot_flux_mass_density_int)[i] +
-            lambda_min[i] * (prefactor_int[i] - 1.0) * get(mass_density_int)[i];
-        for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
-          boundary_correction_momentum_density->get(spatial_index)[i] =
-              normal_dot_flux_momentum_density_int.get(spatial_index)[i] +
-              lambda_min[i] *
-                  (get(mass_density_int)[i] * prefactor_int[i] *
-                       (lambda_star[i] - get(normal_dot_velocity_int)[i]) *
-                       interface_unit_normal_int.get(spatial_index)[i] +
-                   momentum_density_int.get(spatial_index)[i] *
-                       (prefactor_int[i] - 1.0));
-        }
-        get(*boundary_correction_energy_density)[i] =
-            get(normal_dot_flux_energy_density_int)[i] +
-            lambda_min[i] *
-                ((prefactor_int[i] - 1.0) *
-                     (get(energy_density_int)[i] + get(pressure_int)[i]) +
-                 prefactor_int[i] * get(mass_density_int)[i] * lambda_star[i] *
-                     (lambda_star[i] - get(normal_dot_velocity_int)[i]));
-      } else {
-        get(*boundary_correction_mass_density)[i] =
-            -get(normal_dot_flux_mass_density_ext)[i] +
-            lambda_max[i] * (prefactor_ext[i] - 1.0) * get(mass_density_ext)[i];
-        for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
-          boundary_correction_momentum_density->get(spatial_index)[i] =
-              -normal_dot_flux_momentum_density_ext.get(spatial_index)[i] +
-              lambda_max[i] *
-                  (get(mass_density_ext)[i] * prefactor_ext[i] *
-                       (lambda_star[i] + get(normal_dot_velocity_ext)[i]) *
-                       (-interface_unit_normal_ext.get(spatial_index)[i]) +
-                   momentum_density_ext.get(spatial_index)[i] *
-                       (prefactor_ext[i] - 1.0));
-        }
-        get(*boundary_correction_energy_density)[i] =
-            -get(normal_dot_flux_energy_density_ext)[i] +
-            lambda_max[i] *
-                ((prefactor_ext[i] - 1.0) *
-                     (get(energy_density_ext)[i] + get(pressure_ext)[i]) +
-                 prefactor_ext[i] * get(mass_density_ext)[i] * lambda_star[i] *
-                     (lambda_star[i] + get(normal_dot_velocity_ext)[i]));
-      }
-    } else {
-      // Compute boundary correction for strong formulation
-      if (lambda_star[i] >= 0.0) {
-        get(*boundary_correction_mass_density)[i] =
-            lambda_min[i] * (prefactor_int[i] - 1.0) * get(mass_density_int)[i];
-        for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
-          boundary_correction_momentum_density->get(spatial_index)[i] =
-              lambda_min[i] *
-              (get(mass_density_int)[i] * prefactor_int[i] *
-                   (lambda_star[i] - get(normal_dot_velocity_int)[i]) *
-                   interface_unit_normal_int.get(spatial_index)[i] +
-               momentum_density_int.get(spatial_index)[i] *
-                   (prefactor_int[i] - 1.0));
-        }
-        get(*boundary_correction_energy_density)[i] =
-            lambda_min[i] *
-            ((prefactor_int[i] - 1.0) *
-                 (get(energy_density_int)[i] + get(pressure_int)[i]) +
-             prefactor_int[i] * get(mass_density_int)[i] * lambda_star[i] *
-                 (lambda_star[i] - get(normal_dot_velocity_int)[i]));
-      } else {
-        get(*boundary_correction_mass_density)[i] =
-            -get(normal_dot_flux_mass_density_int)[i] -
-            get(normal_dot_flux_mass_density_ext)[i] +
-            lambda_max[i] * (prefactor_ext[i] - 1.0) * get(mass_density_ext)[i];
-        for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
-          boundary_correction_momentum_density->get(spatial_index)[i] =
-              -normal_dot_flux_momentum_density_int.get(spatial_index)[i] -
-              normal_dot_flux_momentum_density_ext.get(spatial_index)[i] +
-              lambda_max[i] *
-                  (get(mass_density_ext)[i] * prefactor_ext[i] *
-                       (lambda_star[i] + get(normal_dot_velocity_ext)[i]) *
-                       (-interface_unit_normal_ext.get(spatial_index)[i]) +
-                   momentum_density_ext.get(spatial_index)[i] *
-                       (prefactor_ext[i] - 1.0));
-        }
-        get(*boundary_correction_energy_density)[i] =
-            -get(normal_dot_flux_energy_density_int)[i] -
-            get(normal_dot_flux_energy_density_ext)[i] +
-            lambda_max[i] *
-                ((prefactor_ext[i] - 1.0) *
-                     (get(energy_density_ext)[i] + get(pressure_ext)[i]) +
-                 prefactor_ext[i] * get(mass_density_ext)[i] * lambda_star[i] *
-                     (lambda_star[i] + get(normal_dot_velocity_ext)[i]));
-      }
+  // Compute boundary correction for strong formulation
+  get(*boundary_correction_mass_density) =
+      c_int * get(mass_density_int) + c_ext * get(mass_density_ext) -
+      exterior_weight * (get(normal_dot_flux_mass_density_int) +
+                         get(normal_dot_flux_mass_density_ext));
+  for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
+    boundary_correction_momentum_density->get(spatial_index) =
+        c_int * momentum_density_int.get(spatial_index) +
+        c_ext * momentum_density_ext.get(spatial_index) +
+        d_int * interface_unit_normal_int.get(spatial_index) -
+        d_ext * interface_unit_normal_ext.get(spatial_index) -
+        exterior_weight *
+            (normal_dot_flux_momentum_density_int.get(spatial_index) +
+             normal_dot_flux_momentum_density_ext.get(spatial_index));
+  }
+  get(*boundary_correction_energy_density) =
+      c_int * (get(energy_density_int) + get(pressure_int)) +
+      c_ext * (get(energy_density_ext) + get(pressure_ext)) +
+      (d_int + d_ext) * lambda_star -
+      exterior_weight * (get(normal_dot_flux_energy_density_int) +
+                         get(normal_dot_flux_energy_density_ext));
+
+  if (dg_formulation == dg::Formulation::WeakInertial) {
+    // Compute intermediate flux F_star (cf. Eq 10.71 - 10.73 of Toro2009)
+    get(*boundary_correction_mass_density) +=
+        get(normal_dot_flux_mass_density_int);
+    for (size_t spatial_index = 0; spatial_index < Dim; ++spatial_index) {
+      boundary_correction_momentum_density->get(spatial_index) +=
+          normal_dot_flux_momentum_density_int.get(spatial_index);
     }
+    get(*boundary_correction_energy_density) +=
+        get(normal_dot_flux_energy_density_int);
   }
 }
 
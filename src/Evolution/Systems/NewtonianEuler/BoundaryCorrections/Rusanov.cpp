@@ -8,6 +8,8 @@
 #include <pup.h>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/NewtonianEuler/SoundSpeedSquared.hpp"
@@ -15,6 +17,7 @@
 #include "NumericalAlgorithms/DiscontinuousGalerkin/NormalDotFlux.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace NewtonianEuler::BoundaryCorrections {
 template <size_t Dim>
@@ -119,41 +122,49 @@ void Rusanov<Dim>::dg_boundary_terms(
     const Scalar<DataVector>& normal_dot_flux_energy_density_ext,
     const Scalar<DataVector>& abs_char_speed_ext,
     const dg::Formulation dg_formulation) const {
+  // Take the dissipation speed from the scratch arena, since it is shared by
+  // all components and this is called for every mortar of every element.
+  TempBuffer<tmpl::list<::Tags::TempScalar<0>>> temps{
+      get(abs_char_speed_int).size()};
+  DataVector& half_max_abs_char_speed = get(get<::Tags::TempScalar<0>>(temps));
+  half_max_abs_char_speed =
+      0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext));
+
   if (dg_formulation == dg::Formulation::WeakInertial) {
     get(*boundary_correction_mass_density) =
         0.5 * (get(normal_dot_flux_mass_density_int) -
                get(normal_dot_flux_mass_density_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
+        half_max_abs_char_speed *
             (get(mass_density_ext) - get(mass_density_int));
     for (size_t i = 0; i < Dim; ++i) {
       boundary_correction_momentum_density->get(i) =
           0.5 * (normal_dot_flux_momentum_density_int.get(i) -
                  normal_dot_flux_momentum_density_ext.get(i)) -
-          0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
+          half_max_abs_char_speed *
               (momentum_density_ext.get(i) - momentum_density_int.get(i));
     }
     get(*boundary_correction_energy_density) =
         0.5 * (get(normal_dot_flux_energy_density_int) -
                get(normal_dot_flux_energy_density_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
+        half_max_abs_char_speed *
             (get(energy_density_ext) - get(energy_density_int));
   } else {
     get(*boundary_correction_mass_density) =
         -0.5 * (get(normal_dot_flux_mass_density_int) +
                 get(normal_dot_flux_mass_density_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
+        half_max_abs_char_speed *
             (get(mass_density_ext) - get(mass_density_int));
     for (size_t i = 0; i < Dim; ++i) {
       boundary_correction_momentum_density->get(i) =
           -0.5 * (normal_dot_flux_momentum_density_int.get(i) +
                   normal_dot_flux_momentum_density_ext.get(i)) -
-          0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
+          half_max_abs_char_speed *
               (momentum_density_ext.get(i) - momentum_density_int.get(i));
     }
     get(*boundary_correction_energy_density) =
         -0.5 * (get(normal_dot_flux_energy_density_int) +
                 get(normal_dot_flux_energy_density_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
+        half_max_abs_char_speed *
             (get(energy_density_ext) - get(energy_density_int));
   }
 }
@@ -58,8 +58,11 @@ bool characteristic_minmod_impl(
   }
 
   // Buffers for minmod limiter and TCI
-  DataVector u_lin_buffer(mesh.number_of_grid_points());
-  Limiters::Minmod_detail::BufferWrapper<VolumeDim> tci_buffer(mesh);
+  thread_local DataVector u_lin_buffer{};
+  if (u_lin_buffer.size() != mesh.number_of_grid_points()) {
+    u_lin_buffer.destructive_resize(mesh.number_of_grid_points());
+  }
+  auto& tci_buffer = Limiters::Minmod_detail::thread_local_buffer(mesh);
 
   // Outer lambda: wraps applying minmod to the NewtonianEuler characteristics
   // for one particular choice of characteristic decomposition
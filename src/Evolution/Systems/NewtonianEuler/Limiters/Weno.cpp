@@ -73,7 +73,7 @@ bool characteristic_simple_weno_impl(
   }
 
   // Buffers for TCI
-  Limiters::Minmod_detail::BufferWrapper<VolumeDim> tci_buffer(mesh);
+  auto& tci_buffer = Limiters::Minmod_detail::thread_local_buffer(mesh);
   const auto effective_neighbor_sizes =
       Limiters::Minmod_detail::compute_effective_neighbor_sizes(element,
                                                                 neighbor_data);
@@ -32,27 +32,39 @@ std::tuple<bool, evolution::dg::subcell::RdmpTciData> TciOnDgGrid<Dim>::apply(
     const evolution::dg::subcell::RdmpTciData& past_rdmp_tci_data,
     const evolution::dg::subcell::SubcellOptions& subcell_options,
     const double persson_exponent,
-    [[maybe_unused]] const bool element_stays_on_dg) {
-  const Variables<tmpl::list<MassDensityCons, MomentumDensity, EnergyDensity>>
-      subcell_vars = evolution::dg::subcell::fd::project(
-          dg_vars, dg_mesh, subcell_mesh.extents());
+    [[maybe_unused]] const bool element_stays_on_dg,
+    const bool rdmp_needs_projection) {
   const Scalar<DataVector>& mass_density = get<MassDensityCons>(dg_vars);
   const tnsr::I<DataVector, Dim, Frame::Inertial>& momentum_density =
       get<MomentumDensity>(dg_vars);
   const Scalar<DataVector>& energy_density = get<EnergyDensity>(dg_vars);
 
-  const Scalar<DataVector>& subcell_mass_density =
-      get<MassDensityCons>(subcell_vars);
-  const Scalar<DataVector>& subcell_energy_density =
-      get<EnergyDensity>(subcell_vars);
-
   using std::max;
   using std::min;
   evolution::dg::subcell::RdmpTciData rdmp_tci_data{
-      {max(max(get(mass_density)), max(get(subcell_mass_density))),
-       max(max(get(energy_density)), max(get(subcell_energy_density)))},
-      {min(min(get(mass_density)), min(get(subcell_mass_density))),
-       min(min(get(energy_density)), min(get(subcell_energy_density)))}};
+      {max(get(mass_density)), max(get(energy_density))},
+      {min(get(mass_density)), min(get(energy_density))}};
+  if (rdmp_needs_projection) {
+    const Variables<tmpl::list<MassDensityCons, MomentumDensity, EnergyDensity>>
+        subcell_vars = evolution::dg::subcell::fd::project(
+            dg_vars, dg_mesh, subcell_mesh.extents());
+    const Scalar<DataVector>& subcell_mass_density =
+        get<MassDensityCons>(subcell_vars);
+    const Scalar<DataVector>& subcell_energy_density =
+        get<EnergyDensity>(subcell_vars);
+    rdmp_tci_data.max_variables_values[0] =
+        max(rdmp_tci_data.max_variables_values[0],
+            max(get(subcell_mass_density)));
+    rdmp_tci_data.max_variables_values[1] =
+        max(rdmp_tci_data.max_variables_values[1],
+            max(get(subcell_energy_density)));
+    rdmp_tci_data.min_variables_values[0] =
+        min(rdmp_tci_data.min_variables_values[0],
+            min(get(subcell_mass_density)));
+    rdmp_tci_data.min_variables_values[1] =
+        min(rdmp_tci_data.min_variables_values[1],
+            min(get(subcell_energy_density)));
+  }
 
   NewtonianEuler::PrimitiveFromConservative<Dim>::apply(
       make_not_null(&get<MassDensity>(*dg_prim_vars)),
@@ -47,6 +47,10 @@ namespace NewtonianEuler::subcell {
  * - runs the Persson TCI on the mass and energy density. The reason for
  *   applying the Persson TCI to both the mass and energy density is to flag
  *   cells at contact discontinuities.
+ *
+ * The candidate solution is only projected to the subcells for the RDMP TCI if
+ * `rdmp_needs_projection` is `true`, see
+ * `evolution::dg::subcell::Actions::TciAndRollback`.
  */
 template <size_t Dim>
 class TciOnDgGrid {
@@ -85,6 +89,7 @@ class TciOnDgGrid {
       const Mesh<Dim>& dg_mesh, const Mesh<Dim>& subcell_mesh,
       const evolution::dg::subcell::RdmpTciData& past_rdmp_tci_data,
       const evolution::dg::subcell::SubcellOptions& subcell_options,
-      double persson_exponent, bool element_stays_on_dg);
+      double persson_exponent, bool element_stays_on_dg,
+      bool rdmp_needs_projection);
 };
 }  // namespace NewtonianEuler::subcell
@@ -51,6 +51,7 @@ namespace evolution::dg::Actions::detail {
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&   \
           mesh_velocity,                                                      \
       const std::optional<Scalar<DataVector>>& div_mesh_velocity,             \
+      const VolumeTermsStage stage,                                           \
       const Scalar<DataVector>& mass_density_cons,                            \
       const tnsr::I<DataVector, DIM(data)>& momentum_density,                 \
       const Scalar<DataVector>& energy_density,                               \
@@ -61,6 +61,9 @@ void compute_closure_impl(
   constexpr size_t spatial_dim = 3;
   // Tolerance used in the rootfinding used to find the closure factor
   constexpr double root_find_tolerance = 1.e-6;
+  // Half width of the bracket around the closure factor of the previous step
+  // that is tried before bracketing the whole allowed domain
+  constexpr double warm_start_half_width = 1.e-3;
   Variables<
       tmpl::list<hydro::Tags::LorentzFactorSquared<DataVector>, MomentumSquared,
                  MomentumUp, hydro::Tags::SpatialVelocityOneForm<DataVector, 3>,
@@ -206,6 +209,9 @@ void compute_closure_impl(
                                  h_sqr_thin_thick * d_thin * d_thick;
             return (square(e_fluid * local_zeta) - h_sqr) / square(e_pt);
           };
+      // The closure factor from the previous step, which is usually
+      // within warm_start_half_width of the new root
+      const double previous_zeta = get(*closure_factor)[s];
       // To avoid failures in the root find at the boundary of
       // the allowed domain for zeta, test the edge values first.
       if (fabs(zeta_j_sqr_minus_h_sqr(0.)) < root_find_tolerance) {
@@ -213,8 +219,28 @@ void compute_closure_impl(
       } else if (fabs(zeta_j_sqr_minus_h_sqr(1.)) < root_find_tolerance) {
         get(*closure_factor)[s] = 1.;
       } else {
-        get(*closure_factor)[s] = RootFinder::toms748(
-            zeta_j_sqr_minus_h_sqr, 1.e-15, 1., root_find_tolerance, 1.0e-15);
+        bool found_root = false;
+        // Try a narrow bracket around the previous closure factor first. The
+        // comparisons also reject an uninitialized (NaN) previous value.
+        if (previous_zeta > 1.e-15 and previous_zeta < 1.) {
+          const double lower = std::max(
+              previous_zeta - warm_start_half_width, 1.e-15);
+          const double upper = std::min(
+              previous_zeta + warm_start_half_width, 1.);
+          const double f_at_lower = zeta_j_sqr_minus_h_sqr(lower);
+          const double f_at_upper = zeta_j_sqr_minus_h_sqr(upper);
+          if (f_at_lower * f_at_upper <= 0.) {
+            get(*closure_factor)[s] = RootFinder::toms748(
+                zeta_j_sqr_minus_h_sqr, lower, upper, f_at_lower, f_at_upper,
+                root_find_tolerance, 1.0e-15);
+            found_root = true;
+          }
+        }
+        if (not found_root) {
+          get(*closure_factor)[s] = RootFinder::toms748(
+              zeta_j_sqr_minus_h_sqr, 1.e-15, 1., root_find_tolerance,
+              1.0e-15);
+        }
       }
       const double& zeta = get(*closure_factor)[s];
 
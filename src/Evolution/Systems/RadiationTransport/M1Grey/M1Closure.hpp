@@ -98,9 +98,11 @@ struct ComputeM1Closure;
  * \f}
  * for a given \f$\xi\f$ only requires recomputing \f$d_{\rm thin,thick}\f$
  * and their derivatives with respect to \f$\xi\f$.
- * We perform the root-finding using a Newton-Raphson algorithm, with the
- * accuracy set by the variable root_find_number_of_digits (6 significant digits
- * at the moment).
+ * We perform the root-finding using `RootFinder::toms748`, with an absolute
+ * accuracy of \f$10^{-6}\f$ in \f$\xi\f$. The input closure factor is used
+ * as an initial guess: the root is first searched for in a narrow bracket
+ * around it, and in the whole interval \f$[0,1]\f$ only if that bracket does
+ * not contain a root.
  *
  * The function returns the closure factors \f$\xi\f$ (to be used as initial
  * guess for this function at the next step), the pressure tensor \f$P_{ij}\f$,
@@ -8,6 +8,8 @@
 #include <pup.h>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/RelativisticEuler/Valencia/Characteristics.hpp"
@@ -16,6 +18,7 @@
 #include "PointwiseFunctions/Hydro/SoundSpeedSquared.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace RelativisticEuler::Valencia::BoundaryCorrections {
 template <size_t Dim>
@@ -145,41 +148,43 @@ void Rusanov<Dim>::dg_boundary_terms(
         normal_dot_flux_tilde_s_ext,
     const Scalar<DataVector>& abs_char_speed_ext,
     const dg::Formulation dg_formulation) const {
+  // Take the dissipation speed from the scratch arena, since it is shared by
+  // all components and this is called for every mortar of every element.
+  TempBuffer<tmpl::list<::Tags::TempScalar<0>>> temps{
+      get(abs_char_speed_int).size()};
+  DataVector& half_max_abs_char_speed = get(get<::Tags::TempScalar<0>>(temps));
+  half_max_abs_char_speed =
+      0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext));
+
   if (dg_formulation == dg::Formulation::WeakInertial) {
     get(*boundary_correction_tilde_d) =
         0.5 * (get(normal_dot_flux_tilde_d_int) -
                get(normal_dot_flux_tilde_d_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_d_ext) - get(tilde_d_int));
+        half_max_abs_char_speed * (get(tilde_d_ext) - get(tilde_d_int));
     get(*boundary_correction_tilde_tau) =
         0.5 * (get(normal_dot_flux_tilde_tau_int) -
                get(normal_dot_flux_tilde_tau_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_tau_ext) - get(tilde_tau_int));
+        half_max_abs_char_speed * (get(tilde_tau_ext) - get(tilde_tau_int));
     for (size_t i = 0; i < Dim; ++i) {
       boundary_correction_tilde_s->get(i) =
           0.5 * (normal_dot_flux_tilde_s_int.get(i) -
                  normal_dot_flux_tilde_s_ext.get(i)) -
-          0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-              (tilde_s_ext.get(i) - tilde_s_int.get(i));
+          half_max_abs_char_speed * (tilde_s_ext.get(i) - tilde_s_int.get(i));
     }
   } else {
     get(*boundary_correction_tilde_d) =
         -0.5 * (get(normal_dot_flux_tilde_d_int) +
                 get(normal_dot_flux_tilde_d_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_d_ext) - get(tilde_d_int));
+        half_max_abs_char_speed * (get(tilde_d_ext) - get(tilde_d_int));
     get(*boundary_correction_tilde_tau) =
         -0.5 * (get(normal_dot_flux_tilde_tau_int) +
                 get(normal_dot_flux_tilde_tau_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_tau_ext) - get(tilde_tau_int));
+        half_max_abs_char_speed * (get(tilde_tau_ext) - get(tilde_tau_int));
     for (size_t i = 0; i < Dim; ++i) {
       boundary_correction_tilde_s->get(i) =
           -0.5 * (normal_dot_flux_tilde_s_int.get(i) +
                   normal_dot_flux_tilde_s_ext.get(i)) -
-          0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-              (tilde_s_ext.get(i) - tilde_s_int.get(i));
+          half_max_abs_char_speed * (tilde_s_ext.get(i) - tilde_s_int.get(i));
     }
   }
 }
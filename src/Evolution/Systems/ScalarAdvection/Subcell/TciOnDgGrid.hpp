@@ -29,6 +29,9 @@ namespace ScalarAdvection::subcell {
  *
  * Applies 1) the RDMP TCI to \f$U\f$ and 2) the Persson TCI to \f$U\f$ if the
  * \f$\max(|U|)\f$ on the DG grid is greater than `tci_options.u_cutoff`.
+ * The candidate solution is only projected to the subcells for the RDMP TCI if
+ * `rdmp_needs_projection` is `true`, see
+ * `evolution::dg::subcell::Actions::TciAndRollback`.
  */
 template <size_t Dim>
 struct TciOnDgGrid {
@@ -47,6 +50,6 @@ struct TciOnDgGrid {
       const evolution::dg::subcell::RdmpTciData& past_rdmp_tci_data,
       const evolution::dg::subcell::SubcellOptions& subcell_options,
       const TciOptions& tci_options, double persson_exponent,
-      bool element_stays_on_dg);
+      bool element_stays_on_dg, bool rdmp_needs_projection);
 };
 }  // namespace ScalarAdvection::subcell
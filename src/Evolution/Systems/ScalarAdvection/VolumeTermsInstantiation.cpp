@@ -50,6 +50,7 @@ namespace evolution::dg::Actions::detail {
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&   \
           mesh_velocity,                                                      \
       const std::optional<Scalar<DataVector>>& div_mesh_velocity,             \
+      const VolumeTermsStage stage,                                           \
       const Scalar<DataVector>& u,                                            \
       const tnsr::I<DataVector, DIM(data), Frame::Inertial>& velocity_field);
 
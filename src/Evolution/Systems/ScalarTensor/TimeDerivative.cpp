@@ -104,11 +104,11 @@ void TimeDerivative::apply(
     // Scalar argument variables
     const Scalar<DataVector>& pi_scalar,
     const tnsr::i<DataVector, dim>& phi_scalar,
-    const Scalar<DataVector>& lapse_scalar,
-    const tnsr::I<DataVector, dim>& shift_scalar,
+    const Scalar<DataVector>& /*lapse_scalar*/,
+    const tnsr::I<DataVector, dim>& /*shift_scalar*/,
     const tnsr::i<DataVector, dim>& deriv_lapse,
     const tnsr::iJ<DataVector, dim>& deriv_shift,
-    const tnsr::II<DataVector, dim>& upper_spatial_metric,
+    const tnsr::II<DataVector, dim>& /*upper_spatial_metric*/,
     const tnsr::I<DataVector, dim>& trace_spatial_christoffel,
     const Scalar<DataVector>& trace_extrinsic_curvature,
     const Scalar<DataVector>& gamma1_scalar,
@@ -137,30 +137,28 @@ void TimeDerivative::apply(
       gamma1, gamma2, gauge_condition, mesh, time, inertial_coords,
       inverse_jacobian, mesh_velocity);
 
-  // Compute sourceless part of the RHS of the scalar equation
-  CurvedScalarWave::TimeDerivative<dim>::apply(
+  // Compute sourceless part of the RHS of the scalar equation. The GH time
+  // derivative has already filled the lapse, shift and inverse spatial metric
+  // temporaries that the two systems share, so only the scalar constraint
+  // damping parameters remain to be set.
+  *result_gamma1_scalar = gamma1_scalar;
+  *result_gamma2_scalar = gamma2_scalar;
+  CurvedScalarWave::TimeDerivative<dim>::compute_time_derivatives(
       // Scalar dt variables
       dt_psi_scalar, dt_pi_scalar, dt_phi_scalar,
 
-      // Scalar temporal variables
-      lapse, shift, inverse_spatial_metric,
-
-      result_gamma1_scalar, result_gamma2_scalar,
-
       // Scalar argument variables
-      d_psi_scalar, d_pi_scalar, d_phi_scalar, pi_scalar, phi_scalar,
-
-      lapse_scalar, shift_scalar,
-
-      deriv_lapse, deriv_shift, upper_spatial_metric, trace_spatial_christoffel,
-      trace_extrinsic_curvature, gamma1_scalar, gamma2_scalar);
+      d_psi_scalar, d_pi_scalar, d_phi_scalar, pi_scalar, phi_scalar, *lapse,
+      *shift, deriv_lapse, deriv_shift, *inverse_spatial_metric,
+      trace_spatial_christoffel, trace_extrinsic_curvature, gamma1_scalar,
+      gamma2_scalar);
 
   // Compute the (trace-reversed) stress energy tensor here
-  trace_reversed_stress_energy(stress_energy, pi_scalar, phi_scalar,
-                               lapse_scalar, shift_scalar);
+  trace_reversed_stress_energy(stress_energy, pi_scalar, phi_scalar, *lapse,
+                               *shift);
 
-  add_stress_energy_term_to_dt_pi(dt_pi, *stress_energy, lapse_scalar);
+  add_stress_energy_term_to_dt_pi(dt_pi, *stress_energy, *lapse);
 
-  add_scalar_source_to_dt_pi_scalar(dt_pi_scalar, scalar_source, lapse_scalar);
+  add_scalar_source_to_dt_pi_scalar(dt_pi_scalar, scalar_source, *lapse);
 }
 }  // namespace ScalarTensor
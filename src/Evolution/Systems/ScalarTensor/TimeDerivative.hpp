@@ -36,6 +36,11 @@ namespace ScalarTensor {
  * to the \f$\partial_t \Pi_{a b}\f$ variable in the Generalized Harmonic
  * system, as well as adding any scalar sources to the variable \f$\partial_t
  * \Pi\f$.
+ *
+ * The two systems share the lapse, shift and inverse spatial metric
+ * temporaries. These are computed once from the spacetime metric by the
+ * Generalized Harmonic part and reused by the scalar part and the coupling
+ * terms, so the corresponding scalar arguments are not read.
  */
 struct TimeDerivative {
   static constexpr size_t dim = 3;
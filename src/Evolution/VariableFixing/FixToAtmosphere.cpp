@@ -68,66 +68,90 @@ void FixToAtmosphere<Dim>::operator()(
     const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
         equation_of_state) const {
   for (size_t i = 0; i < rest_mass_density->get().size(); i++) {
-    if (UNLIKELY(rest_mass_density->get()[i] < density_cutoff_)) {
-      set_density_to_atmosphere(rest_mass_density, specific_internal_energy,
-                                temperature, pressure, electron_fraction,
-                                equation_of_state, i);
-      for (size_t d = 0; d < Dim; ++d) {
-        spatial_velocity->get(d)[i] = 0.0;
-      }
-      get(*lorentz_factor)[i] = 1.0;
-    } else if (UNLIKELY(rest_mass_density->get()[i] <
-                        transition_density_cutoff_)) {
-      set_to_magnetic_free_transition(spatial_velocity, lorentz_factor,
-                                      *rest_mass_density, spatial_metric, i);
+    fix_point(rest_mass_density, specific_internal_energy, spatial_velocity,
+              lorentz_factor, pressure, temperature, electron_fraction,
+              spatial_metric, equation_of_state, i);
+  }
+}
+
+template <size_t Dim>
+template <size_t ThermodynamicDim>
+bool FixToAtmosphere<Dim>::fix_point(
+    const gsl::not_null<Scalar<DataVector>*> rest_mass_density,
+    const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+    const gsl::not_null<tnsr::I<DataVector, Dim, Frame::Inertial>*>
+        spatial_velocity,
+    const gsl::not_null<Scalar<DataVector>*> lorentz_factor,
+    const gsl::not_null<Scalar<DataVector>*> pressure,
+    const gsl::not_null<Scalar<DataVector>*> temperature,
+    const Scalar<DataVector>& electron_fraction,
+    const tnsr::ii<DataVector, Dim, Frame::Inertial>& spatial_metric,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state,
+    const size_t grid_index) const {
+  bool set_to_atmosphere = false;
+  if (UNLIKELY(rest_mass_density->get()[grid_index] < density_cutoff_)) {
+    set_density_to_atmosphere(rest_mass_density, specific_internal_energy,
+                              temperature, pressure, electron_fraction,
+                              equation_of_state, grid_index);
+    for (size_t d = 0; d < Dim; ++d) {
+      spatial_velocity->get(d)[grid_index] = 0.0;
     }
+    get(*lorentz_factor)[grid_index] = 1.0;
+    set_to_atmosphere = true;
+  } else if (UNLIKELY(rest_mass_density->get()[grid_index] <
+                      transition_density_cutoff_)) {
+    set_to_magnetic_free_transition(spatial_velocity, lorentz_factor,
+                                    *rest_mass_density, spatial_metric,
+                                    grid_index);
+  }
 
-    // For 2D & 3D EoS, we also need to limit the temperature / energy
-    if constexpr (ThermodynamicDim > 1) {
-      bool changed_temperature = false;
-      if (const double min_temperature =
-              equation_of_state.temperature_lower_bound();
-          get(*temperature)[i] < min_temperature) {
-        get(*temperature)[i] = min_temperature;
-        changed_temperature = true;
-      }
+  // For 2D & 3D EoS, we also need to limit the temperature / energy
+  if constexpr (ThermodynamicDim > 1) {
+    bool changed_temperature = false;
+    if (const double min_temperature =
+            equation_of_state.temperature_lower_bound();
+        get(*temperature)[grid_index] < min_temperature) {
+      get(*temperature)[grid_index] = min_temperature;
+      changed_temperature = true;
+    }
 
-      // We probably need a better maximum temperature as well, but this is not
-      // as well defined. To be discussed once implementation needs improvement.
-      if (const double max_temperature =
-              equation_of_state.temperature_upper_bound();
-          get(*temperature)[i] > max_temperature) {
-        get(*temperature)[i] = max_temperature;
-        changed_temperature = true;
-      }
+    // We probably need a better maximum temperature as well, but this is not
+    // as well defined. To be discussed once implementation needs improvement.
+    if (const double max_temperature =
+            equation_of_state.temperature_upper_bound();
+        get(*temperature)[grid_index] > max_temperature) {
+      get(*temperature)[grid_index] = max_temperature;
+      changed_temperature = true;
+    }
 
-      if (changed_temperature) {
-        if constexpr (ThermodynamicDim == 2) {
-          specific_internal_energy->get()[i] =
-              get(equation_of_state
-                      .specific_internal_energy_from_density_and_temperature(
-                          Scalar<double>{rest_mass_density->get()[i]},
-                          Scalar<double>{get(*temperature)[i]}));
-          pressure->get()[i] =
-              get(equation_of_state.pressure_from_density_and_energy(
-                  Scalar<double>{rest_mass_density->get()[i]},
-                  Scalar<double>{specific_internal_energy->get()[i]}));
-        } else {
-          specific_internal_energy->get()[i] =
-              get(equation_of_state
-                      .specific_internal_energy_from_density_and_temperature(
-                          Scalar<double>{rest_mass_density->get()[i]},
-                          Scalar<double>{get(*temperature)[i]},
-                          Scalar<double>{get(electron_fraction)[i]}));
-          pressure->get()[i] =
-              get(equation_of_state.pressure_from_density_and_temperature(
-                  Scalar<double>{rest_mass_density->get()[i]},
-                  Scalar<double>{temperature->get()[i]},
-                  Scalar<double>{get(electron_fraction)[i]}));
-        }
+    if (changed_temperature) {
+      if constexpr (ThermodynamicDim == 2) {
+        specific_internal_energy->get()[grid_index] =
+            get(equation_of_state
+                    .specific_internal_energy_from_density_and_temperature(
+                        Scalar<double>{rest_mass_density->get()[grid_index]},
+                        Scalar<double>{get(*temperature)[grid_index]}));
+        pressure->get()[grid_index] =
+            get(equation_of_state.pressure_from_density_and_energy(
+                Scalar<double>{rest_mass_density->get()[grid_index]},
+                Scalar<double>{specific_internal_energy->get()[grid_index]}));
+      } else {
+        specific_internal_energy->get()[grid_index] =
+            get(equation_of_state
+                    .specific_internal_energy_from_density_and_temperature(
+                        Scalar<double>{rest_mass_density->get()[grid_index]},
+                        Scalar<double>{get(*temperature)[grid_index]},
+                        Scalar<double>{get(electron_fraction)[grid_index]}));
+        pressure->get()[grid_index] =
+            get(equation_of_state.pressure_from_density_and_temperature(
+                Scalar<double>{rest_mass_density->get()[grid_index]},
+                Scalar<double>{temperature->get()[grid_index]},
+                Scalar<double>{get(electron_fraction)[grid_index]}));
       }
     }
   }
+  return set_to_atmosphere;
 }
 
 template <size_t Dim>
@@ -230,30 +254,43 @@ bool operator!=(const FixToAtmosphere<Dim>& lhs,
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define THERMO_DIM(data) BOOST_PP_TUPLE_ELEM(1, data)
 
-#define INSTANTIATION(r, data)                                     \
-  template class FixToAtmosphere<DIM(data)>;                       \
-  template bool operator==(const FixToAtmosphere<DIM(data)>& lhs,  \
-                           const FixToAtmosphere<DIM(data)>& rhs); \
-  template bool operator!=(const FixToAtmosphere<DIM(data)>& lhs,  \
+#define INSTANTIATION(r, data)                                                 \
+  template class FixToAtmosphere<DIM(data)>;                                   \
+  template bool operator==(const FixToAtmosphere<DIM(data)>& lhs,              \
+                           const FixToAtmosphere<DIM(data)>& rhs);             \
+  template bool operator!=(const FixToAtmosphere<DIM(data)>& lhs,              \
                            const FixToAtmosphere<DIM(data)>& rhs);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
 #undef INSTANTIATION
 
-#define INSTANTIATION(r, data)                                                \
-  template void FixToAtmosphere<DIM(data)>::operator()(                       \
-      const gsl::not_null<Scalar<DataVector>*> rest_mass_density,             \
-      const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,      \
-      const gsl::not_null<tnsr::I<DataVector, DIM(data), Frame::Inertial>*>   \
-          spatial_velocity,                                                   \
-      const gsl::not_null<Scalar<DataVector>*> lorentz_factor,                \
-      const gsl::not_null<Scalar<DataVector>*> pressure,                      \
-      const gsl::not_null<Scalar<DataVector>*> temperature,                   \
-      const Scalar<DataVector>& electron_fraction,                            \
-      const tnsr::ii<DataVector, DIM(data), Frame::Inertial>& spatial_metric, \
-      const EquationsOfState::EquationOfState<true, THERMO_DIM(data)>&        \
-          equation_of_state) const;
+#define INSTANTIATION(r, data)                                                 \
+  template void FixToAtmosphere<DIM(data)>::operator()(                        \
+      const gsl::not_null<Scalar<DataVector>*> rest_mass_density,              \
+      const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,       \
+      const gsl::not_null<tnsr::I<DataVector, DIM(data), Frame::Inertial>*>    \
+          spatial_velocity,                                                    \
+      const gsl::not_null<Scalar<DataVector>*> lorentz_factor,                 \
+      const gsl::not_null<Scalar<DataVector>*> pressure,                       \
+      const gsl::not_null<Scalar<DataVector>*> temperature,                    \
+      const Scalar<DataVector>& electron_fraction,                             \
+      const tnsr::ii<DataVector, DIM(data), Frame::Inertial>& spatial_metric,  \
+      const EquationsOfState::EquationOfState<true, THERMO_DIM(data)>&         \
+          equation_of_state) const;                                            \
+  template bool FixToAtmosphere<DIM(data)>::fix_point(                         \
+      const gsl::not_null<Scalar<DataVector>*> rest_mass_density,              \
+      const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,       \
+      const gsl::not_null<tnsr::I<DataVector, DIM(data), Frame::Inertial>*>    \
+          spatial_velocity,                                                    \
+      const gsl::not_null<Scalar<DataVector>*> lorentz_factor,                 \
+      const gsl::not_null<Scalar<DataVector>*> pressure,                       \
+      const gsl::not_null<Scalar<DataVector>*> temperature,                    \
+      const Scalar<DataVector>& electron_fraction,                             \
+      const tnsr::ii<DataVector, DIM(data), Frame::Inertial>& spatial_metric,  \
+      const EquationsOfState::EquationOfState<true, THERMO_DIM(data)>&         \
+          equation_of_state,                                                   \
+      size_t grid_index) const;
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3), (1, 2, 3))
 
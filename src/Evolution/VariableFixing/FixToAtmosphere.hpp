@@ -148,6 +148,27 @@ class FixToAtmosphere {
       const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
           equation_of_state) const;
 
+  /// \brief Apply the fix at the single point `grid_index`.
+  ///
+  /// Returns `true` if the point was set to the atmosphere, in which case
+  /// the velocity vanishes and no other velocity limiting is needed. This
+  /// allows fusing the fix into a single pass over the points together with
+  /// other per-point fixes.
+  template <size_t ThermodynamicDim>
+  bool fix_point(
+      gsl::not_null<Scalar<DataVector>*> rest_mass_density,
+      gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      gsl::not_null<tnsr::I<DataVector, Dim, Frame::Inertial>*>
+          spatial_velocity,
+      gsl::not_null<Scalar<DataVector>*> lorentz_factor,
+      gsl::not_null<Scalar<DataVector>*> pressure,
+      gsl::not_null<Scalar<DataVector>*> temperature,
+      const Scalar<DataVector>& electron_fraction,
+      const tnsr::ii<DataVector, Dim, Frame::Inertial>& spatial_metric,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state,
+      size_t grid_index) const;
+
  private:
   template <size_t ThermodynamicDim>
   void set_density_to_atmosphere(
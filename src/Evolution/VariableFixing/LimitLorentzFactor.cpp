@@ -35,19 +35,28 @@ void LimitLorentzFactor::operator()(
     return;
   }
 
-  constexpr size_t dim = 3;
   const size_t number_of_grid_points = get(rest_mass_density).size();
   for (size_t s = 0; s < number_of_grid_points; ++s) {
-    if (get(*lorentz_factor)[s] > lorentz_factor_cap_ and
-        get(rest_mass_density)[s] < max_density_cuttoff_) {
-      const double velocity_renorm_factor =
-          sqrt((1. - 1. / square(lorentz_factor_cap_)) /
-               (1. - 1. / square(get(*lorentz_factor)[s])));
+    limit_point(lorentz_factor, spatial_velocity, rest_mass_density, s);
+  }
+}
+
+void LimitLorentzFactor::limit_point(
+    const gsl::not_null<Scalar<DataVector>*> lorentz_factor,
+    const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+        spatial_velocity,
+    const Scalar<DataVector>& rest_mass_density,
+    const size_t grid_index) const {
+  constexpr size_t dim = 3;
+  if (get(*lorentz_factor)[grid_index] > lorentz_factor_cap_ and
+      get(rest_mass_density)[grid_index] < max_density_cuttoff_) {
+    const double velocity_renorm_factor =
+        sqrt((1. - 1. / square(lorentz_factor_cap_)) /
+             (1. - 1. / square(get(*lorentz_factor)[grid_index])));
 
-      get(*lorentz_factor)[s] = lorentz_factor_cap_;
-      for (size_t d = 0; d < dim; ++d) {
-        spatial_velocity->get(d)[s] *= velocity_renorm_factor;
-      }
+    get(*lorentz_factor)[grid_index] = lorentz_factor_cap_;
+    for (size_t d = 0; d < dim; ++d) {
+      spatial_velocity->get(d)[grid_index] *= velocity_renorm_factor;
     }
   }
 }
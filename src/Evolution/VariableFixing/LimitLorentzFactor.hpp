@@ -83,6 +83,16 @@ class LimitLorentzFactor {
       gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*> spatial_velocity,
       const Scalar<DataVector>& rest_mass_density) const;
 
+  /// Whether or not the limiting is enabled
+  bool is_enabled() const { return enable_; }
+
+  /// \brief Apply the limit at the single point `grid_index`, regardless of
+  /// whether the limiting is enabled.
+  void limit_point(
+      gsl::not_null<Scalar<DataVector>*> lorentz_factor,
+      gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*> spatial_velocity,
+      const Scalar<DataVector>& rest_mass_density, size_t grid_index) const;
+
  private:
   friend bool operator==(const LimitLorentzFactor& lhs,
                          const LimitLorentzFactor& rhs);
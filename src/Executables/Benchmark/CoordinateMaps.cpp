@@ -0,0 +1,123 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/CoordinateMaps/TimeDependent/RotScaleTrans.hpp"
+#include "Domain/CoordinateMaps/Wedge.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
+#include "Domain/FunctionsOfTime/QuaternionFunctionOfTime.hpp"
+#include "Domain/Structure/OrientationMap.hpp"
+
+namespace {
+// Benchmarks of the coordinate maps that dominate the cost of the
+// time-dependent maps in binary simulations, evaluated on the points of a 3d
+// element with `pts_1d` points per dimension.
+
+std::array<DataVector, 3> random_points(const size_t pts_1d,
+                                        const double lower,
+                                        const double upper) {
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> dist{lower, upper};
+  std::array<DataVector, 3> result{};
+  for (auto& component : result) {
+    component = DataVector(pts_1d * pts_1d * pts_1d);
+    for (double& value : component) {
+      value = dist(generator);
+    }
+  }
+  return result;
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_wedge(benchmark::State& state) {  // NOLINT
+  const domain::CoordinateMaps::Wedge<3> map{
+      1.0, 3.0, 0.0, 1.0, OrientationMap<3>::create_aligned(), true};
+  const auto logical_coords =
+      random_points(static_cast<size_t>(state.range(0)), -1.0, 1.0);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(map(logical_coords));
+  }
+}
+BENCHMARK(bench_wedge)->DenseRange(3, 12);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_wedge_jacobian(benchmark::State& state) {  // NOLINT
+  const domain::CoordinateMaps::Wedge<3> map{
+      1.0, 3.0, 0.0, 1.0, OrientationMap<3>::create_aligned(), true};
+  const auto logical_coords =
+      random_points(static_cast<size_t>(state.range(0)), -1.0, 1.0);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(map.jacobian(logical_coords));
+  }
+}
+BENCHMARK(bench_wedge_jacobian)->DenseRange(3, 12);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_rot_scale_trans(benchmark::State& state) {  // NOLINT
+  using Polynomial = domain::FunctionsOfTime::PiecewisePolynomial<3>;
+  using QuatFoT = domain::FunctionsOfTime::QuaternionFunctionOfTime<3>;
+  const double initial_time = 0.0;
+  const double expiration_time = 10.0;
+
+  std::unordered_map<std::string,
+                     std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
+      functions_of_time{};
+  DataVector axis{{1.0, -1.0, 1.0}};
+  axis /= sqrt(3.0);
+  const double angle = 1.0;
+  const std::array<DataVector, 1> initial_quaternion{
+      DataVector{{cos(0.5 * angle), axis[0] * sin(0.5 * angle),
+                  axis[1] * sin(0.5 * angle), axis[2] * sin(0.5 * angle)}}};
+  functions_of_time["rotation_angle"] = std::make_unique<QuatFoT>(
+      initial_time, initial_quaternion,
+      std::array<DataVector, 4>{
+          {axis * angle, axis * -2.0, axis * 2.0, axis * 0.0}},
+      expiration_time);
+  functions_of_time["expansion_a"] = std::make_unique<Polynomial>(
+      initial_time,
+      std::array<DataVector, 4>{{{0.98}, {-0.01}, {0.0}, {0.0}}},
+      expiration_time);
+  functions_of_time["expansion_b"] = std::make_unique<Polynomial>(
+      initial_time, std::array<DataVector, 4>{{{1.0}, {0.0}, {0.0}, {0.0}}},
+      expiration_time);
+  functions_of_time["translation"] = std::make_unique<Polynomial>(
+      initial_time,
+      std::array<DataVector, 4>{
+          {DataVector(3, 1.0), DataVector(3, -0.1), DataVector(3, 0.0),
+           DataVector(3, 0.0)}},
+      expiration_time);
+
+  const domain::CoordinateMaps::TimeDependent::RotScaleTrans<3> map{
+      std::pair<std::string, std::string>{"expansion_a", "expansion_b"},
+      "rotation_angle",
+      "translation",
+      10.0,
+      100.0,
+      domain::CoordinateMaps::TimeDependent::RotScaleTrans<
+          3>::BlockRegion::Transition};
+  // Points in the transition region between the inner and outer radius
+  const auto grid_coords =
+      random_points(static_cast<size_t>(state.range(0)), 10.0, 55.0);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(map(grid_coords, 1.5, functions_of_time));
+  }
+}
+BENCHMARK(bench_rot_scale_trans)->DenseRange(3, 12);  // NOLINT
+}  // namespace
@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// Benchmark of mutating an item in a DataBox and retrieving a compute item
+// that depends on it. The DataBox holds chains of compute items that depend on
+// each of the mutable items, similar to the compute items that depend on the
+// evolved variables and on the mesh in an evolution. Only one of the chains
+// depends on the mutated item, so the cost is dominated by finding the compute
+// items to reset, rather than by evaluating them.
+
+constexpr size_t chain_length = 8;
+
+template <size_t Chain>
+struct Mutable : db::SimpleTag {
+  using type = double;
+};
+
+template <size_t Chain, size_t Link>
+struct Computed : db::SimpleTag {
+  using type = double;
+};
+
+template <size_t Chain, size_t Link>
+struct ComputedCompute : Computed<Chain, Link>, db::ComputeTag {
+  using base = Computed<Chain, Link>;
+  using return_type = double;
+  using argument_tags = tmpl::list<Mutable<Chain>, Computed<Chain, Link - 1>>;
+  static void function(const gsl::not_null<double*> result,
+                       const double mutable_value, const double previous) {
+    *result = mutable_value + previous;
+  }
+};
+
+template <size_t Chain>
+struct ComputedCompute<Chain, 0> : Computed<Chain, 0>, db::ComputeTag {
+  using base = Computed<Chain, 0>;
+  using return_type = double;
+  using argument_tags = tmpl::list<Mutable<Chain>>;
+  static void function(const gsl::not_null<double*> result,
+                       const double mutable_value) {
+    *result = mutable_value;
+  }
+};
+
+template <size_t Chain, size_t... Links>
+tmpl::list<ComputedCompute<Chain, Links>...> chain_compute_tags_impl(
+    std::index_sequence<Links...> /*meta*/);
+
+template <size_t Chain>
+using chain_compute_tags = decltype(chain_compute_tags_impl<Chain>(
+    std::make_index_sequence<chain_length>{}));
+
+// clang-tidy: don't pass be non-const reference
+void bench_mutate_and_get(benchmark::State& state) {  // NOLINT
+  auto box = db::create<
+      db::AddSimpleTags<Mutable<0>, Mutable<1>, Mutable<2>, Mutable<3>>,
+      tmpl::append<chain_compute_tags<0>, chain_compute_tags<1>,
+                   chain_compute_tags<2>, chain_compute_tags<3>>>(1., 2., 3.,
+                                                                  4.);
+  while (state.KeepRunning()) {
+    db::mutate<Mutable<0>>(
+        [](const gsl::not_null<double*> value) { *value += 1.e-10; },
+        make_not_null(&box));
+    benchmark::DoNotOptimize(db::get<Computed<0, chain_length - 1>>(box));
+  }
+}
+BENCHMARK(bench_mutate_and_get);  // NOLINT
+}  // namespace
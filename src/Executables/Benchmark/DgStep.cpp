@@ -0,0 +1,435 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/SliceVariables.hpp"
+#include "DataStructures/Tensor/EagerMath/Determinant.hpp"
+#include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/Creators/DomainCreator.hpp"
+#include "Domain/Creators/Rectilinear.hpp"
+#include "Domain/Creators/Sphere.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementMap.hpp"
+#include "Domain/FaceNormal.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/IndexToSliceAt.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Evolution/Ader/Predictor.hpp"
+#include "Evolution/DiscontinuousGalerkin/Actions/VolumeTermsImpl.hpp"
+#include "Evolution/Systems/ScalarWave/BoundaryCorrections/UpwindPenalty.hpp"
+#include "Evolution/Systems/ScalarWave/System.hpp"
+#include "Evolution/Systems/ScalarWave/Tags.hpp"
+#include "Evolution/Systems/ScalarWave/TimeDerivative.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/LiftFlux.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "PointwiseFunctions/AnalyticSolutions/WaveEquation/PlaneWave.hpp"
+#include "PointwiseFunctions/MathFunctions/Gaussian.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/AdamsBashforth.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// End-to-end benchmarks of a DG step of the ScalarWave system on all elements
+// of a domain, and of each stage of the step on its own. The domain is either
+// a periodic cube or a sphere, with `state.range(0)` grid points per dimension
+// and refinement level `state.range(1)`. The `ElementSteps` counter is the
+// throughput in element-steps per second on a single core.
+//
+// Only the work an element does is benchmarked, so communication between
+// elements is not included. Each face receives the same precomputed data every
+// step as a stand-in for the data from its neighbor, and external boundaries
+// are treated like internal ones. Observations and triggers are not run.
+//
+// The `Ader` stage replaces the Adams-Bashforth step by an ADER-DG step: a
+// local space-time predictor followed by a corrector that needs a single
+// exchange of boundary data per step, instead of one per substep with a
+// Runge-Kutta method. ScalarWave is linear, so the corrector evaluates the
+// volume terms and the boundary corrections once, on the time-averaged
+// predictor.
+
+constexpr size_t volume_dim = 3;
+constexpr size_t time_stepper_order = 3;
+constexpr size_t ader_temporal_points = 4;
+
+using system = ScalarWave::System<volume_dim>;
+using variables_tags = typename system::variables_tag::tags_list;
+using dt_variables_tags = db::wrap_tags_in<::Tags::dt, variables_tags>;
+using BoundaryCorrection =
+    ScalarWave::BoundaryCorrections::UpwindPenalty<volume_dim>;
+using PackagedData =
+    Variables<typename BoundaryCorrection::dg_package_field_tags>;
+
+enum class DomainType { Rectilinear, Sphere };
+
+enum class Stage {
+  // Volume terms of the time derivative
+  Volume,
+  // Boundary corrections on all faces, lifted to the volume
+  Boundary,
+  // Time stepper update
+  Update,
+  // All of the above
+  Step,
+  // ADER-DG step
+  Ader
+};
+
+struct Face {
+  Direction<volume_dim> direction{};
+  size_t slice_index{};
+  tnsr::i<DataVector, volume_dim> unit_normal_covector{};
+  Scalar<DataVector> magnitude_of_normal{};
+  Scalar<DataVector> constraint_gamma2{};
+  Variables<variables_tags> vars{};
+  PackagedData local_data{};
+  PackagedData neighbor_data{};
+  Variables<dt_variables_tags> boundary_correction{};
+};
+
+struct ElementData {
+  Mesh<volume_dim> mesh{};
+  tnsr::I<DataVector, volume_dim> inertial_coords{};
+  InverseJacobian<DataVector, volume_dim, Frame::ElementLogical,
+                  Frame::Inertial>
+      inv_jacobian{};
+  Scalar<DataVector> det_inv_jacobian{};
+  Scalar<DataVector> constraint_gamma2{};
+  Variables<variables_tags> vars{};
+  Variables<dt_variables_tags> dt_vars{};
+  Variables<db::wrap_tags_in<::Tags::Flux, typename system::flux_variables,
+                             tmpl::size_t<volume_dim>, Frame::Inertial>>
+      volume_fluxes{};
+  Variables<db::wrap_tags_in<::Tags::deriv,
+                             typename system::gradient_variables,
+                             tmpl::size_t<volume_dim>, Frame::Inertial>>
+      partial_derivs{};
+  Variables<typename system::compute_volume_time_derivative_terms::
+                temporary_tags>
+      temporaries{};
+  Variables<db::wrap_tags_in<
+      ::Tags::div,
+      db::wrap_tags_in<::Tags::Flux, typename system::flux_variables,
+                       tmpl::size_t<volume_dim>, Frame::Inertial>>>
+      div_fluxes{};
+  std::vector<Face> faces{};
+  TimeSteppers::History<Variables<variables_tags>> history{
+      time_stepper_order};
+  std::vector<Variables<variables_tags>> predicted_vars{};
+  Variables<variables_tags> averaged_vars{};
+};
+
+template <DomainType Domain>
+std::unique_ptr<DomainCreator<volume_dim>> make_domain_creator(
+    const size_t points, const size_t refinement) {
+  if constexpr (Domain == DomainType::Rectilinear) {
+    return std::make_unique<domain::creators::Brick>(
+        std::array{-1.0, -1.0, -1.0}, std::array{1.0, 1.0, 1.0},
+        make_array<volume_dim>(refinement), make_array<volume_dim>(points),
+        make_array<volume_dim>(true));
+  } else {
+    return std::make_unique<domain::creators::Sphere>(
+        1.0, 3.0, domain::creators::Sphere::InnerCube{0.0}, refinement, points,
+        true);
+  }
+}
+
+template <typename... PackagedTags, typename... VariablesTags>
+void package_data(
+    const gsl::not_null<Variables<tmpl::list<PackagedTags...>>*> packaged_data,
+    const BoundaryCorrection& boundary_correction,
+    const Variables<tmpl::list<VariablesTags...>>& face_vars,
+    const Scalar<DataVector>& constraint_gamma2,
+    const tnsr::i<DataVector, volume_dim>& unit_normal_covector) {
+  boundary_correction.dg_package_data(
+      make_not_null(&get<PackagedTags>(*packaged_data))...,
+      get<VariablesTags>(face_vars)..., constraint_gamma2, unit_normal_covector,
+      std::nullopt, std::nullopt);
+}
+
+template <typename... CorrectionTags, typename... PackagedTags>
+void boundary_terms(
+    const gsl::not_null<Variables<tmpl::list<CorrectionTags...>>*>
+        boundary_correction_terms,
+    const BoundaryCorrection& boundary_correction,
+    const Variables<tmpl::list<PackagedTags...>>& local_data,
+    const Variables<tmpl::list<PackagedTags...>>& neighbor_data) {
+  boundary_correction.dg_boundary_terms(
+      make_not_null(&get<CorrectionTags>(*boundary_correction_terms))...,
+      get<PackagedTags>(local_data)..., get<PackagedTags>(neighbor_data)...,
+      ::dg::Formulation::StrongInertial);
+}
+
+std::vector<ElementData> make_elements(
+    const DomainCreator<volume_dim>& domain_creator) {
+  const auto domain = domain_creator.create_domain();
+  const auto initial_extents = domain_creator.initial_extents();
+  const ScalarWave::Solutions::PlaneWave<volume_dim> initial_data{
+      {{1.0, 1.0, 1.0}},
+      {{0.0, 0.0, 0.0}},
+      std::make_unique<MathFunctions::Gaussian<1, Frame::Inertial>>(1.0, 1.0,
+                                                                    0.0)};
+  const BoundaryCorrection boundary_correction{};
+  std::vector<ElementData> elements{};
+  for (const auto& element_id :
+       initial_element_ids(domain_creator.initial_refinement_levels())) {
+    ElementData& element = elements.emplace_back();
+    element.mesh =
+        Mesh<volume_dim>{initial_extents[element_id.block_id()],
+                         Spectral::Basis::Legendre,
+                         Spectral::Quadrature::GaussLobatto};
+    const size_t num_points = element.mesh.number_of_grid_points();
+    const ElementMap<volume_dim, Frame::Inertial> element_map{
+        element_id, domain.blocks()[element_id.block_id()]};
+    const auto logical_coords = logical_coordinates(element.mesh);
+    element.inertial_coords = element_map(logical_coords);
+    element.inv_jacobian = element_map.inv_jacobian(logical_coords);
+    element.det_inv_jacobian = determinant(element.inv_jacobian);
+    element.constraint_gamma2 = Scalar<DataVector>{num_points, 1.0};
+    element.vars.initialize(num_points);
+    element.vars.assign_subset(
+        initial_data.variables(element.inertial_coords, 0.0, variables_tags{}));
+    element.dt_vars.initialize(num_points, 0.0);
+
+    for (const auto& direction : Direction<volume_dim>::all_directions()) {
+      Face& face = element.faces.emplace_back();
+      const auto face_mesh = element.mesh.slice_away(direction.dimension());
+      const size_t num_face_points = face_mesh.number_of_grid_points();
+      face.direction = direction;
+      face.slice_index = index_to_slice_at(element.mesh.extents(), direction);
+      face.unit_normal_covector =
+          unnormalized_face_normal(face_mesh, element_map, direction);
+      face.magnitude_of_normal = magnitude(face.unit_normal_covector);
+      for (auto& component : face.unit_normal_covector) {
+        component /= get(face.magnitude_of_normal);
+      }
+      face.constraint_gamma2 = Scalar<DataVector>{num_face_points, 1.0};
+      face.vars.initialize(num_face_points);
+      face.local_data.initialize(num_face_points);
+      face.boundary_correction.initialize(num_face_points);
+      // The neighbor sees the face with the opposite normal
+      data_on_slice(make_not_null(&face.vars), element.vars,
+                    element.mesh.extents(), direction.dimension(),
+                    face.slice_index);
+      auto neighbor_normal = face.unit_normal_covector;
+      for (auto& component : neighbor_normal) {
+        component *= -1.0;
+      }
+      face.neighbor_data.initialize(num_face_points);
+      package_data(make_not_null(&face.neighbor_data), boundary_correction,
+                   face.vars, face.constraint_gamma2, neighbor_normal);
+    }
+  }
+  return elements;
+}
+
+void volume_terms(const gsl::not_null<Variables<dt_variables_tags>*> dt_vars,
+                  const gsl::not_null<ElementData*> element,
+                  const Variables<variables_tags>& vars) {
+  static const std::optional<tnsr::I<DataVector, volume_dim>> mesh_velocity{};
+  static const std::optional<Scalar<DataVector>> div_mesh_velocity{};
+  dt_vars->initialize(vars.number_of_grid_points());
+  evolution::dg::Actions::detail::volume_terms<
+      ScalarWave::TimeDerivative<volume_dim>>(
+      dt_vars, make_not_null(&element->volume_fluxes),
+      make_not_null(&element->partial_derivs),
+      make_not_null(&element->temporaries),
+      make_not_null(&element->div_fluxes), vars,
+      ::dg::Formulation::StrongInertial, element->mesh,
+      element->inertial_coords, element->inv_jacobian,
+      &element->det_inv_jacobian, mesh_velocity, div_mesh_velocity,
+      evolution::dg::Actions::detail::VolumeTermsStage::All,
+      get<ScalarWave::Tags::Pi>(vars),
+      get<ScalarWave::Tags::Phi<volume_dim>>(vars),
+      element->constraint_gamma2);
+}
+
+void volume_terms(const gsl::not_null<ElementData*> element) {
+  volume_terms(make_not_null(&element->dt_vars), element, element->vars);
+}
+
+void apply_boundary_corrections(
+    const gsl::not_null<Variables<dt_variables_tags>*> dt_vars,
+    const gsl::not_null<ElementData*> element,
+    const BoundaryCorrection& boundary_correction,
+    const Variables<variables_tags>& vars) {
+  const auto& extents = element->mesh.extents();
+  for (auto& face : element->faces) {
+    const size_t dimension = face.direction.dimension();
+    data_on_slice(make_not_null(&face.vars), vars, extents, dimension,
+                  face.slice_index);
+    package_data(make_not_null(&face.local_data), boundary_correction,
+                 face.vars, face.constraint_gamma2, face.unit_normal_covector);
+    boundary_terms(make_not_null(&face.boundary_correction),
+                   boundary_correction, face.local_data, face.neighbor_data);
+    ::dg::lift_flux(make_not_null(&face.boundary_correction),
+                    extents[dimension], face.magnitude_of_normal);
+    add_slice_to_data(dt_vars, face.boundary_correction, extents, dimension,
+                      face.slice_index);
+  }
+}
+
+void apply_boundary_corrections(
+    const gsl::not_null<ElementData*> element,
+    const BoundaryCorrection& boundary_correction) {
+  apply_boundary_corrections(make_not_null(&element->dt_vars), element,
+                             boundary_correction, element->vars);
+}
+
+void update(const gsl::not_null<ElementData*> element,
+            const TimeSteppers::AdamsBashforth& time_stepper,
+            const TimeStepId& time_step_id, const TimeDelta& time_step) {
+  element->history.insert(time_step_id, element->vars, element->dt_vars);
+  time_stepper.update_u(make_not_null(&element->vars), element->history,
+                        time_step);
+  time_stepper.clean_history(make_not_null(&element->history));
+}
+
+void ader_step(const gsl::not_null<ElementData*> element,
+               const BoundaryCorrection& boundary_correction,
+               const double time_step) {
+  ader::dg::spacetime_predictor<Variables<dt_variables_tags>>(
+      make_not_null(&element->predicted_vars), element->vars, time_step,
+      ader_temporal_points,
+      [&element](const gsl::not_null<Variables<dt_variables_tags>*> dt_vars,
+                 const Variables<variables_tags>& vars,
+                 const double /*time_offset*/) {
+        volume_terms(dt_vars, element, vars);
+      },
+      ader_temporal_points);
+  ader::dg::time_average(make_not_null(&element->averaged_vars),
+                         element->predicted_vars);
+  // The corrector, which is the only place that needs neighbor data
+  volume_terms(make_not_null(&element->dt_vars), element,
+               element->averaged_vars);
+  apply_boundary_corrections(make_not_null(&element->dt_vars), element,
+                             boundary_correction, element->averaged_vars);
+  DataVector vars_view{element->vars.data(), element->vars.size()};
+  vars_view +=
+      time_step * DataVector{element->dt_vars.data(), element->dt_vars.size()};
+}
+
+template <DomainType Domain, Stage BenchmarkedStage>
+// clang-tidy: don't pass be non-const reference
+void bench_dg_step(benchmark::State& state) {  // NOLINT
+  const auto points = static_cast<size_t>(state.range(0));
+  const auto refinement = static_cast<size_t>(state.range(1));
+  auto elements =
+      make_elements(*make_domain_creator<Domain>(points, refinement));
+  const BoundaryCorrection boundary_correction{};
+  const TimeSteppers::AdamsBashforth time_stepper{time_stepper_order};
+
+  // Each step is a slab, with a size that keeps the evolution stable
+  Slab slab{0.0, 0.1 / (square(points) * two_to_the(refinement))};
+  int64_t slab_number = 0;
+  const auto next_step = [&slab, &slab_number]() {
+    slab = slab.advance();
+    ++slab_number;
+    return TimeStepId{true, slab_number, slab.start()};
+  };
+  // Fill the history so the steps are done at full order
+  for (size_t i = 0; i < time_stepper_order - 1; ++i) {
+    const TimeStepId time_step_id = next_step();
+    for (auto& element : elements) {
+      volume_terms(make_not_null(&element));
+      apply_boundary_corrections(make_not_null(&element), boundary_correction);
+      update(make_not_null(&element), time_stepper, time_step_id,
+             slab.duration());
+    }
+  }
+
+  while (state.KeepRunning()) {
+    const TimeStepId time_step_id = next_step();
+    for (auto& element : elements) {
+      if constexpr (BenchmarkedStage == Stage::Volume or
+                    BenchmarkedStage == Stage::Step) {
+        volume_terms(make_not_null(&element));
+      }
+      if constexpr (BenchmarkedStage == Stage::Boundary or
+                    BenchmarkedStage == Stage::Step) {
+        apply_boundary_corrections(make_not_null(&element),
+                                   boundary_correction);
+      }
+      if constexpr (BenchmarkedStage == Stage::Update or
+                    BenchmarkedStage == Stage::Step) {
+        update(make_not_null(&element), time_stepper, time_step_id,
+               slab.duration());
+      }
+      if constexpr (BenchmarkedStage == Stage::Ader) {
+        ader_step(make_not_null(&element), boundary_correction,
+                  slab.duration().value());
+      }
+      benchmark::DoNotOptimize(element.vars.data());
+    }
+  }
+  state.counters["Elements"] = static_cast<double>(elements.size());
+  state.counters["ElementSteps"] =
+      benchmark::Counter(static_cast<double>(elements.size()),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// clang-tidy: don't pass be non-const reference
+void dg_step_args(benchmark::internal::Benchmark* benchmark) {  // NOLINT
+  benchmark->ArgNames({"Points", "Refinement"});
+  for (const int64_t points : {4, 6, 8}) {
+    for (const int64_t refinement : {1, 2}) {
+      benchmark->Args({points, refinement});
+    }
+  }
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_dg_step, DomainType::Rectilinear, Stage::Volume)
+    ->Apply(dg_step_args);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_dg_step, DomainType::Rectilinear, Stage::Boundary)
+    ->Apply(dg_step_args);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_dg_step, DomainType::Rectilinear, Stage::Update)
+    ->Apply(dg_step_args);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_dg_step, DomainType::Rectilinear, Stage::Step)
+    ->Apply(dg_step_args);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_dg_step, DomainType::Rectilinear, Stage::Ader)
+    ->Apply(dg_step_args);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_dg_step, DomainType::Sphere, Stage::Volume)
+    ->Apply(dg_step_args);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_dg_step, DomainType::Sphere, Stage::Boundary)
+    ->Apply(dg_step_args);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_dg_step, DomainType::Sphere, Stage::Update)
+    ->Apply(dg_step_args);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_dg_step, DomainType::Sphere, Stage::Step)
+    ->Apply(dg_step_args);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_dg_step, DomainType::Sphere, Stage::Ader)
+    ->Apply(dg_step_args);
@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "Evolution/DgSubcell/Projection.hpp"
+#include "Evolution/DgSubcell/Reconstruction.hpp"
+#include "Evolution/DgSubcell/ReconstructionMethod.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Benchmarks of projecting the 5 hydro variables from a 3d
+// Legendre-Gauss-Lobatto mesh with `pts_1d` points per dimension to the
+// subcells, and of reconstructing a single variable back.
+
+constexpr size_t number_of_variables = 5;
+
+DataVector random_data(const size_t size) {
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> dist{0.5, 1.5};
+  DataVector result{size};
+  for (double& value : result) {
+    value = dist(generator);
+  }
+  return result;
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_project(benchmark::State& state) {  // NOLINT
+  const Mesh<3> dg_mesh{static_cast<size_t>(state.range(0)),
+                        Spectral::Basis::Legendre,
+                        Spectral::Quadrature::GaussLobatto};
+  const Index<3> subcell_extents{2 * dg_mesh.extents(0) - 1};
+  const DataVector dg_u =
+      random_data(dg_mesh.number_of_grid_points() * number_of_variables);
+  DataVector subcell_u{subcell_extents.product() * number_of_variables};
+
+  while (state.KeepRunning()) {
+    evolution::dg::subcell::fd::project(make_not_null(&subcell_u), dg_u,
+                                        dg_mesh, subcell_extents);
+    benchmark::DoNotOptimize(subcell_u.data());
+  }
+}
+BENCHMARK(bench_project)->DenseRange(3, 8);  // NOLINT
+
+template <evolution::dg::subcell::fd::ReconstructionMethod Method>
+// clang-tidy: don't pass be non-const reference
+void bench_reconstruct(benchmark::State& state) {  // NOLINT
+  const Mesh<3> dg_mesh{static_cast<size_t>(state.range(0)),
+                        Spectral::Basis::Legendre,
+                        Spectral::Quadrature::GaussLobatto};
+  const Index<3> subcell_extents{2 * dg_mesh.extents(0) - 1};
+  const DataVector subcell_u = random_data(subcell_extents.product());
+  DataVector dg_u{dg_mesh.number_of_grid_points()};
+
+  while (state.KeepRunning()) {
+    evolution::dg::subcell::fd::reconstruct(make_not_null(&dg_u), subcell_u,
+                                            dg_mesh, subcell_extents, Method);
+    benchmark::DoNotOptimize(dg_u.data());
+  }
+}
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(
+    bench_reconstruct,
+    evolution::dg::subcell::fd::ReconstructionMethod::AllDimsAtOnce)
+    ->DenseRange(3, 8);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_reconstruct,
+                   evolution::dg::subcell::fd::ReconstructionMethod::DimByDim)
+    ->DenseRange(3, 8);
+}  // namespace
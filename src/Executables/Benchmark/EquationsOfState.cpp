@@ -0,0 +1,158 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "NumericalAlgorithms/Interpolation/MultiLinearSpanInterpolation.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Benchmarks of lookups in a tabulated three-dimensional EOS. The table is
+// synthetic because only the cost of the interpolation and of the root find
+// matters here, not the physics.
+
+using Eos = EquationsOfState::Tabulated3D<true>;
+
+std::vector<double> linspace(const double lower, const double upper,
+                             const size_t size) {
+  std::vector<double> result(size);
+  for (size_t i = 0; i < size; ++i) {
+    result[i] = lower + static_cast<double>(i) * (upper - lower) /
+                            static_cast<double>(size - 1);
+  }
+  return result;
+}
+
+Eos make_table(const intrp::TableLayout layout) {
+  constexpr size_t table_size = 64;
+  auto electron_fraction = linspace(0.05, 0.55, table_size);
+  auto log_density = linspace(std::log(1.0e-10), std::log(1.0e-2), table_size);
+  auto log_temperature = linspace(std::log(0.01), std::log(100.0), table_size);
+
+  // The temperature index varies fastest, then the density and the electron
+  // fraction, and the fields at each point are stored contiguously.
+  std::vector<double> table_data(table_size * table_size * table_size *
+                                 Eos::NumberOfVars);
+  size_t index = 0;
+  for (size_t i_ye = 0; i_ye < table_size; ++i_ye) {
+    for (size_t i_rho = 0; i_rho < table_size; ++i_rho) {
+      for (size_t i_temp = 0; i_temp < table_size; ++i_temp) {
+        const double log_temp = log_temperature[i_temp];
+        table_data[index + Eos::Epsilon] = log_temp + std::log(1.5);
+        table_data[index + Eos::Pressure] = log_temp + log_density[i_rho];
+        table_data[index + Eos::CsSquared] = 0.1 + electron_fraction[i_ye];
+        table_data[index + Eos::DeltaMu] = 0.0;
+        index += Eos::NumberOfVars;
+      }
+    }
+  }
+  return Eos{std::move(electron_fraction), std::move(log_density),
+             std::move(log_temperature), std::move(table_data), 0.0, 1.0,
+             layout};
+}
+
+// Random states inside the table on `pts_1d^3` points, the number of points of
+// an element.
+struct States {
+  explicit States(const size_t pts_1d)
+      : rest_mass_density(pts_1d * pts_1d * pts_1d),
+        temperature(pts_1d * pts_1d * pts_1d),
+        electron_fraction(pts_1d * pts_1d * pts_1d) {
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> log_density_dist{std::log(1.0e-9),
+                                                            std::log(1.0e-3)};
+    std::uniform_real_distribution<double> log_temperature_dist{
+        std::log(0.1), std::log(50.0)};
+    std::uniform_real_distribution<double> electron_fraction_dist{0.1, 0.5};
+    for (size_t i = 0; i < get(rest_mass_density).size(); ++i) {
+      get(rest_mass_density)[i] = std::exp(log_density_dist(generator));
+      get(temperature)[i] = std::exp(log_temperature_dist(generator));
+      get(electron_fraction)[i] = electron_fraction_dist(generator);
+    }
+  }
+
+  Scalar<DataVector> rest_mass_density;
+  Scalar<DataVector> temperature;
+  Scalar<DataVector> electron_fraction;
+};
+
+template <intrp::TableLayout Layout>
+// clang-tidy: don't pass be non-const reference
+void bench_tabulated3d_pressure(benchmark::State& state) {  // NOLINT
+  const Eos eos = make_table(Layout);
+  const States states{static_cast<size_t>(state.range(0))};
+
+  while (state.KeepRunning()) {
+    auto pressure = eos.pressure_from_density_and_temperature(
+        states.rest_mass_density, states.temperature,
+        states.electron_fraction);
+    benchmark::DoNotOptimize(get(pressure).data());
+  }
+}
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_tabulated3d_pressure,
+                   intrp::TableLayout::PointInterleaved)
+    ->DenseRange(4, 16, 2);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_tabulated3d_pressure,
+                   intrp::TableLayout::CellInterleaved)
+    ->DenseRange(4, 16, 2);
+
+template <intrp::TableLayout Layout>
+// clang-tidy: don't pass be non-const reference
+void bench_tabulated3d_pressure_energy_sound_speed(  // NOLINT
+    benchmark::State& state) {
+  const Eos eos = make_table(Layout);
+  const States states{static_cast<size_t>(state.range(0))};
+  Scalar<DataVector> pressure{};
+  Scalar<DataVector> specific_internal_energy{};
+  Scalar<DataVector> sound_speed_squared{};
+
+  while (state.KeepRunning()) {
+    eos.pressure_energy_and_sound_speed_squared_from_density_and_temperature(
+        make_not_null(&pressure), make_not_null(&specific_internal_energy),
+        make_not_null(&sound_speed_squared), states.rest_mass_density,
+        states.temperature, states.electron_fraction);
+    benchmark::DoNotOptimize(get(pressure).data());
+  }
+}
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_tabulated3d_pressure_energy_sound_speed,
+                   intrp::TableLayout::PointInterleaved)
+    ->DenseRange(4, 16, 2);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_tabulated3d_pressure_energy_sound_speed,
+                   intrp::TableLayout::CellInterleaved)
+    ->DenseRange(4, 16, 2);
+
+// clang-tidy: don't pass be non-const reference
+void bench_tabulated3d_temperature(benchmark::State& state) {  // NOLINT
+  const Eos eos = make_table(intrp::TableLayout::PointInterleaved);
+  const States states{static_cast<size_t>(state.range(0))};
+  const auto specific_internal_energy =
+      eos.specific_internal_energy_from_density_and_temperature(
+          states.rest_mass_density, states.temperature,
+          states.electron_fraction);
+
+  // The temperature has to be found by a root find so this is the most
+  // expensive lookup during primitive recovery
+  while (state.KeepRunning()) {
+    auto temperature = eos.temperature_from_density_and_energy(
+        states.rest_mass_density, specific_internal_energy,
+        states.electron_fraction);
+    benchmark::DoNotOptimize(get(temperature).data());
+  }
+}
+BENCHMARK(bench_tabulated3d_temperature)->DenseRange(4, 16, 2);  // NOLINT
+}  // namespace
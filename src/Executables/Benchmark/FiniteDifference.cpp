@@ -0,0 +1,120 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonisedCentral.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Wcns5z.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+
+namespace {
+// Benchmarks of the FD reconstruction of the 5 hydro variables to the faces
+// of a 3d subcell mesh with `pts_1d` points per dimension.
+
+constexpr size_t number_of_variables = 5;
+
+class ReconstructionData {
+ public:
+  ReconstructionData(const size_t pts_1d, const size_t stencil_width)
+      : extents_(pts_1d),
+        volume_vars_(extents_.product() * number_of_variables) {
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> dist{0.5, 1.5};
+    for (double& value : volume_vars_) {
+      value = dist(generator);
+    }
+    const size_t ghost_zone_size = (stencil_width + 1) / 2;
+    for (const auto& direction : Direction<3>::all_directions()) {
+      DataVector& ghost_data = ghost_data_[direction];
+      ghost_data = DataVector{ghost_zone_size * pts_1d * pts_1d *
+                              number_of_variables};
+      for (double& value : ghost_data) {
+        value = dist(generator);
+      }
+      ghost_cell_vars_[direction] =
+          gsl::make_span(ghost_data.data(), ghost_data.size());
+    }
+    for (size_t d = 0; d < 3; ++d) {
+      gsl::at(upper_face_data_, d) = DataVector{
+          (pts_1d + 1) * pts_1d * pts_1d * number_of_variables};
+      gsl::at(lower_face_data_, d) = DataVector{
+          (pts_1d + 1) * pts_1d * pts_1d * number_of_variables};
+      gsl::at(upper_face_vars_, d) = gsl::make_span(
+          gsl::at(upper_face_data_, d).data(),
+          gsl::at(upper_face_data_, d).size());
+      gsl::at(lower_face_vars_, d) = gsl::make_span(
+          gsl::at(lower_face_data_, d).data(),
+          gsl::at(lower_face_data_, d).size());
+    }
+  }
+
+  gsl::not_null<std::array<gsl::span<double>, 3>*> upper_face_vars() {
+    return make_not_null(&upper_face_vars_);
+  }
+  gsl::not_null<std::array<gsl::span<double>, 3>*> lower_face_vars() {
+    return make_not_null(&lower_face_vars_);
+  }
+  gsl::span<const double> volume_vars() const {
+    return gsl::make_span(volume_vars_.data(), volume_vars_.size());
+  }
+  const DirectionMap<3, gsl::span<const double>>& ghost_cell_vars() const {
+    return ghost_cell_vars_;
+  }
+  const Index<3>& extents() const { return extents_; }
+  const double* result() const { return upper_face_data_[0].data(); }
+
+ private:
+  Index<3> extents_;
+  DataVector volume_vars_;
+  DirectionMap<3, DataVector> ghost_data_{};
+  DirectionMap<3, gsl::span<const double>> ghost_cell_vars_{};
+  std::array<DataVector, 3> upper_face_data_{};
+  std::array<DataVector, 3> lower_face_data_{};
+  std::array<gsl::span<double>, 3> upper_face_vars_{};
+  std::array<gsl::span<double>, 3> lower_face_vars_{};
+};
+
+// clang-tidy: don't pass be non-const reference
+void bench_monotonised_central(benchmark::State& state) {  // NOLINT
+  ReconstructionData data{static_cast<size_t>(state.range(0)), 3};
+
+  while (state.KeepRunning()) {
+    fd::reconstruction::monotonised_central(
+        data.upper_face_vars(), data.lower_face_vars(), data.volume_vars(),
+        data.ghost_cell_vars(), data.extents(), number_of_variables);
+    benchmark::DoNotOptimize(data.result());
+  }
+}
+BENCHMARK(bench_monotonised_central)->DenseRange(4, 16, 2);  // NOLINT
+
+template <class FallbackReconstructor>
+// clang-tidy: don't pass be non-const reference
+void bench_wcns5z(benchmark::State& state) {  // NOLINT
+  ReconstructionData data{static_cast<size_t>(state.range(0)), 5};
+
+  while (state.KeepRunning()) {
+    fd::reconstruction::wcns5z<2, FallbackReconstructor>(
+        data.upper_face_vars(), data.lower_face_vars(), data.volume_vars(),
+        data.ghost_cell_vars(), data.extents(), number_of_variables, 2.0e-16,
+        1);
+    benchmark::DoNotOptimize(data.result());
+  }
+}
+BENCHMARK_TEMPLATE(bench_wcns5z, void)->DenseRange(4, 16, 2);  // NOLINT
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(
+    bench_wcns5z,
+    fd::reconstruction::detail::MonotonisedCentralReconstructor)
+    ->DenseRange(4, 16, 2);
+}  // namespace
@@ -0,0 +1,135 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cstddef>
+#include <optional>
+#include <random>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Harmonic.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Ricci.hpp"
+#include "PointwiseFunctions/GeneralRelativity/WeylElectric.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// Benchmarks of GR pointwise functions on `pts_1d^3` points, the number of
+// points of an element. The inputs are random because only the number of
+// operations matters here, not the physics.
+
+template <typename TensorType>
+TensorType random_tensor(const size_t pts_1d) {
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> dist{0.5, 1.5};
+  TensorType result{pts_1d * pts_1d * pts_1d};
+  for (auto& component : result) {
+    for (double& value : component) {
+      value = dist(generator);
+    }
+  }
+  return result;
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_ricci_tensor(benchmark::State& state) {  // NOLINT
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  const auto christoffel =
+      random_tensor<tnsr::Ijj<DataVector, 3, Frame::Inertial>>(pts_1d);
+  const auto d_christoffel =
+      random_tensor<tnsr::iJkk<DataVector, 3, Frame::Inertial>>(pts_1d);
+  tnsr::ii<DataVector, 3, Frame::Inertial> ricci{};
+
+  while (state.KeepRunning()) {
+    gr::ricci_tensor(make_not_null(&ricci), christoffel, d_christoffel);
+    benchmark::DoNotOptimize(get<0, 0>(ricci).data());
+  }
+}
+BENCHMARK(bench_ricci_tensor)->DenseRange(4, 12, 2);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_weyl_electric(benchmark::State& state) {  // NOLINT
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  const auto spatial_ricci =
+      random_tensor<tnsr::ii<DataVector, 3, Frame::Inertial>>(pts_1d);
+  const auto extrinsic_curvature =
+      random_tensor<tnsr::ii<DataVector, 3, Frame::Inertial>>(pts_1d);
+  const auto inverse_spatial_metric =
+      random_tensor<tnsr::II<DataVector, 3, Frame::Inertial>>(pts_1d);
+  tnsr::ii<DataVector, 3, Frame::Inertial> weyl_electric{
+      pts_1d * pts_1d * pts_1d};
+
+  while (state.KeepRunning()) {
+    gr::weyl_electric(make_not_null(&weyl_electric), spatial_ricci,
+                      extrinsic_curvature, inverse_spatial_metric);
+    benchmark::DoNotOptimize(get<0, 0>(weyl_electric).data());
+  }
+}
+BENCHMARK(bench_weyl_electric)->DenseRange(4, 12, 2);  // NOLINT
+
+// The GH time derivative evaluates the inverse spacetime metric, the normal
+// vector and the Christoffel symbols on SIMD batches of points.
+// clang-tidy: don't pass be non-const reference
+void bench_gh_time_derivative(benchmark::State& state) {  // NOLINT
+  constexpr size_t dim = 3;
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  const Mesh<dim> mesh{pts_1d, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  const size_t number_of_points = mesh.number_of_grid_points();
+
+  // A perturbation of Minkowski, so the lapse and the inverse spatial metric
+  // are well defined
+  auto spacetime_metric = random_tensor<tnsr::aa<DataVector, dim>>(pts_1d);
+  for (size_t a = 0; a < dim + 1; ++a) {
+    for (size_t b = a; b < dim + 1; ++b) {
+      spacetime_metric.get(a, b) = 0.1 * (spacetime_metric.get(a, b) - 1.0);
+    }
+    spacetime_metric.get(a, a) += a == 0 ? -1.0 : 1.0;
+  }
+  const auto pi = random_tensor<tnsr::aa<DataVector, dim>>(pts_1d);
+  const auto phi = random_tensor<tnsr::iaa<DataVector, dim>>(pts_1d);
+  const auto d_spacetime_metric =
+      random_tensor<tnsr::iaa<DataVector, dim>>(pts_1d);
+  const auto d_pi = random_tensor<tnsr::iaa<DataVector, dim>>(pts_1d);
+  const auto d_phi = random_tensor<tnsr::ijaa<DataVector, dim>>(pts_1d);
+  const auto gamma0 = random_tensor<Scalar<DataVector>>(pts_1d);
+  const auto gamma1 = random_tensor<Scalar<DataVector>>(pts_1d);
+  const auto gamma2 = random_tensor<Scalar<DataVector>>(pts_1d);
+  const auto inertial_coords = random_tensor<tnsr::I<DataVector, dim>>(pts_1d);
+  const auto inverse_jacobian =
+      random_tensor<InverseJacobian<DataVector, dim, Frame::ElementLogical,
+                                    Frame::Inertial>>(pts_1d);
+  const gh::gauges::Harmonic gauge_condition{};
+
+  tnsr::aa<DataVector, dim> dt_spacetime_metric{number_of_points};
+  tnsr::aa<DataVector, dim> dt_pi{number_of_points};
+  tnsr::iaa<DataVector, dim> dt_phi{number_of_points};
+  Variables<typename gh::TimeDerivative<dim>::temporary_tags> buffer{
+      number_of_points};
+  const auto time_derivative =
+      [&]<typename... TemporaryTags>(tmpl::list<TemporaryTags...> /*meta*/) {
+        gh::TimeDerivative<dim>::apply(
+            make_not_null(&dt_spacetime_metric), make_not_null(&dt_pi),
+            make_not_null(&dt_phi),
+            make_not_null(&get<TemporaryTags>(buffer))..., d_spacetime_metric,
+            d_pi, d_phi, spacetime_metric, pi, phi, gamma0, gamma1, gamma2,
+            gauge_condition, mesh, 0.0, inertial_coords, inverse_jacobian,
+            std::nullopt);
+      };
+
+  while (state.KeepRunning()) {
+    time_derivative(typename gh::TimeDerivative<dim>::temporary_tags{});
+    benchmark::DoNotOptimize(get<0, 0>(dt_pi).data());
+  }
+}
+BENCHMARK(bench_gh_time_derivative)->DenseRange(4, 12, 2);  // NOLINT
+}  // namespace
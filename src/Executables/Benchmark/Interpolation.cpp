@@ -0,0 +1,74 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Benchmarks of interpolating from a 3d Legendre-Gauss-Lobatto mesh with
+// `pts_1d` points per dimension to 100 random points in the element, which is
+// roughly the number of points a horizon finder or a Cauchy-characteristic
+// extraction worldtube places in a single element.
+
+constexpr size_t number_of_target_points = 100;
+
+tnsr::I<DataVector, 3, Frame::ElementLogical> random_target_points() {
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+  tnsr::I<DataVector, 3, Frame::ElementLogical> result{
+      number_of_target_points};
+  for (auto& component : result) {
+    for (double& value : component) {
+      value = dist(generator);
+    }
+  }
+  return result;
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_irregular_interpolant_construction(  // NOLINT
+    benchmark::State& state) {
+  const Mesh<3> mesh{static_cast<size_t>(state.range(0)),
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const auto target_points = random_target_points();
+
+  while (state.KeepRunning()) {
+    const intrp::Irregular<3> interpolant{mesh, target_points};
+    benchmark::DoNotOptimize(interpolant);
+  }
+}
+// NOLINTNEXTLINE
+BENCHMARK(bench_irregular_interpolant_construction)->DenseRange(3, 12);
+
+// clang-tidy: don't pass be non-const reference
+void bench_irregular_interpolant_apply(benchmark::State& state) {  // NOLINT
+  const Mesh<3> mesh{static_cast<size_t>(state.range(0)),
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const intrp::Irregular<3> interpolant{mesh, random_target_points()};
+  const auto logical_coords = logical_coordinates(mesh);
+  const DataVector input = get<0>(logical_coords) * get<1>(logical_coords) +
+                           get<2>(logical_coords);
+  DataVector result{number_of_target_points};
+
+  while (state.KeepRunning()) {
+    interpolant.interpolate(make_not_null(&result), input);
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(bench_irregular_interpolant_apply)->DenseRange(3, 12);  // NOLINT
+}  // namespace
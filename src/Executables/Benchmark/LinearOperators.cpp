@@ -0,0 +1,208 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/ApplyMatrixInFirstDimension.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/CoordinateMaps/Wedge.hpp"
+#include "Domain/Structure/OrientationMap.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// Benchmarks of the all_gradient routine for the variables of the GH system
+
+template <size_t Dim>
+struct Kappa : db::SimpleTag {
+  using type = tnsr::abb<DataVector, Dim, Frame::Grid>;
+};
+template <size_t Dim>
+struct Psi : db::SimpleTag {
+  using type = tnsr::aa<DataVector, Dim, Frame::Grid>;
+};
+
+// The inverse Jacobian of a wedge of a spherical shell, which is neither
+// diagonal nor constant, so the derivatives take the general path
+InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Grid>
+wedge_inverse_jacobian(const Mesh<3>& mesh) {
+  const auto map = domain::make_coordinate_map<Frame::ElementLogical,
+                                               Frame::Grid>(
+      domain::CoordinateMaps::Wedge<3>{1.0, 3.0, 0.0, 1.0,
+                                       OrientationMap<3>::create_aligned(),
+                                       true});
+  return map.inv_jacobian(logical_coordinates(mesh));
+}
+
+// The number of points per dimension is the benchmark's range argument so the
+// fused general path, the two passes over memory that it replaces, and the
+// diagonal inverse Jacobian path can be compared over the resolutions we run
+// at.
+// clang-tidy: don't pass be non-const reference
+void bench_all_gradient(benchmark::State& state) {  // NOLINT
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  constexpr const size_t Dim = 3;
+  const Mesh<Dim> mesh{pts_1d, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  const auto inv_jac = wedge_inverse_jacobian(mesh);
+  Variables<VarTags> vars(mesh.number_of_grid_points(), 0.0);
+  Variables<db::wrap_tags_in<Tags::deriv, VarTags, tmpl::size_t<Dim>,
+                             Frame::Grid>>
+      du(mesh.number_of_grid_points());
+
+  while (state.KeepRunning()) {
+    partial_derivatives(make_not_null(&du), vars, mesh, inv_jac);
+    benchmark::DoNotOptimize(du.data());
+  }
+}
+BENCHMARK(bench_all_gradient)->DenseRange(3, 12);  // NOLINT
+
+// Computes the logical derivatives of all variables first and contracts them
+// with the inverse Jacobian in a second pass
+// clang-tidy: don't pass be non-const reference
+void bench_all_gradient_two_passes(benchmark::State& state) {  // NOLINT
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  constexpr const size_t Dim = 3;
+  const Mesh<Dim> mesh{pts_1d, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  const auto inv_jac = wedge_inverse_jacobian(mesh);
+  Variables<VarTags> vars(mesh.number_of_grid_points(), 0.0);
+  std::array<Variables<VarTags>, Dim> logical_du{};
+  Variables<db::wrap_tags_in<Tags::deriv, VarTags, tmpl::size_t<Dim>,
+                             Frame::Grid>>
+      du(mesh.number_of_grid_points());
+
+  while (state.KeepRunning()) {
+    logical_partial_derivatives<VarTags>(make_not_null(&logical_du), vars,
+                                         mesh);
+    partial_derivatives(make_not_null(&du), logical_du, inv_jac);
+    benchmark::DoNotOptimize(du.data());
+  }
+}
+BENCHMARK(bench_all_gradient_two_passes)->DenseRange(3, 12);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_all_gradient_diagonal(benchmark::State& state) {  // NOLINT
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  constexpr const size_t Dim = 3;
+  const Mesh<Dim> mesh{pts_1d, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  Variables<VarTags> vars(mesh.number_of_grid_points(), 0.0);
+  Variables<db::wrap_tags_in<Tags::deriv, VarTags, tmpl::size_t<Dim>,
+                             Frame::Grid>>
+      du(mesh.number_of_grid_points());
+  const std::array<double, Dim> diagonal_inv_jac{{1.0, 1.0, 1.0}};
+
+  while (state.KeepRunning()) {
+    partial_derivatives(make_not_null(&du), vars, mesh, diagonal_inv_jac);
+    benchmark::DoNotOptimize(du.data());
+  }
+}
+BENCHMARK(bench_all_gradient_diagonal)->DenseRange(3, 12);  // NOLINT
+
+// Transform the GH variables from modal to nodal coefficients, which applies a
+// dense matrix in every dimension.
+std::array<Matrix, 3> modal_to_nodal_matrices(const Mesh<3>& mesh) {
+  return {{Spectral::modal_to_nodal_matrix(mesh.slice_through(0)),
+           Spectral::modal_to_nodal_matrix(mesh.slice_through(1)),
+           Spectral::modal_to_nodal_matrix(mesh.slice_through(2))}};
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_apply_matrices(benchmark::State& state) {  // NOLINT
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  constexpr const size_t Dim = 3;
+  const Mesh<Dim> mesh{pts_1d, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  const Variables<VarTags> vars(mesh.number_of_grid_points(), 1.0);
+  Variables<VarTags> result(mesh.number_of_grid_points());
+  const auto matrices = modal_to_nodal_matrices(mesh);
+
+  while (state.KeepRunning()) {
+    apply_matrices(make_not_null(&result), matrices, vars, mesh.extents());
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(bench_apply_matrices)->DenseRange(3, 12);  // NOLINT
+
+// Applies the matrices to the variables of 8 elements with the same mesh at
+// once, e.g. filtering all elements of a node.
+// clang-tidy: don't pass be non-const reference
+void bench_apply_matrices_batched(benchmark::State& state) {  // NOLINT
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  constexpr const size_t Dim = 3;
+  constexpr size_t number_of_elements = 8;
+  const Mesh<Dim> mesh{pts_1d, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  const std::vector<Variables<VarTags>> vars(
+      number_of_elements,
+      Variables<VarTags>(mesh.number_of_grid_points(), 1.0));
+  std::vector<Variables<VarTags>> results(
+      number_of_elements, Variables<VarTags>(mesh.number_of_grid_points()));
+  std::vector<const Variables<VarTags>*> vars_ptrs{};
+  std::vector<Variables<VarTags>*> results_ptrs{};
+  for (size_t i = 0; i < number_of_elements; ++i) {
+    vars_ptrs.push_back(&vars[i]);
+    results_ptrs.push_back(&results[i]);
+  }
+  const auto matrices = modal_to_nodal_matrices(mesh);
+
+  while (state.KeepRunning()) {
+    apply_matrices(results_ptrs, matrices, vars_ptrs, mesh.extents());
+    benchmark::DoNotOptimize(results[0].data());
+  }
+}
+BENCHMARK(bench_apply_matrices_batched)->DenseRange(3, 12);  // NOLINT
+
+// Applies the differentiation matrix in the first dimension to the GH
+// variables, the kernel of `apply_matrices` and the logical derivatives.
+// Compares the kernels compiled for fixed extents to the general BLAS path.
+// clang-tidy: don't pass be non-const reference
+template <bool UseFixedSizeKernels>
+void bench_apply_matrix_in_first_dimension(benchmark::State& state) {  // NOLINT
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  constexpr const size_t Dim = 3;
+  const Mesh<Dim> mesh{pts_1d, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  const Variables<VarTags> vars(mesh.number_of_grid_points(), 1.0);
+  Variables<VarTags> result(mesh.number_of_grid_points());
+  const Matrix& matrix =
+      Spectral::differentiation_matrix(mesh.slice_through(0));
+  const size_t number_of_columns = vars.size() / matrix.columns();
+
+  while (state.KeepRunning()) {
+    apply_matrix_in_first_dimension<UseFixedSizeKernels>(
+        make_not_null(result.data()), matrix, vars.data(), number_of_columns);
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK_TEMPLATE(bench_apply_matrix_in_first_dimension, true)
+    ->DenseRange(3, 12);  // NOLINT
+BENCHMARK_TEMPLATE(bench_apply_matrix_in_first_dimension, false)
+    ->DenseRange(3, 12);  // NOLINT
+}  // namespace
@@ -0,0 +1,170 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservativeOptions.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Equilibrium3D.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/IdealFluid.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// Benchmarks of the recovery of the GRMHD primitive variables from the
+// conserved variables on `pts_1d^3` points with each of the recovery schemes.
+
+struct Conservatives {
+  explicit Conservatives(
+      const size_t pts_1d,
+      const EquationsOfState::EquationOfState<true, 3>& equation_of_state) {
+    const size_t num_points = pts_1d * pts_1d * pts_1d;
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> density_dist{1.0e-4, 1.0e-3};
+    std::uniform_real_distribution<double> energy_dist{0.01, 0.5};
+    std::uniform_real_distribution<double> velocity_dist{-0.3, 0.3};
+    std::uniform_real_distribution<double> magnetic_field_dist{-1.0e-3,
+                                                               1.0e-3};
+
+    Scalar<DataVector> rest_mass_density{num_points};
+    Scalar<DataVector> specific_internal_energy{num_points};
+    tnsr::I<DataVector, 3> spatial_velocity{num_points};
+    tnsr::I<DataVector, 3> magnetic_field{num_points};
+    for (size_t s = 0; s < num_points; ++s) {
+      get(rest_mass_density)[s] = density_dist(generator);
+      get(specific_internal_energy)[s] = energy_dist(generator);
+      for (size_t i = 0; i < 3; ++i) {
+        spatial_velocity.get(i)[s] = velocity_dist(generator);
+        magnetic_field.get(i)[s] = magnetic_field_dist(generator);
+      }
+    }
+    const Scalar<DataVector> electron_fraction{num_points, 0.1};
+    const Scalar<DataVector> lorentz_factor{
+        DataVector{1.0 / sqrt(1.0 - square(get<0>(spatial_velocity)) -
+                              square(get<1>(spatial_velocity)) -
+                              square(get<2>(spatial_velocity)))}};
+    const auto temperature =
+        equation_of_state.temperature_from_density_and_energy(
+            rest_mass_density, specific_internal_energy, electron_fraction);
+    const auto pressure =
+        equation_of_state.pressure_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction);
+    // Offset the initial guess so the root find has to iterate
+    pressure_guess = Scalar<DataVector>{DataVector{0.9 * get(pressure)}};
+
+    spatial_metric = tnsr::ii<DataVector, 3>{num_points, 0.0};
+    inv_spatial_metric = tnsr::II<DataVector, 3>{num_points, 0.0};
+    for (size_t i = 0; i < 3; ++i) {
+      spatial_metric.get(i, i) = 1.0;
+      inv_spatial_metric.get(i, i) = 1.0;
+    }
+    sqrt_det_spatial_metric = Scalar<DataVector>{num_points, 1.0};
+
+    grmhd::ValenciaDivClean::ConservativeFromPrimitive::apply(
+        make_not_null(&tilde_d), make_not_null(&tilde_ye),
+        make_not_null(&tilde_tau), make_not_null(&tilde_s),
+        make_not_null(&tilde_b), make_not_null(&tilde_phi), rest_mass_density,
+        electron_fraction, specific_internal_energy, pressure,
+        spatial_velocity, lorentz_factor, magnetic_field,
+        sqrt_det_spatial_metric, spatial_metric,
+        Scalar<DataVector>{num_points, 0.0});
+  }
+
+  Scalar<DataVector> tilde_d{};
+  Scalar<DataVector> tilde_ye{};
+  Scalar<DataVector> tilde_tau{};
+  tnsr::i<DataVector, 3> tilde_s{};
+  tnsr::I<DataVector, 3> tilde_b{};
+  Scalar<DataVector> tilde_phi{};
+  tnsr::ii<DataVector, 3> spatial_metric{};
+  tnsr::II<DataVector, 3> inv_spatial_metric{};
+  Scalar<DataVector> sqrt_det_spatial_metric{};
+  Scalar<DataVector> pressure_guess{};
+};
+
+template <typename RecoveryScheme>
+// clang-tidy: don't pass be non-const reference
+void bench_primitive_recovery(benchmark::State& state) {  // NOLINT
+  const size_t pts_1d = static_cast<size_t>(state.range(0));
+  const size_t num_points = pts_1d * pts_1d * pts_1d;
+  const EquationsOfState::Equilibrium3D<EquationsOfState::IdealFluid<true>>
+      equation_of_state{EquationsOfState::IdealFluid<true>{4.0 / 3.0}};
+  const Conservatives cons{pts_1d, equation_of_state};
+  const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions options{
+      0.0, 0.0, 0.5 * sqrt(std::numeric_limits<double>::max())};
+
+  Scalar<DataVector> rest_mass_density{num_points};
+  Scalar<DataVector> electron_fraction{num_points};
+  Scalar<DataVector> specific_internal_energy{num_points};
+  tnsr::I<DataVector, 3> spatial_velocity{num_points};
+  tnsr::I<DataVector, 3> magnetic_field{num_points};
+  Scalar<DataVector> divergence_cleaning_field{num_points};
+  Scalar<DataVector> lorentz_factor{num_points};
+  Scalar<DataVector> pressure{num_points};
+  Scalar<DataVector> temperature{num_points};
+
+  using KastaunEtAl =
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl;
+  const auto kastaun_statistics_before = KastaunEtAl::statistics();
+  while (state.KeepRunning()) {
+    pressure = cons.pressure_guess;
+    grmhd::ValenciaDivClean::PrimitiveFromConservative<
+        tmpl::list<RecoveryScheme>>::
+        apply(make_not_null(&rest_mass_density),
+              make_not_null(&electron_fraction),
+              make_not_null(&specific_internal_energy),
+              make_not_null(&spatial_velocity), make_not_null(&magnetic_field),
+              make_not_null(&divergence_cleaning_field),
+              make_not_null(&lorentz_factor), make_not_null(&pressure),
+              make_not_null(&temperature), cons.tilde_d, cons.tilde_ye,
+              cons.tilde_tau, cons.tilde_s, cons.tilde_b, cons.tilde_phi,
+              cons.spatial_metric, cons.inv_spatial_metric,
+              cons.sqrt_det_spatial_metric, equation_of_state, options);
+    benchmark::DoNotOptimize(get(rest_mass_density).data());
+  }
+  if constexpr (std::is_same_v<RecoveryScheme, KastaunEtAl>) {
+    const auto& statistics = KastaunEtAl::statistics();
+    const auto number_of_recoveries = static_cast<double>(
+        statistics.number_of_recoveries -
+        kastaun_statistics_before.number_of_recoveries);
+    state.counters["EvaluationsPerPoint"] =
+        static_cast<double>(statistics.number_of_evaluations -
+                            kastaun_statistics_before.number_of_evaluations) /
+        number_of_recoveries;
+    state.counters["WarmStartFraction"] =
+        static_cast<double>(statistics.number_of_warm_starts -
+                            kastaun_statistics_before.number_of_warm_starts) /
+        number_of_recoveries;
+  }
+}
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(
+    bench_primitive_recovery,
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl)
+    ->DenseRange(4, 12, 2);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(
+    bench_primitive_recovery,
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin)
+    ->DenseRange(4, 12, 2);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(
+    bench_primitive_recovery,
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl)
+    ->DenseRange(4, 12, 2);
+}  // namespace
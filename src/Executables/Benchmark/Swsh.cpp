@@ -0,0 +1,74 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <complex>
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
+#include "DataStructures/SpinWeighted.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Benchmarks of the spin-weighted spherical harmonic transforms of a spin-2
+// quantity on a Cauchy-characteristic extraction volume with 10 radial points,
+// for `l_max` given by the benchmark argument.
+
+constexpr size_t number_of_radial_points = 10;
+
+// clang-tidy: don't pass be non-const reference
+void bench_swsh_transform(benchmark::State& state) {  // NOLINT
+  const auto l_max = static_cast<size_t>(state.range(0));
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+  SpinWeighted<ComplexDataVector, 2> collocation{
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max) *
+      number_of_radial_points};
+  for (auto& value : collocation.data()) {
+    value = std::complex<double>(dist(generator), dist(generator));
+  }
+  SpinWeighted<ComplexModalVector, 2> coefficients{
+      Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max) *
+      number_of_radial_points};
+
+  while (state.KeepRunning()) {
+    Spectral::Swsh::swsh_transform(l_max, number_of_radial_points,
+                                   make_not_null(&coefficients), collocation);
+    benchmark::DoNotOptimize(coefficients.data().data());
+  }
+}
+BENCHMARK(bench_swsh_transform)->DenseRange(8, 32, 4);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_inverse_swsh_transform(benchmark::State& state) {  // NOLINT
+  const auto l_max = static_cast<size_t>(state.range(0));
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+  SpinWeighted<ComplexDataVector, 2> collocation{
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max) *
+      number_of_radial_points};
+  for (auto& value : collocation.data()) {
+    value = std::complex<double>(dist(generator), dist(generator));
+  }
+  // Transform forward first so that the coefficients are those of a smooth
+  // function with the correct spin weight
+  const auto coefficients = Spectral::Swsh::swsh_transform(
+      l_max, number_of_radial_points, collocation);
+
+  while (state.KeepRunning()) {
+    Spectral::Swsh::inverse_swsh_transform(l_max, number_of_radial_points,
+                                           make_not_null(&collocation),
+                                           coefficients);
+    benchmark::DoNotOptimize(collocation.data().data());
+  }
+}
+BENCHMARK(bench_inverse_swsh_transform)->DenseRange(8, 32, 4);  // NOLINT
+}  // namespace
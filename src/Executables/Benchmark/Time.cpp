@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cstddef>
+#include <cstdint>
+
+#include "Time/BoundaryHistory.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/AdamsLts.hpp"
+#include "Utilities/Rational.hpp"
+
+namespace {
+// Benchmark of calculating the Adams-Bashforth LTS coefficients for a
+// local step across a boundary with a remote element taking steps
+// `step_ratio` times larger.
+
+constexpr size_t order = 4;
+
+// clang-tidy: don't pass be non-const reference
+void bench_lts_coefficients(benchmark::State& state) {  // NOLINT
+  const auto step_ratio = static_cast<int32_t>(state.range(0));
+  const Slab slab(0.0, 1.0);
+  const TimeDelta remote_step = slab.duration() / 4;
+  const TimeDelta local_step = remote_step / step_ratio;
+  const Time step_start = slab.start() + 3 * remote_step;
+
+  TimeSteppers::BoundaryHistory<double, double, double> history{};
+  for (int32_t i = 0; i < static_cast<int32_t>(order); ++i) {
+    history.remote().insert(TimeStepId(true, 0, slab.start() + i * remote_step),
+                            order, 0.0);
+  }
+  for (int32_t i = static_cast<int32_t>(order) - 1; i >= 0; --i) {
+    history.local().insert(TimeStepId(true, 0, step_start - i * local_step),
+                           order, 0.0);
+  }
+
+  const TimeSteppers::adams_lts::AdamsScheme scheme{
+      TimeSteppers::adams_lts::SchemeType::Explicit, order};
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(TimeSteppers::adams_lts::lts_coefficients(
+        history.local(), history.remote(), step_start, step_start + local_step,
+        scheme, scheme, scheme));
+  }
+}
+BENCHMARK(bench_lts_coefficients)->RangeMultiplier(2)->Range(1, 32);  // NOLINT
+
+// Benchmark of the time bookkeeping for a sequence of steps, which is done for
+// every element and neighbor, with the slab divided into `divisions` steps.
+// Powers of two are the common case since step choosers halve and double the
+// step size.
+//
+// clang-tidy: don't pass be non-const reference
+void bench_time_arithmetic(benchmark::State& state) {  // NOLINT
+  const auto divisions = static_cast<int32_t>(state.range(0));
+  const Slab slab(0.0, 1.0);
+  const TimeDelta step = slab.duration() / divisions;
+  while (state.KeepRunning()) {
+    Time time = slab.start();
+    for (int32_t i = 0; i < divisions; ++i) {
+      const TimeStepId id(true, 0, time);
+      benchmark::DoNotOptimize(id);
+      benchmark::DoNotOptimize(time + step / 2);
+      time += step;
+    }
+    benchmark::DoNotOptimize(time);
+  }
+}
+BENCHMARK(bench_time_arithmetic)->Arg(16)->Arg(15)->Arg(64)->Arg(63);  // NOLINT
+}  // namespace
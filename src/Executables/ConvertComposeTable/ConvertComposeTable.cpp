@@ -3,6 +3,7 @@
 
 #include <boost/program_options.hpp>
 
+#include <optional>
 #include <string>
 
 #include "DataStructures/DataVector.hpp"
@@ -10,6 +11,7 @@
 #include "IO/H5/EosTable.hpp"
 #include "IO/H5/File.hpp"
 #include "Parallel/Printf/Printf.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
 
 // Charm looks for this function but since we build without a main function or
 // main module we just have it be empty
@@ -42,6 +44,14 @@ void convert_file(const std::string& compose_directory,
     spectre_eos.write_quantity(quantity_name, quantity_data);
   }
 }
+
+void write_mapped_table(const std::string& spectre_eos_filename,
+                        const std::string& spectre_eos_subfile,
+                        const std::string& mapped_table_filename) {
+  const EquationsOfState::Tabulated3D<true> eos{
+      spectre_eos_filename, std::optional{spectre_eos_subfile}};
+  eos.write_mapped_table(mapped_table_filename);
+}
 }  // namespace
 
 int main(int argc, char** argv) {
@@ -140,6 +150,10 @@ int main(int argc, char** argv) {
         ("output,o", bpo::value<std::string>(),
          "Path of the output HDF5 file to which the EOS subfile will be "
          "written, including the .h5 extension.")
+        ("mapped-table", bpo::value<std::string>(),
+         "Optional path of a file to which the converted table is also "
+         "written in the binary format that Tabulated3D memory-maps when its "
+         "TableSubFilename is 'None'.")
         ;
     // clang-format on
 
@@ -161,6 +175,12 @@ int main(int argc, char** argv) {
         parsed_command_line_options.at("compose-directory").as<std::string>(),
         parsed_command_line_options.at("output").as<std::string>(),
         parsed_command_line_options.at("eos-subfile").as<std::string>());
+    if (parsed_command_line_options.count("mapped-table") != 0) {
+      write_mapped_table(
+          parsed_command_line_options.at("output").as<std::string>(),
+          parsed_command_line_options.at("eos-subfile").as<std::string>(),
+          parsed_command_line_options.at("mapped-table").as<std::string>());
+    }
   } catch (const bpo::error& e) {
     ERROR(e.what());
   }
@@ -9,7 +9,9 @@
 #endif  // _OPENMP
 
 #include "DataStructures/Tensor/EagerMath/CartesianToSpherical.hpp"
+#include "Domain/Block.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/BlockSearchTree.hpp"
 #include "Domain/Creators/RegisterDerivedWithCharm.hpp"
 #include "Domain/Creators/TimeDependence/RegisterDerivedWithCharm.hpp"
 #include "Domain/Domain.hpp"
@@ -21,6 +23,7 @@
 #include "IO/H5/VolumeData.hpp"
 #include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 #include "NumericalAlgorithms/Interpolation/PolynomialInterpolation.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/FileSystem.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/GetOutput.hpp"
@@ -35,38 +38,46 @@
 namespace spectre::Exporter {
 
 namespace {
+// The data of a volume file that is kept between batches of target points
 template <size_t Dim>
-void interpolate_to_points(
-    const gsl::not_null<std::vector<std::vector<double>>*> result,
-    const gsl::not_null<std::vector<bool>*> filled_data,
-    const std::string& filename, const std::string& subfile_name,
-    const size_t obs_id, const std::vector<std::string>& tensor_components,
-    const std::vector<BlockLogicalCoords<Dim>>& block_logical_coords,
-    [[maybe_unused]] const size_t num_threads) {
+struct VolumeFileData {
+  std::vector<std::string> grid_names{};
+  std::vector<std::vector<size_t>> all_extents{};
+  std::vector<ElementId<Dim>> element_ids{};
+  std::unordered_map<ElementId<Dim>, Mesh<Dim>> meshes{};
+  // Only read once a target point is in one of the elements of the file
+  std::optional<std::vector<DataVector>> tensor_data{};
+};
+
+template <size_t Dim>
+VolumeFileData<Dim> read_grids(const std::string& filename,
+                               const std::string& subfile_name,
+                               const size_t obs_id) {
   const h5::H5File<h5::AccessType::ReadOnly> h5file(filename);
   const auto& volfile = h5file.get<h5::VolumeData>(subfile_name);
-  const auto grid_names = volfile.get_grid_names(obs_id);
-  const auto all_extents = volfile.get_extents(obs_id);
+  VolumeFileData<Dim> result{};
+  result.grid_names = volfile.get_grid_names(obs_id);
+  result.all_extents = volfile.get_extents(obs_id);
   const auto all_bases = volfile.get_bases(obs_id);
   const auto all_quadratures = volfile.get_quadratures(obs_id);
   // Reconstruct element IDs & meshes in the volume data file.
   // This can be simplified by using ElementId and Mesh in the VolumeData class.
-  std::vector<ElementId<Dim>> element_ids{};
-  std::unordered_map<ElementId<Dim>, Mesh<Dim>> meshes{};
-  element_ids.reserve(grid_names.size());
-  for (const auto& grid_name : grid_names) {
+  result.element_ids.reserve(result.grid_names.size());
+  for (const auto& grid_name : result.grid_names) {
     const ElementId<Dim> element_id(grid_name);
-    element_ids.push_back(element_id);
-    meshes[element_id] = h5::mesh_for_grid<Dim>(
-        grid_name, grid_names, all_extents, all_bases, all_quadratures);
-  }
-  // Map the target points to element-logical coordinates. This selects the
-  // subset of target points that are in the volume data file's elements.
-  const auto element_logical_coords =
-      element_logical_coordinates(element_ids, block_logical_coords);
-  if (element_logical_coords.empty()) {
-    return;
+    result.element_ids.push_back(element_id);
+    result.meshes[element_id] =
+        h5::mesh_for_grid<Dim>(grid_name, result.grid_names,
+                               result.all_extents, all_bases, all_quadratures);
   }
+  return result;
+}
+
+std::vector<DataVector> read_tensor_data(
+    const std::string& filename, const std::string& subfile_name,
+    const size_t obs_id, const std::vector<std::string>& tensor_components) {
+  const h5::H5File<h5::AccessType::ReadOnly> h5file(filename);
+  const auto& volfile = h5file.get<h5::VolumeData>(subfile_name);
   // Load the tensor data for all grids in the file because it's stored
   // contiguously
   std::vector<DataVector> tensor_data{};
@@ -88,7 +99,34 @@ void interpolate_to_points(
       tensor_data.push_back(std::move(double_component_data));
     }
   }
-  h5file.close();
+  return tensor_data;
+}
+
+template <size_t Dim>
+void interpolate_to_points(
+    const gsl::not_null<std::vector<std::vector<double>>*> result,
+    const gsl::not_null<std::vector<bool>*> filled_data,
+    const gsl::not_null<VolumeFileData<Dim>*> volume_file_data,
+    const std::string& filename, const std::string& subfile_name,
+    const size_t obs_id, const std::vector<std::string>& tensor_components,
+    const std::vector<BlockLogicalCoords<Dim>>& block_logical_coords,
+    [[maybe_unused]] const size_t num_threads) {
+  const auto& element_ids = volume_file_data->element_ids;
+  // Map the target points to element-logical coordinates. This selects the
+  // subset of target points that are in the volume data file's elements.
+  const auto element_logical_coords =
+      element_logical_coordinates(element_ids, block_logical_coords);
+  if (element_logical_coords.empty()) {
+    return;
+  }
+  if (not volume_file_data->tensor_data.has_value()) {
+    volume_file_data->tensor_data =
+        read_tensor_data(filename, subfile_name, obs_id, tensor_components);
+  }
+  const auto& tensor_data = volume_file_data->tensor_data.value();
+  const auto& grid_names = volume_file_data->grid_names;
+  const auto& all_extents = volume_file_data->all_extents;
+  const auto& meshes = volume_file_data->meshes;
 #pragma omp parallel num_threads(num_threads)
   {
     DataVector interpolated_data{};
@@ -106,7 +144,7 @@ void interpolate_to_points(
       // separately, we could interpolate all components at once. This would
       // need an offset and stride to be passed to the interpolator, since the
       // tensor components for all elements are stored contiguously.
-      const intrp::Irregular<Dim> interpolant(meshes[element_id],
+      const intrp::Irregular<Dim> interpolant(meshes.at(element_id),
                                               points.element_logical_coords);
       const size_t num_element_target_points =
           points.element_logical_coords.begin()->size();
@@ -322,33 +360,48 @@ struct SelectObservation {
 }  // namespace
 
 template <size_t Dim>
-std::vector<std::vector<double>> interpolate_to_points(
+struct Interpolator<Dim>::Impl {
+  std::vector<std::string> filenames{};
+  std::string subfile_name{};
+  size_t obs_id{};
+  std::vector<std::string> tensor_components{};
+  bool extrapolate_into_excisions = false;
+  size_t num_threads = 1;
+  Domain<Dim> domain{};
+  double time = 0.;
+  domain::FunctionsOfTimeMap functions_of_time{};
+  std::optional<domain::BlockSearchTree<Dim, Frame::Inertial>> search_tree{};
+  // Read when the first batch of points is interpolated
+  std::vector<std::optional<VolumeFileData<Dim>>> volume_files{};
+};
+
+template <size_t Dim>
+Interpolator<Dim>::Interpolator(
     const std::variant<std::vector<std::string>, std::string>&
         volume_files_or_glob,
     const std::string& subfile_name,
     const std::variant<ObservationId, ObservationStep>& observation,
     const std::vector<std::string>& tensor_components,
-    const std::array<std::vector<double>, Dim>& target_points,
     const bool extrapolate_into_excisions,
-    const std::optional<size_t> num_threads) {
+    const std::optional<size_t> num_threads)
+    : impl_(std::make_unique<Impl>()) {
   domain::creators::register_derived_with_charm();
   domain::creators::time_dependence::register_derived_with_charm();
   domain::FunctionsOfTime::register_derived_with_charm();
 
   // Resolve number of threads to use in OpenMP parallelization
 #ifdef _OPENMP
-  const size_t resolved_num_threads =
-      num_threads.value_or(omp_get_max_threads());
+  impl_->num_threads = num_threads.value_or(omp_get_max_threads());
 #else
   if (num_threads.has_value()) {
     ERROR_NO_TRACE(
         "OpenMP is not available, so num_threads cannot be specified.");
   }
-  const size_t resolved_num_threads = 1;
+  impl_->num_threads = 1;
 #endif  // _OPENMP
 
   // Get the list of volume data files
-  const std::vector<std::string> filenames =
+  impl_->filenames =
       std::visit(Overloader{[](const std::vector<std::string>& volume_files) {
                               return volume_files;
                             },
@@ -356,12 +409,17 @@ std::vector<std::vector<double>> interpolate_to_points(
                               return file_system::glob(volume_files_glob);
                             }},
                  volume_files_or_glob);
-  if (filenames.empty()) {
+  if (impl_->filenames.empty()) {
     ERROR_NO_TRACE("No volume files found. Specify at least one volume file.");
   }
+  impl_->subfile_name = subfile_name;
+  impl_->tensor_components = tensor_components;
+  impl_->extrapolate_into_excisions = extrapolate_into_excisions;
+  impl_->volume_files.resize(impl_->filenames.size());
 
   // Retrieve info from the first volume file
-  const h5::H5File<h5::AccessType::ReadOnly> first_h5file(filenames.front());
+  const h5::H5File<h5::AccessType::ReadOnly> first_h5file(
+      impl_->filenames.front());
   const auto& first_volfile = first_h5file.get<h5::VolumeData>(subfile_name);
   const auto dim = first_volfile.get_dimension();
   if (dim != Dim) {
@@ -373,25 +431,45 @@ std::vector<std::vector<double>> interpolate_to_points(
   // so we only look into the first file. For generalizing to volume files
   // across multiple segments, see the Python function
   // `Visualization.ReadH5:select_observation` and possibly move it to C++.
-  const size_t obs_id =
-      std::visit(SelectObservation{first_volfile}, observation);
+  impl_->obs_id = std::visit(SelectObservation{first_volfile}, observation);
   // Get domain, time, functions of time
-  const auto domain =
-      deserialize<Domain<Dim>>(first_volfile.get_domain(obs_id)->data());
-  const auto time_and_fot = [&first_volfile, &obs_id, &domain]() {
-    if (domain.is_time_dependent()) {
-      return std::make_pair(
-          first_volfile.get_observation_value(obs_id),
-          deserialize<domain::FunctionsOfTimeMap>(
-              first_volfile.get_functions_of_time(obs_id)->data()));
-    } else {
-      return std::make_pair(0., domain::FunctionsOfTimeMap{});
-    }
-  }();
-  const double time = time_and_fot.first;
-  const auto& functions_of_time = time_and_fot.second;
+  impl_->domain =
+      deserialize<Domain<Dim>>(first_volfile.get_domain(impl_->obs_id)->data());
+  if (impl_->domain.is_time_dependent()) {
+    impl_->time = first_volfile.get_observation_value(impl_->obs_id);
+    impl_->functions_of_time = deserialize<domain::FunctionsOfTimeMap>(
+        first_volfile.get_functions_of_time(impl_->obs_id)->data());
+  }
   first_h5file.close();
 
+  // The search tree narrows down the blocks that may contain a target point.
+  // It is only valid at the time of the observation, which is fixed for the
+  // lifetime of the interpolator.
+  if (impl_->domain.blocks().size() > 1) {
+    impl_->search_tree.emplace(impl_->domain, impl_->time,
+                               impl_->functions_of_time);
+  }
+}
+
+template <size_t Dim>
+Interpolator<Dim>::Interpolator(Interpolator&&) = default;
+
+template <size_t Dim>
+Interpolator<Dim>& Interpolator<Dim>::operator=(Interpolator&&) = default;
+
+template <size_t Dim>
+Interpolator<Dim>::~Interpolator() = default;
+
+template <size_t Dim>
+std::vector<std::vector<double>> Interpolator<Dim>::interpolate(
+    const std::array<std::vector<double>, Dim>& target_points) {
+  const auto& domain = impl_->domain;
+  const double time = impl_->time;
+  const auto& functions_of_time = impl_->functions_of_time;
+  const auto& tensor_components = impl_->tensor_components;
+  const bool extrapolate_into_excisions = impl_->extrapolate_into_excisions;
+  const size_t resolved_num_threads = impl_->num_threads;
+
   // Check target points have the same number of points in each dimension
   const size_t num_target_points = target_points[0].size();
   for (size_t d = 0; d < Dim; ++d) {
@@ -418,6 +496,7 @@ std::vector<std::vector<double>> interpolate_to_points(
   {
     // Set up thread-local variables
     tnsr::I<double, Dim, Frame::Inertial> target_point{};
+    std::vector<size_t> candidate_block_ids{};
     std::vector<BlockLogicalCoords<Dim>> extra_block_logical_coords{};
     std::vector<ExtrapolationInfo<num_extrapolation_anchors>>
         extra_extrapolation_info{};
@@ -426,15 +505,39 @@ std::vector<std::vector<double>> interpolate_to_points(
       for (size_t d = 0; d < Dim; ++d) {
         target_point.get(d) = gsl::at(target_points, d)[s];
       }
-      for (const auto& block : domain.blocks()) {
+      const auto is_in_block = [&block_logical_coords, &s, &target_point,
+                                &time,
+                                &functions_of_time](const Block<Dim>& block) {
         auto x_logical = block_logical_coordinates_single_point(
             target_point, block, time, functions_of_time);
         if (x_logical.has_value()) {
           block_logical_coords[s] = {domain::BlockId(block.id()),
                                      std::move(x_logical.value())};
-          break;
+          return true;
         }
-      }  // for blocks
+        return false;
+      };
+      // Try the candidate blocks from the search tree first. Its bounding
+      // boxes are not guaranteed to enclose the blocks, so check the other
+      // blocks as well before concluding that the point is outside the domain.
+      if (impl_->search_tree.has_value()) {
+        impl_->search_tree->candidate_blocks(
+            make_not_null(&candidate_block_ids), target_point);
+      }
+      const bool found_in_candidate =
+          alg::any_of(candidate_block_ids, [&domain, &is_in_block](
+                                               const size_t block_id) {
+            return is_in_block(domain.blocks()[block_id]);
+          });
+      if (not found_in_candidate) {
+        for (const auto& block : domain.blocks()) {
+          if (not std::binary_search(candidate_block_ids.begin(),
+                                     candidate_block_ids.end(), block.id()) and
+              is_in_block(block)) {
+            break;
+          }
+        }  // for blocks
+      }
       if (block_logical_coords[s].has_value() or
           not extrapolate_into_excisions) {
         continue;
@@ -482,10 +585,19 @@ std::vector<std::vector<double>> interpolate_to_points(
   // Process all volume files in serial, because loading data with H5 must be
   // done in serial anyway. Instead, the loop over elements within each file is
   // parallelized with OpenMP.
-  for (const auto& filename : filenames) {
+  for (size_t file_index = 0; file_index < impl_->filenames.size();
+       ++file_index) {
+    const auto& filename = impl_->filenames[file_index];
+    auto& volume_file_data = impl_->volume_files[file_index];
+    if (not volume_file_data.has_value()) {
+      volume_file_data =
+          read_grids<Dim>(filename, impl_->subfile_name, impl_->obs_id);
+    }
     interpolate_to_points(make_not_null(&result), make_not_null(&filled_data),
-                          filename, subfile_name, obs_id, tensor_components,
-                          block_logical_coords, resolved_num_threads);
+                          make_not_null(&volume_file_data.value()), filename,
+                          impl_->subfile_name, impl_->obs_id,
+                          tensor_components, block_logical_coords,
+                          resolved_num_threads);
     // Terminate early if all data has been filled
     if (std::all_of(filled_data.begin(), filled_data.end(),
                     [](const bool filled) { return filled; })) {
@@ -518,11 +630,28 @@ std::vector<std::vector<double>> interpolate_to_points(
   return result;
 }
 
+template <size_t Dim>
+std::vector<std::vector<double>> interpolate_to_points(
+    const std::variant<std::vector<std::string>, std::string>&
+        volume_files_or_glob,
+    const std::string& subfile_name,
+    const std::variant<ObservationId, ObservationStep>& observation,
+    const std::vector<std::string>& tensor_components,
+    const std::array<std::vector<double>, Dim>& target_points,
+    const bool extrapolate_into_excisions,
+    const std::optional<size_t> num_threads) {
+  return Interpolator<Dim>{volume_files_or_glob, subfile_name, observation,
+                           tensor_components,    extrapolate_into_excisions,
+                           num_threads}
+      .interpolate(target_points);
+}
+
 // Generate instantiations
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(_, data)                                                  \
+  template class Interpolator<DIM(data)>;                                     \
   template std::vector<std::vector<double>> interpolate_to_points<DIM(data)>( \
       const std::variant<std::vector<std::string>, std::string>&              \
           volume_files_or_glob,                                               \
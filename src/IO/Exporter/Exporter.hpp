@@ -10,6 +10,7 @@
 
 #include <array>
 #include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
 #include <variant>
@@ -76,4 +77,53 @@ std::vector<std::vector<double>> interpolate_to_points(
     bool extrapolate_into_excisions = false,
     std::optional<size_t> num_threads = std::nullopt);
 
+/*!
+ * \brief Interpolate data in volume files to repeated batches of target points
+ *
+ * \details This does the same as `interpolate_to_points`, but keeps the state
+ * that doesn't depend on the target points between calls to `interpolate()`.
+ * Use it to import data onto many batches of points, e.g. one batch per patch
+ * of a moving-puncture AMR grid:
+ *
+ * - The domain and functions of time are read once on construction, and a
+ *   search tree over the blocks is built once to find the blocks that contain
+ *   the target points.
+ * - The element IDs and meshes of a volume file are read the first time a
+ *   batch is interpolated, and the selected tensor components of a volume
+ *   file are read the first time a target point falls into one of its
+ *   elements. Both are kept for subsequent batches, so the memory usage grows
+ *   up to the size of the selected tensor components in all volume files.
+ *
+ * The parameters are the same as for `interpolate_to_points`. The batches of
+ * target points are passed to `interpolate()`, which returns the interpolated
+ * data in the same format as `interpolate_to_points`. Batches must be
+ * interpolated one at a time; each batch is parallelized with OpenMP.
+ */
+template <size_t Dim>
+class Interpolator {
+ public:
+  Interpolator(const std::variant<std::vector<std::string>, std::string>&
+                   volume_files_or_glob,
+               const std::string& subfile_name,
+               const std::variant<ObservationId, ObservationStep>& observation,
+               const std::vector<std::string>& tensor_components,
+               bool extrapolate_into_excisions = false,
+               std::optional<size_t> num_threads = std::nullopt);
+
+  Interpolator(const Interpolator&) = delete;
+  Interpolator& operator=(const Interpolator&) = delete;
+  Interpolator(Interpolator&& rhs);
+  Interpolator& operator=(Interpolator&& rhs);
+  ~Interpolator();
+
+  /// Interpolate the tensor components to the `target_points`, given in
+  /// inertial coordinates
+  std::vector<std::vector<double>> interpolate(
+      const std::array<std::vector<double>, Dim>& target_points);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace spectre::Exporter
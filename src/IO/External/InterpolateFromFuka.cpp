@@ -3,11 +3,13 @@
 
 #include "IO/External/InterpolateFromFuka.hpp"
 
+#include <algorithm>
 #include <array>
+#include <condition_variable>
 #include <cstddef>
+#include <iterator>
 #include <mutex>
 #include <string>
-#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
@@ -47,95 +49,191 @@ std::array<std::vector<double>, 22> KadathExportBHNS(
 
 namespace io {
 
+namespace {
+template <FukaIdType IdType>
+using FukaResult = tuples::tagged_tuple_from_typelist<fuka_tags<IdType>>;
+
+// The points of an element waiting for FUKA and the buffer for its data
+template <FukaIdType IdType>
+struct FukaRequest {
+  const tnsr::I<DataVector, 3, Frame::Inertial>* x;
+  const std::string* info_filename;
+  double interpolation_offset;
+  int interp_order;
+  double delta_r_rel;
+  FukaResult<IdType>* result;
+  bool done{false};
+
+  bool same_export(const FukaRequest& rhs) const {
+    return *info_filename == *rhs.info_filename and
+           interpolation_offset == rhs.interpolation_offset and
+           interp_order == rhs.interp_order and delta_r_rel == rhs.delta_r_rel;
+  }
+};
+
+// The requests of all threads of this process that wait for FUKA
+template <FukaIdType IdType>
+struct FukaQueue {
+  std::mutex mutex{};
+  std::condition_variable exported{};
+  std::vector<FukaRequest<IdType>*> requests{};
+  bool is_exporting{false};
+
+  static FukaQueue& local() {
+    static FukaQueue queue{};
+    return queue;
+  }
+};
+
+template <FukaIdType IdType>
+auto export_from_fuka(const std::array<std::vector<double>, 3>& x,
+                      const std::string& info_filename,
+                      [[maybe_unused]] const double interpolation_offset,
+                      [[maybe_unused]] const int interp_order,
+                      [[maybe_unused]] const double delta_r_rel) {
+  // FUKA throws FPEs for some reason. Just disabling them seems to work, but
+  // it is unclear what's causing this and if it can be a problem.
+  const ScopedFpeState disable_fpes(false);
+  const auto num_points = static_cast<int>(x[0].size());
+  if constexpr (IdType == FukaIdType::Bh) {
+    return KadathExportBH(num_points, x[0].data(), x[1].data(), x[2].data(),
+                          info_filename.c_str(), interpolation_offset,
+                          interp_order, delta_r_rel);
+  } else if constexpr (IdType == FukaIdType::Bbh) {
+    return KadathExportBBH(num_points, x[0].data(), x[1].data(), x[2].data(),
+                           info_filename.c_str(), interpolation_offset,
+                           interp_order, delta_r_rel);
+  } else if constexpr (IdType == FukaIdType::Ns) {
+    return KadathExportNS(num_points, x[0].data(), x[1].data(), x[2].data(),
+                          info_filename.c_str());
+  } else if constexpr (IdType == FukaIdType::Bns) {
+    return KadathExportBNS(num_points, x[0].data(), x[1].data(), x[2].data(),
+                           info_filename.c_str());
+  } else if constexpr (IdType == FukaIdType::Bhns) {
+    return KadathExportBHNS(num_points, x[0].data(), x[1].data(), x[2].data(),
+                            info_filename.c_str(), interpolation_offset,
+                            interp_order, delta_r_rel);
+  } else {
+    ERROR("Unrecognized enum value for 'FukaIdType'");
+  }
+}
+
+// Copies the `num_points` points starting at `offset` out of the FUKA data.
+// The FUKA functions return tensor components in this order.
+// See: https://bitbucket.org/fukaws/kadathimporter/src/master/src/importer.h
+template <FukaIdType IdType, typename FukaData>
+void copy_from_fuka_data(const gsl::not_null<FukaResult<IdType>*> result,
+                         const FukaData& fuka_data, const size_t offset,
+                         const size_t num_points) {
+  size_t var_index = 0;
+  const auto copy_component = [&fuka_data, &offset, &num_points,
+                               &var_index](const gsl::not_null<DataVector*>
+                                               component) {
+    component->destructive_resize(num_points);
+    std::copy_n(fuka_data[var_index].begin() +
+                    static_cast<std::ptrdiff_t>(offset),
+                num_points, component->begin());
+    ++var_index;
+  };
+  copy_component(
+      make_not_null(&get(get<gr::Tags::Lapse<DataVector>>(*result))));
+  for (auto& component : get<gr::Tags::Shift<DataVector, 3>>(*result)) {
+    copy_component(make_not_null(&component));
+  }
+  for (auto& component :
+       get<gr::Tags::SpatialMetric<DataVector, 3>>(*result)) {
+    copy_component(make_not_null(&component));
+  }
+  for (auto& component :
+       get<gr::Tags::ExtrinsicCurvature<DataVector, 3>>(*result)) {
+    copy_component(make_not_null(&component));
+  }
+  if constexpr (IdType == FukaIdType::Ns or IdType == FukaIdType::Bns or
+                IdType == FukaIdType::Bhns) {
+    copy_component(make_not_null(
+        &get(get<hydro::Tags::RestMassDensity<DataVector>>(*result))));
+    copy_component(make_not_null(
+        &get(get<hydro::Tags::SpecificInternalEnergy<DataVector>>(*result))));
+    copy_component(
+        make_not_null(&get(get<hydro::Tags::Pressure<DataVector>>(*result))));
+    for (auto& component :
+         get<hydro::Tags::SpatialVelocity<DataVector, 3>>(*result)) {
+      copy_component(make_not_null(&component));
+    }
+  }
+}
+
+// Exports the points of all `requests` in a single call to FUKA, so the
+// solution is loaded from disk only once for all of them
+template <FukaIdType IdType>
+void export_batch(const gsl::not_null<std::mutex*> fuka_lock,
+                  const std::vector<FukaRequest<IdType>*>& requests) {
+  std::array<std::vector<double>, 3> x{};
+  for (size_t d = 0; d < 3; ++d) {
+    for (const auto* const request : requests) {
+      const DataVector& x_d = request->x->get(d);
+      gsl::at(x, d).insert(gsl::at(x, d).end(), x_d.begin(), x_d.end());
+    }
+  }
+  const auto& first = *requests.front();
+  const auto fuka_data = [&fuka_lock, &x, &first]() {
+    // The FUKA functions are not thread-safe, so we need to lock here.
+    const std::lock_guard lock{*fuka_lock};
+    return export_from_fuka<IdType>(x, *first.info_filename,
+                                    first.interpolation_offset,
+                                    first.interp_order, first.delta_r_rel);
+  }();
+  size_t offset = 0;
+  for (auto* const request : requests) {
+    const size_t num_points = request->x->begin()->size();
+    copy_from_fuka_data<IdType>(make_not_null(request->result), fuka_data,
+                                offset, num_points);
+    offset += num_points;
+  }
+}
+}  // namespace
+
 template <FukaIdType IdType>
 tuples::tagged_tuple_from_typelist<fuka_tags<IdType>> interpolate_from_fuka(
     const gsl::not_null<std::mutex*> fuka_lock,
     const std::string& info_filename,
     const tnsr::I<DataVector, 3, Frame::Inertial>& x,
-    [[maybe_unused]] const double interpolation_offset,
-    [[maybe_unused]] const int interp_order,
-    [[maybe_unused]] const double delta_r_rel) {
+    const double interpolation_offset, const int interp_order,
+    const double delta_r_rel) {
   tuples::tagged_tuple_from_typelist<fuka_tags<IdType>> result{};
-  // The FUKA functions are not thread-safe, so we need to lock here.
-  fuka_lock->lock();
-  const auto fuka_data = [&x, &info_filename, &interpolation_offset,
-                          &interp_order, &delta_r_rel]() {
-    // FUKA throws FPEs for some reason. Just disabling them seems to work, but
-    // it is unclear what's causing this and if it can be a problem.
-    const ScopedFpeState disable_fpes(false);
-    if constexpr (IdType == FukaIdType::Bh) {
-      return KadathExportBH(static_cast<int>(x.begin()->size()),
-                            get<0>(x).data(), get<1>(x).data(),
-                            get<2>(x).data(), info_filename.c_str(),
-                            interpolation_offset, interp_order, delta_r_rel);
-    } else if constexpr (IdType == FukaIdType::Bbh) {
-      return KadathExportBBH(static_cast<int>(x.begin()->size()),
-                             get<0>(x).data(), get<1>(x).data(),
-                             get<2>(x).data(), info_filename.c_str(),
-                             interpolation_offset, interp_order, delta_r_rel);
-    } else if constexpr (IdType == FukaIdType::Ns) {
-      (void)interpolation_offset;
-      (void)interp_order;
-      (void)delta_r_rel;
-      return KadathExportNS(static_cast<int>(x.begin()->size()),
-                            get<0>(x).data(), get<1>(x).data(),
-                            get<2>(x).data(), info_filename.c_str());
-    } else if constexpr (IdType == FukaIdType::Bns) {
-      (void)interpolation_offset;
-      (void)interp_order;
-      (void)delta_r_rel;
-      return KadathExportBNS(static_cast<int>(x.begin()->size()),
-                             get<0>(x).data(), get<1>(x).data(),
-                             get<2>(x).data(), info_filename.c_str());
-    } else if constexpr (IdType == FukaIdType::Bhns) {
-      return KadathExportBHNS(static_cast<int>(x.begin()->size()),
-                              get<0>(x).data(), get<1>(x).data(),
-                              get<2>(x).data(), info_filename.c_str(),
-                              interpolation_offset, interp_order, delta_r_rel);
-    } else {
-      ERROR("Unrecognized enum value for 'FukaIdType'");
+  // Every call to FUKA loads the solution from disk and the calls are
+  // serialized, so the elements of this process that wait for FUKA at the
+  // same time are exported in a single call. The first waiting thread that
+  // finds FUKA idle exports the points of all waiting requests with the same
+  // parameters, including its own, and wakes up their threads.
+  auto& queue = FukaQueue<IdType>::local();
+  FukaRequest<IdType> request{
+      &x, &info_filename, interpolation_offset, interp_order, delta_r_rel,
+      &result};
+  std::unique_lock queue_lock{queue.mutex};
+  queue.requests.push_back(&request);
+  while (not request.done) {
+    if (queue.is_exporting) {
+      queue.exported.wait(queue_lock);
+      continue;
     }
-  }();
-  // Unlock before copying data to avoid holding the lock for too long.
-  fuka_lock->unlock();
-  // The FUKA functions return tensor components in this order.
-  // See: https://bitbucket.org/fukaws/kadathimporter/src/master/src/importer.h
-  auto& lapse = get<gr::Tags::Lapse<DataVector>>(result);
-  get(lapse) = DataVector(fuka_data[0]);
-  auto& shift = get<gr::Tags::Shift<DataVector, 3>>(result);
-  get<0>(shift) = DataVector(fuka_data[1]);
-  get<1>(shift) = DataVector(fuka_data[2]);
-  get<2>(shift) = DataVector(fuka_data[3]);
-  auto& spatial_metric = get<gr::Tags::SpatialMetric<DataVector, 3>>(result);
-  get<0, 0>(spatial_metric) = DataVector(fuka_data[4]);
-  get<0, 1>(spatial_metric) = DataVector(fuka_data[5]);
-  get<0, 2>(spatial_metric) = DataVector(fuka_data[6]);
-  get<1, 1>(spatial_metric) = DataVector(fuka_data[7]);
-  get<1, 2>(spatial_metric) = DataVector(fuka_data[8]);
-  get<2, 2>(spatial_metric) = DataVector(fuka_data[9]);
-  auto& extrinsic_curvature =
-      get<gr::Tags::ExtrinsicCurvature<DataVector, 3>>(result);
-  get<0, 0>(extrinsic_curvature) = DataVector(fuka_data[10]);
-  get<0, 1>(extrinsic_curvature) = DataVector(fuka_data[11]);
-  get<0, 2>(extrinsic_curvature) = DataVector(fuka_data[12]);
-  get<1, 1>(extrinsic_curvature) = DataVector(fuka_data[13]);
-  get<1, 2>(extrinsic_curvature) = DataVector(fuka_data[14]);
-  get<2, 2>(extrinsic_curvature) = DataVector(fuka_data[15]);
-  if constexpr (IdType == FukaIdType::Ns or IdType == FukaIdType::Bns or
-                IdType == FukaIdType::Bhns) {
-    auto& rest_mass_density =
-        get<hydro::Tags::RestMassDensity<DataVector>>(result);
-    get(rest_mass_density) = DataVector(fuka_data[16]);
-    auto& specific_internal_energy =
-        get<hydro::Tags::SpecificInternalEnergy<DataVector>>(result);
-    get(specific_internal_energy) = DataVector(fuka_data[17]);
-    auto& pressure = get<hydro::Tags::Pressure<DataVector>>(result);
-    get(pressure) = DataVector(fuka_data[18]);
-    auto& spatial_velocity =
-        get<hydro::Tags::SpatialVelocity<DataVector, 3>>(result);
-    get<0>(spatial_velocity) = DataVector(fuka_data[19]);
-    get<1>(spatial_velocity) = DataVector(fuka_data[20]);
-    get<2>(spatial_velocity) = DataVector(fuka_data[21]);
+    queue.is_exporting = true;
+    const auto batch_end = std::stable_partition(
+        queue.requests.begin(), queue.requests.end(),
+        [&request](const FukaRequest<IdType>* const waiting) {
+          return not waiting->same_export(request);
+        });
+    const std::vector<FukaRequest<IdType>*> batch(batch_end,
+                                                  queue.requests.end());
+    queue.requests.erase(batch_end, queue.requests.end());
+    queue_lock.unlock();
+    export_batch<IdType>(fuka_lock, batch);
+    queue_lock.lock();
+    for (auto* const exported_request : batch) {
+      exported_request->done = true;
+    }
+    queue.is_exporting = false;
+    queue.exported.notify_all();
   }
   return result;
 }
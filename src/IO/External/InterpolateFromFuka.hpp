@@ -45,6 +45,11 @@ using fuka_tags = typename detail::FukaTags<IdType>::type;
 /*!
  * \brief Interpolate numerical FUKA initial data to arbitrary points
  *
+ * Each call to FUKA loads the solution from disk, and calls can't run
+ * concurrently. Therefore, concurrent calls on a process with the same
+ * `info_filename` and parameters are combined: the points of all threads that
+ * wait for FUKA are exported together in a single call.
+ *
  * \tparam IdType Type of FUKA initial data
  * \param fuka_lock Lock for accessing FUKA data. This is needed because
  * FUKA is not thread-safe. Pass in a lock that is shared with other
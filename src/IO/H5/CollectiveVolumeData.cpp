@@ -0,0 +1,454 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/CollectiveVolumeData.hpp"
+
+#ifdef SPECTRE_PARALLEL_HDF5
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <hdf5.h>
+#include <iterator>
+#include <limits>
+#include <mpi.h>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
+#include "IO/H5/ExtendConnectivityHelpers.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/Helpers.hpp"
+#include "IO/H5/OpenGroup.hpp"
+#include "IO/H5/SpectralIo.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/Type.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/H5/Wrappers.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace h5 {
+namespace {
+// Datasets at least this large start at a multiple of this many bytes in the
+// file, which is a typical stripe size of parallel file systems.
+constexpr hsize_t dataset_alignment = 1_st << 20;
+
+void check_mpi(const int status, const std::string& operation) {
+  if (status != MPI_SUCCESS) {
+    ERROR("Failed MPI operation: " << operation);
+  }
+}
+
+template <typename T>
+MPI_Datatype mpi_type() {
+  if constexpr (std::is_same_v<T, char>) {
+    return MPI_CHAR;
+  } else if constexpr (std::is_same_v<T, int>) {
+    return MPI_INT;
+  } else if constexpr (std::is_same_v<T, unsigned long>) {
+    return MPI_UNSIGNED_LONG;
+  } else {
+    static_assert(std::is_same_v<T, unsigned long long>,
+                  "Unsupported type for MPI communication.");
+    return MPI_UNSIGNED_LONG_LONG;
+  }
+}
+
+template <typename T>
+void broadcast(const gsl::not_null<std::vector<T>*> data, const int root,
+               const MPI_Comm communicator) {
+  unsigned long long size = data->size();
+  check_mpi(MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG_LONG, root, communicator),
+            "MPI_Bcast");
+  data->resize(size);
+  check_mpi(MPI_Bcast(data->data(), static_cast<int>(size), mpi_type<T>(),
+                      root, communicator),
+            "MPI_Bcast");
+}
+
+// Concatenate `local_data` of all ranks in rank order on rank 0
+template <typename T>
+std::vector<T> gather_on_rank_zero(const std::vector<T>& local_data,
+                                   const MPI_Comm communicator, const int rank,
+                                   const int number_of_ranks) {
+  const int local_size = static_cast<int>(local_data.size());
+  std::vector<int> sizes(rank == 0 ? static_cast<size_t>(number_of_ranks) : 0);
+  check_mpi(MPI_Gather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0,
+                       communicator),
+            "MPI_Gather");
+  std::vector<int> displacements(sizes.size());
+  int total_size = 0;
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    displacements[i] = total_size;
+    total_size += sizes[i];
+  }
+  std::vector<T> result(static_cast<size_t>(total_size));
+  check_mpi(MPI_Gatherv(local_data.data(), local_size, mpi_type<T>(),
+                        result.data(), sizes.data(), displacements.data(),
+                        mpi_type<T>(), 0, communicator),
+            "MPI_Gatherv");
+  return result;
+}
+
+// The offset of the entries of this rank in a dataset that holds the entries
+// of all ranks in rank order, and the size of that dataset
+std::pair<hsize_t, hsize_t> offset_and_total_size(const size_t local_size,
+                                                  const MPI_Comm communicator,
+                                                  const int rank) {
+  const unsigned long long local = local_size;
+  unsigned long long offset = 0;
+  unsigned long long total = 0;
+  check_mpi(MPI_Exscan(&local, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                       communicator),
+            "MPI_Exscan");
+  // The result of MPI_Exscan is undefined on rank 0
+  if (rank == 0) {
+    offset = 0;
+  }
+  check_mpi(MPI_Allreduce(&local, &total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                          communicator),
+            "MPI_Allreduce");
+  return {static_cast<hsize_t>(offset), static_cast<hsize_t>(total)};
+}
+
+// Create a dataset whose space is allocated but not written so that the slabs
+// can be written collectively later
+template <typename T>
+void create_dataset_for_collective_write(const hid_t group_id,
+                                         const std::string& name,
+                                         const hsize_t size) {
+  if (contains_dataset_or_group(group_id, "", name)) {
+    ERROR("Trying to write dataset '" << name
+                                      << "' which already exists in HDF5 "
+                                         "file.");
+  }
+  const hid_t properties = H5Pcreate(H5P_DATASET_CREATE);
+  CHECK_H5(properties, "Failed to create dataset creation property list.");
+  CHECK_H5(H5Pset_layout(properties, H5D_CONTIGUOUS),
+           "Failed to set contiguous layout.");
+  CHECK_H5(H5Pset_alloc_time(properties, H5D_ALLOC_TIME_EARLY),
+           "Failed to set allocation time.");
+  CHECK_H5(H5Pset_fill_time(properties, H5D_FILL_TIME_NEVER),
+           "Failed to set fill time.");
+  const hid_t space_id = H5Screate_simple(1, &size, nullptr);
+  CHECK_H5(space_id, "Failed to create dataspace");
+  const hid_t dataset_id =
+      H5Dcreate2(group_id, name.c_str(), h5_type<T>(), space_id,
+                 h5p_default(), properties, h5p_default());
+  CHECK_H5(dataset_id, "Failed to create dataset '" << name << "'");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  CHECK_H5(H5Pclose(properties), "Failed to close property list");
+}
+
+// Write `local_data` to the entries `[offset, offset + local_data.size())` of
+// the dataset `name`. All ranks must call this, even those without data.
+template <typename T>
+void write_slab(const hid_t group_id, const std::string& name,
+                const std::vector<T>& local_data, const hsize_t offset,
+                const hid_t transfer_properties) {
+  const hid_t dataset_id = H5Dopen2(group_id, name.c_str(), h5p_default());
+  CHECK_H5(dataset_id, "Failed to open dataset '" << name << "'");
+  const hid_t file_space_id = H5Dget_space(dataset_id);
+  CHECK_H5(file_space_id, "Failed to open dataspace");
+  const auto size = static_cast<hsize_t>(local_data.size());
+  const hid_t memory_space_id = H5Screate_simple(1, &size, nullptr);
+  CHECK_H5(memory_space_id, "Failed to create dataspace");
+  if (size == 0) {
+    CHECK_H5(H5Sselect_none(file_space_id), "Failed to select no entries");
+    CHECK_H5(H5Sselect_none(memory_space_id), "Failed to select no entries");
+  } else {
+    CHECK_H5(H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, &offset,
+                                 nullptr, &size, nullptr),
+             "Failed to select hyperslab of dataset '" << name << "'");
+  }
+  CHECK_H5(H5Dwrite(dataset_id, h5_type<T>(), memory_space_id, file_space_id,
+                    transfer_properties, local_data.data()),
+           "Failed to write to dataset '" << name << "'");
+  CHECK_H5(H5Sclose(memory_space_id), "Failed to close dataspace");
+  CHECK_H5(H5Sclose(file_space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+}
+
+template <typename T>
+std::vector<T> contiguous_component_data(
+    const std::vector<ElementVolumeData>& elements,
+    const size_t component_index, const std::string& component_name,
+    const size_t number_of_points) {
+  using type_from_variant =
+      tmpl::conditional_t<std::is_same_v<T, double>, DataVector,
+                          std::vector<float>>;
+  std::vector<T> result{};
+  result.reserve(number_of_points);
+  for (const auto& element : elements) {
+    const auto& tensor_component = element.tensor_components[component_index];
+    ASSERT(tensor_component.name == component_name,
+           "Tensor components must be in the same order for all elements and "
+           "ranks. Expected '"
+               << component_name << "' but found '" << tensor_component.name
+               << "' at index " << component_index << ".");
+    const auto& data = std::get<type_from_variant>(tensor_component.data);
+    result.insert(result.end(), data.begin(), data.end());
+  }
+  return result;
+}
+}  // namespace
+
+void write_volume_data_collectively(
+    const MPI_Comm communicator, const std::string& file_name,
+    const std::string& input_source, const std::string& subfile_path,
+    const uint32_t version, const size_t observation_id,
+    const double observation_value,
+    const std::vector<ElementVolumeData>& elements,
+    const std::optional<std::vector<char>>& serialized_domain,
+    const std::optional<std::vector<char>>& serialized_functions_of_time) {
+  int rank = 0;
+  int number_of_ranks = 0;
+  check_mpi(MPI_Comm_rank(communicator, &rank), "MPI_Comm_rank");
+  check_mpi(MPI_Comm_size(communicator, &number_of_ranks), "MPI_Comm_size");
+  // The elements on the lowest rank that has any determine the tensor
+  // components, their types, and the dimension. The names are separated by
+  // null characters.
+  const int rank_with_elements_if_any =
+      elements.empty() ? number_of_ranks : rank;
+  int root = number_of_ranks;
+  check_mpi(MPI_Allreduce(&rank_with_elements_if_any, &root, 1, MPI_INT,
+                          MPI_MIN, communicator),
+            "MPI_Allreduce");
+  if (root == number_of_ranks) {
+    // No rank has any elements, so there is nothing to write
+    return;
+  }
+  std::vector<char> component_names_as_chars{};
+  std::vector<int> component_types{};
+  std::vector<unsigned long long> dimension{};
+  if (rank == root) {
+    for (const auto& component : elements.front().tensor_components) {
+      ASSERT(component.name.find_last_of('/') == std::string::npos,
+             "The expected format of the tensor component names is "
+             "'COMPONENT_NAME' but found a '/' in '"
+                 << component.name << "'.");
+      component_names_as_chars.insert(component_names_as_chars.end(),
+                                      component.name.begin(),
+                                      component.name.end());
+      component_names_as_chars.push_back('\0');
+      component_types.push_back(static_cast<int>(component.data.index()));
+    }
+    dimension.push_back(elements.front().extents.size());
+  }
+  broadcast(make_not_null(&component_names_as_chars), root, communicator);
+  broadcast(make_not_null(&component_types), root, communicator);
+  broadcast(make_not_null(&dimension), root, communicator);
+  std::vector<std::string> component_names{};
+  for (auto it = component_names_as_chars.begin();
+       it != component_names_as_chars.end();) {
+    const auto end_of_name =
+        std::find(it, component_names_as_chars.end(), '\0');
+    component_names.emplace_back(it, end_of_name);
+    it = std::next(end_of_name);
+  }
+  const size_t dim = dimension.front();
+
+  size_t local_number_of_points = 0;
+  for (const auto& element : elements) {
+    local_number_of_points +=
+        alg::accumulate(element.extents, 1_st, std::multiplies<>{});
+  }
+  const auto [point_offset, total_number_of_points] =
+      offset_and_total_size(local_number_of_points, communicator, rank);
+  if (total_number_of_points >
+      static_cast<hsize_t>(std::numeric_limits<int>::max())) {
+    ERROR("Cannot write " << total_number_of_points
+                          << " points because the connectivity is stored as "
+                             "'int'.");
+  }
+
+  std::vector<size_t> extents{};
+  std::string grid_names{};
+  std::vector<int> connectivity{};
+  std::vector<int> pole_connectivity{};
+  std::vector<int> quadratures{};
+  std::vector<int> bases{};
+  int total_points_so_far = static_cast<int>(point_offset);
+  for (const auto& element : elements) {
+    grid_names += element.element_name + VolumeData::separator();
+    alg::transform(element.basis, std::back_inserter(bases),
+                   [](const Spectral::Basis t) {
+                     // Shift the basis to keep compatibility with old file
+                     // formats.
+                     return static_cast<int>(static_cast<uint8_t>(t) >>
+                                             Spectral::basis_shift);
+                   });
+    alg::transform(
+        element.quadrature, std::back_inserter(quadratures),
+        [](const Spectral::Quadrature t) { return static_cast<int>(t); });
+    detail::append_element_extents_and_connectivity(
+        &extents, &connectivity, &pole_connectivity, &total_points_so_far, dim,
+        element);
+  }
+  const auto [connectivity_offset, total_connectivity_size] =
+      offset_and_total_size(connectivity.size(), communicator, rank);
+
+  const std::vector<char> all_grid_names = gather_on_rank_zero(
+      std::vector<char>(grid_names.begin(), grid_names.end()), communicator,
+      rank, number_of_ranks);
+  const auto all_extents =
+      gather_on_rank_zero(extents, communicator, rank, number_of_ranks);
+  const auto all_bases =
+      gather_on_rank_zero(bases, communicator, rank, number_of_ranks);
+  const auto all_quadratures =
+      gather_on_rank_zero(quadratures, communicator, rank, number_of_ranks);
+  const auto all_pole_connectivity = gather_on_rank_zero(
+      pole_connectivity, communicator, rank, number_of_ranks);
+
+  // Same naming as in the `h5::VolumeData` constructor
+  const std::string volume_group_path =
+      subfile_path.size() > VolumeData::extension().size() and
+              subfile_path.substr(subfile_path.size() -
+                                  VolumeData::extension().size()) ==
+                  VolumeData::extension()
+          ? subfile_path
+          : subfile_path + VolumeData::extension();
+  const std::string observation_path =
+      "ObservationId" + std::to_string(observation_id);
+
+  // Rank 0 writes the metadata and allocates the datasets that are written
+  // collectively, using the serial HDF5 driver.
+  if (rank == 0) {
+    {
+      H5File<AccessType::ReadWrite> h5_file(file_name, true, input_source);
+      h5_file.try_insert<VolumeData>(subfile_path, version);
+    }
+    const hid_t file_access = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK_H5(file_access, "Failed to create file access property list.");
+    CHECK_H5(
+        H5Pset_alignment(file_access, dataset_alignment, dataset_alignment),
+        "Failed to set alignment.");
+    const hid_t file_id =
+        H5Fopen(file_name.c_str(), h5f_acc_rdwr(), file_access);
+    CHECK_H5(file_id, "Failed to open file '" << file_name << "'");
+    {
+      const detail::OpenGroup volume_group(file_id, volume_group_path,
+                                           AccessType::ReadWrite);
+      if (not contains_attribute(volume_group.id(), "", "dimension")) {
+        write_to_attribute(volume_group.id(), "dimension", dim);
+      }
+      const detail::OpenGroup observation_group(
+          volume_group.id(), observation_path, AccessType::ReadWrite);
+      if (contains_attribute(observation_group.id(), "", "observation_value")) {
+        ERROR_NO_TRACE("Trying to write ObservationId "
+                       << std::to_string(observation_id)
+                       << " which already exists in file at "
+                       << observation_path
+                       << ". Did you forget to clean up after an earlier run?");
+      }
+      write_to_attribute(observation_group.id(), "observation_value",
+                         observation_value);
+      for (size_t i = 0; i < component_names.size(); ++i) {
+        if (component_types[i] == 0) {
+          create_dataset_for_collective_write<double>(
+              observation_group.id(), component_names[i],
+              total_number_of_points);
+        } else {
+          create_dataset_for_collective_write<float>(observation_group.id(),
+                                                     component_names[i],
+                                                     total_number_of_points);
+        }
+      }
+      write_data(observation_group.id(), all_extents, {all_extents.size()},
+                 "total_extents");
+      std::vector<char> grid_names_as_chars = all_grid_names;
+      grid_names_as_chars.pop_back();
+      write_data(observation_group.id(), grid_names_as_chars,
+                 {grid_names_as_chars.size()}, "grid_names");
+      const auto io_quadratures = Spectral::all_quadratures();
+      std::vector<std::string> quadrature_dict(io_quadratures.size());
+      alg::transform(io_quadratures, quadrature_dict.begin(),
+                     get_output<Spectral::Quadrature>);
+      h5_detail::write_dictionary("Quadrature dictionary", quadrature_dict,
+                                  observation_group);
+      write_data(observation_group.id(), all_quadratures,
+                 {all_quadratures.size()}, "quadratures");
+      const auto io_bases = Spectral::all_bases();
+      std::vector<std::string> basis_dict(io_bases.size());
+      alg::transform(io_bases, basis_dict.begin(), get_output<Spectral::Basis>);
+      h5_detail::write_dictionary("Basis dictionary", basis_dict,
+                                  observation_group);
+      write_data(observation_group.id(), all_bases, {all_bases.size()},
+                 "bases");
+      create_dataset_for_collective_write<int>(
+          observation_group.id(), "connectivity", total_connectivity_size);
+      if (not all_pole_connectivity.empty()) {
+        write_data(observation_group.id(), all_pole_connectivity,
+                   {all_pole_connectivity.size()}, "pole_connectivity");
+      }
+      if (serialized_domain.has_value()) {
+        write_data(observation_group.id(), *serialized_domain,
+                   {serialized_domain->size()}, "domain");
+      }
+      if (serialized_functions_of_time.has_value()) {
+        write_data(observation_group.id(), *serialized_functions_of_time,
+                   {serialized_functions_of_time->size()},
+                   "functions_of_time");
+      }
+    }
+    CHECK_H5(H5Fclose(file_id), "Failed to close file '" << file_name << "'");
+    CHECK_H5(H5Pclose(file_access), "Failed to close property list");
+  }
+  check_mpi(MPI_Barrier(communicator), "MPI_Barrier");
+
+  // All ranks write their slabs of the large datasets with one collective
+  // write each.
+  const hid_t file_access = H5Pcreate(H5P_FILE_ACCESS);
+  CHECK_H5(file_access, "Failed to create file access property list.");
+  CHECK_H5(H5Pset_fapl_mpio(file_access, communicator, MPI_INFO_NULL),
+           "Failed to set the MPI-IO file driver.");
+  CHECK_H5(H5Pset_all_coll_metadata_ops(file_access, true),
+           "Failed to set collective metadata reads.");
+  const hid_t file_id = H5Fopen(file_name.c_str(), h5f_acc_rdwr(), file_access);
+  CHECK_H5(file_id, "Failed to open file '" << file_name
+                                            << "' with the MPI-IO driver");
+  const hid_t transfer_properties = H5Pcreate(H5P_DATASET_XFER);
+  CHECK_H5(transfer_properties, "Failed to create transfer property list.");
+  CHECK_H5(H5Pset_dxpl_mpio(transfer_properties, H5FD_MPIO_COLLECTIVE),
+           "Failed to set collective transfer.");
+  {
+    const detail::OpenGroup observation_group(
+        file_id, volume_group_path + "/" + observation_path,
+        AccessType::ReadWrite);
+    for (size_t i = 0; i < component_names.size(); ++i) {
+      if (component_types[i] == 0) {
+        write_slab(observation_group.id(), component_names[i],
+                   contiguous_component_data<double>(
+                       elements, i, component_names[i], local_number_of_points),
+                   point_offset, transfer_properties);
+      } else {
+        write_slab(observation_group.id(), component_names[i],
+                   contiguous_component_data<float>(
+                       elements, i, component_names[i], local_number_of_points),
+                   point_offset, transfer_properties);
+      }
+    }
+    write_slab(observation_group.id(), "connectivity", connectivity,
+               connectivity_offset, transfer_properties);
+  }
+  CHECK_H5(H5Pclose(transfer_properties), "Failed to close property list");
+  CHECK_H5(H5Fclose(file_id), "Failed to close file '" << file_name << "'");
+  CHECK_H5(H5Pclose(file_access), "Failed to close property list");
+}
+}  // namespace h5
+#endif  // SPECTRE_PARALLEL_HDF5
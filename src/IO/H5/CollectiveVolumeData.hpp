@@ -0,0 +1,56 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#ifdef SPECTRE_PARALLEL_HDF5
+#include <cstddef>
+#include <cstdint>
+#include <mpi.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+/// \cond
+struct ElementVolumeData;
+/// \endcond
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief Write the volume data of one observation from all ranks of
+ * `communicator` to a single file using HDF5's MPI-IO driver.
+ *
+ * \details This is a collective operation: every rank of `communicator` must
+ * call it with the same `file_name`, `subfile_path`, `version`,
+ * `observation_id` and `observation_value`, and the calls for different
+ * observations must happen in the same order on all ranks. `elements` are the
+ * elements of the calling rank and may be empty on any rank. The tensor
+ * components are taken from the elements of the lowest rank that has any, and
+ * nothing is written if no rank has elements. The `serialized_domain` and
+ * `serialized_functions_of_time` are only used on rank 0.
+ *
+ * The file has the same layout as one written by
+ * `h5::VolumeData::write_volume_data`, so it can be read with
+ * `h5::VolumeData`, with the elements ordered by rank. Rank 0 creates the
+ * subfile and the observation group, writes the grid names, extents, bases and
+ * quadratures gathered from all ranks, and allocates the tensor component and
+ * connectivity datasets, which are aligned to 1 MiB in the file. Then each rank
+ * writes its contiguous slab of these datasets in a collective write, offset
+ * by the number of points and connectivity entries of the lower ranks. Since
+ * the collective datasets are not chunked they are also not compressed, and
+ * the `TensorComponent::compression` is ignored.
+ *
+ * \note The connectivity only connects points within an element, which is what
+ * `h5::VolumeData::write_volume_data` writes too.
+ */
+void write_volume_data_collectively(
+    MPI_Comm communicator, const std::string& file_name,
+    const std::string& input_source, const std::string& subfile_path,
+    uint32_t version, size_t observation_id, double observation_value,
+    const std::vector<ElementVolumeData>& elements,
+    const std::optional<std::vector<char>>& serialized_domain = std::nullopt,
+    const std::optional<std::vector<char>>& serialized_functions_of_time =
+        std::nullopt);
+}  // namespace h5
+#endif  // SPECTRE_PARALLEL_HDF5
@@ -3,11 +3,16 @@
 
 #include "IO/H5/CombineH5.hpp"
 
+#include <algorithm>
 #include <boost/program_options.hpp>
 #include <cstddef>
 #include <cstdlib>
+#include <functional>
 #include <iterator>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
@@ -17,9 +22,14 @@
 #include "IO/H5/SourceArchive.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Parallel/Printf/Printf.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/MakeString.hpp"
+#include "Utilities/Numeric.hpp"
 #include "Utilities/StdHelpers.hpp"
 
 namespace {
@@ -34,27 +44,88 @@ std::vector<size_t> get_observation_ids(
   return initial_volume_file.list_observation_ids();
 }
 
-// Returns total number of elements for an observation id across all volume data
-// files
-size_t get_number_of_elements(const std::vector<std::string>& input_filenames,
-                              const std::string& subfile_name,
-                              const size_t& observation_id) {
-  size_t total_elements = 0;
-  for (const auto& input_filename : input_filenames) {
-    const h5::H5File<h5::AccessType::ReadOnly> original_file(input_filename,
-                                                             false);
-    const auto& original_volume_file =
-        original_file.get<h5::VolumeData>(subfile_name);
-    total_elements += original_volume_file.get_extents(observation_id).size();
+// The grids of one observation in one volume file
+struct FileGrids {
+  std::vector<std::string> grid_names{};
+  std::vector<std::vector<size_t>> extents{};
+  std::vector<std::vector<Spectral::Basis>> bases{};
+  std::vector<std::vector<Spectral::Quadrature>> quadratures{};
+  size_t number_of_points = 0;
+};
+
+FileGrids get_file_grids(const h5::VolumeData& volume_file,
+                         const size_t observation_id) {
+  FileGrids result{volume_file.get_grid_names(observation_id),
+                   volume_file.get_extents(observation_id),
+                   volume_file.get_bases(observation_id),
+                   volume_file.get_quadratures(observation_id)};
+  for (const auto& extents : result.extents) {
+    result.number_of_points +=
+        alg::accumulate(extents, 1_st, std::multiplies<>{});
+  }
+  return result;
+}
+
+// Reads the tensor component `component_name` from all files and concatenates
+// it in the order of the files, which is the order in which the elements are
+// written to the combined file
+std::variant<DataVector, std::vector<float>> read_combined_component(
+    const std::vector<std::string>& file_names,
+    const std::vector<const h5::VolumeData*>& volume_files,
+    const size_t observation_id, const std::string& component_name,
+    const size_t number_of_points) {
+  std::variant<DataVector, std::vector<float>> result{};
+  size_t offset = 0;
+  for (size_t file_index = 0; file_index < file_names.size(); ++file_index) {
+    const auto& file_name = file_names[file_index];
+    const auto& original_volume_file = *volume_files[file_index];
+    const auto component_data =
+        original_volume_file.get_tensor_component(observation_id,
+                                                  component_name)
+            .data;
+    if (file_index == 0) {
+      if (std::holds_alternative<DataVector>(component_data)) {
+        result = DataVector(number_of_points);
+      } else {
+        result = std::vector<float>(number_of_points);
+      }
+    } else if (component_data.index() != result.index()) {
+      ERROR_NO_TRACE("The tensor component '"
+                     << component_name << "' in file '" << file_name
+                     << "' has a different precision than in the first file.");
+    }
+    std::visit(
+        [&component_data, &component_name, &file_name, &number_of_points,
+         &offset](auto& combined_data) {
+          const auto& data =
+              std::get<std::decay_t<decltype(combined_data)>>(component_data);
+          if (offset + data.size() > number_of_points) {
+            ERROR_NO_TRACE("The tensor component '"
+                           << component_name << "' in file '" << file_name
+                           << "' has more points than the grids in the "
+                              "files.");
+          }
+          std::copy(data.begin(), data.end(),
+                    combined_data.begin() +
+                        static_cast<std::ptrdiff_t>(offset));
+          offset += data.size();
+        },
+        result);
+  }
+  if (offset != number_of_points) {
+    ERROR_NO_TRACE("The tensor component '"
+                   << component_name << "' has " << offset
+                   << " points, but the grids in the files have "
+                   << number_of_points << " points.");
   }
-  return total_elements;
+  return result;
 }
 }  // namespace
 namespace h5 {
 
 void combine_h5(const std::vector<std::string>& file_names,
                 const std::string& subfile_name, const std::string& output,
-                const bool check_src) {
+                const bool check_src, const bool verbose) {
   // Parses for and stores all input files to be looped over
   Parallel::printf("Processing files:\n%s\n",
                    std::string{MakeString{} << file_names}.c_str());
@@ -77,76 +148,116 @@ void combine_h5(const std::vector<std::string>& file_names,
         "executable or were corrupted.");
   }
 
-  // Braces to specify scope for H5 file
-  {
-    // Instantiates the output file and the .vol subfile to be filled with the
-    // combined data later
-    Parallel::printf("Creating output file: %s\n", output.c_str());
-    h5::H5File<h5::AccessType::ReadWrite> new_file(output, true);
-    new_file.insert<h5::VolumeData>(subfile_name);
-    new_file.close_current_object();
-  }  // End of scope for H5 file
-
   // Obtains list of observation ids to loop over
   const std::vector<size_t> observation_ids =
       get_observation_ids(file_names, subfile_name);
 
-  // Loops over observation ids to write volume data by observation id
+  // The input files and the output file stay open while the files are
+  // combined, so each file is opened once rather than once per observation
+  // and tensor component
+  std::vector<h5::H5File<h5::AccessType::ReadOnly>> original_files{};
+  original_files.reserve(file_names.size());
+  std::vector<const h5::VolumeData*> original_volume_files{};
+  original_volume_files.reserve(file_names.size());
+  for (const auto& file_name : file_names) {
+    original_files.emplace_back(file_name, false);
+    original_volume_files.push_back(
+        &original_files.back().get<h5::VolumeData>(subfile_name));
+  }
+  // Instantiates the output file and the .vol subfile to be filled with the
+  // combined data
+  if (verbose) {
+    Parallel::printf("Creating output file: %s\n", output.c_str());
+  }
+  h5::H5File<h5::AccessType::ReadWrite> new_file(output, true);
+  auto& new_volume_file = new_file.insert<h5::VolumeData>(subfile_name);
+
+  // Loops over observation ids to write volume data by observation id. To
+  // bound the memory usage, the files are combined one tensor component at a
+  // time: the grids are written along with the first component, and each of
+  // the other components is read from all files and written before the next
+  // one is read. So at most one tensor component of one observation is held in
+  // memory, instead of all components of the observation.
   for (size_t obs_index = 0; obs_index < observation_ids.size(); ++obs_index) {
     const size_t obs_id = observation_ids[obs_index];
-    // Pre-calculates size of vector to store element data and allocates
-    // corresponding memory
-    const size_t vector_dim =
-        get_number_of_elements(file_names, subfile_name, obs_id);
-    std::vector<ElementVolumeData> element_data;
-    element_data.reserve(vector_dim);
-
     double obs_val = 0.0;
     std::optional<std::vector<char>> serialized_domain{};
     std::optional<std::vector<char>> serialized_functions_of_time{};
-
-    // Loops over input files to append element data into a single vector to be
-    // stored in a single H5
-    bool printed = false;
-    for (auto const& file_name : file_names) {
-      const h5::H5File<h5::AccessType::ReadOnly> original_file(file_name,
-                                                               false);
-      const auto& original_volume_file =
-          original_file.get<h5::VolumeData>(subfile_name);
-      obs_val = original_volume_file.get_observation_value(obs_id);
-      if (not printed) {
+    std::vector<std::string> component_names{};
+    std::vector<FileGrids> file_grids{};
+    file_grids.reserve(file_names.size());
+    size_t number_of_points = 0;
+    for (const auto* const original_volume_file_ptr : original_volume_files) {
+      const auto& original_volume_file = *original_volume_file_ptr;
+      if (file_grids.empty()) {
+        obs_val = original_volume_file.get_observation_value(obs_id);
         Parallel::printf(
             "Processing obsevation ID %lo (%lo/%lo) with value %1.14e\n",
             obs_id, obs_index, observation_ids.size(), obs_val);
-        printed = true;
+        serialized_domain = original_volume_file.get_domain(obs_id);
+        serialized_functions_of_time =
+            original_volume_file.get_functions_of_time(obs_id);
+        component_names = original_volume_file.list_tensor_components(obs_id);
       }
-      Parallel::printf("  Processing file: %s\n", file_name.c_str());
-
-      serialized_domain = original_volume_file.get_domain(obs_id);
-      serialized_functions_of_time =
-          original_volume_file.get_functions_of_time(obs_id);
-
-      // Get vector of element data for this `obs_id` and `file_name`
-      std::vector<ElementVolumeData> data_by_element =
-          std::move(std::get<2>(original_volume_file.get_data_by_element(
-              obs_val * (1.0 - 4.0 * std::numeric_limits<double>::epsilon()),
-              obs_val * (1.0 + 4.0 * std::numeric_limits<double>::epsilon()),
-              std::nullopt)[0]));
-
-      // Append vector to total vector of element data for this `obs_id`
-      element_data.insert(element_data.end(),
-                          std::make_move_iterator(data_by_element.begin()),
-                          std::make_move_iterator(data_by_element.end()));
-      data_by_element.clear();
-      original_file.close_current_object();
+      file_grids.push_back(get_file_grids(original_volume_file, obs_id));
+      number_of_points += file_grids.back().number_of_points;
+    }
+    if (component_names.empty()) {
+      ERROR_NO_TRACE("Observation ID " << obs_id
+                                       << " has no tensor components.");
     }
 
-    h5::H5File<h5::AccessType::ReadWrite> new_file(output, true);
-    auto& new_volume_file = new_file.get<h5::VolumeData>(subfile_name);
-    new_volume_file.write_volume_data(obs_id, obs_val, element_data,
-                                      serialized_domain,
-                                      serialized_functions_of_time);
-    new_file.close_current_object();
+    for (size_t component_index = 0; component_index < component_names.size();
+         ++component_index) {
+      const std::string& component_name = component_names[component_index];
+      if (verbose) {
+        Parallel::printf("  Processing tensor component: %s\n",
+                         component_name.c_str());
+      }
+      const auto combined_data =
+          read_combined_component(file_names, original_volume_files, obs_id,
+                                  component_name, number_of_points);
+      if (component_index == 0) {
+        // Split the first component by element to write it along with the
+        // grids
+        std::vector<ElementVolumeData> element_data{};
+        size_t offset = 0;
+        for (const auto& grids : file_grids) {
+          for (size_t i = 0; i < grids.grid_names.size(); ++i) {
+            const size_t num_points = alg::accumulate(
+                grids.extents[i], 1_st, std::multiplies<>{});
+            std::visit(
+                [&](const auto& data) {
+                  using DataType = std::decay_t<decltype(data)>;
+                  DataType element_component(num_points);
+                  std::copy(
+                      data.begin() + static_cast<std::ptrdiff_t>(offset),
+                      data.begin() +
+                          static_cast<std::ptrdiff_t>(offset + num_points),
+                      element_component.begin());
+                  element_data.emplace_back(
+                      grids.grid_names[i],
+                      std::vector<TensorComponent>{TensorComponent{
+                          component_name, std::move(element_component)}},
+                      grids.extents[i], grids.bases[i],
+                      grids.quadratures[i]);
+                },
+                combined_data);
+            offset += num_points;
+          }
+        }
+        new_volume_file.write_volume_data(obs_id, obs_val, element_data,
+                                          serialized_domain,
+                                          serialized_functions_of_time);
+      } else {
+        std::visit(
+            [&](const auto& data) {
+              new_volume_file.write_tensor_component(obs_id, component_name,
+                                                     data);
+            },
+            combined_data);
+      }
+    }
   }
 }
 }  // namespace h5
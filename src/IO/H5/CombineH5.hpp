@@ -7,9 +7,19 @@
 #include <vector>
 
 namespace h5 {
-
+/*!
+ * \brief Combine the volume data in the subfile `subfile_name` of all
+ * `file_names` into a single `output` file
+ *
+ * \details The observations are combined one after another, and each
+ * observation one tensor component at a time, so at most one tensor component
+ * of one observation is held in memory. All files stay open while they are
+ * combined. The data is decompressed and compressed again. With `verbose`, the
+ * name of the output file and of every tensor component are printed as they
+ * are created and combined.
+ */
 void combine_h5(const std::vector<std::string>& file_names,
                 const std::string& subfile_name, const std::string& output,
-                const bool check_src = true);
+                bool check_src = true, bool verbose = false);
 
 }  // namespace h5
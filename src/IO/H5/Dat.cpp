@@ -23,7 +23,7 @@
 namespace h5 {
 Dat::Dat(const bool exists, detail::OpenGroup&& group, const hid_t location,
          const std::string& name, std::vector<std::string> legend,
-         const uint32_t version)
+         const uint32_t version, const size_t rows_per_chunk)
     : group_(std::move(group)),
       name_(extension() == name.substr(name.size() > extension().size()
                                            ? name.size() - extension().size()
@@ -68,7 +68,8 @@ Dat::Dat(const bool exists, detail::OpenGroup&& group, const hid_t location,
     size_[1] = legend_.size();
   } else {  // file does not exist
     dataset_id_ = h5::detail::create_extensible_dataset(
-        location, name_, size_, std::array<hsize_t, 2>{{4, legend_.size()}},
+        location, name_, size_,
+        std::array<hsize_t, 2>{{rows_per_chunk, legend_.size()}},
         {{h5s_unlimited(), legend_.size()}});
     CHECK_H5(dataset_id_, "Failed to create dataset");
 
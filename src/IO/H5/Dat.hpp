@@ -36,6 +36,11 @@ namespace h5 {
  * multiple Dat objects can be stored inside a single H5File the problem of many
  * different dat files being stored as individual files is solved.
  *
+ * The data is stored in chunks of `rows_per_chunk` rows, which is only used
+ * when the dat file is created. Larger chunks make reads of many consecutive
+ * rows touch fewer chunks, at the cost of allocating the storage of a whole
+ * chunk at a time.
+ *
  * \note This class does not do any caching of data so all data is written as
  * soon as append() is called.
  */
@@ -46,7 +51,7 @@ class Dat : public h5::Object {
 
   Dat(bool exists, detail::OpenGroup&& group, hid_t location,
       const std::string& name, std::vector<std::string> legend = {},
-      uint32_t version = 1);
+      uint32_t version = 1, size_t rows_per_chunk = 4);
 
   Dat(const Dat& /*rhs*/) = delete;
   Dat& operator=(const Dat& /*rhs*/) = delete;
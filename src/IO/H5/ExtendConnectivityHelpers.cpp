@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <functional>
 #include <boost/functional/hash.hpp>
 #include <cstddef>
 #include <string>
@@ -13,11 +14,16 @@
 #include <vector>
 
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "IO/Connectivity.hpp"
+#include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
@@ -361,6 +367,105 @@ generate_new_connectivity(
 }  // namespace
 
 namespace h5::detail {
+// Append the element extents and connectivity to the total extents and
+// connectivity
+void append_element_extents_and_connectivity(
+    const gsl::not_null<std::vector<size_t>*> total_extents,
+    const gsl::not_null<std::vector<int>*> total_connectivity,
+    const gsl::not_null<std::vector<int>*> pole_connectivity,
+    const gsl::not_null<int*> total_points_so_far, const size_t dim,
+    const ElementVolumeData& element) {
+  // Process the element extents
+  const auto& extents = element.extents;
+  ASSERT(alg::none_of(extents, [](const size_t extent) { return extent == 1; }),
+         "We cannot generate connectivity for any single grid point elements.");
+  if (extents.size() != dim) {
+    ERROR("Trying to write data of dimensionality"
+          << extents.size() << "but the VolumeData file has dimensionality"
+          << dim << ".");
+  }
+  total_extents->insert(total_extents->end(), extents.begin(), extents.end());
+  // Find the number of points in the local connectivity
+  const int element_num_points =
+      alg::accumulate(extents, 1, std::multiplies<>{});
+  // Generate the connectivity data for the element
+  // Possible optimization: local_connectivity.reserve(BLAH) if we can figure
+  // out size without computing all the connectivities.
+  const std::vector<int> connectivity = [&extents, &total_points_so_far]() {
+    std::vector<int> local_connectivity;
+    for (const auto& cell : vis::detail::compute_cells(extents)) {
+      for (const auto& bounding_indices : cell.bounding_indices) {
+        local_connectivity.emplace_back(*total_points_so_far +
+                                        static_cast<int>(bounding_indices));
+      }
+    }
+    return local_connectivity;
+  }();
+  *total_points_so_far += element_num_points;
+  total_connectivity->insert(total_connectivity->end(), connectivity.begin(),
+                             connectivity.end());
+
+  // If element is 2D and the bases are both SphericalHarmonic,
+  // then add extra connections to close the surface.
+  if (dim == 2) {
+    if (not(element.basis[0] == Spectral::Basis::SphericalHarmonic and
+            element.basis[1] == Spectral::Basis::SphericalHarmonic)) {
+      return;
+    }
+    // Extents are (l+1, 2l+1)
+    const int l = static_cast<int>(element.extents[0] - 1);
+
+    // Connect max(phi) and min(phi) by adding more quads
+    // to total_connectivity
+    for (int j = 0; j < l; ++j) {
+      total_connectivity->push_back(j);
+      total_connectivity->push_back(j + 1);
+      total_connectivity->push_back(2 * l * (l + 1) + j + 1);
+      total_connectivity->push_back((2 * l) * (l + 1) + j);
+    }
+
+    // Add a new connectivity output for filling the poles
+    // First, get the points at min(theta), which define the
+    // boundary of the top pole to fill, and the points at
+    // max(theta), which define the boundary of the bottom
+    // pole to fill. Note: points are stored with theta
+    // varying faster than phi.
+    std::vector<int> top_pole_points{};
+    std::vector<int> bottom_pole_points{};
+    for (int k = 0; k < (2 * l + 1); ++k) {
+      top_pole_points.push_back(k * (l + 1));
+      bottom_pole_points.push_back(k * (l + 1) + l);
+    }
+
+    const size_t number_of_pole_points = top_pole_points.size();
+    if (number_of_pole_points < 3) {
+      ERROR_NO_TRACE(
+          "Cannot write a 2D surface to file with l=0. Must have at least "
+          "l=1.");
+    }
+
+    // Fill poles with triangles in a fan pattern. Choose the root point that is
+    // common with all triangles to be the first point for each pole
+    const int top_root_point = top_pole_points[0];
+    const int bottom_root_point = bottom_pole_points[0];
+
+    // We end such that the last triangle we make has indices (0, N-2, N-1)
+    // given number_of_pole_points = N
+    for (size_t i = 1; i <= number_of_pole_points - 2; i++) {
+      int top_second_point = gsl::at(top_pole_points, i);
+      int top_third_point = gsl::at(top_pole_points, i + 1);
+      int bottom_second_point = gsl::at(bottom_pole_points, i);
+      int bottom_third_point = gsl::at(bottom_pole_points, i + 1);
+
+      pole_connectivity->push_back(top_root_point);
+      pole_connectivity->push_back(top_second_point);
+      pole_connectivity->push_back(top_third_point);
+      pole_connectivity->push_back(bottom_root_point);
+      pole_connectivity->push_back(bottom_second_point);
+      pole_connectivity->push_back(bottom_third_point);
+    }
+  }
+}
 
 // Write new connectivity connections given a std::vector of observation ids
 template <size_t SpatialDim>
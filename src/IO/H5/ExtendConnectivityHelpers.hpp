@@ -8,7 +8,10 @@
 #include <string>
 #include <vector>
 
+#include "Utilities/Gsl.hpp"
+
 /// \cond
+struct ElementVolumeData;
 namespace Spectral {
 enum class Basis : uint8_t;
 enum class Quadrature : uint8_t;
@@ -21,6 +24,16 @@ std::vector<int> extend_connectivity(
     std::vector<std::vector<Spectral::Basis>>& bases,
     std::vector<std::vector<Spectral::Quadrature>>& quadratures,
     std::vector<std::vector<size_t>>& extents);
+
+// Append the extents of `element` to `total_extents` and the connectivity of
+// its points, offset by `total_points_so_far`, to `total_connectivity`, and
+// increase `total_points_so_far` by the number of points of `element`.
+void append_element_extents_and_connectivity(
+    gsl::not_null<std::vector<size_t>*> total_extents,
+    gsl::not_null<std::vector<int>*> total_connectivity,
+    gsl::not_null<std::vector<int>*> pole_connectivity,
+    gsl::not_null<int*> total_points_so_far, size_t dim,
+    const ElementVolumeData& element);
 }
 
 /// \endcond
@@ -4,8 +4,12 @@
 #include "IO/H5/Helpers.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <ostream>
 #include <string>
@@ -17,6 +21,7 @@
 #include "DataStructures/Matrix.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/CheckH5.hpp"
+#include "IO/H5/LossyCompression.hpp"
 #include "IO/H5/OpenGroup.hpp"
 #include "IO/H5/Type.hpp"
 #include "IO/H5/Wrappers.hpp"
@@ -24,6 +29,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/ErrorHandling/StaticAssert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/StdHelpers.hpp"
 #include "Utilities/TMPL.hpp"
@@ -259,6 +265,116 @@ void write_data(const hid_t group_id, const std::vector<T>& data,
   CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
 }
 
+namespace {
+// Registered ID of the H5Z-ZFP filter plugin
+constexpr H5Z_filter_t zfp_filter_id = 32013;
+// Fixed-accuracy mode of the H5Z-ZFP filter
+constexpr unsigned int zfp_accuracy_mode = 3;
+
+bool filter_is_available(const H5Z_filter_t filter_id) {
+  if (H5Zfilter_avail(filter_id) <= 0) {
+    return false;
+  }
+  unsigned int filter_info = 0;
+  const auto status = H5Zget_filter_info(filter_id, &filter_info);
+  return status >= 0 and (filter_info & H5Z_FILTER_CONFIG_ENCODE_ENABLED);
+}
+
+template <typename T>
+double max_abs(const std::vector<T>& data) {
+  double result = 0.0;
+  for (const T value : data) {
+    result = std::max(result, std::abs(static_cast<double>(value)));
+  }
+  return result;
+}
+
+template <typename T>
+void write_with_zfp(const hid_t group_id, const std::vector<T>& data,
+                    const std::string& name, const double absolute_error) {
+  if (not filter_is_available(zfp_filter_id)) {
+    ERROR_NO_TRACE(
+        "Cannot write dataset '"
+        << name
+        << "' with ZFP compression because the H5Z-ZFP filter plugin is not "
+           "available. Point the HDF5_PLUGIN_PATH environment variable to the "
+           "directory that contains the plugin.");
+  }
+  // Same chunk size as `h5::write_data`
+  constexpr size_t target_number_of_bytes_per_chunk = 131'072;
+  const auto size = static_cast<hsize_t>(data.size());
+  const hsize_t chunk_size =
+      std::min(size, static_cast<hsize_t>(target_number_of_bytes_per_chunk /
+                                          sizeof(T)));
+  // The H5Z-ZFP filter reads the tolerance as a double stored in two
+  // consecutive unsigned ints
+  std::array<unsigned int, 4> cd_values{zfp_accuracy_mode, 0, 0, 0};
+  static_assert(sizeof(double) == 2 * sizeof(unsigned int));
+  std::memcpy(&cd_values[2], &absolute_error, sizeof(double));
+
+  const hid_t space_id = H5Screate_simple(1, &size, nullptr);
+  CHECK_H5(space_id, "Failed to create dataspace");
+  const hid_t property_list = H5Pcreate(H5P_DATASET_CREATE);
+  CHECK_H5(property_list, "Failed to create property list");
+  CHECK_H5(H5Pset_chunk(property_list, 1, &chunk_size),
+           "Failed to set chunk size on dataset " << name);
+  CHECK_H5(H5Pset_filter(property_list, zfp_filter_id, H5Z_FLAG_MANDATORY,
+                         cd_values.size(), cd_values.data()),
+           "Failed to enable ZFP filter on dataset " << name);
+  CHECK_H5(H5Pset_fill_time(property_list, H5D_FILL_TIME_NEVER),
+           "Failed to disable setting default values on dataset creation for "
+           "dataset "
+               << name);
+  const hid_t dataset_id =
+      H5Dcreate2(group_id, name.c_str(), h5_type<T>(), space_id, h5p_default(),
+                 property_list, h5p_default());
+  CHECK_H5(dataset_id, "Failed to create dataset");
+  CHECK_H5(H5Dwrite(dataset_id, h5_type<T>(), h5s_all(), h5s_all(),
+                    h5p_default(), static_cast<const void*>(data.data())),
+           "Failed to write data to dataset");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  CHECK_H5(H5Pclose(property_list), "Failed to close property list");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+}
+}  // namespace
+
+template <typename T>
+void write_data(const hid_t group_id, const std::vector<T>& data,
+                const std::string& name, const LossyCompression& compression,
+                const bool overwrite_existing) {
+  ASSERT(not data.empty(), "Got zero extent when trying to write data.");
+  if (H5Lexists(group_id, name.c_str(), h5p_default()) != 0) {
+    if (not overwrite_existing) {
+      ERROR("Dataset already exists with name '" << name << "'.");
+    }
+    CHECK_H5(H5Ldelete(group_id, name.c_str(), h5p_default()),
+             "Failed to delete existing dataset");
+  }
+  if (compression.method == LossyCompressionMethod::BitRounding) {
+    std::vector<T> rounded_data(data.size());
+    std::transform(data.begin(), data.end(), rounded_data.begin(),
+                   [&compression](const T value) {
+                     return detail::round_mantissa(
+                         value, *compression.relative_error);
+                   });
+    h5::write_data(group_id, rounded_data, {rounded_data.size()}, name);
+  } else {
+    const double absolute_error =
+        compression.absolute_error.has_value()
+            ? *compression.absolute_error
+            : *compression.relative_error * max_abs(data);
+    // ZFP needs a positive tolerance even if all data is zero
+    write_with_zfp(
+        group_id, data, name,
+        absolute_error > 0.0 ? absolute_error
+                             : std::numeric_limits<double>::min());
+  }
+  const hid_t dataset_id = H5Dopen2(group_id, name.c_str(), h5p_default());
+  CHECK_H5(dataset_id, "Failed to open dataset '" << name << "'");
+  write_to_attribute(dataset_id, "lossy_compression", get_output(compression));
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+}
+
 void write_data(const hid_t group_id, const DataVector& data,
                 const std::string& name, const bool overwrite_existing) {
   const auto number_of_points = static_cast<hsize_t>(data.size());
@@ -437,17 +553,28 @@ Matrix retrieve_dataset_subset(const hid_t file_id,
 
   CHECK_H5(H5Sselect_none(dataspace_id),
            "Failed to select none of the dataspace");
-  for (auto& column : these_columns) {
+  // Select runs of consecutive columns as a single block. Combining many
+  // single-column hyperslabs is expensive in HDF5, and the worldtube data read
+  // by CCE reads nearly all of the columns of each dataset.
+  for (size_t run_start = 0; run_start < num_cols;) {
+    size_t run_end = run_start + 1;
+    while (run_end < num_cols and
+           these_columns[run_end] == these_columns[run_end - 1] + 1) {
+      ++run_end;
+    }
     const std::array<hsize_t, 2> start{
-        {first_row, static_cast<hsize_t>(column)}};
+        {first_row, static_cast<hsize_t>(these_columns[run_start])}};
     // offset between blocks (have only one anyway)
     const std::array<hsize_t, 2> stride{{1, 1}};
     const std::array<hsize_t, 2> count{{1, 1}};
-    const std::array<hsize_t, 2> block{{num_rows, 1}};
+    const std::array<hsize_t, 2> block{
+        {num_rows, static_cast<hsize_t>(run_end - run_start)}};
 
     CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_OR, start.data(),
                                  stride.data(), count.data(), block.data()),
-             "Failed to select column " << column);
+             "Failed to select columns " << these_columns[run_start] << " to "
+                                         << these_columns[run_end - 1]);
+    run_start = run_end;
   }
 
   std::vector<double> raw_data(num_rows * num_cols);
@@ -937,6 +1064,14 @@ GENERATE_INSTANTIATIONS(INSTANTIATE_WRITE_DATA,
                         (float, double, int, unsigned int, long, unsigned long,
                          long long, unsigned long long, char))
 
+#define INSTANTIATE_WRITE_LOSSY_DATA(_, DATA)                       \
+  template void write_data<TYPE(DATA)>(                            \
+      const hid_t group_id, const std::vector<TYPE(DATA)>& data,   \
+      const std::string& name, const LossyCompression& compression, \
+      bool overwrite_existing);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_WRITE_LOSSY_DATA, (float, double))
+
 #define INSTANTIATE_ATTRIBUTE(_, DATA)                                    \
   template void write_to_attribute<TYPE(DATA)>(                           \
       const hid_t group_id, const std::string& name,                      \
@@ -1027,6 +1162,7 @@ GENERATE_INSTANTIATIONS(INSTANTIATE_READ_DATAVECTOR, (DataVector), (1, 2, 3))
 
 #undef INSTANTIATE_ATTRIBUTE
 #undef INSTANTIATE_WRITE_DATA
+#undef INSTANTIATE_WRITE_LOSSY_DATA
 #undef INSTANTIATE_READ_SCALAR
 #undef INSTANTIATE_READ_VECTOR
 #undef INSTANTIATE_READ_MULTIARRAY
@@ -17,6 +17,9 @@
 /// \cond
 class DataVector;
 class Matrix;
+namespace h5 {
+struct LossyCompression;
+}  // namespace h5
 /// \endcond
 
 namespace h5 {
@@ -36,6 +39,20 @@ void write_data(hid_t group_id, const std::vector<T>& data,
                 const std::string& name = "scalar",
                 const bool overwrite_existing = false);
 
+/*!
+ * \ingroup HDF5Group
+ * \brief Write the 1D `data` named `name` to the group `group_id`, compressed
+ * lossily with `compression`.
+ *
+ * The dataset is chunked like the ones written by the overload above, so it
+ * can be read back with the same functions. The `compression` is recorded in
+ * the string attribute `lossy_compression` of the dataset.
+ */
+template <typename T>
+void write_data(hid_t group_id, const std::vector<T>& data,
+                const std::string& name, const LossyCompression& compression,
+                bool overwrite_existing = false);
+
 /*!
  * \ingroup HDF5Group
  * \brief Write a DataVector named `name` to the group `group_id`
@@ -0,0 +1,148 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/LossyCompression.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <type_traits>
+
+#include "Options/Context.hpp"
+#include "Options/Options.hpp"
+#include "Options/ParseError.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
+
+namespace h5 {
+std::ostream& operator<<(std::ostream& os, const LossyCompressionMethod t) {
+  switch (t) {
+    case LossyCompressionMethod::BitRounding:
+      return os << "BitRounding";
+    case LossyCompressionMethod::Zfp:
+      return os << "Zfp";
+    default:
+      ERROR("Unknown lossy compression method, must be BitRounding or Zfp");
+  }
+}
+
+LossyCompression::LossyCompression(
+    const LossyCompressionMethod method_in,
+    const std::optional<double> absolute_error_in,
+    const std::optional<double> relative_error_in,
+    const Options::Context& context)
+    : method(method_in),
+      absolute_error(absolute_error_in),
+      relative_error(relative_error_in) {
+  if (absolute_error.has_value() == relative_error.has_value()) {
+    PARSE_ERROR(context,
+                "Specify exactly one of 'AbsoluteError' and 'RelativeError'.");
+  }
+  if (absolute_error.value_or(1.0) <= 0.0 or
+      relative_error.value_or(1.0) <= 0.0) {
+    PARSE_ERROR(context, "The error bound must be positive.");
+  }
+  if (method == LossyCompressionMethod::BitRounding and
+      absolute_error.has_value()) {
+    PARSE_ERROR(context,
+                "BitRounding only supports a 'RelativeError'. Use 'Zfp' for "
+                "an absolute error bound.");
+  }
+}
+
+void LossyCompression::pup(PUP::er& p) {
+  p | method;
+  p | absolute_error;
+  p | relative_error;
+}
+
+bool operator==(const LossyCompression& lhs, const LossyCompression& rhs) {
+  return lhs.method == rhs.method and
+         lhs.absolute_error == rhs.absolute_error and
+         lhs.relative_error == rhs.relative_error;
+}
+
+bool operator!=(const LossyCompression& lhs, const LossyCompression& rhs) {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const LossyCompression& t) {
+  os << t.method << "(";
+  if (t.absolute_error.has_value()) {
+    os << "AbsoluteError=" << *t.absolute_error;
+  } else if (t.relative_error.has_value()) {
+    os << "RelativeError=" << *t.relative_error;
+  }
+  return os << ")";
+}
+
+namespace detail {
+template <typename T>
+T round_mantissa(const T value, const double relative_error) {
+  using UInt = std::conditional_t<std::is_same_v<T, float>, uint32_t, uint64_t>;
+  constexpr int mantissa_bits = std::numeric_limits<T>::digits - 1;
+  if (not std::isfinite(value) or relative_error >= 1.0) {
+    return value;
+  }
+  // Rounding to nearest with `k` mantissa bits has a relative error of at most
+  // 2^-(k+1).
+  const int bits_to_keep =
+      std::clamp(static_cast<int>(std::ceil(-std::log2(relative_error))) - 1, 0,
+                 mantissa_bits);
+  if (bits_to_keep == mantissa_bits) {
+    return value;
+  }
+  const int bits_to_drop = mantissa_bits - bits_to_keep;
+  UInt bits{};
+  std::memcpy(&bits, &value, sizeof(T));
+  const UInt half_of_dropped = UInt{1} << (bits_to_drop - 1);
+  const UInt mask = ~((UInt{1} << bits_to_drop) - 1);
+  // A carry out of the mantissa correctly increments the exponent
+  const UInt rounded_bits = (bits + half_of_dropped) & mask;
+  T result{};
+  std::memcpy(&result, &rounded_bits, sizeof(T));
+  // Don't round the largest finite values to infinity
+  return std::isfinite(result) ? result : value;
+}
+}  // namespace detail
+
+#define TYPE(DATA) BOOST_PP_TUPLE_ELEM(0, DATA)
+
+#define INSTANTIATE(_, DATA)                               \
+  template TYPE(DATA) detail::round_mantissa<TYPE(DATA)>( \
+      TYPE(DATA) value, double relative_error);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (float, double))
+
+#undef INSTANTIATE
+#undef TYPE
+}  // namespace h5
+
+template <>
+h5::LossyCompressionMethod
+Options::create_from_yaml<h5::LossyCompressionMethod>::create<void>(
+    const Options::Option& options) {
+  const auto type_read = options.parse_as<std::string>();
+  if (type_read == get_output(h5::LossyCompressionMethod::BitRounding)) {
+    return h5::LossyCompressionMethod::BitRounding;
+  } else if (type_read == get_output(h5::LossyCompressionMethod::Zfp)) {
+    return h5::LossyCompressionMethod::Zfp;
+  }
+  PARSE_ERROR(options.context(),
+              "Failed to convert \""
+                  << type_read
+                  << "\" to LossyCompressionMethod. Must be one of '"
+                  << get_output(h5::LossyCompressionMethod::BitRounding)
+                  << "' or '" << get_output(h5::LossyCompressionMethod::Zfp)
+                  << "'.");
+}
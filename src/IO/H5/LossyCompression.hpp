@@ -0,0 +1,114 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <iosfwd>
+#include <optional>
+
+#include "Options/Auto.hpp"
+#include "Options/String.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Options {
+struct Context;
+class Option;
+template <typename T>
+struct create_from_yaml;
+}  // namespace Options
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief Algorithm used to compress floating point data lossily.
+ *
+ * - `BitRounding`: Rounds the mantissa of each value to the fewest bits that
+ *   satisfy a relative error bound and zeroes the remaining bits. The data is
+ *   then written with the usual lossless gzip and shuffle filters, which
+ *   compress the zeroed bits well. This needs no HDF5 plugin and any HDF5
+ *   reader can read the data.
+ * - `Zfp`: The ZFP compressor in fixed-accuracy mode, which guarantees an
+ *   absolute error bound. This needs the H5Z-ZFP filter plugin (HDF5 filter
+ *   ID 32013) to be found on the `HDF5_PLUGIN_PATH` both when writing and when
+ *   reading the data.
+ */
+enum class LossyCompressionMethod { BitRounding, Zfp };
+
+std::ostream& operator<<(std::ostream& os, LossyCompressionMethod t);
+
+/*!
+ * \ingroup HDF5Group
+ * \brief A lossy compression algorithm and the error bound it must satisfy.
+ *
+ * Exactly one of the `AbsoluteError` and `RelativeError` must be specified.
+ * `BitRounding` only supports a relative error bound. For `Zfp` a relative
+ * error bound is converted to an absolute one by multiplying with the largest
+ * magnitude in the dataset being written.
+ */
+struct LossyCompression {
+  struct Method {
+    using type = LossyCompressionMethod;
+    static constexpr Options::String help = {
+        "Compression algorithm: 'BitRounding' or 'Zfp'."};
+  };
+  struct AbsoluteError {
+    using type = Options::Auto<double, Options::AutoLabel::None>;
+    static constexpr Options::String help = {
+        "Maximum absolute error of each value."};
+  };
+  struct RelativeError {
+    using type = Options::Auto<double, Options::AutoLabel::None>;
+    static constexpr Options::String help = {
+        "Maximum error of each value relative to its magnitude for "
+        "'BitRounding', or relative to the largest magnitude in the dataset "
+        "for 'Zfp'."};
+  };
+
+  using options = tmpl::list<Method, AbsoluteError, RelativeError>;
+  static constexpr Options::String help = {
+      "Lossy compression of volume data with a bound on the error."};
+
+  LossyCompression() = default;
+  LossyCompression(LossyCompressionMethod method_in,
+                   std::optional<double> absolute_error_in,
+                   std::optional<double> relative_error_in,
+                   const Options::Context& context = {});
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+  LossyCompressionMethod method{LossyCompressionMethod::BitRounding};
+  std::optional<double> absolute_error{};
+  std::optional<double> relative_error{};
+};
+
+bool operator==(const LossyCompression& lhs, const LossyCompression& rhs);
+bool operator!=(const LossyCompression& lhs, const LossyCompression& rhs);
+
+std::ostream& operator<<(std::ostream& os, const LossyCompression& t);
+
+namespace detail {
+/// Round the mantissa of `value` to nearest so that the relative error is at
+/// most `relative_error`, and zero the bits that are not needed.
+template <typename T>
+T round_mantissa(T value, double relative_error);
+}  // namespace detail
+}  // namespace h5
+
+template <>
+struct Options::create_from_yaml<h5::LossyCompressionMethod> {
+  template <typename Metavariables>
+  static h5::LossyCompressionMethod create(const Options::Option& options) {
+    return create<void>(options);
+  }
+};
+
+template <>
+h5::LossyCompressionMethod
+Options::create_from_yaml<h5::LossyCompressionMethod>::create<void>(
+    const Options::Option& options);
@@ -55,7 +55,12 @@ combine_h5_command.add_command(combine_h5_dat_command, name="dat")
         " checked, False implies no src files to check."
     ),
 )
-def combine_h5_vol_command(h5files, subfile_name, output, check_src):
+@click.option(
+    "--verbose",
+    is_flag=True,
+    help="Print the output file and every tensor component as it is combined.",
+)
+def combine_h5_vol_command(h5files, subfile_name, output, check_src, verbose):
     """Combines volume data spread over multiple H5 files into a single file
 
     The typical use case is to combine volume data from multiple nodes into a
@@ -82,7 +87,7 @@ def combine_h5_vol_command(h5files, subfile_name, output, check_src):
     if not output.endswith(".h5"):
         output += ".h5"
 
-    spectre_h5.combine_h5(h5files, subfile_name, output, check_src)
+    spectre_h5.combine_h5(h5files, subfile_name, output, check_src, verbose)
 
 
 if __name__ == "__main__":
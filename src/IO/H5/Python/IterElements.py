@@ -1,10 +1,13 @@
 # Distributed under the MIT License.
 # See LICENSE.txt for details.
 
+import collections
 import fnmatch
+import os
+from concurrent.futures import ThreadPoolExecutor
 from dataclasses import dataclass
 from functools import cached_property
-from typing import Dict, Iterable, Optional, Sequence, Union
+from typing import Any, Callable, Dict, Iterable, Optional, Sequence, Union
 
 import numpy as np
 
@@ -118,6 +121,7 @@ def iter_elements(
     obs_ids: Optional[Union[int, Sequence[int]]],
     tensor_components: Optional[Iterable[str]] = None,
     element_patterns: Optional[Sequence[str]] = None,
+    max_points_per_read: Optional[int] = None,
 ):
     """Return volume data by element
 
@@ -129,12 +133,19 @@ def iter_elements(
       tensor_components: Tensor components to retrieve. Can be empty.
       element_patterns: If specified, include only elements that match any of
         these glob patterns. See 'IterElements.include_element' for details.
+      max_points_per_read: The tensor data of consecutive elements in a file
+        is read in chunks of at most this many points (but at least one
+        element), and only for the selected elements. Set to limit memory
+        usage for large files. If None (default), the data of all selected
+        elements at an observation is read at once.
 
     Returns: Iterator over all elements in all 'volfiles'. Yields either just
       the 'Element' with structural information if 'tensor_components' is
       empty, or both the 'Element' and an 'np.ndarray' with the tensor data
       listed in 'tensor_components'. The tensor data has shape
-      `(len(tensor_components), num_points)`.
+      `(len(tensor_components), num_points)` and is a view into the chunk of
+      data read from the file, so it remains valid after the iteration
+      continues.
     """
     if isinstance(volfiles, spectre_h5.H5Vol):
         volfiles = [volfiles]
@@ -157,27 +168,34 @@ def iter_elements(
             # if the volfile doesn't contain any of the requested elements
             all_grid_names = volfile.get_grid_names(obs_id)
             if element_patterns is not None:
-                grid_names = [
-                    grid_name
-                    for grid_name in all_grid_names
+                selected = [
+                    i
+                    for i, grid_name in enumerate(all_grid_names)
                     if include_element(grid_name, element_patterns)
                 ]
             else:
-                grid_names = all_grid_names
-            if not grid_names:
+                selected = list(range(len(all_grid_names)))
+            if not selected:
                 continue
-            element_ids = [ElementId[dim](name) for name in grid_names]
+            element_ids = [
+                ElementId[dim](all_grid_names[i]) for i in selected
+            ]
             # Reconstruct meshes
             all_extents = volfile.get_extents(obs_id)
             all_bases = volfile.get_bases(obs_id)
             all_quadratures = volfile.get_quadratures(obs_id)
             meshes = [
-                Mesh[dim](extents, bases, quadratures)
-                for grid_name, extents, bases, quadratures in zip(
-                    all_grid_names, all_extents, all_bases, all_quadratures
-                )
-                if grid_name in grid_names
+                Mesh[dim](all_extents[i], all_bases[i], all_quadratures[i])
+                for i in selected
             ]
+            # The data of the grids is stored contiguously in the order of the
+            # grid names
+            all_lengths = [int(np.prod(extents)) for extents in all_extents]
+            all_offsets = np.cumsum([0] + all_lengths[:-1])
+            offsets_and_lengths = [
+                (int(all_offsets[i]), all_lengths[i]) for i in selected
+            ]
+            num_points = sum(all_lengths)
             # Deserialize domain and functions of time
             if not domain:
                 serialized_domain = volfile.get_domain(obs_id)
@@ -190,36 +208,133 @@ def iter_elements(
                 )
             else:
                 functions_of_time = None
-            # Pre-load the tensor data because it's stored contiguously for all
-            # grids in the file
-            if tensor_components:
-                tensor_data = np.asarray(
-                    [
-                        volfile.get_tensor_component(obs_id, component).data
-                        for component in tensor_components
-                    ]
-                )
-            # Iterate elements in this file
-            for grid_name, element_id, mesh in zip(
-                grid_names, element_ids, meshes
-            ):
-                offset, length = spectre_h5.offset_and_length_for_grid(
-                    grid_name, all_grid_names, all_extents
-                )
-                data_slice = slice(offset, offset + length)
-                if domain:
-                    element_map = ElementMap(element_id, domain)
-                else:
-                    element_map = None
-                element = Element(
-                    element_id,
-                    mesh=mesh,
-                    map=element_map,
-                    time=time,
-                    functions_of_time=functions_of_time,
-                    data_slice=data_slice,
-                )
+            # Iterate elements in this file, reading the tensor data of
+            # consecutive elements in large chunks because it's stored
+            # contiguously for all grids in the file
+            for chunk in _chunks(offsets_and_lengths, max_points_per_read):
                 if tensor_components:
-                    yield element, tensor_data[:, offset : offset + length]
-                else:
-                    yield element
+                    tensor_data = _read_tensor_data(
+                        volfile,
+                        obs_id,
+                        tensor_components,
+                        [offsets_and_lengths[i] for i in chunk],
+                        num_points,
+                    )
+                chunk_offset = 0
+                for i in chunk:
+                    element_id = element_ids[i]
+                    offset, length = offsets_and_lengths[i]
+                    if domain:
+                        element_map = ElementMap(element_id, domain)
+                    else:
+                        element_map = None
+                    element = Element(
+                        element_id,
+                        mesh=meshes[i],
+                        map=element_map,
+                        time=time,
+                        functions_of_time=functions_of_time,
+                        data_slice=slice(offset, offset + length),
+                    )
+                    if tensor_components:
+                        yield element, tensor_data[
+                            :, chunk_offset : chunk_offset + length
+                        ]
+                    else:
+                        yield element
+                    chunk_offset += length
+
+
+def _chunks(offsets_and_lengths, max_points_per_read):
+    """Split the indices of the elements into chunks of consecutive elements
+    with at most 'max_points_per_read' points, but at least one element"""
+    if max_points_per_read is None:
+        return [list(range(len(offsets_and_lengths)))]
+    chunks = []
+    chunk = []
+    chunk_size = 0
+    for i, (_, length) in enumerate(offsets_and_lengths):
+        if chunk and chunk_size + length > max_points_per_read:
+            chunks.append(chunk)
+            chunk = []
+            chunk_size = 0
+        chunk.append(i)
+        chunk_size += length
+    if chunk:
+        chunks.append(chunk)
+    return chunks
+
+
+def _read_tensor_data(
+    volfile, obs_id, tensor_components, offsets_and_lengths, num_points
+):
+    """Read the tensor components at the 'offsets_and_lengths' into a single
+    array of shape '(len(tensor_components), total_length)'
+
+    Only the requested parts of the datasets are read from disk. The data is
+    read directly into the array to avoid copying it.
+    """
+    total_length = sum(length for _, length in offsets_and_lengths)
+    tensor_data = np.empty(
+        (len(tensor_components), total_length), dtype=np.float64
+    )
+    for i, component in enumerate(tensor_components):
+        if total_length == num_points:
+            volfile.read_tensor_component(tensor_data[i], obs_id, component)
+        else:
+            volfile.read_tensor_component(
+                tensor_data[i], obs_id, component, offsets_and_lengths
+            )
+    return tensor_data
+
+
+def map_elements(
+    kernel: Callable[..., Any],
+    volfiles: Union[spectre_h5.H5Vol, Iterable[spectre_h5.H5Vol]],
+    obs_ids: Optional[Union[int, Sequence[int]]],
+    tensor_components: Optional[Iterable[str]] = None,
+    element_patterns: Optional[Sequence[str]] = None,
+    max_points_per_read: Optional[int] = None,
+    num_threads: Optional[int] = None,
+):
+    """Apply the 'kernel' to all elements on worker threads
+
+    The elements and their tensor data are read as in 'iter_elements' on the
+    calling thread, since the H5 files can't be read concurrently, and the
+    'kernel' is called on a pool of 'num_threads' worker threads. This speeds
+    up kernels that spend most of their time in code that releases the GIL,
+    such as NumPy operations on the tensor data. Only a few elements per thread
+    are read ahead of the kernels, so memory usage stays bounded.
+
+    Arguments:
+      kernel: Called as 'kernel(element, tensor_data)' for each element, or as
+        'kernel(element)' if 'tensor_components' is empty. Must not modify the
+        'tensor_data' of other elements, since it is a view into the chunk of
+        data that was read from the file.
+      num_threads: Number of worker threads. Defaults to the number of CPUs.
+
+    See 'iter_elements' for the other arguments.
+
+    Returns: Iterator over the return values of the 'kernel', in the order of
+      the elements.
+    """
+    if num_threads is None:
+        num_threads = os.cpu_count() or 1
+    max_pending = 2 * num_threads
+    with ThreadPoolExecutor(max_workers=num_threads) as executor:
+        pending = collections.deque()
+        for element_and_data in iter_elements(
+            volfiles,
+            obs_ids,
+            tensor_components=tensor_components,
+            element_patterns=element_patterns,
+            max_points_per_read=max_points_per_read,
+        ):
+            if tensor_components:
+                pending.append(executor.submit(kernel, *element_and_data))
+            else:
+                pending.append(executor.submit(kernel, element_and_data))
+            if len(pending) >= max_pending:
+                yield pending.popleft().result()
+        while pending:
+            yield pending.popleft().result()
@@ -3,13 +3,19 @@
 
 #include "IO/H5/Python/VolumeData.hpp"
 
+#include <cstddef>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace py = pybind11;
 
@@ -38,8 +44,52 @@ void bind_h5vol(py::module& m) {
            py::arg("observation_id"))
       .def("list_tensor_components", &h5::VolumeData::list_tensor_components,
            py::arg("observation_id"))
-      .def("get_tensor_component", &h5::VolumeData::get_tensor_component,
+      .def("get_tensor_component",
+           py::overload_cast<size_t, const std::string&>(
+               &h5::VolumeData::get_tensor_component, py::const_),
            py::arg("observation_id"), py::arg("tensor_component"))
+      .def(
+          "read_tensor_component",
+          [](const h5::VolumeData& volume_data,
+             py::array_t<double, py::array::c_style> buffer,
+             const size_t observation_id, const std::string& tensor_component) {
+            if (buffer.ndim() != 1) {
+              throw std::runtime_error(
+                  "The buffer must be a one-dimensional array.");
+            }
+            volume_data.read_tensor_component(
+                gsl::make_span(buffer.mutable_data(),
+                               static_cast<size_t>(buffer.size())),
+                observation_id, tensor_component);
+          },
+          // Don't convert the buffer, since the data would be read into a
+          // temporary copy
+          py::arg("buffer").noconvert(), py::arg("observation_id"),
+          py::arg("tensor_component"),
+          "Read the tensor component into the preallocated contiguous "
+          "float64 array `buffer` without intermediate copies.")
+      .def(
+          "read_tensor_component",
+          [](const h5::VolumeData& volume_data,
+             py::array_t<double, py::array::c_style> buffer,
+             const size_t observation_id, const std::string& tensor_component,
+             const std::vector<std::pair<size_t, size_t>>&
+                 offsets_and_lengths) {
+            if (buffer.ndim() != 1) {
+              throw std::runtime_error(
+                  "The buffer must be a one-dimensional array.");
+            }
+            volume_data.read_tensor_component(
+                gsl::make_span(buffer.mutable_data(),
+                               static_cast<size_t>(buffer.size())),
+                observation_id, tensor_component, offsets_and_lengths);
+          },
+          py::arg("buffer").noconvert(), py::arg("observation_id"),
+          py::arg("tensor_component"), py::arg("offsets_and_lengths"),
+          "Read the points [offset, offset + length) for each of the sorted "
+          "'offsets_and_lengths' of the tensor component, concatenated, into "
+          "the preallocated contiguous float64 array `buffer`. Only the "
+          "requested parts of the dataset are read from disk.")
       .def("get_extents", &h5::VolumeData::get_extents,
            py::arg("observation_id"))
       .def("get_quadratures", &h5::VolumeData::get_quadratures,
@@ -4,23 +4,93 @@
 #include "IO/H5/SourceArchive.hpp"
 
 #include <algorithm>
+#include <cerrno>
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "IO/H5/Helpers.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/FileSystem.hpp"
 #include "Utilities/Formaline.hpp"
 
 namespace h5 {
+namespace {
+const std::string archive_file_attribute_name{"SourceArchiveFile"};
+
+// Copying the archive out of the executable is only done once per process.
+const std::vector<char>& executable_archive() {
+  static const std::vector<char> archive = formaline::get_archive();
+  return archive;
+}
+
+// The file the archive of this executable is stored in, named by a hash of
+// the archive so executables built from different sources don't share it.
+// Written only once, even if several processes share the directory.
+std::string external_archive_file(const std::string& directory) {
+  static std::mutex mutex{};
+  const std::lock_guard lock(mutex);
+  const auto& archive = executable_archive();
+  std::ostringstream file_name{};
+  file_name << file_system::get_absolute_path(directory) << "/SourceArchive_"
+            << std::hex
+            << std::hash<std::string_view>{}(
+                   std::string_view{archive.data(), archive.size()})
+            << SourceArchive::extension();
+  const std::string result = file_name.str();
+  // Opening with "x" fails if the file exists, so only one process writes it
+  if (std::FILE* outfile = std::fopen(result.c_str(), "wx");
+      outfile != nullptr) {
+    std::fwrite(archive.data(), sizeof(char), archive.size(), outfile);
+    std::fclose(outfile);
+  } else if (errno != EEXIST) {
+    ERROR("Failed to create the source archive file '" << result << "'");
+  }
+  return result;
+}
+
+std::vector<char> read_external_archive(const std::string& file_name) {
+  std::FILE* infile = std::fopen(file_name.c_str(), "rb");
+  if (infile == nullptr) {
+    ERROR("Failed to open the source archive file '" << file_name << "'");
+  }
+  std::vector<char> archive(file_system::file_size(file_name));
+  const size_t read_size =
+      std::fread(archive.data(), sizeof(char), archive.size(), infile);
+  std::fclose(infile);
+  if (read_size != archive.size()) {
+    ERROR("Failed to read the source archive file '" << file_name << "'");
+  }
+  return archive;
+}
+}  // namespace
+
 SourceArchive::SourceArchive(const bool exists, detail::OpenGroup&& group,
                              const hid_t location, const std::string& name)
     : group_(std::move(group)),
       path_(group_.group_path_with_trailing_slash() + name) {
   if (exists) {
-    source_archive_ =
-        read_data<1, std::vector<char>>(location, name + extension());
+    if (contains_attribute(location, "", archive_file_attribute_name)) {
+      source_archive_ = read_external_archive(read_value_attribute<std::string>(
+          location, archive_file_attribute_name));
+    } else {
+      source_archive_ =
+          read_data<1, std::vector<char>>(location, name + extension());
+    }
+  } else if (const char* const directory =
+                 std::getenv("SPECTRE_SOURCE_ARCHIVE_DIRECTORY");
+             directory != nullptr and not std::string{directory}.empty()) {
+    source_archive_ = executable_archive();
+    write_to_attribute<std::string>(location, archive_file_attribute_name,
+                                    {{external_archive_file(directory)}});
   } else {
-    source_archive_ = formaline::get_archive();
+    source_archive_ = executable_archive();
     write_data(location, source_archive_, {source_archive_.size()},
                name + extension());
   }
@@ -14,6 +14,15 @@ namespace h5 {
 /*!
  * \ingroup HDF5Group
  * \brief Writes an archive of the source tree into a dataset.
+ *
+ * \details Every H5 file created by an executable gets the same archive. To
+ * store it only once, set the environment variable
+ * `SPECTRE_SOURCE_ARCHIVE_DIRECTORY` to a directory that all processes can
+ * write to. New files then reference the file
+ * `SourceArchive_<hash>.tar.gz` in that directory instead of embedding the
+ * archive, and the first process to need the file writes it. The archive of
+ * an existing file is read from wherever it is stored, so the referenced file
+ * must be kept with the H5 files.
  */
 class SourceArchive : public h5::Object {
  public:
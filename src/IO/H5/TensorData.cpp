@@ -32,6 +32,7 @@ TensorComponent::TensorComponent(std::string in_name,
 void TensorComponent::pup(PUP::er& p) {
   p | name;
   p | data;
+  p | compression;
 }
 
 std::ostream& operator<<(std::ostream& os, const TensorComponent& t) {
@@ -47,7 +48,8 @@ std::ostream& operator<<(std::ostream& os, const TensorComponent& t) {
 }
 
 bool operator==(const TensorComponent& lhs, const TensorComponent& rhs) {
-  return lhs.name == rhs.name and lhs.data == rhs.data;
+  return lhs.name == rhs.name and lhs.data == rhs.data and
+         lhs.compression == rhs.compression;
 }
 
 bool operator!=(const TensorComponent& lhs, const TensorComponent& rhs) {
@@ -5,12 +5,14 @@
 
 #include <cstddef>
 #include <iosfwd>
+#include <optional>
 #include <string>
 #include <utility>
 #include <variant>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "IO/H5/LossyCompression.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Utilities/GetOutput.hpp"
@@ -31,6 +33,9 @@ struct Mesh;
  *
  * The name should be just the name of the tensor component, such as 'Psi_xx'.
  * It must not include any slashes ('/').
+ *
+ * If `compression` is set, the component is compressed lossily when it is
+ * written to disk. It must be the same for all elements.
  */
 struct TensorComponent {
   TensorComponent() = default;
@@ -41,6 +46,7 @@ struct TensorComponent {
   void pup(PUP::er& p);
   std::string name{};
   std::variant<DataVector, std::vector<float>> data{};
+  std::optional<h5::LossyCompression> compression{};
 };
 
 std::ostream& operator<<(std::ostream& os, const TensorComponent& t);
@@ -13,18 +13,21 @@
 #include <optional>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
-#include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/ExtendConnectivityHelpers.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
+#include "IO/H5/LossyCompression.hpp"
 #include "IO/H5/SpectralIo.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/Type.hpp"
 #include "IO/H5/Version.hpp"
+#include "IO/H5/Wrappers.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
@@ -44,106 +47,45 @@
 
 namespace h5 {
 namespace {
-// Append the element extents and connectivity to the total extents and
-// connectivity
-void append_element_extents_and_connectivity(
-    const gsl::not_null<std::vector<size_t>*> total_extents,
-    const gsl::not_null<std::vector<int>*> total_connectivity,
-    const gsl::not_null<std::vector<int>*> pole_connectivity,
-    const gsl::not_null<int*> total_points_so_far, const size_t dim,
-    const ElementVolumeData& element) {
-  // Process the element extents
-  const auto& extents = element.extents;
-  ASSERT(alg::none_of(extents, [](const size_t extent) { return extent == 1; }),
-         "We cannot generate connectivity for any single grid point elements.");
-  if (extents.size() != dim) {
-    ERROR("Trying to write data of dimensionality"
-          << extents.size() << "but the VolumeData file has dimensionality"
-          << dim << ".");
-  }
-  total_extents->insert(total_extents->end(), extents.begin(), extents.end());
-  // Find the number of points in the local connectivity
-  const int element_num_points =
-      alg::accumulate(extents, 1, std::multiplies<>{});
-  // Generate the connectivity data for the element
-  // Possible optimization: local_connectivity.reserve(BLAH) if we can figure
-  // out size without computing all the connectivities.
-  const std::vector<int> connectivity = [&extents, &total_points_so_far]() {
-    std::vector<int> local_connectivity;
-    for (const auto& cell : vis::detail::compute_cells(extents)) {
-      for (const auto& bounding_indices : cell.bounding_indices) {
-        local_connectivity.emplace_back(*total_points_so_far +
-                                        static_cast<int>(bounding_indices));
-      }
-    }
-    return local_connectivity;
-  }();
-  *total_points_so_far += element_num_points;
-  total_connectivity->insert(total_connectivity->end(), connectivity.begin(),
-                             connectivity.end());
-
-  // If element is 2D and the bases are both SphericalHarmonic,
-  // then add extra connections to close the surface.
-  if (dim == 2) {
-    if (not(element.basis[0] == Spectral::Basis::SphericalHarmonic and
-            element.basis[1] == Spectral::Basis::SphericalHarmonic)) {
-      return;
-    }
-    // Extents are (l+1, 2l+1)
-    const int l = static_cast<int>(element.extents[0] - 1);
-
-    // Connect max(phi) and min(phi) by adding more quads
-    // to total_connectivity
-    for (int j = 0; j < l; ++j) {
-      total_connectivity->push_back(j);
-      total_connectivity->push_back(j + 1);
-      total_connectivity->push_back(2 * l * (l + 1) + j + 1);
-      total_connectivity->push_back((2 * l) * (l + 1) + j);
+// Select the union of the hyperslabs `[offset, offset + length)` of the
+// one-dimensional dataspace and return the total number of selected points.
+// HDF5 reads the selection in the order of the file, so the hyperslabs must be
+// sorted.
+size_t select_hyperslabs(
+    const hid_t dataspace_id, const std::string& tensor_component,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) {
+  hsize_t size = 0;
+  H5Sget_simple_extent_dims(dataspace_id, &size, nullptr);
+  CHECK_H5(H5Sselect_none(dataspace_id),
+           "Failed to select none of the dataspace");
+  size_t total_length = 0;
+  size_t previous_end = 0;
+  for (const auto& [offset, length] : offsets_and_lengths) {
+    ASSERT(offset >= previous_end,
+           "The offsets and lengths must be sorted by offset and must not "
+           "overlap, but the hyperslab at offset "
+               << offset << " starts before the end of the previous one at "
+               << previous_end << ".");
+    if (offset + length > size) {
+      ERROR("Can't read points [" << offset << ", " << offset + length
+                                  << ") of the tensor component '"
+                                  << tensor_component << "' with only " << size
+                                  << " points.");
     }
-
-    // Add a new connectivity output for filling the poles
-    // First, get the points at min(theta), which define the
-    // boundary of the top pole to fill, and the points at
-    // max(theta), which define the boundary of the bottom
-    // pole to fill. Note: points are stored with theta
-    // varying faster than phi.
-    std::vector<int> top_pole_points{};
-    std::vector<int> bottom_pole_points{};
-    for (int k = 0; k < (2 * l + 1); ++k) {
-      top_pole_points.push_back(k * (l + 1));
-      bottom_pole_points.push_back(k * (l + 1) + l);
-    }
-
-    const size_t number_of_pole_points = top_pole_points.size();
-    if (number_of_pole_points < 3) {
-      ERROR_NO_TRACE(
-          "Cannot write a 2D surface to file with l=0. Must have at least "
-          "l=1.");
-    }
-
-    // Fill poles with triangles in a fan pattern. Choose the root point that is
-    // common with all triangles to be the first point for each pole
-    const int top_root_point = top_pole_points[0];
-    const int bottom_root_point = bottom_pole_points[0];
-
-    // We end such that the last triangle we make has indices (0, N-2, N-1)
-    // given number_of_pole_points = N
-    for (size_t i = 1; i <= number_of_pole_points - 2; i++) {
-      int top_second_point = gsl::at(top_pole_points, i);
-      int top_third_point = gsl::at(top_pole_points, i + 1);
-      int bottom_second_point = gsl::at(bottom_pole_points, i);
-      int bottom_third_point = gsl::at(bottom_pole_points, i + 1);
-
-      pole_connectivity->push_back(top_root_point);
-      pole_connectivity->push_back(top_second_point);
-      pole_connectivity->push_back(top_third_point);
-      pole_connectivity->push_back(bottom_root_point);
-      pole_connectivity->push_back(bottom_second_point);
-      pole_connectivity->push_back(bottom_third_point);
+    previous_end = offset + length;
+    if (length == 0) {
+      continue;
     }
+    const hsize_t start = offset;
+    const hsize_t count = length;
+    CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_OR, &start, nullptr,
+                                 &count, nullptr),
+             "Failed to select points [" << offset << ", " << offset + length
+                                         << ")");
+    total_length += length;
   }
+  return total_length;
 }
-
 }  // namespace
 
 VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
@@ -271,7 +213,7 @@ void VolumeData::write_volume_data(
                                return static_cast<int>(t);
                              });
 
-              append_element_extents_and_connectivity(
+              detail::append_element_extents_and_connectivity(
                   &total_extents, &total_connectivity, &pole_connectivity,
                   &total_points_so_far, dim, element);
             }
@@ -291,8 +233,16 @@ void VolumeData::write_volume_data(
                 std::get<type_from_variant>(tensor_component.data).begin(),
                 std::get<type_from_variant>(tensor_component.data).end());
           }  // for each element
-          h5::write_data(observation_group.id(), *contiguous_tensor_data_ptr,
-                         {contiguous_tensor_data_ptr->size()}, component_name);
+          const auto& compression =
+              elements[0].tensor_components[i].compression;
+          if (compression.has_value()) {
+            h5::write_data(observation_group.id(), *contiguous_tensor_data_ptr,
+                           component_name, *compression);
+          } else {
+            h5::write_data(observation_group.id(), *contiguous_tensor_data_ptr,
+                           {contiguous_tensor_data_ptr->size()},
+                           component_name);
+          }
         };
 
     if (elements[0].tensor_components[i].data.index() == 0) {
@@ -504,6 +454,127 @@ TensorComponent VolumeData::get_tensor_component(
   }
 }
 
+TensorComponent VolumeData::get_tensor_component(
+    const size_t observation_id, const std::string& tensor_component,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) const {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+
+  const hid_t dataset_id =
+      h5::open_dataset(observation_group.id(), tensor_component);
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  const int rank = H5Sget_simple_extent_ndims(dataspace_id);
+  if (rank != 1) {
+    ERROR("Can only read a subset of one-dimensional tensor components, but '"
+          << tensor_component << "' has rank " << rank << ".");
+  }
+  const size_t total_length = select_hyperslabs(
+      dataspace_id, tensor_component, offsets_and_lengths);
+
+  const hid_t datatype_id = H5Dget_type(dataset_id);
+  CHECK_H5(datatype_id, "Failed to get the type of the dataset");
+  const bool use_float = h5::types_equal(datatype_id, h5::h5_type<float>());
+  CHECK_H5(H5Tclose(datatype_id), "Failed to close the datatype");
+
+  const auto read_selection = [&dataset_id, &dataspace_id, &tensor_component,
+                               &total_length](auto data) {
+    if (total_length > 0) {
+      const hsize_t memspace_size = total_length;
+      const hid_t memspace_id =
+          H5Screate_simple(1, &memspace_size, &memspace_size);
+      CHECK_H5(memspace_id, "Failed to create memory space");
+      CHECK_H5(H5Dread(dataset_id,
+                       h5::h5_type<typename decltype(data)::value_type>(),
+                       memspace_id, dataspace_id, h5::h5p_default(),
+                       data.data()),
+               "Failed to read a subset of the dataset '" << tensor_component
+                                                          << "'");
+      CHECK_H5(H5Sclose(memspace_id), "Failed to close memory space");
+    }
+    return data;
+  };
+  TensorComponent result =
+      use_float ? TensorComponent{tensor_component,
+                                  read_selection(
+                                      std::vector<float>(total_length))}
+                : TensorComponent{tensor_component,
+                                  read_selection(DataVector(total_length))};
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+  return result;
+}
+
+void VolumeData::read_tensor_component(
+    const gsl::span<double> buffer, const size_t observation_id,
+    const std::string& tensor_component) const {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+  const hid_t dataset_id =
+      h5::open_dataset(observation_group.id(), tensor_component);
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  const int rank = H5Sget_simple_extent_ndims(dataspace_id);
+  if (rank != 1) {
+    ERROR("Can only read one-dimensional tensor components into a buffer, "
+          "but '"
+          << tensor_component << "' has rank " << rank << ".");
+  }
+  hsize_t size = 0;
+  H5Sget_simple_extent_dims(dataspace_id, &size, nullptr);
+  if (size != buffer.size()) {
+    ERROR("The tensor component '" << tensor_component << "' has " << size
+                                   << " points but the buffer has size "
+                                   << buffer.size() << ".");
+  }
+  // HDF5 converts `float` data to `double` while reading
+  if (size > 0) {
+    CHECK_H5(H5Dread(dataset_id, h5::h5_type<double>(), h5::h5s_all(),
+                     h5::h5s_all(), h5::h5p_default(), buffer.data()),
+             "Failed to read the dataset '" << tensor_component << "'");
+  }
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+}
+
+void VolumeData::read_tensor_component(
+    const gsl::span<double> buffer, const size_t observation_id,
+    const std::string& tensor_component,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) const {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+  const hid_t dataset_id =
+      h5::open_dataset(observation_group.id(), tensor_component);
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  const int rank = H5Sget_simple_extent_ndims(dataspace_id);
+  if (rank != 1) {
+    ERROR("Can only read a subset of one-dimensional tensor components, but '"
+          << tensor_component << "' has rank " << rank << ".");
+  }
+  const size_t total_length = select_hyperslabs(
+      dataspace_id, tensor_component, offsets_and_lengths);
+  if (total_length != buffer.size()) {
+    ERROR("The requested points of the tensor component '"
+          << tensor_component << "' add up to " << total_length
+          << " but the buffer has size " << buffer.size() << ".");
+  }
+  if (total_length > 0) {
+    const hsize_t memspace_size = total_length;
+    const hid_t memspace_id =
+        H5Screate_simple(1, &memspace_size, &memspace_size);
+    CHECK_H5(memspace_id, "Failed to create memory space");
+    // HDF5 converts `float` data to `double` while reading
+    CHECK_H5(H5Dread(dataset_id, h5::h5_type<double>(), memspace_id,
+                     dataspace_id, h5::h5p_default(), buffer.data()),
+             "Failed to read a subset of the dataset '" << tensor_component
+                                                        << "'");
+    CHECK_H5(H5Sclose(memspace_id), "Failed to close memory space");
+  }
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+}
+
 std::vector<std::vector<size_t>> VolumeData::get_extents(
     const size_t observation_id) const {
   const std::string path = "ObservationId" + std::to_string(observation_id);
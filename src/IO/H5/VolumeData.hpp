@@ -14,6 +14,7 @@
 #include "IO/H5/Object.hpp"
 #include "IO/H5/OpenGroup.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 
 /// \cond
 class DataVector;
@@ -167,6 +168,42 @@ class VolumeData : public h5::Object {
   TensorComponent get_tensor_component(
       size_t observation_id, const std::string& tensor_component) const;
 
+  /// Read the points `[offset, offset + length)` for each of the
+  /// `offsets_and_lengths` of the tensor component with name
+  /// `tensor_component` at observation id `observation_id`, concatenated in
+  /// a single buffer. This is used to read the data of a subset of the grids,
+  /// see `h5::offset_and_length_for_grid`. Only the parts of the dataset that
+  /// hold the requested points are read from disk and decompressed.
+  ///
+  /// \requires the `offsets_and_lengths` are sorted by offset and don't
+  /// overlap
+  TensorComponent get_tensor_component(
+      size_t observation_id, const std::string& tensor_component,
+      const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) const;
+
+  /// Read the one-dimensional tensor component with name `tensor_component` at
+  /// observation id `observation_id` from all grids in the file into
+  /// `buffer`, converting to `double` if the data is stored as `float`. This
+  /// avoids allocating and copying when the data is read into preallocated
+  /// memory, such as a NumPy array.
+  ///
+  /// \requires `buffer` has the size of the tensor component
+  void read_tensor_component(gsl::span<double> buffer, size_t observation_id,
+                             const std::string& tensor_component) const;
+
+  /// Read the points `[offset, offset + length)` for each of the
+  /// `offsets_and_lengths` of the tensor component with name
+  /// `tensor_component` at observation id `observation_id` into `buffer`,
+  /// concatenated. Combines the subset read of `get_tensor_component` with
+  /// reading into preallocated memory.
+  ///
+  /// \requires the `offsets_and_lengths` are sorted by offset and don't
+  /// overlap, and `buffer` has the size of their total length
+  void read_tensor_component(
+      gsl::span<double> buffer, size_t observation_id,
+      const std::string& tensor_component,
+      const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) const;
+
   /// Read the extents of all the grids stored in the file at the observation id
   /// `observation_id`
   std::vector<std::vector<size_t>> get_extents(size_t observation_id) const;
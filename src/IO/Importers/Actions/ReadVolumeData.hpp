@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -15,16 +18,14 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/Domain.hpp"
-#include "Domain/ElementLogicalCoordinates.hpp"
 #include "Domain/Structure/ElementId.hpp"
-#include "IO/H5/AccessType.hpp"
-#include "IO/H5/File.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/Importers/InterpolationPlan.hpp"
 #include "IO/Importers/ObservationSelector.hpp"
 #include "IO/Importers/Tags.hpp"
+#include "IO/Importers/VolumeFileCache.hpp"
 #include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
@@ -33,6 +34,7 @@
 #include "Parallel/ArrayIndex.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -77,16 +79,20 @@ struct Selected : db::SimpleTag {
 namespace detail {
 
 // Read the single `tensor_name` from the `volume_file`, taking care of suffixes
-// like "_x" etc for its components.
+// like "_x" etc for its components. Only the points in the
+// `offsets_and_lengths` are read, concatenated in that order.
 template <typename TensorType>
-void read_tensor_data(const gsl::not_null<TensorType*> tensor_data,
-                      const std::string& tensor_name,
-                      const h5::VolumeData& volume_file,
-                      const size_t observation_id) {
+void read_tensor_data(
+    const gsl::not_null<TensorType*> tensor_data,
+    const std::string& tensor_name, const h5::VolumeData& volume_file,
+    const size_t observation_id,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) {
   for (size_t i = 0; i < tensor_data->size(); ++i) {
     const auto& tensor_component = volume_file.get_tensor_component(
-        observation_id, tensor_name + tensor_data->component_suffix(
-                                          tensor_data->get_tensor_index(i)));
+        observation_id,
+        tensor_name +
+            tensor_data->component_suffix(tensor_data->get_tensor_index(i)),
+        offsets_and_lengths);
     if (not std::holds_alternative<DataVector>(tensor_component.data)) {
       ERROR("The tensor component '"
             << tensor_component.name
@@ -97,25 +103,27 @@ void read_tensor_data(const gsl::not_null<TensorType*> tensor_data,
   }
 }
 
-// Read the `selected_fields` from the `volume_file`. Reads the data
-// for all elements in the `volume_file` at once. Invoked lazily when data
-// for an element in the volume file is needed.
+// Read the `selected_fields` from the `volume_file`. Reads the data for all
+// elements in the `offsets_and_lengths` at once, which are the elements in the
+// `volume_file` that are needed on this node.
 template <typename FieldTagsList>
 tuples::tagged_tuple_from_typelist<FieldTagsList> read_tensor_data(
     const h5::VolumeData& volume_file, const size_t observation_id,
     const tuples::tagged_tuple_from_typelist<
-        db::wrap_tags_in<Tags::Selected, FieldTagsList>>& selected_fields) {
+        db::wrap_tags_in<Tags::Selected, FieldTagsList>>& selected_fields,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths) {
   tuples::tagged_tuple_from_typelist<FieldTagsList> all_tensor_data{};
   tmpl::for_each<FieldTagsList>([&all_tensor_data, &volume_file,
-                                 &observation_id,
-                                 &selected_fields](auto field_tag_v) {
+                                 &observation_id, &selected_fields,
+                                 &offsets_and_lengths](auto field_tag_v) {
     using field_tag = tmpl::type_from<decltype(field_tag_v)>;
     const auto& selection = get<Tags::Selected<field_tag>>(selected_fields);
     if (not selection.has_value()) {
       return;
     }
     read_tensor_data(make_not_null(&get<field_tag>(all_tensor_data)),
-                     selection.value(), volume_file, observation_id);
+                     selection.value(), volume_file, observation_id,
+                     offsets_and_lengths);
   });
   return all_tensor_data;
 }
@@ -184,7 +192,7 @@ void verify_inertial_coordinates(
             "The source and target coordinates don't match on grid "
             << grid_name << " in dimension " << d << " at point " << j
             << " (plus offset " << source_element_data_offset_and_length.first
-            << " in the data file). Source coordinate: "
+            << " in the data read from the file). Source coordinate: "
             << source_coord[source_element_data_offset_and_length.first + j]
             << ", target coordinate: " << target_coord[j]
             << ". Set 'Interpolate: True' to enable interpolation between the "
@@ -340,16 +348,44 @@ struct ReadVolumeData {
  * that was encoded into the `Parallel::ArrayComponentId` used to register the
  * elements. The `volume_data_id` passed to this action is used as key.
  *
+ * \par Reading only the data needed on the node
+ * This action runs once on every node. It first finds the source elements in
+ * each volume data file that overlap with the target elements on this node,
+ * and then reads only the parts of the tensor datasets that hold the data of
+ * these source elements (HDF5 hyperslabs). The files stay open in the
+ * `importers::Tags::VolumeFileCache` across invocations of this action, along
+ * with an index of the grids in each file at each observation. So the grid
+ * names and extents are read only once per file and observation, and looking
+ * up the data of a source element takes constant time.
+ *
+ * \par Interpolation plans
+ * When interpolating, finding the target points in the source elements is
+ * expensive because it inverts the source domain's maps at every target point.
+ * Therefore, this action stores an `importers::InterpolationPlan` for each
+ * target element, file and observation in the
+ * `importers::Tags::InterpolationPlans`, and reuses it in subsequent
+ * invocations as long as the target element's registered points are
+ * unchanged. Subsequent invocations don't need to deserialize the source
+ * domain at all if all plans are available. When importing another observation
+ * from the same file, e.g. to interpolate in time, the plan of a previous
+ * observation is copied instead of computed if the source domain is
+ * time-independent and the file holds the same elements at both
+ * observations.
+ *
  * \par Memory consumption
- * This action runs once on every node. It reads all volume data files on the
- * node, but doesn't keep them all in memory at once. The following items
- * contribute primarily to memory consumption and can be reconsidered if we run
- * into memory issues:
+ * The following items contribute primarily to memory consumption and can be
+ * reconsidered if we run into memory issues:
  *
- * - `all_tensor_data`: All requested tensor components in the volume data file
- *   at the specified observation ID. Only data from one volume data file is
- *   held in memory at any time. Only data from files that overlap with target
- *   elements on this node are read in.
+ * - `all_tensor_data`: The requested tensor components of the source elements
+ *   in the volume data file that overlap with target elements on this node, at
+ *   the specified observation ID. Only data from one volume data file is held
+ *   in memory at any time.
+ * - `importers::Tags::VolumeFileCache`: The names, extents, bases and
+ *   quadratures of all grids in each volume data file that this node has read
+ *   from.
+ * - `importers::Tags::InterpolationPlans`: The element-logical coordinates of
+ *   all target points on this node, for each volume data file and observation
+ *   that this node has interpolated from.
  * - `target_element_data_buffer`: Holds incomplete interpolated data for each
  *   (target) element that resides on this node. In the worst case, when all
  *   target elements need data from the last source element in the last volume
@@ -439,7 +475,11 @@ struct ReadAllVolumeDataAndDistribute {
       ERROR_NO_TRACE("The file glob '" << file_glob << "' matches no files.");
     }
 
-    // Open every file in turn
+    // Open every file in turn, or retrieve it from the cache if it was opened
+    // in a previous invocation of this action
+    auto& volume_file_cache =
+        db::get_mutable_reference<Tags::VolumeFileCache>(make_not_null(&box));
+    const std::string subfile_path = "/" + get<OptionTags::Subgroup>(options);
     std::optional<size_t> prev_observation_id{};
     double observation_value = std::numeric_limits<double>::signaling_NaN();
     std::optional<Domain<Dim>> source_domain{};
@@ -447,11 +487,8 @@ struct ReadAllVolumeDataAndDistribute {
                        std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
         source_domain_functions_of_time{};
     for (const std::string& file_name : file_paths) {
-      // Open the volume data file
-      h5::H5File<h5::AccessType::ReadOnly> h5file(file_name);
-      constexpr size_t version_number = 0;
-      const auto& volume_file = h5file.get<h5::VolumeData>(
-          "/" + get<OptionTags::Subgroup>(options), version_number);
+      const auto& volume_file =
+          volume_file_cache.volume_file(file_name, subfile_path);
 
       // Select observation ID
       const size_t observation_id = std::visit(
@@ -480,226 +517,301 @@ struct ReadAllVolumeDataAndDistribute {
               << ". Make sure all files select the same observation ID.");
       }
       prev_observation_id = observation_id;
-      observation_value = volume_file.get_observation_value(observation_id);
-
-      // Memory buffer for the tensor data stored in this file. The data is
-      // loaded lazily when it is needed. We may find that we can skip loading
-      // some files because none of their data is needed to fill the elements on
-      // this node.
-      std::optional<tuples::tagged_tuple_from_typelist<FieldTagsList>>
-          all_tensor_data{};
-      std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>
-          source_inertial_coords{};
 
       // Retrieve the information needed to reconstruct which element the data
-      // belongs to
-      const auto source_grid_names = volume_file.get_grid_names(observation_id);
-      const auto source_extents = volume_file.get_extents(observation_id);
-      const auto source_bases = volume_file.get_bases(observation_id);
-      const auto source_quadratures =
-          volume_file.get_quadratures(observation_id);
-      std::vector<ElementId<Dim>> source_element_ids{};
+      // belongs to. The index is built only once per file and observation.
+      const VolumeFileIndex& source_index =
+          volume_file_cache.index(file_name, subfile_path, observation_id);
+      observation_value = source_index.observation_value();
+      // Find the source elements in this volume file that overlap with the
+      // registered (target) elements. Only the data of these source elements
+      // is read from the file. It's possible that the volume file only
+      // contains data for a subset of elements, e.g., when each node of a
+      // simulation wrote volume data for its elements to a separate file.
+      std::unordered_map<ElementId<Dim>, const InterpolationPlan<Dim>*>
+          target_interpolation_plans{};
+      std::vector<ElementId<Dim>> target_elements_in_file{};
+      std::vector<std::pair<size_t, size_t>> source_offsets_and_lengths{};
       if (enable_interpolation) {
-        // Need to parse all source grid names to element IDs only if
-        // interpolation is enabled
-        source_element_ids.reserve(source_grid_names.size());
-        for (const auto& grid_name : source_grid_names) {
-          source_element_ids.push_back(ElementId<Dim>(grid_name));
-        }
-        // Reconstruct domain from volume data file
-        const std::optional<std::vector<char>> serialized_domain =
-            volume_file.get_domain(observation_id);
-        if (not serialized_domain.has_value()) {
-          ERROR_NO_TRACE("No serialized domain found in file '"
-                         << file_name << volume_file.subfile_path()
-                         << "'. The domain is needed for interpolation.");
-        }
-        if (source_domain.has_value()) {
-#ifdef SPECTRE_DEBUG
-          // Check that the domain is the same in all files (only in debug mode)
-          const auto deserialized_domain =
-              deserialize<Domain<Dim>>(serialized_domain->data());
-          if (*source_domain != deserialized_domain) {
-            ERROR_NO_TRACE(
-                "The domain in all volume files must be the same. Domain in "
-                "file '"
-                << file_name << volume_file.subfile_path()
-                << "' differs from a previously read file.");
+        // The source elements and the logical coordinates of the target points
+        // in them are computed only once per target element, file and
+        // observation, and are reused for subsequent imports
+        auto& all_interpolation_plans =
+            db::get_mutable_reference<Tags::InterpolationPlans<Dim>>(
+                make_not_null(&box));
+        auto& interpolation_plans = all_interpolation_plans[std::make_pair(
+            file_name + subfile_path, observation_id)];
+        // Computing new plans needs the source domain and the IDs of all
+        // elements in this volume file, so they are loaded only if needed
+        bool source_domain_is_loaded = false;
+        std::vector<ElementId<Dim>> source_element_ids{};
+        const auto load_source_domain = [&source_domain_is_loaded,
+                                         &source_element_ids, &source_index,
+                                         &volume_file, &observation_id,
+                                         &file_name, &source_domain,
+                                         &source_domain_functions_of_time]() {
+          source_domain_is_loaded = true;
+          source_element_ids.reserve(source_index.grid_names().size());
+          for (const auto& grid_name : source_index.grid_names()) {
+            source_element_ids.push_back(ElementId<Dim>(grid_name));
           }
+          // Reconstruct domain from volume data file
+          const std::optional<std::vector<char>> serialized_domain =
+              volume_file.get_domain(observation_id);
+          if (not serialized_domain.has_value()) {
+            ERROR_NO_TRACE("No serialized domain found in file '"
+                           << file_name << volume_file.subfile_path()
+                           << "'. The domain is needed for interpolation.");
+          }
+          if (source_domain.has_value()) {
+#ifdef SPECTRE_DEBUG
+            // Check that the domain is the same in all files (only in debug
+            // mode)
+            const auto deserialized_domain =
+                deserialize<Domain<Dim>>(serialized_domain->data());
+            if (*source_domain != deserialized_domain) {
+              ERROR_NO_TRACE(
+                  "The domain in all volume files must be the same. Domain in "
+                  "file '"
+                  << file_name << volume_file.subfile_path()
+                  << "' differs from a previously read file.");
+            }
 #endif
-        } else {
-          source_domain = deserialize<Domain<Dim>>(serialized_domain->data());
+          } else {
+            source_domain =
+                deserialize<Domain<Dim>>(serialized_domain->data());
+          }
+          // Reconstruct functions of time from volume data file
+          if (source_domain_functions_of_time.empty() and
+              alg::any_of(source_domain->blocks(), [](const auto& block) {
+                return block.is_time_dependent();
+              })) {
+            const std::optional<std::vector<char>>
+                serialized_functions_of_time =
+                    volume_file.get_functions_of_time(observation_id);
+            if (not serialized_functions_of_time.has_value()) {
+              ERROR_NO_TRACE("No domain functions of time found in file '"
+                             << file_name << volume_file.subfile_path()
+                             << "'. The functions of time are needed for "
+                                "interpolating with time-dependent maps.");
+            }
+            source_domain_functions_of_time = deserialize<std::unordered_map<
+                std::string,
+                std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>>(
+                serialized_functions_of_time->data());
+          }
+        };
+        for (const auto& target_element_id : target_element_ids) {
+          const auto target_array_component_id =
+              Parallel::make_array_component_id<ReceiveComponent>(
+                  target_element_id);
+          const auto& target_points =
+              get<Tags::RegisteredElements<Dim>>(box).at(
+                  target_array_component_id);
+          // A plan is only valid for the target points it was computed for
+          auto& interpolation_plan =
+              interpolation_plans[target_array_component_id];
+          if (interpolation_plan.target_points != target_points) {
+            if (not source_domain_is_loaded) {
+              load_source_domain();
+            }
+            // With time-independent maps the target points lie at the same
+            // logical coordinates of the source elements at all observations,
+            // so a plan from another observation of this file is reused if the
+            // file holds the same elements at both observations
+            const InterpolationPlan<Dim>* reusable_plan = nullptr;
+            if (alg::none_of(source_domain->blocks(), [](const auto& block) {
+                  return block.is_time_dependent();
+                })) {
+              for (auto other_plans = all_interpolation_plans.lower_bound(
+                       std::make_pair(file_name + subfile_path, 0_st));
+                   reusable_plan == nullptr and
+                   other_plans != all_interpolation_plans.end() and
+                   other_plans->first.first == file_name + subfile_path;
+                   ++other_plans) {
+                const auto other_plan =
+                    other_plans->second.find(target_array_component_id);
+                if (other_plans->first.second == observation_id or
+                    other_plan == other_plans->second.end() or
+                    other_plan->second.target_points != target_points or
+                    volume_file_cache
+                            .index(file_name, subfile_path,
+                                   other_plans->first.second)
+                            .grid_names() != source_index.grid_names()) {
+                  continue;
+                }
+                reusable_plan = &other_plan->second;
+              }
+            }
+            if (reusable_plan != nullptr) {
+              interpolation_plan = *reusable_plan;
+            } else {
+              interpolation_plan = InterpolationPlan<Dim>{
+                  target_points, *source_domain, observation_value,
+                  source_domain_functions_of_time, source_element_ids};
+            }
+          }
+          if (interpolation_plan.source_elements.empty()) {
+            continue;
+          }
+          for (const auto& source_element :
+               interpolation_plan.source_elements) {
+            source_offsets_and_lengths.push_back(
+                source_index.offset_and_length(source_element.grid_name));
+          }
+          target_interpolation_plans.emplace(target_element_id,
+                                             &interpolation_plan);
         }
-        // Reconstruct functions of time from volume data file
-        if (source_domain_functions_of_time.empty() and
-            alg::any_of(source_domain->blocks(), [](const auto& block) {
-              return block.is_time_dependent();
-            })) {
-          const std::optional<std::vector<char>> serialized_functions_of_time =
-              volume_file.get_functions_of_time(observation_id);
-          if (not serialized_functions_of_time.has_value()) {
-            ERROR_NO_TRACE("No domain functions of time found in file '"
-                           << file_name << volume_file.subfile_path()
-                           << "'. The functions of time are needed for "
-                              "interpolating with time-dependent maps.");
+      } else {
+        // When interpolation is disabled we process only volume files that
+        // contain the exact element
+        for (const auto& target_element_id : target_element_ids) {
+          const auto target_grid_name = get_output(target_element_id);
+          if (not source_index.contains(target_grid_name)) {
+            continue;
           }
-          source_domain_functions_of_time = deserialize<std::unordered_map<
-              std::string,
-              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>>(
-              serialized_functions_of_time->data());
+          source_offsets_and_lengths.push_back(
+              source_index.offset_and_length(target_grid_name));
+          target_elements_in_file.push_back(target_element_id);
         }
       }
+      // Skip this file if none of its data is needed on this node
+      if (source_offsets_and_lengths.empty()) {
+        continue;
+      }
+
+      // Read the data of all overlapping source elements from the file at
+      // once. The data is read in the order it is stored in the file, so we
+      // sort the hyperslabs and remove duplicates from source elements that
+      // overlap with multiple target elements. Then we record where each
+      // hyperslab begins in the data that was read.
+      alg::sort(source_offsets_and_lengths);
+      source_offsets_and_lengths.erase(
+          std::unique(source_offsets_and_lengths.begin(),
+                      source_offsets_and_lengths.end()),
+          source_offsets_and_lengths.end());
+      std::unordered_map<size_t, size_t> offsets_in_read_data{};
+      size_t offset_in_read_data = 0;
+      for (const auto& [offset, length] : source_offsets_and_lengths) {
+        offsets_in_read_data.emplace(offset, offset_in_read_data);
+        offset_in_read_data += length;
+      }
+      const auto all_tensor_data = detail::read_tensor_data<FieldTagsList>(
+          volume_file, observation_id, selected_fields,
+          source_offsets_and_lengths);
+      std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>
+          source_inertial_coords{};
+      if (not enable_interpolation) {
+        // Verify that the inertial coordinates of the source and target
+        // elements match. To do so we retrieve the inertial coordinates
+        // that are written alongside the tensor data in the file. This is
+        // an important check. It avoids nasty bugs where tensor data is
+        // read in to points that don't exactly match the input. Therefore
+        // we DON'T restrict this check to Debug mode.
+        source_inertial_coords.emplace();
+        detail::read_tensor_data(make_not_null(&*source_inertial_coords),
+                                 "InertialCoordinates", volume_file,
+                                 observation_id, source_offsets_and_lengths);
+      }
+
+      // Find the data of a source element in the data that was read
+      const auto offset_and_length_in_read_data =
+          [&source_index, &offsets_in_read_data](const std::string& grid_name) {
+            const auto offset_and_length =
+                source_index.offset_and_length(grid_name);
+            return std::make_pair(
+                offsets_in_read_data.at(offset_and_length.first),
+                offset_and_length.second);
+          };
 
       // Distribute the tensor data to the registered (target) elements. We
       // erase target elements when they are complete. This allows us to search
       // only for incomplete elements in subsequent volume files, and to stop
       // early when all registered elements are complete.
       std::unordered_set<ElementId<Dim>> completed_target_elements{};
-      for (const auto& target_element_id : target_element_ids) {
-        const auto& target_points = get<Tags::RegisteredElements<Dim>>(box).at(
-            Parallel::make_array_component_id<ReceiveComponent>(
-                target_element_id));
-        const auto target_grid_name = get_output(target_element_id);
-
-        // Proceed with the registered element only if it overlaps with the
-        // volume file. It's possible that the volume file only contains data
-        // for a subset of elements, e.g., when each node of a simulation wrote
-        // volume data for its elements to a separate file.
-        std::vector<ElementId<Dim>> overlapping_source_element_ids{};
-        std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>
-            source_element_logical_coords{};
-        if (enable_interpolation) {
-          // Transform the target points to block logical coords in the source
-          // domain
-          const auto source_block_logical_coords = block_logical_coordinates(
-              *source_domain, target_points, observation_value,
-              source_domain_functions_of_time);
-          // Find the target points in the subset of source elements contained
-          // in this volume file
-          source_element_logical_coords = element_logical_coordinates(
-              source_element_ids, source_block_logical_coords);
-          overlapping_source_element_ids.reserve(
-              source_element_logical_coords.size());
-          for (const auto& source_element_id_and_coords :
-               source_element_logical_coords) {
-            overlapping_source_element_ids.push_back(
-                source_element_id_and_coords.first);
-          }
-        } else {
-          // When interpolation is disabled we process only volume files that
-          // contain the exact element
-          if (std::find(source_grid_names.begin(), source_grid_names.end(),
-                        target_grid_name) == source_grid_names.end()) {
-            continue;
+      for (const auto& [target_element_id, interpolation_plan] :
+           target_interpolation_plans) {
+        const size_t target_num_points =
+            interpolation_plan->target_points.begin()->size();
+
+        // Get and resize target buffer
+        auto& target_element_data =
+            target_element_data_buffer[target_element_id];
+        tmpl::for_each<FieldTagsList>([&target_element_data,
+                                       &target_num_points,
+                                       &selected_fields](auto field_tag_v) {
+          using field_tag = tmpl::type_from<decltype(field_tag_v)>;
+          if (get<Tags::Selected<field_tag>>(selected_fields).has_value()) {
+            for (auto& component : get<field_tag>(target_element_data)) {
+              component.destructive_resize(target_num_points);
+            }
           }
-          overlapping_source_element_ids.push_back(target_element_id);
-        }
-
-        // Lazily load the tensor data from the file if needed
-        if (not overlapping_source_element_ids.empty() and
-            not all_tensor_data.has_value()) {
-          all_tensor_data = detail::read_tensor_data<FieldTagsList>(
-              volume_file, observation_id, selected_fields);
-        }
+        });
+        auto& indices_of_filled_interp_points =
+            all_indices_of_filled_interp_points[target_element_id];
 
         // Iterate over the source elements in this volume file that overlap
         // with the target element
-        for (const auto& source_element_id : overlapping_source_element_ids) {
-          const auto source_grid_name = get_output(source_element_id);
-          // Find the data offset that corresponds to this element
-          const auto element_data_offset_and_length =
-              h5::offset_and_length_for_grid(source_grid_name,
-                                             source_grid_names, source_extents);
+        for (const auto& source_element : interpolation_plan->source_elements) {
           // Extract this element's data from the read-in dataset
-          auto source_element_data =
+          const auto source_element_data =
               detail::extract_element_data<FieldTagsList>(
-                  element_data_offset_and_length, *all_tensor_data,
-                  selected_fields);
-
-          if (enable_interpolation) {
-            const auto source_mesh = h5::mesh_for_grid<Dim>(
-                source_grid_name, source_grid_names, source_extents,
-                source_bases, source_quadratures);
-            const size_t target_num_points = target_points.begin()->size();
-
-            // Get and resize target buffer
-            auto& target_element_data =
-                target_element_data_buffer[target_element_id];
-            tmpl::for_each<FieldTagsList>([&target_element_data,
-                                           &target_num_points,
-                                           &selected_fields](auto field_tag_v) {
-              using field_tag = tmpl::type_from<decltype(field_tag_v)>;
-              if (get<Tags::Selected<field_tag>>(selected_fields).has_value()) {
-                for (auto& component : get<field_tag>(target_element_data)) {
-                  component.destructive_resize(target_num_points);
-                }
-              }
-            });
-            auto& indices_of_filled_interp_points =
-                all_indices_of_filled_interp_points[target_element_id];
-
-            // Interpolate!
-            const auto& source_logical_coords_of_target_points =
-                source_element_logical_coords.at(source_element_id);
-            detail::interpolate_selected_fields<FieldTagsList>(
-                make_not_null(&target_element_data), source_element_data,
-                source_mesh,
-                source_logical_coords_of_target_points.element_logical_coords,
-                source_logical_coords_of_target_points.offsets,
-                selected_fields);
-            indices_of_filled_interp_points.insert(
-                indices_of_filled_interp_points.end(),
-                source_logical_coords_of_target_points.offsets.begin(),
-                source_logical_coords_of_target_points.offsets.end());
-
-            if (indices_of_filled_interp_points.size() == target_num_points) {
-              // Pass the (interpolated) data to the element. Now it can proceed
-              // in parallel with transforming the data, taking derivatives on
-              // the grid, etc.
-              if constexpr (Parallel::is_dg_element_collection_v<
-                                ReceiveComponent>) {
-                ERROR("Can't yet do numerical initial data with nodegroups");
-              } else {
-                Parallel::receive_data<Tags::VolumeData<FieldTagsList>>(
-                    Parallel::get_parallel_component<ReceiveComponent>(
-                        cache)[target_element_id],
-                    volume_data_id, std::move(target_element_data));
-              }
-              completed_target_elements.insert(target_element_id);
-              target_element_data_buffer.erase(target_element_id);
-              all_indices_of_filled_interp_points.erase(target_element_id);
-            }
+                  offset_and_length_in_read_data(source_element.grid_name),
+                  all_tensor_data, selected_fields);
+          // Interpolate!
+          detail::interpolate_selected_fields<FieldTagsList>(
+              make_not_null(&target_element_data), source_element_data,
+              source_index.mesh<Dim>(source_element.grid_name),
+              source_element.target_logical_coords,
+              source_element.target_offsets, selected_fields);
+          indices_of_filled_interp_points.insert(
+              indices_of_filled_interp_points.end(),
+              source_element.target_offsets.begin(),
+              source_element.target_offsets.end());
+        }
+
+        if (indices_of_filled_interp_points.size() == target_num_points) {
+          // Pass the (interpolated) data to the element. Now it can proceed
+          // in parallel with transforming the data, taking derivatives on
+          // the grid, etc.
+          if constexpr (Parallel::is_dg_element_collection_v<
+                            ReceiveComponent>) {
+            ERROR("Can't yet do numerical initial data with nodegroups");
           } else {
-            // Verify that the inertial coordinates of the source and target
-            // elements match. To do so we retrieve the inertial coordinates
-            // that are written alongside the tensor data in the file. This is
-            // an important check. It avoids nasty bugs where tensor data is
-            // read in to points that don't exactly match the input. Therefore
-            // we DON'T restrict this check to Debug mode.
-            if (not source_inertial_coords.has_value()) {
-              tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords{};
-              detail::read_tensor_data(make_not_null(&inertial_coords),
-                                       "InertialCoordinates", volume_file,
-                                       observation_id);
-              source_inertial_coords = std::move(inertial_coords);
-            }
-            detail::verify_inertial_coordinates(
-                element_data_offset_and_length, *source_inertial_coords,
-                target_points, source_grid_name);
-            // Pass data directly to the element when interpolation is disabled
-            if constexpr (Parallel::is_dg_element_collection_v<
-                              ReceiveComponent>) {
-              ERROR("Can't yet do numerical initial data with nodegroups");
-            } else {
-              Parallel::receive_data<Tags::VolumeData<FieldTagsList>>(
-                  Parallel::get_parallel_component<ReceiveComponent>(
-                      cache)[target_element_id],
-                  volume_data_id, std::move(source_element_data));
-            }
-            completed_target_elements.insert(target_element_id);
+            Parallel::receive_data<Tags::VolumeData<FieldTagsList>>(
+                Parallel::get_parallel_component<ReceiveComponent>(
+                    cache)[target_element_id],
+                volume_data_id, std::move(target_element_data));
           }
-        }  // loop over overlapping source elements
-      }    // loop over registered elements
+          completed_target_elements.insert(target_element_id);
+          target_element_data_buffer.erase(target_element_id);
+          all_indices_of_filled_interp_points.erase(target_element_id);
+        }
+      }  // loop over registered elements when interpolating
+      for (const auto& target_element_id : target_elements_in_file) {
+        const auto& target_points = get<Tags::RegisteredElements<Dim>>(box).at(
+            Parallel::make_array_component_id<ReceiveComponent>(
+                target_element_id));
+        const auto grid_name = get_output(target_element_id);
+        const auto element_data_offset_and_length =
+            offset_and_length_in_read_data(grid_name);
+        // Extract this element's data from the read-in dataset
+        auto source_element_data = detail::extract_element_data<FieldTagsList>(
+            element_data_offset_and_length, all_tensor_data, selected_fields);
+        detail::verify_inertial_coordinates(element_data_offset_and_length,
+                                            *source_inertial_coords,
+                                            target_points, grid_name);
+        // Pass data directly to the element when interpolation is disabled
+        if constexpr (Parallel::is_dg_element_collection_v<ReceiveComponent>) {
+          ERROR("Can't yet do numerical initial data with nodegroups");
+        } else {
+          Parallel::receive_data<Tags::VolumeData<FieldTagsList>>(
+              Parallel::get_parallel_component<ReceiveComponent>(
+                  cache)[target_element_id],
+              volume_data_id, std::move(source_element_data));
+        }
+        completed_target_elements.insert(target_element_id);
+      }  // loop over registered elements when not interpolating
       for (const auto& completed_element_id : completed_target_elements) {
         target_element_ids.erase(completed_element_id);
       }
@@ -65,7 +65,8 @@ namespace detail {
 template <size_t Dim>
 struct InitializeElementDataReader {
   using simple_tags =
-      tmpl::list<Tags::RegisteredElements<Dim>, Tags::ElementDataAlreadyRead>;
+      tmpl::list<Tags::RegisteredElements<Dim>, Tags::ElementDataAlreadyRead,
+                 Tags::VolumeFileCache, Tags::InterpolationPlans<Dim>>;
   using compute_tags = tmpl::list<>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -0,0 +1,66 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Importers/InterpolationPlan.hpp"
+
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementLogicalCoordinates.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/GetOutput.hpp"
+
+namespace importers {
+
+template <size_t Dim>
+void InterpolationPlan<Dim>::SourceElement::pup(PUP::er& p) {
+  p | grid_name;
+  p | target_logical_coords;
+  p | target_offsets;
+}
+
+template <size_t Dim>
+InterpolationPlan<Dim>::InterpolationPlan(
+    tnsr::I<DataVector, Dim, Frame::Inertial> target_points_in,
+    const Domain<Dim>& source_domain, const double time,
+    const domain::FunctionsOfTimeMap& source_functions_of_time,
+    const std::vector<ElementId<Dim>>& source_element_ids)
+    : target_points(std::move(target_points_in)) {
+  // Transform the target points to block logical coords in the source domain
+  const auto source_block_logical_coords = block_logical_coordinates(
+      source_domain, target_points, time, source_functions_of_time);
+  // Find the target points in the subset of source elements
+  auto source_element_logical_coords = element_logical_coordinates(
+      source_element_ids, source_block_logical_coords);
+  source_elements.reserve(source_element_logical_coords.size());
+  for (auto& [source_element_id, coords] : source_element_logical_coords) {
+    source_elements.push_back({get_output(source_element_id),
+                               std::move(coords.element_logical_coords),
+                               std::move(coords.offsets)});
+  }
+}
+
+template <size_t Dim>
+void InterpolationPlan<Dim>::pup(PUP::er& p) {
+  p | target_points;
+  p | source_elements;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data) template struct InterpolationPlan<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef INSTANTIATE
+#undef DIM
+}  // namespace importers
@@ -0,0 +1,82 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+
+/// \cond
+template <size_t Dim>
+class Domain;
+template <size_t Dim>
+class ElementId;
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace importers {
+
+/*!
+ * \brief Where the points of a target element lie in the source elements of a
+ * volume data file.
+ *
+ * \details Finding the block-logical and element-logical coordinates of the
+ * target points in the source domain involves inverting the source domain's
+ * maps at every target point, which is expensive. The
+ * `importers::ElementDataReader` computes a plan once for each target element
+ * and each volume data file and observation, and reuses it for subsequent
+ * imports from the same files, e.g. of other tensors or in iterations of an
+ * elliptic solve. A plan is valid only for the `target_points` it was computed
+ * for, so it is recomputed when the target element registers different points.
+ *
+ * Only the source element-logical coordinates of the target points are stored,
+ * and the interpolation matrices are rebuilt for each import from them. Storing
+ * the matrices would take memory proportional to the number of target points
+ * times the number of points per source element, for every target element.
+ */
+template <size_t Dim>
+struct InterpolationPlan {
+  /// The target points in a source element
+  struct SourceElement {
+    /// The name of the source element's grid in the volume data file
+    std::string grid_name{};
+    /// The element-logical coordinates of the target points in the source
+    /// element
+    tnsr::I<DataVector, Dim, Frame::ElementLogical> target_logical_coords{};
+    /// The indices of these target points in the `target_points`
+    std::vector<size_t> target_offsets{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+
+  InterpolationPlan() = default;
+
+  /// Find the `target_points` in the `source_element_ids` of the
+  /// `source_domain` at time `time`. The `source_element_ids` are the
+  /// elements in a volume data file, which can be a subset of all elements in
+  /// the source domain.
+  InterpolationPlan(
+      tnsr::I<DataVector, Dim, Frame::Inertial> target_points_in,
+      const Domain<Dim>& source_domain, double time,
+      const domain::FunctionsOfTimeMap& source_functions_of_time,
+      const std::vector<ElementId<Dim>>& source_element_ids);
+
+  /// The target points the plan was computed for
+  tnsr::I<DataVector, Dim, Frame::Inertial> target_points{};
+  /// The source elements that hold at least one target point. Empty if the
+  /// volume data file holds none of the target points.
+  std::vector<SourceElement> source_elements{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+
+}  // namespace importers
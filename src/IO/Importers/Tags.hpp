@@ -10,11 +10,14 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <variant>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "IO/Importers/InterpolationPlan.hpp"
 #include "IO/Importers/ObservationSelector.hpp"
+#include "IO/Importers/VolumeFileCache.hpp"
 #include "Options/String.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/InboxInserters.hpp"
@@ -118,6 +121,26 @@ struct ElementDataAlreadyRead : db::SimpleTag {
   using type = std::unordered_set<size_t>;
 };
 
+/// Volume data files that are kept open across reads, along with an index of
+/// the grids in each file. See `importers::VolumeFileCache`.
+struct VolumeFileCache : db::SimpleTag {
+  using type = importers::VolumeFileCache;
+};
+
+/*!
+ * \brief The `importers::InterpolationPlan`s of the registered elements for
+ * each volume data file and observation.
+ *
+ * \details The keys are the file name followed by the subfile path, and the
+ * observation ID.
+ */
+template <size_t Dim>
+struct InterpolationPlans : db::SimpleTag {
+  using type = std::map<std::pair<std::string, size_t>,
+                        std::unordered_map<Parallel::ArrayComponentId,
+                                           InterpolationPlan<Dim>>>;
+};
+
 /*!
  * \brief Inbox tag that carries the data read from a volume data file.
  *
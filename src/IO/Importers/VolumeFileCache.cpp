@@ -0,0 +1,165 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Importers/VolumeFileCache.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/MakeArray.hpp"
+
+namespace importers {
+
+VolumeFileIndex::VolumeFileIndex(const h5::VolumeData& volume_file,
+                                 const size_t observation_id)
+    : observation_id_(observation_id),
+      observation_value_(volume_file.get_observation_value(observation_id)),
+      grid_names_(volume_file.get_grid_names(observation_id)),
+      extents_(volume_file.get_extents(observation_id)),
+      bases_(volume_file.get_bases(observation_id)),
+      quadratures_(volume_file.get_quadratures(observation_id)) {
+  ASSERT(extents_.size() == grid_names_.size() and
+             bases_.size() == grid_names_.size() and
+             quadratures_.size() == grid_names_.size(),
+         "Found " << grid_names_.size() << " grid names but "
+                  << extents_.size() << " extents, " << bases_.size()
+                  << " bases and " << quadratures_.size()
+                  << " quadratures in volume file '"
+                  << volume_file.subfile_path() << "'.");
+  offsets_.reserve(grid_names_.size());
+  grid_indices_.reserve(grid_names_.size());
+  size_t offset = 0;
+  for (size_t i = 0; i < grid_names_.size(); ++i) {
+    offsets_.push_back(offset);
+    offset += alg::accumulate(extents_[i], 1_st, std::multiplies<>{});
+    grid_indices_.emplace(grid_names_[i], i);
+  }
+}
+
+bool VolumeFileIndex::contains(const std::string& grid_name) const {
+  return grid_indices_.find(grid_name) != grid_indices_.end();
+}
+
+std::pair<size_t, size_t> VolumeFileIndex::offset_and_length(
+    const std::string& grid_name) const {
+  const size_t index = grid_index(grid_name);
+  return {offsets_[index],
+          alg::accumulate(extents_[index], 1_st, std::multiplies<>{})};
+}
+
+template <size_t Dim>
+Mesh<Dim> VolumeFileIndex::mesh(const std::string& grid_name) const {
+  const size_t index = grid_index(grid_name);
+  const auto& extents = extents_[index];
+  const auto& bases = bases_[index];
+  const auto& quadratures = quadratures_[index];
+  ASSERT(extents.size() == Dim and bases.size() == Dim and
+             quadratures.size() == Dim,
+         "The mesh of grid '" << grid_name << "' is not " << Dim << "D.");
+  return Mesh<Dim>{make_array<size_t, Dim>(extents),
+                   make_array<Spectral::Basis, Dim>(bases),
+                   make_array<Spectral::Quadrature, Dim>(quadratures)};
+}
+
+void VolumeFileIndex::pup(PUP::er& p) {
+  p | observation_id_;
+  p | observation_value_;
+  p | grid_names_;
+  p | extents_;
+  p | bases_;
+  p | quadratures_;
+  p | offsets_;
+  p | grid_indices_;
+}
+
+size_t VolumeFileIndex::grid_index(const std::string& grid_name) const {
+  const auto found_grid = grid_indices_.find(grid_name);
+  if (found_grid == grid_indices_.end()) {
+    ERROR("Found no grid named '" + grid_name + "'.");
+  }
+  return found_grid->second;
+}
+
+VolumeFileCache::VolumeFileCache() = default;
+VolumeFileCache::VolumeFileCache(VolumeFileCache&& /*rhs*/) = default;
+VolumeFileCache& VolumeFileCache::operator=(VolumeFileCache&& /*rhs*/) =
+    default;
+VolumeFileCache::~VolumeFileCache() = default;
+
+const h5::VolumeData& VolumeFileCache::volume_file(
+    const std::string& file_name, const std::string& subfile_path) {
+  auto open_file = open_files_.find(file_name);
+  if (open_file == open_files_.end()) {
+    open_file =
+        open_files_
+            .emplace(file_name,
+                     OpenFile{std::make_unique<
+                                  h5::H5File<h5::AccessType::ReadOnly>>(
+                                  file_name),
+                              "", nullptr})
+            .first;
+  }
+  auto& [file, open_subfile_path, open_volume_file] = open_file->second;
+  // An H5File holds only one open subfile at a time
+  if (open_volume_file == nullptr or open_subfile_path != subfile_path) {
+    file->close_current_object();
+    constexpr size_t version_number = 0;
+    open_volume_file =
+        &file->get<h5::VolumeData>(subfile_path, version_number);
+    open_subfile_path = subfile_path;
+  }
+  return *open_volume_file;
+}
+
+const VolumeFileIndex& VolumeFileCache::index(const std::string& file_name,
+                                              const std::string& subfile_path,
+                                              const size_t observation_id) {
+  auto& indices_in_file = indices_[std::make_pair(file_name, subfile_path)];
+  auto found_index = indices_in_file.find(observation_id);
+  if (found_index == indices_in_file.end()) {
+    found_index =
+        indices_in_file
+            .emplace(observation_id,
+                     VolumeFileIndex{volume_file(file_name, subfile_path),
+                                     observation_id})
+            .first;
+  }
+  return found_index->second;
+}
+
+void VolumeFileCache::pup(PUP::er& p) {
+  // The open files are not serialized. They are reopened on demand.
+  if (p.isUnpacking()) {
+    open_files_.clear();
+  }
+  p | indices_;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                 \
+  template Mesh<DIM(data)> VolumeFileIndex::mesh<DIM(data)>( \
+      const std::string& grid_name) const;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef INSTANTIATE
+#undef DIM
+}  // namespace importers
@@ -0,0 +1,139 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+
+/// \cond
+template <size_t Dim>
+class Mesh;
+namespace PUP {
+class er;
+}  // namespace PUP
+namespace h5 {
+template <AccessType Access_t>
+class H5File;
+class VolumeData;
+}  // namespace h5
+/// \endcond
+
+namespace importers {
+
+/*!
+ * \brief The grids in a volume data file at one observation, indexed by their
+ * name.
+ *
+ * \details The index holds the names, extents, bases and quadratures of all
+ * grids in the file and the offset of each grid's data into the contiguous
+ * tensor datasets. It is built once per file and observation by the
+ * `importers::VolumeFileCache`. Looking up a grid takes constant time, whereas
+ * `h5::offset_and_length_for_grid` and `h5::mesh_for_grid` search and sum over
+ * all grids in the file.
+ */
+class VolumeFileIndex {
+ public:
+  VolumeFileIndex() = default;
+  VolumeFileIndex(const h5::VolumeData& volume_file, size_t observation_id);
+
+  size_t observation_id() const { return observation_id_; }
+
+  double observation_value() const { return observation_value_; }
+
+  /// The names of all grids in the order they are stored in the file
+  const std::vector<std::string>& grid_names() const { return grid_names_; }
+
+  /// Whether or not the file holds data for the grid named `grid_name`
+  bool contains(const std::string& grid_name) const;
+
+  /// The offset and number of points of the data of the grid named
+  /// `grid_name` in the contiguous tensor datasets, like
+  /// `h5::offset_and_length_for_grid`
+  std::pair<size_t, size_t> offset_and_length(
+      const std::string& grid_name) const;
+
+  /// The mesh of the grid named `grid_name`, like `h5::mesh_for_grid`
+  template <size_t Dim>
+  Mesh<Dim> mesh(const std::string& grid_name) const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  size_t grid_index(const std::string& grid_name) const;
+
+  size_t observation_id_{std::numeric_limits<size_t>::max()};
+  double observation_value_{std::numeric_limits<double>::signaling_NaN()};
+  std::vector<std::string> grid_names_{};
+  std::vector<std::vector<size_t>> extents_{};
+  std::vector<std::vector<Spectral::Basis>> bases_{};
+  std::vector<std::vector<Spectral::Quadrature>> quadratures_{};
+  std::vector<size_t> offsets_{};
+  std::unordered_map<std::string, size_t> grid_indices_{};
+};
+
+/*!
+ * \brief Volume data files that the `importers::ElementDataReader` keeps open
+ * across reads, along with an index of the grids in each file.
+ *
+ * \details Opening a volume data file and reading the names and extents of
+ * all its grids is expensive for files with many elements, so the
+ * `importers::ElementDataReader` does it only once per file and reuses the
+ * open file and the `importers::VolumeFileIndex` in subsequent
+ * `importers::Actions::ReadAllVolumeDataAndDistribute` invocations, e.g. when
+ * importing multiple fields or multiple observations from the same files.
+ *
+ * The files are opened read-only, and they must not be modified while the
+ * reader keeps them open. Only the indices are serialized, so the files are
+ * reopened on demand after a restart from a checkpoint.
+ */
+class VolumeFileCache {
+ public:
+  VolumeFileCache();
+  VolumeFileCache(const VolumeFileCache& /*rhs*/) = delete;
+  VolumeFileCache& operator=(const VolumeFileCache& /*rhs*/) = delete;
+  VolumeFileCache(VolumeFileCache&& /*rhs*/);
+  VolumeFileCache& operator=(VolumeFileCache&& /*rhs*/);
+  ~VolumeFileCache();
+
+  /// The subfile `subfile_path` in the file `file_name`. The file is opened
+  /// on the first call and kept open.
+  const h5::VolumeData& volume_file(const std::string& file_name,
+                                    const std::string& subfile_path);
+
+  /// The grids in the subfile `subfile_path` in the file `file_name` at the
+  /// `observation_id`. The index is built on the first call and kept.
+  const VolumeFileIndex& index(const std::string& file_name,
+                               const std::string& subfile_path,
+                               size_t observation_id);
+
+  /// The number of files that are currently open
+  size_t number_of_open_files() const { return open_files_.size(); }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  struct OpenFile {
+    std::unique_ptr<h5::H5File<h5::AccessType::ReadOnly>> file;
+    std::string subfile_path;
+    const h5::VolumeData* volume_file;
+  };
+
+  std::unordered_map<std::string, OpenFile> open_files_{};
+  std::map<std::pair<std::string, std::string>,
+           std::map<size_t, VolumeFileIndex>>
+      indices_{};
+};
+}  // namespace importers
@@ -0,0 +1,245 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <thread>
+#include <utility>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/CollectiveVolumeData.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace observers {
+void VolumeWriteRequest::pup(PUP::er& p) {
+  p | file_name;
+  p | input_source;
+  p | subfile_name;
+  p | observation_hash;
+  p | observation_value;
+  p | volume_data;
+  p | serialized_domain;
+  p | serialized_functions_of_time;
+  p | collective;
+}
+
+AsyncVolumeWriter::AsyncVolumeWriter() : AsyncVolumeWriter(2) {}
+
+AsyncVolumeWriter::AsyncVolumeWriter(const size_t number_of_buffers)
+    : number_of_buffers_(number_of_buffers),
+      state_(std::make_unique<State>()) {
+  ASSERT(number_of_buffers_ > 0, "Need at least one buffer to stage data in.");
+}
+
+AsyncVolumeWriter& AsyncVolumeWriter::operator=(AsyncVolumeWriter&& rhs) {
+  if (this != &rhs) {
+    stop();
+    number_of_buffers_ = rhs.number_of_buffers_;
+    state_ = std::move(rhs.state_);
+  }
+  return *this;
+}
+
+AsyncVolumeWriter::~AsyncVolumeWriter() { stop(); }
+
+double AsyncVolumeWriter::write(
+    const gsl::not_null<Parallel::NodeLock*> h5_file_lock,
+    VolumeWriteRequest request) {
+  if (state_ == nullptr) {
+    state_ = std::make_unique<State>();
+  }
+  std::unique_lock lock(state_->mutex);
+  rethrow_error(state_.get());
+  if (not state_->thread.joinable()) {
+    state_->stop = false;
+    state_->thread = std::thread(&AsyncVolumeWriter::run, state_.get());
+  }
+  double blocked_time = 0.0;
+  const auto buffer_is_free = [this]() {
+    return state_->pending.size() + (state_->writing ? 1 : 0) <
+           number_of_buffers_;
+  };
+  if (not buffer_is_free()) {
+    const double start_time = sys::wall_time();
+    state_->request_written.wait(lock, [this, &buffer_is_free]() {
+      return buffer_is_free() or state_->error != nullptr;
+    });
+    rethrow_error(state_.get());
+    blocked_time = sys::wall_time() - start_time;
+    ++state_->statistics.blocked_writes;
+    state_->statistics.blocked_time += blocked_time;
+  }
+  state_->pending.emplace_back(h5_file_lock, std::move(request));
+  ++state_->statistics.writes;
+  lock.unlock();
+  state_->work_available.notify_one();
+  return blocked_time;
+}
+
+void AsyncVolumeWriter::wait_until_written() {
+  if (state_ == nullptr) {
+    return;
+  }
+  std::unique_lock lock(state_->mutex);
+  state_->request_written.wait(lock, [this]() {
+    return (state_->pending.empty() and not state_->writing) or
+           state_->error != nullptr;
+  });
+  rethrow_error(state_.get());
+}
+
+bool AsyncVolumeWriter::wait_until_written(const double timeout_in_seconds) {
+  if (state_ == nullptr) {
+    return true;
+  }
+  std::unique_lock lock(state_->mutex);
+  const bool written = state_->request_written.wait_for(
+      lock, std::chrono::duration<double>(timeout_in_seconds), [this]() {
+        return (state_->pending.empty() and not state_->writing) or
+               state_->error != nullptr;
+      });
+  rethrow_error(state_.get());
+  return written;
+}
+
+bool AsyncVolumeWriter::arm_waiter() {
+  if (state_ == nullptr) {
+    state_ = std::make_unique<State>();
+  }
+  const std::lock_guard lock(state_->mutex);
+  if (state_->waiter_armed) {
+    return false;
+  }
+  state_->waiter_armed = true;
+  return true;
+}
+
+bool AsyncVolumeWriter::wait_until_written_and_disarm(
+    const double timeout_in_seconds) {
+  if (state_ == nullptr) {
+    return true;
+  }
+  std::unique_lock lock(state_->mutex);
+  const bool written = state_->request_written.wait_for(
+      lock, std::chrono::duration<double>(timeout_in_seconds), [this]() {
+        return (state_->pending.empty() and not state_->writing) or
+               state_->error != nullptr;
+      });
+  if (written) {
+    state_->waiter_armed = false;
+  }
+  rethrow_error(state_.get());
+  return written;
+}
+
+AsyncVolumeWriter::Statistics AsyncVolumeWriter::statistics() const {
+  if (state_ == nullptr) {
+    return {};
+  }
+  const std::lock_guard lock(state_->mutex);
+  return state_->statistics;
+}
+
+void AsyncVolumeWriter::pup(PUP::er& p) {
+  if (not p.isUnpacking()) {
+    wait_until_written();
+  }
+  p | number_of_buffers_;
+  if (p.isUnpacking()) {
+    stop();
+    state_ = std::make_unique<State>();
+  }
+}
+
+void AsyncVolumeWriter::run(const gsl::not_null<State*> state) {
+  std::unique_lock lock(state->mutex);
+  while (true) {
+    state->work_available.wait(
+        lock, [&state]() { return state->stop or not state->pending.empty(); });
+    if (state->pending.empty()) {
+      return;
+    }
+    auto [h5_file_lock, request] = std::move(state->pending.front());
+    state->pending.pop_front();
+    state->writing = true;
+    lock.unlock();
+
+    const double start_time = sys::wall_time();
+    std::exception_ptr error{};
+    try {
+      const std::lock_guard hold_lock(*h5_file_lock);
+      constexpr size_t version_number = 0;
+      if (request.collective) {
+#ifdef SPECTRE_PARALLEL_HDF5
+        h5::write_volume_data_collectively(
+            MPI_COMM_WORLD, request.file_name, request.input_source,
+            request.subfile_name, version_number, request.observation_hash,
+            request.observation_value, request.volume_data,
+            request.serialized_domain, request.serialized_functions_of_time);
+#else
+        ERROR(
+            "Collective volume data output requires building with "
+            "SPECTRE_PARALLEL_HDF5.");
+#endif  // SPECTRE_PARALLEL_HDF5
+      } else {
+        // Scoping is for closing HDF5 file before we release the lock.
+        h5::H5File<h5::AccessType::ReadWrite> h5_file(request.file_name, true,
+                                                      request.input_source);
+        auto& volume_file = h5_file.try_insert<h5::VolumeData>(
+            request.subfile_name, version_number);
+        volume_file.write_volume_data(
+            request.observation_hash, request.observation_value,
+            request.volume_data, request.serialized_domain,
+            request.serialized_functions_of_time);
+      }
+    } catch (...) {
+      error = std::current_exception();
+    }
+    const double write_time = sys::wall_time() - start_time;
+
+    lock.lock();
+    state->writing = false;
+    state->statistics.write_time += write_time;
+    if (error != nullptr and state->error == nullptr) {
+      state->error = error;
+    }
+    state->request_written.notify_all();
+  }
+}
+
+void AsyncVolumeWriter::stop() {
+  if (state_ == nullptr or not state_->thread.joinable()) {
+    return;
+  }
+  {
+    const std::lock_guard lock(state_->mutex);
+    state_->stop = true;
+  }
+  state_->work_available.notify_one();
+  // The thread writes all pending requests before it stops
+  state_->thread.join();
+}
+
+void AsyncVolumeWriter::rethrow_error(const gsl::not_null<State*> state) {
+  if (state->error != nullptr) {
+    std::exception_ptr error{};
+    std::swap(error, state->error);
+    std::rethrow_exception(error);
+  }
+}
+}  // namespace observers
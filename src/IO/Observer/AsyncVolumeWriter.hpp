@@ -0,0 +1,159 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/TensorData.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace Parallel {
+class NodeLock;
+}  // namespace Parallel
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/// Everything needed to write the volume data of one observation to an
+/// `h5::VolumeData` subfile.
+struct VolumeWriteRequest {
+  /// The name of the HDF5 file, including the `.h5` extension
+  std::string file_name{};
+  std::string input_source{};
+  std::string subfile_name{};
+  size_t observation_hash{};
+  double observation_value{};
+  std::vector<ElementVolumeData> volume_data{};
+  std::optional<std::vector<char>> serialized_domain{};
+  std::optional<std::vector<char>> serialized_functions_of_time{};
+  /// Write the data of all nodes to `file_name` collectively with
+  /// `h5::write_volume_data_collectively`. Only supported when built with
+  /// `SPECTRE_PARALLEL_HDF5`, see `observers::CollectiveVolumeWrites`.
+  bool collective{false};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+
+/*!
+ * \brief Writes volume data to disk on a dedicated thread so that the
+ * `ObserverWriter` does not block while HDF5 compresses and flushes the data.
+ *
+ * \details Up to `number_of_buffers()` observations are staged at a time: with
+ * the default of two, one observation is being written while the next one
+ * waits. A call to `write()` blocks only when all buffers are full, i.e. when
+ * observations are produced faster than they can be written. The time spent
+ * blocked is returned by `write()` and accumulated in `statistics()` so the
+ * number of buffers can be chosen.
+ *
+ * The I/O thread is started on the first call to `write()` and holds the
+ * `h5_file_lock` passed with each request while it accesses the file, since
+ * HDF5 is not assumed to be thread-safe. An error raised while writing is
+ * rethrown by the next call to `write()` or `wait_until_written()`.
+ *
+ * Requests with `VolumeWriteRequest::collective` set are written with MPI-IO
+ * over `MPI_COMM_WORLD` from the I/O thread, so MPI must be initialized with
+ * `MPI_THREAD_MULTIPLE` and every process must write the same observations in
+ * the same order, otherwise the collective calls deadlock. The
+ * `observers::CollectiveVolumeWrites` agreed upon by all nodes guarantee this.
+ *
+ * \note The I/O thread does not send any Charm++ messages, so quiescence
+ * detection does not know about the writes in flight. Callers must keep a
+ * message alive while data is pending, see
+ * `observers::ThreadedActions::WaitForVolumeWrites`.
+ *
+ * \warning Serializing waits until all pending data is written. The
+ * statistics are not serialized.
+ */
+class AsyncVolumeWriter {
+ public:
+  struct Statistics {
+    size_t writes{0};
+    /// Number of calls to `write()` that had to wait for a free buffer
+    size_t blocked_writes{0};
+    /// Total time spent waiting for a free buffer in `write()`
+    double blocked_time{0.0};
+    /// Total time the I/O thread spent writing
+    double write_time{0.0};
+  };
+
+  AsyncVolumeWriter();
+  explicit AsyncVolumeWriter(size_t number_of_buffers);
+  AsyncVolumeWriter(const AsyncVolumeWriter&) = delete;
+  AsyncVolumeWriter& operator=(const AsyncVolumeWriter&) = delete;
+  AsyncVolumeWriter(AsyncVolumeWriter&&) = default;
+  AsyncVolumeWriter& operator=(AsyncVolumeWriter&& rhs);
+  /// Waits until all pending data is written.
+  ~AsyncVolumeWriter();
+
+  size_t number_of_buffers() const { return number_of_buffers_; }
+
+  /// Hand `request` to the I/O thread. Returns the time in seconds spent
+  /// waiting for a free buffer.
+  double write(gsl::not_null<Parallel::NodeLock*> h5_file_lock,
+               VolumeWriteRequest request);
+
+  /// Block until all data passed to `write()` is on disk.
+  void wait_until_written();
+
+  /// Block until all data passed to `write()` is on disk or until
+  /// `timeout_in_seconds` have passed. Returns `true` if all data is on disk.
+  bool wait_until_written(double timeout_in_seconds);
+
+  /// Mark that a waiter (see `observers::ThreadedActions::WaitForVolumeWrites`)
+  /// keeps a message alive until the pending data is on disk. Returns `false`
+  /// if a waiter is already armed, so only one waiter per writer is scheduled.
+  bool arm_waiter();
+
+  /// Like `wait_until_written(double)`, but also disarms the waiter (see
+  /// `arm_waiter()`) if all data is on disk. Checking and disarming happen
+  /// atomically, so data written concurrently either is seen by this waiter or
+  /// arms a new one.
+  bool wait_until_written_and_disarm(double timeout_in_seconds);
+
+  Statistics statistics() const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  // The state shared with the I/O thread lives on the heap so that the writer
+  // can be moved while the thread is running.
+  struct State {
+    std::mutex mutex{};
+    // Signaled when a request is added or the thread should stop
+    std::condition_variable work_available{};
+    // Signaled when a request has been written
+    std::condition_variable request_written{};
+    std::deque<std::pair<Parallel::NodeLock*, VolumeWriteRequest>> pending{};
+    bool writing{false};
+    bool stop{false};
+    bool waiter_armed{false};
+    std::exception_ptr error{};
+    Statistics statistics{};
+    std::thread thread{};
+  };
+
+  static void run(gsl::not_null<State*> state);
+  void stop();
+  // Must be called with the mutex held
+  static void rethrow_error(gsl::not_null<State*> state);
+
+  size_t number_of_buffers_{2};
+  std::unique_ptr<State> state_{};
+};
+}  // namespace observers
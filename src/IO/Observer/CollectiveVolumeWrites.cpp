@@ -0,0 +1,82 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/CollectiveVolumeWrites.hpp"
+
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <utility>
+#include <vector>
+
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace observers {
+void CollectiveVolumeWrites::stage(const ObservationId& observation_id,
+                                   VolumeWriteRequest request) {
+  if (UNLIKELY(not staged_.emplace(observation_id, std::move(request))
+                       .second)) {
+    ERROR("Already staged volume data for a collective write of observation "
+          << observation_id);
+  }
+}
+
+CollectiveVolumeWrites::Readiness CollectiveVolumeWrites::node_is_ready(
+    const ObservationId& observation_id, const int node,
+    const int number_of_nodes) {
+  Readiness result{};
+  result.first_node = nodes_ready_.count(observation_id) == 0;
+  auto& nodes_ready = nodes_ready_[observation_id];
+  if (UNLIKELY(not nodes_ready.insert(node).second)) {
+    ERROR("Node " << node
+                  << " is already ready for the collective write of "
+                     "observation "
+                  << observation_id);
+  }
+  if (nodes_ready.size() == static_cast<size_t>(number_of_nodes)) {
+    result.sequence_number = next_sequence_number_;
+    ++next_sequence_number_;
+    nodes_ready_.erase(observation_id);
+  }
+  return result;
+}
+
+std::vector<VolumeWriteRequest> CollectiveVolumeWrites::schedule(
+    const size_t sequence_number, const ObservationId& observation_id) {
+  if (UNLIKELY(sequence_number < next_sequence_number_to_write_ or
+               not scheduled_.emplace(sequence_number, observation_id)
+                       .second)) {
+    ERROR("Collective volume write number "
+          << sequence_number << " of observation " << observation_id
+          << " was already scheduled.");
+  }
+  std::vector<VolumeWriteRequest> result{};
+  for (auto next = scheduled_.find(next_sequence_number_to_write_);
+       next != scheduled_.end();
+       next = scheduled_.find(next_sequence_number_to_write_)) {
+    const auto staged = staged_.find(next->second);
+    if (UNLIKELY(staged == staged_.end())) {
+      ERROR("No volume data was staged for the collective write of "
+            "observation "
+            << next->second);
+    }
+    result.push_back(std::move(staged->second));
+    staged_.erase(staged);
+    scheduled_.erase(next);
+    ++next_sequence_number_to_write_;
+  }
+  return result;
+}
+
+void CollectiveVolumeWrites::pup(PUP::er& p) {
+  p | lock_;
+  p | staged_;
+  p | nodes_ready_;
+  p | next_sequence_number_;
+  p | scheduled_;
+  p | next_sequence_number_to_write_;
+}
+}  // namespace observers
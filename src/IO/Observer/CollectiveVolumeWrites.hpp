@@ -0,0 +1,91 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "Parallel/NodeLock.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/*!
+ * \brief Bookkeeping that lets all nodes write their volume data collectively
+ * to a single file.
+ *
+ * \details A collective write is an MPI collective, so every node must take
+ * part in it, and all nodes must write the observations in the same order.
+ * Neither is guaranteed by the observers: a node may have no elements
+ * contributing to an observation (e.g. the elements of an array section, or
+ * the elements after AMR or load balancing), and observations can complete in
+ * different orders on different nodes. Therefore the writes are agreed upon
+ * as follows:
+ *
+ * - When a node has received the data of all its contributors to an
+ *   observation it calls `stage()` and tells node 0 that it is ready.
+ * - When node 0 hears of an observation for the first time it asks all nodes
+ *   to join it. Nodes without contributors to the observation stage an empty
+ *   request and tell node 0 that they are ready, nodes with contributors do
+ *   nothing.
+ * - Once all nodes are ready (see `node_is_ready()`), node 0 assigns the
+ *   observation the next sequence number and sends it to all nodes.
+ * - Each node passes the sequence number to `schedule()`, which returns the
+ *   staged requests in the order of their sequence numbers. These are handed
+ *   to the `AsyncVolumeWriter`, whose I/O thread writes them in that order.
+ */
+class CollectiveVolumeWrites {
+ public:
+  /// What node 0 has to do after a node reported that it is ready.
+  struct Readiness {
+    /// This is the first node that is ready for the observation, so all
+    /// nodes must be asked to join the write.
+    bool first_node{false};
+    /// Set once all nodes are ready, in which case all nodes must be told to
+    /// write the observation with this sequence number.
+    std::optional<size_t> sequence_number{};
+  };
+
+  /// Must be held while calling the other member functions. It must also be
+  /// held while the requests returned by `schedule()` are handed to the
+  /// `AsyncVolumeWriter`, so that concurrent calls can't reorder them.
+  Parallel::NodeLock& lock() { return lock_; }
+
+  /// Stage the `request` of this node for `observation_id`.
+  void stage(const ObservationId& observation_id, VolumeWriteRequest request);
+
+  /// Record on node 0 that `node` is ready to write `observation_id`.
+  Readiness node_is_ready(const ObservationId& observation_id, int node,
+                          int number_of_nodes);
+
+  /// Schedule the staged request for `observation_id` to be written with the
+  /// `sequence_number` assigned by node 0. Returns the requests that can be
+  /// written now, in order, i.e. the requests following the last request
+  /// returned without a gap in the sequence numbers.
+  std::vector<VolumeWriteRequest> schedule(size_t sequence_number,
+                                           const ObservationId& observation_id);
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  Parallel::NodeLock lock_{};
+  std::unordered_map<ObservationId, VolumeWriteRequest> staged_{};
+  // Only used on node 0
+  std::unordered_map<ObservationId, std::unordered_set<int>> nodes_ready_{};
+  size_t next_sequence_number_{0};
+  std::map<size_t, ObservationId> scheduled_{};
+  size_t next_sequence_number_to_write_{0};
+};
+}  // namespace observers
@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <string>
+#include <vector>
+
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Reduction.hpp"
@@ -40,12 +44,18 @@ std::string input_source_from_cache(
   if constexpr (tmpl::list_contains_v<
                     ::Parallel::get_const_global_cache_tags<Metavariables>,
                     ::Parallel::Tags::InputSource>) {
-    const std::vector<std::string> input_source_vector{
-        Parallel::get<::Parallel::Tags::InputSource>(cache)};
+    // This is called for every reduction that is written, so concatenate the
+    // input files in place instead of copying them first
+    const std::vector<std::string>& input_source_vector =
+        Parallel::get<::Parallel::Tags::InputSource>(cache);
+    size_t total_size = 0;
+    for (const auto& input_file : input_source_vector) {
+      total_size += input_file.size();
+    }
     std::string input_source{};
-    for (auto it = input_source_vector.begin(); it != input_source_vector.end();
-         ++it) {
-      input_source += *it;
+    input_source.reserve(total_size);
+    for (const auto& input_file : input_source_vector) {
+      input_source += input_file;
     }
     return input_source;
   } else {
@@ -71,7 +71,8 @@ struct InitializeWriter {
                  Tags::ContributorsOfTensorData, Tags::VolumeDataLock,
                  Tags::TensorData, Tags::InterpolatorTensorData,
                  Tags::NodesExpectedToContributeReductions,
-                 Tags::NodesThatContributedReductions, Tags::H5FileLock>,
+                 Tags::NodesThatContributedReductions, Tags::H5FileLock,
+                 Tags::AsyncVolumeWriter, Tags::CollectiveVolumeWrites>,
       typename Metavariables::observed_reduction_data_tags,
       tmpl::transform<
           typename Metavariables::observed_reduction_data_tags,
@@ -52,7 +52,7 @@ struct ObserverWriter {
   using chare_type = Parallel::Algorithms::Nodegroup;
   using const_global_cache_tags =
       tmpl::list<Tags::ReductionFileName, Tags::VolumeFileName,
-                 ::Parallel::Tags::InputSource>;
+                 Tags::CollectiveVolumeOutput, ::Parallel::Tags::InputSource>;
   using metavariables = Metavariables;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       Parallel::Phase::Initialization,
@@ -16,11 +16,14 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/TensorData.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+#include "IO/Observer/CollectiveVolumeWrites.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "Options/String.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/Reduction.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/PrettyType.hpp"
 
 namespace observers {
@@ -151,6 +154,18 @@ struct H5FileLock : db::SimpleTag {
   using type = Parallel::NodeLock;
 };
 
+/// Writes the volume data of the observations on this node to disk on a
+/// separate thread.
+struct AsyncVolumeWriter : db::SimpleTag {
+  using type = observers::AsyncVolumeWriter;
+};
+
+/// Agrees with the other nodes on the order of the volume data writes when
+/// `Tags::CollectiveVolumeOutput` is enabled.
+struct CollectiveVolumeWrites : db::SimpleTag {
+  using type = observers::CollectiveVolumeWrites;
+};
+
 /*!
  * \brief A string identifying observations related to the `Tag`.
  *
@@ -190,6 +205,16 @@ struct VolumeFileName {
   using group = Group;
 };
 
+/// Write the volume data of all nodes collectively to a single H5 file.
+struct CollectiveVolumeOutput {
+  using type = bool;
+  static constexpr Options::String help = {
+      "Write the volume data of all nodes collectively to a single file "
+      "'VolumeFileName.h5' with MPI-IO instead of writing one file per node. "
+      "Requires building with SPECTRE_PARALLEL_HDF5."};
+  using group = Group;
+};
+
 /// The name of the H5 file on disk to which all reduction data is written.
 struct ReductionFileName {
   using type = std::string;
@@ -227,6 +252,28 @@ struct VolumeFileName : db::SimpleTag {
   }
 };
 
+/// \brief Whether the volume data of all nodes is written collectively to a
+/// single file `VolumeFileName.h5` instead of to one file per node.
+///
+/// \see observers::CollectiveVolumeWrites
+struct CollectiveVolumeOutput : db::SimpleTag {
+  using type = bool;
+  using option_tags =
+      tmpl::list<::observers::OptionTags::CollectiveVolumeOutput>;
+
+  static constexpr bool pass_metavariables = false;
+  static bool create_from_options(const bool collective_volume_output) {
+#ifndef SPECTRE_PARALLEL_HDF5
+    if (collective_volume_output) {
+      ERROR_NO_TRACE(
+          "Collective volume output requires building with "
+          "SPECTRE_PARALLEL_HDF5.");
+    }
+#endif  // SPECTRE_PARALLEL_HDF5
+    return collective_volume_output;
+  }
+};
+
 /// \brief The name of the HDF5 file on disk into which reduction data is
 /// written.
 ///
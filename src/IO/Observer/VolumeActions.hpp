@@ -7,6 +7,7 @@
 #include <iterator>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <unordered_map>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -18,6 +19,8 @@
 #include "IO/H5/File.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+#include "IO/Observer/CollectiveVolumeWrites.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
@@ -28,6 +31,7 @@
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
+#include "Parallel/Printf/Printf.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -41,7 +45,11 @@
 namespace observers {
 /// \cond
 namespace ThreadedActions {
+struct CollectiveVolumeDataIsReady;
 struct ContributeVolumeDataToWriter;
+struct JoinCollectiveVolumeWrite;
+struct WaitForVolumeWrites;
+struct WriteCollectiveVolumeData;
 }  // namespace ThreadedActions
 /// \endcond
 namespace Actions {
@@ -157,12 +165,84 @@ void write_data(const std::string& h5_file_name,
                 const std::string& subfile_path,
                 const observers::ObservationId& observation_id,
                 std::vector<ElementVolumeData>&& volume_data);
+
+// Everything needed to write an observation except the volume data
+template <typename Metavariables>
+VolumeWriteRequest make_write_request(
+    Parallel::GlobalCache<Metavariables>& cache,
+    const observers::ObservationId& observation_id,
+    const std::string& subfile_name, const int my_node,
+    const bool collective) {
+  VolumeWriteRequest request{};
+  const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
+  request.file_name =
+      collective ? file_prefix + ".h5"
+                 : file_prefix + std::to_string(my_node) + ".h5";
+  request.collective = collective;
+  request.input_source = observers::input_source_from_cache(cache);
+  request.subfile_name = subfile_name;
+  request.observation_hash = observation_id.hash();
+  request.observation_value = observation_id.value();
+  // Serialize domain. See `Domain` docs for details on the serialization.
+  // The domain is retrieved from the global cache using the standard
+  // domain tag. If more flexibility is required here later, then the
+  // domain can be passed along with the `ContributeVolumeData` action.
+  request.serialized_domain = serialize(
+      Parallel::get<domain::Tags::Domain<Metavariables::volume_dim>>(cache));
+  // Functions-of-time are in the _mutable_ global cache, so they aren't
+  // accessible through the DataBox by default
+  if constexpr (Parallel::is_in_global_cache<Metavariables,
+                                             domain::Tags::FunctionsOfTime>) {
+    request.serialized_functions_of_time =
+        serialize(get<domain::Tags::FunctionsOfTime>(cache));
+  }
+  return request;
+}
+
+// Hand the `request` to the I/O thread of this node
+template <typename ParallelComponent, typename Metavariables>
+void hand_to_writer(Parallel::GlobalCache<Metavariables>& cache,
+                    const gsl::not_null<AsyncVolumeWriter*> volume_writer,
+                    const gsl::not_null<Parallel::NodeLock*> volume_file_lock,
+                    VolumeWriteRequest request) {
+  auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+  const int my_node =
+      Parallel::my_node<int>(*Parallel::local_branch(my_proxy));
+  const std::string subfile_name = request.subfile_name;
+  const double observation_value = request.observation_value;
+  // Writing can be very time consuming (it's network dependent, depends
+  // on how full the disks are, what other users are doing, etc.) so the
+  // data is handed to the I/O thread of this node, which takes the
+  // H5FileLock while it writes. This only blocks if the previous
+  // observations are still being written.
+  const double blocked_time =
+      volume_writer->write(volume_file_lock, std::move(request));
+  if (UNLIKELY(blocked_time > 0.0)) {
+    const auto statistics = volume_writer->statistics();
+    Parallel::printf(
+        "Node %d waited %f s to write volume data to %s at %f because all "
+        "%zu buffers were full. In total %zu of %zu volume data writes on "
+        "this node waited for %f s.\n",
+        my_node, blocked_time, subfile_name, observation_value,
+        volume_writer->number_of_buffers(), statistics.blocked_writes,
+        statistics.writes, statistics.blocked_time);
+  }
+  // Keep a message alive until the data is on disk so that quiescence
+  // is not detected while the I/O thread is still writing. A single
+  // waiter per node covers all writes in flight.
+  if (volume_writer->arm_waiter()) {
+    Parallel::threaded_action<WaitForVolumeWrites>(my_proxy[my_node]);
+  }
+}
 }  // namespace VolumeActions_detail
 /*!
  * \ingroup ObserversGroup
  * \brief Move data to the observer writer for writing to disk.
  *
  * Once data from all cores is collected this action writes the data to disk.
+ * With `Tags::CollectiveVolumeOutput` the data of all nodes is written to a
+ * single file in a collective write, which all nodes first agree on as
+ * described in `observers::CollectiveVolumeWrites`.
  */
 struct ContributeVolumeDataToWriter {
   template <typename ParallelComponent, typename DbTagsList,
@@ -225,15 +305,19 @@ struct ContributeVolumeDataToWriter {
                        std::unordered_set<Parallel::ArrayComponentId>>*
         volume_observers_contributed = nullptr;
     Parallel::NodeLock* volume_data_lock = nullptr;
+    AsyncVolumeWriter* volume_writer = nullptr;
+    CollectiveVolumeWrites* collective_writes = nullptr;
     size_t observations_registered_with_id = std::numeric_limits<size_t>::max();
 
     {
       const std::lock_guard hold_lock(*node_lock);
       db::mutate<TensorDataTag, Tags::ContributorsOfTensorData,
-                 Tags::VolumeDataLock, Tags::H5FileLock>(
+                 Tags::VolumeDataLock, Tags::H5FileLock,
+                 Tags::AsyncVolumeWriter, Tags::CollectiveVolumeWrites>(
           [&observation_id, &observations_registered_with_id,
            &observer_group_id, &all_volume_data, &volume_observers_contributed,
-           &volume_data_lock, &volume_file_lock](
+           &volume_data_lock, &volume_file_lock, &volume_writer,
+           &collective_writes](
               const gsl::not_null<typename TensorDataTag::type*>
                   volume_data_ptr,
               const gsl::not_null<std::unordered_map<
@@ -242,6 +326,9 @@ struct ContributeVolumeDataToWriter {
                   volume_observers_contributed_ptr,
               const gsl::not_null<Parallel::NodeLock*> volume_data_lock_ptr,
               const gsl::not_null<Parallel::NodeLock*> volume_file_lock_ptr,
+              const gsl::not_null<AsyncVolumeWriter*> volume_writer_ptr,
+              const gsl::not_null<CollectiveVolumeWrites*>
+                  collective_writes_ptr,
               const std::unordered_map<
                   ObservationKey,
                   std::unordered_set<Parallel::ArrayComponentId>>&
@@ -271,6 +358,8 @@ struct ContributeVolumeDataToWriter {
             observations_registered_with_id =
                 observations_registered.at(key).size();
             volume_file_lock = &*volume_file_lock_ptr;
+            volume_writer = &*volume_writer_ptr;
+            collective_writes = &*collective_writes_ptr;
           },
           make_not_null(&box),
           db::get<Tags::ExpectedContributorsForObservations>(box));
@@ -284,6 +373,10 @@ struct ContributeVolumeDataToWriter {
            "Failed to set volume_observers_contributed in the mutate");
     ASSERT(volume_data_lock != nullptr,
            "Failed to set volume_data_lock in the mutate");
+    ASSERT(volume_writer != nullptr,
+           "Failed to set volume_writer in the mutate");
+    ASSERT(collective_writes != nullptr,
+           "Failed to set collective_writes in the mutate");
     ASSERT(
         observations_registered_with_id != std::numeric_limits<size_t>::max(),
         "Failed to set observations_registered_with_id when mutating the "
@@ -328,14 +421,26 @@ struct ContributeVolumeDataToWriter {
       ASSERT(not volume_data.empty(),
              "Failed to populate volume_data before trying to write it.");
 
-      std::vector<ElementVolumeData> volume_data_to_write;
+      auto& my_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      const int my_node =
+          Parallel::my_node<int>(*Parallel::local_branch(my_proxy));
+      bool collective = false;
+      if constexpr (Parallel::is_in_global_cache<
+                        Metavariables, Tags::CollectiveVolumeOutput>) {
+        collective = Parallel::get<Tags::CollectiveVolumeOutput>(cache);
+      }
+      VolumeWriteRequest request = VolumeActions_detail::make_write_request(
+          cache, observation_id, subfile_name, my_node, collective);
+      std::vector<ElementVolumeData>& volume_data_to_write =
+          request.volume_data;
 
       if constexpr (std::is_same_v<tmpl::at_c<VolumeDataAtObsId, 1>,
                                    ElementVolumeData>) {
         volume_data_to_write.reserve(volume_data.size());
-        for (const auto& [id, element] : volume_data) {
+        for (auto& [id, element] : volume_data) {
           (void)id;  // avoid compiler warnings
-          volume_data_to_write.push_back(element);
+          volume_data_to_write.push_back(std::move(element));
         }
       } else {
         size_t total_size = 0;
@@ -345,62 +450,210 @@ struct ContributeVolumeDataToWriter {
         }
         volume_data_to_write.reserve(total_size);
 
-        for (const auto& [id, vec_elements] : volume_data) {
+        for (auto& [id, vec_elements] : volume_data) {
           (void)id;  // avoid compiler warnings
-          volume_data_to_write.insert(volume_data_to_write.end(),
-                                      vec_elements.begin(), vec_elements.end());
+          volume_data_to_write.insert(
+              volume_data_to_write.end(),
+              std::make_move_iterator(vec_elements.begin()),
+              std::make_move_iterator(vec_elements.end()));
         }
       }
 
-      // Write to file. We use a separate node lock because writing can be
-      // very time consuming (it's network dependent, depends on how full the
-      // disks are, what other users are doing, etc.) and we want to be able
-      // to continue to work on the nodegroup while we are writing data to
-      // disk.
-      const std::lock_guard hold_lock(*volume_file_lock);
-      {
-        // Scoping is for closing HDF5 file before we release the lock.
-        const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
-        auto& my_proxy =
-            Parallel::get_parallel_component<ParallelComponent>(cache);
-        h5::H5File<h5::AccessType::ReadWrite> h5file(
-            file_prefix +
-                std::to_string(
-                    Parallel::my_node<int>(*Parallel::local_branch(my_proxy))) +
-                ".h5",
-            true, observers::input_source_from_cache(cache));
-        constexpr size_t version_number = 0;
-        auto& volume_file =
-            h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
-
-        // Serialize domain. See `Domain` docs for details on the serialization.
-        // The domain is retrieved from the global cache using the standard
-        // domain tag. If more flexibility is required here later, then the
-        // domain can be passed along with the `ContributeVolumeData` action.
-        const auto serialized_domain = serialize(
-            Parallel::get<domain::Tags::Domain<Metavariables::volume_dim>>(
-                cache));
-        const auto serialized_functions_of_time =
-            [&cache]() -> std::optional<std::vector<char>> {
-          // Functions-of-time are in the _mutable_ global cache, so they aren't
-          // accessible through the DataBox by default
-          if constexpr (Parallel::is_in_global_cache<
-                            Metavariables, domain::Tags::FunctionsOfTime>) {
-            return serialize(get<domain::Tags::FunctionsOfTime>(cache));
-          } else {
-            (void)cache;
-            return std::nullopt;
-          }
-        }();
-        // Write the data to the file
-        volume_file.write_volume_data(
-            observation_id.hash(), observation_id.value(), volume_data_to_write,
-            serialized_domain, serialized_functions_of_time);
+      if (collective) {
+        // All nodes write to the same file collectively, so the write is
+        // only handed to the I/O thread once node 0 has agreed on it with all
+        // nodes.
+        {
+          const std::lock_guard hold_lock(collective_writes->lock());
+          collective_writes->stage(observation_id, std::move(request));
+        }
+        Parallel::threaded_action<CollectiveVolumeDataIsReady>(
+            my_proxy[0], observation_id, subfile_name, my_node);
+      } else {
+        VolumeActions_detail::hand_to_writer<ParallelComponent>(
+            cache, make_not_null(volume_writer),
+            make_not_null(volume_file_lock), std::move(request));
       }
     }
   }
 };
 
+/*!
+ * \ingroup ObserversGroup
+ * \brief Tell node 0 that `node` has staged its volume data for the collective
+ * write of an observation.
+ *
+ * Invoked on the `ObserverWriter` of node 0. When the first node is ready, all
+ * nodes are asked to join the write with `JoinCollectiveVolumeWrite`. Once all
+ * nodes are ready, the write is assigned the next sequence number and all
+ * nodes are told to write it with `WriteCollectiveVolumeData`. See
+ * `observers::CollectiveVolumeWrites`.
+ */
+struct CollectiveVolumeDataIsReady {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const observers::ObservationId& observation_id,
+                    const std::string& subfile_name, const int node) {
+    CollectiveVolumeWrites* collective_writes = nullptr;
+    {
+      const std::lock_guard hold_lock(*node_lock);
+      collective_writes =
+          &db::get_mutable_reference<Tags::CollectiveVolumeWrites>(
+              make_not_null(&box));
+    }
+    auto& my_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    CollectiveVolumeWrites::Readiness readiness{};
+    {
+      const std::lock_guard hold_lock(collective_writes->lock());
+      readiness = collective_writes->node_is_ready(
+          observation_id, node,
+          Parallel::number_of_nodes<int>(*Parallel::local_branch(my_proxy)));
+    }
+    if (readiness.sequence_number.has_value()) {
+      Parallel::threaded_action<WriteCollectiveVolumeData>(
+          my_proxy, *readiness.sequence_number, observation_id);
+    } else if (readiness.first_node) {
+      Parallel::threaded_action<JoinCollectiveVolumeWrite>(
+          my_proxy, observation_id, subfile_name);
+    }
+  }
+};
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief Take part in the collective write of an observation even though no
+ * element on this node contributes to it.
+ *
+ * Invoked on the `ObserverWriter` of all nodes. Nodes with contributors to
+ * the observation ignore this action, since they report to node 0 once they
+ * have their data. The other nodes stage an empty write and report to node 0
+ * right away.
+ */
+struct JoinCollectiveVolumeWrite {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const observers::ObservationId& observation_id,
+                    const std::string& subfile_name) {
+    CollectiveVolumeWrites* collective_writes = nullptr;
+    bool has_contributors = false;
+    {
+      const std::lock_guard hold_lock(*node_lock);
+      const auto& registered =
+          db::get<Tags::ExpectedContributorsForObservations>(box);
+      const auto contributors =
+          registered.find(observation_id.observation_key());
+      has_contributors =
+          contributors != registered.end() and not contributors->second.empty();
+      collective_writes =
+          &db::get_mutable_reference<Tags::CollectiveVolumeWrites>(
+              make_not_null(&box));
+    }
+    if (has_contributors) {
+      return;
+    }
+    auto& my_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    const int my_node =
+        Parallel::my_node<int>(*Parallel::local_branch(my_proxy));
+    {
+      const std::lock_guard hold_lock(collective_writes->lock());
+      collective_writes->stage(
+          observation_id,
+          VolumeActions_detail::make_write_request(
+              cache, observation_id, subfile_name, my_node, true));
+    }
+    Parallel::threaded_action<CollectiveVolumeDataIsReady>(
+        my_proxy[0], observation_id, subfile_name, my_node);
+  }
+};
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief Hand the staged data of a collective write to the I/O thread of this
+ * node, in the order assigned by node 0.
+ *
+ * Invoked on the `ObserverWriter` of all nodes. The messages may arrive in any
+ * order, so writes are held back until all writes with lower sequence numbers
+ * have been handed to the I/O thread.
+ */
+struct WriteCollectiveVolumeData {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const size_t sequence_number,
+                    const observers::ObservationId& observation_id) {
+    CollectiveVolumeWrites* collective_writes = nullptr;
+    AsyncVolumeWriter* volume_writer = nullptr;
+    Parallel::NodeLock* volume_file_lock = nullptr;
+    {
+      const std::lock_guard hold_lock(*node_lock);
+      collective_writes =
+          &db::get_mutable_reference<Tags::CollectiveVolumeWrites>(
+              make_not_null(&box));
+      volume_writer = &db::get_mutable_reference<Tags::AsyncVolumeWriter>(
+          make_not_null(&box));
+      volume_file_lock =
+          &db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
+    }
+    // The lock is held while handing the requests to the I/O thread so that
+    // concurrent invocations can't reorder them.
+    const std::lock_guard hold_lock(collective_writes->lock());
+    for (auto& request :
+         collective_writes->schedule(sequence_number, observation_id)) {
+      VolumeActions_detail::hand_to_writer<ParallelComponent>(
+          cache, make_not_null(volume_writer), make_not_null(volume_file_lock),
+          std::move(request));
+    }
+  }
+};
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief Wait until the volume data handed to `Tags::AsyncVolumeWriter` on
+ * this node is on disk.
+ *
+ * The I/O thread does not send Charm++ messages, so without this action
+ * quiescence could be detected (e.g. to change phases or to exit) while volume
+ * data is still being written. To avoid blocking a core for the whole write,
+ * the action waits for at most a millisecond and then invokes itself again.
+ * Only one instance per node is pending at a time (see
+ * `observers::AsyncVolumeWriter::arm_waiter`), however many writes are in
+ * flight.
+ */
+struct WaitForVolumeWrites {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock) {
+    AsyncVolumeWriter* volume_writer = nullptr;
+    {
+      const std::lock_guard hold_lock(*node_lock);
+      volume_writer = &db::get_mutable_reference<Tags::AsyncVolumeWriter>(
+          make_not_null(&box));
+    }
+    if (not volume_writer->wait_until_written_and_disarm(1.0e-3)) {
+      auto& my_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      Parallel::threaded_action<WaitForVolumeWrites>(
+          my_proxy[Parallel::my_node<int>(*Parallel::local_branch(my_proxy))]);
+    }
+  }
+};
+
 /*!
  * \brief Write volume data (such as surface data) at a given time (specified by
  * an `ObservationId`) without the need to register or reduce anything, e.g.
@@ -116,11 +116,6 @@ void project_contiguous_data_to_boundary(
                                    ? volume_mesh.extents(sliced_dim) - 1
                                    : 0;
 
-    const size_t interface_grid_points =
-        volume_mesh.extents().slice_away(sliced_dim).product();
-    const size_t volume_grid_points = volume_mesh.number_of_grid_points();
-
-    const ValueType* vars_data = volume_fields.data();
     // Since the face fields are a superset of the volume tags we need to find
     // the first volume tag on the face and get the pointer for that.
     ValueType* interface_vars_data =
@@ -131,18 +126,9 @@ void project_contiguous_data_to_boundary(
     // function should replace data_on_slice in the long term since in
     // additional to supporting different volume and face tags, it also supports
     // Gauss and Gauss-Lobatto points.
-    //
-    // Run the SliceIterator as the outer-most loop since incrementing the slice
-    // iterator is surprisingly expensive.
-    for (SliceIterator si(volume_mesh.extents(), sliced_dim, fixed_index); si;
-         ++si) {
-      for (size_t i = 0; i < number_of_independent_components; ++i) {
-        // clang-tidy: do not use pointer arithmetic
-        interface_vars_data[si.slice_offset() +                      // NOLINT
-                            i * interface_grid_points] =             // NOLINT
-            vars_data[si.volume_offset() + i * volume_grid_points];  // NOLINT
-      }
-    }
+    copy_volume_to_slice(interface_vars_data, volume_fields.data(),
+                         volume_mesh.extents(), sliced_dim, fixed_index,
+                         number_of_independent_components);
   }
 }
 
@@ -198,33 +184,17 @@ void project_tensors_to_boundary(
                                    ? volume_mesh.extents(sliced_dim) - 1
                                    : 0;
 
-    const size_t interface_grid_points =
-        volume_mesh.extents().slice_away(sliced_dim).product();
-    const size_t volume_grid_points = volume_mesh.number_of_grid_points();
-
-    // Run the SliceIterator as the outer-most loop since incrementing the slice
-    // iterator is surprisingly expensive.
-    for (SliceIterator si(volume_mesh.extents(), sliced_dim, fixed_index); si;
-         ++si) {
-      tmpl::for_each<TagsToProjectList>([&face_fields, interface_grid_points,
-                                         &si, &volume_fields,
-                                         volume_grid_points](auto tag_v) {
-        using tag = typename decltype(tag_v)::type;
-
-        const double* vars_data = get<tag>(volume_fields)[0].data();
-        double* interface_vars_data = get<tag>(*face_fields)[0].data();
-        static constexpr size_t number_of_independent_components_in_tensor =
-            std::decay_t<decltype(get<tag>(volume_fields))>::size();
-
-        for (size_t i = 0; i < number_of_independent_components_in_tensor;
-             ++i) {
-          // clang-tidy: do not use pointer arithmetic
-          interface_vars_data[si.slice_offset() +                      // NOLINT
-                              i * interface_grid_points] =             // NOLINT
-              vars_data[si.volume_offset() + i * volume_grid_points];  // NOLINT
-        }
-      });
-    }
+    tmpl::for_each<TagsToProjectList>([&face_fields, fixed_index, sliced_dim,
+                                       &volume_fields,
+                                       &volume_mesh](auto tag_v) {
+      using tag = typename decltype(tag_v)::type;
+      static constexpr size_t number_of_independent_components_in_tensor =
+          std::decay_t<decltype(get<tag>(volume_fields))>::size();
+      copy_volume_to_slice(get<tag>(*face_fields)[0].data(),
+                           get<tag>(volume_fields)[0].data(),
+                           volume_mesh.extents(), sliced_dim, fixed_index,
+                           number_of_independent_components_in_tensor);
+    });
   }
 }
 
@@ -259,15 +229,11 @@ void project_tensor_to_boundary(
                                    ? volume_mesh.extents(sliced_dim) - 1
                                    : 0;
 
-    // Run the SliceIterator as the outer-most loop since incrementing the slice
-    // iterator is surprisingly expensive.
-    for (SliceIterator si(volume_mesh.extents(), sliced_dim, fixed_index); si;
-         ++si) {
-      for (size_t tensor_storage_index = 0;
-           tensor_storage_index < volume_field.size(); ++tensor_storage_index) {
-        (*face_field)[tensor_storage_index][si.slice_offset()] =
-            volume_field[tensor_storage_index][si.volume_offset()];
-      }
+    for (size_t tensor_storage_index = 0;
+         tensor_storage_index < volume_field.size(); ++tensor_storage_index) {
+      copy_volume_to_slice((*face_field)[tensor_storage_index].data(),
+                           volume_field[tensor_storage_index].data(),
+                           volume_mesh.extents(), sliced_dim, fixed_index, 1);
     }
   }
 }
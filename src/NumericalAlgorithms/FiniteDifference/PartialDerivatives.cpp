@@ -137,6 +137,57 @@ struct ComputeImpl<8, UnitStride> {
   }
 };
 
+// Computes the correction that turns the centered derivative of order `Order`
+// into the upwind-biased derivative of order `Order - 1` for a positive
+// advection velocity. The correction is proportional to the undivided
+// difference of order `Order`, so it uses the same stencil as the centered
+// derivative. Only the first weight is used, the others are zero.
+template <size_t Order>
+struct UpwindCorrectionImpl {
+  static constexpr size_t fd_order = Order;
+
+  SPECTRE_ALWAYS_INLINE static double pointwise(
+      const double* const q, const int stride,
+      const std::array<double, Order / 2>& weights) {
+    ASSERT(stride == 1, "The upwind correction needs unit stride but got "
+                            << stride);
+    (void)stride;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if constexpr (Order == 2) {
+      return weights[0] * (q[-1] + q[1] - 2.0 * q[0]);
+    } else if constexpr (Order == 4) {
+      return weights[0] *
+             (q[-2] + q[2] - 4.0 * (q[-1] + q[1]) + 6.0 * q[0]);
+    } else if constexpr (Order == 6) {
+      return weights[0] * (q[-3] + q[3] - 6.0 * (q[-2] + q[2]) +
+                           15.0 * (q[-1] + q[1]) - 20.0 * q[0]);
+    } else {
+      static_assert(Order == 8, "Unsupported upwind order");
+      return weights[0] * (q[-4] + q[4] - 8.0 * (q[-3] + q[3]) +
+                           28.0 * (q[-2] + q[2]) - 56.0 * (q[-1] + q[1]) +
+                           70.0 * q[0]);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  // The coefficient of the undivided difference is (-1)^m / (m C(2m, m)) with
+  // 2m = Order
+  static constexpr std::array<double, Order / 2> derivative_weights(
+      const double one_over_delta) {
+    std::array<double, Order / 2> result{};
+    if constexpr (Order == 2) {
+      result[0] = -0.5 * one_over_delta;
+    } else if constexpr (Order == 4) {
+      result[0] = 0.08333333333333333 * one_over_delta;
+    } else if constexpr (Order == 6) {
+      result[0] = -0.016666666666666666 * one_over_delta;
+    } else {
+      result[0] = 0.0035714285714285713 * one_over_delta;
+    }
+    return result;
+  }
+};
+
 template <typename DerivativeComputer, size_t Dim>
 void logical_partial_derivatives_fastest_dim(
     const gsl::not_null<gsl::span<double>*> derivative,
@@ -451,6 +502,77 @@ void logical_partial_derivatives(
       number_of_variables, fd_order);
 }
 
+template <size_t Dim>
+void logical_upwind_partial_derivatives(
+    const gsl::not_null<std::array<gsl::span<double>, Dim>*>
+        logical_derivatives,
+    const gsl::span<const double>& volume_vars,
+    const DirectionMap<Dim, gsl::span<const double>>& ghost_cell_vars,
+    const Mesh<Dim>& volume_mesh, const size_t number_of_variables,
+    const size_t fd_order,
+    const std::array<gsl::span<const double>, Dim>& logical_velocity) {
+  const size_t number_of_points = volume_mesh.number_of_grid_points();
+  for (size_t d = 0; d < Dim; ++d) {
+    ASSERT(gsl::at(logical_velocity, d).size() == number_of_points,
+           "The logical velocity must have one value per grid point ("
+               << number_of_points << ") but has size "
+               << gsl::at(logical_velocity, d).size() << " in dimension "
+               << d);
+  }
+  logical_partial_derivatives(logical_derivatives, volume_vars,
+                              ghost_cell_vars, volume_mesh,
+                              number_of_variables, fd_order);
+
+  DataVector buffer{Dim * volume_vars.size()};
+  std::array<gsl::span<double>, Dim> corrections{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(corrections, d) =
+        gsl::make_span(&buffer[d * volume_vars.size()], volume_vars.size());
+  }
+  switch (fd_order) {
+    case 2:
+      ::fd::logical_partial_derivatives_impl<UpwindCorrectionImpl<2>>(
+          make_not_null(&corrections), nullptr, volume_vars, ghost_cell_vars,
+          volume_mesh, number_of_variables);
+      break;
+    case 4:
+      ::fd::logical_partial_derivatives_impl<UpwindCorrectionImpl<4>>(
+          make_not_null(&corrections), nullptr, volume_vars, ghost_cell_vars,
+          volume_mesh, number_of_variables);
+      break;
+    case 6:
+      ::fd::logical_partial_derivatives_impl<UpwindCorrectionImpl<6>>(
+          make_not_null(&corrections), nullptr, volume_vars, ghost_cell_vars,
+          volume_mesh, number_of_variables);
+      break;
+    case 8:
+      ::fd::logical_partial_derivatives_impl<UpwindCorrectionImpl<8>>(
+          make_not_null(&corrections), nullptr, volume_vars, ghost_cell_vars,
+          volume_mesh, number_of_variables);
+      break;
+    default:
+      ERROR("Cannot do upwinded finite difference derivative of order "
+            << fd_order);
+  };
+
+  // Mirroring the stencil flips the sign of the correction
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto& velocity = gsl::at(logical_velocity, d);
+    auto& derivative = gsl::at(*logical_derivatives, d);
+    const auto& correction = gsl::at(corrections, d);
+    for (size_t var = 0; var < number_of_variables; ++var) {
+      const size_t offset = var * number_of_points;
+      for (size_t i = 0; i < number_of_points; ++i) {
+        if (velocity[i] > 0.0) {
+          derivative[offset + i] += correction[offset + i];
+        } else if (velocity[i] < 0.0) {
+          derivative[offset + i] -= correction[offset + i];
+        }
+      }
+    }
+  }
+}
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATION(r, data)                                                 \
@@ -466,7 +588,14 @@ void logical_partial_derivatives(
       const gsl::span<const double>& volume_vars,                              \
       const DirectionMap<DIM(data), gsl::span<const double>>& ghost_cell_vars, \
       const Mesh<DIM(data)>& volume_fd_mesh, size_t number_of_variables,       \
-      size_t fd_order);
+      size_t fd_order);                                                        \
+  template void logical_upwind_partial_derivatives(                            \
+      gsl::not_null<std::array<gsl::span<double>, DIM(data)>*> derivative,     \
+      const gsl::span<const double>& volume_vars,                              \
+      const DirectionMap<DIM(data), gsl::span<const double>>& ghost_cell_vars, \
+      const Mesh<DIM(data)>& volume_fd_mesh, size_t number_of_variables,       \
+      size_t fd_order,                                                         \
+      const std::array<gsl::span<const double>, DIM(data)>& logical_velocity);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
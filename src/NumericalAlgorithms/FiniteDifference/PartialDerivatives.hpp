@@ -47,6 +47,36 @@ void logical_partial_derivatives(
     const DirectionMap<Dim, gsl::span<const double>>& ghost_cell_vars,
     const Mesh<Dim>& volume_mesh, size_t number_of_variables, size_t fd_order);
 
+/*!
+ * \brief Compute upwind-biased logical partial derivatives for advection terms
+ * such as \f$\beta^i\partial_i u\f$.
+ *
+ * \details In each logical direction the derivative is biased towards the
+ * upwind side given by the sign of the corresponding component of
+ * `logical_velocity` at each grid point, e.g. the shift in logical
+ * coordinates. For an even `fd_order` \f$2m\f$ the upwind-biased derivative
+ * of order \f$2m-1\f$ is the centered derivative of order \f$2m\f$ plus
+ * a multiple of the undivided difference \f$\delta^{2m}\f$,
+ *
+ * \f{align*}{
+ * \partial^{\mathrm{up}} u_i = \partial^{(2m)} u_i +
+ *   \mathrm{sgn}(v_i) \frac{(-1)^m}{m \binom{2m}{m} \Delta x}
+ *   \delta^{2m} u_i,
+ * \f}
+ *
+ * which drops the point farthest downwind from the stencil. The stencil, and
+ * therefore the required ghost data, is the same as for the centered
+ * derivative of order `fd_order`. Where the velocity vanishes the centered
+ * derivative is used. Orders 2, 4, 6, and 8 are supported.
+ */
+template <size_t Dim>
+void logical_upwind_partial_derivatives(
+    gsl::not_null<std::array<gsl::span<double>, Dim>*> logical_derivatives,
+    const gsl::span<const double>& volume_vars,
+    const DirectionMap<Dim, gsl::span<const double>>& ghost_cell_vars,
+    const Mesh<Dim>& volume_mesh, size_t number_of_variables, size_t fd_order,
+    const std::array<gsl::span<const double>, Dim>& logical_velocity);
+
 /*!
  * \brief Compute the partial derivative on the `DerivativeFrame` using the
  * `inverse_jacobian`.
@@ -68,10 +68,13 @@ namespace fd {
  *   \f$u_{i-1}\f$ is at `u[-stride]`. The returned values are the
  *   reconstructed solution on the lower and upper side of the cell.
  *
- * \note Currently the stride is always one because we transpose the data before
- * reconstruction. However, it may be faster to have a non-unit stride without
- * the transpose. We have the `stride` parameter in the reconstruction schemes
- * to make testing performance easier in the future.
+ * \note The data is not transposed before reconstruction. Instead, in
+ * direction \f$i\f$ the stride is the product of the extents in the
+ * directions lower than \f$i\f$, and the ghost cells are read in place. All
+ * variables and all stencil lines that are adjacent in memory are
+ * reconstructed in one pass so that the loop vectorizes across lines. Cells
+ * near the element boundaries copy their stencil into a buffer and so have
+ * unit stride.
  *
  * Here is an ASCII illustration of the names of various quantities and where in
  * the cells they are:
@@ -5,12 +5,13 @@
 
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/StripeIterator.hpp"
-#include "DataStructures/Transpose.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionMap.hpp"
 #include "Domain/Structure/Side.hpp"
@@ -87,179 +88,159 @@ void reconstruct_impl(
     const gsl::span<const double>& lower_ghost_data,
     const gsl::span<const double>& upper_ghost_data,
     const Index<Dim>& volume_extents, const size_t number_of_variables,
-    const ArgsForReconstructor&... args_for_reconstructor) {
+    const size_t dim, const ArgsForReconstructor&... args_for_reconstructor) {
   using std::get;
   using std::min;
   constexpr size_t stencil_width = Reconstructor::stencil_width();
   ASSERT(stencil_width % 2 == 1, "The stencil with should be odd but got "
                                      << stencil_width
                                      << " for the reconstructor.");
-  const size_t ghost_zone_for_stencil = (stencil_width - 1) / 2;
+  constexpr size_t ghost_zone_for_stencil = (stencil_width - 1) / 2;
   // Assume we send one extra ghost cell so we can reconstruct our neighbor's
   // external data.
-  const size_t ghost_pts_in_neighbor_data = ghost_zone_for_stencil + 1;
-
+  constexpr size_t ghost_pts_in_neighbor_data = ghost_zone_for_stencil + 1;
+
+  const size_t extent = volume_extents[dim];
+  ASSERT(extent >= stencil_width - 1,
+         " Subcell volume extent (current value: "
+             << extent
+             << ") must be not smaller than the stencil width (current value: "
+             << stencil_width << ") minus 1");
+
+  // The volume data, the ghost data, and the reconstructed data are all
+  // ordered (x,y,z,vars). A stencil line in direction `dim` is therefore
+  // strided by the product of the extents in the lower dimensions, and
+  // `line_stride` neighboring lines are adjacent in memory. We loop over these
+  // adjacent lines innermost so the reconstruction vectorizes across lines,
+  // and we read the data in place instead of transposing it.
+  size_t line_stride = 1;
+  for (size_t d = 0; d < dim; ++d) {
+    line_stride *= volume_extents[d];
+  }
+  const int stride = static_cast<int>(line_stride);
   const size_t number_of_stripes_per_variable =
-      volume_extents.slice_away(0).product();
-  const size_t number_of_stripes =
-      number_of_stripes_per_variable * number_of_variables;
-  [[maybe_unused]] size_t recons_order_slice_offset = 0;
+      volume_extents.slice_away(dim).product();
+  const size_t number_of_line_blocks =
+      number_of_stripes_per_variable * number_of_variables / line_stride;
   if constexpr (ReturnReconstructionOrder) {
     ASSERT(reconstruction_order->size() ==
-               (number_of_stripes_per_variable * (volume_extents[0] + 2)),
+               (number_of_stripes_per_variable * (extent + 2)),
            "Expected size "
-               << (number_of_stripes_per_variable * (volume_extents[0] + 2))
+               << (number_of_stripes_per_variable * (extent + 2))
                << " for reconstruction_order but got "
                << reconstruction_order->size());
   }
 
+  // Cells are labeled by `cell`, which is offset by one so that `cell == 0` is
+  // the cell in the lower neighbor nearest to the boundary and
+  // `cell == extent + 1` the one in the upper neighbor. We reconstruct both
+  // so we have the neighbor's reconstruction at the element boundaries.
+  //
+  // We use extent + 2 for the reconstruction order because we need the
+  // order of the left and right cells for adjusting the correction at the
+  // interface. The stripes of the reconstruction order are numbered as if the
+  // data were transposed to have direction `dim` fastest.
+  const auto set_recons_order = [&reconstruction_order, number_of_line_blocks,
+                                 number_of_stripes_per_variable, extent](
+                                    const auto& upper_lower_and_order,
+                                    const size_t line, const size_t line_block,
+                                    const size_t cell) {
+    if constexpr (ReturnReconstructionOrder and
+                  std::tuple_size<
+                      std::decay_t<decltype(upper_lower_and_order)>>::value >
+                      2) {
+      std::uint8_t& order =
+          (*reconstruction_order)[((line_block +
+                                    number_of_line_blocks * line) %
+                                   number_of_stripes_per_variable) *
+                                      (extent + 2) +
+                                  cell];
+      order = min(static_cast<std::uint8_t>(get<2>(upper_lower_and_order)),
+                  order);
+    } else {
+      (void)upper_lower_and_order;
+      (void)line;
+      (void)line_block;
+      (void)cell;
+    }
+  };
+
+  // Cells whose stencil extends into the ghost cells are gathered into a
+  // buffer with unit stride.
   std::array<double, stencil_width> q{};
-  for (size_t slice = 0; slice < number_of_stripes; ++slice) {
-    const size_t vars_slice_offset = slice * volume_extents[0];
-    const size_t vars_neighbor_slice_offset =
-        slice * ghost_pts_in_neighbor_data;
-    const size_t recons_slice_offset = (volume_extents[0] + 1) * slice;
-    // We use volume_extents + 2 because we need the order of the left and
-    // right cells for adjusting the correction at the interface. This means
-    // we include one neighbor on the upper and lower side.
-    recons_order_slice_offset =
-        slice % number_of_stripes_per_variable == 0
-            ? 0
-            : (recons_order_slice_offset + volume_extents[0] + 2);
-    [[maybe_unused]] size_t recons_order_index = 0;
-    const auto set_recons_order = [&reconstruction_order, &recons_order_index,
-                                   recons_order_slice_offset](
-                                      const auto& upper_lower_and_order) {
-      if constexpr (ReturnReconstructionOrder and
-                    std::tuple_size<
-                        std::decay_t<decltype(upper_lower_and_order)>>::value >
-                        2) {
-        (*reconstruction_order)[recons_order_slice_offset +
-                                recons_order_index] =
-            min(static_cast<std::uint8_t>(get<2>(upper_lower_and_order)),
-                (*reconstruction_order)[recons_order_slice_offset +
-                                        recons_order_index]);
-        ++recons_order_index;
+  const auto reconstruct_boundary_cell = [&](const size_t line,
+                                             const size_t line_block,
+                                             const size_t cell) {
+    const size_t vars_offset = line + line_stride * extent * line_block;
+    const size_t ghost_offset =
+        line + line_stride * ghost_pts_in_neighbor_data * line_block;
+    for (size_t j = 0; j < stencil_width; ++j) {
+      // Index of the stencil point counted from the first ghost cell
+      const size_t point = cell + j;
+      if (point < ghost_pts_in_neighbor_data) {
+        gsl::at(q, j) = lower_ghost_data[ghost_offset + line_stride * point];
+      } else if (point < extent + ghost_pts_in_neighbor_data) {
+        gsl::at(q, j) =
+            volume_vars[vars_offset +
+                        line_stride * (point - ghost_pts_in_neighbor_data)];
+      } else {
+        gsl::at(q, j) =
+            upper_ghost_data[ghost_offset +
+                             line_stride *
+                                 (point - extent - ghost_pts_in_neighbor_data)];
       }
-    };
-
-    // Deal with lower ghost data.
-    //
-    // There's one extra reconstruction for the upper face of the neighbor
-    for (size_t j = 0; j < ghost_pts_in_neighbor_data; ++j) {
-      q[j] = lower_ghost_data[vars_neighbor_slice_offset + j];
     }
-    for (size_t j = ghost_pts_in_neighbor_data, k = 0; j < stencil_width;
-         ++j, ++k) {
-      gsl::at(q, j) = volume_vars[vars_slice_offset + k];
+    const auto upper_lower_and_order = Reconstructor::pointwise(
+        q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
+    const size_t recons_offset = line + line_stride * (extent + 1) * line_block;
+    if (cell > 0) {
+      (*recons_upper)[recons_offset + line_stride * (cell - 1)] =
+          get<0>(upper_lower_and_order);
     }
-    {
-      const auto upper_lower_and_order = Reconstructor::pointwise(
-          q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
-      (*recons_lower)[recons_slice_offset] = get<1>(upper_lower_and_order);
-      set_recons_order(upper_lower_and_order);
+    if (cell <= extent) {
+      (*recons_lower)[recons_offset + line_stride * cell] =
+          get<1>(upper_lower_and_order);
     }
-
-    for (size_t i = 0; i < ghost_zone_for_stencil; ++i) {
-      // offset comes from accounting for the 1 extra point in our ghost
-      // cells plus how far away from the boundary we are reconstructing.
-      for (size_t j = 0, offset = vars_neighbor_slice_offset +
-                                  ghost_pts_in_neighbor_data -
-                                  (ghost_zone_for_stencil - i);
-           j < ghost_zone_for_stencil - i; ++j) {
-        q[j] = lower_ghost_data[offset + j];
-      }
-      for (size_t j = ghost_zone_for_stencil - i, k = 0; j < stencil_width;
-           ++j, ++k) {
-        gsl::at(q, j) = volume_vars[vars_slice_offset + k];
+    set_recons_order(upper_lower_and_order, line, line_block, cell);
+  };
+
+  for (size_t line_block = 0; line_block < number_of_line_blocks;
+       ++line_block) {
+    // Deal with lower ghost data. There's one extra reconstruction for the
+    // upper face of the neighbor.
+    for (size_t cell = 0; cell <= ghost_zone_for_stencil; ++cell) {
+      for (size_t line = 0; line < line_stride; ++line) {
+        reconstruct_boundary_cell(line, line_block, cell);
       }
-      const auto upper_lower_and_order = Reconstructor::pointwise(
-          q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
-      (*recons_upper)[recons_slice_offset + i] = get<0>(upper_lower_and_order);
-      (*recons_lower)[recons_slice_offset + 1 + i] =
-          get<1>(upper_lower_and_order);
-      set_recons_order(upper_lower_and_order);
     }
 
     // Reconstruct in the bulk
-    const size_t slice_end = volume_extents[0] - ghost_zone_for_stencil;
-    for (size_t vars_index = vars_slice_offset + ghost_zone_for_stencil,
-                i = ghost_zone_for_stencil;
-         i < slice_end; ++vars_index, ++i) {
-      // Note: we keep the `stride` here because we may want to
-      // experiment/support non-unit strides in the bulk in the future. For
-      // cells where the reconstruction needs boundary data we copy into a
-      // `std::array` buffer, which means we always have unit stride.
-      constexpr int stride = 1;
-      const auto upper_lower_and_order = Reconstructor::pointwise(
-          &volume_vars[vars_index], stride, args_for_reconstructor...);
-      (*recons_upper)[recons_slice_offset + i] = get<0>(upper_lower_and_order);
-      (*recons_lower)[recons_slice_offset + 1 + i] =
-          get<1>(upper_lower_and_order);
-      set_recons_order(upper_lower_and_order);
-    }
-
-    // Reconstruct using upper neighbor data
-    for (size_t i = 0; i < ghost_zone_for_stencil; ++i) {
-      // offset comes from accounting for the 1 extra point in our ghost
-      // cells plus how far away from the boundary we are reconstructing.
-      //
-      // Note:
-      // - q has size stencil_width
-      // - we need to copy over (stencil_width - 1 - i) from the volume
-      // - we need to copy (i + 1) from the neighbor
-      //
-      // Here is an example of a case with stencil_width 5:
-      //
-      //  Interior points| Neighbor points
-      // x x x x x x x x | o o o
-      //             ^
-      //         c c c c | c
-      //  c = points used for reconstruction
-
-      ASSERT(
-          volume_extents[0] >= stencil_width - 1,
-          " Subcell volume extent (current value: "
-              << volume_extents[0]
-              << ") must be not smaller than the stencil width (current value: "
-              << stencil_width << ") minus 1");
-
-      size_t j = 0;
-      for (size_t k =
-               vars_slice_offset + volume_extents[0] - (stencil_width - 1 - i);
-           j < stencil_width - 1 - i; ++j, ++k) {
-        gsl::at(q, j) = volume_vars[k];
-      }
-      for (size_t k = 0; j < stencil_width; ++j, ++k) {
-        gsl::at(q, j) = upper_ghost_data[vars_neighbor_slice_offset + k];
+    const size_t vars_offset = line_stride * extent * line_block;
+    const size_t recons_offset = line_stride * (extent + 1) * line_block;
+    for (size_t cell = ghost_zone_for_stencil + 1;
+         cell <= extent - ghost_zone_for_stencil; ++cell) {
+      const size_t vars_index = vars_offset + line_stride * (cell - 1);
+      const size_t upper_index = recons_offset + line_stride * (cell - 1);
+      const size_t lower_index = recons_offset + line_stride * cell;
+      for (size_t line = 0; line < line_stride; ++line) {
+        const auto upper_lower_and_order = Reconstructor::pointwise(
+            &volume_vars[vars_index + line], stride,
+            args_for_reconstructor...);
+        (*recons_upper)[upper_index + line] = get<0>(upper_lower_and_order);
+        (*recons_lower)[lower_index + line] = get<1>(upper_lower_and_order);
+        set_recons_order(upper_lower_and_order, line, line_block, cell);
       }
-
-      const auto upper_lower_and_order = Reconstructor::pointwise(
-          q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
-      (*recons_upper)[recons_slice_offset + slice_end + i] =
-          get<0>(upper_lower_and_order);
-      (*recons_lower)[recons_slice_offset + slice_end + i + 1] =
-          get<1>(upper_lower_and_order);
-      set_recons_order(upper_lower_and_order);
     }
 
-    // Reconstruct the upper side of the last face, this is what the
-    // neighbor would've reconstructed.
-    for (size_t j = 0; j < ghost_zone_for_stencil; ++j) {
-      gsl::at(q, j) = volume_vars[vars_slice_offset + volume_extents[0] -
-                                  ghost_zone_for_stencil + j];
-    }
-    for (size_t j = ghost_zone_for_stencil, k = 0; j < stencil_width;
-         ++j, ++k) {
-      gsl::at(q, j) = upper_ghost_data[vars_neighbor_slice_offset + k];
+    // Reconstruct using upper neighbor data, including the upper side of the
+    // last face which is what the neighbor would've reconstructed.
+    for (size_t cell = extent - ghost_zone_for_stencil + 1; cell <= extent + 1;
+         ++cell) {
+      for (size_t line = 0; line < line_stride; ++line) {
+        reconstruct_boundary_cell(line, line_block, cell);
+      }
     }
-    const auto upper_lower_and_order = Reconstructor::pointwise(
-        q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
-    (*recons_upper)[recons_slice_offset + volume_extents[0]] =
-        get<0>(upper_lower_and_order);
-    set_recons_order(upper_lower_and_order);
-
-  }  // for slices
+  }
 }
 
 template <bool ReturnReconstructionOrder, typename Reconstructor, size_t Dim,
@@ -305,110 +286,25 @@ void reconstruct_impl(
   }
 #endif  // SPECTRE_DEBUG
 
-  ASSERT(ghost_cell_vars.contains(Direction<Dim>::lower_xi()),
-         "Couldn't find lower ghost data in lower-xi");
-  ASSERT(ghost_cell_vars.contains(Direction<Dim>::upper_xi()),
-         "Couldn't find upper ghost data in upper-xi");
   // Because std::optional.value_or returns by value we want to ensure that we
   // don't copy any data.
   gsl::span<std::uint8_t> empty_span{};
-  reconstruct_impl<ReturnReconstructionOrder, Reconstructor>(
-      make_not_null(&(*reconstructed_upper_side_of_face_vars)[0]),
-      make_not_null(&(*reconstructed_lower_side_of_face_vars)[0]),
-      make_not_null(&(ReturnReconstructionOrder
-                          ? reconstruction_order->value()[0]
-                          : empty_span)),
-      volume_vars, ghost_cell_vars.at(Direction<Dim>::lower_xi()),
-      ghost_cell_vars.at(Direction<Dim>::upper_xi()), volume_extents,
-      number_of_variables, args_for_reconstructor...);
-
-  if constexpr (Dim > 1) {
-    // We transpose from (x,y,z,vars) ordering to (y,z,vars,x) ordering
-    // Might not be the most efficient (unclear), but easiest.
-    // We use a single large buffer for both the y and z reconstruction
-    // to reduce the number of memory allocations and improve data locality.
-    const auto& lower_ghost = ghost_cell_vars.at(Direction<Dim>::lower_eta());
-    const auto& upper_ghost = ghost_cell_vars.at(Direction<Dim>::upper_eta());
-    DataVector buffer(volume_vars.size() + lower_ghost.size() +
-                      upper_ghost.size() +
-                      2 * (*reconstructed_upper_side_of_face_vars)[1].size());
-    raw_transpose(make_not_null(buffer.data()), volume_vars.data(),
-                  volume_extents[0], volume_vars.size() / volume_extents[0]);
-    raw_transpose(make_not_null(buffer.data() + volume_vars.size()),
-                  lower_ghost.data(), volume_extents[0],
-                  lower_ghost.size() / volume_extents[0]);
-    raw_transpose(
-        make_not_null(buffer.data() + volume_vars.size() + lower_ghost.size()),
-        upper_ghost.data(), volume_extents[0],
-        upper_ghost.size() / volume_extents[0]);
-
-    // Note: assumes isotropic extents
-    const size_t recons_offset_in_buffer =
-        volume_vars.size() + lower_ghost.size() + upper_ghost.size();
-    const size_t recons_size =
-        (*reconstructed_upper_side_of_face_vars)[1].size();
-    gsl::span<double> recons_upper_view =
-        gsl::make_span(buffer.data() + recons_offset_in_buffer, recons_size);
-    gsl::span<double> recons_lower_view = gsl::make_span(
-        buffer.data() + recons_offset_in_buffer + recons_size, recons_size);
+  for (size_t i = 0; i < Dim; ++i) {
+    const auto lower_direction = Direction<Dim>{i, Side::Lower};
+    const auto upper_direction = Direction<Dim>{i, Side::Upper};
+    ASSERT(ghost_cell_vars.contains(lower_direction),
+           "Couldn't find lower ghost data in " << lower_direction);
+    ASSERT(ghost_cell_vars.contains(upper_direction),
+           "Couldn't find upper ghost data in " << upper_direction);
     reconstruct_impl<ReturnReconstructionOrder, Reconstructor>(
-        make_not_null(&recons_upper_view), make_not_null(&recons_lower_view),
+        make_not_null(&gsl::at(*reconstructed_upper_side_of_face_vars, i)),
+        make_not_null(&gsl::at(*reconstructed_lower_side_of_face_vars, i)),
         make_not_null(&(ReturnReconstructionOrder
-                            ? reconstruction_order->value()[1]
+                            ? gsl::at(reconstruction_order->value(), i)
                             : empty_span)),
-        gsl::make_span(&buffer[0], volume_vars.size()),
-        gsl::make_span(buffer.data() + volume_vars.size(), lower_ghost.size()),
-        gsl::make_span(buffer.data() + volume_vars.size() + lower_ghost.size(),
-                       upper_ghost.size()),
-        volume_extents, number_of_variables, args_for_reconstructor...);
-    // Transpose result back
-    raw_transpose(
-        make_not_null((*reconstructed_upper_side_of_face_vars)[1].data()),
-        recons_upper_view.data(), recons_upper_view.size() / volume_extents[0],
-        volume_extents[0]);
-    raw_transpose(
-        make_not_null((*reconstructed_lower_side_of_face_vars)[1].data()),
-        recons_lower_view.data(), recons_lower_view.size() / volume_extents[0],
-        volume_extents[0]);
-
-    if constexpr (Dim > 2) {
-      const size_t chunk_size = volume_extents[0] * volume_extents[1];
-      const size_t number_of_volume_chunks = volume_vars.size() / chunk_size;
-      const size_t number_of_neighbor_chunks =
-          ghost_cell_vars.at(Direction<Dim>::lower_zeta()).size() / chunk_size;
-
-      raw_transpose(make_not_null(buffer.data()), volume_vars.data(),
-                    chunk_size, number_of_volume_chunks);
-      raw_transpose(make_not_null(buffer.data() + volume_vars.size()),
-                    ghost_cell_vars.at(Direction<Dim>::lower_zeta()).data(),
-                    chunk_size, number_of_neighbor_chunks);
-      raw_transpose(make_not_null(buffer.data() + volume_vars.size() +
-                                  lower_ghost.size()),
-                    ghost_cell_vars.at(Direction<Dim>::upper_zeta()).data(),
-                    chunk_size, number_of_neighbor_chunks);
-
-      reconstruct_impl<ReturnReconstructionOrder, Reconstructor>(
-          make_not_null(&recons_upper_view), make_not_null(&recons_lower_view),
-          make_not_null(&(ReturnReconstructionOrder
-                              ? reconstruction_order->value()[2]
-                              : empty_span)),
-          gsl::make_span(&buffer[0], volume_vars.size()),
-          gsl::make_span(buffer.data() + volume_vars.size(),
-                         lower_ghost.size()),
-          gsl::make_span(
-              buffer.data() + volume_vars.size() + lower_ghost.size(),
-              upper_ghost.size()),
-          volume_extents, number_of_variables, args_for_reconstructor...);
-      // Transpose result back
-      raw_transpose(
-          make_not_null((*reconstructed_upper_side_of_face_vars)[2].data()),
-          recons_upper_view.data(), recons_upper_view.size() / chunk_size,
-          chunk_size);
-      raw_transpose(
-          make_not_null((*reconstructed_lower_side_of_face_vars)[2].data()),
-          recons_lower_view.data(), recons_lower_view.size() / chunk_size,
-          chunk_size);
-    }
+        volume_vars, ghost_cell_vars.at(lower_direction),
+        ghost_cell_vars.at(upper_direction), volume_extents,
+        number_of_variables, i, args_for_reconstructor...);
   }
 }
 
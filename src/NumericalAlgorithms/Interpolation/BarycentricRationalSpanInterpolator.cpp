@@ -3,17 +3,51 @@
 
 #include "NumericalAlgorithms/Interpolation/BarycentricRationalSpanInterpolator.hpp"
 
-#include <boost/math/interpolators/barycentric_rational.hpp>
+#include <algorithm>
 #include <complex>
 #include <cstddef>
 
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 
-// Doesn't exist in boost before 1.77, but referenced below.
-namespace boost::math::interpolators {}
-
 namespace intrp {
+namespace {
+// Floater-Hormann barycentric rational interpolation of order `order`, as in
+// boost's `barycentric_rational`, but templated on the value type so the
+// weights computed from the `source_points` are shared by all components of
+// the `values`.
+template <typename ValueType>
+ValueType barycentric_interpolate(const gsl::span<const double>& source_points,
+                                  const gsl::span<const ValueType>& values,
+                                  const double target_point,
+                                  const size_t order) {
+  const size_t size = source_points.size();
+  ValueType numerator = 0.0;
+  double denominator = 0.0;
+  for (size_t k = 0; k < size; ++k) {
+    if (target_point == source_points[k]) {
+      return values[k];
+    }
+    const size_t i_min = k > order ? k - order : 0;
+    const size_t i_max = std::min(k, size - order - 1);
+    double weight = 0.0;
+    for (size_t i = i_min; i <= i_max; ++i) {
+      double product = 1.0;
+      for (size_t j = i; j <= std::min(i + order, size - 1); ++j) {
+        if (j != k) {
+          product *= source_points[k] - source_points[j];
+        }
+      }
+      weight += (i % 2 == 0 ? 1.0 : -1.0) / product;
+    }
+    const double term = weight / (target_point - source_points[k]);
+    numerator += term * values[k];
+    denominator += term;
+  }
+  return numerator / denominator;
+}
+}  // namespace
 
 BarycentricRationalSpanInterpolator::BarycentricRationalSpanInterpolator(
     size_t min_order, size_t max_order)
@@ -29,16 +63,21 @@ double BarycentricRationalSpanInterpolator::interpolate(
   if (UNLIKELY(source_points.size() < min_order_ + 1)) {
     ERROR("provided independent values for interpolation too small.");
   }
-  // Boost moved barycentric_rational from boost::math to
-  // boost::math::interpolators in version 1.77.
-  // NOLINTNEXTLINE(google-build-using-namespace)
-  using namespace boost::math;
-  // NOLINTNEXTLINE(google-build-using-namespace)
-  using namespace boost::math::interpolators;
-  barycentric_rational<double> interpolant(
-      source_points.data(), values.data(), source_points.size(),
+  return barycentric_interpolate(
+      source_points, values, target_point,
+      std::min(source_points.size() - 1, max_order_));
+}
+
+std::complex<double> BarycentricRationalSpanInterpolator::interpolate(
+    const gsl::span<const double>& source_points,
+    const gsl::span<const std::complex<double>>& values,
+    const double target_point) const {
+  if (UNLIKELY(source_points.size() < min_order_ + 1)) {
+    ERROR("provided independent values for interpolation too small.");
+  }
+  return barycentric_interpolate(
+      source_points, values, target_point,
       std::min(source_points.size() - 1, max_order_));
-  return interpolant(target_point);
 }
 
 PUP::able::PUP_ID intrp::BarycentricRationalSpanInterpolator::my_PUP_ID = 0;
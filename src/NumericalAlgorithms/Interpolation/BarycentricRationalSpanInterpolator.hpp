@@ -21,6 +21,10 @@ namespace intrp {
 /// length, so that buffers that adjust length based on
 /// `required_points_before_and_after()` can be forced to use an interpolator of
 /// a target order.
+///
+/// The barycentric weights depend only on the `source_points`, so the complex
+/// overload computes them once and applies them to the complex values
+/// directly, rather than once each for the real and imaginary parts.
 class BarycentricRationalSpanInterpolator : public SpanInterpolator {
  public:
   struct MinOrder {
@@ -69,13 +73,15 @@ class BarycentricRationalSpanInterpolator : public SpanInterpolator {
     return std::make_unique<BarycentricRationalSpanInterpolator>(*this);
   }
 
-  // to get the generic overload:
-  using SpanInterpolator::interpolate;
-
   double interpolate(const gsl::span<const double>& source_points,
                      const gsl::span<const double>& values,
                      double target_point) const override;
 
+  std::complex<double> interpolate(
+      const gsl::span<const double>& source_points,
+      const gsl::span<const std::complex<double>>& values,
+      double target_point) const override;
+
   size_t required_number_of_points_before_and_after() const override {
     return min_order_ / 2 + 1;
   }
@@ -48,7 +48,7 @@ class LinearSpanInterpolator : public SpanInterpolator {
   std::complex<double> interpolate(
       const gsl::span<const double>& source_points,
       const gsl::span<const std::complex<double>>& values,
-      double target_point) const;
+      double target_point) const override;
 
   size_t required_number_of_points_before_and_after() const override {
     return 1;
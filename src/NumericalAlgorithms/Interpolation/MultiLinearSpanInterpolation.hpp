@@ -6,7 +6,10 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/Index.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -14,14 +17,77 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace intrp {
+/// \brief Memory layout of the table read by `MultiLinearSpanInterpolation`
+enum class TableLayout {
+  /// C-ordered array (n, x, y, z), i.e. the variables at a table point are
+  /// contiguous and the first dimension varies fastest between points.
+  PointInterleaved,
+  /// C-ordered array (n, corner, x, y, z), i.e. the variables at all
+  /// \f$2^D\f$ corners of the cell whose lowest corner is at (x, y, z) are
+  /// contiguous, so an interpolation reads a single contiguous block of
+  /// memory. Every table point is stored \f$2^D\f$ times. Use
+  /// `make_cell_interleaved_table` to create such a table.
+  CellInterleaved
+};
+
+/*!
+ * \brief Convert a `TableLayout::PointInterleaved` table into a
+ * `TableLayout::CellInterleaved` table.
+ *
+ * \details The entries of cells whose lowest corner is on the upper boundary
+ * of the table in any dimension are never read and are set to zero.
+ */
+template <size_t Dimension, size_t NumberOfVariables>
+std::vector<double> make_cell_interleaved_table(
+    const gsl::span<const double> point_interleaved_table,
+    const Index<Dimension>& number_of_points) {
+  constexpr size_t number_of_corners = two_to_the(Dimension);
+  const size_t number_of_table_points = number_of_points.product();
+  ASSERT(point_interleaved_table.size() ==
+             NumberOfVariables * number_of_table_points,
+         "The table has " << point_interleaved_table.size()
+                          << " entries but expected "
+                          << NumberOfVariables * number_of_table_points);
+  std::vector<double> result(number_of_corners * NumberOfVariables *
+                             number_of_table_points);
+  for (size_t point = 0; point < number_of_table_points; ++point) {
+    Index<Dimension> lower_corner{};
+    size_t remainder = point;
+    bool is_on_upper_boundary = false;
+    for (size_t d = 0; d < Dimension; ++d) {
+      lower_corner[d] = remainder % number_of_points[d];
+      remainder /= number_of_points[d];
+      is_on_upper_boundary |= lower_corner[d] + 1 == number_of_points[d];
+    }
+    if (is_on_upper_boundary) {
+      continue;
+    }
+    for (size_t corner = 0; corner < number_of_corners; ++corner) {
+      Index<Dimension> corner_index = lower_corner;
+      for (size_t d = 0; d < Dimension; ++d) {
+        corner_index[d] += (corner >> d) & 1;
+      }
+      const size_t source =
+          NumberOfVariables * collapsed_index(corner_index, number_of_points);
+      const size_t destination =
+          NumberOfVariables * (corner + number_of_corners * point);
+      for (size_t var = 0; var < NumberOfVariables; ++var) {
+        result[destination + var] = point_interleaved_table[source + var];
+      }
+    }
+  }
+  return result;
+}
 
 /*!
  * \brief Performs linear interpolation in arbitrary dimensions.
  *  The class is non-owning and expects a C-ordered array, (n, x, y, z).
- *  The variable index, n, varies fastest in memory.
+ *  The variable index, n, varies fastest in memory. Alternatively, the table
+ *  can be stored cell by cell, see `TableLayout`.
  *  Note that this class is intentionally non-pupable.
  *
  *  \tparam Dimension dimensionality of the table
@@ -130,11 +196,32 @@ class MultiLinearSpanInterpolation {
                        std::make_index_sequence<Dimension>{});
   }
 
+  /*!
+   * \brief Interpolate the variables `VariablesToInterpolate...` to all
+   * `target_points`.
+   *
+   * \details The table indices and the normalized coordinates of
+   * `simd::batch<double>` many points are computed at once, the corner values
+   * of only the requested variables are gathered, and the multilinear
+   * interpolation is done in registers by successive linear interpolation
+   * along each dimension. Only available for uniform spacing.
+   */
+  template <size_t... VariablesToInterpolate>
+  void interpolate(
+      gsl::not_null<
+          std::array<gsl::span<double>, sizeof...(VariablesToInterpolate)>*>
+          result,
+      const std::array<gsl::span<const double>, Dimension>& target_points)
+      const;
+
   MultiLinearSpanInterpolation() = default;
 
   MultiLinearSpanInterpolation(
       std::array<gsl::span<const double>, Dimension> x_,
-      gsl::span<const double> y_, Index<Dimension> number_of_points__);
+      gsl::span<const double> y_, Index<Dimension> number_of_points__,
+      TableLayout layout = TableLayout::PointInterleaved);
+
+  TableLayout layout() const { return layout_; }
 
   double lower_bound(const size_t which_dimension) const {
     return x_[which_dimension][0];
@@ -155,6 +242,11 @@ class MultiLinearSpanInterpolation {
   std::array<double, Dimension> spacing_;
   /// Number of points per dimension
   Index<Dimension> number_of_points_;
+  TableLayout layout_{TableLayout::PointInterleaved};
+  /// Offset of the table point at each corner of a cell from the lowest
+  /// corner, in units of table points. Only used for
+  /// `TableLayout::PointInterleaved`.
+  std::array<size_t, two_to_the(Dimension)> corner_offsets_;
 
   using DataPointer = gsl::span<const double>;
   /// X values of the table. Only used if allocated
@@ -178,6 +270,23 @@ class MultiLinearSpanInterpolation {
       return find_index_general(which_dimension, target_points);
     }
   }
+
+  /// Offset into `y_`, in units of `NumberOfVariables`, of the data at
+  /// `corner` of the cell whose lowest corner is the table point
+  /// `lower_corner`.
+  size_t corner_index(const size_t lower_corner, const size_t corner) const {
+    if (layout_ == TableLayout::CellInterleaved) {
+      return corner + two_to_the(Dimension) * lower_corner;
+    }
+    return lower_corner + corner_offsets_[corner];
+  }
+
+  template <size_t... I>
+  Weight<Dimension> get_weights(
+      const std::array<gsl::span<const double>, Dimension>& target_points,
+      const size_t point, std::index_sequence<I...> /*meta*/) const {
+    return get_weights(target_points[I][point]...);
+  }
 };
 
 template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
@@ -281,8 +390,9 @@ auto MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
 
   // Compute indices
 
-  weights.index[0] = index[0];
-  weights.index[1] = index[0] + 1;
+  for (size_t i = 0; i < 2; ++i) {
+    weights.index[i] = corner_index(index[0], i);
+  }
 
   return weights;
 }
@@ -318,11 +428,9 @@ auto MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
 
   // Compute indices
   //
-  for (size_t j = 0; j < 2; ++j) {
-    for (size_t i = 0; i < 2; ++i) {
-      auto tmp_index = Index<2>(index[0] + i, index[1] + j);
-      weights.index[i + 2 * j] = collapsed_index(tmp_index, number_of_points_);
-    }
+  const size_t lower_corner = collapsed_index(index, number_of_points_);
+  for (size_t i = 0; i < 4; ++i) {
+    weights.index[i] = corner_index(lower_corner, i);
   }
 
   return weights;
@@ -367,31 +475,179 @@ auto MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
 
   // Compute indices
   //
-  for (size_t k = 0; k < 2; ++k) {
-    for (size_t j = 0; j < 2; ++j) {
-      for (size_t i = 0; i < 2; ++i) {
-        auto tmp_index = Index<3>(index[0] + i, index[1] + j, index[2] + k);
-        weights.index[i + 2 * (j + 2 * k)] =
-            collapsed_index(tmp_index, number_of_points_);
-      }
-    }
+  const size_t lower_corner = collapsed_index(index, number_of_points_);
+  for (size_t i = 0; i < 8; ++i) {
+    weights.index[i] = corner_index(lower_corner, i);
   }
 
   return weights;
 }
 
+template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
+template <size_t... VariablesToInterpolate>
+void MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
+                                  UniformSpacing>::
+    interpolate(
+        const gsl::not_null<
+            std::array<gsl::span<double>, sizeof...(VariablesToInterpolate)>*>
+            result,
+        const std::array<gsl::span<const double>, Dimension>& target_points)
+        const {
+  static_assert(UniformSpacing,
+                "Interpolating to many points at once is only implemented for "
+                "uniform spacing.");
+  static_assert(((VariablesToInterpolate < NumberOfVariables) and ...),
+                "You are trying to interpolate a variable this container does "
+                "not hold.");
+  constexpr size_t number_of_corners = two_to_the(Dimension);
+  const size_t number_of_target_points = target_points[0].size();
+  for (size_t d = 0; d < Dimension; ++d) {
+    ASSERT(gsl::at(target_points, d).size() == number_of_target_points,
+           "All dimensions must have the same number of target points, but "
+           "dimension "
+               << d << " has " << gsl::at(target_points, d).size()
+               << " instead of " << number_of_target_points);
+  }
+  for (const auto& result_for_var : *result) {
+    ASSERT(result_for_var.size() == number_of_target_points,
+           "The result has size " << result_for_var.size() << " but there are "
+                                  << number_of_target_points
+                                  << " target points.");
+  }
+
+#ifdef SPECTRE_USE_XSIMD
+  using BatchType = simd::batch<double>;
+#else
+  using BatchType = double;
+#endif
+  constexpr size_t width = simd::size<BatchType>();
+
+  const auto interpolate_batch = [this, &result,
+                                  &target_points](const size_t offset) {
+    alignas(64) std::array<double, width> buffer{};
+    std::array<size_t, width> lower_corners{};
+    std::array<BatchType, Dimension> fractions{};
+    size_t stride = 1;
+    for (size_t d = 0; d < Dimension; ++d) {
+      const BatchType relative_coordinate =
+          (simd::load_unaligned(&gsl::at(target_points, d)[offset]) -
+           BatchType(x_[d][0])) *
+          BatchType(inverse_spacing_[d]);
+      // Use linear extrapolation from the two lowest (highest) points in the
+      // table beyond its bounds
+      const BatchType index = simd::min(
+          simd::max(simd::floor(relative_coordinate), BatchType(0.0)),
+          BatchType(static_cast<double>(number_of_points_[d] - 2)));
+      gsl::at(fractions, d) = relative_coordinate - index;
+#ifdef SPECTRE_DEBUG
+      simd::store_unaligned(buffer.data(), relative_coordinate);
+      for (size_t lane = 0; lane < width; ++lane) {
+        ASSERT(allow_extrapolation_below_data_[d] or
+                   gsl::at(buffer, lane) >= 0.0,
+               "Interpolation exceeds lower table bounds.\nwhich_dimension: "
+                   << d << "\ntarget point: "
+                   << gsl::at(target_points, d)[offset + lane]);
+        ASSERT(allow_extrapolation_abov_data_[d] or
+                   gsl::at(buffer, lane) <
+                       static_cast<double>(number_of_points_[d] - 1),
+               "Interpolation exceeds upper table bounds.\nwhich_dimension: "
+                   << d << "\ntarget point: "
+                   << gsl::at(target_points, d)[offset + lane]);
+      }
+#endif  // SPECTRE_DEBUG
+      simd::store_unaligned(buffer.data(), index);
+      for (size_t lane = 0; lane < width; ++lane) {
+        gsl::at(lower_corners, lane) +=
+            stride * static_cast<size_t>(gsl::at(buffer, lane));
+      }
+      stride *= number_of_points_[d];
+    }
+
+    const auto interpolate_variable = [this, &buffer, &fractions,
+                                       &lower_corners](
+                                          const size_t variable,
+                                          const gsl::span<double> dest) {
+      std::array<BatchType, number_of_corners> values{};
+      for (size_t corner = 0; corner < number_of_corners; ++corner) {
+        for (size_t lane = 0; lane < width; ++lane) {
+          gsl::at(buffer, lane) =
+              y_[variable +
+                 NumberOfVariables *
+                     corner_index(gsl::at(lower_corners, lane), corner)];
+        }
+        gsl::at(values, corner) = simd::load_unaligned(buffer.data());
+      }
+      // The first dimension varies fastest between the corners, so
+      // neighboring corners are interpolated along the current dimension.
+      for (size_t d = 0; d < Dimension; ++d) {
+        for (size_t corner = 0; corner < (number_of_corners >> (d + 1));
+             ++corner) {
+          gsl::at(values, corner) = simd::fma(
+              gsl::at(fractions, d),
+              gsl::at(values, 2 * corner + 1) - gsl::at(values, 2 * corner),
+              gsl::at(values, 2 * corner));
+        }
+      }
+      simd::store_unaligned(&dest[0], values[0]);
+    };
+
+    size_t result_index = 0;
+    (interpolate_variable(VariablesToInterpolate,
+                          gsl::at(*result, result_index++).subspan(offset)),
+     ...);
+  };
+
+  if (number_of_target_points < width) {
+    for (size_t point = 0; point < number_of_target_points; ++point) {
+      const auto weights = get_weights(target_points, point,
+                                       std::make_index_sequence<Dimension>{});
+      size_t result_index = 0;
+      ((gsl::at(*result, result_index++)[point] =
+            interpolate(weights, VariablesToInterpolate)),
+       ...);
+    }
+    return;
+  }
+  const size_t vectorized_size =
+      number_of_target_points - number_of_target_points % width;
+  for (size_t offset = 0; offset < vectorized_size; offset += width) {
+    interpolate_batch(offset);
+  }
+  // Recompute some points of the last full batch rather than handling a
+  // partial batch
+  if (vectorized_size != number_of_target_points) {
+    interpolate_batch(number_of_target_points - width);
+  }
+}
+
 template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
 MultiLinearSpanInterpolation<Dimension, NumberOfVariables, UniformSpacing>::
     MultiLinearSpanInterpolation(
         std::array<gsl::span<double const>, Dimension> x,
-        gsl::span<double const> y, Index<Dimension> number_of_points)
-    : number_of_points_(number_of_points), x_(x), y_(y) {
+        gsl::span<double const> y, Index<Dimension> number_of_points,
+        const TableLayout layout)
+    : number_of_points_(number_of_points), layout_(layout), x_(x), y_(y) {
+  ASSERT(y_.size() == NumberOfVariables * number_of_points_.product() *
+                          (layout_ == TableLayout::CellInterleaved
+                               ? two_to_the(Dimension)
+                               : 1),
+         "The table has " << y_.size()
+                          << " entries, which does not match the number of "
+                             "points and variables.");
   for (size_t i = 0; i < Dimension; ++i) {
     spacing_[i] = x_[i][1] - x_[i][0];
     inverse_spacing_[i] = 1. / spacing_[i];
     allow_extrapolation_below_data_[i] = false;
     allow_extrapolation_abov_data_[i] = false;
   }
+  for (size_t corner = 0; corner < two_to_the(Dimension); ++corner) {
+    corner_offsets_[corner] = 0;
+    size_t stride = 1;
+    for (size_t d = 0; d < Dimension; ++d) {
+      corner_offsets_[corner] += ((corner >> d) & 1) * stride;
+      stride *= number_of_points_[d];
+    }
+  }
 }
 
 /// Multilinear span interpolation with uniform grid spacing
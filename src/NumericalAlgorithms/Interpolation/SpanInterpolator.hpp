@@ -28,7 +28,7 @@ class BarycentricRationalSpanInterpolator;
 /// derived class. The `interpolate` for complex values can just be used from
 /// this base class, which calls the real version for each component. If it is
 /// possible to make a specialized complex version that avoids allocations, that
-/// is probably more efficient.
+/// is probably more efficient, and a derived class may override it.
 class SpanInterpolator : public PUP::able {
  public:
   using creatable_classes =
@@ -50,7 +50,7 @@ class SpanInterpolator : public PUP::able {
   /// Perform the interpolation of function represented by complex `values` at
   /// `source_points` to the requested `target_point`, returning the
   /// (complex) interpolation result.
-  std::complex<double> interpolate(
+  virtual std::complex<double> interpolate(
       const gsl::span<const double>& source_points,
       const gsl::span<const std::complex<double>>& values,
       double target_point) const;
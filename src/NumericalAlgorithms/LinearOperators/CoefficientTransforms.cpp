@@ -4,6 +4,8 @@
 #include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 
 #include <array>
+#include <atomic>
+#include <cstddef>
 #include <utility>
 
 #include "DataStructures/ApplyMatrices.hpp"
@@ -19,6 +21,8 @@
 #include "Utilities/Gsl.hpp"
 
 namespace {
+std::atomic<size_t> modal_transform_counter{0};
+
 template <size_t Dim, size_t... Is>
 std::array<std::reference_wrapper<const Matrix>, Dim> make_transform_matrices(
     const Mesh<Dim>& mesh, const bool nodal_to_modal,
@@ -32,10 +36,15 @@ std::array<std::reference_wrapper<const Matrix>, Dim> make_transform_matrices(
 }
 }  // namespace
 
+size_t number_of_modal_transforms() {
+  return modal_transform_counter.load(std::memory_order_relaxed);
+}
+
 template <size_t Dim>
 void to_modal_coefficients(
     const gsl::not_null<ComplexModalVector*> modal_coefficients,
     const ComplexDataVector& nodal_coefficients, const Mesh<Dim>& mesh) {
+  modal_transform_counter.fetch_add(1, std::memory_order_relaxed);
   modal_coefficients->destructive_resize(nodal_coefficients.size());
   apply_matrices<ComplexModalVector>(
       modal_coefficients,
@@ -49,6 +58,7 @@ template <size_t Dim>
 void to_modal_coefficients(gsl::not_null<ModalVector*> modal_coefficients,
                            const DataVector& nodal_coefficients,
                            const Mesh<Dim>& mesh) {
+  modal_transform_counter.fetch_add(1, std::memory_order_relaxed);
   modal_coefficients->destructive_resize(nodal_coefficients.size());
   apply_matrices<ModalVector>(
       modal_coefficients,
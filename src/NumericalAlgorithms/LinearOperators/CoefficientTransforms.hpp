@@ -4,8 +4,13 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/ModalVector.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits.hpp"
 
 /// \cond
@@ -14,12 +19,11 @@ class ComplexModalVector;
 class DataVector;
 template <size_t Dim>
 class Mesh;
-class ModalVector;
 
-namespace gsl {
-template <typename T>
-class not_null;
-}  // namespace gsl
+namespace domain::Tags {
+template <size_t Dim>
+struct Mesh;
+}  // namespace domain::Tags
 /// \endcond
 
 /// @{
@@ -79,3 +83,52 @@ template <size_t Dim>
 ComplexDataVector to_nodal_coefficients(
     const ComplexModalVector& modal_coefficients, const Mesh<Dim>& mesh);
 /// @}
+
+/*!
+ * \ingroup SpectralGroup
+ * \brief The number of transforms to modal coefficients done on this process
+ * so far.
+ *
+ * Every call to `to_modal_coefficients` counts as one transform, regardless of
+ * the number of components it transforms. The difference between two calls
+ * measures how many transforms were done in between, e.g. during one step.
+ * Counting is threadsafe.
+ */
+size_t number_of_modal_transforms();
+
+namespace Tags {
+/// \ingroup DataBoxTagsGroup
+/// \brief The modal coefficients of each component of the tensor `Tag`
+///
+/// The modal coefficients are stored in the order of the tensor components.
+template <typename Tag>
+struct ModalCoefficients : db::PrefixTag, db::SimpleTag {
+  using tag = Tag;
+  using type = std::vector<ModalVector>;
+};
+
+/*!
+ * \ingroup DataBoxTagsGroup
+ * \brief Compute the modal coefficients of the tensor `Tag`
+ *
+ * The DataBox only recomputes the modal coefficients when `Tag` or the mesh
+ * change, so all consumers that retrieve them in the same step share a single
+ * set of transforms. `amr::Criteria::TruncationError` uses these coefficients
+ * if the tag is in the DataBox.
+ */
+template <typename Tag, size_t Dim>
+struct ModalCoefficientsCompute : ModalCoefficients<Tag>, db::ComputeTag {
+  using base = ModalCoefficients<Tag>;
+  using return_type = typename base::type;
+  using argument_tags = tmpl::list<Tag, domain::Tags::Mesh<Dim>>;
+  static void function(const gsl::not_null<return_type*> modal_coefficients,
+                       const typename Tag::type& tensor,
+                       const Mesh<Dim>& mesh) {
+    modal_coefficients->resize(tensor.size());
+    for (size_t i = 0; i < tensor.size(); ++i) {
+      to_modal_coefficients(make_not_null(&(*modal_coefficients)[i]),
+                            tensor[i], mesh);
+    }
+  }
+};
+}  // namespace Tags
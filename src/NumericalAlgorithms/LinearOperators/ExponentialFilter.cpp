@@ -3,6 +3,9 @@
 
 #include "NumericalAlgorithms/LinearOperators/ExponentialFilter.hpp"
 
+#include <array>
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <unordered_set>
 
@@ -13,6 +16,8 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Options/Options.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
@@ -75,6 +80,29 @@ const Matrix& Exponential<FilterIndex>::filter_matrix(
   return cache(mesh.extents(0), mesh.basis(0), mesh.quadrature(0));
 }
 
+template <size_t FilterIndex>
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim>
+Exponential<FilterIndex>::filter_matrices(const Mesh<Dim>& mesh) const {
+  const static Matrix identity{};
+  auto result = make_array<Dim>(std::cref(identity));
+  if (alpha_ == 0.0) {
+    return result;
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    if (mesh.extents(d) > 1) {
+      gsl::at(result, d) = std::cref(filter_matrix(mesh.slice_through(d)));
+    }
+  }
+  return result;
+}
+
+template <size_t FilterIndex>
+template <size_t Dim>
+bool Exponential<FilterIndex>::is_identity(const Mesh<Dim>& mesh) const {
+  return alpha_ == 0.0 or mesh.number_of_grid_points() == 1;
+}
+
 template <size_t FilterIndex>
 void Exponential<FilterIndex>::pup(PUP::er& p) {
   p | alpha_;
@@ -108,7 +136,20 @@ bool operator!=(const Exponential<FilterIndex>& lhs,
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (0, 1, 2, 3, 4, 5, 6, 7, 8, 9))
 
+#define DIM(data) BOOST_PP_TUPLE_ELEM(1, data)
+#define INSTANTIATE_DIM(_, data)                                         \
+  template std::array<std::reference_wrapper<const Matrix>, DIM(data)>   \
+  Exponential<FILTER_INDEX(data)>::filter_matrices(                      \
+      const Mesh<DIM(data)>& mesh) const;                                \
+  template bool Exponential<FILTER_INDEX(data)>::is_identity(            \
+      const Mesh<DIM(data)>& mesh) const;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_DIM, (0, 1, 2, 3, 4, 5, 6, 7, 8, 9),
+                        (1, 2, 3))
+
+#undef DIM
 #undef FILTER_INDEX
 #undef INSTANTIATE
+#undef INSTANTIATE_DIM
 
 }  // namespace Filters
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <functional>
 #include <optional>
 #include <pup.h>
 #include <string>
@@ -112,6 +114,23 @@ class Exponential {
   /// A cached matrix used to apply the filter to the given mesh
   const Matrix& filter_matrix(const Mesh<1>& mesh) const;
 
+  /*!
+   * \brief The cached matrices used to apply the filter in each dimension of
+   * the `mesh`.
+   *
+   * Dimensions in which the filter is the identity, i.e. those with a single
+   * grid point or all of them if `Alpha` is zero, get an empty matrix so
+   * `apply_matrices` skips the multiplication in that dimension.
+   */
+  template <size_t Dim>
+  std::array<std::reference_wrapper<const Matrix>, Dim> filter_matrices(
+      const Mesh<Dim>& mesh) const;
+
+  /// Whether the filter leaves data on the `mesh` unchanged, so applying it
+  /// can be skipped altogether.
+  template <size_t Dim>
+  bool is_identity(const Mesh<Dim>& mesh) const;
+
   bool enable() const { return enable_; }
 
   const std::optional<std::unordered_set<std::string>>& blocks_to_filter()
@@ -9,6 +9,7 @@
 #include <functional>
 #include <vector>
 
+#include "DataStructures/ApplyMatrixInFirstDimension.hpp"
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
@@ -28,19 +29,8 @@ namespace partial_derivatives_detail {
 void apply_matrix_in_first_dim(double* result, const double* const input,
                                const Matrix& matrix, const size_t size,
                                const bool add_to_result) {
-  dgemm_<true>(
-      'N', 'N',
-      matrix.rows(),              // rows of matrix and result
-      size / matrix.columns(),    // columns of result and input
-      matrix.columns(),           // columns of matrix and rows of input
-      1.0,                        // overall multiplier
-      matrix.data(),              // matrix
-      matrix.spacing(),           // rows of matrix including padding
-      input,                      // input
-      matrix.columns(),           // rows of input
-      add_to_result ? 1.0 : 0.0,  // overwrite output with result or add to it
-      result,                     // result
-      matrix.rows());             // rows of result
+  apply_matrix_in_first_dimension(make_not_null(result), matrix, input,
+                                  size / matrix.columns(), add_to_result);
 }
 void apply_matrix_in_first_dim(std::complex<double>* result,
                                const std::complex<double>* const input,
@@ -127,6 +127,14 @@ auto logical_partial_derivative(const Tensor<DataType, SymmList, IndexList>& u,
 /// The return-by-value overload requires that the `DerivativeTags` are
 /// specified explicitly as the first template parameter. It returns a
 /// `Variables` with the `DerivativeTags` wrapped in `Tags::deriv`.
+///
+/// The overloads that take `u` check whether the `inverse_jacobian` is diagonal
+/// and constant over the element, as for a product of `Affine` maps. If it is,
+/// they skip the contraction with the inverse Jacobian and call the overload
+/// for a `diagonal_inverse_jacobian`. Otherwise real variables are
+/// differentiated in blocks of tensor components that fit into the cache, and
+/// the logical derivatives of each block are contracted with the inverse
+/// Jacobian before the next block is differentiated.
 template <typename ResultTags, typename DerivativeTags, size_t Dim,
           typename DerivativeFrame>
 void partial_derivatives(
@@ -154,6 +162,55 @@ auto partial_derivatives(
                                   tmpl::size_t<Dim>, DerivativeFrame>>;
 /// @}
 
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Compute the partial derivatives of each variable for an element whose
+ * inverse Jacobian is diagonal and constant, e.g. an element of a
+ * `ProductOf2Maps` or `ProductOf3Maps` of `Affine` maps.
+ *
+ * The `diagonal_inverse_jacobian` holds the constant values
+ * \f$\partial\xi^i/\partial x^i\f$. Since the inverse Jacobian is diagonal
+ * the contraction with the logical derivatives reduces to a scaling, which is
+ * fused into the transpose that restores the memory layout after each 1D
+ * differentiation. This avoids both the buffer holding the logical derivatives
+ * and the separate pass over memory for the contraction.
+ *
+ * The subset of tags being differentiated is inferred from `ResultTags` and
+ * must be the head of `VariableTags`, like for the other overloads.
+ */
+template <typename ResultTags, typename VariableTags, size_t Dim>
+void partial_derivatives(
+    gsl::not_null<Variables<ResultTags>*> du, const Variables<VariableTags>& u,
+    const Mesh<Dim>& mesh,
+    const std::array<double, Dim>& diagonal_inverse_jacobian);
+
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Compute the partial derivatives of each variable with respect to the
+ * inertial coordinates for an element whose grid-to-inertial map has a
+ * spatially uniform Jacobian, e.g. a rigid rotation, uniform expansion or
+ * translation.
+ *
+ * The inverse Jacobian is given in factored form: the time-independent
+ * `logical_to_grid_inverse_jacobian` at every grid point, and the single
+ * matrix `grid_to_inertial_inverse_jacobian`
+ * \f$\partial X^k/\partial x^j\f$ that holds at all points. This avoids
+ * recomputing and storing the inertial inverse Jacobian at every grid point on
+ * every substep, see
+ * `domain::CoordinateMapBase::jacobian_is_spatially_uniform`.
+ *
+ * The subset of tags being differentiated is inferred from `ResultTags` and
+ * must be the head of `VariableTags`, like for the other overloads.
+ */
+template <typename ResultTags, typename VariableTags, size_t Dim>
+void partial_derivatives(
+    gsl::not_null<Variables<ResultTags>*> du, const Variables<VariableTags>& u,
+    const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Grid>&
+        logical_to_grid_inverse_jacobian,
+    const InverseJacobian<double, Dim, Frame::Grid, Frame::Inertial>&
+        grid_to_inertial_inverse_jacobian);
+
 /// @{
 /// \ingroup NumericalAlgorithmsGroup
 /// \brief Compute the partial derivative of a `Tensor` with respect to
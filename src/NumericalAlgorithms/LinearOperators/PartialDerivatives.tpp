@@ -5,6 +5,12 @@
 
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <type_traits>
+
+#include "DataStructures/ApplyMatrixInFirstDimension.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -127,7 +133,9 @@ void logical_partial_derivatives(
     gsl::at(deriv_pointers, i) =
         gsl::at(*logical_partial_derivatives_of_u, i).data();
   }
-  if constexpr (Dim == 1) {
+  // Only transposing along the strided dimensions needs buffers, which is not
+  // done for real values
+  if constexpr (Dim == 1 or std::is_same_v<ValueType, double>) {
     Variables<DerivativeTags>* temp = nullptr;
     partial_derivatives_detail::LogicalImpl<Dim, VariableTags, DerivativeTags>::
         apply(make_not_null(&deriv_pointers), temp, temp, u, mesh);
@@ -188,6 +196,121 @@ void partial_derivatives(
       inverse_jacobian);
 }
 
+namespace partial_derivatives_detail {
+template <size_t Dim, typename DerivativeFrame>
+std::optional<std::array<double, Dim>> constant_diagonal(
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          DerivativeFrame>& inverse_jacobian) {
+  const size_t num_points = get<0, 0>(inverse_jacobian).size();
+  if (num_points == 0) {
+    return std::nullopt;
+  }
+  std::array<double, Dim> diagonal{};
+  // Curved maps are usually detected within the first few points of the
+  // diagonal, so those are checked first
+  for (size_t i = 0; i < Dim; ++i) {
+    const DataVector& component = inverse_jacobian.get(i, i);
+    gsl::at(diagonal, i) = component[0];
+    for (size_t s = 1; s < num_points; ++s) {
+      if (component[s] != gsl::at(diagonal, i)) {
+        return std::nullopt;
+      }
+    }
+  }
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = 0; j < Dim; ++j) {
+      if (i != j) {
+        const DataVector& component = inverse_jacobian.get(i, j);
+        for (size_t s = 0; s < num_points; ++s) {
+          if (component[s] != 0.0) {
+            return std::nullopt;
+          }
+        }
+      }
+    }
+  }
+  return diagonal;
+}
+
+// The number of logical derivative values that `fused_partial_derivatives_impl`
+// computes at a time, which is 128 KiB and so stays in the L2 cache
+constexpr size_t fused_block_size = 16384;
+
+// Computes `du` for a general inverse Jacobian of real variables. The
+// components of `u` are processed in blocks of `components_per_block`: the
+// logical derivatives of a block are computed into `buffer`, which holds `Dim`
+// blocks, and are contracted with the inverse Jacobian right away while they
+// are still in cache. So the logical derivatives of all components are never
+// stored at once, and the contraction doesn't make a second pass over main
+// memory. The layout of `du` is that of `partial_derivatives_impl`: for each
+// independent component of `u` the `Dim` derivative components are stored
+// contiguously.
+template <size_t Dim, typename DerivativeFrame>
+void fused_partial_derivatives_impl(
+    const gsl::not_null<double*> du, const gsl::not_null<double*> buffer,
+    const double* const u, const size_t number_of_independent_components,
+    const size_t components_per_block, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          DerivativeFrame>& inverse_jacobian) {
+  const size_t num_grid_points = mesh.number_of_grid_points();
+  std::array<const Matrix*, Dim> differentiation_matrices{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(differentiation_matrices, d) =
+        &Spectral::differentiation_matrix(mesh.slice_through(d));
+  }
+  std::array<double*, Dim> logical_du{};
+  for (size_t d = 0; d < Dim; ++d) {
+    // clang-tidy: no pointer arithmetic
+    gsl::at(logical_du, d) =
+        buffer.get() + d * components_per_block * num_grid_points;  // NOLINT
+  }
+  for (size_t first_component = 0;
+       first_component < number_of_independent_components;
+       first_component += components_per_block) {
+    const size_t block_components =
+        std::min(components_per_block,
+                 number_of_independent_components - first_component);
+    const size_t block_size = block_components * num_grid_points;
+    const double* const u_block =
+        u + first_component * num_grid_points;  // NOLINT
+    apply_matrix_in_first_dim(logical_du[0], u_block,
+                              *differentiation_matrices[0], block_size);
+    if constexpr (Dim > 1) {
+      apply_matrix_in_strided_dimension(
+          make_not_null(logical_du[1]), *differentiation_matrices[1], u_block,
+          mesh.extents(0), block_size / (mesh.extents(0) * mesh.extents(1)));
+    }
+    if constexpr (Dim > 2) {
+      apply_matrix_in_strided_dimension(
+          make_not_null(logical_du[2]), *differentiation_matrices[2], u_block,
+          mesh.extents(0) * mesh.extents(1), block_components);
+    }
+    for (size_t c = 0; c < block_components; ++c) {
+      for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
+        double* const du_c =
+            du.get() +  // NOLINT
+            ((first_component + c) * Dim + deriv_index) * num_grid_points;
+        const double* inv_jac = inverse_jacobian.get(0, deriv_index).data();
+        const double* logical_du_c = logical_du[0] + c * num_grid_points;
+        for (size_t s = 0; s < num_grid_points; ++s) {
+          du_c[s] = inv_jac[s] * logical_du_c[s];  // NOLINT
+        }
+        for (size_t logical_deriv_index = 1; logical_deriv_index < Dim;
+             ++logical_deriv_index) {
+          inv_jac =
+              inverse_jacobian.get(logical_deriv_index, deriv_index).data();
+          logical_du_c = gsl::at(logical_du, logical_deriv_index) +  // NOLINT
+                         c * num_grid_points;
+          for (size_t s = 0; s < num_grid_points; ++s) {
+            du_c[s] += inv_jac[s] * logical_du_c[s];  // NOLINT
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace partial_derivatives_detail
+
 template <typename ResultTags, typename VariableTags, size_t Dim,
           typename DerivativeFrame>
 void partial_derivatives(
@@ -203,6 +326,14 @@ void partial_derivatives(
           tmpl::transform<db::wrap_tags_in<Tags::deriv, DerivativeTags,
                                            tmpl::size_t<Dim>, DerivativeFrame>,
                           tmpl::bind<tmpl::type_from, tmpl::_1>>>);
+  // Elements of products of `Affine` maps skip the contraction with the
+  // inverse Jacobian
+  if (const auto diagonal =
+          partial_derivatives_detail::constant_diagonal(inverse_jacobian);
+      diagonal.has_value()) {
+    partial_derivatives(du, u, mesh, *diagonal);
+    return;
+  }
   using ValueType = typename Variables<VariableTags>::value_type;
   auto& partial_derivatives_of_u = *du;
   // For mutating compute items we must set the size.
@@ -210,7 +341,25 @@ void partial_derivatives(
                mesh.number_of_grid_points())) {
     partial_derivatives_of_u.initialize(mesh.number_of_grid_points());
   }
+  if constexpr (std::is_same_v<ValueType, double>) {
+    constexpr size_t number_of_components =
+        Variables<DerivativeTags>::number_of_independent_components;
+    const size_t components_per_block = std::clamp(
+        partial_derivatives_detail::fused_block_size /
+            (Dim * mesh.number_of_grid_points()),
+        size_t{1}, number_of_components);
+    const auto buffer = cpp20::make_unique_for_overwrite<double[]>(
+        Dim * components_per_block * mesh.number_of_grid_points());
+    partial_derivatives_detail::fused_partial_derivatives_impl(
+        make_not_null(partial_derivatives_of_u.data()),
+        make_not_null(buffer.get()), u.data(), number_of_components,
+        components_per_block, mesh, inverse_jacobian);
+    return;
+  }
 
+  // Complex values are differentiated along the strided dimensions with
+  // transposes, so their logical derivatives are computed for all components
+  // first
   const size_t vars_size =
       u.number_of_grid_points() *
       Variables<DerivativeTags>::number_of_independent_components;
@@ -256,6 +405,170 @@ partial_derivatives(
   return partial_derivatives_of_u;
 }
 
+namespace partial_derivatives_detail {
+// Computes `du` for a constant diagonal inverse Jacobian. For each logical
+// direction we differentiate all components at once in `deriv_buffer`, then
+// transpose directly into the strided location of `du` while scaling by the
+// inverse Jacobian. The layout of `du` is that of `partial_derivatives_impl`:
+// for each independent component of `u` the `Dim` derivative components are
+// stored contiguously.
+template <size_t Dim, typename ValueType>
+void diagonal_partial_derivatives_impl(
+    const gsl::not_null<ValueType*> du, const gsl::not_null<ValueType*> buffer,
+    const ValueType* const u, const size_t number_of_independent_components,
+    const Mesh<Dim>& mesh,
+    const std::array<double, Dim>& diagonal_inverse_jacobian) {
+  const size_t num_grid_points = mesh.number_of_grid_points();
+  const size_t deriv_size = number_of_independent_components * num_grid_points;
+  // clang-tidy: no pointer arithmetic
+  ValueType* const deriv_buffer = buffer.get();
+  ValueType* const transpose_buffer = buffer.get() + deriv_size;  // NOLINT
+
+  apply_matrix_in_first_dim(deriv_buffer, u,
+                            Spectral::differentiation_matrix(
+                                mesh.slice_through(0)),
+                            deriv_size);
+  const auto scale_into_du = [&du, &deriv_buffer, &num_grid_points,
+                               &number_of_independent_components,
+                               &diagonal_inverse_jacobian](const size_t d) {
+    for (size_t c = 0; c < number_of_independent_components; ++c) {
+      ValueType* const du_c =
+          du.get() + (c * Dim + d) * num_grid_points;  // NOLINT
+      const ValueType* const deriv_c =
+          deriv_buffer + c * num_grid_points;  // NOLINT
+      for (size_t s = 0; s < num_grid_points; ++s) {
+        du_c[s] = gsl::at(diagonal_inverse_jacobian, d) * deriv_c[s];  // NOLINT
+      }
+    }
+  };
+  scale_into_du(0);
+  if constexpr (std::is_same_v<ValueType, double>) {
+    // Differentiate along the strided dimensions directly, so the derivatives
+    // are in the layout of `u` and no transposes are needed
+    size_t stride = 1;
+    for (size_t d = 1; d < Dim; ++d) {
+      stride *= mesh.extents(d - 1);
+      apply_matrix_in_strided_dimension(
+          make_not_null(deriv_buffer),
+          Spectral::differentiation_matrix(mesh.slice_through(d)), u, stride,
+          deriv_size / (stride * mesh.extents(d)));
+      scale_into_du(d);
+    }
+    return;
+  }
+  if constexpr (Dim > 1) {
+    // Eta-fastest layout: index `j + xi_slices * i0` where
+    // `j = i1 + n1 * (i2 + n2 * c)`.
+    const size_t n0 = mesh.extents(0);
+    const size_t xi_slices = deriv_size / n0;
+    const size_t xi_slices_per_component = num_grid_points / n0;
+    raw_transpose(make_not_null(transpose_buffer), u, n0, xi_slices);
+    apply_matrix_in_first_dim(deriv_buffer, transpose_buffer,
+                              Spectral::differentiation_matrix(
+                                  mesh.slice_through(1)),
+                              deriv_size);
+    for (size_t c = 0; c < number_of_independent_components; ++c) {
+      ValueType* const du_c =
+          du.get() + (c * Dim + 1) * num_grid_points;  // NOLINT
+      for (size_t k = 0; k < xi_slices_per_component; ++k) {
+        const size_t j = c * xi_slices_per_component + k;
+        for (size_t i0 = 0; i0 < n0; ++i0) {
+          du_c[i0 + n0 * k] =                                         // NOLINT
+              diagonal_inverse_jacobian[1] * deriv_buffer[j + xi_slices * i0];
+        }
+      }
+    }
+  }
+  if constexpr (Dim > 2) {
+    // Zeta-fastest layout: index `q + number_of_chunks * p` where
+    // `p = i0 + n0 * i1` and `q = i2 + n2 * c`.
+    const size_t chunk_size = mesh.extents(0) * mesh.extents(1);
+    const size_t number_of_chunks = deriv_size / chunk_size;
+    const size_t n2 = mesh.extents(2);
+    raw_transpose(make_not_null(transpose_buffer), u, chunk_size,
+                  number_of_chunks);
+    apply_matrix_in_first_dim(deriv_buffer, transpose_buffer,
+                              Spectral::differentiation_matrix(
+                                  mesh.slice_through(2)),
+                              deriv_size);
+    for (size_t c = 0; c < number_of_independent_components; ++c) {
+      ValueType* const du_c =
+          du.get() + (c * Dim + 2) * num_grid_points;  // NOLINT
+      for (size_t i2 = 0; i2 < n2; ++i2) {
+        const size_t q = i2 + n2 * c;
+        for (size_t p = 0; p < chunk_size; ++p) {
+          du_c[p + chunk_size * i2] =  // NOLINT
+              diagonal_inverse_jacobian[2] *
+              deriv_buffer[q + number_of_chunks * p];
+        }
+      }
+    }
+  }
+}
+}  // namespace partial_derivatives_detail
+
+template <typename ResultTags, typename VariableTags, size_t Dim>
+void partial_derivatives(
+    const gsl::not_null<Variables<ResultTags>*> du,
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    const std::array<double, Dim>& diagonal_inverse_jacobian) {
+  using DerivativeTags =
+      tmpl::front<tmpl::split_at<VariableTags, tmpl::size<ResultTags>>>;
+  static_assert(Variables<ResultTags>::number_of_independent_components ==
+                    Dim * Variables<DerivativeTags>::
+                              number_of_independent_components,
+                "The ResultTags must be the derivatives of the head of the "
+                "VariableTags.");
+  using ValueType = typename Variables<VariableTags>::value_type;
+  // For mutating compute items we must set the size.
+  if (UNLIKELY(du->number_of_grid_points() != mesh.number_of_grid_points())) {
+    du->initialize(mesh.number_of_grid_points());
+  }
+  const size_t deriv_size =
+      u.number_of_grid_points() *
+      Variables<DerivativeTags>::number_of_independent_components;
+  const auto buffer = cpp20::make_unique_for_overwrite<ValueType[]>(
+      (Dim > 1 ? 2 : 1) * deriv_size);
+  partial_derivatives_detail::diagonal_partial_derivatives_impl(
+      make_not_null(du->data()), make_not_null(buffer.get()), u.data(),
+      Variables<DerivativeTags>::number_of_independent_components, mesh,
+      diagonal_inverse_jacobian);
+}
+
+template <typename ResultTags, typename VariableTags, size_t Dim>
+void partial_derivatives(
+    const gsl::not_null<Variables<ResultTags>*> du,
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Grid>&
+        logical_to_grid_inverse_jacobian,
+    const InverseJacobian<double, Dim, Frame::Grid, Frame::Inertial>&
+        grid_to_inertial_inverse_jacobian) {
+  // Contracting the factors once is cheaper than applying them one after the
+  // other to every component of `u`. The logical to inertial inverse Jacobian
+  // only lives for the duration of this call.
+  const size_t num_grid_points = mesh.number_of_grid_points();
+  DataVector buffer{Dim * Dim * num_grid_points};
+  InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+      logical_to_inertial_inverse_jacobian{};
+  for (size_t i = 0; i < logical_to_inertial_inverse_jacobian.size(); ++i) {
+    logical_to_inertial_inverse_jacobian[i].set_data_ref(
+        &buffer[i * num_grid_points], num_grid_points);
+  }
+  for (size_t logical_i = 0; logical_i < Dim; ++logical_i) {
+    for (size_t inertial_i = 0; inertial_i < Dim; ++inertial_i) {
+      auto& component =
+          logical_to_inertial_inverse_jacobian.get(logical_i, inertial_i);
+      component = logical_to_grid_inverse_jacobian.get(logical_i, 0) *
+                  grid_to_inertial_inverse_jacobian.get(0, inertial_i);
+      for (size_t grid_i = 1; grid_i < Dim; ++grid_i) {
+        component += logical_to_grid_inverse_jacobian.get(logical_i, grid_i) *
+                     grid_to_inertial_inverse_jacobian.get(grid_i, inertial_i);
+      }
+    }
+  }
+  partial_derivatives(du, u, mesh, logical_to_inertial_inverse_jacobian);
+}
+
 namespace partial_derivatives_detail {
 template <typename VariableTags, typename DerivativeTags>
 struct LogicalImpl<1, VariableTags, DerivativeTags> {
@@ -299,11 +612,19 @@ struct LogicalImpl<2, VariableTags, DerivativeTags> {
     const size_t num_components_times_xi_slices = deriv_size / mesh.extents(0);
     apply_matrix_in_first_dim(logical_partial_derivatives_of_u[0], u.data(),
                               differentiation_matrix_xi, deriv_size);
+    const Matrix& differentiation_matrix_eta =
+        Spectral::differentiation_matrix(mesh.slice_through(1));
+    if constexpr (std::is_same_v<ValueType, double>) {
+      // Differentiate along eta directly instead of transposing
+      apply_matrix_in_strided_dimension(
+          make_not_null(logical_partial_derivatives_of_u[1]),
+          differentiation_matrix_eta, u.data(), mesh.extents(0),
+          deriv_size / u.number_of_grid_points());
+      return;
+    }
     transpose<Variables<VariableTags>, Variables<DerivativeTags>>(
         make_not_null(u_eta_fastest), u, mesh.extents(0),
         num_components_times_xi_slices);
-    const Matrix& differentiation_matrix_eta =
-        Spectral::differentiation_matrix(mesh.slice_through(1));
     apply_matrix_in_first_dim(partial_u_wrt_eta->data(), u_eta_fastest->data(),
                               differentiation_matrix_eta, deriv_size);
     raw_transpose(make_not_null(logical_partial_derivatives_of_u[1]),
@@ -334,12 +655,28 @@ struct LogicalImpl<3, VariableTags, DerivativeTags> {
     const size_t num_components_times_xi_slices = deriv_size / mesh.extents(0);
     apply_matrix_in_first_dim(logical_partial_derivatives_of_u[0], u.data(),
                               differentiation_matrix_xi, deriv_size);
+    const Matrix& differentiation_matrix_eta =
+        Spectral::differentiation_matrix(mesh.slice_through(1));
+    const Matrix& differentiation_matrix_zeta =
+        Spectral::differentiation_matrix(mesh.slice_through(2));
+    const size_t chunk_size = mesh.extents(0) * mesh.extents(1);
+    const size_t number_of_chunks = deriv_size / chunk_size;
+    if constexpr (std::is_same_v<ValueType, double>) {
+      // Differentiate along eta and zeta directly instead of transposing
+      apply_matrix_in_strided_dimension(
+          make_not_null(logical_partial_derivatives_of_u[1]),
+          differentiation_matrix_eta, u.data(), mesh.extents(0),
+          number_of_chunks);
+      apply_matrix_in_strided_dimension(
+          make_not_null(logical_partial_derivatives_of_u[2]),
+          differentiation_matrix_zeta, u.data(), chunk_size,
+          deriv_size / u.number_of_grid_points());
+      return;
+    }
 
     transpose<Variables<VariableTags>, Variables<DerivativeTags>>(
         make_not_null(u_eta_or_zeta_fastest), u, mesh.extents(0),
         num_components_times_xi_slices);
-    const Matrix& differentiation_matrix_eta =
-        Spectral::differentiation_matrix(mesh.slice_through(1));
     apply_matrix_in_first_dim(partial_u_wrt_eta_or_zeta->data(),
                               u_eta_or_zeta_fastest->data(),
                               differentiation_matrix_eta, deriv_size);
@@ -347,12 +684,8 @@ struct LogicalImpl<3, VariableTags, DerivativeTags> {
                   partial_u_wrt_eta_or_zeta->data(),
                   num_components_times_xi_slices, mesh.extents(0));
 
-    const size_t chunk_size = mesh.extents(0) * mesh.extents(1);
-    const size_t number_of_chunks = deriv_size / chunk_size;
     transpose(make_not_null(u_eta_or_zeta_fastest), u, chunk_size,
               number_of_chunks);
-    const Matrix& differentiation_matrix_zeta =
-        Spectral::differentiation_matrix(mesh.slice_through(2));
     apply_matrix_in_first_dim(partial_u_wrt_eta_or_zeta->data(),
                               u_eta_or_zeta_fastest->data(),
                               differentiation_matrix_zeta, deriv_size);
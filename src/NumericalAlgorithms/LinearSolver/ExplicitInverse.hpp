@@ -4,10 +4,18 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
+#include <complex>
 #include <cstddef>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
 #include <string>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -19,6 +27,7 @@
 #include "Options/Auto.hpp"
 #include "Options/String.hpp"
 #include "Parallel/Tags/ArrayIndex.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
@@ -43,6 +52,121 @@ struct ExplicitInverse {
 };
 }  // namespace Registrars
 
+namespace detail {
+// The inverse of an operator matrix, which `ExplicitInverse` solvers of
+// identical operators can share
+template <typename ValueType>
+struct ExplicitInverseData {
+  using SinglePrecisionType =
+      std::conditional_t<std::is_same_v<ValueType, std::complex<double>>,
+                         std::complex<float>, float>;
+
+  blaze::DynamicMatrix<ValueType, blaze::columnMajor> inverse{};
+  // Only used in single precision, in which case `inverse` is released
+  blaze::DynamicMatrix<SinglePrecisionType, blaze::columnMajor>
+      single_precision_inverse{};
+  // The operator matrix applied to a fixed random vector, which identifies
+  // identical operators. Only computed if the inverse is shared.
+  blaze::DynamicVector<ValueType> fingerprint{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | inverse;
+    p | single_precision_inverse;
+    p | fingerprint;
+  }
+};
+
+// The operator `matrix` applied to a fixed random vector. Operators that agree
+// on this vector are considered identical.
+template <typename ValueType>
+blaze::DynamicVector<ValueType> operator_fingerprint(
+    const blaze::DynamicMatrix<ValueType, blaze::columnMajor>& matrix) {
+  std::mt19937 generator{1};
+  std::uniform_real_distribution<double> dist{0.5, 1.5};
+  blaze::DynamicVector<ValueType> random_vector(matrix.columns());
+  for (auto& value : random_vector) {
+    value = dist(generator);
+  }
+  return matrix * random_vector;
+}
+
+/*!
+ * \brief The inverses that `ExplicitInverse` solvers on this process share
+ *
+ * \details Only weak references are held, so an inverse is released once no
+ * solver uses it anymore. All member functions are thread-safe.
+ */
+template <typename ValueType>
+class SharedExplicitInverses {
+ public:
+  /// The record of this process
+  static SharedExplicitInverses& local() {
+    static SharedExplicitInverses shared_inverses{};
+    return shared_inverses;
+  }
+
+  /// An inverse in the given precision whose fingerprint agrees with the
+  /// `fingerprint` to the relative `tolerance`, or `nullptr` if there is none
+  std::shared_ptr<ExplicitInverseData<ValueType>> find(
+      const blaze::DynamicVector<ValueType>& fingerprint,
+      const bool single_precision, const double tolerance) const {
+    double scale = 0.;
+    for (const auto& value : fingerprint) {
+      scale = std::max(scale, std::abs(value));
+    }
+    const std::lock_guard lock{mutex_};
+    for (const auto& entry : entries_) {
+      auto data = entry.data.lock();
+      if (data == nullptr or entry.single_precision != single_precision or
+          data->fingerprint.size() != fingerprint.size()) {
+        continue;
+      }
+      bool agrees = true;
+      for (size_t i = 0; i < fingerprint.size(); ++i) {
+        if (std::abs(data->fingerprint[i] - fingerprint[i]) >
+            tolerance * scale) {
+          agrees = false;
+          break;
+        }
+      }
+      if (agrees) {
+        return data;
+      }
+    }
+    return nullptr;
+  }
+
+  void insert(const std::shared_ptr<ExplicitInverseData<ValueType>>& data,
+              const bool single_precision) {
+    const std::lock_guard lock{mutex_};
+    entries_.erase(
+        std::remove_if(entries_.begin(), entries_.end(),
+                       [](const Entry& entry) { return entry.data.expired(); }),
+        entries_.end());
+    entries_.push_back({single_precision, data});
+  }
+
+  /// The number of inverses that are still in use
+  size_t size() const {
+    const std::lock_guard lock{mutex_};
+    return static_cast<size_t>(
+        std::count_if(entries_.begin(), entries_.end(), [](const Entry& entry) {
+          return not entry.data.expired();
+        }));
+  }
+
+ private:
+  struct Entry {
+    bool single_precision;
+    std::weak_ptr<ExplicitInverseData<ValueType>> data;
+  };
+
+  mutable std::mutex mutex_{};
+  std::vector<Entry> entries_{};
+};
+}  // namespace detail
+
 /*!
  * \brief Linear solver that builds a matrix representation of the linear
  * operator and inverts it directly
@@ -76,6 +200,23 @@ struct ExplicitInverse {
  *   operator only changes "a little". In that case the preconditioner solves
  *   subdomain problems only approximately, but possibly still sufficiently to
  *   provide effective preconditioning.
+ * - When this solver is used as preconditioner, e.g. as Schwarz subdomain
+ *   solver, its solutions don't need to be accurate to double precision. In
+ *   that case you can enable the `SinglePrecision` option to store and apply
+ *   the inverse in single precision. The matrix is still built and inverted in
+ *   double precision, but storing the inverse takes half the memory and
+ *   applying it moves half the data, which is the dominant cost of successive
+ *   solves. Expect the relative error of the solutions to be about
+ *   \f$10^{-7}\f$ times the condition number of the operator.
+ * - Many subdomains have identical operators on regular domains, e.g. all
+ *   elements of the same size with neighbors of the same size away from
+ *   external boundaries. Set the `ShareInverses` option to invert and store the
+ *   matrix only once for all subdomains on a process whose operators agree to
+ *   the given relative tolerance. The operators are compared by their action
+ *   on a fixed random vector, which accounts for the mesh, the geometry, the
+ *   overlaps and the boundary conditions of the subdomain alike. Each solver
+ *   still builds its matrix, but the inversion, which dominates the
+ *   initialization cost, and the memory for the inverse are shared.
  */
 template <typename ValueType,
           typename LinearSolverRegistrars =
@@ -95,7 +236,26 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
         "written.";
   };
 
-  using options = tmpl::list<WriteMatrixToFile>;
+  struct SinglePrecision {
+    using type = bool;
+    static constexpr Options::String help =
+        "Store and apply the inverse in single precision. This halves the "
+        "memory and memory bandwidth needed for successive solves, but limits "
+        "their accuracy, so enable this only when the solver is used as a "
+        "preconditioner.";
+  };
+
+  struct ShareInverses {
+    using type = Options::Auto<double, Options::AutoLabel::None>;
+    static constexpr Options::String help =
+        "Share the inverse with the other solvers on this process whose "
+        "operators agree with this one to this relative tolerance, so that "
+        "identical subdomain operators (e.g. on regular grids) are inverted "
+        "and stored only once. Set to 'None' to store a separate inverse for "
+        "each solver.";
+  };
+
+  using options = tmpl::list<WriteMatrixToFile, SinglePrecision, ShareInverses>;
   static constexpr Options::String help =
       "Build a matrix representation of the linear operator and invert it "
       "directly. This means that the first solve has a large initialization "
@@ -108,8 +268,12 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
   ~ExplicitInverse() = default;
 
   explicit ExplicitInverse(
-      std::optional<std::string> matrix_filename = std::nullopt)
-      : matrix_filename_(std::move(matrix_filename)) {}
+      std::optional<std::string> matrix_filename = std::nullopt,
+      const bool single_precision = false,
+      const std::optional<double> share_tolerance = std::nullopt)
+      : matrix_filename_(std::move(matrix_filename)),
+        single_precision_(single_precision),
+        share_tolerance_(share_tolerance) {}
 
   /// \cond
   explicit ExplicitInverse(CkMigrateMessage* m) : Base(m) {}
@@ -139,28 +303,69 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
       const SourceType& source,
       const std::tuple<OperatorArgs...>& operator_args = std::tuple{}) const;
 
-  /// Flags the operator to require re-initialization. No memory is released.
+  /// Flags the operator to require re-initialization. No memory is released,
+  /// and the memory of an inverse that isn't shared is reused by the rebuild.
   /// Call this function to rebuild the solver when the operator changed.
   void reset() override { size_ = std::numeric_limits<size_t>::max(); }
 
   /// Size of the operator. The stored matrix will have `size^2` entries.
   size_t size() const { return size_; }
 
+  /// Whether the inverse is stored and applied in single precision
+  bool single_precision() const { return single_precision_; }
+
+  /// The relative tolerance to which operators must agree to share their
+  /// inverse, or `std::nullopt` if the inverse isn't shared
+  const std::optional<double>& share_tolerance() const {
+    return share_tolerance_;
+  }
+
+  /// Whether another solver uses the same inverse
+  bool shares_inverse() const { return inverse_.use_count() > 1; }
+
   /// The matrix representation of the solver. This matrix approximates the
-  /// inverse of the subdomain operator.
+  /// inverse of the subdomain operator. Only available if the solver doesn't
+  /// run in single precision.
   const blaze::DynamicMatrix<ValueType, blaze::columnMajor>&
   matrix_representation() const {
-    return inverse_;
+    ASSERT(not single_precision_,
+           "The matrix representation is not stored in double precision when "
+           "the solver runs in single precision.");
+    ASSERT(inverse_ != nullptr,
+           "The matrix representation is only available after a solve.");
+    return inverse_->inverse;
   }
 
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) override {
     p | matrix_filename_;
+    p | single_precision_;
+    p | share_tolerance_;
     p | size_;
-    p | inverse_;
-    if (p.isUnpacking() and size_ != std::numeric_limits<size_t>::max()) {
-      source_workspace_.resize(size_);
-      solution_workspace_.resize(size_);
+    bool has_inverse = inverse_ != nullptr;
+    p | has_inverse;
+    if (has_inverse) {
+      if (p.isUnpacking()) {
+        inverse_ = std::make_shared<detail::ExplicitInverseData<ValueType>>();
+      }
+      p | *inverse_;
+    }
+    if (p.isUnpacking()) {
+      // Share the inverse again with identical operators on the new process
+      if (share_tolerance_.has_value() and has_inverse) {
+        auto& shared_inverses =
+            detail::SharedExplicitInverses<ValueType>::local();
+        auto shared_inverse = shared_inverses.find(
+            inverse_->fingerprint, single_precision_, *share_tolerance_);
+        if (shared_inverse != nullptr) {
+          inverse_ = std::move(shared_inverse);
+        } else {
+          shared_inverses.insert(inverse_, single_precision_);
+        }
+      }
+      if (size_ != std::numeric_limits<size_t>::max()) {
+        resize_workspaces();
+      }
     }
   }
 
@@ -169,20 +374,42 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
   }
 
  private:
+  using SinglePrecisionType =
+      typename detail::ExplicitInverseData<ValueType>::SinglePrecisionType;
+
+  void resize_workspaces() const {
+    if (single_precision_) {
+      single_precision_source_workspace_.resize(size_);
+      single_precision_solution_workspace_.resize(size_);
+    } else {
+      source_workspace_.resize(size_);
+      solution_workspace_.resize(size_);
+    }
+  }
+
   std::optional<std::string> matrix_filename_{};
+  bool single_precision_ = false;
+  std::optional<double> share_tolerance_{};
   // Caches for successive solves of the same operator
   // NOLINTNEXTLINE(spectre-mutable)
   mutable size_t size_ = std::numeric_limits<size_t>::max();
   // We currently store the matrix representation in a dense matrix because
-  // Blaze doesn't support the inversion of sparse matrices (yet).
+  // Blaze doesn't support the inversion of sparse matrices (yet). The inverse
+  // is only modified while no other solver uses it.
   // NOLINTNEXTLINE(spectre-mutable)
-  mutable blaze::DynamicMatrix<ValueType, blaze::columnMajor> inverse_{};
+  mutable std::shared_ptr<detail::ExplicitInverseData<ValueType>> inverse_{};
 
   // Buffers to avoid re-allocating memory for applying the operator
   // NOLINTNEXTLINE(spectre-mutable)
   mutable blaze::DynamicVector<ValueType> source_workspace_{};
   // NOLINTNEXTLINE(spectre-mutable)
   mutable blaze::DynamicVector<ValueType> solution_workspace_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicVector<SinglePrecisionType>
+      single_precision_source_workspace_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicVector<SinglePrecisionType>
+      single_precision_solution_workspace_{};
 };
 
 template <typename ValueType, typename LinearSolverRegistrars>
@@ -196,14 +423,20 @@ ExplicitInverse<ValueType, LinearSolverRegistrars>::solve(
   if (UNLIKELY(size_ == std::numeric_limits<size_t>::max())) {
     const auto& used_for_size = source;
     size_ = used_for_size.size();
-    source_workspace_.resize(size_);
-    solution_workspace_.resize(size_);
-    inverse_.resize(size_, size_);
+    resize_workspaces();
+    // Reuse the memory of the previous inverse unless other solvers use it or
+    // may find it to share it
+    if (inverse_ == nullptr or inverse_.use_count() > 1 or
+        share_tolerance_.has_value()) {
+      inverse_ = std::make_shared<detail::ExplicitInverseData<ValueType>>();
+    }
+    auto& inverse = inverse_->inverse;
+    inverse.resize(size_, size_);
     // Construct explicit matrix representation by "sniffing out" the operator,
     // i.e. feeding it unit vectors
     auto operand_buffer = make_with_value<VarsType>(used_for_size, 0.);
     auto result_buffer = make_with_value<SourceType>(used_for_size, 0.);
-    build_matrix(make_not_null(&inverse_), make_not_null(&operand_buffer),
+    build_matrix(make_not_null(&inverse), make_not_null(&operand_buffer),
                  make_not_null(&result_buffer), linear_operator, operator_args);
     // Write to file before inverting
     if (UNLIKELY(matrix_filename_.has_value())) {
@@ -227,23 +460,64 @@ ExplicitInverse<ValueType, LinearSolverRegistrars>::solve(
       }();
       std::ofstream matrix_file(matrix_filename_.value() +
                                 filename_suffix.value_or("") + ".txt");
-      write_csv(matrix_file, inverse_, " ");
+      write_csv(matrix_file, inverse, " ");
+    }
+    // Use the inverse of an identical operator if another solver on this
+    // process already computed it
+    bool found_shared_inverse = false;
+    if (share_tolerance_.has_value()) {
+      inverse_->fingerprint = detail::operator_fingerprint(inverse);
+      auto shared_inverse =
+          detail::SharedExplicitInverses<ValueType>::local().find(
+              inverse_->fingerprint, single_precision_, *share_tolerance_);
+      if (shared_inverse != nullptr) {
+        inverse_ = std::move(shared_inverse);
+        found_shared_inverse = true;
+      }
     }
-    // Directly invert the matrix
-    try {
-      blaze::invert(inverse_);
-    } catch (const std::invalid_argument& e) {
-      ERROR("Could not invert subdomain matrix (size " << size_
-                                                       << "): " << e.what());
+    if (not found_shared_inverse) {
+      // Directly invert the matrix
+      try {
+        blaze::invert(inverse);
+      } catch (const std::invalid_argument& e) {
+        ERROR("Could not invert subdomain matrix (size " << size_
+                                                         << "): " << e.what());
+      }
+      // Round the inverse to single precision and release the double-precision
+      // matrix, so only the single-precision matrix is retained
+      if (single_precision_) {
+        inverse_->single_precision_inverse = inverse;
+        inverse.clear();
+        inverse.shrinkToFit();
+      }
+      if (share_tolerance_.has_value()) {
+        detail::SharedExplicitInverses<ValueType>::local().insert(
+            inverse_, single_precision_);
+      }
     }
   }
+  if (single_precision_) {
+    std::transform(source.begin(), source.end(),
+                   single_precision_source_workspace_.begin(),
+                   [](const ValueType value) {
+                     return static_cast<SinglePrecisionType>(value);
+                   });
+    single_precision_solution_workspace_ =
+        inverse_->single_precision_inverse * single_precision_source_workspace_;
+    std::transform(single_precision_solution_workspace_.begin(),
+                   single_precision_solution_workspace_.end(),
+                   solution->begin(), [](const SinglePrecisionType value) {
+                     return static_cast<ValueType>(value);
+                   });
+    return {0, 0};
+  }
   // Copy source into contiguous workspace. In cases where the source and
   // solution data are already stored contiguously we might avoid the copy and
   // the associated workspace memory. However, compared to the cost of building
   // and storing the matrix this is likely insignificant.
   std::copy(source.begin(), source.end(), source_workspace_.begin());
   // Apply inverse
-  solution_workspace_ = inverse_ * source_workspace_;
+  solution_workspace_ = inverse_->inverse * source_workspace_;
   // Reconstruct solution data from contiguous workspace
   std::copy(solution_workspace_.begin(), solution_workspace_.end(),
             solution->begin());
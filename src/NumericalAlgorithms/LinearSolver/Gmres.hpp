@@ -9,6 +9,7 @@
 #include <pup.h>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DynamicMatrix.hpp"
 #include "DataStructures/DynamicVector.hpp"
@@ -146,6 +147,21 @@ struct Gmres {
  * \f$N_\mathrm{restart}\f$ to activate restarting, or set it to 'None' to
  * deactivate restarting.
  *
+ * \par Subspace recycling:
+ * When the solver is used repeatedly with the same operator, e.g. as a
+ * subdomain solver, the solutions of the successive solves often share large
+ * components. Set the `recycled_vectors` argument of the constructor to keep
+ * the corrections \f$u_j\f$ of up to this many previous solves, together with
+ * \f$c_j = A(u_j)\f$ orthonormalized. Each solve first projects the recycled
+ * subspace out of the initial residual \f$r_0\f$, setting \f$x_0 \to x_0 +
+ * \sum_j \langle c_j, r_0\rangle u_j\f$, and then builds the Krylov subspace
+ * for the remaining residual. This is the augmentation step of subspace
+ * recycling methods like GCRO-DR (see \cite Parks2006), recycling the previous
+ * solutions instead of approximate eigenvectors. The recycled subspace costs
+ * one additional operator application per solve and is discarded when the
+ * solver is `reset()`, which must happen whenever the operator changes.
+ * Convergence is measured relative to the residual before the projection.
+ *
  * \par Preconditioning:
  * This implementation of the GMRES algorithm also supports preconditioning.
  * You can provide a linear operator \f$P\f$ that approximates the inverse of
@@ -190,6 +206,15 @@ class Gmres final : public PreconditionedLinearSolver<Preconditioner,
         "enable restarting.";
     static type suggested_value() { return {}; }
   };
+  struct RecycledVectors {
+    using type = size_t;
+    static constexpr Options::String help =
+        "Number of corrections from previous solves to project out of the "
+        "initial residual, or '0' to disable recycling. The solver must be "
+        "reset whenever the operator changes, so don't skip resets of the "
+        "subdomain solver when recycling.";
+    static size_t suggested_value() { return 0; }
+  };
   struct Verbosity {
     using type = ::Verbosity;
     static constexpr Options::String help = "Logging verbosity";
@@ -213,14 +238,19 @@ class Gmres final : public PreconditionedLinearSolver<Preconditioner,
       "non-positive-definite matrices and is not guaranteed to converge\n"
       "within N_A iterations anymore when restarting is activated.\n"
       "Activate restarting by setting the 'Restart' option to N_restart, or\n"
-      "deactivate restarting by setting it to 'None'.";
+      "deactivate restarting by setting it to 'None'.\n"
+      "\n"
+      "Recycling: When the operator stays the same over successive solves, the "
+      "corrections of the previous solves can be projected out of the initial "
+      "residual, so fewer iterations are needed.";
   using options = tmpl::flatten<tmpl::list<
-      ConvergenceCriteria, Verbosity, Restart,
+      ConvergenceCriteria, Verbosity, Restart, RecycledVectors,
       tmpl::conditional_t<std::is_same_v<Preconditioner, NoPreconditioner>,
                           tmpl::list<>, typename Base::PreconditionerOption>>>;
 
   Gmres(Convergence::Criteria convergence_criteria, ::Verbosity verbosity,
         std::optional<size_t> restart = std::nullopt,
+        size_t recycled_vectors = 0,
         std::optional<typename Base::PreconditionerType> local_preconditioner =
             std::nullopt,
         const Options::Context& context = {});
@@ -258,12 +288,14 @@ class Gmres final : public PreconditionedLinearSolver<Preconditioner,
   }
   ::Verbosity verbosity() const { return verbosity_; }
   size_t restart() const { return restart_; }
+  size_t recycled_vectors() const { return recycled_vectors_; }
 
   void pup(PUP::er& p) override {  // NOLINT
     Base::pup(p);
     p | convergence_criteria_;
     p | verbosity_;
     p | restart_;
+    p | recycled_vectors_;
     if (p.isUnpacking()) {
       initialize();
     }
@@ -280,7 +312,9 @@ class Gmres final : public PreconditionedLinearSolver<Preconditioner,
           NoIterationCallback{}) const;
 
   void reset() override {
-    // Nothing to reset. Only call into base class to reset preconditioner.
+    // The recycled subspace is only valid for the operator it was built with
+    recycled_solutions_.clear();
+    recycled_operator_applied_.clear();
     Base::reset();
   }
 
@@ -288,6 +322,7 @@ class Gmres final : public PreconditionedLinearSolver<Preconditioner,
   Convergence::Criteria convergence_criteria_{};
   ::Verbosity verbosity_{::Verbosity::Verbose};
   size_t restart_{};
+  size_t recycled_vectors_{0};
 
   // Memory buffers to avoid re-allocating memory for successive solves:
   // The `orthogonalization_history_` is built iteratively from inner products
@@ -316,20 +351,28 @@ class Gmres final : public PreconditionedLinearSolver<Preconditioner,
   // has converged.
   // NOLINTNEXTLINE(spectre-mutable)
   mutable std::vector<VarsType> preconditioned_basis_history_{};
+  // The recycled corrections of previous solves and the operator applied to
+  // them. The latter are orthonormal, and the oldest are discarded first. They
+  // aren't copied or serialized, since they only accelerate the solves.
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::vector<VarsType> recycled_solutions_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::vector<VarsType> recycled_operator_applied_{};
 };
 
 template <typename VarsType, typename Preconditioner,
           typename LinearSolverRegistrars>
 Gmres<VarsType, Preconditioner, LinearSolverRegistrars>::Gmres(
     Convergence::Criteria convergence_criteria, ::Verbosity verbosity,
-    std::optional<size_t> restart,
+    std::optional<size_t> restart, const size_t recycled_vectors,
     std::optional<typename Base::PreconditionerType> local_preconditioner,
     const Options::Context& context)
     // clang-tidy: trivially copyable
     : Base(std::move(local_preconditioner)),
       convergence_criteria_(std::move(convergence_criteria)),  // NOLINT
       verbosity_(std::move(verbosity)),                        // NOLINT
-      restart_(restart.value_or(convergence_criteria_.max_iterations)) {
+      restart_(restart.value_or(convergence_criteria_.max_iterations)),
+      recycled_vectors_(recycled_vectors) {
   if (restart_ == 0) {
     PARSE_ERROR(context,
                 "Can't restart every '0' iterations. Set to a nonzero "
@@ -347,7 +390,8 @@ Gmres<VarsType, Preconditioner, LinearSolverRegistrars>::Gmres(const Gmres& rhs)
     : Base(rhs),
       convergence_criteria_(rhs.convergence_criteria_),
       verbosity_(rhs.verbosity_),
-      restart_(rhs.restart_) {
+      restart_(rhs.restart_),
+      recycled_vectors_(rhs.recycled_vectors_) {
   initialize();
 }
 template <typename VarsType, typename Preconditioner,
@@ -359,6 +403,7 @@ Gmres<VarsType, Preconditioner, LinearSolverRegistrars>::operator=(
   convergence_criteria_ = rhs.convergence_criteria_;
   verbosity_ = rhs.verbosity_;
   restart_ = rhs.restart_;
+  recycled_vectors_ = rhs.recycled_vectors_;
   initialize();
   return *this;
 }
@@ -394,6 +439,9 @@ Gmres<VarsType, Preconditioner, LinearSolverRegistrars>::solve(
   auto& solution = *initial_guess_in_solution_out;
   Convergence::HasConverged has_converged{};
   size_t iteration = 0;
+  // Keep the initial guess to recycle the correction of this solve
+  const std::optional<VarsType> initial_guess_for_recycling =
+      recycled_vectors_ > 0 ? std::make_optional(solution) : std::nullopt;
 
   while (not has_converged) {
     const auto& initial_guess = *initial_guess_in_solution_out;
@@ -412,11 +460,23 @@ Gmres<VarsType, Preconditioner, LinearSolverRegistrars>::solve(
       initial_operand *= -1.;
       initial_operand += source;
     }
-    const double initial_residual_magnitude =
-        sqrt(magnitude_square(initial_operand));
+    double initial_residual_magnitude = sqrt(magnitude_square(initial_operand));
+    const double reference_residual_magnitude = initial_residual_magnitude;
+    // Project the recycled subspace out of the initial residual. The recycled
+    // operator applications are orthonormal, so this minimizes the residual
+    // over the recycled subspace.
+    if (iteration == 0 and not recycled_solutions_.empty()) {
+      for (size_t j = 0; j < recycled_solutions_.size(); ++j) {
+        const auto projection =
+            inner_product(recycled_operator_applied_[j], initial_operand);
+        solution += projection * recycled_solutions_[j];
+        initial_operand -= projection * recycled_operator_applied_[j];
+      }
+      initial_residual_magnitude = sqrt(magnitude_square(initial_operand));
+    }
     has_converged = Convergence::HasConverged{convergence_criteria_, iteration,
                                               initial_residual_magnitude,
-                                              initial_residual_magnitude};
+                                              reference_residual_magnitude};
     if constexpr (use_iteration_callback) {
       iteration_callback(has_converged);
     }
@@ -459,7 +519,7 @@ Gmres<VarsType, Preconditioner, LinearSolverRegistrars>::solve(
       ++iteration;
       has_converged = Convergence::HasConverged{
           convergence_criteria_, iteration, abs(residual_history_[k + 1]),
-          initial_residual_magnitude};
+          reference_residual_magnitude};
       if constexpr (use_iteration_callback) {
         iteration_callback(has_converged);
       }
@@ -480,6 +540,39 @@ Gmres<VarsType, Preconditioner, LinearSolverRegistrars>::solve(
                                       i);
     }
   }
+  // Add the correction of this solve to the recycled subspace, orthonormalizing
+  // the operator applied to it against the previously recycled ones
+  if (initial_guess_for_recycling.has_value() and iteration > 0) {
+    VarsType correction = solution;
+    correction -= *initial_guess_for_recycling;
+    VarsType operator_applied_to_correction{};
+    std::apply(linear_operator,
+               std::tuple_cat(
+                   std::forward_as_tuple(
+                       make_not_null(&operator_applied_to_correction),
+                       correction),
+                   operator_args));
+    for (size_t j = 0; j < recycled_solutions_.size(); ++j) {
+      const auto projection = inner_product(recycled_operator_applied_[j],
+                                            operator_applied_to_correction);
+      correction -= projection * recycled_solutions_[j];
+      operator_applied_to_correction -=
+          projection * recycled_operator_applied_[j];
+    }
+    const double normalization =
+        sqrt(magnitude_square(operator_applied_to_correction));
+    if (normalization > 0.) {
+      correction /= normalization;
+      operator_applied_to_correction /= normalization;
+      if (recycled_solutions_.size() == recycled_vectors_) {
+        recycled_solutions_.erase(recycled_solutions_.begin());
+        recycled_operator_applied_.erase(recycled_operator_applied_.begin());
+      }
+      recycled_solutions_.push_back(std::move(correction));
+      recycled_operator_applied_.push_back(
+          std::move(operator_applied_to_correction));
+    }
+  }
   return has_converged;
 }
 
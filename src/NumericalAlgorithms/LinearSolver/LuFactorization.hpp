@@ -0,0 +1,184 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "DataStructures/DynamicMatrix.hpp"
+#include "DataStructures/DynamicVector.hpp"
+#include "NumericalAlgorithms/Convergence/HasConverged.hpp"
+#include "NumericalAlgorithms/LinearSolver/BuildMatrix.hpp"
+#include "NumericalAlgorithms/LinearSolver/LinearSolver.hpp"
+#include "Options/String.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace LinearSolver::Serial {
+
+/// \cond
+template <typename ValueType, typename LinearSolverRegistrars>
+struct LuFactorization;
+/// \endcond
+
+namespace Registrars {
+/// Registers the `LinearSolver::Serial::LuFactorization` linear solver
+template <typename ValueType>
+struct LuFactorization {
+  template <typename LinearSolverRegistrars>
+  using f = Serial::LuFactorization<ValueType, LinearSolverRegistrars>;
+};
+}  // namespace Registrars
+
+/*!
+ * \brief Linear solver that builds a matrix representation of the linear
+ * operator and stores its LU factorization
+ *
+ * This solver constructs an explicit matrix representation of the operator in
+ * the same way as `LinearSolver::Serial::ExplicitInverse` and then factorizes
+ * it with partial pivoting. Successive solves of the same operator are a pair
+ * of triangular solves with the stored factors, so they converge immediately.
+ * Compared to `LinearSolver::Serial::ExplicitInverse` the factorization is
+ * about three times cheaper to compute than the inverse, and applying it has
+ * the same cost as applying the inverse. This makes it the better choice when
+ * the solver is `reset()` frequently, e.g. once per nonlinear-solver iteration
+ * when used as Schwarz subdomain solver (see
+ * `LinearSolver::Schwarz::Actions::ResetSubdomainSolver`). The memory
+ * requirements are the same as for `LinearSolver::Serial::ExplicitInverse`.
+ */
+template <typename ValueType,
+          typename LinearSolverRegistrars =
+              tmpl::list<Registrars::LuFactorization<ValueType>>>
+class LuFactorization : public LinearSolver<LinearSolverRegistrars> {
+ private:
+  using Base = LinearSolver<LinearSolverRegistrars>;
+
+ public:
+  using options = tmpl::list<>;
+  static constexpr Options::String help =
+      "Build a matrix representation of the linear operator and store its LU "
+      "factorization. This means that the first solve has a large "
+      "initialization cost, but all subsequent solves converge immediately.";
+
+  LuFactorization() = default;
+  LuFactorization(const LuFactorization& /*rhs*/) = default;
+  LuFactorization& operator=(const LuFactorization& /*rhs*/) = default;
+  LuFactorization(LuFactorization&& /*rhs*/) = default;
+  LuFactorization& operator=(LuFactorization&& /*rhs*/) = default;
+  ~LuFactorization() = default;
+
+  /// \cond
+  explicit LuFactorization(CkMigrateMessage* m) : Base(m) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(LuFactorization);  // NOLINT
+  /// \endcond
+
+  /*!
+   * \brief Solve the equation \f$Ax=b\f$ by explicitly constructing the
+   * operator matrix \f$A\f$ and its LU factorization. The first solve is
+   * computationally expensive and successive solves are cheap.
+   *
+   * The `SourceType` must support the same operations as for
+   * `LinearSolver::Serial::ExplicitInverse::solve`.
+   */
+  template <typename LinearOperator, typename VarsType, typename SourceType,
+            typename... OperatorArgs>
+  Convergence::HasConverged solve(
+      gsl::not_null<VarsType*> solution, const LinearOperator& linear_operator,
+      const SourceType& source,
+      const std::tuple<OperatorArgs...>& operator_args = std::tuple{}) const;
+
+  /// Flags the operator to require re-initialization. No memory is released.
+  /// Call this function to rebuild the solver when the operator changed.
+  void reset() override { size_ = std::numeric_limits<size_t>::max(); }
+
+  /// Size of the operator. The stored matrix will have `size^2` entries.
+  size_t size() const { return size_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    p | size_;
+    p | lu_factors_;
+    p | pivots_;
+    if (p.isUnpacking() and size_ != std::numeric_limits<size_t>::max()) {
+      workspace_.resize(size_);
+    }
+  }
+
+  std::unique_ptr<Base> get_clone() const override {
+    return std::make_unique<LuFactorization>(*this);
+  }
+
+ private:
+  // Caches for successive solves of the same operator
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t size_ = std::numeric_limits<size_t>::max();
+  // Both triangular factors are stored in one dense matrix, as returned by
+  // LAPACK. Blaze doesn't support the factorization of sparse matrices.
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicMatrix<ValueType, blaze::columnMajor> lu_factors_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::vector<blaze::blas_int_t> pivots_{};
+
+  // Buffer to avoid re-allocating memory for the triangular solves
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicVector<ValueType> workspace_{};
+};
+
+template <typename ValueType, typename LinearSolverRegistrars>
+template <typename LinearOperator, typename VarsType, typename SourceType,
+          typename... OperatorArgs>
+Convergence::HasConverged
+LuFactorization<ValueType, LinearSolverRegistrars>::solve(
+    const gsl::not_null<VarsType*> solution,
+    const LinearOperator& linear_operator, const SourceType& source,
+    const std::tuple<OperatorArgs...>& operator_args) const {
+  if (UNLIKELY(size_ == std::numeric_limits<size_t>::max())) {
+    const auto& used_for_size = source;
+    const size_t size = used_for_size.size();
+    workspace_.resize(size);
+    lu_factors_.resize(size, size);
+    pivots_.resize(size);
+    // Construct explicit matrix representation by "sniffing out" the operator,
+    // i.e. feeding it unit vectors
+    auto operand_buffer = make_with_value<VarsType>(used_for_size, 0.);
+    auto result_buffer = make_with_value<SourceType>(used_for_size, 0.);
+    build_matrix(make_not_null(&lu_factors_), make_not_null(&operand_buffer),
+                 make_not_null(&result_buffer), linear_operator, operator_args);
+    blaze::getrf(lu_factors_, pivots_.data());
+    for (size_t i = 0; i < size; ++i) {
+      if (UNLIKELY(lu_factors_(i, i) == ValueType{0.})) {
+        ERROR("Could not factorize subdomain matrix (size "
+              << size << "): it is singular.");
+      }
+    }
+    // Only mark the factorization as valid once it succeeded
+    size_ = size;
+  }
+  std::copy(source.begin(), source.end(), workspace_.begin());
+  // Apply the inverse with forward and backward substitution
+  blaze::getrs(lu_factors_, workspace_, 'N', pivots_.data());
+  std::copy(workspace_.begin(), workspace_.end(), solution->begin());
+  return {0, 0};
+}
+
+/// \cond
+// NOLINTBEGIN
+template <typename ValueType, typename LinearSolverRegistrars>
+PUP::able::PUP_ID
+    LuFactorization<ValueType, LinearSolverRegistrars>::my_PUP_ID = 0;
+// NOLINTEND
+/// \endcond
+
+}  // namespace LinearSolver::Serial
@@ -5,9 +5,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <mutex>
 #include <ostream>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
@@ -24,6 +27,7 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
+#include "Utilities/PrettyType.hpp"
 #include "Utilities/StaticCache.hpp"
 
 namespace Spectral {
@@ -35,6 +39,32 @@ namespace {
 
 // Caching mechanism
 
+std::mutex cached_quantities_mutex{};
+std::vector<CachedQuantity> cached_quantities_list{};
+
+void record_cached_quantity(std::string name, const Basis basis,
+                            const Quadrature quadrature,
+                            const size_t num_points) {
+  const std::lock_guard lock(cached_quantities_mutex);
+  cached_quantities_list.push_back(
+      CachedQuantity{std::move(name), basis, quadrature, num_points});
+}
+
+// Generates the quantity and records that it was generated. Since the
+// StaticCache generates each entry only once this records each entry once.
+template <Basis BasisType, Quadrature QuadratureType, typename Generator>
+struct RecordingGenerator {
+  auto operator()(const size_t num_points) const {
+    std::string name = pretty_type::short_name<Generator>();
+    if (name.ends_with("Generator")) {
+      name.resize(name.size() - std::string{"Generator"}.size());
+    }
+    record_cached_quantity(std::move(name), BasisType, QuadratureType,
+                           num_points);
+    return Generator{}(num_points);
+  }
+};
+
 template <Basis BasisType, Quadrature QuadratureType,
           typename SpectralQuantityGenerator>
 const auto& precomputed_spectral_quantity(const size_t num_points) {
@@ -47,13 +77,14 @@ const auto& precomputed_spectral_quantity(const size_t num_points) {
          "points for this quadrature.");
   ASSERT(num_points <= max_num_points,
          "Exceeded maximum number of collocation points.");
-  // We compute the quantity for all possible `num_point`s the first time this
-  // function is called and keep the data around for the lifetime of the
-  // program. The computation is handled by the call operator of the
-  // `SpectralQuantityType` instance.
+  // We compute the quantity for each `num_points` the first time it is
+  // requested and keep the data around for the lifetime of the program. The
+  // computation is handled by the call operator of the
+  // `SpectralQuantityGenerator` instance.
   static const auto precomputed_data =
       make_static_cache<CacheRange<min_num_points, max_num_points + 1>>(
-          SpectralQuantityGenerator{});
+          RecordingGenerator<BasisType, QuadratureType,
+                             SpectralQuantityGenerator>{});
   return precomputed_data(num_points);
 }
 
@@ -685,6 +716,8 @@ const std::pair<Matrix, Matrix>& boundary_interpolation_matrices(
       CacheRange<Spectral::minimum_number_of_points<BasisType, QuadratureType>,
                  Spectral::maximum_number_of_points<BasisType> + 1>>(
       [](const size_t local_num_points) {
+        record_cached_quantity("BoundaryInterpolationMatrices", BasisType,
+                               QuadratureType, local_num_points);
         return std::pair<Matrix, Matrix>{
             interpolation_matrix<BasisType, QuadratureType>(local_num_points,
                                                             -1.0),
@@ -719,6 +752,8 @@ const std::pair<DataVector, DataVector>& boundary_interpolation_term(
       CacheRange<Spectral::minimum_number_of_points<BasisType, QuadratureType>,
                  Spectral::maximum_number_of_points<BasisType> + 1>>(
       [](const size_t local_num_points) {
+        record_cached_quantity("BoundaryInterpolationTerm", BasisType,
+                               QuadratureType, local_num_points);
         const Matrix interp_matrix =
             interpolation_matrix<BasisType, Quadrature::GaussLobatto>(
                 local_num_points == 1 ? 2 : local_num_points,
@@ -762,6 +797,8 @@ const std::pair<DataVector, DataVector>& boundary_lifting_term(
       CacheRange<Spectral::minimum_number_of_points<BasisType, QuadratureType>,
                  Spectral::maximum_number_of_points<BasisType> + 1>>(
       [](const size_t local_num_points) {
+        record_cached_quantity("BoundaryLiftingTerm", BasisType,
+                               QuadratureType, local_num_points);
         const auto& matrices =
             boundary_interpolation_matrices<BasisType, QuadratureType>(
                 local_num_points);
@@ -879,6 +916,16 @@ SPECTRAL_QUANTITY_FOR_MESH(linear_filter_matrix, Matrix)
 
 #undef SPECTRAL_QUANTITY_FOR_MESH
 
+std::ostream& operator<<(std::ostream& os, const CachedQuantity& quantity) {
+  return os << quantity.name << "(" << quantity.basis << ", "
+            << quantity.quadrature << ", " << quantity.number_of_points << ")";
+}
+
+std::vector<CachedQuantity> cached_quantities() {
+  const std::lock_guard lock(cached_quantities_mutex);
+  return cached_quantities_list;
+}
+
 template <typename T>
 Matrix interpolation_matrix(const Mesh<1>& mesh, const T& target_points) {
   return get_spectral_quantity_for_mesh(
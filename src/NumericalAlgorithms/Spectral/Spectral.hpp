@@ -12,7 +12,9 @@
 #include <cstddef>
 #include <iosfwd>
 #include <limits>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
@@ -562,4 +564,30 @@ const Matrix& linear_filter_matrix(size_t num_points);
  */
 const Matrix& linear_filter_matrix(const Mesh<1>& mesh);
 
+/// A spectral quantity that has been computed and cached
+struct CachedQuantity {
+  /// Name of the quantity, e.g. `DifferentiationMatrix`
+  std::string name;
+  Basis basis;
+  Quadrature quadrature;
+  size_t number_of_points;
+
+  bool operator==(const CachedQuantity& rhs) const = default;
+};
+
+std::ostream& operator<<(std::ostream& os, const CachedQuantity& quantity);
+
+/*!
+ * \brief The spectral quantities that have been computed so far, in the order
+ * in which they were computed.
+ *
+ * \details Each quantity is computed the first time it is retrieved for a
+ * particular basis, quadrature and number of points, and then kept for the
+ * lifetime of the program. Threads that retrieve a quantity while it is being
+ * computed wait for the computation to finish. Only the combinations that were
+ * retrieved use memory, which this report makes visible. This function is
+ * threadsafe.
+ */
+std::vector<CachedQuantity> cached_quantities();
+
 }  // namespace Spectral
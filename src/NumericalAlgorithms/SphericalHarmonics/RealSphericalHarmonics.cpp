@@ -4,9 +4,11 @@
 #include "NumericalAlgorithms/SphericalHarmonics/RealSphericalHarmonics.hpp"
 
 #include <boost/math/special_functions/spherical_harmonic.hpp>
+#include <cmath>
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -41,4 +43,72 @@ DataVector real_spherical_harmonic(const DataVector& theta,
   real_spherical_harmonic(make_not_null(&result), theta, phi, l, m);
   return result;
 }
+
+void real_spherical_harmonics(
+    const gsl::not_null<DataVector*> spherical_harmonics,
+    const DataVector& theta, const DataVector& phi, const size_t l_max) {
+  ASSERT(theta.size() == phi.size(),
+         "theta and phi must have the same size, but have sizes "
+             << theta.size() << " and " << phi.size());
+  const size_t num_points = theta.size();
+  const size_t num_modes = square(l_max + 1);
+  spherical_harmonics->destructive_resize(num_modes * num_points);
+  const auto mode = [&spherical_harmonics, &num_points](const size_t l,
+                                                        const int m) {
+    const auto mode_index =
+        static_cast<size_t>(static_cast<int>(square(l) + l) + m);
+    return DataVector(spherical_harmonics->data() + mode_index * num_points,
+                      num_points);
+  };
+  const DataVector cos_theta = cos(theta);
+  const DataVector sin_theta = sin(theta);
+  // Normalized associated Legendre functions without the Condon-Shortley
+  // phase, starting at l = m = 0
+  DataVector p_mm(num_points, 0.5 / sqrt(M_PI));
+  for (size_t m = 0; m <= l_max; ++m) {
+    if (m > 0) {
+      p_mm *= sqrt((2. * static_cast<double>(m) + 1.) /
+                   (2. * static_cast<double>(m))) *
+              sin_theta;
+    }
+    // First fill the m >= 0 slots with the associated Legendre functions
+    mode(m, static_cast<int>(m)) = p_mm;
+    if (m + 1 <= l_max) {
+      mode(m + 1, static_cast<int>(m)) =
+          sqrt(2. * static_cast<double>(m) + 3.) * cos_theta * p_mm;
+    }
+    for (size_t l = m + 2; l <= l_max; ++l) {
+      const auto l_d = static_cast<double>(l);
+      const auto m_d = static_cast<double>(m);
+      const double a =
+          sqrt((4. * square(l_d) - 1.) / (square(l_d) - square(m_d)));
+      const double b = sqrt((square(l_d - 1.) - square(m_d)) /
+                            (4. * square(l_d - 1.) - 1.));
+      mode(l, static_cast<int>(m)) =
+          a * (cos_theta * mode(l - 1, static_cast<int>(m)) -
+               b * mode(l - 2, static_cast<int>(m)));
+    }
+    // Then multiply with the azimuthal dependence
+    if (m > 0) {
+      const DataVector cos_m_phi =
+          M_SQRT2 * cos(static_cast<double>(m) * phi);
+      const DataVector sin_m_phi =
+          M_SQRT2 * sin(static_cast<double>(m) * phi);
+      for (size_t l = m; l <= l_max; ++l) {
+        auto negative_m = mode(l, -static_cast<int>(m));
+        auto positive_m = mode(l, static_cast<int>(m));
+        negative_m = positive_m * sin_m_phi;
+        positive_m *= cos_m_phi;
+      }
+    }
+  }
+}
+
+DataVector real_spherical_harmonics(const DataVector& theta,
+                                    const DataVector& phi,
+                                    const size_t l_max) {
+  DataVector result{};
+  real_spherical_harmonics(make_not_null(&result), theta, phi, l_max);
+  return result;
+}
 }  // namespace ylm
@@ -40,4 +40,32 @@ void real_spherical_harmonic(gsl::not_null<DataVector*> spherical_harmonic,
 DataVector real_spherical_harmonic(const DataVector& theta,
                                    const DataVector& phi, size_t l, int m);
 /// @}
+
+/// @{
+/*!
+ * \ingroup SpectralGroup
+ *
+ * \brief Evaluates all real spherical harmonics up to order `l_max` at the
+ * requested angles \f$\theta\f$ and \f$\phi\f$.
+ *
+ * The real spherical harmonics are defined as in
+ * `ylm::real_spherical_harmonic`. The result is mode-major: the values of
+ * \f$Y_{lm}\f$ at all points are stored contiguously, starting at index
+ * \f$(l^2 + l + m) N\f$ where \f$N\f$ is the number of points. So the modes
+ * are ordered by \f$l\f$ first and then by \f$m\f$ from \f$-l\f$ to \f$l\f$.
+ * The buffer has size \f$(l_\mathrm{max} + 1)^2 N\f$.
+ *
+ * All modes are computed in a single pass with the standard recurrence
+ * relations for the normalized associated Legendre functions, which is
+ * considerably faster and more stable than evaluating each mode separately
+ * with `ylm::real_spherical_harmonic`. The recurrences operate on all points
+ * at once.
+ */
+void real_spherical_harmonics(gsl::not_null<DataVector*> spherical_harmonics,
+                              const DataVector& theta, const DataVector& phi,
+                              size_t l_max);
+
+DataVector real_spherical_harmonics(const DataVector& theta,
+                                    const DataVector& phi, size_t l_max);
+/// @}
 }  // namespace ylm
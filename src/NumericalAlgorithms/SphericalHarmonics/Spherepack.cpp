@@ -5,8 +5,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <tuple>
+#include <utility>
 
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/TempBuffer.hpp"
@@ -62,13 +66,25 @@ namespace ylm {
 thread_local Spherepack_detail::MemoryPool Spherepack::memory_pool_ =
     Spherepack_detail::MemoryPool();
 
+namespace {
+// The work arrays only depend on l_max and m_max, so we fill them once per
+// process and share them between all instances with the same l_max and m_max.
+// This makes constructing and copying a Spherepack cheap, e.g. when an
+// apparent horizon finder creates new Strahlkorpers in every iteration. The
+// cache is never cleared, but only a handful of resolutions are typically in
+// use.
+std::mutex storage_cache_mutex{};
+std::map<std::pair<size_t, size_t>,
+         std::shared_ptr<Spherepack_detail::ConstStorage>>
+    storage_cache{};
+}  // namespace
+
 Spherepack::Spherepack(const size_t l_max, const size_t m_max)
     : l_max_{l_max},
       m_max_{m_max},
       n_theta_{l_max_ + 1},
       n_phi_{2 * m_max_ + 1},
-      spectral_size_{2 * (l_max_ + 1) * (m_max_ + 1)},
-      storage_(l_max_, m_max_) {
+      spectral_size_{2 * (l_max_ + 1) * (m_max_ + 1)} {
   if (l_max_ < 2) {
     ERROR("Must use l_max>=2, not l_max=" << l_max_);
   }
@@ -79,10 +95,25 @@ Spherepack::Spherepack(const size_t l_max, const size_t m_max)
     ERROR("Must use m_max<=l_max, not l_max=" << l_max_
                                               << ", m_max=" << m_max_);
   }
+  {
+    const std::lock_guard lock(storage_cache_mutex);
+    const auto cached_storage = storage_cache.find(std::pair{l_max_, m_max_});
+    if (cached_storage != storage_cache.end()) {
+      storage_ = cached_storage->second;
+      return;
+    }
+  }
+  storage_ =
+      std::make_shared<Spherepack_detail::ConstStorage>(l_max_, m_max_);
   calculate_collocation_points();
   fill_scalar_work_arrays();
   fill_vector_work_arrays();
   calculate_interpolation_data();
+  const std::lock_guard lock(storage_cache_mutex);
+  // Another thread may have filled the storage for the same l_max and m_max in
+  // the meantime, in which case we use that one
+  storage_ = storage_cache.try_emplace(std::pair{l_max_, m_max_}, storage_)
+                 .first->second;
 }
 
 void Spherepack::phys_to_spec_impl(
@@ -106,7 +137,7 @@ void Spherepack::phys_to_spec_impl(
       loop_over_offset ? -1 : int(physical_offset);
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
-  const auto& work_phys_to_spec = storage_.work_phys_to_spec;
+  const auto& work_phys_to_spec = storage_->work_phys_to_spec;
   shags_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
          effective_physical_offset, effective_spectral_offset,
          static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -145,7 +176,7 @@ void Spherepack::spec_to_phys_impl(
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
 
-  const auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+  const auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
   shsgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
          effective_physical_offset, effective_spectral_offset,
          static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -257,7 +288,7 @@ void Spherepack::gradient_from_coefs_impl(
       loop_over_offset ? -1 : int(physical_offset);
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
-  const auto& work_vector_spec_to_phys = storage_.work_vector_spec_to_phys;
+  const auto& work_vector_spec_to_phys = storage_->work_vector_spec_to_phys;
   gradgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
           effective_physical_offset, effective_spectral_offset,
           static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1, df[0],
@@ -348,7 +379,7 @@ void Spherepack::scalar_laplacian_from_coefs(
   const size_t work_size = n_theta_ * (3 * n_phi_ + 2 * l1 + 1);
   auto& work = memory_pool_.get(work_size);
   int err = 0;
-  const auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+  const auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
   slapgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
           static_cast<int>(physical_offset), static_cast<int>(spectral_offset),
           static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -405,12 +436,12 @@ void Spherepack::second_derivative(
     const std::array<double*, 2>& df, const gsl::not_null<SecondDeriv*> ddf,
     const gsl::not_null<const double*> collocation_values,
     const size_t physical_stride, const size_t physical_offset) const {
-  const auto& cos_theta = storage_.cos_theta;
-  const auto& sin_theta = storage_.sin_theta;
-  const auto& sin_phi = storage_.sin_phi;
-  const auto& cos_phi = storage_.cos_phi;
-  const auto& cot_theta = storage_.cot_theta;
-  const auto& cosec_theta = storage_.cosec_theta;
+  const auto& cos_theta = storage_->cos_theta;
+  const auto& sin_theta = storage_->sin_theta;
+  const auto& sin_phi = storage_->sin_phi;
+  const auto& cos_phi = storage_->cos_phi;
+  const auto& cot_theta = storage_->cot_theta;
+  const auto& cosec_theta = storage_->cosec_theta;
 
   // Get first derivatives
   gradient(df, collocation_values, physical_stride, physical_offset);
@@ -550,7 +581,7 @@ Spherepack::InterpolationInfo<T>::InterpolationInfo(
 template <typename T>
 Spherepack::InterpolationInfo<T> Spherepack::set_up_interpolation_info(
     const std::array<T, 2>& target_points) const {
-  return InterpolationInfo(l_max_, m_max_, storage_.work_interp_pmm,
+  return InterpolationInfo(l_max_, m_max_, storage_->work_interp_pmm,
                            target_points);
 }
 
@@ -585,9 +616,9 @@ void Spherepack::interpolate_from_coefs(
           << interpolation_info.l_max() << ") and Spherepack instance ("
           << l_max_ << ")");
   };
-  const auto& alpha = storage_.work_interp_alpha;
-  const auto& beta = storage_.work_interp_beta;
-  const auto& index = storage_.work_interp_index;
+  const auto& alpha = storage_->work_interp_alpha;
+  const auto& beta = storage_->work_interp_beta;
+  const auto& index = storage_->work_interp_index;
   // alpha holds alpha(n,m,x)/x, beta holds beta(n+1,m).
   // index holds the index into the coefficient array.
   // All are indexed together.
@@ -695,7 +726,7 @@ T Spherepack::interpolate_from_coefs(
 
 void Spherepack::calculate_collocation_points() {
   // Theta
-  auto& theta = storage_.theta;
+  auto& theta = storage_->theta;
   DataVector temp(2 * n_theta_ + 1);
   auto work = gsl::make_span(temp.data(), n_theta_);
   auto unused_weights = gsl::make_span(temp.data() + n_theta_, n_theta_ + 1);
@@ -708,17 +739,17 @@ void Spherepack::calculate_collocation_points() {
   }
 
   // Phi
-  auto& phi = storage_.phi;
+  auto& phi = storage_->phi;
   const double two_pi_over_n_phi = 2.0 * M_PI / n_phi_;
   for (size_t i = 0; i < n_phi_; ++i) {
     phi[i] = two_pi_over_n_phi * i;
   }
 
   // Other trig functions at collocation points
-  auto& cos_theta = storage_.cos_theta;
-  auto& sin_theta = storage_.sin_theta;
-  auto& cot_theta = storage_.cot_theta;
-  auto& cosec_theta = storage_.cosec_theta;
+  auto& cos_theta = storage_->cos_theta;
+  auto& sin_theta = storage_->sin_theta;
+  auto& cot_theta = storage_->cot_theta;
+  auto& cosec_theta = storage_->cosec_theta;
   for (size_t i = 0; i < n_theta_; ++i) {
     cos_theta[i] = cos(theta[i]);
     sin_theta[i] = sin(theta[i]);
@@ -726,8 +757,8 @@ void Spherepack::calculate_collocation_points() {
     cot_theta[i] = cos_theta[i] * cosec_theta[i];
   }
 
-  auto& sin_phi = storage_.sin_phi;
-  auto& cos_phi = storage_.cos_phi;
+  auto& sin_phi = storage_->sin_phi;
+  auto& cos_phi = storage_->cos_phi;
   for (size_t i = 0; i < n_phi_; ++i) {
     cos_phi[i] = cos(phi[i]);
     sin_phi[i] = sin(phi[i]);
@@ -772,10 +803,10 @@ void Spherepack::calculate_interpolation_data() {
   // and  Pbar(m+1)(m) is (2m+1)!! x(1-x^2)^(n/2)sqrt((2m+3)/(2(2m+1)!))
   //  Ratio Pbar(m+1)(m)/Pbar(m)(m)   = x sqrt(2m+3)
   //  Ratio Pbar(m+1)(m+1)/Pbar(m)(m) = sqrt(1-x^2) sqrt((2m+3)/(2m+2))
-  auto& alpha = storage_.work_interp_alpha;
-  auto& beta = storage_.work_interp_beta;
-  auto& pmm = storage_.work_interp_pmm;
-  auto& index = storage_.work_interp_index;
+  auto& alpha = storage_->work_interp_alpha;
+  auto& beta = storage_->work_interp_beta;
+  auto& pmm = storage_->work_interp_pmm;
+  auto& index = storage_->work_interp_index;
 
   const size_t l1 = m_max_ + 1;
 
@@ -830,7 +861,7 @@ void Spherepack::calculate_interpolation_data() {
 void Spherepack::fill_vector_work_arrays() {
   DataVector work((3 * n_theta_ * (n_theta_ + 3) + 2) / 2);
 
-  auto& work_vector_spec_to_phys = storage_.work_vector_spec_to_phys;
+  auto& work_vector_spec_to_phys = storage_->work_vector_spec_to_phys;
   int err = 0;
   vhsgsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
           work_vector_spec_to_phys.data(),
@@ -854,7 +885,7 @@ void Spherepack::fill_scalar_work_arrays() {
     if (UNLIKELY(err != 0)) {
       ERROR("gaqd error " << err << " in Spherepack");
     }
-    auto& quadrature_weights = storage_.quadrature_weights;
+    auto& quadrature_weights = storage_->quadrature_weights;
     for (size_t i = 0; i < n_theta_; ++i) {
       for (size_t j = 0; j < n_phi_; ++j) {
         quadrature_weights[i + j * n_theta_] = (2 * M_PI / n_phi_) * weights[i];
@@ -869,7 +900,7 @@ void Spherepack::fill_scalar_work_arrays() {
     DataVector temp(work0_size + work1_size);
     auto work0 = gsl::make_span(temp.data(), work0_size);
     auto work1 = gsl::make_span(temp.data() + work0_size, work1_size);
-    auto& work_phys_to_spec = storage_.work_phys_to_spec;
+    auto& work_phys_to_spec = storage_->work_phys_to_spec;
     int err = 0;
     shagsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
             work_phys_to_spec.data(),
@@ -879,7 +910,7 @@ void Spherepack::fill_scalar_work_arrays() {
     if (UNLIKELY(err != 0)) {
       ERROR("shagsi error " << err << " in Spherepack");
     }
-    auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+    auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
     shsgsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
             work_scalar_spec_to_phys.data(),
             static_cast<int>(work_scalar_spec_to_phys.size()), work0.data(),
@@ -330,20 +330,41 @@ const ClenshawRecurrenceConstants<Spin>& cached_clenshaw_factors(
 }  // namespace
 
 SwshInterpolator::SwshInterpolator(const DataVector& theta,
-                                   const DataVector& phi, const size_t l_max)
-    : l_max_{l_max},
-      raw_libsharp_coefficient_buffer_{
-          size_of_libsharp_coefficient_vector(l_max)},
-      raw_goldberg_coefficient_buffer_{square(l_max + 1)} {
-  cos_m_phi_ = std::vector<DataVector>(l_max + 1);
-  sin_m_phi_ = std::vector<DataVector>(l_max + 1);
+                                   const DataVector& phi, const size_t l_max) {
+  update_target_points(theta, phi, l_max);
+}
+
+bool SwshInterpolator::update_target_points(const DataVector& theta,
+                                            const DataVector& phi,
+                                            const size_t l_max,
+                                            const double tolerance) {
+  ASSERT(theta.size() == phi.size(),
+         "The target theta and phi must have the same size, but have sizes "
+             << theta.size() << " and " << phi.size());
+  if (l_max == l_max_ and theta.size() == theta_.size() and
+      not theta.empty() and max(abs(theta - theta_)) <= tolerance and
+      max(abs(phi - phi_)) <= tolerance) {
+    return false;
+  }
+  if (l_max != l_max_ or cos_m_phi_.size() != l_max + 1) {
+    l_max_ = l_max;
+    raw_libsharp_coefficient_buffer_.destructive_resize(
+        size_of_libsharp_coefficient_vector(l_max));
+    raw_goldberg_coefficient_buffer_.destructive_resize(square(l_max + 1));
+    cos_m_phi_.resize(l_max + 1);
+    sin_m_phi_.resize(l_max + 1);
+  }
+  theta_ = theta;
+  phi_ = phi;
   cos_theta_ = cos(theta);
   sin_theta_ = sin(theta);
   cos_theta_over_two_ = cos(0.5 * theta);
   sin_theta_over_two_ = sin(0.5 * theta);
   // evaluate cos(m phi) and sin(m phi) via recurrence
-  cos_m_phi_[0] = DataVector{phi.size(), 1.0};
-  sin_m_phi_[0] = DataVector{phi.size(), 0.0};
+  cos_m_phi_[0].destructive_resize(phi.size());
+  cos_m_phi_[0] = 1.0;
+  sin_m_phi_[0].destructive_resize(phi.size());
+  sin_m_phi_[0] = 0.0;
   const DataVector m_phi_beta = sin(phi);
   const DataVector m_phi_alpha = 2.0 * square(sin(0.5 * phi));
   for (size_t m = 1; m <= l_max; ++m) {
@@ -352,6 +373,7 @@ SwshInterpolator::SwshInterpolator(const DataVector& theta,
     sin_m_phi_[m] = sin_m_phi_[m - 1] - (m_phi_alpha * sin_m_phi_[m - 1] -
                                          m_phi_beta * cos_m_phi_[m - 1]);
   }
+  return true;
 }
 
 template <int Spin>
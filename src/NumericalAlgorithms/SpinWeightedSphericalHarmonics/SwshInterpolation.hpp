@@ -244,6 +244,21 @@ class SwshInterpolator {
   SwshInterpolator(const DataVector& theta, const DataVector& phi,
                    size_t l_max);
 
+  /*!
+   * \brief Move the target points to `theta` and `phi`, reusing the
+   * allocations of the current target points.
+   *
+   * \details The angular functions of the target points are only recomputed if
+   * `l_max` or the number of points changed, or if any target coordinate moved
+   * by more than `tolerance`. Returns whether they were recomputed. With the
+   * default `tolerance` of zero an update is only skipped if the target points
+   * are unchanged, so the interpolation is identical to that of a newly
+   * constructed `SwshInterpolator`. The target coordinates are not serialized,
+   * so the first update after deserialization always recomputes.
+   */
+  bool update_target_points(const DataVector& theta, const DataVector& phi,
+                            size_t l_max, double tolerance = 0.0);
+
   /*!
    * \brief Perform the Clenshaw recurrence sum, returning by pointer
    * `interpolated` of interpolating the `goldberg_modes` at the collocation
@@ -360,6 +375,8 @@ class SwshInterpolator {
 
  private:
   size_t l_max_ = 0;
+  DataVector theta_;
+  DataVector phi_;
   DataVector cos_theta_;
   DataVector sin_theta_;
   DataVector cos_theta_over_two_;
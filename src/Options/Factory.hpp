@@ -11,6 +11,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <yaml-cpp/yaml.h>
 
@@ -88,6 +89,42 @@ template <typename T>
 struct is_factory_creatable
     : std::bool_constant<get_factory_creatable_or_default_v<T, true>> {};
 
+template <typename BaseClass, typename Metavariables, typename Derived>
+std::unique_ptr<BaseClass> create_derived(const Option& options) {
+  return std::make_unique<Derived>(options.parse_as<Derived, Metavariables>());
+}
+
+template <typename BaseClass>
+struct Creator {
+  std::unique_ptr<BaseClass> (*create)(const Option&) = nullptr;
+  // Whether several creatable classes have the same name
+  bool duplicate = false;
+};
+
+// The creators of all classes in the factory by name. Computing the names
+// means demangling type names, so this is done once for each factory rather
+// than for every created object.
+template <typename BaseClass, typename Metavariables,
+          typename CreatableClasses>
+const std::unordered_map<std::string, Creator<BaseClass>>& creators() {
+  static const auto result = []() {
+    std::unordered_map<std::string, Creator<BaseClass>> table{};
+    table.reserve(tmpl::size<CreatableClasses>::value);
+    tmpl::for_each<CreatableClasses>([&table](auto derived_v) {
+      using Derived = tmpl::type_from<decltype(derived_v)>;
+      auto [entry, inserted] = table.insert_or_assign(
+          pretty_type::name<Derived>(),
+          Creator<BaseClass>{&create_derived<BaseClass, Metavariables, Derived>,
+                             false});
+      if (not inserted) {
+        entry->second.duplicate = true;
+      }
+    });
+    return table;
+  }();
+  return result;
+}
+
 template <typename BaseClass, typename Metavariables>
 std::unique_ptr<BaseClass> create(const Option& options) {
   using all_creatable_classes =
@@ -123,18 +160,12 @@ std::unique_ptr<BaseClass> create(const Option& options) {
                 << node);
   }
 
-  std::unique_ptr<BaseClass> result;
-  tmpl::for_each<creatable_classes>(
-      [&id, &derived_opts, &result](auto derived_v) {
-        using Derived = tmpl::type_from<decltype(derived_v)>;
-        if (pretty_type::name<Derived>() == id) {
-          ASSERT(result == nullptr, "Duplicate factory id: " << id);
-          result = std::make_unique<Derived>(
-              derived_opts.parse_as<Derived, Metavariables>());
-        }
-      });
-  if (result != nullptr) {
-    return result;
+  const auto& all_creators =
+      creators<BaseClass, Metavariables, creatable_classes>();
+  if (const auto creator = all_creators.find(id);
+      creator != all_creators.end()) {
+    ASSERT(not creator->second.duplicate, "Duplicate factory id: " << id);
+    return creator->second.create(derived_opts);
   }
   PARSE_ERROR(derived_opts.context(),
               "Unknown Id '" << id << "'\n"
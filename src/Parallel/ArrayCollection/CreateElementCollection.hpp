@@ -6,23 +6,29 @@
 #include <cstddef>
 #include <optional>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Block.hpp"
+#include "Domain/CreateInitialElement.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/Creators/Tags/InitialExtents.hpp"
 #include "Domain/Creators/Tags/InitialRefinementLevels.hpp"
 #include "Domain/Domain.hpp"
+#include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags/ElementDistribution.hpp"
 #include "Evolution/DiscontinuousGalerkin/Initialization/QuadratureTag.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/ArrayCollection/MessageAggregator.hpp"
 #include "Parallel/ArrayCollection/SpawnInitializeElementsInCollection.hpp"
+#include "Parallel/ArrayCollection/Tags/BoundaryMessageAggregator.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementCollection.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementWorkQueues.hpp"
 #include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
 #include "Parallel/CreateElementsUsingDistribution.hpp"
 #include "Parallel/GlobalCache.hpp"
@@ -59,12 +65,18 @@ namespace Parallel::Actions {
  * - Adds:
  *   - `Parallel::Tags::ElementCollection`
  *   - `Parallel::Tags::ElementLocations<Dim>`
+ *   - `Parallel::Tags::ElementWorkQueues<Dim>`
  *   - `Parallel::Tags::NumberOfElementsTerminated`
+ *   - `Parallel::Tags::BoundaryMessageAggregator<Dim>`
  * - Removes: nothing
  * - Modifies:
  *   - `Parallel::Tags::ElementCollection`
  *   - `Parallel::Tags::ElementLocations<Dim>`
+ *   - `Parallel::Tags::ElementWorkQueues<Dim>`, with the elements that have
+ *     neighbors on other nodes as priority elements
  *   - `Parallel::Tags::NumberOfElementsTerminated`
+ *   - `Parallel::Tags::BoundaryMessageAggregator<Dim>`, using the
+ *     `Parallel::aggregation_policy()` of the `Metavariables`
  */
 template <size_t Dim, class Metavariables, class PhaseDepActionList,
           typename SimpleTagsFromOptions>
@@ -72,7 +84,9 @@ struct CreateElementCollection {
   using simple_tags = tmpl::list<
       Parallel::Tags::ElementCollection<Dim, Metavariables, PhaseDepActionList,
                                         SimpleTagsFromOptions>,
-      Parallel::Tags::ElementLocations<Dim>, Tags::NumberOfElementsTerminated>;
+      Parallel::Tags::ElementLocations<Dim>,
+      Parallel::Tags::ElementWorkQueues<Dim>, Tags::NumberOfElementsTerminated,
+      Parallel::Tags::BoundaryMessageAggregator<Dim>>;
   using compute_tags = tmpl::list<>;
   using const_global_cache_tags =
       tmpl::list<::domain::Tags::Domain<Dim>,
@@ -147,12 +161,43 @@ struct CreateElementCollection {
     db::mutate<Tags::ElementLocations<Dim>,
                Tags::ElementCollection<Dim, Metavariables, PhaseDepActionList,
                                        SimpleTagsFromOptions>,
-               Tags::NumberOfElementsTerminated>(
-        [&local_cache, &initialization_items, &my_elements_and_cores,
-         &node_of_elements](
+               Tags::ElementWorkQueues<Dim>, Tags::NumberOfElementsTerminated,
+               Tags::BoundaryMessageAggregator<Dim>>(
+        [&blocks, &local_cache, &initial_refinement_levels,
+         &initialization_items, &my_elements_and_cores, &node_of_elements,
+         my_node, number_of_nodes](
             const auto element_locations_ptr, const auto collection_ptr,
-            const gsl::not_null<size_t*> number_of_elements_terminated) {
+            const gsl::not_null<Parallel::ElementWorkQueues<Dim>*>
+                work_queues,
+            const gsl::not_null<size_t*> number_of_elements_terminated,
+            const auto message_aggregator) {
           *number_of_elements_terminated = 0;
+          *message_aggregator =
+              typename Tags::BoundaryMessageAggregator<Dim>::type{
+                  number_of_nodes,
+                  Parallel::aggregation_policy<Metavariables>()};
+          *work_queues = Parallel::ElementWorkQueues<Dim>{
+              Parallel::procs_on_node<size_t>(my_node, local_cache)};
+          // Elements that send data to other nodes run first so the data has
+          // more time to arrive. The initial neighbors are used, so after
+          // refinement the priorities are only approximate.
+          std::unordered_set<ElementId<Dim>> elements_with_remote_neighbors{};
+          for (const auto& element_id_and_core : my_elements_and_cores) {
+            const auto& element_id = element_id_and_core.first;
+            const Element<Dim> element =
+                domain::Initialization::create_initial_element(
+                    element_id, blocks[element_id.block_id()],
+                    initial_refinement_levels);
+            for (const auto& [direction, neighbors] : element.neighbors()) {
+              for (const auto& neighbor_id : neighbors) {
+                if (node_of_elements.at(neighbor_id) != my_node) {
+                  elements_with_remote_neighbors.insert(element_id);
+                }
+              }
+            }
+          }
+          work_queues->set_priority_elements(
+              std::move(elements_with_remote_neighbors));
           const auto serialized_initialization_items =
               serialize(initialization_items);
           *element_locations_ptr = std::move(node_of_elements);
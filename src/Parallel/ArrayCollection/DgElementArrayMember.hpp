@@ -6,6 +6,7 @@
 #include <charm++.h>
 #include <cstddef>
 #include <exception>
+#include <memory>
 #include <pup.h>
 #include <string>
 #include <type_traits>
@@ -22,9 +23,12 @@
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
+#include "Parallel/MeasuredCost.hpp"
+#include "Parallel/MpscQueue.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/Tags/ArrayIndex.hpp"
+#include "Parallel/Tags/MeasuredCost.hpp"
 #include "Parallel/Tags/Metavariables.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -33,6 +37,7 @@
 #include "Utilities/MakeString.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/System/Abort.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -87,7 +92,8 @@ class DgElementArrayMember<Dim, Metavariables,
   using databox_type = db::compute_databox_type<tmpl::flatten<tmpl::list<
       Tags::MetavariablesImpl<metavariables>,
       Tags::ArrayIndexImpl<ElementId<Dim>>,
-      Tags::GlobalCacheProxy<metavariables>, SimpleTagsFromOptions,
+      Tags::GlobalCacheProxy<metavariables>, Tags::MeasuredCost,
+      SimpleTagsFromOptions,
       Tags::GlobalCacheImplCompute<metavariables>,
       Tags::ResourceInfoReference<metavariables>,
       db::wrap_tags_in<Tags::FromGlobalCache, all_cache_tags>,
@@ -175,6 +181,23 @@ class DgElementArrayMember<Dim, Metavariables,
   const auto& get_inboxes() const { return inboxes(); }
   /// @}
 
+  /// \brief Insert `data` into the inbox of `ReceiveTag` from any thread
+  /// without locking.
+  ///
+  /// The data is pushed onto a lock-free multi-producer single-consumer queue
+  /// and moved into the inbox by the thread holding the `element_lock()`
+  /// before the element runs its next iterable action. The caller must make
+  /// sure the element runs afterward, e.g. by sending
+  /// `Parallel::Actions::ReceiveDataForElement`.
+  template <typename ReceiveTag, typename ReceiveData>
+  void push_into_inbox(typename ReceiveTag::temporal_id instance,
+                       ReceiveData&& data) {
+    pending_inbox_insertions_.push(
+        std::make_unique<
+            InboxInsertionImpl<ReceiveTag, std::decay_t<ReceiveData>>>(
+            std::move(instance), std::forward<ReceiveData>(data)));
+  }
+
   void pup(PUP::er& p) override;
 
  private:
@@ -185,12 +208,57 @@ class DgElementArrayMember<Dim, Metavariables,
 
   template <typename PhaseDepActions, size_t... Is>
   bool iterate_over_actions(std::index_sequence<Is...> /*meta*/);
+
+  // Moves the data queued by `push_into_inbox` into the inboxes. Must only be
+  // called while holding the `element_lock()`.
+  void insert_pending_inbox_data();
+
+  // Data queued by `push_into_inbox` that is yet to be inserted into the
+  // inboxes
+  struct InboxInsertion {
+    virtual ~InboxInsertion() = default;
+    virtual void insert(gsl::not_null<inbox_type*> inboxes) = 0;
+  };
+
+  template <typename ReceiveTag, typename ReceiveData>
+  struct InboxInsertionImpl final : InboxInsertion {
+    InboxInsertionImpl(typename ReceiveTag::temporal_id instance_in,
+                       ReceiveData data_in)
+        : instance(std::move(instance_in)), data(std::move(data_in)) {}
+
+    void insert(const gsl::not_null<inbox_type*> inboxes) override {
+      ReceiveTag::insert_into_inbox(
+          make_not_null(&tuples::get<ReceiveTag>(*inboxes)),
+          std::move(instance), std::move(data));
+    }
+
+    typename ReceiveTag::temporal_id instance;
+    ReceiveData data;
+  };
+
+  // Copies start out empty since the queued data is on its way to the element
+  // that was copied, not to the copy.
+  struct PendingInboxInsertions
+      : Parallel::MpscQueue<std::unique_ptr<InboxInsertion>> {
+    PendingInboxInsertions() = default;
+    PendingInboxInsertions(const PendingInboxInsertions& /*unused*/) {}
+    PendingInboxInsertions& operator=(
+        const PendingInboxInsertions& /*unused*/) {
+      return *this;
+    }
+    PendingInboxInsertions(PendingInboxInsertions&& /*unused*/) = default;
+    PendingInboxInsertions& operator=(PendingInboxInsertions&& /*unused*/) =
+        default;
+    ~PendingInboxInsertions() = default;
+  };
+
   static_assert(std::is_move_constructible_v<databox_type>);
   static_assert(std::is_move_constructible_v<inbox_type>);
 
   Parallel::CProxy_GlobalCache<Metavariables> global_cache_proxy_{};
   databox_type box_{};
   inbox_type inboxes_{};
+  PendingInboxInsertions pending_inbox_insertions_{};
 };
 
 /// \cond
@@ -218,8 +286,9 @@ DgElementArrayMember<Dim, Metavariables, tmpl::list<PhaseDepActionListsPack...>,
   (void)initialization_items;  // avoid potential compiler warnings if unused
   ::Initialization::mutate_assign<
       tmpl::list<Tags::ArrayIndex, Tags::GlobalCacheProxy<Metavariables>,
-                 InitializationTags...>>(
+                 Tags::MeasuredCost, InitializationTags...>>(
       make_not_null(&box_), this->element_id_, global_cache_proxy_,
+      Parallel::MeasuredCost{},
       std::move(get<InitializationTags>(initialization_items))...);
 }
 
@@ -286,6 +355,7 @@ void DgElementArrayMember<Dim, Metavariables,
       constexpr Parallel::Phase phase = PhaseDep::phase;
       using actions_list = typename PhaseDep::action_list;
       if (this->phase_ == phase) {
+        const double start_time = sys::wall_time();
         while (
             tmpl::size<actions_list>::value > 0 and
             not this->get_terminate() and
@@ -293,6 +363,8 @@ void DgElementArrayMember<Dim, Metavariables,
             iterate_over_actions<PhaseDep>(
                 std::make_index_sequence<tmpl::size<actions_list>::value>{})) {
         }
+        db::get_mutable_reference<Tags::MeasuredCost>(make_not_null(&box_))
+            .add_wall_time(sys::wall_time() - start_time);
         tmpl::for_each<actions_list>([this](auto action_v) {
           using action = tmpl::type_from<decltype(action_v)>;
           if (this->algorithm_step_ ==
@@ -378,6 +450,8 @@ bool DgElementArrayMember<Dim, Metavariables,
     using actions_list = typename PhaseDepActions::action_list;
     using this_action = tmpl::at_c<actions_list, iter>;
 
+    // Give the action all data that has been sent so far
+    insert_pending_inbox_data();
     constexpr size_t phase_index =
         tmpl::index_of<phase_dependent_action_lists, PhaseDepActions>::value;
     this->performing_action_ = true;
@@ -410,6 +484,8 @@ bool DgElementArrayMember<Dim, Metavariables,
     // Wrap counter if necessary
     if (this->algorithm_step_ >= tmpl::size<actions_list>::value) {
       this->algorithm_step_ = 0;
+      db::get_mutable_reference<Tags::MeasuredCost>(make_not_null(&box_))
+          .add_iteration();
     }
   };
   // In case of no Actions avoid compiler warning.
@@ -419,6 +495,20 @@ bool DgElementArrayMember<Dim, Metavariables,
   return take_next_action;
 }
 
+template <size_t Dim, typename Metavariables,
+          typename... PhaseDepActionListsPack, typename SimpleTagsFromOptions>
+void DgElementArrayMember<
+    Dim, Metavariables, tmpl::list<PhaseDepActionListsPack...>,
+    SimpleTagsFromOptions>::insert_pending_inbox_data() {
+  // Checking first avoids the atomic exchange when nothing was sent
+  if (not pending_inbox_insertions_.empty()) {
+    pending_inbox_insertions_.consume_all(
+        [this](std::unique_ptr<InboxInsertion>&& insertion) {
+          insertion->insert(make_not_null(&inboxes_));
+        });
+  }
+}
+
 template <size_t Dim, typename Metavariables,
           typename... PhaseDepActionListsPack, typename SimpleTagsFromOptions>
 template <typename ThisAction, typename PhaseIndex, typename DataBoxIndex>
@@ -545,6 +635,8 @@ void DgElementArrayMember<Dim, Metavariables,
   DgElementArrayMemberBase<Dim>::pup(p);
   p | global_cache_proxy_;
   p | box_;
+  // The queue isn't serializable, so first move its data into the inboxes
+  insert_pending_inbox_data();
   p | inboxes_;
   if (p.isUnpacking()) {
     // Since we need the global cache to set the node, the derived class
@@ -82,11 +82,6 @@ std::string DgElementArrayMemberBase<Dim>::print_state() const {
   return os.str();
 }
 
-template <size_t Dim>
-Parallel::NodeLock& DgElementArrayMemberBase<Dim>::inbox_lock() {
-  return inbox_lock_;
-}
-
 template <size_t Dim>
 Parallel::NodeLock& DgElementArrayMemberBase<Dim>::element_lock() {
   return element_lock_;
@@ -114,7 +109,7 @@ void DgElementArrayMemberBase<Dim>::pup(PUP::er& p) {
   p | deadlock_analysis_next_iterable_action_;
   p | element_id_;
   if (p.isUnpacking()) {
-    // Node locks are default-constructed, which is fine
+    // The node lock is default-constructed, which is fine
     //
     // Note: my_node_ is set by derived class pup
   }
@@ -85,16 +85,11 @@ class DgElementArrayMemberBase : PUP::able {
   /// Print the current contents of the DataBox
   virtual std::string print_databox() const = 0;
 
-  /// \brief The `inbox_lock()` only locks the inbox, nothing else. The inbox is
-  /// unsafe to access without this lock.
+  /// \brief Locks the element.
   ///
-  /// Use `element_lock()` to lock the rest of the element.
-  ///
-  /// This should always be managed by `std::unique_lock` or `std::lock_guard`.
-  Parallel::NodeLock& inbox_lock();
-
-  /// \brief Locks the element, except for the inbox, which is guarded by the
-  /// `inbox_lock()`.
+  /// Other threads send data to the element without this lock through a
+  /// lock-free queue that is moved into the inboxes while the lock is held,
+  /// see `DgElementArrayMember::push_into_inbox()`.
   ///
   /// This should always be managed by `std::unique_lock` or `std::lock_guard`.
   Parallel::NodeLock& element_lock();
@@ -116,7 +111,6 @@ class DgElementArrayMemberBase : PUP::able {
  protected:
   DgElementArrayMemberBase(ElementId<Dim> element_id, size_t node_number);
 
-  Parallel::NodeLock inbox_lock_{};
   Parallel::NodeLock element_lock_{};
   bool performing_action_ = false;
   Parallel::Phase phase_{Parallel::Phase::Initialization};
@@ -27,6 +27,11 @@ namespace Parallel {
  * The `PhaseDepActionList` is the PDAL that was used for the array
  * approach. Some actions will require updating to support nodegroups if they
  * haven't already been.
+ *
+ * Each element is a `Parallel::DgElementArrayMember` that owns its own
+ * `db::DataBox`, so the `Variables` of different elements are separate heap
+ * allocations. Kernels therefore operate on one element at a time, and the
+ * data of elements with the same `Mesh` is not contiguous in memory.
  */
 template <size_t Dim, class Metavariables, class PhaseDepActionList>
 struct DgElementCollection {
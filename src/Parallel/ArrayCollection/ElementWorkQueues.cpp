@@ -0,0 +1,170 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/ArrayCollection/ElementWorkQueues.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace Parallel {
+template <size_t Dim>
+ElementWorkQueues<Dim>::ElementWorkQueues(const size_t number_of_cores)
+    : number_of_cores_(number_of_cores),
+      cores_(std::make_unique<Core[]>(number_of_cores)),
+      start_time_(sys::wall_time()) {}
+
+template <size_t Dim>
+void ElementWorkQueues<Dim>::set_priority_elements(
+    std::unordered_set<ElementId<Dim>> element_ids) {
+  ASSERT(alg::all_of(gsl::make_span(cores_.get(), number_of_cores_),
+                     [](const Core& core) {
+                       return core.elements.empty() and
+                              core.priority_elements.empty();
+                     }),
+         "The priority elements can only be set while all queues are empty.");
+  priority_elements_ = std::move(element_ids);
+}
+
+template <size_t Dim>
+void ElementWorkQueues<Dim>::push(const size_t core,
+                                  const ElementId<Dim>& element_id) {
+  ASSERT(core < number_of_cores_, "Core " << core << " is out of range, only "
+                                          << number_of_cores_
+                                          << " cores are available.");
+  Core& my_core = cores_[core];
+  const std::lock_guard lock(my_core.mutex);
+  if (priority_elements_.contains(element_id)) {
+    my_core.priority_elements.push_back(element_id);
+  } else {
+    my_core.elements.push_back(element_id);
+  }
+}
+
+template <size_t Dim>
+bool ElementWorkQueues<Dim>::try_pop(
+    const gsl::not_null<ElementId<Dim>*> element_id, const size_t core) {
+  ASSERT(core < number_of_cores_, "Core " << core << " is out of range, only "
+                                          << number_of_cores_
+                                          << " cores are available.");
+  // Priority elements are taken from all cores before any other element
+  for (auto queue : {&Core::priority_elements, &Core::elements}) {
+    {
+      Core& my_core = cores_[core];
+      const std::lock_guard lock(my_core.mutex);
+      auto& my_elements = my_core.*queue;
+      if (not my_elements.empty()) {
+        *element_id = my_elements.back();
+        my_elements.pop_back();
+        return true;
+      }
+    }
+    // Start with the next core so that thieves spread over the victims
+    for (size_t offset = 1; offset < number_of_cores_; ++offset) {
+      Core& victim = cores_[(core + offset) % number_of_cores_];
+      bool stole = false;
+      {
+        const std::lock_guard lock(victim.mutex);
+        auto& victim_elements = victim.*queue;
+        if (not victim_elements.empty()) {
+          *element_id = victim_elements.front();
+          victim_elements.pop_front();
+          stole = true;
+        }
+      }
+      if (stole) {
+        Core& my_core = cores_[core];
+        const std::lock_guard lock(my_core.mutex);
+        ++my_core.elements_stolen;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+template <size_t Dim>
+void ElementWorkQueues<Dim>::add_busy_time(const size_t core,
+                                           const double seconds) {
+  ASSERT(core < number_of_cores_, "Core " << core << " is out of range, only "
+                                          << number_of_cores_
+                                          << " cores are available.");
+  Core& my_core = cores_[core];
+  const std::lock_guard lock(my_core.mutex);
+  my_core.busy_time += seconds;
+  ++my_core.elements_run;
+}
+
+template <size_t Dim>
+std::vector<typename ElementWorkQueues<Dim>::CoreStatistics>
+ElementWorkQueues<Dim>::statistics() const {
+  const double elapsed = sys::wall_time() - start_time_;
+  std::vector<CoreStatistics> result(number_of_cores_);
+  for (size_t core = 0; core < number_of_cores_; ++core) {
+    const Core& current_core = cores_[core];
+    const std::lock_guard lock(current_core.mutex);
+    result[core].busy_time = current_core.busy_time;
+    result[core].idle_time = elapsed - current_core.busy_time;
+    result[core].elements_run = current_core.elements_run;
+    result[core].elements_stolen = current_core.elements_stolen;
+  }
+  return result;
+}
+
+template <size_t Dim>
+void ElementWorkQueues<Dim>::reset_statistics() {
+  for (size_t core = 0; core < number_of_cores_; ++core) {
+    Core& current_core = cores_[core];
+    const std::lock_guard lock(current_core.mutex);
+    current_core.busy_time = 0.0;
+    current_core.elements_run = 0;
+    current_core.elements_stolen = 0;
+  }
+  start_time_ = sys::wall_time();
+}
+
+template <size_t Dim>
+void ElementWorkQueues<Dim>::pup(PUP::er& p) {
+  if (not p.isUnpacking()) {
+    for (size_t core = 0; core < number_of_cores_; ++core) {
+      const size_t queue_size = cores_[core].elements.size() +
+                                cores_[core].priority_elements.size();
+      if (queue_size != 0) {
+        ERROR("Can only serialize ElementWorkQueues if all queues are empty "
+              "but the queue of core "
+              << core << " has " << queue_size << " elements.");
+      }
+    }
+  }
+  p | number_of_cores_;
+  p | priority_elements_;
+  if (p.isUnpacking()) {
+    cores_ = std::make_unique<Core[]>(number_of_cores_);
+    start_time_ = sys::wall_time();
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data) template class ElementWorkQueues<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace Parallel
@@ -0,0 +1,120 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Parallel {
+/*!
+ * \brief Per-core queues of the elements on a node that are ready to run.
+ *
+ * \details When an element becomes ready (e.g. all of its neighbor data for
+ * the next step has arrived), the core that made it ready pushes it onto its
+ * own queue and sends a message to the nodegroup. Whichever core handles the
+ * message runs the element it pushed most recently, whose data is likely still
+ * in cache, and if its own queue is empty it steals the element that has been
+ * waiting longest on another core. This keeps cores busy when the cost per
+ * element varies strongly, e.g. with local time stepping or when some elements
+ * are using DG-subcell.
+ *
+ * Every push must be paired with exactly one message that pops, so there is
+ * always an entry available for each message, although a single call to
+ * `try_pop()` can miss it while another core is concurrently popping.
+ *
+ * Elements marked with `set_priority_elements()` are run before all other
+ * elements, both from a core's own queue and when stealing. These are the
+ * elements with neighbors on other nodes, whose boundary data should be sent
+ * as early as possible so that it arrives before the neighbors need it.
+ *
+ * The time each core spends running elements is accumulated so the idle time
+ * of each core can be reported by `statistics()`.
+ *
+ * \warning Only empty queues may be serialized. The statistics are not
+ * serialized.
+ */
+template <size_t Dim>
+class ElementWorkQueues {
+ public:
+  /// Scheduling statistics of a single core
+  struct CoreStatistics {
+    /// Time spent running elements
+    double busy_time{0.0};
+    /// Wall time elapsed minus `busy_time`
+    double idle_time{0.0};
+    size_t elements_run{0};
+    /// Number of elements taken from another core's queue
+    size_t elements_stolen{0};
+  };
+
+  ElementWorkQueues() = default;
+  explicit ElementWorkQueues(size_t number_of_cores);
+  ElementWorkQueues(const ElementWorkQueues&) = delete;
+  ElementWorkQueues& operator=(const ElementWorkQueues&) = delete;
+  ElementWorkQueues(ElementWorkQueues&&) = default;
+  ElementWorkQueues& operator=(ElementWorkQueues&&) = default;
+  ~ElementWorkQueues() = default;
+
+  size_t number_of_cores() const { return number_of_cores_; }
+
+  /// \brief Set the elements that are popped before all others.
+  ///
+  /// Not threadsafe, must be called while the queues are empty.
+  void set_priority_elements(std::unordered_set<ElementId<Dim>> element_ids);
+
+  const std::unordered_set<ElementId<Dim>>& priority_elements() const {
+    return priority_elements_;
+  }
+
+  /// Add `element_id` to the queue of `core`.
+  void push(size_t core, const ElementId<Dim>& element_id);
+
+  /// Take the most recently pushed element of `core`, or steal the least
+  /// recently pushed element of another core if `core`'s queue is empty.
+  /// Priority elements are taken this way before any other element. Returns
+  /// `false` if no element was found.
+  bool try_pop(gsl::not_null<ElementId<Dim>*> element_id, size_t core);
+
+  /// Record that `core` spent `seconds` running an element.
+  void add_busy_time(size_t core, double seconds);
+
+  /// The statistics of each core since construction or the last call to
+  /// `reset_statistics()`.
+  std::vector<CoreStatistics> statistics() const;
+
+  void reset_statistics();
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  // Aligned so that cores do not contend on the same cache line
+  struct alignas(64) Core {
+    mutable std::mutex mutex{};
+    std::deque<ElementId<Dim>> priority_elements{};
+    std::deque<ElementId<Dim>> elements{};
+    double busy_time{0.0};
+    size_t elements_run{0};
+    size_t elements_stolen{0};
+  };
+
+  size_t number_of_cores_{0};
+  std::unique_ptr<Core[]> cores_{};
+  std::unordered_set<ElementId<Dim>> priority_elements_{};
+  double start_time_{0.0};
+};
+}  // namespace Parallel
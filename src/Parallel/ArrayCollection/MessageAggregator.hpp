@@ -0,0 +1,234 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <utility>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
+
+namespace Parallel {
+/// \brief How `Parallel::MessageAggregator` batches messages.
+///
+/// Set `static constexpr Parallel::AggregationPolicy
+/// message_aggregation_policy{...};` in the metavariables to change the
+/// default policy, see `Parallel::aggregation_policy()`.
+struct AggregationPolicy {
+  /// If `false`, every message to another node is sent on its own.
+  bool enabled = true;
+  /// A batch is sent as soon as it holds this many messages. Batches are also
+  /// sent whenever a sender flushes them, so this only bounds the size of a
+  /// batch.
+  size_t max_messages_per_batch = 64;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | enabled;
+    p | max_messages_per_batch;
+  }
+};
+
+namespace detail {
+CREATE_HAS_STATIC_MEMBER_VARIABLE(message_aggregation_policy)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(message_aggregation_policy)
+}  // namespace detail
+
+/// \brief The `Metavariables::message_aggregation_policy` if it is defined,
+/// otherwise the default `Parallel::AggregationPolicy`.
+template <typename Metavariables>
+constexpr AggregationPolicy aggregation_policy() {
+  if constexpr (detail::has_message_aggregation_policy_v<Metavariables,
+                                                         AggregationPolicy>) {
+    return Metavariables::message_aggregation_policy;
+  } else {
+    return AggregationPolicy{};
+  }
+}
+
+/*!
+ * \brief Per-node buffers of messages to elements on other nodes, so that all
+ * messages to the same node can be sent as one.
+ *
+ * \details Elements of a `Parallel::DgElementCollection` send a message to
+ * each of their neighbors every step. For low-order elements these messages
+ * are small, so the overhead of each message dominates the communication
+ * between nodes. Instead of sending them individually, senders `add()` their
+ * messages to the buffer of the node of the receiver, and `flush()` the
+ * buffers of the nodes of all their neighbors once they are done sending.
+ * Messages of different senders that are added concurrently end up in the
+ * same batch. A batch is also returned by `add()` once it holds
+ * `AggregationPolicy::max_messages_per_batch` messages.
+ *
+ * Every message is sent no later than its sender flushes, so aggregation never
+ * holds back data that a receiver waits for. All member functions except
+ * `pup()`, `reset_statistics()` and the move operations are threadsafe.
+ *
+ * \warning Only empty buffers may be serialized. The statistics are not
+ * serialized.
+ */
+template <size_t Dim, typename TemporalId, typename Data>
+class MessageAggregator {
+ public:
+  using temporal_id = TemporalId;
+  using data_type = Data;
+
+  /// A message to a single element
+  struct Message {
+    ElementId<Dim> element_id{};
+    TemporalId instance{};
+    Data data{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p) {
+      p | element_id;
+      p | instance;
+      p | data;
+    }
+  };
+
+  using Batch = std::vector<Message>;
+
+  /// Counters of the messages and batches sent to other nodes
+  struct Statistics {
+    size_t number_of_messages{0};
+    /// Number of messages sent to the runtime system. The ratio
+    /// `number_of_messages / number_of_batches` is the average batch size.
+    size_t number_of_batches{0};
+    /// Number of batches sent because they reached the maximum size
+    size_t number_of_full_batches{0};
+    /// Wall time over which the messages were counted, to compute rates
+    double elapsed_time{0.0};
+  };
+
+  MessageAggregator() = default;
+  explicit MessageAggregator(size_t number_of_nodes,
+                             AggregationPolicy policy = {})
+      : policy_(policy),
+        number_of_nodes_(number_of_nodes),
+        nodes_(std::make_unique<Node[]>(number_of_nodes)),
+        start_time_(sys::wall_time()) {
+    ASSERT(policy_.max_messages_per_batch > 0,
+           "The maximum number of messages per batch must be positive.");
+  }
+  MessageAggregator(const MessageAggregator&) = delete;
+  MessageAggregator& operator=(const MessageAggregator&) = delete;
+  MessageAggregator(MessageAggregator&&) = default;
+  MessageAggregator& operator=(MessageAggregator&&) = default;
+  ~MessageAggregator() = default;
+
+  const AggregationPolicy& policy() const { return policy_; }
+
+  size_t number_of_nodes() const { return number_of_nodes_; }
+
+  /// \brief Buffer a message for an element on `node`.
+  ///
+  /// Returns the batch of `node` if it is full and must be sent now.
+  std::optional<Batch> add(const size_t node, Message message) {
+    ASSERT(node < number_of_nodes_, "Node " << node << " is out of range, only "
+                                            << number_of_nodes_
+                                            << " nodes are available.");
+    Node& destination = nodes_[node];
+    const std::lock_guard lock(destination.mutex);
+    if (destination.messages.empty()) {
+      destination.messages.reserve(policy_.max_messages_per_batch);
+    }
+    destination.messages.push_back(std::move(message));
+    ++destination.number_of_messages;
+    if (destination.messages.size() < policy_.max_messages_per_batch) {
+      return std::nullopt;
+    }
+    ++destination.number_of_batches;
+    ++destination.number_of_full_batches;
+    return std::exchange(destination.messages, Batch{});
+  }
+
+  /// \brief Remove and return all messages buffered for `node`.
+  ///
+  /// The batch is empty if there are no messages, in which case nothing needs
+  /// to be sent.
+  Batch flush(const size_t node) {
+    ASSERT(node < number_of_nodes_, "Node " << node << " is out of range, only "
+                                            << number_of_nodes_
+                                            << " nodes are available.");
+    Node& destination = nodes_[node];
+    const std::lock_guard lock(destination.mutex);
+    if (not destination.messages.empty()) {
+      ++destination.number_of_batches;
+    }
+    return std::exchange(destination.messages, Batch{});
+  }
+
+  /// The statistics summed over all nodes since construction or the last call
+  /// to `reset_statistics()`.
+  Statistics statistics() const {
+    Statistics result{};
+    for (size_t node = 0; node < number_of_nodes_; ++node) {
+      const Node& destination = nodes_[node];
+      const std::lock_guard lock(destination.mutex);
+      result.number_of_messages += destination.number_of_messages;
+      result.number_of_batches += destination.number_of_batches;
+      result.number_of_full_batches += destination.number_of_full_batches;
+    }
+    result.elapsed_time = sys::wall_time() - start_time_;
+    return result;
+  }
+
+  void reset_statistics() {
+    for (size_t node = 0; node < number_of_nodes_; ++node) {
+      Node& destination = nodes_[node];
+      const std::lock_guard lock(destination.mutex);
+      destination.number_of_messages = 0;
+      destination.number_of_batches = 0;
+      destination.number_of_full_batches = 0;
+    }
+    start_time_ = sys::wall_time();
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    if (not p.isUnpacking()) {
+      for (size_t node = 0; node < number_of_nodes_; ++node) {
+        if (not nodes_[node].messages.empty()) {
+          ERROR("Can only serialize a MessageAggregator if all buffers are "
+                "empty but the buffer of node "
+                << node << " has " << nodes_[node].messages.size()
+                << " messages.");
+        }
+      }
+    }
+    p | policy_;
+    p | number_of_nodes_;
+    if (p.isUnpacking()) {
+      nodes_ = std::make_unique<Node[]>(number_of_nodes_);
+      start_time_ = sys::wall_time();
+    }
+  }
+
+ private:
+  // Aligned so that senders to different nodes do not contend on the same
+  // cache line
+  struct alignas(64) Node {
+    mutable std::mutex mutex{};
+    Batch messages{};
+    size_t number_of_messages{0};
+    size_t number_of_batches{0};
+    size_t number_of_full_batches{0};
+  };
+
+  AggregationPolicy policy_{};
+  size_t number_of_nodes_{0};
+  std::unique_ptr<Node[]> nodes_{};
+  double start_time_{0.0};
+};
+}  // namespace Parallel
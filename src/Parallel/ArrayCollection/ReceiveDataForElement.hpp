@@ -5,24 +5,37 @@
 
 #include <cstddef>
 #include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Evolution/DiscontinuousGalerkin/AtomicInboxBoundaryData.hpp"
+#include "Parallel/ArrayCollection/ElementWorkQueues.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementWorkQueues.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/Phase.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 namespace Parallel::Actions {
 /// \brief Receive data for a specific element on the nodegroup.
 ///
 /// If `StartPhase` is `true` then `start_phase(phase)` is called on the
-/// `element_to_execute_on`, otherwise `perform_algorithm()` is called on the
-/// `element_to_execute_on`.
+/// `element_to_execute_on`, otherwise `perform_algorithm()` is called on an
+/// element taken from `Parallel::Tags::ElementWorkQueues`. That is the element
+/// most recently made ready by this core if there is one, and otherwise
+/// the element that has waited longest on another core, so the
+/// `element_to_execute_on` argument is only a hint. Each message must have
+/// been preceded by a push onto the queues, which `SendDataToElement` does.
 template <bool StartPhase = false>
 struct ReceiveDataForElement {
   /// \brief Entry method called when receiving data from another node.
@@ -46,13 +59,74 @@ struct ReceiveDataForElement {
         make_not_null(&box));
     // Note: We'll be able to do a counter-based check here too once that
     // works for LTS in `SendDataToElement`
-    ReceiveTag::insert_into_inbox(
-        make_not_null(&tuples::get<ReceiveTag>(
-            element_collection.at(element_to_execute_on).inboxes())),
-        instance, std::move(receive_data));
+    auto& element = element_collection.at(element_to_execute_on);
+    if constexpr (std::is_same_v<evolution::dg::AtomicInboxBoundaryData<Dim>,
+                                 typename ReceiveTag::type>) {
+      ReceiveTag::insert_into_inbox(
+          make_not_null(&tuples::get<ReceiveTag>(element.inboxes())),
+          instance, std::move(receive_data));
+    } else {
+      // The element may be running on another thread
+      element.template push_into_inbox<ReceiveTag>(std::move(instance),
+                                                   std::move(receive_data));
+    }
 
+    auto& work_queues =
+        db::get_mutable_reference<Parallel::Tags::ElementWorkQueues<Dim>>(
+            make_not_null(&box));
+    if constexpr (not StartPhase) {
+      work_queues.push(Parallel::my_local_rank<size_t>(cache),
+                       element_to_execute_on);
+    }
     apply_impl<ParallelComponent>(cache, element_to_execute_on,
-                                  make_not_null(&element_collection));
+                                  make_not_null(&element_collection),
+                                  make_not_null(&work_queues));
+  }
+
+  /// \brief Entry method called when receiving a batch of messages from
+  /// another node, see `Parallel::MessageAggregator`.
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex, typename ReceiveTag,
+            typename Message, typename DistributedObject>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+                    const DistributedObject* /*distributed_object*/,
+                    const ReceiveTag& /*meta*/,
+                    std::vector<Message> messages) {
+    static_assert(not StartPhase,
+                  "Batches of messages can't start a phase on the elements.");
+    constexpr size_t Dim = decltype(Message::element_id)::volume_dim;
+    if (messages.empty()) {
+      return;
+    }
+    auto& element_collection = db::get_mutable_reference<
+        typename ParallelComponent::element_collection_tag>(
+        make_not_null(&box));
+    auto& work_queues =
+        db::get_mutable_reference<Parallel::Tags::ElementWorkQueues<Dim>>(
+            make_not_null(&box));
+    const size_t my_core = Parallel::my_local_rank<size_t>(cache);
+    for (auto& message : messages) {
+      // Boundary data is inserted into the lock-free atomic inbox
+      ReceiveTag::insert_into_inbox(
+          make_not_null(&tuples::get<ReceiveTag>(
+              element_collection.at(message.element_id).inboxes())),
+          message.instance, std::move(message.data));
+      work_queues.push(my_core, message.element_id);
+    }
+    // Every push must be paired with one message. This core handles the first
+    // and the others are sent to the node so that other cores can help.
+    auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    const size_t my_node = Parallel::my_node<size_t>(cache);
+    for (size_t i = 1; i < messages.size(); ++i) {
+      Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
+          my_proxy[my_node], messages[i].element_id);
+    }
+    apply_impl<ParallelComponent>(cache, messages.front().element_id,
+                                  make_not_null(&element_collection),
+                                  make_not_null(&work_queues));
   }
 
   /// \brief Entry method call when receiving from same node.
@@ -68,8 +142,11 @@ struct ReceiveDataForElement {
     auto& element_collection = db::get_mutable_reference<
         typename ParallelComponent::element_collection_tag>(
         make_not_null(&box));
-    apply_impl<ParallelComponent>(cache, element_to_execute_on,
-                                  make_not_null(&element_collection));
+    apply_impl<ParallelComponent>(
+        cache, element_to_execute_on, make_not_null(&element_collection),
+        make_not_null(
+            &db::get_mutable_reference<Parallel::Tags::ElementWorkQueues<Dim>>(
+                make_not_null(&box))));
   }
 
  private:
@@ -78,8 +155,10 @@ struct ReceiveDataForElement {
   static void apply_impl(
       Parallel::GlobalCache<Metavariables>& cache,
       const ElementId<Dim>& element_to_execute_on,
-      const gsl::not_null<ElementCollection*> element_collection) {
+      const gsl::not_null<ElementCollection*> element_collection,
+      const gsl::not_null<Parallel::ElementWorkQueues<Dim>*> work_queues) {
     const size_t my_node = Parallel::my_node<size_t>(cache);
+    const size_t my_core = Parallel::my_local_rank<size_t>(cache);
     auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
 
     if constexpr (StartPhase) {
@@ -89,15 +168,40 @@ struct ReceiveDataForElement {
               ->phase();
       auto& element = element_collection->at(element_to_execute_on);
       const std::lock_guard element_lock(element.element_lock());
+      const double start_time = sys::wall_time();
       element.start_phase(current_phase);
+      work_queues->add_busy_time(my_core, sys::wall_time() - start_time);
     } else {
-      auto& element = element_collection->at(element_to_execute_on);
+      // Since every message is paired with one push, there is always an
+      // element for us in the queues. A single sweep can miss it while other
+      // cores are popping, so we retry a few times. If that fails, we send
+      // ourselves another message instead of spinning, so the core can run
+      // other work in the meantime.
+      ElementId<Dim> element_id = element_to_execute_on;
+      constexpr size_t max_pop_attempts = 16;
+      bool popped = false;
+      for (size_t attempt = 0; attempt < max_pop_attempts; ++attempt) {
+        if (work_queues->try_pop(make_not_null(&element_id), my_core)) {
+          popped = true;
+          break;
+        }
+        std::this_thread::yield();
+      }
+      if (not popped) {
+        Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
+            my_proxy[my_node], element_to_execute_on);
+        return;
+      }
+      auto& element = element_collection->at(element_id);
       std::unique_lock element_lock(element.element_lock(), std::defer_lock);
       if (element_lock.try_lock()) {
+        const double start_time = sys::wall_time();
         element.perform_algorithm();
+        work_queues->add_busy_time(my_core, sys::wall_time() - start_time);
       } else {
+        work_queues->push(my_core, element_id);
         Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
-            my_proxy[my_node], element_to_execute_on);
+            my_proxy[my_node], element_id);
       }
     }
   }
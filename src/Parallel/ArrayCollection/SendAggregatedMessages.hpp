@@ -0,0 +1,72 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Parallel/ArrayCollection/ReceiveDataForElement.hpp"
+#include "Parallel/ArrayCollection/Tags/BoundaryMessageAggregator.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel::Actions {
+/*!
+ * \brief A local synchronous action that sends the boundary data buffered in
+ * the `Parallel::Tags::BoundaryMessageAggregator` for the nodes of all
+ * neighbors of the `element`.
+ *
+ * Call this once the `element` has sent data to all its neighbors with
+ * `Parallel::Actions::SendDataToElement`. Data that other elements buffered
+ * for the same nodes in the meantime is sent along in the same batch.
+ */
+struct SendAggregatedMessages {
+  using return_type = void;
+
+  template <typename ParallelComponent, typename DbTagList, size_t Dim,
+            typename ReceiveTag, typename Metavariables>
+  static return_type apply(
+      db::DataBox<DbTagList>& box,
+      const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+      const gsl::not_null<Parallel::GlobalCache<Metavariables>*> cache,
+      const ReceiveTag& /*meta*/, const Element<Dim>& element) {
+    // As in `SendDataToElement`, we avoid locking the nodegroup by using
+    // `db::get_mutable_reference`.
+    auto& aggregator =
+        db::get_mutable_reference<Parallel::Tags::BoundaryMessageAggregator<
+            Dim>>(make_not_null(&box));
+    if (not aggregator.policy().enabled) {
+      return;
+    }
+    const auto& element_locations =
+        db::get_mutable_reference<Parallel::Tags::ElementLocations<Dim>>(
+            make_not_null(&box));
+    const size_t my_node = Parallel::my_node<size_t>(*cache);
+    auto& my_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(*cache);
+    for (const auto& [direction, neighbors] : element.neighbors()) {
+      (void)direction;
+      for (const auto& neighbor : neighbors) {
+        const size_t node_of_neighbor = element_locations.at(neighbor);
+        if (node_of_neighbor == my_node) {
+          continue;
+        }
+        // After the first neighbor on a node the batch is usually empty
+        auto batch = aggregator.flush(node_of_neighbor);
+        if (not batch.empty()) {
+          Parallel::threaded_action<
+              Parallel::Actions::ReceiveDataForElement<>>(
+              my_proxy[node_of_neighbor], ReceiveTag{}, std::move(batch));
+        }
+      }
+    }
+  }
+};
+}  // namespace Parallel::Actions
@@ -4,7 +4,6 @@
 #pragma once
 
 #include <cstddef>
-#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -12,7 +11,9 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Evolution/DiscontinuousGalerkin/AtomicInboxBoundaryData.hpp"
 #include "Parallel/ArrayCollection/ReceiveDataForElement.hpp"
+#include "Parallel/ArrayCollection/Tags/BoundaryMessageAggregator.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementWorkQueues.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/NodeLock.hpp"
@@ -27,13 +28,26 @@ namespace Parallel::Actions {
  * If the inbox tag type is an `evolution::dg::AtomicInboxBoundaryData` then
  * remote insert for elements on the same node is done in a lock-free manner
  * between the sender and receiver elements, and in a wait-free manner between
- * different sender elements to the same receiver element.
+ * different sender elements to the same receiver element. Other inbox tags are
+ * pushed onto the lock-free queue of the receiver element with
+ * `DgElementArrayMember::push_into_inbox()`, so no sender ever waits on a
+ * lock.
  *
  * The number of messages needed to take the next time step on the receiver
  * element is kept track of and a message is sent to the parallel runtime
  * system (e.g. Charm++) only when the receiver/neighbor element has all the
  * data it needs to take the next time step. This is done so as to reduce
  * pressure on the runtime system by sending fewer messages.
+ *
+ * For receivers on the same node, the receiver is pushed onto this core's
+ * queue in `Parallel::Tags::ElementWorkQueues` before the message is sent, so
+ * that whichever core handles the message can run it or steal it.
+ *
+ * Boundary data for elements on other nodes is buffered in the
+ * `Parallel::Tags::BoundaryMessageAggregator` unless its policy disables
+ * aggregation, so that all data for the same node is sent as one message. The
+ * sender must call `Parallel::Actions::SendAggregatedMessages` once it has sent
+ * data to all its neighbors.
  */
 struct SendDataToElement {
   using return_type = void;
@@ -70,10 +84,7 @@ struct SendDataToElement {
             make_not_null(&tuples::get<ReceiveTag>(element.inboxes())),
             instance, std::forward<ReceiveData>(receive_data));
       } else {
-        // Scope so that we minimize how long we lock the inbox.
-        std::lock_guard inbox_lock(element.inbox_lock());
-        count = ReceiveTag::insert_into_inbox(
-            make_not_null(&tuples::get<ReceiveTag>(element.inboxes())),
+        element.template push_into_inbox<ReceiveTag>(
             instance, std::forward<ReceiveData>(receive_data));
       }
       // A lower bound for the number of neighbors is
@@ -83,10 +94,33 @@ struct SendDataToElement {
       // directions that don't have external boundaries in our neighbors block.
       // if (count >=
       //     (2 * Dim - element_to_execute_on.number_of_block_boundaries())) {
+      db::get_mutable_reference<Parallel::Tags::ElementWorkQueues<Dim>>(
+          make_not_null(&box))
+          .push(Parallel::my_local_rank<size_t>(*cache), element_to_execute_on);
       Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
           my_proxy[node_of_element], element_to_execute_on);
       // }
     } else {
+      using aggregator_tag = Parallel::Tags::BoundaryMessageAggregator<Dim>;
+      if constexpr (std::is_same_v<evolution::dg::AtomicInboxBoundaryData<Dim>,
+                                   typename ReceiveTag::type> and
+                    std::is_same_v<std::decay_t<ReceiveData>,
+                                   typename aggregator_tag::type::data_type>) {
+        auto& aggregator =
+            db::get_mutable_reference<aggregator_tag>(make_not_null(&box));
+        if (aggregator.policy().enabled) {
+          auto batch = aggregator.add(
+              node_of_element,
+              {element_to_execute_on, std::move(instance),
+               std::forward<ReceiveData>(receive_data)});
+          if (batch.has_value()) {
+            Parallel::threaded_action<
+                Parallel::Actions::ReceiveDataForElement<>>(
+                my_proxy[node_of_element], ReceiveTag{}, std::move(*batch));
+          }
+          return;
+        }
+      }
       Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
           my_proxy[node_of_element], ReceiveTag{}, element_to_execute_on,
           instance, std::forward<ReceiveData>(receive_data));
@@ -3,19 +3,38 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <limits>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/ArrayCollection/ElementWorkQueues.hpp"
 #include "Parallel/ArrayCollection/ReceiveDataForElement.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementCollection.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementWorkQueues.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Printf/Printf.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
 
 namespace Parallel::Actions {
+namespace detail {
+CREATE_HAS_STATIC_MEMBER_VARIABLE(report_element_scheduling)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(report_element_scheduling)
+}  // namespace detail
+
 /// \brief Starts the next phase on the nodegroup and calls
 /// `ReceiveDataForElement` for each element on the node.
+///
+/// The scheduling statistics of the cores on the node are reset. If the
+/// metavariables set `static constexpr bool report_element_scheduling = true`
+/// and any elements were run during the previous phase, a one-line summary is
+/// printed for the node first: the busy and idle time summed over the cores,
+/// the busy time of the least and most busy core, the number of elements run,
+/// and the number of elements stolen from another core.
 struct StartPhaseOnNodegroup {
   template <typename DbTagsList, typename... InboxTags, typename ArrayIndex,
             typename ActionList, typename ParallelComponent,
@@ -27,6 +46,40 @@ struct StartPhaseOnNodegroup {
       const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
     const size_t my_node = Parallel::my_node<size_t>(cache);
+    constexpr size_t dim = ParallelComponent::element_collection_tag::type::
+        key_type::volume_dim;
+    auto& work_queues =
+        db::get_mutable_reference<Parallel::Tags::ElementWorkQueues<dim>>(
+            make_not_null(&box));
+    if constexpr (detail::has_report_element_scheduling_v<Metavariables>) {
+      if constexpr (Metavariables::report_element_scheduling) {
+        const auto statistics = work_queues.statistics();
+        double busy_time = 0.0;
+        double idle_time = 0.0;
+        double min_busy_time = std::numeric_limits<double>::max();
+        double max_busy_time = 0.0;
+        size_t elements_run = 0;
+        size_t elements_stolen = 0;
+        for (const auto& core_statistics : statistics) {
+          busy_time += core_statistics.busy_time;
+          idle_time += core_statistics.idle_time;
+          min_busy_time = std::min(min_busy_time, core_statistics.busy_time);
+          max_busy_time = std::max(max_busy_time, core_statistics.busy_time);
+          elements_run += core_statistics.elements_run;
+          elements_stolen += core_statistics.elements_stolen;
+        }
+        if (elements_run > 0) {
+          Parallel::printf(
+              "Element scheduling on node %zu in the last phase: busy %gs, "
+              "idle %gs over %zu cores (busy %gs to %gs per core), ran %zu "
+              "elements, stole %zu\n",
+              my_node, busy_time, idle_time, statistics.size(), min_busy_time,
+              max_busy_time, elements_run, elements_stolen);
+        }
+      }
+    }
+    work_queues.reset_statistics();
+
     auto proxy_to_this_node =
         Parallel::get_parallel_component<ParallelComponent>(cache)[my_node];
     for (const auto& [element_id, element] :
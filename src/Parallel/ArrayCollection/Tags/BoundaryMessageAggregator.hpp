@@ -0,0 +1,26 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/Structure/DirectionalId.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Parallel/ArrayCollection/MessageAggregator.hpp"
+#include "Time/TimeStepId.hpp"
+
+namespace Parallel::Tags {
+/// \brief Buffers of the DG boundary data sent to elements on other nodes.
+///
+/// This should be in the nodegroup's DataBox. See
+/// `Parallel::Actions::SendDataToElement`.
+template <size_t Dim>
+struct BoundaryMessageAggregator : db::SimpleTag {
+  using type = Parallel::MessageAggregator<
+      Dim, TimeStepId,
+      std::pair<DirectionalId<Dim>, evolution::dg::BoundaryData<Dim>>>;
+};
+}  // namespace Parallel::Tags
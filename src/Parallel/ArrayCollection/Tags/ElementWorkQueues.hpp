@@ -0,0 +1,19 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Parallel/ArrayCollection/ElementWorkQueues.hpp"
+
+namespace Parallel::Tags {
+/// \brief The per-core queues of elements on the node that are ready to run.
+///
+/// This should be in the nodegroup's DataBox.
+template <size_t Dim>
+struct ElementWorkQueues : db::SimpleTag {
+  using type = Parallel::ElementWorkQueues<Dim>;
+};
+}  // namespace Parallel::Tags
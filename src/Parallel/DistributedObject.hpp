@@ -35,6 +35,7 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Local.hpp"
+#include "Parallel/MeasuredCost.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
@@ -42,7 +43,9 @@
 #include "Parallel/Printf/Printf.hpp"
 #include "Parallel/Tags/ArrayIndex.hpp"
 #include "Parallel/Tags/DistributedObjectTags.hpp"
+#include "Parallel/Tags/MeasuredCost.hpp"
 #include "Parallel/Tags/Metavariables.hpp"
+#include "Parallel/Tracing.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Utilities/Algorithm.hpp"
@@ -433,6 +436,14 @@ class DistributedObject<ParallelComponent,
 
   size_t number_of_actions_in_phase(const Parallel::Phase phase) const;
 
+  // Singletons do much of their work in simple actions, so their measured
+  // cost includes the simple actions that started at `start_time`
+  void add_simple_action_time(double start_time);
+
+  // Print the fraction of the current phase the singleton spent executing
+  // actions and start measuring the next phase
+  void report_singleton_utilization();
+
   // After catching an exception, shutdown the simulation
   void initiate_shutdown(const std::exception& exception);
 
@@ -457,6 +468,12 @@ class DistributedObject<ParallelComponent,
   // analysis we can print this out.
   std::string deadlock_analysis_next_iterable_action_{};
 
+  // Wall time at the start of the current phase and the measured cost up to
+  // then, used to report how busy singletons are in each phase. Not
+  // serialized, since the wall time restarts with the executable.
+  double phase_start_wall_time_{sys::wall_time()};
+  double busy_time_at_phase_start_{0.0};
+
   databox_type box_;
   inbox_type inboxes_{};
   array_index array_index_;
@@ -516,17 +533,20 @@ DistributedObject<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
     // charm++ `AtSync` barrier.
     // The array parallel components are migratable so they get balanced
     // appropriately when load balancing is triggered by the LoadBalancing phase
-    // in Main
+    // in Main. The load of the elements is the `Parallel::MeasuredCost`
+    // reported at the start of the LoadBalancing phase, so Charm++ doesn't
+    // measure it.
     if constexpr (std::is_same_v<typename ParallelComponent::chare_type,
                                  Parallel::Algorithms::Array>) {
       this->usesAtSync = false;
+      this->usesAutoMeasure = false;
       this->setMigratable(true);
     }
     global_cache_proxy_ = global_cache_proxy;
     ::Initialization::mutate_assign<
         tmpl::push_back<distributed_object_tags, InitializationTags...>>(
         make_not_null(&box_), metavariables{}, array_index_,
-        global_cache_proxy_,
+        global_cache_proxy_, Parallel::MeasuredCost{},
         std::move(get<InitializationTags>(initialization_items))...);
   } catch (const std::exception& exception) {
     initiate_shutdown(exception);
@@ -549,15 +569,18 @@ DistributedObject<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
     // charm++ `AtSync` barrier.
     // The array parallel components are migratable so they get balanced
     // appropriately when load balancing is triggered by the LoadBalancing phase
-    // in Main
+    // in Main. The load of the elements is the `Parallel::MeasuredCost`
+    // reported at the start of the LoadBalancing phase, so Charm++ doesn't
+    // measure it.
     this->usesAtSync = false;
+    this->usesAutoMeasure = false;
     this->setMigratable(true);
     global_cache_proxy_ = global_cache_proxy;
     phase_ = current_phase;
     phase_bookmarks_ = std::move(phase_bookmarks);
     ::Initialization::mutate_assign<distributed_object_tags>(
         make_not_null(&box_), metavariables{}, array_index_,
-        global_cache_proxy_);
+        global_cache_proxy_, Parallel::MeasuredCost{});
     callback->invoke();
   } catch (const std::exception& exception) {
     initiate_shutdown(exception);
@@ -677,6 +700,8 @@ void DistributedObject<
           (void)proxy;
         },
         make_not_null(&box_));
+    phase_start_wall_time_ = sys::wall_time();
+    busy_time_at_phase_start_ = db::get<Tags::MeasuredCost>(box_).wall_time();
   }
   p | inboxes_;
   p | array_index_;
@@ -765,8 +790,10 @@ void DistributedObject<ParallelComponent,
             "we do not allow.");
       }
       performing_action_ = true;
+      const double start_time = sys::wall_time();
       forward_tuple_to_action<Action>(
           std::move(args), std::make_index_sequence<sizeof...(Args)>{});
+      add_simple_action_time(start_time);
       performing_action_ = false;
     }
     perform_algorithm();
@@ -796,9 +823,11 @@ void DistributedObject<
             "we do not allow.");
       }
       performing_action_ = true;
+      const double start_time = sys::wall_time();
       Action::template apply<ParallelComponent>(
           box_, *Parallel::local_branch(global_cache_proxy_),
           static_cast<const array_index&>(array_index_));
+      add_simple_action_time(start_time);
       performing_action_ = false;
     }
     perform_algorithm();
@@ -920,12 +949,15 @@ void DistributedObject<
         constexpr Parallel::Phase phase = PhaseDep::phase;
         using actions_list = typename PhaseDep::action_list;
         if (phase_ == phase) {
+          const double start_time = sys::wall_time();
           while (tmpl::size<actions_list>::value > 0 and not get_terminate() and
                  not halt_algorithm_until_next_phase_ and
                  iterate_over_actions<PhaseDep>(
                      std::make_index_sequence<
                          tmpl::size<actions_list>::value>{})) {
           }
+          db::get_mutable_reference<Tags::MeasuredCost>(make_not_null(&box_))
+              .add_wall_time(sys::wall_time() - start_time);
           tmpl::for_each<actions_list>([this](auto action_v) {
             using action = tmpl::type_from<decltype(action_v)>;
             if (algorithm_step_ ==
@@ -990,6 +1022,18 @@ void DistributedObject<ParallelComponent,
     // Then, after updating `phase_`, we check if we've ever stored a bookmark
     // for the new phase previously. If so, we start from where we left off,
     // otherwise, start from the beginning of the action list.
+    if constexpr (Parallel::is_singleton_v<ParallelComponent>) {
+      report_singleton_utilization();
+    }
+    if constexpr (std::is_same_v<typename ParallelComponent::chare_type,
+                                 Parallel::Algorithms::Array>) {
+      if (next_phase == Parallel::Phase::LoadBalancing) {
+        auto& measured_cost = db::get_mutable_reference<Tags::MeasuredCost>(
+            make_not_null(&box_));
+        this->setObjTime(measured_cost.wall_time_since_load_balancing());
+        measured_cost.reset_wall_time_since_load_balancing();
+      }
+    }
     phase_bookmarks_[phase_] = algorithm_step_;
     phase_ = next_phase;
     if (phase_bookmarks_.count(phase_) != 0) {
@@ -1004,6 +1048,41 @@ void DistributedObject<ParallelComponent,
   }
 }
 
+template <typename ParallelComponent, typename... PhaseDepActionListsPack>
+void DistributedObject<ParallelComponent,
+                       tmpl::list<PhaseDepActionListsPack...>>::
+    add_simple_action_time(const double start_time) {
+  if constexpr (Parallel::is_singleton_v<ParallelComponent>) {
+    db::get_mutable_reference<Tags::MeasuredCost>(make_not_null(&box_))
+        .add_wall_time(sys::wall_time() - start_time);
+  } else {
+    (void)start_time;
+  }
+}
+
+template <typename ParallelComponent, typename... PhaseDepActionListsPack>
+void DistributedObject<
+    ParallelComponent,
+    tmpl::list<PhaseDepActionListsPack...>>::report_singleton_utilization() {
+  const double now = sys::wall_time();
+  const double busy_time_at_phase_end =
+      db::get<Tags::MeasuredCost>(box_).wall_time();
+  const double busy_time = busy_time_at_phase_end - busy_time_at_phase_start_;
+  const double phase_time = now - phase_start_wall_time_;
+  if (busy_time > 0.0 and phase_time > 0.0 and
+      Parallel::local_branch(global_cache_proxy_)
+          ->get_resource_info()
+          .report_singleton_utilization()) {
+    Parallel::printf(
+        "%s on global proc %d was busy for %.1f%% of phase %s (%.3f of %.3f "
+        "seconds)\n",
+        pretty_type::name<ParallelComponent>(), sys::my_proc(),
+        100.0 * busy_time / phase_time, phase_, busy_time, phase_time);
+  }
+  phase_start_wall_time_ = now;
+  busy_time_at_phase_start_ = busy_time_at_phase_end;
+}
+
 template <typename ParallelComponent, typename... PhaseDepActionListsPack>
 void DistributedObject<
     ParallelComponent,
@@ -1034,6 +1113,9 @@ DistributedObject<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
         tmpl::index_of<phase_dependent_action_lists, PhaseDepActions>::value;
     performing_action_ = true;
     ++algorithm_step_;
+#ifdef SPECTRE_PROFILING
+    const Parallel::tracing::ScopedActionSpan<this_action> trace_span{};
+#endif  // SPECTRE_PROFILING
     // While the overhead from using the local entry method to enable
     // profiling is fairly small (<2%), we still avoid it when we aren't
     // tracing.
@@ -1061,6 +1143,8 @@ DistributedObject<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
     // Wrap counter if necessary
     if (algorithm_step_ >= tmpl::size<actions_list>::value) {
       algorithm_step_ = 0;
+      db::get_mutable_reference<Tags::MeasuredCost>(make_not_null(&box_))
+          .add_iteration();
     }
   };
   // In case of no Actions avoid compiler warning.
@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <charm++.h>
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <numeric>
@@ -20,6 +23,7 @@
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataBox/TagTraits.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/Callback.hpp"
 #include "Parallel/CharmRegistration.hpp"
@@ -56,6 +60,7 @@ template <typename Metavariables>
 struct MemoryMonitor;
 template <typename ContributingComponent>
 struct ContributeMemoryData;
+struct ContributeScratchArenaData;
 }  // namespace mem_monitor
 /// \endcond
 
@@ -328,6 +333,24 @@ class GlobalCache
   template <typename GlobalCacheTag, typename Function, typename... Args>
   void mutate(const std::tuple<Args...>& args);
 
+  /// Counters of the callbacks registered through
+  /// `mutable_cache_item_is_ready` and of the time spent waiting for the locks
+  /// that protect the mutable cache items and their callbacks on this node.
+  struct MutableCacheStatistics {
+    /// Number of callbacks registered because an item wasn't ready
+    size_t callbacks_registered{0};
+    /// Number of callbacks invoked after mutating an item
+    size_t callbacks_invoked{0};
+    /// Number of lock acquisitions that had to wait for another thread
+    size_t contended_locks{0};
+    /// Total wall time in seconds spent waiting for locks
+    double lock_wait_time{0.0};
+  };
+
+  /// The `MutableCacheStatistics` accumulated on this node since the start of
+  /// the run
+  MutableCacheStatistics mutable_cache_statistics() const;
+
   /// Entry method that computes the size of the local branch of the
   /// GlobalCache and sends it to the MemoryMonitor parallel component.
   ///
@@ -336,6 +359,14 @@ class GlobalCache
   /// framework. Trying to do either of these will result in an ERROR.
   void compute_size_for_memory_monitor(const double time);
 
+  /// Entry method that sends the number of bytes of scratch memory served from
+  /// the `ScratchArena`s and from the heap on this node since the previous call
+  /// to the MemoryMonitor parallel component, then resets those counters.
+  ///
+  /// \note This has the same restrictions as
+  /// `compute_size_for_memory_monitor`.
+  void compute_scratch_arena_usage_for_memory_monitor(const double time);
+
   /// Entry method that will set the value of the Parallel::Tags::ResourceInfo
   /// tag to the value passed in (if the tag exists in the GlobalCache)
   ///
@@ -413,6 +444,12 @@ class GlobalCache
   tuples::tagged_tuple_from_typelist<
       tmpl::transform<MutableTagsStorage, tmpl::bind<MutexTag, tmpl::_1>>>
       mutexes_{};
+  // Lock `mutex`, recording in the statistics below if it was contended
+  std::unique_lock<std::mutex> lock_mutable_cache_mutex(std::mutex& mutex);
+  std::atomic<size_t> callbacks_registered_{0};
+  std::atomic<size_t> callbacks_invoked_{0};
+  std::atomic<size_t> contended_locks_{0};
+  std::atomic<double> lock_wait_time_{0.0};
   ParallelComponentTuple parallel_components_{};
   Parallel::ResourceInfo<Metavariables> resource_info_{};
   bool parallel_components_have_been_set_{false};
@@ -489,12 +526,13 @@ bool GlobalCache<Metavariables>::mutable_cache_item_is_ready(
     std::mutex& mutex = tuples::get<MutexTag<tag>>(mutexes_).second;
     {
       // Scoped for lock guard
-      const std::lock_guard<std::mutex> lock(mutex);
+      const auto lock = lock_mutable_cache_mutex(mutex);
       std::unordered_map<Parallel::ArrayComponentId, std::unique_ptr<Callback>>&
           callbacks = std::get<1>(tuples::get<tag>(mutable_global_cache_));
 
       if (callbacks.count(array_component_id) != 1) {
         callbacks[array_component_id] = std::move(optional_callback);
+        callbacks_registered_.fetch_add(1, std::memory_order_relaxed);
       }
     }
 
@@ -530,7 +568,7 @@ bool GlobalCache<Metavariables>::mutable_cache_item_is_ready(
     // was registered.
     const bool cache_item_is_ready = not callback_was_registered();
     if (cache_item_is_ready) {
-      const std::lock_guard<std::mutex> lock(mutex);
+      const auto lock = lock_mutable_cache_mutex(mutex);
       std::unordered_map<Parallel::ArrayComponentId, std::unique_ptr<Callback>>&
           callbacks = std::get<1>(tuples::get<tag>(mutable_global_cache_));
 
@@ -558,7 +596,7 @@ void GlobalCache<Metavariables>::mutate(const std::tuple<Args...>& args) {
       [this](const auto&... local_args) {
         // First mutex is for value of mutable tag
         std::mutex& mutex = tuples::get<MutexTag<tag>>(mutexes_).first;
-        const std::lock_guard<std::mutex> lock(mutex);
+        const auto lock = lock_mutable_cache_mutex(mutex);
         Function::apply(make_not_null(&StdHelpers::retrieve(std::get<0>(
                             tuples::get<tag>(mutable_global_cache_)))),
                         local_args...);
@@ -579,7 +617,7 @@ void GlobalCache<Metavariables>::mutate(const std::tuple<Args...>& args) {
   std::mutex& mutex = tuples::get<MutexTag<tag>>(mutexes_).second;
   {
     // Scoped for lock guard
-    const std::lock_guard<std::mutex> lock(mutex);
+    const auto lock = lock_mutable_cache_mutex(mutex);
     callbacks = std::move(std::get<1>(tuples::get<tag>(mutable_global_cache_)));
     std::get<1>(tuples::get<tag>(mutable_global_cache_)).clear();
   }
@@ -587,12 +625,39 @@ void GlobalCache<Metavariables>::mutate(const std::tuple<Args...>& args) {
   // Invoke the callbacks.  Any new callbacks that are added to the
   // list (if a callback calls mutable_cache_item_is_ready) will be
   // saved and will not be invoked here.
+  callbacks_invoked_.fetch_add(callbacks.size(), std::memory_order_relaxed);
   for (auto& [array_component_id, callback] : callbacks) {
     (void)array_component_id;
     callback->invoke();
   }
 }
 
+template <typename Metavariables>
+auto GlobalCache<Metavariables>::mutable_cache_statistics() const
+    -> MutableCacheStatistics {
+  return {callbacks_registered_.load(std::memory_order_relaxed),
+          callbacks_invoked_.load(std::memory_order_relaxed),
+          contended_locks_.load(std::memory_order_relaxed),
+          lock_wait_time_.load(std::memory_order_relaxed)};
+}
+
+template <typename Metavariables>
+std::unique_lock<std::mutex>
+GlobalCache<Metavariables>::lock_mutable_cache_mutex(std::mutex& mutex) {
+  std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+  if (not lock.owns_lock()) {
+    const auto start_time = std::chrono::steady_clock::now();
+    lock.lock();
+    contended_locks_.fetch_add(1, std::memory_order_relaxed);
+    lock_wait_time_.fetch_add(
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      start_time)
+            .count(),
+        std::memory_order_relaxed);
+  }
+  return lock;
+}
+
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wsuggest-attribute=noreturn"
@@ -623,6 +688,33 @@ void GlobalCache<Metavariables>::compute_size_for_memory_monitor(
   }
 }
 
+template <typename Metavariables>
+void GlobalCache<Metavariables>::compute_scratch_arena_usage_for_memory_monitor(
+    const double time) {
+  if constexpr (tmpl::list_contains_v<
+                    typename Metavariables::component_list,
+                    mem_monitor::MemoryMonitor<Metavariables>>) {
+    const ScratchArena::Statistics statistics = ScratchArena::statistics();
+    ScratchArena::reset_statistics();
+
+    auto& mem_monitor_proxy = Parallel::get_parallel_component<
+        mem_monitor::MemoryMonitor<Metavariables>>(*this);
+
+    const int my_node = Parallel::my_node<int>(*this);
+
+    Parallel::simple_action<mem_monitor::ContributeScratchArenaData>(
+        mem_monitor_proxy, time, my_node,
+        static_cast<double>(statistics.bytes_from_arena) / 1.0e6,
+        static_cast<double>(statistics.bytes_from_heap) / 1.0e6);
+  } else {
+    (void)time;
+    ERROR(
+        "GlobalCache::compute_scratch_arena_usage_for_memory_monitor can only "
+        "be called if the MemoryMonitor is in the component list in the "
+        "metavariables.\n");
+  }
+}
+
 template <typename Metavariables>
 void GlobalCache<Metavariables>::set_resource_info(
     const Parallel::ResourceInfo<Metavariables>& resource_info) {
@@ -16,6 +16,7 @@
 #include <string>
 #include <type_traits>
 
+#include "DataStructures/DataBox/ComputeItemProfile.hpp"
 #include "Informer/InfoFromBuild.hpp"
 #include "Informer/Informer.hpp"
 #include "Options/ParseOptions.hpp"
@@ -32,10 +33,12 @@
 #include "Parallel/PhaseControl/InitializePhaseChangeDecisionData.hpp"
 #include "Parallel/PhaseControl/PhaseControlTags.hpp"
 #include "Parallel/PhaseControlReductionHelpers.hpp"
+#include "Parallel/Printf/LogBuffer.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "Parallel/Reduction.hpp"
 #include "Parallel/ResourceInfo.hpp"
 #include "Parallel/Tags/ResourceInfo.hpp"
+#include "Parallel/Tracing.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/FileSystem.hpp"
@@ -138,9 +141,13 @@ class Main : public CBase_Main<Metavariables> {
   /// reduction action.
   void did_all_elements_terminate(bool all_elements_terminated);
 
+  /// Flushes the `Parallel::LogBuffer`s of all nodes and exits once the
+  /// messages were printed, see `exit_after_flushing_logs`.
+  void post_deadlock_analysis_termination();
+
   /// Prints exit info and stops the executable with failure if a deadlock was
   /// detected.
-  void post_deadlock_analysis_termination();
+  void exit_after_flushing_logs();
 
  private:
   // Return the dir name for the Charm++ checkpoints as well as the prefix for
@@ -214,6 +221,10 @@ class Main : public CBase_Main<Metavariables> {
   // successfully terminated.
   size_t current_termination_check_index_{0};
   std::vector<std::string> components_that_did_not_terminate_{};
+  // Wall time at which the current phase started, used to report how long
+  // each phase took. Not serialized, so the first phase after a restart is
+  // timed from the restart.
+  double phase_start_wall_time_{0.0};
 };
 
 namespace detail {
@@ -283,6 +294,8 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
   /// \todo detail::register_events_to_trace();
 
   namespace bpo = boost::program_options;
+  std::string log_file_prefix{};
+  size_t log_buffer_capacity = Parallel::LogBuffer::default_capacity;
   try {
     bpo::options_description command_line_options;
     // disable clang-format because it combines the repeated call operator
@@ -307,6 +320,15 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
         ("copyright-and-licenses",
          "Returns all of the copyright and license info for SpECTRE and "
          "its dependencies.")
+        ("log-file-prefix", bpo::value<std::string>(&log_file_prefix),
+         "If specified, the messages of Parallel::log are appended to the "
+         "file PREFIXNode<N>.log of each node instead of being printed to "
+         "stdout.")
+        ("log-buffer-capacity",
+         bpo::value<size_t>(&log_buffer_capacity)->default_value(
+             Parallel::LogBuffer::default_capacity),
+         "Number of bytes of the messages of Parallel::log that are buffered "
+         "on each node between flushes. Further messages are dropped.")
         ;
     // clang-format on
 
@@ -415,11 +437,15 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
         options.parse(
             "ResourceInfo:\n"
             "  AvoidGlobalProc0: false\n"
+            "  ReservedProcs: None\n"
+            "  ReportSingletonUtilization: false\n"
             "  Singletons: Auto\n");
       } else {
         options.parse(
             "ResourceInfo:\n"
-            "  AvoidGlobalProc0: false\n");
+            "  AvoidGlobalProc0: false\n"
+            "  ReservedProcs: None\n"
+            "  ReportSingletonUtilization: false\n");
       }
     }
 
@@ -600,6 +626,8 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
 
   printer_chare = CProxy_PrinterChare::ckNew(1);
   printer_chare_is_set = true;
+  log_buffer_chare =
+      CProxy_LogBufferChare::ckNew(log_file_prefix, log_buffer_capacity);
 }
 
 template <typename Metavariables>
@@ -645,7 +673,10 @@ void Main<Metavariables>::pup(PUP::er& p) {  // NOLINT
           << " procs.\n"
              "Restarted with "
           << sys::number_of_nodes() << " nodes, " << sys::number_of_procs()
-          << " procs.");
+          << " procs.\n"
+             "To continue on different resources, start a new run from the "
+             "volume data of this one, which distributes the elements for the "
+             "new resources.");
     }
   } else {
     int current_nodes = sys::number_of_nodes();
@@ -746,19 +777,28 @@ void Main<Metavariables>::execute_next_phase() {
 
     if (current_phase_ == Parallel::Phase::PostFailureCleanup) {
       Parallel::printf("PostFailureCleanup phase complete. Aborting.\n");
+      Parallel::LogBuffer::local().flush();
       Informer::print_exit_info();
       sys::abort("");
     }
 
+    [[maybe_unused]] const double phase_wall_time =
+        sys::wall_time() - phase_start_wall_time_;
     const auto next_phase = PhaseControl::arbitrate_phase_change(
         make_not_null(&phase_change_decision_data_), current_phase_,
         *Parallel::local_branch(global_cache_proxy_));
     if (next_phase.has_value()) {
       // Only print info if there was an actual phase change.
       if (current_phase_ != next_phase.value()) {
+#ifdef SPECTRE_PROFILING
+        Parallel::printf("Phase %s took %.3f seconds\n", current_phase_,
+                         phase_wall_time);
+        Parallel::tracing::record_phase(current_phase_, phase_wall_time);
+#endif  // SPECTRE_PROFILING
         Parallel::printf("Entering phase from phase control: %s at time %s\n",
                          next_phase.value(), sys::pretty_wall_time());
         current_phase_ = next_phase.value();
+        phase_start_wall_time_ = sys::wall_time();
       }
     } else {
       const auto& default_order = Metavariables::default_phase_order;
@@ -776,14 +816,28 @@ void Main<Metavariables>::execute_next_phase() {
               << "' is last in Metavariables::default_phase_order "
               << default_order << "\n");
       }
+#ifdef SPECTRE_PROFILING
+      Parallel::printf("Phase %s took %.3f seconds\n", current_phase_,
+                       phase_wall_time);
+      Parallel::tracing::record_phase(current_phase_, phase_wall_time);
+#endif  // SPECTRE_PROFILING
       current_phase_ = *std::next(it);
 
       Parallel::printf("Entering phase: %s at time %s\n", current_phase_,
                        sys::pretty_wall_time());
+      phase_start_wall_time_ = sys::wall_time();
     }
   }
 
   if (Parallel::Phase::Exit == current_phase_) {
+#ifdef SPECTRE_PROFILING
+    Parallel::printf("Compute item profile of this process:\n%s",
+                     db::compute_item_profile_summary());
+    Parallel::tracing::write_chrome_trace(
+        "Trace" + std::to_string(sys::my_proc()) + ".json", sys::my_proc());
+    Parallel::printf("Wrote a trace of this process to Trace%d.json\n",
+                     sys::my_proc());
+#endif  // SPECTRE_PROFILING
     check_if_component_terminated_correctly();
     return;
   }
@@ -946,6 +1000,13 @@ void Main<Metavariables>::check_if_component_terminated_correctly() {
 
 template <typename Metavariables>
 void Main<Metavariables>::post_deadlock_analysis_termination() {
+  log_buffer_chare.flush();
+  CkStartQD(CkCallback(CkIndex_Main<Metavariables>::exit_after_flushing_logs(),
+                       this->thisProxy));
+}
+
+template <typename Metavariables>
+void Main<Metavariables>::exit_after_flushing_logs() {
   Informer::print_exit_info();
   if (not components_that_did_not_terminate_.empty()) {
     sys::abort("");
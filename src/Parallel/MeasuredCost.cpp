@@ -0,0 +1,76 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/MeasuredCost.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <pup.h>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace Parallel {
+void MeasuredCost::add_wall_time(const double seconds) {
+  ASSERT(seconds >= 0.0,
+         "The wall time must be non-negative, but is " << seconds);
+  wall_time_ += seconds;
+  wall_time_since_load_balancing_ += seconds;
+}
+
+void MeasuredCost::add_iteration() { ++number_of_iterations_; }
+
+double MeasuredCost::wall_time_per_iteration() const {
+  return number_of_iterations_ == 0
+             ? 0.0
+             : wall_time_ / static_cast<double>(number_of_iterations_);
+}
+
+void MeasuredCost::reset() {
+  wall_time_ = 0.0;
+  number_of_iterations_ = 0;
+}
+
+void MeasuredCost::reset_wall_time_since_load_balancing() {
+  wall_time_since_load_balancing_ = 0.0;
+}
+
+MeasuredCost MeasuredCost::split(const size_t number_of_children) const {
+  ASSERT(number_of_children > 0, "An element must have at least one child.");
+  MeasuredCost child_cost{};
+  child_cost.wall_time_ = wall_time_ / static_cast<double>(number_of_children);
+  child_cost.number_of_iterations_ = number_of_iterations_;
+  child_cost.wall_time_since_load_balancing_ =
+      wall_time_since_load_balancing_ / static_cast<double>(number_of_children);
+  return child_cost;
+}
+
+void MeasuredCost::join(const MeasuredCost& child) {
+  wall_time_ += child.wall_time_;
+  number_of_iterations_ =
+      std::max(number_of_iterations_, child.number_of_iterations_);
+  wall_time_since_load_balancing_ += child.wall_time_since_load_balancing_;
+}
+
+void MeasuredCost::pup(PUP::er& p) {
+  p | wall_time_;
+  p | number_of_iterations_;
+  p | wall_time_since_load_balancing_;
+}
+
+bool operator==(const MeasuredCost& lhs, const MeasuredCost& rhs) {
+  return lhs.wall_time() == rhs.wall_time() and
+         lhs.number_of_iterations() == rhs.number_of_iterations() and
+         lhs.wall_time_since_load_balancing() ==
+             rhs.wall_time_since_load_balancing();
+}
+
+bool operator!=(const MeasuredCost& lhs, const MeasuredCost& rhs) {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const MeasuredCost& cost) {
+  return os << "(" << cost.wall_time() << "s, " << cost.number_of_iterations()
+            << " iterations)";
+}
+}  // namespace Parallel
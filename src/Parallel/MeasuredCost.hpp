@@ -0,0 +1,99 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Parallel {
+/*!
+ * \brief The wall time an element of a parallel component spent executing its
+ * actions.
+ *
+ * \details The DistributedObject (and the elements of a
+ * `Parallel::DgElementCollection`) time every call to `perform_algorithm()`
+ * and add the time here, and count how many times the action list of the
+ * current phase was completed. Unlike the static estimates of
+ * `domain::ElementWeight`, the accumulated cost captures e.g. the higher cost
+ * of elements using DG-subcell or taking smaller time steps.
+ *
+ * The elements of array components report the wall time accumulated since the
+ * last load balancing to the Charm++ load balancer when the
+ * `Parallel::Phase::LoadBalancing` starts, in place of the load Charm++ would
+ * measure itself. Elements created by AMR start from the cost of the
+ * elements they replace (see `split()` and `join()`).
+ *
+ * For singletons the time spent in simple actions is included as well, and
+ * the fraction of each phase they were busy is printed at the end of the
+ * phase (see `Parallel::ResourceInfo`).
+ *
+ * \note The wall time includes time an element spends waiting inside an
+ * action, e.g. for a lock. When the number of elements per core is large this
+ * is negligible.
+ */
+class MeasuredCost {
+ public:
+  MeasuredCost() = default;
+
+  /// Add `seconds` of wall time spent executing actions.
+  void add_wall_time(double seconds);
+
+  /// Record that the action list of the current phase was completed.
+  void add_iteration();
+
+  /// Total wall time (in seconds) spent executing actions.
+  double wall_time() const { return wall_time_; }
+
+  /// Number of times the action list was completed.
+  size_t number_of_iterations() const { return number_of_iterations_; }
+
+  /// The average wall time per iteration, or zero if no iteration was
+  /// completed yet.
+  double wall_time_per_iteration() const;
+
+  /// Wall time (in seconds) spent executing actions since the last call to
+  /// `reset_wall_time_since_load_balancing()`. This is not cleared by
+  /// `reset()`.
+  double wall_time_since_load_balancing() const {
+    return wall_time_since_load_balancing_;
+  }
+
+  /// Discard all measurements, e.g. after the elements were redistributed.
+  void reset();
+
+  /// Discard the wall time reported to the load balancer.
+  void reset_wall_time_since_load_balancing();
+
+  /// The cost of each of the `number_of_children` elements created by AMR
+  /// splitting an element with this cost. The wall times are divided evenly
+  /// among the children, which have completed as many iterations as their
+  /// parent.
+  MeasuredCost split(size_t number_of_children) const;
+
+  /// Add the cost of a child to the cost of the element created by AMR joining
+  /// it with its siblings. The wall times are summed, while the number of
+  /// iterations is the largest of the children's.
+  void join(const MeasuredCost& child);
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  double wall_time_{0.0};
+  size_t number_of_iterations_{0};
+  double wall_time_since_load_balancing_{0.0};
+};
+
+bool operator==(const MeasuredCost& lhs, const MeasuredCost& rhs);
+
+bool operator!=(const MeasuredCost& lhs, const MeasuredCost& rhs);
+
+std::ostream& operator<<(std::ostream& os, const MeasuredCost& cost);
+}  // namespace Parallel
@@ -0,0 +1,104 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Parallel {
+/*!
+ * \brief An unbounded lock-free multi-producer single-consumer queue.
+ *
+ * Any number of threads may push simultaneously, while only one thread at a
+ * time may consume. A push allocates a node and links it in with a single
+ * compare-and-swap, so producers never wait for each other or for the
+ * consumer. `consume_all()` detaches all nodes with one atomic exchange and
+ * passes the values to the consumer in the order in which they were pushed.
+ *
+ * \note This class is intentionally not serializable since handling
+ * threadsafety around serialization requires careful thought of the individual
+ * circumstances. Consume the queue before serializing its owner.
+ */
+template <typename T>
+class MpscQueue {
+ public:
+  MpscQueue() = default;
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+  /// Moving is not threadsafe.
+  MpscQueue(MpscQueue&& other) noexcept
+      : head_(other.head_.exchange(nullptr, std::memory_order_relaxed)) {}
+  /// Moving is not threadsafe.
+  MpscQueue& operator=(MpscQueue&& other) noexcept {
+    if (this != &other) {
+      clear();
+      head_.store(other.head_.exchange(nullptr, std::memory_order_relaxed),
+                  std::memory_order_relaxed);
+    }
+    return *this;
+  }
+  ~MpscQueue() { clear(); }
+
+  /// Construct a value at the back of the queue. Threadsafe.
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto* const node = new Node{T(std::forward<Args>(args)...),
+                                head_.load(std::memory_order_relaxed)};
+    while (not head_.compare_exchange_weak(node->next, node,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+    }
+  }
+
+  /// Push a value onto the back of the queue. Threadsafe.
+  void push(T value) { emplace(std::move(value)); }
+
+  /// Whether the queue is empty. Since other threads may push at any time, the
+  /// queue can be non-empty by the time this function returns.
+  bool empty() const {
+    return head_.load(std::memory_order_acquire) == nullptr;
+  }
+
+  /// \brief Removes all values from the queue and calls `consumer(T&&)` on
+  /// each, in the order in which they were pushed. Returns the number of
+  /// values consumed.
+  ///
+  /// Values pushed while this function runs are left for the next call.
+  template <typename F>
+  size_t consume_all(F&& consumer) {
+    Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+    // The nodes are linked from the most recent push, so reverse them
+    Node* first = nullptr;
+    while (node != nullptr) {
+      Node* const next = node->next;
+      node->next = first;
+      first = node;
+      node = next;
+    }
+    size_t count = 0;
+    while (first != nullptr) {
+      const std::unique_ptr<Node> current{first};
+      first = current->next;
+      consumer(std::move(current->value));
+      ++count;
+    }
+    return count;
+  }
+
+ private:
+  struct Node {
+    T value;
+    Node* next;
+  };
+
+  void clear() {
+    consume_all([](T&& /*value*/) {});
+  }
+
+  std::atomic<Node*> head_{nullptr};
+};
+}  // namespace Parallel
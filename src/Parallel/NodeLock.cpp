@@ -3,6 +3,7 @@
 
 #include "Parallel/NodeLock.hpp"
 
+#include <atomic>
 #include <pup.h>
 
 #include "Parallel/Spinlock.hpp"
@@ -17,13 +18,24 @@ NodeLock::NodeLock()
 NodeLock::NodeLock(CkMigrateMessage* /*message*/) {}
 
 NodeLock::NodeLock(NodeLock&& moved_lock) noexcept
-    : lock_(std::move(moved_lock.lock_)) {
+    : lock_(std::move(moved_lock.lock_)),
+      number_of_acquisitions_(moved_lock.number_of_acquisitions_),
+      number_of_contended_locks_(moved_lock.number_of_contended_locks_),
+      number_of_failed_try_locks_(moved_lock.number_of_failed_try_locks_.load(
+          std::memory_order_relaxed)) {
   moved_lock.lock_ = nullptr;
+  moved_lock.reset_statistics();
 }
 
 NodeLock& NodeLock::operator=(NodeLock&& moved_lock) noexcept {
   lock_ = std::move(moved_lock.lock_);
+  number_of_acquisitions_ = moved_lock.number_of_acquisitions_;
+  number_of_contended_locks_ = moved_lock.number_of_contended_locks_;
+  number_of_failed_try_locks_.store(
+      moved_lock.number_of_failed_try_locks_.load(std::memory_order_relaxed),
+      std::memory_order_relaxed);
   moved_lock.lock_ = nullptr;
+  moved_lock.reset_statistics();
   return *this;
 }
 
@@ -33,14 +45,24 @@ void NodeLock::lock() {
   if (UNLIKELY(nullptr == lock_)) {
     ERROR("Trying to lock a destroyed lock");
   }
-  lock_->lock();
+  // Only the contended case pays for the second atomic operation
+  if (not lock_->try_lock()) {
+    lock_->lock();
+    ++number_of_contended_locks_;
+  }
+  ++number_of_acquisitions_;
 }
 
 bool NodeLock::try_lock() {
   if (UNLIKELY(nullptr == lock_)) {
     ERROR("Trying to try_lock a destroyed lock");
   }
-  return lock_->try_lock();
+  if (lock_->try_lock()) {
+    ++number_of_acquisitions_;
+    return true;
+  }
+  number_of_failed_try_locks_.fetch_add(1, std::memory_order_relaxed);
+  return false;
 }
 
 void NodeLock::unlock() {
@@ -50,6 +72,17 @@ void NodeLock::unlock() {
   lock_->unlock();
 }
 
+NodeLock::Statistics NodeLock::statistics() const {
+  return {number_of_acquisitions_, number_of_contended_locks_,
+          number_of_failed_try_locks_.load(std::memory_order_relaxed)};
+}
+
+void NodeLock::reset_statistics() {
+  number_of_acquisitions_ = 0;
+  number_of_contended_locks_ = 0;
+  number_of_failed_try_locks_.store(0, std::memory_order_relaxed);
+}
+
 void NodeLock::destroy() {
   if (nullptr == lock_) {
     return;
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <charm++.h>
+#include <cstddef>
 #include <memory>
 
 #include "Parallel/Spinlock.hpp"
@@ -21,10 +23,23 @@ namespace Parallel {
  * \brief A typesafe wrapper for a lock for synchronization of shared resources
  * on a given node, with safe creation, destruction, and serialization.
  *
+ * The lock counts how often it was acquired and how often it was contended,
+ * see `statistics()`, so that contention on shared resources can be measured.
+ *
  * \note If a locked NodeLock is serialized, it is deserialized as unlocked.
  */
 class NodeLock {
  public:
+  /// \brief Counters of how the lock was used
+  struct Statistics {
+    /// Number of times the lock was acquired by `lock()` or `try_lock()`
+    size_t number_of_acquisitions = 0;
+    /// Number of times `lock()` had to wait because the lock was held
+    size_t number_of_contended_locks = 0;
+    /// Number of times `try_lock()` failed because the lock was held
+    size_t number_of_failed_try_locks = 0;
+  };
+
   NodeLock();
 
   explicit NodeLock(CkMigrateMessage* /*message*/);
@@ -45,10 +60,25 @@ class NodeLock {
 
   bool is_destroyed() { return nullptr == lock_; }
 
+  /// \brief The usage counters of the lock.
+  ///
+  /// The acquisition counters are only updated while the lock is held, so
+  /// read them while holding the lock or while no other thread uses it. The
+  /// counters are moved along with the lock but are not serialized.
+  Statistics statistics() const;
+
+  /// Reset all usage counters to zero. Requires the same care as
+  /// `statistics()`.
+  void reset_statistics();
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p);
 
  private:
   std::unique_ptr<Spinlock> lock_;
+  size_t number_of_acquisitions_{0};
+  size_t number_of_contended_locks_{0};
+  // Updated without holding the lock
+  std::atomic<size_t> number_of_failed_try_locks_{0};
 };
 }  // namespace Parallel
@@ -5,6 +5,7 @@
 
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseControl/CheckpointAndExitAfterWallclock.hpp"
+#include "Parallel/PhaseControl/LoadBalanceStragglers.hpp"
 #include "Parallel/PhaseControl/VisitAndReturn.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -15,5 +16,5 @@ using factory_creatable_classes =
                VisitAndReturn<Parallel::Phase::CheckDomain>,
                VisitAndReturn<Parallel::Phase::LoadBalancing>,
                VisitAndReturn<Parallel::Phase::WriteCheckpoint>,
-               CheckpointAndExitAfterWallclock>;
+               CheckpointAndExitAfterWallclock, LoadBalanceStragglers>;
 }
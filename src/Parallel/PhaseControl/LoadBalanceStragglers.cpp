@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/PhaseControl/LoadBalanceStragglers.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <pup.h>
+#include <vector>
+
+#include "Options/ParseError.hpp"
+#include "Parallel/Phase.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace PhaseControl {
+
+namespace Tags {
+std::vector<double> BusyTimePerCoreOnNodes::combine_method::operator()(
+    std::vector<double> first, const std::vector<double>& second) {
+  if (first.empty()) {
+    return second;
+  }
+  if (second.empty()) {
+    return first;
+  }
+  if (first.size() != second.size()) {
+    ERROR("Can't combine busy times of " << first.size() << " and "
+                                         << second.size() << " nodes.");
+  }
+  std::transform(first.begin(), first.end(), second.begin(), first.begin(),
+                 std::plus<>{});
+  return first;
+}
+
+std::optional<Parallel::Phase> StragglerReturnPhase::combine_method::operator()(
+    const std::optional<Parallel::Phase> /*first_phase*/,
+    const std::optional<Parallel::Phase>& /*second_phase*/) {
+  ERROR(
+      "The return phase should only be altered by the phase change "
+      "arbitration in the Main chare, so no reduction data should be "
+      "provided.");
+}
+}  // namespace Tags
+
+LoadBalanceStragglers::LoadBalanceStragglers(
+    const double maximum_throughput_loss, const Options::Context& context)
+    : maximum_throughput_loss_(maximum_throughput_loss) {
+  if (maximum_throughput_loss < 0.0 or maximum_throughput_loss > 1.0) {
+    PARSE_ERROR(context, "The maximum throughput loss must be in [0, 1], but "
+                         "got "
+                             << maximum_throughput_loss);
+  }
+}
+
+LoadBalanceStragglers::LoadBalanceStragglers(CkMigrateMessage* msg)
+    : PhaseChange(msg) {}
+
+void LoadBalanceStragglers::pup(PUP::er& p) {
+  PhaseChange::pup(p);
+  p | maximum_throughput_loss_;
+}
+}  // namespace PhaseControl
+
+PUP::able::PUP_ID PhaseControl::LoadBalanceStragglers::my_PUP_ID = 0;
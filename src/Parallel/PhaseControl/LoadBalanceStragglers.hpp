@@ -0,0 +1,239 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <pup.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Options/Context.hpp"
+#include "Options/String.hpp"
+#include "Parallel/AlgorithmMetafunctions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/MeasuredCost.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseControl/ContributeToPhaseChangeReduction.hpp"
+#include "Parallel/PhaseControl/PhaseChange.hpp"
+#include "Parallel/Printf/Printf.hpp"
+#include "Parallel/Tags/MeasuredCost.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace PhaseControl {
+namespace Tags {
+/// The wall time the array elements on each node spent executing actions since
+/// the last check, divided by the number of cores of the node.
+///
+/// Combinations add the times node by node.
+struct BusyTimePerCoreOnNodes {
+  using type = std::vector<double>;
+
+  struct combine_method {
+    std::vector<double> operator()(std::vector<double> first,
+                                   const std::vector<double>& second);
+  };
+
+  using main_combine_method = combine_method;
+};
+
+/// Storage in the phase change decision tuple so that the Main chare can record
+/// the phase to return to after balancing the load in
+/// `PhaseControl::LoadBalanceStragglers`.
+///
+/// \note This tag is not intended to participate in any of the reduction
+/// procedures, so will error if the combine method is called.
+struct StragglerReturnPhase {
+  using type = std::optional<Parallel::Phase>;
+
+  struct combine_method {
+    [[noreturn]] std::optional<Parallel::Phase> operator()(
+        const std::optional<Parallel::Phase> /*first_phase*/,
+        const std::optional<Parallel::Phase>& /*second_phase*/);
+  };
+
+  using main_combine_method = combine_method;
+};
+}  // namespace Tags
+
+/*!
+ * \brief Phase control object that runs the LoadBalancing phase when slow
+ * nodes hold back the others
+ *
+ * With global time stepping all nodes wait for the slowest node at every slab,
+ * so a few slow nodes (e.g. because of thermal throttling or other jobs on the
+ * node) slow down the whole run. Each time this phase control is triggered,
+ * the array elements contribute the wall time they spent executing actions
+ * since the last check (see `Parallel::MeasuredCost`), summed up on each node
+ * and divided by the number of cores of the node. The throughput loss is the
+ * fraction of time the cores of an average node wait for the busiest node,
+ *
+ * \f{equation}
+ * 1 - \frac{\langle T_\mathrm{node} \rangle}{\max T_\mathrm{node}},
+ * \f}
+ *
+ * where \f$T_\mathrm{node}\f$ is the busy time per core of a node. When the
+ * throughput loss exceeds `MaximumThroughputLoss`, the throughput loss and the
+ * slowest node are printed and the LoadBalancing phase runs. Charm++'s load
+ * balancer measures the elements on the slow nodes as more expensive and
+ * moves some of them elsewhere. Execution then returns to the original phase.
+ *
+ * \note The `Parallel::MeasuredCost` of the array elements is reset by every
+ * check, so each check measures only the time since the previous one.
+ */
+struct LoadBalanceStragglers : public PhaseChange {
+  explicit LoadBalanceStragglers(double maximum_throughput_loss,
+                                 const Options::Context& context = {});
+
+  explicit LoadBalanceStragglers(CkMigrateMessage* msg);
+
+  /// \cond
+  LoadBalanceStragglers() = default;
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(LoadBalanceStragglers);  // NOLINT
+  /// \endcond
+
+  struct MaximumThroughputLoss {
+    using type = double;
+    static constexpr Options::String help = {
+        "Fraction of the wall time an average node may spend waiting for the "
+        "slowest node before the load is balanced."};
+    static type lower_bound() { return 0.0; }
+    static type upper_bound() { return 1.0; }
+  };
+
+  using options = tmpl::list<MaximumThroughputLoss>;
+  static constexpr Options::String help{
+      "Measure how long the elements on each node were busy since the last "
+      "check, and balance the load when slow nodes hold back the others by "
+      "more than the MaximumThroughputLoss."};
+
+  using argument_tags = tmpl::list<>;
+  using return_tags = tmpl::list<Parallel::Tags::MeasuredCost>;
+
+  using phase_change_tags_and_combines =
+      tmpl::list<Tags::BusyTimePerCoreOnNodes, Tags::StragglerReturnPhase>;
+
+  template <typename Metavariables>
+  using participating_components = typename Metavariables::component_list;
+
+  template <typename... DecisionTags>
+  void initialize_phase_data_impl(
+      const gsl::not_null<tuples::TaggedTuple<DecisionTags...>*>
+          phase_change_decision_data) const;
+
+  template <typename ParallelComponent, typename ArrayIndex,
+            typename Metavariables>
+  void contribute_phase_data_impl(
+      gsl::not_null<Parallel::MeasuredCost*> measured_cost,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index) const;
+
+  template <typename... DecisionTags, typename Metavariables>
+  typename std::optional<std::pair<Parallel::Phase, ArbitrationStrategy>>
+  arbitrate_phase_change_impl(
+      const gsl::not_null<tuples::TaggedTuple<DecisionTags...>*>
+          phase_change_decision_data,
+      const Parallel::Phase current_phase,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/) const;
+
+  void pup(PUP::er& p) override;
+
+ private:
+  double maximum_throughput_loss_{};
+};
+
+template <typename... DecisionTags>
+void LoadBalanceStragglers::initialize_phase_data_impl(
+    const gsl::not_null<tuples::TaggedTuple<DecisionTags...>*>
+        phase_change_decision_data) const {
+  tuples::get<Tags::BusyTimePerCoreOnNodes>(*phase_change_decision_data)
+      .clear();
+  tuples::get<Tags::StragglerReturnPhase>(*phase_change_decision_data) =
+      std::nullopt;
+}
+
+template <typename ParallelComponent, typename ArrayIndex,
+          typename Metavariables>
+void LoadBalanceStragglers::contribute_phase_data_impl(
+    const gsl::not_null<Parallel::MeasuredCost*> measured_cost,
+    Parallel::GlobalCache<Metavariables>& cache,
+    const ArrayIndex& array_index) const {
+  // Singletons and groups are not moved by the load balancer, and the busy
+  // time of singletons is also used to report their utilization
+  if constexpr (std::is_same_v<typename ParallelComponent::chare_type,
+                               Parallel::Algorithms::Array>) {
+    const int node = sys::my_node();
+    std::vector<double> busy_time_per_core(
+        static_cast<size_t>(sys::number_of_nodes()), 0.0);
+    busy_time_per_core[static_cast<size_t>(node)] =
+        measured_cost->wall_time() /
+        static_cast<double>(sys::procs_on_node(node));
+    measured_cost->reset();
+    Parallel::contribute_to_phase_change_reduction<ParallelComponent>(
+        tuples::TaggedTuple<Tags::BusyTimePerCoreOnNodes>{
+            std::move(busy_time_per_core)},
+        cache, array_index);
+  } else {
+    (void)measured_cost;
+    (void)cache;
+    (void)array_index;
+  }
+}
+
+template <typename... DecisionTags, typename Metavariables>
+typename std::optional<std::pair<Parallel::Phase, ArbitrationStrategy>>
+LoadBalanceStragglers::arbitrate_phase_change_impl(
+    const gsl::not_null<tuples::TaggedTuple<DecisionTags...>*>
+        phase_change_decision_data,
+    const Parallel::Phase current_phase,
+    const Parallel::GlobalCache<Metavariables>& /*cache*/) const {
+  auto& return_phase =
+      tuples::get<Tags::StragglerReturnPhase>(*phase_change_decision_data);
+  if (return_phase.has_value()) {
+    const auto result = return_phase;
+    return_phase.reset();
+    return std::make_pair(result.value(),
+                          ArbitrationStrategy::PermitAdditionalJumps);
+  }
+  auto& busy_time_per_core =
+      tuples::get<Tags::BusyTimePerCoreOnNodes>(*phase_change_decision_data);
+  if (busy_time_per_core.empty()) {
+    return std::nullopt;
+  }
+  const auto slowest_node =
+      std::max_element(busy_time_per_core.begin(), busy_time_per_core.end());
+  const double max_busy_time = *slowest_node;
+  const double mean_busy_time =
+      std::accumulate(busy_time_per_core.begin(), busy_time_per_core.end(),
+                      0.0) /
+      static_cast<double>(busy_time_per_core.size());
+  const auto slowest_node_index =
+      static_cast<size_t>(slowest_node - busy_time_per_core.begin());
+  busy_time_per_core.clear();
+  if (max_busy_time <= 0.0) {
+    return std::nullopt;
+  }
+  const double throughput_loss = 1.0 - mean_busy_time / max_busy_time;
+  if (throughput_loss <= maximum_throughput_loss_) {
+    return std::nullopt;
+  }
+  Parallel::printf(
+      "Node %zu was busy for %.3g seconds per core, %.1f%% longer than the "
+      "average node. Waiting for it cost %.1f%% of the throughput, so the load "
+      "is balanced.\n",
+      slowest_node_index, max_busy_time,
+      100.0 * (max_busy_time / mean_busy_time - 1.0), 100.0 * throughput_loss);
+  return_phase = current_phase;
+  return std::make_pair(Parallel::Phase::LoadBalancing,
+                        ArbitrationStrategy::RunPhaseImmediately);
+}
+}  // namespace PhaseControl
@@ -0,0 +1,187 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/Printf/LogBuffer.hpp"
+
+#include <charm++.h>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Parallel/Printf/Printf.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace Parallel {
+LogBuffer::~LogBuffer() {
+  // Main flushes all buffers before it exits, so this only prints the messages
+  // of executables that don't exit through Main, e.g. the unit tests. The
+  // printer chare may be gone at exit, so the messages are printed on this
+  // process.
+  const auto messages = extract();
+  if (messages.empty()) {
+    return;
+  }
+  const auto file = file_name_impl();
+  if (file.has_value()) {
+    std::ofstream stream(*file, std::ios::app);
+    stream << messages.data();
+  } else {
+    // NOLINTNEXTLINE(cert-err33-c,cppcoreguidelines-pro-type-vararg)
+    fprintf(stdout, "%s", messages.data());
+  }
+}
+
+LogBuffer& LogBuffer::local() {
+  static LogBuffer log_buffer{};
+  return log_buffer;
+}
+
+bool LogBuffer::append(const std::string& source,
+                       const std::vector<char>& message,
+                       const double wall_time) {
+  std::stringstream prefix{};
+  prefix << "[" << std::fixed << std::setprecision(3) << wall_time << "s Node"
+         << sys::my_node() << " " << source << "] ";
+  const std::string prefix_str = prefix.str();
+  // The message is null-terminated
+  const size_t message_size = message.empty() ? 0 : message.size() - 1;
+  {
+    const std::lock_guard lock(mutex_);
+    if (buffer_.size() + prefix_str.size() + message_size > capacity_) {
+      ++number_of_dropped_messages_;
+      return false;
+    }
+    buffer_.insert(buffer_.end(), prefix_str.begin(), prefix_str.end());
+    buffer_.insert(buffer_.end(), message.begin(),
+                   message.begin() + static_cast<std::ptrdiff_t>(message_size));
+  }
+  if (printer_chare_is_set) {
+    std::call_once(flushing_started_, [this]() {
+      CcdCallFnAfter(&LogBuffer::flush_periodically, this,
+                     1000.0 * flush_interval);
+    });
+  }
+  return true;
+}
+
+std::vector<char> LogBuffer::extract() {
+  std::vector<char> messages{};
+  size_t number_of_dropped_messages = 0;
+  {
+    const std::lock_guard lock(mutex_);
+    std::swap(messages, buffer_);
+    std::swap(number_of_dropped_messages, number_of_dropped_messages_);
+  }
+  if (number_of_dropped_messages > 0) {
+    const std::string report =
+        "[Node" + std::to_string(sys::my_node()) + " LogBuffer] Dropped " +
+        std::to_string(number_of_dropped_messages) +
+        " messages because the buffer was full.\n";
+    messages.insert(messages.end(), report.begin(), report.end());
+  }
+  if (not messages.empty()) {
+    messages.push_back('\0');
+  }
+  return messages;
+}
+
+void LogBuffer::flush() {
+  const auto messages = extract();
+  if (not messages.empty()) {
+    print(messages);
+  }
+}
+
+void LogBuffer::set_file_prefix(std::optional<std::string> file_prefix) {
+  const std::lock_guard lock(mutex_);
+  file_prefix_ = std::move(file_prefix);
+}
+
+std::optional<std::string> LogBuffer::file_name() const {
+  const std::lock_guard lock(mutex_);
+  return file_name_impl();
+}
+
+void LogBuffer::set_capacity(const size_t capacity) {
+  const std::lock_guard lock(mutex_);
+  capacity_ = capacity;
+}
+
+size_t LogBuffer::capacity() const {
+  const std::lock_guard lock(mutex_);
+  return capacity_;
+}
+
+void LogBuffer::configure(const std::string& file_prefix,
+                          const size_t capacity) {
+  set_file_prefix(file_prefix.empty() ? std::nullopt
+                                      : std::optional{file_prefix});
+  set_capacity(capacity);
+}
+
+size_t LogBuffer::size() const {
+  const std::lock_guard lock(mutex_);
+  return buffer_.size();
+}
+
+size_t LogBuffer::number_of_dropped_messages() const {
+  const std::lock_guard lock(mutex_);
+  return number_of_dropped_messages_;
+}
+
+void LogBuffer::flush_periodically(void* log_buffer_ptr,
+                                   double /*current_wall_time*/) {
+  static_cast<LogBuffer*>(log_buffer_ptr)->flush();
+  CcdCallFnAfter(&LogBuffer::flush_periodically, log_buffer_ptr,
+                 1000.0 * flush_interval);
+}
+
+std::optional<std::string> LogBuffer::file_name_impl() const {
+  if (not file_prefix_.has_value()) {
+    return std::nullopt;
+  }
+  return *file_prefix_ + "Node" + std::to_string(sys::my_node()) + ".log";
+}
+
+void LogBuffer::print(const std::vector<char>& messages) const {
+  std::optional<std::string> file{};
+  {
+    const std::lock_guard lock(mutex_);
+    file = file_name_impl();
+  }
+  if (not file.has_value()) {
+    detail::send_message(false, messages);
+    return;
+  }
+  // Only this node writes to its file, so unlike `Parallel::fprintf` the
+  // messages don't go through the printer chare on node 0. The lock keeps
+  // the threads of this node from writing at the same time.
+  const std::lock_guard lock(mutex_);
+  std::ofstream stream(*file, std::ios::app);
+  if (not stream) {
+    ERROR_NO_TRACE("Could not open '" << *file << "' for writing.\n");
+  }
+  stream << messages.data();
+}
+
+LogBufferChare::LogBufferChare(const std::string& file_prefix,
+                               const size_t capacity) {
+  LogBuffer::local().configure(file_prefix, capacity);
+}
+
+void LogBufferChare::flush() { LogBuffer::local().flush(); }
+
+namespace detail {
+void log_message(const std::string& source, const std::vector<char>& message) {
+  LogBuffer::local().append(source, message, sys::wall_time());
+}
+}  // namespace detail
+}  // namespace Parallel
@@ -0,0 +1,141 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Parallel/Printf/Printf.hpp"
+
+namespace Parallel {
+/*!
+ * \brief Buffer of diagnostic messages on this process that are printed in
+ * batches
+ *
+ * \details `Parallel::printf` sends every message to node 0 and prints it
+ * right away, so high-volume diagnostics (e.g. at `Verbosity::Debug`, where
+ * every element reports every iteration) flood node 0 with messages.
+ * `Parallel::log` appends its messages to this buffer instead. Each message is
+ * prefixed with the wall time and the node it was logged on, and with the
+ * `source` that logged it, e.g. the parallel component or options group.
+ *
+ * When running in a Charm++ executable, the buffer is flushed every
+ * `flush_interval` seconds and when `Parallel::Main` exits. A flush prints all
+ * buffered messages with a single `Parallel::printf` call, or appends them to
+ * the log file of this node (see `set_file_prefix`). Messages that don't fit
+ * into the buffer of `capacity` bytes are dropped, so logging never stalls the
+ * caller. The next flush reports the number of dropped messages.
+ *
+ * Executables set the file prefix and the capacity of the buffers of all nodes
+ * with the `--log-file-prefix` and `--log-buffer-capacity` command-line
+ * options (see `Parallel::LogBufferChare`).
+ *
+ * All member functions are thread-safe.
+ */
+class LogBuffer {
+ public:
+  static constexpr double flush_interval = 5.0;
+  static constexpr size_t default_capacity = 16 * 1024 * 1024;
+
+  LogBuffer() = default;
+  LogBuffer(const LogBuffer&) = delete;
+  LogBuffer& operator=(const LogBuffer&) = delete;
+  LogBuffer(LogBuffer&&) = delete;
+  LogBuffer& operator=(LogBuffer&&) = delete;
+  /// Prints the messages that were logged after the last flush
+  ~LogBuffer();
+
+  /// The buffer of this process
+  static LogBuffer& local();
+
+  /// Appends the `message` logged by the `source` at the `wall_time`. Returns
+  /// `false` if the message was dropped because the buffer is full.
+  bool append(const std::string& source, const std::vector<char>& message,
+              double wall_time);
+
+  /// Takes all buffered messages, followed by a report of the messages
+  /// dropped since the last call, if any. The result is null-terminated, or
+  /// empty if there is nothing to print.
+  std::vector<char> extract();
+
+  /// Prints all buffered messages
+  void flush();
+
+  /// Append the messages to the file `<prefix>Node<N>.log` of this node
+  /// instead of printing them to stdout. Pass `std::nullopt` to print to
+  /// stdout.
+  void set_file_prefix(std::optional<std::string> file_prefix);
+
+  /// The name of the log file of this node, or `std::nullopt` if messages are
+  /// printed to stdout
+  std::optional<std::string> file_name() const;
+
+  void set_capacity(size_t capacity);
+
+  size_t capacity() const;
+
+  /// Set the file prefix and the capacity as given on the command line, where
+  /// an empty `file_prefix` prints the messages to stdout
+  void configure(const std::string& file_prefix, size_t capacity);
+
+  /// The number of bytes in the buffer
+  size_t size() const;
+
+  /// The number of messages dropped since the last flush
+  size_t number_of_dropped_messages() const;
+
+ private:
+  static void flush_periodically(void* log_buffer_ptr,
+                                 double /*current_wall_time*/);
+  std::optional<std::string> file_name_impl() const;
+  void print(const std::vector<char>& messages) const;
+
+  mutable std::mutex mutex_{};
+  std::vector<char> buffer_{};
+  size_t capacity_{default_capacity};
+  size_t number_of_dropped_messages_{0};
+  std::optional<std::string> file_prefix_{};
+  std::once_flag flushing_started_{};
+};
+
+/// Nodegroup that configures and flushes the `LogBuffer` of each node
+class LogBufferChare : public CBase_LogBufferChare {
+ public:
+  /// Configures the `LogBuffer` of this node, see `LogBuffer::configure`
+  LogBufferChare(const std::string& file_prefix, size_t capacity);
+  explicit LogBufferChare(CkMigrateMessage* /*msg*/) {}
+
+  /// Prints all buffered messages of this node
+  void flush();
+};
+
+// Charm readonly variable set in Main.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+extern CProxy_LogBufferChare log_buffer_chare;
+
+namespace detail {
+void log_message(const std::string& source, const std::vector<char>& message);
+}  // namespace detail
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Log a high-volume diagnostic message with C printf usage
+ *
+ * The message is buffered on this process and printed in a batch with
+ * other messages (see `Parallel::LogBuffer`), so it may appear with a delay,
+ * and it is dropped if the buffer is full. Use `Parallel::printf` for
+ * messages that must appear immediately. The `source` identifies the caller
+ * in the output.
+ */
+template <typename... Args>
+inline void log(const std::string& source, const std::string& format,
+                Args&&... args) {
+  detail::log_message(
+      source, detail::format_message(format, std::forward<Args>(args)...));
+}
+}  // namespace Parallel
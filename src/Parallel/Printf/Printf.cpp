@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "Parallel/Printf/LogBuffer.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/ErrorHandling/Strerror.hpp"
 #include "Utilities/System/ParallelInfo.hpp"
@@ -104,6 +105,8 @@ void PrinterChare::register_with_charm() {
 CProxy_PrinterChare printer_chare;
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 bool printer_chare_is_set;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+CProxy_LogBufferChare log_buffer_chare;
 }  // namespace Parallel
 
 #include "Parallel/Printf/Printf.def.h"
@@ -6,6 +6,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <ios>
+#include <iterator>
+#include <numeric>
 #include <optional>
 #include <pup.h>
 #include <set>
@@ -14,6 +16,7 @@
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Options/Auto.hpp"
@@ -225,6 +228,71 @@ bool operator!=(const SingletonPack<tmpl::list<Components...>>& lhs,
   return not(lhs == rhs);
 }
 
+/*!
+ * \ingroup ParallelGroup
+ * \brief Procs that are reserved for singletons
+ *
+ * \details The last `procs_per_node()` procs on each of the `nodes()` are
+ * reserved. No array elements are placed on them, and the singletons whose
+ * proc is chosen automatically are placed on them (see
+ * `Parallel::ResourceInfo`). This keeps expensive singletons, like the CCE
+ * evolution or the horizon finders, from stalling the elements they would
+ * otherwise share a proc with.
+ */
+struct ReservedProcsInfo {
+  struct Nodes {
+    using type = Options::Auto<std::vector<size_t>, Options::AutoLabel::All>;
+    static constexpr Options::String help = {
+        "Nodes on which to reserve procs, or 'All' to reserve procs on every "
+        "node."};
+  };
+
+  struct ProcsPerNode {
+    using type = size_t;
+    static constexpr Options::String help = {
+        "Number of procs to reserve on each of the nodes."};
+    static size_t lower_bound() { return 1; }
+  };
+
+  using options = tmpl::list<Nodes, ProcsPerNode>;
+  static constexpr Options::String help = {
+      "Procs to reserve for singletons. No array elements are placed on these "
+      "procs."};
+
+  ReservedProcsInfo(std::optional<std::vector<size_t>> nodes,
+                    const size_t procs_per_node)
+      : nodes_(std::move(nodes)), procs_per_node_(procs_per_node) {}
+
+  ReservedProcsInfo() = default;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | nodes_;
+    p | procs_per_node_;
+  }
+
+  /// The nodes on which procs are reserved, or `std::nullopt` for all nodes.
+  const std::optional<std::vector<size_t>>& nodes() const { return nodes_; }
+
+  /// The number of procs reserved on each node.
+  size_t procs_per_node() const { return procs_per_node_; }
+
+ private:
+  std::optional<std::vector<size_t>> nodes_{};
+  size_t procs_per_node_{0};
+};
+
+inline bool operator==(const ReservedProcsInfo& lhs,
+                       const ReservedProcsInfo& rhs) {
+  return lhs.nodes() == rhs.nodes() and
+         lhs.procs_per_node() == rhs.procs_per_node();
+}
+
+inline bool operator!=(const ReservedProcsInfo& lhs,
+                       const ReservedProcsInfo& rhs) {
+  return not(lhs == rhs);
+}
+
 namespace detail {
 template <typename Metavariables>
 using singleton_components =
@@ -245,6 +313,8 @@ using singleton_components =
  * \code {.yaml}
  * ResourceInfo:
  *   AvoidGlobalProc0: true
+ *   ReservedProcs: None
+ *   ReportSingletonUtilization: false
  * \endcode
  *
  * If you have singletons, but do not want to assign any of them to a specific
@@ -254,6 +324,8 @@ using singleton_components =
  * \code {.yaml}
  * ResourceInfo:
  *   AvoidGlobalProc0: true
+ *   ReservedProcs: None
+ *   ReportSingletonUtilization: false
  *   Singletons: Auto
  * \endcode
  *
@@ -263,6 +335,8 @@ using singleton_components =
  * \code {.yaml}
  * ResourceInfo:
  *   AvoidGlobalProc0: true
+ *   ReservedProcs: None
+ *   ReportSingletonUtilization: false
  *   Singletons:
  *     MySingleton1:
  *       Proc: 2
@@ -321,6 +395,28 @@ using singleton_components =
  * would distribute this workload. It isn't perfect, but is a significant
  * improvement over placing singletons on one proc after another starting from
  * global proc 0.
+ *
+ * Procs can also be reserved for singletons with the `ReservedProcs` option
+ * (see `Parallel::ReservedProcsInfo`):
+ *
+ * \code {.yaml}
+ * ResourceInfo:
+ *   AvoidGlobalProc0: false
+ *   ReservedProcs:
+ *     Nodes: [0]
+ *     ProcsPerNode: 2
+ *   ReportSingletonUtilization: true
+ *   Singletons: Auto
+ * \endcode
+ *
+ * No array elements are placed on reserved procs. Before steps 2 and 3 above,
+ * the `auto exclusive` singletons are placed on the reserved procs that no
+ * singleton requested, one per proc, and then the `auto nonexclusive`
+ * singletons are distributed round-robin over the remaining reserved procs.
+ * Only the singletons that don't fit on the reserved procs are placed by the
+ * algorithm above, on the procs that aren't reserved. To decide how many procs
+ * to reserve, set `ReportSingletonUtilization: true` so that every singleton
+ * prints at the end of each phase how busy it was during the phase.
  */
 template <typename Metavariables>
 struct ResourceInfo {
@@ -349,10 +445,26 @@ struct ResourceInfo {
         "0."};
   };
 
+  struct ReservedProcs {
+    using type =
+        Options::Auto<Parallel::ReservedProcsInfo, Options::AutoLabel::None>;
+    static constexpr Options::String help = {
+        "Procs to reserve for singletons, or 'None'. No array elements are "
+        "placed on reserved procs, and singletons with automatically chosen "
+        "procs are placed on them."};
+  };
+
+  struct ReportSingletonUtilization {
+    using type = bool;
+    static constexpr Options::String help = {
+        "Whether every singleton prints how busy it was at the end of each "
+        "phase. Use this to decide how many procs to reserve."};
+  };
+
   using options = tmpl::push_front<
       tmpl::conditional_t<tmpl::size<singletons>::value != 0,
                           tmpl::list<Singletons>, tmpl::list<>>,
-      AvoidGlobalProc0>;
+      AvoidGlobalProc0, ReservedProcs, ReportSingletonUtilization>;
 
   static constexpr Options::String help = {
       "Resource options for a simulation. This information will be used when "
@@ -363,13 +475,17 @@ struct ResourceInfo {
   /// this one. This constructor holds all checks able to be done during option
   /// parsing.
   ResourceInfo(const bool avoid_global_proc_0,
+               const std::optional<ReservedProcsInfo>& reserved_procs,
+               bool report_singleton_utilization,
                const std::optional<SingletonPack<singletons>>& singleton_pack,
                const Options::Context& context = {});
 
-  /// This constructor is used when only AvoidGlobalProc0 is specified, but no
-  /// SingletonInfoHolders are specified. Calls the main constructor with an
-  /// empty SingletonPack.
+  /// This constructor is used when only AvoidGlobalProc0, ReservedProcs and
+  /// ReportSingletonUtilization are specified, but no SingletonInfoHolders are
+  /// specified. Calls the main constructor with an empty SingletonPack.
   ResourceInfo(const bool avoid_global_proc_0,
+               const std::optional<ReservedProcsInfo>& reserved_procs,
+               bool report_singleton_utilization,
                const Options::Context& context = {});
 
   ResourceInfo() = default;
@@ -386,6 +502,12 @@ struct ResourceInfo {
   /// the global zeroth proc. Default `false`.
   bool avoid_global_proc_0() const { return avoid_global_proc_0_; }
 
+  /// Returns whether singletons print how busy they were at the end of each
+  /// phase. Default `false`.
+  bool report_singleton_utilization() const {
+    return report_singleton_utilization_;
+  }
+
   /// Return a SingletonInfoHolder corresponding to `Component`
   template <typename Component>
   auto get_singleton_info() const;
@@ -399,6 +521,10 @@ struct ResourceInfo {
   /// elements on, meaning processors that aren't ignored.
   const std::set<size_t>& procs_available_for_elements() const;
 
+  /// Returns the processors reserved for singletons with the `ReservedProcs`
+  /// option. These are also part of `procs_to_ignore()`.
+  const std::set<size_t>& reserved_procs() const;
+
   /// Returns the proc that the singleton `Component` should be placed on.
   template <typename Component>
   size_t proc_for() const;
@@ -433,6 +559,8 @@ struct ResourceInfo {
         "build_singleton_map() before you call this function.");
   }
   bool avoid_global_proc_0_{false};
+  std::optional<ReservedProcsInfo> reserved_procs_info_{};
+  bool report_singleton_utilization_{false};
   bool singleton_map_has_been_set_{false};
   // These are quantities that we will need for placing singletons which can be
   // determined just by option parsing
@@ -444,6 +572,7 @@ struct ResourceInfo {
   // Procs that are exclusive. These may or may not be specifically requested
   std::unordered_set<size_t> procs_to_ignore_{};
   std::set<size_t> procs_available_for_elements_{};
+  std::set<size_t> reserved_procs_{};
   // For each singleton (whether it has a SingletonInfo or not), maps whether
   // it's exclusive and what proc it is on.
   tuples::tagged_tuple_from_typelist<local_tags> singleton_map_{};
@@ -452,9 +581,13 @@ struct ResourceInfo {
 template <typename Metavariables>
 ResourceInfo<Metavariables>::ResourceInfo(
     const bool avoid_global_proc_0,
+    const std::optional<ReservedProcsInfo>& reserved_procs,
+    const bool report_singleton_utilization,
     const std::optional<SingletonPack<singletons>>& opt_singleton_pack,
     const Options::Context& context)
-    : avoid_global_proc_0_(avoid_global_proc_0) {
+    : avoid_global_proc_0_(avoid_global_proc_0),
+      reserved_procs_info_(reserved_procs),
+      report_singleton_utilization_(report_singleton_utilization) {
   if (avoid_global_proc_0_) {
     procs_to_ignore_.insert(0);
     ++num_procs_to_ignore_;
@@ -556,13 +689,18 @@ ResourceInfo<Metavariables>::ResourceInfo(
 }
 
 template <typename Metavariables>
-ResourceInfo<Metavariables>::ResourceInfo(const bool avoid_global_proc_0,
-                                          const Options::Context& context)
-    : ResourceInfo(avoid_global_proc_0, std::nullopt, context) {}
+ResourceInfo<Metavariables>::ResourceInfo(
+    const bool avoid_global_proc_0,
+    const std::optional<ReservedProcsInfo>& reserved_procs,
+    const bool report_singleton_utilization, const Options::Context& context)
+    : ResourceInfo(avoid_global_proc_0, reserved_procs,
+                   report_singleton_utilization, std::nullopt, context) {}
 
 template <typename Metavariables>
 void ResourceInfo<Metavariables>::pup(PUP::er& p) {
   p | avoid_global_proc_0_;
+  p | reserved_procs_info_;
+  p | report_singleton_utilization_;
   p | singleton_map_has_been_set_;
   p | num_exclusive_singletons_;
   p | num_procs_to_ignore_;
@@ -571,6 +709,7 @@ void ResourceInfo<Metavariables>::pup(PUP::er& p) {
   p | requested_nonexclusive_procs_;
   p | procs_to_ignore_;
   p | procs_available_for_elements_;
+  p | reserved_procs_;
   p | singleton_map_;
 }
 
@@ -604,6 +743,14 @@ ResourceInfo<Metavariables>::procs_available_for_elements() const {
   return procs_available_for_elements_;
 }
 
+template <typename Metavariables>
+const std::set<size_t>& ResourceInfo<Metavariables>::reserved_procs() const {
+  if (not singleton_map_has_been_set_) {
+    singleton_map_not_built();
+  }
+  return reserved_procs_;
+}
+
 template <typename Metavariables>
 template <typename Component>
 size_t ResourceInfo<Metavariables>::proc_for() const {
@@ -617,6 +764,9 @@ template <typename Metavars>
 bool operator==(const ResourceInfo<Metavars>& lhs,
                 const ResourceInfo<Metavars>& rhs) {
   return lhs.avoid_global_proc_0_ == rhs.avoid_global_proc_0_ and
+         lhs.reserved_procs_info_ == rhs.reserved_procs_info_ and
+         lhs.report_singleton_utilization_ ==
+             rhs.report_singleton_utilization_ and
          lhs.singleton_map_has_been_set_ == rhs.singleton_map_has_been_set_ and
          lhs.num_exclusive_singletons_ == rhs.num_exclusive_singletons_ and
          lhs.num_procs_to_ignore_ == rhs.num_procs_to_ignore_ and
@@ -629,6 +779,7 @@ bool operator==(const ResourceInfo<Metavars>& lhs,
          lhs.procs_to_ignore_ == rhs.procs_to_ignore_ and
          lhs.procs_available_for_elements_ ==
              rhs.procs_available_for_elements_ and
+         lhs.reserved_procs_ == rhs.reserved_procs_ and
          lhs.singleton_map_ == rhs.singleton_map_;
 }
 
@@ -672,10 +823,73 @@ void ResourceInfo<Metavariables>::build_singleton_map(const Cache& cache) {
     }
   });
 
+  // Reserve the last procs on each of the requested nodes
+  if (reserved_procs_info_.has_value()) {
+    const size_t procs_per_node = reserved_procs_info_->procs_per_node();
+    std::vector<size_t> reserved_nodes(num_nodes);
+    std::iota(reserved_nodes.begin(), reserved_nodes.end(), 0_st);
+    if (reserved_procs_info_->nodes().has_value()) {
+      reserved_nodes = *reserved_procs_info_->nodes();
+    }
+    for (const size_t node : reserved_nodes) {
+      if (node >= num_nodes) {
+        ERROR("Can't reserve procs on node " << node << " because there are "
+                                             << num_nodes << " nodes.");
+      }
+      const size_t first_proc =
+          Parallel::first_proc_on_node<size_t>(node, cache);
+      const size_t procs_on_node = Parallel::procs_on_node<size_t>(node, cache);
+      if (procs_per_node > procs_on_node) {
+        ERROR("Can't reserve " << procs_per_node << " procs on node " << node
+                               << " because it only has " << procs_on_node
+                               << " procs.");
+      }
+      for (size_t proc = first_proc + procs_on_node - procs_per_node;
+           proc < first_proc + procs_on_node; ++proc) {
+        reserved_procs_.insert(proc);
+      }
+    }
+  }
+  // Reserved procs available to auto singletons, i.e. that no singleton
+  // requested and that aren't avoided
+  std::vector<size_t> free_reserved_procs{};
+  std::vector<size_t> reserved_procs_on_each_node(num_nodes, 0_st);
+  for (const size_t proc : reserved_procs_) {
+    if (procs_to_ignore_.find(proc) == procs_to_ignore_.end()) {
+      ++reserved_procs_on_each_node[Parallel::node_of<size_t>(proc, cache)];
+      if (requested_nonexclusive_procs_.count(proc) == 0) {
+        free_reserved_procs.push_back(proc);
+      }
+    }
+  }
+
   // At this point, all requested singletons have been allocated on their
   // desired procs. This leaves just the auto singletons left, both exclusive
   // and non-exclusive.
 
+  // Pin auto exclusive singletons to the free reserved procs, one per proc
+  size_t num_pinned_exclusive_singletons = 0;
+  tmpl::for_each<singletons>([this, &free_reserved_procs,
+                              &num_pinned_exclusive_singletons](
+                                 const auto component_v) {
+    using component = tmpl::type_from<decltype(component_v)>;
+    auto& singleton_map = tuples::get<LocalTag<component>>(singleton_map_);
+    if (singleton_map.first and not singleton_map.second.has_value() and
+        num_pinned_exclusive_singletons < free_reserved_procs.size()) {
+      singleton_map.second =
+          free_reserved_procs[num_pinned_exclusive_singletons];
+      procs_to_ignore_.insert(*singleton_map.second);
+      ++num_pinned_exclusive_singletons;
+    }
+  });
+  // The reserved procs that are left are shared by the auto nonexclusive
+  // singletons
+  const std::vector<size_t> shared_reserved_procs(
+      std::next(free_reserved_procs.begin(),
+                static_cast<std::ptrdiff_t>(num_pinned_exclusive_singletons)),
+      free_reserved_procs.end());
+  procs_to_ignore_.insert(reserved_procs_.begin(), reserved_procs_.end());
+
   // First allocate auto exclusive singletons
   // This first vector will keep track of the total number of singletons on each
   // node so we can spread them out evenly
@@ -700,7 +914,8 @@ void ResourceInfo<Metavariables>::build_singleton_map(const Cache& cache) {
       });
 
   size_t remaining_auto_exclusive_singletons =
-      num_exclusive_singletons_ - num_requested_exclusive_singletons_;
+      num_exclusive_singletons_ - num_requested_exclusive_singletons_ -
+      num_pinned_exclusive_singletons;
   // Start with the min number of singletons on a node as our baseline. Then,
   // while we still have auto exclusive singletons to place, we loop over all
   // nodes and place singletons on nodes with this minimum number. Once all
@@ -719,7 +934,7 @@ void ResourceInfo<Metavariables>::build_singleton_map(const Cache& cache) {
       // haven't exhausted the number of procs on this node. This check is ok
       // right now because we haven't included any nonexclusive singletons in
       // singletons_on_each_node yet.
-      if (not(singletons_on_each_node[i] <
+      if (not(singletons_on_each_node[i] + reserved_procs_on_each_node[i] <
               Parallel::procs_on_node<size_t>(i, cache))) {
         continue;
       }
@@ -788,6 +1003,31 @@ break_auto_exclusive_loops:
       procs_available_for_elements_.insert(i);
     }
   }
+  if (procs_available_for_elements_.empty()) {
+    ERROR(
+        "No cores are left for array elements after reserving "
+        << reserved_procs_.size()
+        << " cores for singletons and placing the exclusive singletons. "
+           "Reserve fewer cores.");
+  }
+
+  // Distribute the auto nonexclusive singletons round-robin over the shared
+  // reserved procs
+  size_t num_pinned_nonexclusive_singletons = 0;
+  if (not shared_reserved_procs.empty()) {
+    tmpl::for_each<singletons>([this, &shared_reserved_procs,
+                                &num_pinned_nonexclusive_singletons](
+                                   const auto component_v) {
+      using component = tmpl::type_from<decltype(component_v)>;
+      auto& singleton_map = tuples::get<LocalTag<component>>(singleton_map_);
+      if (not singleton_map.first and not singleton_map.second.has_value()) {
+        singleton_map.second =
+            shared_reserved_procs[num_pinned_nonexclusive_singletons %
+                                  shared_reserved_procs.size()];
+        ++num_pinned_nonexclusive_singletons;
+      }
+    });
+  }
 
   // At this point, all auto exclusive singletons have been allocated. Now the
   // only singletons left are auto non-exclusive. We use vectors of
@@ -810,13 +1050,18 @@ break_auto_exclusive_loops:
   // Now we add in the requested nonexclusive to the total number of singletons
   // per node
   for (const auto& proc : requested_nonexclusive_procs_) {
-    ++*nonexclusive_singletons_on_each_proc[proc];
+    // Requested procs can be reserved, in which case no auto nonexclusive
+    // singletons are placed there by the algorithm below anyway
+    if (nonexclusive_singletons_on_each_proc[proc].has_value()) {
+      ++*nonexclusive_singletons_on_each_proc[proc];
+    }
     ++singletons_on_each_node[Parallel::node_of<size_t>(proc, cache)];
   }
 
   size_t remaining_auto_nonexclusive_singletons =
       tmpl::size<singletons>::value - num_exclusive_singletons_ -
-      num_requested_nonexclusive_singletons_;
+      num_requested_nonexclusive_singletons_ -
+      num_pinned_nonexclusive_singletons;
 
   // This serves the same purpose as before
   min_num_singletons_on_a_node = *std::min_element(
@@ -904,6 +1149,11 @@ break_auto_nonexclusive_loops:
 
   // Actually allocate the auto nonexclusive singletons
   std::stringstream ss;
+  if (not reserved_procs_.empty()) {
+    using ::operator<<;
+    ss << "\nReserved " << reserved_procs_.size()
+       << " procs for singletons: " << reserved_procs_ << "\n";
+  }
   ss << "\nAllocating Singletons:\n";
   size_t current_proc = 0;
   tmpl::for_each<singletons>([this, &current_proc, &cache, &ss,
@@ -934,7 +1184,9 @@ break_auto_nonexclusive_loops:
     ss << pretty_type::name<component>();
     ss << " on node " << Parallel::node_of<int>(*singleton_map.second, cache);
     ss << ", global proc " << *singleton_map.second;
-    ss << ", exclusive = " << std::boolalpha << singleton_map.first << "\n";
+    ss << ", exclusive = " << std::boolalpha << singleton_map.first;
+    ss << ", reserved = " << (reserved_procs_.count(*singleton_map.second) > 0)
+       << "\n";
   });
 
   ss << "\n";
@@ -13,6 +13,7 @@ template <typename Metavariables>
 struct GlobalCacheProxy;
 template <typename Metavariables>
 struct MetavariablesImpl;
+struct MeasuredCost;
 /// \endcond
 
 /// \brief List of tags for mutable items that are automatically added to
@@ -24,5 +25,5 @@ template <typename Metavariables, typename Index>
 using distributed_object_tags =
     tmpl::list<Tags::MetavariablesImpl<Metavariables>,
                Tags::ArrayIndexImpl<Index>,
-               Tags::GlobalCacheProxy<Metavariables>>;
+               Tags::GlobalCacheProxy<Metavariables>, Tags::MeasuredCost>;
 }  // namespace Parallel::Tags
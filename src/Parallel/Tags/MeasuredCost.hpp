@@ -0,0 +1,19 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Parallel/MeasuredCost.hpp"
+
+namespace Parallel::Tags {
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ParallelGroup
+/// The wall time the element spent executing its actions, see
+/// `Parallel::MeasuredCost`.
+///
+/// This tag is added to the DataBox and updated by the DistributedObject.
+struct MeasuredCost : db::SimpleTag {
+  using type = Parallel::MeasuredCost;
+};
+}  // namespace Parallel::Tags
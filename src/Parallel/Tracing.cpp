@@ -0,0 +1,152 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/Tracing.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Parallel/Phase.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeString.hpp"
+
+namespace Parallel::tracing {
+namespace {
+struct Span {
+  const std::string* name = nullptr;
+  std::chrono::steady_clock::time_point begin{};
+  std::chrono::steady_clock::time_point end{};
+};
+
+// Only the owning thread writes to a buffer. The buffers are never destroyed
+// so that spans recorded by threads that have finished can still be exported.
+struct ThreadBuffer {
+  explicit ThreadBuffer(const size_t id) : thread_id(id) {}
+  size_t thread_id;
+  std::atomic<size_t> number_recorded{0};
+  std::vector<Span> spans = std::vector<Span>(spans_per_thread);
+};
+
+std::mutex thread_buffers_mutex{};
+std::vector<std::unique_ptr<ThreadBuffer>> thread_buffers{};
+const std::chrono::steady_clock::time_point trace_start =
+    std::chrono::steady_clock::now();
+
+ThreadBuffer& this_thread_buffer() {
+  thread_local ThreadBuffer* const buffer = []() {
+    const std::lock_guard lock(thread_buffers_mutex);
+    thread_buffers.push_back(
+        std::make_unique<ThreadBuffer>(thread_buffers.size()));
+    return thread_buffers.back().get();
+  }();
+  return *buffer;
+}
+
+double microseconds_since_start(
+    const std::chrono::steady_clock::time_point time) {
+  return std::chrono::duration<double, std::micro>(time - trace_start).count();
+}
+
+void write_escaped(const gsl::not_null<std::ostringstream*> os,
+                   const std::string& name) {
+  for (const char c : name) {
+    if (c == '"' or c == '\\') {
+      *os << '\\';
+    }
+    *os << c;
+  }
+}
+}  // namespace
+
+void record_span(const std::string& name,
+                 const std::chrono::steady_clock::time_point begin,
+                 const std::chrono::steady_clock::time_point end) {
+  ThreadBuffer& buffer = this_thread_buffer();
+  const size_t index = buffer.number_recorded.load(std::memory_order_relaxed);
+  buffer.spans[index % spans_per_thread] = Span{&name, begin, end};
+  buffer.number_recorded.store(index + 1, std::memory_order_release);
+}
+
+void record_phase(const Parallel::Phase phase,
+                  const double duration_in_seconds) {
+  // The span names must outlive the trace, so keep one string per phase
+  static const std::unordered_map<Parallel::Phase, std::string> phase_names =
+      []() {
+        std::unordered_map<Parallel::Phase, std::string> result{};
+        for (const auto known_phase : Parallel::known_phases()) {
+          result.emplace(known_phase, MakeString{} << "Phase " << known_phase);
+        }
+        return result;
+      }();
+  const auto end = std::chrono::steady_clock::now();
+  record_span(phase_names.at(phase),
+              end - std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::duration<double>(duration_in_seconds)),
+              end);
+}
+
+size_t number_of_spans() {
+  const std::lock_guard lock(thread_buffers_mutex);
+  size_t result = 0;
+  for (const auto& buffer : thread_buffers) {
+    result += std::min(buffer->number_recorded.load(std::memory_order_acquire),
+                       spans_per_thread);
+  }
+  return result;
+}
+
+std::string chrome_trace_json(const int process_id) {
+  std::ostringstream os{};
+  os << std::fixed << std::setprecision(3);
+  os << "{\"traceEvents\":[";
+  bool first_event = true;
+  const std::lock_guard lock(thread_buffers_mutex);
+  for (const auto& buffer : thread_buffers) {
+    const size_t number_recorded =
+        buffer->number_recorded.load(std::memory_order_acquire);
+    const size_t first_span = number_recorded > spans_per_thread
+                                  ? number_recorded - spans_per_thread
+                                  : 0;
+    for (size_t i = first_span; i < number_recorded; ++i) {
+      const Span& span = buffer->spans[i % spans_per_thread];
+      os << (first_event ? "\n" : ",\n") << "{\"name\":\"";
+      write_escaped(make_not_null(&os), *span.name);
+      os << "\",\"ph\":\"X\",\"ts\":" << microseconds_since_start(span.begin)
+         << ",\"dur\":"
+         << std::chrono::duration<double, std::micro>(span.end - span.begin)
+                .count()
+         << ",\"pid\":" << process_id << ",\"tid\":" << buffer->thread_id
+         << "}";
+      first_event = false;
+    }
+  }
+  os << "\n]}\n";
+  return os.str();
+}
+
+void write_chrome_trace(const std::string& filename, const int process_id) {
+  std::ofstream file(filename);
+  if (not file.is_open()) {
+    ERROR("Could not open file '" << filename << "' to write the trace.");
+  }
+  file << chrome_trace_json(process_id);
+}
+
+void clear() {
+  const std::lock_guard lock(thread_buffers_mutex);
+  for (const auto& buffer : thread_buffers) {
+    buffer->number_recorded.store(0, std::memory_order_relaxed);
+  }
+}
+}  // namespace Parallel::tracing
@@ -0,0 +1,134 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Parallel/Phase.hpp"
+#include "Utilities/PrettyType.hpp"
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Lightweight tracing of actions and phases
+ *
+ * \details In builds with `ENABLE_PROFILING` turned on (which defines
+ * `SPECTRE_PROFILING`) the algorithm records the begin and end time of every
+ * iterable action it runs, and accumulates the time spent in each type of
+ * action (see `Parallel::tracing::action_statistics()`). `Main` records every
+ * phase. Each thread records into its own fixed-size ring buffer without
+ * locking, so recording a span costs two clock reads and a few stores. When a
+ * buffer is full the oldest spans are overwritten, so the trace holds the most
+ * recent `Parallel::tracing::spans_per_thread` spans of each thread.
+ *
+ * The recorded spans can be exported in the Chrome trace event format with
+ * `Parallel::tracing::chrome_trace_json()`, which can be loaded into
+ * `chrome://tracing` or [Perfetto](https://ui.perfetto.dev). Exporting reads
+ * the buffers of all threads, so it should only be done while no spans are
+ * recorded, e.g. at the end of a run.
+ */
+namespace Parallel::tracing {
+/// The number of spans each thread keeps in its ring buffer
+constexpr size_t spans_per_thread = 65536;
+
+/// Record a span named `name` that started at `begin` and ended at `end`. The
+/// `name` must outlive the trace, so it is usually a `static` string such as
+/// the ones returned by `Parallel::tracing::span_name()`.
+void record_span(const std::string& name,
+                 std::chrono::steady_clock::time_point begin,
+                 std::chrono::steady_clock::time_point end);
+
+/// The name of the spans recorded for the type `T`, e.g. an action. This is the
+/// full demangled name so that actions differing only in their template
+/// parameters can be told apart.
+template <typename T>
+const std::string& span_name() {
+  static const std::string name = pretty_type::get_name<T>();
+  return name;
+}
+
+/// Record a span for the `phase` that took `duration_in_seconds` and ended now
+void record_phase(Parallel::Phase phase, double duration_in_seconds);
+
+/// Records a span over the lifetime of the object
+class ScopedSpan {
+ public:
+  explicit ScopedSpan(const std::string& name)
+      : name_(name), begin_(std::chrono::steady_clock::now()) {}
+  ScopedSpan(const ScopedSpan&) = delete;
+  ScopedSpan& operator=(const ScopedSpan&) = delete;
+  ScopedSpan(ScopedSpan&&) = delete;
+  ScopedSpan& operator=(ScopedSpan&&) = delete;
+  ~ScopedSpan() {
+    record_span(name_, begin_, std::chrono::steady_clock::now());
+  }
+
+ private:
+  const std::string& name_;
+  std::chrono::steady_clock::time_point begin_;
+};
+
+/// Cumulative statistics of the spans recorded for one type of action in this
+/// process. Unlike the ring buffers, these cover the whole run.
+struct ActionStatistics {
+  std::atomic<uint64_t> calls{0};
+  std::atomic<uint64_t> total_nanoseconds{0};
+  std::atomic<uint64_t> max_nanoseconds{0};
+};
+
+/// The `Parallel::tracing::ActionStatistics` of the action `Action`
+template <typename Action>
+ActionStatistics& action_statistics() {
+  static ActionStatistics statistics{};
+  return statistics;
+}
+
+/// Records a span for the action `Action` over the lifetime of the object and
+/// adds it to the `Parallel::tracing::action_statistics()`
+template <typename Action>
+class ScopedActionSpan {
+ public:
+  ScopedActionSpan() : begin_(std::chrono::steady_clock::now()) {}
+  ScopedActionSpan(const ScopedActionSpan&) = delete;
+  ScopedActionSpan& operator=(const ScopedActionSpan&) = delete;
+  ScopedActionSpan(ScopedActionSpan&&) = delete;
+  ScopedActionSpan& operator=(ScopedActionSpan&&) = delete;
+  ~ScopedActionSpan() {
+    const auto end = std::chrono::steady_clock::now();
+    record_span(span_name<Action>(), begin_, end);
+    const auto nanoseconds = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin_)
+            .count());
+    ActionStatistics& statistics = action_statistics<Action>();
+    statistics.calls.fetch_add(1, std::memory_order_relaxed);
+    statistics.total_nanoseconds.fetch_add(nanoseconds,
+                                           std::memory_order_relaxed);
+    uint64_t max_nanoseconds =
+        statistics.max_nanoseconds.load(std::memory_order_relaxed);
+    while (nanoseconds > max_nanoseconds and
+           not statistics.max_nanoseconds.compare_exchange_weak(
+               max_nanoseconds, nanoseconds, std::memory_order_relaxed)) {
+    }
+  }
+
+ private:
+  std::chrono::steady_clock::time_point begin_;
+};
+
+/// The number of spans currently held by the buffers of all threads
+size_t number_of_spans();
+
+/// The spans recorded in this process in the Chrome trace event format. Each
+/// thread is listed with its own thread ID in the process `process_id`.
+std::string chrome_trace_json(int process_id);
+
+/// Write `chrome_trace_json()` to the file `filename`
+void write_chrome_trace(const std::string& filename, int process_id);
+
+/// Remove the spans recorded by all threads
+void clear();
+}  // namespace Parallel::tracing
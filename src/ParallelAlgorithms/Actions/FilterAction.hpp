@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <optional>
 #include <string>
 #include <tuple>
@@ -18,6 +19,7 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Time/Actions/UpdateU.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
@@ -37,8 +39,7 @@ struct Filter;
 /// \endcond
 
 namespace dg {
-namespace Actions {
-namespace Filter_detail {
+namespace Actions::Filter_detail {
 template <bool SameSize, bool SameList>
 struct FilterAllEvolvedVars {
   template <typename EvolvedVarsTagList, typename... FilterTags>
@@ -58,8 +59,105 @@ struct FilterAllEvolvedVars<true, true> {
   template <typename EvolvedVarsTagList, typename... FilterTags>
   using f = std::integral_constant<bool, true>;
 };
-}  // namespace Filter_detail
 
+template <typename FilterType, typename... TagsToFilter, typename DbTags,
+          typename Metavariables>
+void filter(const gsl::not_null<db::DataBox<DbTags>*> box,
+            const Parallel::GlobalCache<Metavariables>& cache,
+            tmpl::list<TagsToFilter...> /*meta*/) {
+  constexpr size_t volume_dim = Metavariables::system::volume_dim;
+  using evolved_vars_tag = typename Metavariables::system::variables_tag;
+  using evolved_vars_tags_list = typename evolved_vars_tag::tags_list;
+  const FilterType& filter_helper =
+      Parallel::get<::Filters::Tags::Filter<FilterType>>(cache);
+  const size_t block_id =
+      db::get<domain::Tags::Element<volume_dim>>(*box).id().block_id();
+  const auto& domain = Parallel::get<domain::Tags::Domain<volume_dim>>(cache);
+  const auto& block_groups = domain.block_groups();
+  const std::string& block_name = domain.blocks()[block_id].name();
+
+  // Technically this whole next block could be done on a single line, but
+  // then it would be very dense and hard to understand. This way is easier to
+  // read and understand
+  bool enable = filter_helper.enable();
+  // Only do this check if filtering is enabled. A `nullopt` means all blocks
+  // are allowed to do filtering
+  if (enable and filter_helper.blocks_to_filter().has_value()) {
+    // Enable filtering for this block if it's in any of the listed groups
+    enable = alg::any_of(
+        filter_helper.blocks_to_filter().value(),
+        [&block_name, &block_groups](const std::string& block_to_filter) {
+          return domain::block_is_in_group(block_name, block_to_filter,
+                                           block_groups);
+        });
+  }
+
+  const Mesh<volume_dim> mesh = db::get<domain::Tags::Mesh<volume_dim>>(*box);
+  if (not enable or filter_helper.is_identity(mesh)) {
+    return;
+  }
+
+  // Dimensions in which the filter is the identity hold an empty matrix and
+  // are skipped by `apply_matrices`
+  const std::array<std::reference_wrapper<const Matrix>, volume_dim> filter =
+      filter_helper.filter_matrices(mesh);
+
+  // In the case that the tags we are filtering are all the evolved variables
+  // we filter the entire Variables at once to be more efficient. This case is
+  // the first branch of the `if-else`.
+  if (FilterAllEvolvedVars<
+          sizeof...(TagsToFilter) == tmpl::size<evolved_vars_tags_list>::value,
+          std::is_same_v<evolved_vars_tags_list, tmpl::list<TagsToFilter...>>>::
+          template f<evolved_vars_tags_list, TagsToFilter...>::value) {
+    db::mutate<evolved_vars_tag>(
+        [&filter](const gsl::not_null<typename evolved_vars_tag::type*> vars,
+                  const auto& local_mesh) {
+          *vars = apply_matrices(filter, *vars, local_mesh.extents());
+        },
+        box, mesh);
+  } else {
+    db::mutate<TagsToFilter...>(
+        [](const gsl::not_null<
+               typename TagsToFilter::type*>... tensors_to_filter,
+           const Mesh<volume_dim>& local_mesh,
+           const std::array<std::reference_wrapper<const Matrix>, volume_dim>&
+               local_filter) {
+          DataVector temp(local_mesh.number_of_grid_points(), 0.0);
+          const auto helper = [&local_mesh, &local_filter,
+                               &temp](const auto tensor) {
+            for (auto& component : *tensor) {
+              temp = 0.0;
+              apply_matrices(make_not_null(&temp), local_filter, component,
+                             local_mesh.extents());
+              component = temp;
+            }
+          };
+          EXPAND_PACK_LEFT_TO_RIGHT(helper(tensors_to_filter));
+        },
+        box, mesh, filter);
+  }
+}
+}  // namespace Actions::Filter_detail
+
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Apply the filter `FilterType` to the tags in `TagsToFilterList`.
+ *
+ * Nothing is done if the filter is disabled in the block of the element or is
+ * the identity on its mesh, e.g. because `Alpha` is zero.
+ *
+ * \note This is a free function version of `dg::Actions::Filter`. This free
+ * function alternative permits applying the filter in the middle of another
+ * action, see `dg::Actions::UpdateUAndFilter`.
+ */
+template <typename FilterType, typename TagsToFilterList, typename DbTags,
+          typename Metavariables>
+void filter(const gsl::not_null<db::DataBox<DbTags>*> box,
+            const Parallel::GlobalCache<Metavariables>& cache) {
+  Actions::Filter_detail::filter<FilterType>(box, cache, TagsToFilterList{});
+}
+
+namespace Actions {
 /// \cond
 template <typename FilterType, typename TagsToFilterList>
 struct Filter;
@@ -105,84 +203,51 @@ class Filter<FilterType, tmpl::list<TagsToFilter...>> {
       const Parallel::GlobalCache<Metavariables>& cache,
       const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
-    constexpr size_t volume_dim = Metavariables::system::volume_dim;
-    using evolved_vars_tag = typename Metavariables::system::variables_tag;
-    using evolved_vars_tags_list = typename evolved_vars_tag::tags_list;
-    const FilterType& filter_helper =
-        Parallel::get<::Filters::Tags::Filter<FilterType>>(cache);
-    const size_t block_id =
-        db::get<domain::Tags::Element<volume_dim>>(box).id().block_id();
-    const auto& domain = Parallel::get<domain::Tags::Domain<volume_dim>>(cache);
-    const auto& block_groups = domain.block_groups();
-    const std::string& block_name = domain.blocks()[block_id].name();
-
-    // Technically this whole next block could be done on a single line, but
-    // then it would be very dense and hard to understand. This way is easier to
-    // read and understand
-    bool enable = filter_helper.enable();
-    // Only do this check if filtering is enabled. A `nullopt` means all blocks
-    // are allowed to do filtering
-    if (enable and filter_helper.blocks_to_filter().has_value()) {
-      // Enable filtering for this block if it's in any of the listed groups
-      enable = alg::any_of(
-          filter_helper.blocks_to_filter().value(),
-          [&block_name, &block_groups](const std::string& block_to_filter) {
-            return domain::block_is_in_group(block_name, block_to_filter,
-                                             block_groups);
-          });
-    }
-
-    if (not enable) {
-      return {Parallel::AlgorithmExecution::Continue, std::nullopt};
-    }
-
-    const Mesh<volume_dim> mesh = db::get<domain::Tags::Mesh<volume_dim>>(box);
-    const Matrix empty{};
-    std::array<std::reference_wrapper<const Matrix>, volume_dim> filter =
-        make_array<volume_dim>(std::cref(empty));
-    for (size_t d = 0; d < volume_dim; d++) {
-      gsl::at(filter, d) =
-          std::cref(filter_helper.filter_matrix(mesh.slice_through(d)));
-    }
-
-    // In the case that the tags we are filtering are all the evolved variables
-    // we filter the entire Variables at once to be more efficient. This case is
-    // the first branch of the `if-else`.
-    if (Filter_detail::FilterAllEvolvedVars<
-            sizeof...(TagsToFilter) ==
-                tmpl::size<evolved_vars_tags_list>::value,
-            std::is_same_v<evolved_vars_tags_list,
-                           tmpl::list<TagsToFilter...>>>::
-            template f<evolved_vars_tags_list, TagsToFilter...>::value) {
-      db::mutate<typename Metavariables::system::variables_tag>(
-          [&filter](const gsl::not_null<
-                        typename Metavariables::system::variables_tag::type*>
-                        vars,
-                    const auto& local_mesh) {
-            *vars = apply_matrices(filter, *vars, local_mesh.extents());
-          },
-          make_not_null(&box), mesh);
-    } else {
-      db::mutate<TagsToFilter...>(
-          [](const gsl::not_null<
-                 typename TagsToFilter::type*>... tensors_to_filter,
-             const Mesh<volume_dim>& local_mesh,
-             const std::array<std::reference_wrapper<const Matrix>, volume_dim>&
-                 local_filter) {
-            DataVector temp(local_mesh.number_of_grid_points(), 0.0);
-            const auto helper = [&local_mesh, &local_filter,
-                                 &temp](const auto tensor) {
-              for (auto& component : *tensor) {
-                temp = 0.0;
-                apply_matrices(make_not_null(&temp), local_filter, component,
-                               local_mesh.extents());
-                component = temp;
-              }
-            };
-            EXPAND_PACK_LEFT_TO_RIGHT(helper(tensors_to_filter));
-          },
-          make_not_null(&box), mesh, filter);
-    }
+    dg::filter<FilterType, tmpl::list<TagsToFilter...>>(make_not_null(&box),
+                                                        cache);
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Perform the variable updates for one substep, then apply a filter to
+ * the specified tags.
+ *
+ * This is equivalent to `Actions::UpdateU` followed by `dg::Actions::Filter`,
+ * but filters the variables while they are still in cache from the update
+ * instead of sweeping over the full state again in a separate action. The
+ * filter is applied even if the step does not update the variables, exactly
+ * like the separate `dg::Actions::Filter`.
+ *
+ * Uses:
+ * - GlobalCache:
+ *   - `Filter`
+ * - DataBox:
+ *   - Everything `Actions::UpdateU` uses
+ *   - `Tags::Mesh`
+ * - DataBox changes:
+ *   - Adds: nothing
+ *   - Removes: nothing
+ *   - Modifies:
+ *     - `system::variables_tag`
+ */
+template <typename System, typename FilterType, typename TagsToFilterList>
+struct UpdateUAndFilter {
+  using const_global_cache_tags =
+      tmpl::list<::Filters::Tags::Filter<FilterType>>;
+
+  template <typename DbTags, typename... InboxTags, typename ArrayIndex,
+            typename ActionList, typename ParallelComponent,
+            typename Metavariables>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    ::update_u<System>(make_not_null(&box));
+    dg::filter<FilterType, TagsToFilterList>(make_not_null(&box), cache);
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
@@ -0,0 +1,114 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/MemoryMonitor/MemoryMonitor.hpp"
+#include "Parallel/MemoryMonitor/Tags.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace mem_monitor {
+/*!
+ * \brief Simple action meant to be run on the MemoryMonitor component that
+ * collects the number of bytes of scratch memory each node served from its
+ * `ScratchArena`s and from the heap.
+ *
+ * \details Each node sends the bytes requested since the previous observation.
+ * Once every node has reported, a row is written to disk. The columns in the
+ * dat file when running on 2 nodes will be
+ *
+ * - %Time
+ * - Arena on node 0 (MB)
+ * - Heap on node 0 (MB)
+ * - Arena on node 1 (MB)
+ * - Heap on node 1 (MB)
+ * - Fraction from arena
+ *
+ * The dat file is `/MemoryMonitors/ScratchArena` in the reduction file.
+ */
+struct ContributeScratchArenaData {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex>
+  static void apply(db::DataBox<DbTags>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/, const double time,
+                    const int node, const double arena_megabytes,
+                    const double heap_megabytes) {
+    db::mutate<Tags::MemoryHolder>(
+        [&cache, &time, &node, &arena_megabytes, &heap_megabytes](
+            const gsl::not_null<std::unordered_map<
+                std::string,
+                std::unordered_map<double, std::unordered_map<int, double>>>*>
+                memory_holder_all) {
+          auto& arena_holder = (*memory_holder_all)["ScratchArena/Arena"];
+          auto& heap_holder = (*memory_holder_all)["ScratchArena/Heap"];
+          arena_holder[time][node] = arena_megabytes;
+          heap_holder[time][node] = heap_megabytes;
+
+          auto& mem_monitor_proxy =
+              Parallel::get_parallel_component<MemoryMonitor<Metavariables>>(
+                  cache);
+          const size_t num_nodes = Parallel::number_of_nodes<size_t>(
+              *Parallel::local(mem_monitor_proxy));
+          ASSERT(arena_holder.at(time).size() <= num_nodes,
+                 "ContributeScratchArenaData received more data than it was "
+                 "expecting. Was expecting "
+                     << num_nodes << " calls but instead got "
+                     << arena_holder.at(time).size());
+          if (arena_holder.at(time).size() != num_nodes) {
+            return;
+          }
+
+          std::vector<double> data_to_append{time};
+          std::vector<std::string> legend{{"Time"}};
+          double total_arena = 0.0;
+          double total_heap = 0.0;
+          for (size_t node_index = 0; node_index < num_nodes; ++node_index) {
+            const int node_number = static_cast<int>(node_index);
+            const double arena = arena_holder.at(time).at(node_number);
+            const double heap = heap_holder.at(time).at(node_number);
+            data_to_append.push_back(arena);
+            data_to_append.push_back(heap);
+            legend.emplace_back("Arena on node " + get_output(node_index) +
+                                " (MB)");
+            legend.emplace_back("Heap on node " + get_output(node_index) +
+                                " (MB)");
+            total_arena += arena;
+            total_heap += heap;
+          }
+          data_to_append.push_back(
+              total_arena + total_heap > 0.0
+                  ? total_arena / (total_arena + total_heap)
+                  : 0.0);
+          legend.emplace_back("Fraction from arena");
+
+          auto& observer_writer_proxy = Parallel::get_parallel_component<
+              observers::ObserverWriter<Metavariables>>(cache);
+          Parallel::threaded_action<
+              observers::ThreadedActions::WriteReductionDataRow>(
+              // Node 0 is always the writer
+              observer_writer_proxy[0],
+              std::string{"/MemoryMonitors/ScratchArena"}, legend,
+              std::make_tuple(data_to_append));
+
+          arena_holder.erase(time);
+          heap_holder.erase(time);
+        },
+        make_not_null(&box));
+  }
+};
+}  // namespace mem_monitor
@@ -0,0 +1,79 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/MemoryMonitor/Tags.hpp"
+
+namespace mem_monitor {
+/*!
+ * \brief Simple action meant to be used as a callback for
+ * Parallel::contribute_to_reduction that writes the size of each item in the
+ * DataBoxes of an Array parallel component to disk.
+ *
+ * \details The `item_sizes` are the number of bytes of each item (as returned
+ * by `db::DataBox::size_of_items()`) summed over all elements. The columns in
+ * the dat file are
+ *
+ * - %Time
+ * - `{Item} (MB)` for every item, sorted by the name of the item
+ * - Largest item (MB)
+ * - Total (MB)
+ *
+ * so the items that dominate the memory usage can be found by sorting the
+ * columns of a row. The dat file is the `mem_monitor::subfile_name()` of the
+ * component followed by `DataBox`, e.g.
+ * `/MemoryMonitors/DgElementArrayDataBox`.
+ */
+template <typename ArrayComponent>
+struct ProcessDataBox {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex>
+  static void apply(db::DataBox<DbTags>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/, const double time,
+                    const std::map<std::string, size_t>& item_sizes) {
+    auto& observer_writer_proxy = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+
+    std::vector<std::string> legend{};
+    legend.reserve(item_sizes.size() + 3);
+    legend.emplace_back("Time");
+    std::vector<double> columns{};
+    columns.reserve(item_sizes.size() + 3);
+    columns.emplace_back(time);
+    double largest_size = 0.0;
+    double total_size = 0.0;
+    for (const auto& [name, size_in_bytes] : item_sizes) {
+      const double size_in_megabytes =
+          static_cast<double>(size_in_bytes) / 1.0e6;
+      legend.emplace_back(name + " (MB)");
+      columns.emplace_back(size_in_megabytes);
+      largest_size = std::max(largest_size, size_in_megabytes);
+      total_size += size_in_megabytes;
+    }
+    legend.emplace_back("Largest item (MB)");
+    columns.emplace_back(largest_size);
+    legend.emplace_back("Total (MB)");
+    columns.emplace_back(total_size);
+
+    Parallel::threaded_action<
+        observers::ThreadedActions::WriteReductionDataRow>(
+        // Node 0 is always the writer
+        observer_writer_proxy[0], subfile_name<ArrayComponent>() + "DataBox",
+        legend, std::make_tuple(columns));
+  }
+};
+}  // namespace mem_monitor
@@ -26,7 +26,9 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "Parallel/Tags/DistributedObjectTags.hpp"
@@ -38,7 +40,6 @@
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
-#include "Utilities/Literals.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/TMPL.hpp"
@@ -157,9 +158,10 @@ struct AdjustDomain {
           Parallel::printf("Splitting element %s into %zu: %s\n", element_id,
                            children_ids.size(), children_ids);
         }
-        Parallel::simple_action<CreateChild>(amr_component, element_array,
-                                             element_id, children_ids, 0_st,
-                                             phase_bookmarks);
+        Parallel::simple_action<CreateChild>(
+            amr_component, element_array, element_id, children_ids,
+            Parallel::my_proc<int>(*Parallel::local(element_array[element_id])),
+            phase_bookmarks);
 
       } else if (alg::any_of(my_amr_flags, [](amr::Flag flag) {
                    return flag == amr::Flag::Join;
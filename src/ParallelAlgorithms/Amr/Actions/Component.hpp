@@ -7,11 +7,15 @@
 #include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/ArrayCollection/SimpleActionOnElement.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
+#include "ParallelAlgorithms/Actions/InitializeItems.hpp"
 #include "ParallelAlgorithms/Amr/Actions/AdjustDomain.hpp"
 #include "ParallelAlgorithms/Amr/Actions/EvaluateRefinementCriteria.hpp"
+#include "ParallelAlgorithms/Amr/Actions/Initialize.hpp"
+#include "ParallelAlgorithms/Amr/Actions/RecordPhaseStartTime.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Tags/Criteria.hpp"
 #include "ParallelAlgorithms/Amr/Policies/Tags.hpp"
 #include "Utilities/TMPL.hpp"
@@ -26,6 +30,10 @@ namespace amr {
 ///   on global processor 0.
 /// - As a reduction target to perform sanity checks after AMR, output
 ///   AMR diagnostics, or determine when to trigger AMR.
+///
+/// The component records when each of the AMR phases starts (see
+/// amr::Actions::RecordPhaseStartTime), so amr::Actions::RunAmrDiagnostics can
+/// observe how long they took.
 template <class Metavariables>
 struct Component {
   using metavariables = Metavariables;
@@ -36,8 +44,11 @@ struct Component {
       tmpl::list<amr::Criteria::Tags::Criteria, amr::Tags::Policies,
                  logging::Tags::Verbosity<amr::OptionTags::AmrGroup>>;
 
-  using phase_dependent_action_list = tmpl::list<
-      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<
+          Parallel::Phase::Initialization,
+          tmpl::list<::Initialization::Actions::InitializeItems<
+              amr::Initialization::InitializeComponent>>>>;
 
   using simple_tags_from_options = Parallel::get_simple_tags_from_options<
       Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
@@ -46,8 +57,15 @@ struct Component {
       const Parallel::Phase next_phase,
       Parallel::CProxy_GlobalCache<Metavariables>& global_cache_proxy) {
     auto& local_cache = *Parallel::local_branch(global_cache_proxy);
-    Parallel::get_parallel_component<Component>(local_cache)
-        .start_phase(next_phase);
+    auto& amr_component =
+        Parallel::get_parallel_component<Component>(local_cache);
+    amr_component.start_phase(next_phase);
+    if (Parallel::Phase::EvaluateAmrCriteria == next_phase or
+        Parallel::Phase::AdjustDomain == next_phase or
+        Parallel::Phase::CheckDomain == next_phase) {
+      Parallel::simple_action<::amr::Actions::RecordPhaseStartTime>(
+          amr_component, next_phase);
+    }
     if (Parallel::Phase::EvaluateAmrCriteria == next_phase) {
       if constexpr (Parallel::is_dg_element_collection_v<
                         typename metavariables::amr::element_array>) {
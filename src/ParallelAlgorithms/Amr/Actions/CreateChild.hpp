@@ -1,12 +1,12 @@
-
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
 #pragma once
 
 #include <charm++.h>
-#include <iterator>
+#include <cstddef>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -14,7 +14,6 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Phase.hpp"
 #include "ParallelAlgorithms/Amr/Actions/SendDataToChildren.hpp"
-#include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 
 /// \cond
@@ -25,17 +24,20 @@ class DataBox;
 /// \endcond
 
 namespace amr::Actions {
-/// \brief Creates a new element in an ArrayAlgorithm whose id is `child_id`
+/// \brief Creates the new elements in an ArrayAlgorithm whose ids are
+/// `children_ids`
 ///
-/// \details This action is meant to be initially invoked by
-/// amr::Actions::AdjustDomain on the amr::Component.  This action inserts a new
-/// element with id `children_ids[index_of_child_id]` in the array referenced by
-/// `element_proxy`.  A Parallel::SimpleActionCallback is passed to the
-/// constructor of the new DistributedObject.  If `index_of_child_id` is that of
-/// the last element of `children_ids`, the Parallel::SimpleActionCallback will
-/// invoke amr::Actions::SendDataToChildren on the element with id `parent_id`.
-/// Otherwise, it will invoke amr::Actions::CreateChild on the next element of
-/// `children_ids`.
+/// \details This action is meant to be invoked by amr::Actions::AdjustDomain on
+/// the amr::Component.  This action inserts all elements with ids
+/// `children_ids` in the array referenced by `element_proxy` at once, on the
+/// processor `parent_proc` of the parent element, so the children can receive
+/// the data of the parent without a message (see
+/// amr::Actions::SendDataToChildren).  A Parallel::Callback is passed to the
+/// constructor of each new DistributedObject.  The callback of the last child
+/// in `children_ids` invokes amr::Actions::SendDataToChildren on the element
+/// with id `parent_id`.  The callbacks of the other children only invoke
+/// `perform_algorithm` on the amr::Component, which has no actions to perform
+/// while the domain is adjusted.
 ///
 /// This action does not modify anything in the DataBox
 struct CreateChild {
@@ -47,34 +49,31 @@ struct CreateChild {
       ElementProxy element_proxy,
       ElementId<Metavariables::volume_dim> parent_id,
       std::vector<ElementId<Metavariables::volume_dim>> children_ids,
-      const size_t index_of_child_id,
+      const int parent_proc,
       const std::unordered_map<Parallel::Phase, size_t>
           parent_phase_bookmarks) {
+    ASSERT(not children_ids.empty(),
+           "Element " << parent_id << " has no children to create.");
     auto my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
-    const ElementId<Metavariables::volume_dim>& child_id =
-        children_ids[index_of_child_id];
-    if (index_of_child_id + 1 == children_ids.size()) {
-      auto parent_proxy = element_proxy[parent_id];
-      element_proxy[child_id].insert(
-          cache.get_this_proxy(), Parallel::Phase::AdjustDomain,
-          parent_phase_bookmarks,
-          std::make_unique<Parallel::SimpleActionCallback<
-              SendDataToChildren, decltype(parent_proxy),
-              std::vector<ElementId<Metavariables::volume_dim>>>>(
-              parent_proxy, std::move(children_ids)));
-    } else {
-      element_proxy[child_id].insert(
+    for (size_t i = 0; i + 1 < children_ids.size(); ++i) {
+      element_proxy[children_ids[i]].insert(
           cache.get_this_proxy(), Parallel::Phase::AdjustDomain,
           parent_phase_bookmarks,
-          std::make_unique<Parallel::SimpleActionCallback<
-              CreateChild, decltype(my_proxy), ElementProxy,
-              ElementId<Metavariables::volume_dim>,
-              std::vector<ElementId<Metavariables::volume_dim>>, size_t,
-              std::unordered_map<Parallel::Phase, size_t>>>(
-              my_proxy, std::move(element_proxy), std::move(parent_id),
-              std::move(children_ids), index_of_child_id + 1,
-              parent_phase_bookmarks));
+          std::make_unique<
+              Parallel::PerformAlgorithmCallback<decltype(my_proxy)>>(my_proxy),
+          parent_proc);
     }
+    auto parent_proxy = element_proxy[parent_id];
+    const ElementId<Metavariables::volume_dim> last_child_id =
+        children_ids.back();
+    element_proxy[last_child_id].insert(
+        cache.get_this_proxy(), Parallel::Phase::AdjustDomain,
+        parent_phase_bookmarks,
+        std::make_unique<Parallel::SimpleActionCallback<
+            SendDataToChildren, decltype(parent_proxy),
+            std::vector<ElementId<Metavariables::volume_dim>>>>(
+            parent_proxy, std::move(children_ids)),
+        parent_proc);
   }
 };
 }  // namespace amr::Actions
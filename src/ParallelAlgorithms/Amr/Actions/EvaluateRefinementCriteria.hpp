@@ -72,7 +72,8 @@ namespace amr::Actions {
 /// \details
 /// - Evaluates each refinement criteria held by amr::Criteria::Tags::Criteria,
 ///   and in each dimension selects the amr::Flag with the highest
-///   priority (i.e the highest integral value).
+///   priority (i.e the highest integral value). The remaining criteria are not
+///   evaluated once all dimensions are flagged to split.
 /// - If necessary, changes the refinement decision in order to satisfy the
 ///   amr::Policies
 /// - An Element that is splitting in one dimension is not allowed to join
@@ -101,6 +102,12 @@ struct EvaluateRefinementCriteria {
     const auto& refinement_criteria =
         db::get<amr::Criteria::Tags::Criteria>(box);
     for (const auto& criterion : refinement_criteria) {
+      // No criterion can override a split, so skip evaluating the remaining
+      // criteria (which can be expensive, e.g. modal transforms of all
+      // monitored tensors) once every dimension is splitting
+      if (overall_decision == make_array<volume_dim>(amr::Flag::Split)) {
+        break;
+      }
       auto decision = criterion->evaluate(observation_box, cache, element_id);
       for (size_t d = 0; d < volume_dim; ++d) {
         overall_decision[d] = std::max(overall_decision[d], decision[d]);
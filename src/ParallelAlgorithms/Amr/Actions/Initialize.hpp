@@ -5,11 +5,14 @@
 
 #include <array>
 #include <cstddef>
+#include <unordered_map>
 
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Amr/Info.hpp"
 #include "Domain/Amr/Tags/Flags.hpp"
 #include "Domain/Amr/Tags/NeighborFlags.hpp"
+#include "Parallel/Phase.hpp"
+#include "ParallelAlgorithms/Amr/Tags.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
@@ -38,4 +41,27 @@ struct Initialize {
     amr_info->flags = make_array<Dim>(amr::Flag::Undefined);
   }
 };
+
+/// \ingroup InitializationGroup
+/// \brief Initialize the items of amr::Component
+///
+/// \see InitializeItems
+struct InitializeComponent {
+  using const_global_cache_tags = tmpl::list<>;
+  using mutable_global_cache_tags = tmpl::list<>;
+  using simple_tags_from_options = tmpl::list<>;
+
+  using argument_tags = tmpl::list<>;
+  using return_tags = tmpl::list<amr::Tags::PhaseStartTimes>;
+  using simple_tags = return_tags;
+
+  using compute_tags = tmpl::list<>;
+
+  /// No AMR phase has started yet
+  static void apply(
+      const gsl::not_null<std::unordered_map<Parallel::Phase, double>*>
+          phase_start_times) {
+    phase_start_times->clear();
+  }
+};
 }  // namespace amr::Initialization
@@ -10,6 +10,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Helpers.hpp"
 #include "Domain/Amr/NeighborsOfChild.hpp"
 #include "Domain/Amr/Tags/Flags.hpp"
 #include "Domain/Amr/Tags/NeighborFlags.hpp"
@@ -22,6 +23,8 @@
 #include "Domain/Tags/NeighborMesh.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/ElementRegistration.hpp"
+#include "Parallel/MeasuredCost.hpp"
+#include "Parallel/Tags/MeasuredCost.hpp"
 #include "ParallelAlgorithms/Amr/Projectors/Mesh.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Utilities/Gsl.hpp"
@@ -43,10 +46,16 @@ namespace amr::Actions {
 /// - Modifies:
 ///   * domain::Tags::Element<volume_dim>
 ///   * domain::Tags::Mesh<volume_dim>
+///   * Parallel::Tags::MeasuredCost (if sent by the parent)
 ///   * all return_tags of Metavariables::amr::projectors
 ///
 /// \details This action is meant to be invoked by
 /// amr::Actions::SendDataToChildren
+///
+/// The children share the work of their parent, so each child starts with an
+/// equal share of the parent's Parallel::MeasuredCost (see
+/// Parallel::MeasuredCost::split). This way a load balancing right after AMR
+/// sees the cost measured before the AMR change instead of no cost at all.
 struct InitializeChild {
   template <typename ParallelComponent, typename DbTagList,
             typename Metavariables, typename... Tags>
@@ -76,6 +85,15 @@ struct InitializeChild {
         ::domain::Tags::NeighborMesh<volume_dim>>>(
         make_not_null(&box), std::move(child), std::move(child_mesh),
         std::move(neighbors.second));
+    if constexpr (tmpl::list_contains_v<tmpl::list<Tags...>,
+                                        Parallel::Tags::MeasuredCost>) {
+      ::Initialization::mutate_assign<
+          tmpl::list<Parallel::Tags::MeasuredCost>>(
+          make_not_null(&box),
+          tuples::get<Parallel::Tags::MeasuredCost>(parent_items)
+              .split(amr::ids_of_children(parent.id(), parent_info.flags)
+                         .size()));
+    }
 
     tmpl::for_each<typename Metavariables::amr::projectors>(
         [&box, &parent_items](auto projector_v) {
@@ -24,6 +24,8 @@
 #include "Domain/Tags/NeighborMesh.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/ElementRegistration.hpp"
+#include "Parallel/MeasuredCost.hpp"
+#include "Parallel/Tags/MeasuredCost.hpp"
 #include "ParallelAlgorithms/Amr/Projectors/Mesh.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Utilities/Gsl.hpp"
@@ -45,10 +47,14 @@ namespace amr::Actions {
 /// - Modifies:
 ///   * domain::Tags::Element<volume_dim>
 ///   * domain::Tags::Mesh<volume_dim>
+///   * Parallel::Tags::MeasuredCost (if in the DataBox)
 ///   * all return_tags of Metavariables::amr::projectors
 ///
 /// \details This action is meant to be invoked by
 /// amr::Actions::CollectDataFromChildren
+///
+/// The parent takes over the work of its children, so it starts with the sum
+/// of their Parallel::MeasuredCost (see Parallel::MeasuredCost::join).
 struct InitializeParent {
   template <typename ParallelComponent, typename DbTagList,
             typename Metavariables>
@@ -94,6 +100,19 @@ struct InitializeParent {
         ::domain::Tags::NeighborMesh<volume_dim>>>(
         make_not_null(&box), std::move(parent), std::move(parent_mesh),
         std::move(parent_neighbors.second));
+    using mutable_tags =
+        typename db::DataBox<DbTagList>::mutable_item_creation_tags;
+    if constexpr (tmpl::list_contains_v<mutable_tags,
+                                        Parallel::Tags::MeasuredCost>) {
+      Parallel::MeasuredCost parent_cost{};
+      for (const auto& [_, child_items] : children_items) {
+        parent_cost.join(
+            tuples::get<Parallel::Tags::MeasuredCost>(child_items));
+      }
+      ::Initialization::mutate_assign<
+          tmpl::list<Parallel::Tags::MeasuredCost>>(make_not_null(&box),
+                                                    std::move(parent_cost));
+    }
 
     tmpl::for_each<typename Metavariables::amr::projectors>(
         [&box, &children_items](auto projector_v) {
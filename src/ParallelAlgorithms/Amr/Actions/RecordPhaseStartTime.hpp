@@ -0,0 +1,47 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <unordered_map>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Parallel/Phase.hpp"
+#include "ParallelAlgorithms/Amr/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+/// \endcond
+
+namespace amr::Actions {
+/// \brief Records the wall time at which the `phase` started
+///
+/// DataBox:
+/// - Modifies:
+///   * amr::Tags::PhaseStartTimes
+///
+/// \details This action is meant to be invoked on the amr::Component when one
+/// of the AMR phases starts.  amr::Actions::RunAmrDiagnostics uses the
+/// recorded times to observe how long the AMR phases took.
+struct RecordPhaseStartTime {
+  template <typename ParallelComponent, typename DbTagList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagList>& box,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const Parallel::Phase phase) {
+    db::mutate<amr::Tags::PhaseStartTimes>(
+        [&phase](const gsl::not_null<
+                 std::unordered_map<Parallel::Phase, double>*>
+                     phase_start_times) {
+          (*phase_start_times)[phase] = sys::wall_time();
+        },
+        make_not_null(&box));
+  }
+};
+}  // namespace amr::Actions
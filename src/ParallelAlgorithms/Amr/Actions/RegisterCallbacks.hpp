@@ -21,12 +21,8 @@ void register_callbacks() {
   using ArrayIndex = typename Component::array_index;
   register_classes_with_charm(
       tmpl::list<
-          Parallel::SimpleActionCallback<
-              amr::Actions::CreateChild,
-              CProxy_AlgorithmSingleton<amr::Component<Metavariables>, int>,
-              CProxy_AlgorithmArray<Component, ArrayIndex>, ArrayIndex,
-              std::vector<ArrayIndex>, size_t,
-              std::unordered_map<Parallel::Phase, size_t>>,
+          Parallel::PerformAlgorithmCallback<
+              CProxy_AlgorithmSingleton<amr::Component<Metavariables>, int>>,
           Parallel::SimpleActionCallback<
               amr::Actions::SendDataToChildren,
               CProxyElement_AlgorithmArray<Component, ArrayIndex>,
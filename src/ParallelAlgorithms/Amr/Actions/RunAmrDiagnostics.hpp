@@ -6,23 +6,26 @@
 #include <boost/rational.hpp>
 #include <cstddef>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "IO/Logging/Tags.hpp"
 #include "IO/Logging/Verbosity.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Phase.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "ParallelAlgorithms/Amr/Tags.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/StdHelpers.hpp"
 #include "Utilities/System/Abort.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
-namespace Parallel {
-template <typename Metavariables>
-class GlobalCache;
-}  // namespace Parallel
 namespace domain::Tags {
 template <size_t VolumeDim>
 struct Domain;
@@ -43,6 +46,12 @@ namespace amr::Actions {
 /// - The average refinement level by logical dimension (i.e. not by the
 ///   physical dimensions)
 /// - The average number of grid points by logical dimension
+///
+/// After AMR has adjusted the domain, the wall time the amr::Component spent
+/// in Parallel::Phase::EvaluateAmrCriteria and Parallel::Phase::AdjustDomain
+/// (see amr::Tags::PhaseStartTimes) is printed as well, and written to the
+/// `/AmrDiagnostics` subfile of the reduction file along with the number of
+/// elements and grid points.
 struct RunAmrDiagnostics {
   using const_global_cache_tags =
       tmpl::list<logging::Tags::Verbosity<amr::OptionTags::AmrGroup>>;
@@ -50,7 +59,7 @@ struct RunAmrDiagnostics {
   template <typename ParallelComponent, typename DbTagList,
             typename Metavariables, typename ArrayIndex>
   static void apply(db::DataBox<DbTagList>& box,
-                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
                     const boost::rational<size_t>& volume,
                     const size_t number_of_elements,
@@ -65,8 +74,9 @@ struct RunAmrDiagnostics {
                               << number_of_blocks << ", not " << volume
                               << "\n");
     }
-    if (db::get<logging::Tags::Verbosity<amr::OptionTags::AmrGroup>>(box) >=
-        Verbosity::Quiet) {
+    const auto& verbosity =
+        db::get<logging::Tags::Verbosity<amr::OptionTags::AmrGroup>>(box);
+    if (verbosity >= Verbosity::Quiet) {
       const std::string string_gcc_needs_to_use_in_order_for_printf_to_compile =
           MakeString{} << "Average refinement levels: "
                        << avg_refinement_levels_by_dim
@@ -79,6 +89,40 @@ struct RunAmrDiagnostics {
           number_of_elements, number_of_grid_points,
           string_gcc_needs_to_use_in_order_for_printf_to_compile);
     }
+
+    // The AMR phases have start times only after AMR has adjusted the domain,
+    // so there is nothing to observe when the domain is checked at startup
+    const auto& phase_start_times = db::get<amr::Tags::PhaseStartTimes>(box);
+    if (phase_start_times.count(Parallel::Phase::EvaluateAmrCriteria) == 0 or
+        phase_start_times.count(Parallel::Phase::AdjustDomain) == 0 or
+        phase_start_times.count(Parallel::Phase::CheckDomain) == 0) {
+      return;
+    }
+    const double evaluate_criteria_wall_time =
+        phase_start_times.at(Parallel::Phase::AdjustDomain) -
+        phase_start_times.at(Parallel::Phase::EvaluateAmrCriteria);
+    const double adjust_domain_wall_time =
+        phase_start_times.at(Parallel::Phase::CheckDomain) -
+        phase_start_times.at(Parallel::Phase::AdjustDomain);
+    if (verbosity >= Verbosity::Quiet) {
+      Parallel::printf(
+          "Wall time to evaluate AMR criteria: %.3f seconds\n"
+          "Wall time to adjust the domain: %.3f seconds\n",
+          evaluate_criteria_wall_time, adjust_domain_wall_time);
+    }
+    auto& observer_writer_proxy = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+    Parallel::threaded_action<
+        observers::ThreadedActions::WriteReductionDataRow>(
+        // Node 0 is always the writer
+        observer_writer_proxy[0], std::string{"/AmrDiagnostics"},
+        std::vector<std::string>{"Walltime", "NumberOfElements",
+                                 "NumberOfGridPoints",
+                                 "EvaluateAmrCriteriaWalltime",
+                                 "AdjustDomainWalltime"},
+        std::make_tuple(sys::wall_time(), number_of_elements,
+                        number_of_grid_points, evaluate_criteria_wall_time,
+                        adjust_domain_wall_time));
   }
 };
 }  // namespace amr::Actions
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -10,6 +13,7 @@
 #include "Parallel/ElementRegistration.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
 #include "ParallelAlgorithms/Amr/Actions/InitializeChild.hpp"
 
 namespace amr::Actions {
@@ -21,6 +25,15 @@ namespace amr::Actions {
 /// corresponding to the mutable_item_creation_tags of `box` to each of the
 /// elements with `ids_of_children`.  Finally, the parent element destroys
 /// itself.
+///
+/// The children are created on the processor of the parent, so usually they
+/// are local to it.  Then amr::Actions::InitializeChild is invoked on them
+/// directly, so the items of the parent are projected (e.g. by
+/// amr::projectors::ProjectVariables) from an in-memory copy instead of being
+/// serialized into a message.  The last local child takes the copy of the
+/// items.  A child that is not (yet) local, e.g. because its insertion has not
+/// been processed, gets the items in a message, which Charm++ buffers until the
+/// child exists.
 struct SendDataToChildren {
   template <typename ParallelComponent, typename DbTagList,
             typename Metavariables>
@@ -31,12 +44,27 @@ struct SendDataToChildren {
                         ids_of_children) {
     auto& array_proxy =
         Parallel::get_parallel_component<ParallelComponent>(cache);
+    auto parent_items = db::copy_items<
+        typename db::DataBox<DbTagList>::mutable_item_creation_tags>(box);
+    std::vector<decltype(Parallel::local(array_proxy[element_id]))>
+        local_children{};
     for (const auto& child_id : ids_of_children) {
-      Parallel::simple_action<amr::Actions::InitializeChild>(
-          array_proxy[child_id],
-          db::copy_items<
-              typename db::DataBox<DbTagList>::mutable_item_creation_tags>(
-              box));
+      auto* const local_child = Parallel::local(array_proxy[child_id]);
+      if (local_child == nullptr) {
+        Parallel::simple_action<amr::Actions::InitializeChild>(
+            array_proxy[child_id], parent_items);
+      } else {
+        local_children.push_back(local_child);
+      }
+    }
+    for (size_t i = 0; i < local_children.size(); ++i) {
+      if (i + 1 == local_children.size()) {
+        local_children[i]->template simple_action<InitializeChild>(
+            std::make_tuple(std::move(parent_items)));
+      } else {
+        local_children[i]->template simple_action<InitializeChild>(
+            std::make_tuple(parent_items));
+      }
     }
 
     Parallel::deregister_element<ParallelComponent>(box, cache, element_id);
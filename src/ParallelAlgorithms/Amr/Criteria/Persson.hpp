@@ -22,6 +22,7 @@
 #include "Options/ParseError.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -209,6 +210,10 @@ std::array<Flag, Dim> Persson<Dim, TensorTags>::operator()(
         }
         const auto& tensor = db::get<tag>(box);
         for (const DataVector& tensor_component : tensor) {
+          // Skip the remaining components once every dimension is splitting
+          if (result == make_array<Dim>(Flag::Split)) {
+            return;
+          }
           Persson_detail::max_over_components(
               make_not_null(&result), make_not_null(&buffer), tensor_component,
               mesh, num_highest_modes_, alpha_, absolute_tolerance_,
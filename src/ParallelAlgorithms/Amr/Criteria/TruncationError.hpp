@@ -14,15 +14,18 @@
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/ValidateSelection.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Context.hpp"
 #include "Options/ParseError.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -40,13 +43,15 @@ namespace TruncationError_detail {
  * tensor components. This function will update the flags if necessary. It takes
  * the "max" of the current and new flags, where the "highest" flag is
  * `Flag::IncreaseResolution`, followed by `Flag::DoNothing`, and then
- * `Flag::DecreaseResolution`.
+ * `Flag::DecreaseResolution`. The `modal_coefficients` are those of the
+ * `tensor_component`.
  */
 template <size_t Dim>
 void max_over_components(
     gsl::not_null<std::array<Flag, Dim>*> result,
     const gsl::not_null<std::array<DataVector, Dim>*> power_monitors_buffer,
-    const DataVector& tensor_component, const Mesh<Dim>& mesh,
+    const DataVector& tensor_component, const ModalVector& modal_coefficients,
+    const Mesh<Dim>& mesh,
     std::optional<double> target_abs_truncation_error,
     std::optional<double> target_rel_truncation_error);
 }  // namespace TruncationError_detail
@@ -62,6 +67,10 @@ void max_over_components(
  * For details on how the truncation error is computed see
  * `PowerMonitors::truncation_error`.
  *
+ * If the DataBox holds the modal coefficients of a monitored tensor, i.e.
+ * `Tags::ModalCoefficientsCompute` was added for it, the criterion uses them
+ * instead of transforming the tensor again.
+ *
  * \tparam Dim Spatial dimension of the grid
  * \tparam TensorTags List of tags of the tensors to be monitored
  */
@@ -160,9 +169,11 @@ std::array<Flag, Dim> TruncationError<Dim, TensorTags>::operator()(
   auto result = make_array<Dim>(Flag::Undefined);
   const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
   std::array<DataVector, Dim> power_monitors_buffer{};
+  ModalVector modal_coefficients_buffer{};
   // Check all tensors and all tensor components in turn
   tmpl::for_each<TensorTags>(
-      [&result, &box, &mesh, &power_monitors_buffer, this](const auto tag_v) {
+      [&result, &box, &mesh, &power_monitors_buffer,
+       &modal_coefficients_buffer, this](const auto tag_v) {
         // Stop if we have already decided to refine every dimension
         if (result == make_array<Dim>(Flag::IncreaseResolution)) {
           return;
@@ -174,11 +185,26 @@ std::array<Flag, Dim> TruncationError<Dim, TensorTags>::operator()(
           return;
         }
         const auto& tensor = db::get<tag>(box);
-        for (const DataVector& tensor_component : tensor) {
+        for (size_t i = 0; i < tensor.size(); ++i) {
+          // Skip the modal transforms of the remaining components once every
+          // dimension is refined
+          if (result == make_array<Dim>(Flag::IncreaseResolution)) {
+            return;
+          }
+          const ModalVector* modal_coefficients = &modal_coefficients_buffer;
+          if constexpr (db::tag_is_retrievable_v<
+                            ::Tags::ModalCoefficients<tag>,
+                            db::DataBox<DbTagsList>>) {
+            modal_coefficients =
+                &db::get<::Tags::ModalCoefficients<tag>>(box)[i];
+          } else {
+            to_modal_coefficients(make_not_null(&modal_coefficients_buffer),
+                                  tensor[i], mesh);
+          }
           TruncationError_detail::max_over_components(
               make_not_null(&result), make_not_null(&power_monitors_buffer),
-              tensor_component, mesh, target_abs_truncation_error_,
-              target_rel_truncation_error_);
+              tensor[i], *modal_coefficients, mesh,
+              target_abs_truncation_error_, target_rel_truncation_error_);
         }
       });
   return result;
@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <unordered_map>
 #include <utility>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ChildSize.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
@@ -29,7 +32,9 @@ namespace amr::projectors {
 /// `tmpl::list` is available.
 ///
 /// \details For each item corresponding to each tag in VariablesTags, project
-/// the data for each variable from the old mesh to the new mesh
+/// the data for each variable from the old mesh to the new mesh. On
+/// h-coarsening the data of all children is restricted to the parent and the
+/// contributions are summed, like the multigrid restriction.
 ///
 /// \see ProjectTensors
 template <size_t Dim, typename... VariablesTags>
@@ -88,11 +93,50 @@ struct ProjectVariables : tt::ConformsTo<amr::protocols::Projector> {
   // h-coarsening
   template <typename... Tags>
   static void apply(
-      const gsl::not_null<typename VariablesTags::type*>... /*vars*/,
-      const Element<Dim>& /*element*/, const Mesh<Dim>& /*new_mesh*/,
+      const gsl::not_null<typename VariablesTags::type*>... vars,
+      const Element<Dim>& element, const Mesh<Dim>& parent_mesh,
       const std::unordered_map<ElementId<Dim>, tuples::TaggedTuple<Tags...>>&
-      /*children_items*/) {
-    ERROR("h-coarsening not implemented yet");
+          children_items) {
+    expand_pack(
+        (vars->initialize(parent_mesh.number_of_grid_points(), 0.), 0)...);
+    const auto& parent_id = element.id();
+    for (const auto& [child_id, child_items] : children_items) {
+      const auto& child_mesh = get<domain::Tags::Mesh<Dim>>(child_items);
+      const auto child_sizes =
+          domain::child_size(child_id.segment_ids(), parent_id.segment_ids());
+      // The restriction needs the child to have at least as many points as the
+      // parent, so increase the child's resolution first if needed
+      std::array<size_t, Dim> restriction_extents{};
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(restriction_extents, d) =
+            std::max(child_mesh.extents(d), parent_mesh.extents(d));
+      }
+      const Mesh<Dim> restriction_mesh{restriction_extents, child_mesh.basis(),
+                                       child_mesh.quadrature()};
+      if (restriction_mesh == child_mesh) {
+        const auto restriction_matrices =
+            Spectral::projection_matrix_child_to_parent(
+                child_mesh, parent_mesh, child_sizes);
+        expand_pack((*vars += apply_matrices(restriction_matrices,
+                                             get<VariablesTags>(child_items),
+                                             child_mesh.extents()),
+                     0)...);
+      } else {
+        const auto p_projection_matrices =
+            Spectral::p_projection_matrices(child_mesh, restriction_mesh);
+        const auto restriction_matrices =
+            Spectral::projection_matrix_child_to_parent(
+                restriction_mesh, parent_mesh, child_sizes);
+        expand_pack(
+            (*vars += apply_matrices(
+                 restriction_matrices,
+                 apply_matrices(p_projection_matrices,
+                                get<VariablesTags>(child_items),
+                                child_mesh.extents()),
+                 restriction_mesh.extents()),
+             0)...);
+      }
+    }
   }
 };
 
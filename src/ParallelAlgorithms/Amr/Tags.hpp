@@ -4,8 +4,11 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 
+#include "DataStructures/DataBox/Tag.hpp"
 #include "Options/String.hpp"
+#include "Parallel/Phase.hpp"
 
 /// Options for AMR
 namespace amr::OptionTags {
@@ -17,3 +20,12 @@ struct AmrGroup {
 };
 
 }  // namespace amr::OptionTags
+
+namespace amr::Tags {
+/// The wall time on the amr::Component at which each of the AMR phases
+/// (Parallel::Phase::EvaluateAmrCriteria, Parallel::Phase::AdjustDomain, and
+/// Parallel::Phase::CheckDomain) last started
+struct PhaseStartTimes : db::SimpleTag {
+  using type = std::unordered_map<Parallel::Phase, double>;
+};
+}  // namespace amr::Tags
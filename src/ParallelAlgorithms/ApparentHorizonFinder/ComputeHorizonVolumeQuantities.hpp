@@ -77,6 +77,13 @@ struct ComputeHorizonVolumeQuantities
       const tnsr::I<DataVector, 3, TargetFrame>&
           grid_to_target_frame_mesh_velocity);
 
+  /// The single-frame case only needs the source variables at each point,
+  /// since the spatial Ricci tensor is computed from the derivative of
+  /// \f$\Phi\f$ in the source variables. So elements without frame
+  /// transformations interpolate the generalized harmonic variables to the
+  /// horizon and compute the quantities only there.
+  static constexpr bool is_pointwise = true;
+
   using allowed_src_tags =
       tmpl::list<gr::Tags::SpacetimeMetric<DataVector, 3>,
                  gh::Tags::Pi<DataVector, 3>, gh::Tags::Phi<DataVector, 3>,
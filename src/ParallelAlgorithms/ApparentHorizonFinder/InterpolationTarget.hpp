@@ -155,8 +155,11 @@ struct ApparentHorizon : tt::ConformsTo<intrp::protocols::ComputeTargetPoints> {
       tmpl::push_back<ylm::Tags::items_tags<Frame>, ::ah::Tags::FastFlow,
                       logging::Tags::Verbosity<InterpolationTargetTag>,
                       ylm::Tags::PreviousStrahlkorpers<Frame>>;
+  // The points of successive iterations and horizon finds are close to each
+  // other, so the block logical coordinates of the previous points are a good
+  // initial guess for the next ones.
   using simple_tags = tmpl::append<
-      common_tags,
+      common_tags, tmpl::list<Tags::PreviousBlockLogicalCoords<3>>,
       tmpl::conditional_t<
           std::is_same_v<Frame, ::Frame::Inertial>, tmpl::list<>,
           tmpl::list<ylm::Tags::CartesianCoords<::Frame::Inertial>>>>;
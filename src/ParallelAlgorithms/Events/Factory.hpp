@@ -7,6 +7,7 @@
 #include <type_traits>
 
 #include "ParallelAlgorithms/Events/ErrorIfDataTooBig.hpp"
+#include "ParallelAlgorithms/Events/ObserveActionProfile.hpp"
 #include "ParallelAlgorithms/Events/ObserveAdaptiveSteppingDiagnostics.hpp"
 #include "ParallelAlgorithms/Events/ObserveFields.hpp"
 #include "ParallelAlgorithms/Events/ObserveNorms.hpp"
@@ -28,6 +29,7 @@ using field_observations = tmpl::flatten<tmpl::list<
 namespace Events {
 template <typename System>
 using time_events =
-    tmpl::list<Events::ObserveAdaptiveSteppingDiagnostics,
+    tmpl::list<Events::ObserveActionProfile,
+               Events::ObserveAdaptiveSteppingDiagnostics,
                Events::ObserveTimeStep<System>, Events::ChangeSlabSize>;
 }  // namespace Events
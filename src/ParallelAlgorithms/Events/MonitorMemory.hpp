@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <limits>
+#include <map>
 #include <optional>
 #include <pup.h>
 #include <string>
@@ -14,6 +15,7 @@
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "Domain/Structure/Element.hpp"
@@ -35,9 +37,12 @@
 #include "Parallel/MemoryMonitor/Tags.hpp"
 #include "Parallel/Reduction.hpp"
 #include "Parallel/TypeTraits.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ContributeScratchArenaData.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessDataBox.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
+#include "ParallelAlgorithms/Events/ObserveDataBox.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Functional.hpp"
@@ -71,6 +76,19 @@ namespace Events {
  * parallel component ("Blah" for example) in the input file. An ERROR will
  * occur and a list of the available components to monitor will be printed.
  *
+ * Passing "ScratchArena" (or 'All') additionally writes the number of
+ * megabytes of scratch memory each node served from its `ScratchArena`s versus
+ * from the heap since the previous observation. See
+ * `mem_monitor::ContributeScratchArenaData` for the columns.
+ *
+ * Passing "DataBox" additionally writes the number of megabytes of
+ * each item in the DataBoxes of the DgElementArray, summed over all elements,
+ * to find which items (e.g. boundary history, mortar data, or ghost data)
+ * dominate the memory usage. See `mem_monitor::ProcessDataBox` for the
+ * columns. Computing the size of every item serializes the whole DataBox of
+ * every element, so this is considerably more expensive than monitoring the
+ * total size of the DgElementArray and is not included in 'All'.
+ *
  * \note Currently, the only Parallel::Algorithms::Array parallel component that
  * can be monitored is the DgElementArray itself.
  */
@@ -85,6 +103,13 @@ class MonitorMemory : public Event {
       // Vector of total mem usage on each node
       Parallel::ReductionDatum<std::vector<double>,
                                funcl::ElementWise<funcl::Plus<>>>>;
+  // Reduction data for the size of each DataBox item of arrays
+  using DataBoxReductionData = Parallel::ReductionData<
+      // Time
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      // Map of total mem usage in bytes per item in the DataBoxes
+      Parallel::ReductionDatum<std::map<std::string, size_t>,
+                               detail::map_add>>;
 
  public:
   explicit MonitorMemory(CkMigrateMessage* msg);
@@ -118,11 +143,11 @@ class MonitorMemory : public Event {
   using compute_tags_for_observation_box = tmpl::list<>;
 
   using return_tags = tmpl::list<>;
-  using argument_tags = tmpl::list<domain::Tags::Element<Dim>>;
+  using argument_tags = tmpl::list<domain::Tags::Element<Dim>, ::Tags::DataBox>;
 
-  template <typename Metavariables, typename ArrayIndex,
+  template <typename DataBoxType, typename Metavariables, typename ArrayIndex,
             typename ParallelComponent>
-  void operator()(const ::Element<Dim>& element,
+  void operator()(const ::Element<Dim>& element, const DataBoxType& box,
                   Parallel::GlobalCache<Metavariables>& cache,
                   const ArrayIndex& array_index,
                   const ParallelComponent* const /*meta*/,
@@ -182,6 +207,14 @@ MonitorMemory<Dim>::MonitorMemory(
           str_component_list += " - " + component_name + "\n";
         }
       });
+  // Not a parallel component, but the scratch arena usage is reported through
+  // the GlobalCache so it is monitored the same way.
+  existing_components["ScratchArena"] = "ScratchArena";
+  str_component_list += " - ScratchArena\n";
+  // Not a parallel component either, but the items in the DataBoxes of the
+  // DgElementArray
+  existing_components["DataBox"] = "DataBox";
+  str_component_list += " - DataBox\n";
 
   // A list of names was specified
   if (components_to_monitor.has_value()) {
@@ -213,9 +246,9 @@ MonitorMemory<Dim>::MonitorMemory(
     }
   } else {
     // 'All' was specified. Filter out Array components that are not the
-    // DgElementArray
+    // DgElementArray, and the expensive DataBox items
     for (const auto& [name, chare] : existing_components) {
-      if (chare != "Array") {
+      if (chare != "Array" and chare != "DataBox") {
         components_to_monitor_.insert(name);
       } else if (name == "DgElementArray") {
         components_to_monitor_.insert(name);
@@ -225,11 +258,12 @@ MonitorMemory<Dim>::MonitorMemory(
 }
 
 template <size_t Dim>
-template <typename Metavariables, typename ArrayIndex,
+template <typename DataBoxType, typename Metavariables, typename ArrayIndex,
           typename ParallelComponent>
 void MonitorMemory<Dim>::operator()(
-    const ::Element<Dim>& element, Parallel::GlobalCache<Metavariables>& cache,
-    const ArrayIndex& array_index, const ParallelComponent* const /*meta*/,
+    const ::Element<Dim>& element, const DataBoxType& box,
+    Parallel::GlobalCache<Metavariables>& cache, const ArrayIndex& array_index,
+    const ParallelComponent* const /*meta*/,
     const ObservationValue& observation_value) const {
   using component_list = tmpl::push_back<typename Metavariables::component_list,
                                          Parallel::GlobalCache<Metavariables>>;
@@ -318,6 +352,29 @@ void MonitorMemory<Dim>::operator()(
       }
     }
   });
+
+  if (components_to_monitor_.count("ScratchArena") == 1 and
+      is_zeroth_element(element.id())) {
+    // This will be called on all branches of the GlobalCache
+    cache.get_this_proxy().compute_scratch_arena_usage_for_memory_monitor(
+        observation_value.value);
+  }
+
+  if constexpr (Parallel::is_array_v<ParallelComponent>) {
+    if (components_to_monitor_.count("DataBox") == 1) {
+      auto& memory_monitor_proxy = Parallel::get_parallel_component<
+          mem_monitor::MemoryMonitor<Metavariables>>(cache);
+      auto array_element_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(
+              cache)[array_index];
+      Parallel::contribute_to_reduction<
+          mem_monitor::ProcessDataBox<ParallelComponent>>(
+          DataBoxReductionData{observation_value.value, box.size_of_items()},
+          array_element_proxy, memory_monitor_proxy);
+    }
+  } else {
+    (void)box;
+  }
 }
 
 template <size_t Dim>
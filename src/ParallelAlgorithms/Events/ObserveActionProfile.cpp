@@ -0,0 +1,31 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Events/ObserveActionProfile.hpp"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Events {
+namespace detail {
+bool is_first_action_profile_contribution(const std::string& subfile_path,
+                                          const double observation_value) {
+  static std::mutex last_observation_values_mutex{};
+  static std::unordered_map<std::string, double> last_observation_values{};
+  const std::lock_guard lock(last_observation_values_mutex);
+  const auto [it, inserted] =
+      last_observation_values.emplace(subfile_path, observation_value);
+  if (inserted) {
+    return true;
+  }
+  if (it->second == observation_value) {
+    return false;
+  }
+  it->second = observation_value;
+  return true;
+}
+}  // namespace detail
+
+PUP::able::PUP_ID ObserveActionProfile::my_PUP_ID = 0;  // NOLINT
+}  // namespace Events
@@ -0,0 +1,211 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
+#include "Options/String.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/Tracing.hpp"
+#include "Parallel/TypeTraits.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+namespace detail {
+// Returns `true` for the first call in this process with the
+// `observation_value` for the `subfile_path`, and `false` for all other calls
+bool is_first_action_profile_contribution(const std::string& subfile_path,
+                                          double observation_value);
+}  // namespace detail
+
+/*!
+ * \brief %Observe how much time the elements spend in each type of action
+ *
+ * Writes reduction quantities:
+ * - The observation value (e.g. `%Time`)
+ * - `{Action} time`: the total wall time in seconds spent in the action,
+ *   summed over all processes
+ * - `{Action} calls`: the number of times the action was run, summed over all
+ *   processes
+ * - `{Action} max time`: the longest wall time in seconds of a single run of
+ *   the action
+ *
+ * for every iterable action in any phase of the parallel component, and
+ * - `Modal transforms`: the number of transforms to modal coefficients, summed
+ *   over all processes (see `number_of_modal_transforms()`)
+ *
+ * The quantities are cumulative since the start of the run (or since the
+ * restart), so the cost of an action over an interval, or the number of
+ * transforms per step, is the difference between two rows.
+ *
+ * The times are only recorded in builds with `ENABLE_PROFILING` turned on (see
+ * `Parallel::tracing`), and are zero otherwise. Every process contributes its
+ * statistics once per observation, through the first element on the process
+ * that runs the event.
+ */
+class ObserveActionProfile : public Event {
+ private:
+  using ReductionData = Parallel::ReductionData<
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Plus<>>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Plus<>>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Max<>>>,
+      Parallel::ReductionDatum<double, funcl::Plus<>>>;
+
+ public:
+  /// The name of the subfile inside the HDF5 file
+  struct SubfileName {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "The name of the subfile inside the HDF5 file without an extension and "
+        "without a preceding '/'."};
+  };
+
+  /// \cond
+  explicit ObserveActionProfile(CkMigrateMessage* /*unused*/) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveActionProfile);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<SubfileName>;
+  static constexpr Options::String help =
+      "Observe the total time, number of calls, and maximum time of each type "
+      "of action, accumulated over all processes since the start of the run. "
+      "The times are only recorded in builds with ENABLE_PROFILING turned on, "
+      "and are zero otherwise.";
+
+  ObserveActionProfile() = default;
+  explicit ObserveActionProfile(const std::string& subfile_name)
+      : subfile_path_("/" + subfile_name) {}
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<>;
+
+  template <typename ArrayIndex, typename ParallelComponent,
+            typename Metavariables>
+  void operator()(Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    using actions = tmpl::remove_duplicates<tmpl::flatten<tmpl::transform<
+        typename ParallelComponent::phase_dependent_action_list,
+        Parallel::get_action_list_from_phase_dep_action_list<tmpl::_1>>>>;
+    constexpr size_t number_of_actions = tmpl::size<actions>::value;
+
+    const bool contribute_statistics =
+        detail::is_first_action_profile_contribution(subfile_path_,
+                                                     observation_value.value);
+    std::vector<double> total_times(number_of_actions, 0.0);
+    std::vector<double> calls(number_of_actions, 0.0);
+    std::vector<double> max_times(number_of_actions, 0.0);
+    std::vector<std::string> legend(2 + 3 * number_of_actions);
+    legend[0] = observation_value.name;
+    legend.back() = "Modal transforms";
+    const double modal_transforms =
+        contribute_statistics
+            ? static_cast<double>(number_of_modal_transforms())
+            : 0.0;
+    size_t action_index = 0;
+    tmpl::for_each<actions>([&](auto action_v) {
+      using action = tmpl::type_from<decltype(action_v)>;
+      const std::string& name = Parallel::tracing::span_name<action>();
+      legend[1 + action_index] = name + " time";
+      legend[1 + number_of_actions + action_index] = name + " calls";
+      legend[1 + 2 * number_of_actions + action_index] = name + " max time";
+      if (contribute_statistics) {
+        const auto& statistics = Parallel::tracing::action_statistics<action>();
+        total_times[action_index] =
+            1.0e-9 * static_cast<double>(statistics.total_nanoseconds.load(
+                         std::memory_order_relaxed));
+        calls[action_index] = static_cast<double>(
+            statistics.calls.load(std::memory_order_relaxed));
+        max_times[action_index] =
+            1.0e-9 * static_cast<double>(statistics.max_nanoseconds.load(
+                         std::memory_order_relaxed));
+      }
+      ++action_index;
+    });
+
+    auto& local_observer = *Parallel::local_branch(
+        Parallel::get_parallel_component<
+            tmpl::conditional_t<Parallel::is_nodegroup_v<ParallelComponent>,
+                                observers::ObserverWriter<Metavariables>,
+                                observers::Observer<Metavariables>>>(cache));
+    observers::ObservationId observation_id{observation_value.value,
+                                            subfile_path_ + ".dat"};
+    Parallel::ArrayComponentId array_component_id =
+        Parallel::make_array_component_id<ParallelComponent>(array_index);
+    ReductionData reduction_data{observation_value.value,
+                                 std::move(total_times), std::move(calls),
+                                 std::move(max_times), modal_transforms};
+    if constexpr (Parallel::is_nodegroup_v<ParallelComponent>) {
+      Parallel::threaded_action<
+          observers::ThreadedActions::CollectReductionDataOnNode>(
+          local_observer, std::move(observation_id),
+          std::move(array_component_id), subfile_path_, std::move(legend),
+          std::move(reduction_data));
+    } else {
+      Parallel::simple_action<observers::Actions::ContributeReductionData>(
+          local_observer, std::move(observation_id),
+          std::move(array_component_id), subfile_path_, std::move(legend),
+          std::move(reduction_data));
+    }
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+  std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  get_observation_type_and_key_for_registration() const {
+    return {observers::TypeOfObservation::Reduction,
+            observers::ObservationKey(subfile_path_ + ".dat")};
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    Event::pup(p);
+    p | subfile_path_;
+  }
+
+ private:
+  std::string subfile_path_;
+};
+}  // namespace Events
@@ -23,6 +23,7 @@
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
 #include "Parallel/Reduction.hpp"
+#include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "Time/AdaptiveSteppingDiagnostics.hpp"
 #include "Utilities/Functional.hpp"
@@ -110,22 +111,39 @@ class ObserveAdaptiveSteppingDiagnostics : public Event {
                   const ParallelComponent* const /*meta*/,
                   const ObservationValue& observation_value) const {
     auto& local_observer = *Parallel::local_branch(
-        Parallel::get_parallel_component<observers::Observer<Metavariables>>(
-            cache));
-    Parallel::simple_action<observers::Actions::ContributeReductionData>(
-        local_observer,
-        observers::ObservationId(observation_value.value,
-                                 subfile_path_ + ".dat"),
-        Parallel::make_array_component_id<ParallelComponent>(array_index),
-        subfile_path_,
-        std::vector<std::string>{
-            observation_value.name, "Number of slabs",
-            "Number of slab size changes", "Total steps on all elements",
-            "Number of LTS step changes", "Number of step rejections"},
-        ReductionData{observation_value.value, diags.number_of_slabs,
-                      diags.number_of_slab_size_changes, diags.number_of_steps,
-                      diags.number_of_step_fraction_changes,
-                      diags.number_of_step_rejections});
+        Parallel::get_parallel_component<
+            tmpl::conditional_t<Parallel::is_nodegroup_v<ParallelComponent>,
+                                observers::ObserverWriter<Metavariables>,
+                                observers::Observer<Metavariables>>>(cache));
+
+    observers::ObservationId observation_id{observation_value.value,
+                                            subfile_path_ + ".dat"};
+    Parallel::ArrayComponentId array_component_id =
+        Parallel::make_array_component_id<ParallelComponent>(array_index);
+    std::vector<std::string> legend{
+        observation_value.name,        "Number of slabs",
+        "Number of slab size changes", "Total steps on all elements",
+        "Number of LTS step changes",  "Number of step rejections"};
+    ReductionData reduction_data{observation_value.value, diags.number_of_slabs,
+                                 diags.number_of_slab_size_changes,
+                                 diags.number_of_steps,
+                                 diags.number_of_step_fraction_changes,
+                                 diags.number_of_step_rejections};
+
+    // The elements of a nodegroup DG collection are combined on the node by
+    // the ObserverWriter directly
+    if constexpr (Parallel::is_nodegroup_v<ParallelComponent>) {
+      Parallel::threaded_action<
+          observers::ThreadedActions::CollectReductionDataOnNode>(
+          local_observer, std::move(observation_id),
+          std::move(array_component_id), subfile_path_, std::move(legend),
+          std::move(reduction_data));
+    } else {
+      Parallel::simple_action<observers::Actions::ContributeReductionData>(
+          local_observer, std::move(observation_id),
+          std::move(array_component_id), subfile_path_, std::move(legend),
+          std::move(reduction_data));
+    }
   }
 
   using observation_registration_tags = tmpl::list<>;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <optional>
 #include <pup.h>
@@ -51,6 +52,11 @@ namespace Events {
  *
  * \snippet Test_ObserveAtExtremum.cpp input_file_examples
  *
+ * Each element contributes its local extremum and the additional data at that
+ * point. The observers combine the contributions on each core and then on each
+ * node, keeping only the data of the element with the extremum, so a single
+ * entry per node travels between nodes regardless of the number of elements.
+ *
  * \par Array sections
  * This event supports sections (see `Parallel::Section`). Set the
  * `ArraySectionIdTag` template parameter to split up observations into subsets
@@ -315,21 +321,20 @@ operator()(const ObservationBox<ComputeTagsList, DataBoxType>& box,
                  "computed. This can happen when you try to observe errors "
                  "without an analytic solution.");
       }
+      // Access the components directly since `get_vector_of_data` copies them
       const auto& scalar = value(get<tag>(box));
-      const auto components = get<1>(scalar.get_vector_of_data());
-      if (components.size() > 1) {
+      if (scalar.size() > 1) {
         ERROR("Extremum should be taken on a scalar, yet we have "
-              << components.size() << " components in tensor " << tensor_name);
-      }
-      for (size_t i = 1; i < components[0].size(); i++) {
-        if ((extremum_type_ == "Max" and
-             (components[0][i] > components[0][index_of_extremum])) or
-            (extremum_type_ == "Min" and
-             (components[0][i] < components[0][index_of_extremum]))) {
-          index_of_extremum = i;
-        }
+              << scalar.size() << " components in tensor " << tensor_name);
       }
-      data_to_reduce.push_back(components[0][index_of_extremum]);
+      // Decide on the type of extremum once instead of at every point
+      const DataVector& values = scalar[0];
+      index_of_extremum = static_cast<size_t>(
+          (extremum_type_ == "Max"
+               ? std::max_element(values.begin(), values.end())
+               : std::min_element(values.begin(), values.end())) -
+          values.begin());
+      data_to_reduce.push_back(values[index_of_extremum]);
       if (extremum_type_ == "Max") {
         legend.push_back("Max(" + scalar_name_ + ")");
       } else {
@@ -352,12 +357,12 @@ operator()(const ObservationBox<ComputeTagsList, DataBoxType>& box,
                    "without an analytic solution.");
         }
         const auto& tensor = value(get<tag>(box));
-        const auto [component_names, components] = tensor.get_vector_of_data();
-        for (size_t j = 0; j < components.size(); j++) {
-          data_to_reduce.push_back(components[j][index_of_extremum]);
-          if (components.size() > 1) {
-            legend.push_back("At" + scalar_name_ + extremum_type_ + "(" +
-                             tensor_name + "_" + component_names[j] + ")");
+        for (size_t j = 0; j < tensor.size(); j++) {
+          data_to_reduce.push_back(tensor[j][index_of_extremum]);
+          if (tensor.size() > 1) {
+            legend.push_back(
+                "At" + scalar_name_ + extremum_type_ + "(" + tensor_name + "_" +
+                tensor.component_name(tensor.get_tensor_index(j)) + ")");
           } else {
             legend.push_back("At" + scalar_name_ + extremum_type_ + "(" +
                              tensor_name + ")");
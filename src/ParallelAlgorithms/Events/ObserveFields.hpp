@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <initializer_list>
@@ -20,8 +22,16 @@
 #include "DataStructures/DataBox/ValidateSelection.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/FloatingPointType.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/Creators/BlockGroups.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Structure/Side.hpp"
 #include "Domain/Tags.hpp"
+#include "IO/H5/LossyCompression.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/Observer/GetSectionObservationKey.hpp"
 #include "IO/Observer/ObservationId.hpp"
@@ -42,6 +52,7 @@
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Numeric.hpp"
@@ -85,6 +96,29 @@ class ObserveFields;
  * The user may specify an `interpolation_mesh` to which the
  * data is interpolated.
  *
+ * Individual variables can be compressed lossily with a bound on the error by
+ * listing them in the `LossyCompression` option (see `h5::LossyCompression`).
+ * The coordinates are always written losslessly so that the data can be
+ * visualized and interpolated reliably.
+ *
+ * The observation can be restricted to a region of interest by listing block
+ * names or block groups in the `BlocksToObserve` option. Elements in other
+ * blocks don't register with the observers and don't send any data. To output
+ * different regions on different meshes or at different cadences, add one
+ * ObserveFields event per region, each with its own `SubfileName`,
+ * `InterpolateToMesh` and trigger. Restricting the observation requires the
+ * `domain::Tags::Domain` and the `domain::Tags::Element` in the DataBox.
+ *
+ * Instead of the full volume, a slice through the domain can be observed with
+ * the `SliceAt` option. It selects the plane where the block-logical
+ * coordinate in one dimension has a fixed value, e.g. an equatorial or
+ * meridional cut through a spherical shell. Only elements that intersect the
+ * plane register and send data, and they interpolate their data onto the
+ * plane (and onto the `InterpolateToMesh` in the other dimensions) before
+ * sending it. The slice is written as a grid of one dimension lower than the
+ * volume, so it is a fraction of the size of a volume observation. Observing a
+ * slice requires the `domain::Tags::Element` in the DataBox.
+ *
  * \note The `NonTensorComputeTags` are intended to be used for `Variables`
  * compute tags like `Tags::DerivCompute`
  *
@@ -157,9 +191,44 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
     using type = FloatingPointType;
   };
 
+  /// Lossy compression of individual variables when they are written to disk
+  struct LossyCompression {
+    using type =
+        Options::Auto<std::unordered_map<std::string, h5::LossyCompression>,
+                      Options::AutoLabel::None>;
+    static constexpr Options::String help =
+        "Variables to compress lossily when writing them to disk, each with "
+        "the compression method and its error bound. All other variables and "
+        "the coordinates are written losslessly.";
+  };
+
+  /// Blocks or block groups in which to observe the fields
+  struct BlocksToObserve {
+    using type =
+        Options::Auto<std::vector<std::string>, Options::AutoLabel::All>;
+    static constexpr Options::String help =
+        "List of blocks or block groups in which to observe the fields. "
+        "Elements in all other blocks are not observed. Specify 'All' to "
+        "observe the fields in all blocks of the domain.";
+  };
+
+  /// A plane of constant block-logical coordinate to which the observation is
+  /// restricted
+  struct SliceAt {
+    using type =
+        Options::Auto<std::pair<size_t, double>, Options::AutoLabel::None>;
+    static constexpr Options::String help =
+        "Observe the fields only on the plane where the block-logical "
+        "coordinate in the dimension given by the first entry has the value "
+        "given by the second entry, e.g. [2, 0.] for the equatorial plane of a "
+        "spherical shell. Only elements that intersect the plane send data. "
+        "Specify 'None' to observe the full volume.";
+  };
+
   using options =
       tmpl::list<SubfileName, CoordinatesFloatingPointType, FloatingPointTypes,
-                 VariablesToObserve, InterpolateToMesh>;
+                 VariablesToObserve, InterpolateToMesh, LossyCompression,
+                 BlocksToObserve, SliceAt>;
 
   static constexpr Options::String help =
       "Observe volume tensor fields.\n"
@@ -175,6 +244,11 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
                 const std::vector<FloatingPointType>& floating_point_types,
                 const std::vector<std::string>& variables_to_observe,
                 std::optional<Mesh<VolumeDim>> interpolation_mesh = {},
+                std::optional<std::unordered_map<std::string,
+                                                 h5::LossyCompression>>
+                    lossy_compression = {},
+                std::optional<std::vector<std::string>> blocks_to_observe = {},
+                std::optional<std::pair<size_t, double>> slice = {},
                 const Options::Context& context = {});
 
   using compute_tags_for_observation_box =
@@ -192,15 +266,18 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
                   const ElementId<VolumeDim>& array_index,
                   const ParallelComponent* const component,
                   const ObservationValue& observation_value) const {
-    // Skip observation on elements that are not part of a section
+    // Skip observation on elements that are not part of a section or not in
+    // the region of interest
     const std::optional<std::string> section_observation_key =
         observers::get_section_observation_key<ArraySectionIdTag>(box);
-    if (not section_observation_key.has_value()) {
+    if (not section_observation_key.has_value() or
+        not is_in_blocks_to_observe(box) or not intersects_slice(box)) {
       return;
     }
     call_operator_impl(subfile_path_ + *section_observation_key,
-                       variables_to_observe_, interpolation_mesh_, mesh, box,
-                       cache, array_index, component, observation_value);
+                       variables_to_observe_, lossy_compression_,
+                       interpolation_mesh_, mesh, box, cache, array_index,
+                       component, observation_value, slice_);
   }
 
   // We factor out the work into a static member function so it can  be shared
@@ -212,17 +289,31 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
       const std::string& subfile_path,
       const std::unordered_map<std::string, FloatingPointType>&
           variables_to_observe,
+      const std::unordered_map<std::string, h5::LossyCompression>&
+          lossy_compression,
       const std::optional<Mesh<VolumeDim>>& interpolation_mesh,
       const Mesh<VolumeDim>& mesh,
       const ObservationBox<DataBoxType, ComputeTagsList>& box,
       Parallel::GlobalCache<Metavariables>& cache,
       const ElementId<VolumeDim>& element_id,
       const ParallelComponent* const /*meta*/,
-      const ObservationValue& observation_value) {
+      const ObservationValue& observation_value,
+      const std::optional<std::pair<size_t, double>>& slice = std::nullopt) {
     // if no interpolation_mesh is provided, the interpolation is essentially
     // ignored by the RegularGridInterpolant except for a single copy.
-    const intrp::RegularGrid interpolant(mesh,
-                                         interpolation_mesh.value_or(mesh));
+    const Mesh<VolumeDim> target_mesh = interpolation_mesh.value_or(mesh);
+    // A slice is interpolated to a single point in the sliced dimension
+    std::array<DataVector, VolumeDim> target_logical_coords{};
+    if (slice.has_value()) {
+      const std::optional<double> slice_coordinate =
+          element_logical_slice_coordinate(element_id, *slice);
+      ASSERT(slice_coordinate.has_value(),
+             "The element " << element_id << " doesn't intersect the slice.");
+      gsl::at(target_logical_coords, slice->first) =
+          DataVector(1, *slice_coordinate);
+    }
+    const intrp::RegularGrid interpolant(mesh, target_mesh,
+                                         target_logical_coords);
 
     // Remove tensor types, only storing individual components.
     std::vector<TensorComponent> components;
@@ -235,9 +326,11 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
         0_st));
 
     const auto record_tensor_component_impl =
-        [&components](DataVector&& tensor_component,
-                      const FloatingPointType floating_point_type,
-                      const std::string& component_name) {
+        [&components](
+            DataVector&& tensor_component,
+            const FloatingPointType floating_point_type,
+            const std::string& component_name,
+            const std::optional<h5::LossyCompression>& compression) {
           if (floating_point_type == FloatingPointType::Float) {
             components.emplace_back(component_name,
                                     std::vector<float>{tensor_component.begin(),
@@ -246,12 +339,14 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
             components.emplace_back(component_name,
                                     std::move(tensor_component));
           }
+          components.back().compression = compression;
         };
 
     const auto record_tensor_components_impl =
         [&record_tensor_component_impl, &interpolant](
             const auto& tensor, const FloatingPointType floating_point_type,
-            const std::string& tag_name) {
+            const std::string& tag_name,
+            const std::optional<h5::LossyCompression>& compression) {
           using TensorType = std::decay_t<decltype(tensor)>;
           using VectorType = typename TensorType::type;
           for (size_t i = 0; i < tensor.size(); ++i) {
@@ -259,21 +354,22 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
             const std::string component_name =
                 tag_name + tensor.component_suffix(i);
             if constexpr (std::is_same_v<VectorType, ComplexDataVector>) {
-              record_tensor_component_impl(real(tensor_component),
-                                           floating_point_type,
-                                           "Re(" + component_name + ")");
-              record_tensor_component_impl(imag(tensor_component),
-                                           floating_point_type,
-                                           "Im(" + component_name + ")");
+              record_tensor_component_impl(
+                  real(tensor_component), floating_point_type,
+                  "Re(" + component_name + ")", compression);
+              record_tensor_component_impl(
+                  imag(tensor_component), floating_point_type,
+                  "Im(" + component_name + ")", compression);
             } else {
               record_tensor_component_impl(std::move(tensor_component),
-                                           floating_point_type, component_name);
+                                           floating_point_type, component_name,
+                                           compression);
             }
           }
         };
     const auto record_tensor_components =
-        [&box, &record_tensor_components_impl,
-         &variables_to_observe](const auto tensor_tag_v) {
+        [&box, &record_tensor_components_impl, &variables_to_observe,
+         &lossy_compression](const auto tensor_tag_v) {
           using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
           const std::string tag_name = db::tag_name<tensor_tag>();
           if (const auto var_to_observe = variables_to_observe.find(tag_name);
@@ -287,8 +383,12 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
               return;
             }
             const auto floating_point_type = var_to_observe->second;
-            record_tensor_components_impl(value(tensor), floating_point_type,
-                                          tag_name);
+            const auto compression = lossy_compression.find(tag_name);
+            record_tensor_components_impl(
+                value(tensor), floating_point_type, tag_name,
+                compression == lossy_compression.end()
+                    ? std::nullopt
+                    : std::optional{compression->second});
           }
         };
     EXPAND_PACK_LEFT_TO_RIGHT(record_tensor_components(tmpl::type_<Tensors>{}));
@@ -297,7 +397,17 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
         std::add_pointer_t<ParallelComponent>{nullptr},
         Parallel::ArrayIndex<ElementId<VolumeDim>>{element_id}};
     ElementVolumeData element_volume_data{element_id, std::move(components),
-                                          interpolation_mesh.value_or(mesh)};
+                                          target_mesh};
+    if (slice.has_value()) {
+      // Write the slice as a grid of one dimension lower than the volume
+      const auto sliced_dim = static_cast<std::ptrdiff_t>(slice->first);
+      element_volume_data.extents.erase(element_volume_data.extents.begin() +
+                                        sliced_dim);
+      element_volume_data.basis.erase(element_volume_data.basis.begin() +
+                                      sliced_dim);
+      element_volume_data.quadrature.erase(
+          element_volume_data.quadrature.begin() + sliced_dim);
+    }
     observers::ObservationId observation_id{observation_value.value,
                                             subfile_path + ".vol"};
 
@@ -335,7 +445,8 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
       const db::DataBox<DbTagsList>& box) const {
     const std::optional<std::string> section_observation_key =
         observers::get_section_observation_key<ArraySectionIdTag>(box);
-    if (not section_observation_key.has_value()) {
+    if (not section_observation_key.has_value() or
+        not is_in_blocks_to_observe(box) or not intersects_slice(box)) {
       return std::nullopt;
     }
     return {{observers::TypeOfObservation::Volume,
@@ -359,10 +470,75 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
     Event::pup(p);
     p | subfile_path_;
     p | variables_to_observe_;
+    p | lossy_compression_;
     p | interpolation_mesh_;
+    p | blocks_to_observe_;
+    p | slice_;
   }
 
  private:
+  template <typename BoxType>
+  bool is_in_blocks_to_observe(const BoxType& box) const {
+    if (not blocks_to_observe_.has_value()) {
+      return true;
+    }
+    if constexpr (db::tag_is_retrievable_v<domain::Tags::Domain<VolumeDim>,
+                                           BoxType> and
+                  db::tag_is_retrievable_v<domain::Tags::Element<VolumeDim>,
+                                           BoxType>) {
+      const auto& domain = get<domain::Tags::Domain<VolumeDim>>(box);
+      const std::string& block_name =
+          domain.blocks()[get<domain::Tags::Element<VolumeDim>>(box)
+                              .id()
+                              .block_id()]
+              .name();
+      return alg::any_of(
+          *blocks_to_observe_,
+          [&block_name, &domain](const std::string& block_or_group_name) {
+            return domain::block_is_in_group(block_name, block_or_group_name,
+                                             domain.block_groups());
+          });
+    } else {
+      ERROR(
+          "Observing the fields only in some blocks requires the domain and "
+          "the element in the DataBox.");
+    }
+  }
+
+  template <typename BoxType>
+  bool intersects_slice(const BoxType& box) const {
+    if (not slice_.has_value()) {
+      return true;
+    }
+    if constexpr (db::tag_is_retrievable_v<domain::Tags::Element<VolumeDim>,
+                                           BoxType>) {
+      return element_logical_slice_coordinate(
+                 get<domain::Tags::Element<VolumeDim>>(box).id(), *slice_)
+          .has_value();
+    } else {
+      ERROR("Observing the fields on a slice requires the element in the "
+            "DataBox.");
+    }
+  }
+
+  // The element-logical coordinate of the slice, or `std::nullopt` if the
+  // element doesn't intersect it. An element intersects the slice if the
+  // slice is in the half-open block-logical interval [lower, upper) of the
+  // element, so every point of the slice is observed only once. Elements at
+  // the upper boundary of the block also intersect a slice at that boundary.
+  static std::optional<double> element_logical_slice_coordinate(
+      const ElementId<VolumeDim>& element_id,
+      const std::pair<size_t, double>& slice) {
+    const SegmentId& segment_id = element_id.segment_id(slice.first);
+    const double lower = segment_id.endpoint(Side::Lower);
+    const double upper = segment_id.endpoint(Side::Upper);
+    if (slice.second < lower or slice.second > upper or
+        (slice.second == upper and upper < 1.)) {
+      return std::nullopt;
+    }
+    return 2. * (slice.second - segment_id.midpoint()) / (upper - lower);
+  }
+
   template <typename Tag>
   static bool print_warning_about_optional() {
     Parallel::printf(
@@ -377,7 +553,10 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
 
   std::string subfile_path_;
   std::unordered_map<std::string, FloatingPointType> variables_to_observe_{};
+  std::unordered_map<std::string, h5::LossyCompression> lossy_compression_{};
   std::optional<Mesh<VolumeDim>> interpolation_mesh_{};
+  std::optional<std::vector<std::string>> blocks_to_observe_{};
+  std::optional<std::pair<size_t, double>> slice_{};
 };
 
 template <size_t VolumeDim, typename... Tensors,
@@ -389,6 +568,11 @@ ObserveFields<VolumeDim, tmpl::list<Tensors...>,
                   const std::vector<FloatingPointType>& floating_point_types,
                   const std::vector<std::string>& variables_to_observe,
                   std::optional<Mesh<VolumeDim>> interpolation_mesh,
+                  std::optional<std::unordered_map<std::string,
+                                                   h5::LossyCompression>>
+                      lossy_compression,
+                  std::optional<std::vector<std::string>> blocks_to_observe,
+                  std::optional<std::pair<size_t, double>> slice,
                   const Options::Context& context)
     : subfile_path_("/" + subfile_name),
       variables_to_observe_([&context, &floating_point_types,
@@ -416,13 +600,41 @@ ObserveFields<VolumeDim, tmpl::list<Tensors...>,
         }
         return result;
       }()),
-      interpolation_mesh_(interpolation_mesh) {
+      lossy_compression_(std::move(lossy_compression).value_or(
+          std::unordered_map<std::string, h5::LossyCompression>{})),
+      interpolation_mesh_(interpolation_mesh),
+      blocks_to_observe_(std::move(blocks_to_observe)),
+      slice_(slice) {
   ASSERT(
       (... or (db::tag_name<Tensors>() == "InertialCoordinates")),
       "There is no tag with name 'InertialCoordinates' specified "
       "for the observer. Please make sure you specify a tag in the 'Tensors' "
       "list that has the 'db::tag_name()' 'InertialCoordinates'.");
   db::validate_selection<tmpl::list<Tensors...>>(variables_to_observe, context);
+  for (const auto& [name, compression] : lossy_compression_) {
+    (void)compression;
+    if (name == "InertialCoordinates") {
+      PARSE_ERROR(context,
+                  "The coordinates must be written losslessly, so they cannot "
+                  "be listed in 'LossyCompression'.");
+    }
+    if (alg::find(variables_to_observe, name) == variables_to_observe.end()) {
+      PARSE_ERROR(context, "The variable '"
+                               << name
+                               << "' listed in 'LossyCompression' is not "
+                                  "listed in 'VariablesToObserve'.");
+    }
+  }
+  if (slice_.has_value() and
+      (slice_->first >= VolumeDim or std::abs(slice_->second) > 1.)) {
+    PARSE_ERROR(context,
+                "The slice must be in a dimension smaller than "
+                    << VolumeDim
+                    << " at a block-logical coordinate in [-1, 1], but got "
+                       "dimension "
+                    << slice_->first << " and coordinate " << slice_->second
+                    << ".");
+  }
   variables_to_observe_["InertialCoordinates"] =
       coordinates_floating_point_type;
 }
@@ -4,12 +4,26 @@
 #include "ParallelAlgorithms/EventsAndDenseTriggers/EventsAndDenseTriggers.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <pup.h>
 #include <pup_stl.h>
 #include <utility>
 
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
 
+namespace {
+// Heap ordering that puts the earliest check on top
+struct CheckedLater {
+  bool operator()(const std::pair<double, size_t>& lhs,
+                  const std::pair<double, size_t>& rhs) const {
+    return before(rhs.first, lhs.first);
+  }
+
+  evolution_less<double> before;
+};
+}  // namespace
+
 EventsAndDenseTriggers::TriggerRecord::TriggerRecord() = default;
 
 EventsAndDenseTriggers::TriggerRecord::TriggerRecord(
@@ -67,9 +81,47 @@ void EventsAndDenseTriggers::pup(PUP::er& p) {
   p | events_and_triggers_;
   p | next_check_;
   p | before_;
+  if (p.isUnpacking() and initialized()) {
+    rebuild_schedule();
+  }
 }
 
 bool EventsAndDenseTriggers::initialized() const {
   const ScopedFpeState disable_fpes(false);
   return not std::isnan(next_check_);
 }
+
+void EventsAndDenseTriggers::rebuild_schedule() {
+  due_triggers_.clear();
+  scheduled_triggers_.clear();
+  for (size_t i = 0; i < events_and_triggers_.size(); ++i) {
+    if (events_and_triggers_[i].next_check == next_check_) {
+      due_triggers_.push_back(i);
+    } else {
+      scheduled_triggers_.emplace_back(events_and_triggers_[i].next_check, i);
+    }
+  }
+  std::make_heap(scheduled_triggers_.begin(), scheduled_triggers_.end(),
+                 CheckedLater{before_});
+}
+
+void EventsAndDenseTriggers::schedule(const size_t trigger_index) {
+  scheduled_triggers_.emplace_back(
+      events_and_triggers_[trigger_index].next_check, trigger_index);
+  std::push_heap(scheduled_triggers_.begin(), scheduled_triggers_.end(),
+                 CheckedLater{before_});
+}
+
+void EventsAndDenseTriggers::pop_due_triggers() {
+  ASSERT(due_triggers_.empty(), "Not all due triggers were rescheduled.");
+  ASSERT(not scheduled_triggers_.empty(), "No triggers are scheduled.");
+  next_check_ = scheduled_triggers_.front().first;
+  while (not scheduled_triggers_.empty() and
+         scheduled_triggers_.front().first == next_check_) {
+    due_triggers_.push_back(scheduled_triggers_.front().second);
+    std::pop_heap(scheduled_triggers_.begin(), scheduled_triggers_.end(),
+                  CheckedLater{before_});
+    scheduled_triggers_.pop_back();
+  }
+  std::sort(due_triggers_.begin(), due_triggers_.end());
+}
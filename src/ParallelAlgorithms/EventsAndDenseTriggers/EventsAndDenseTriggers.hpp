@@ -7,6 +7,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -52,6 +53,11 @@ struct PreviousTriggerTime : db::SimpleTag {
 
 /// \ingroup EventsAndTriggersGroup
 /// Class that checks dense triggers and runs events
+///
+/// The next check times of the triggers are kept in a priority queue, so
+/// checking for triggers during a step only compares against the earliest
+/// one, and only the triggers due at that time are checked, run, and
+/// rescheduled.
 class EventsAndDenseTriggers {
  private:
   template <typename Event>
@@ -161,9 +167,25 @@ class EventsAndDenseTriggers {
 
   bool initialized() const;
 
+  // Sort the triggers into the ones due at `next_check_` and the queue of
+  // the others.
+  void rebuild_schedule();
+
+  // Add the trigger to the queue at its `next_check`.
+  void schedule(size_t trigger_index);
+
+  // Advance `next_check_` to the earliest check in the queue and remove the
+  // triggers due at that time from the queue.
+  void pop_due_triggers();
+
   Storage events_and_triggers_;
   double next_check_ = std::numeric_limits<double>::signaling_NaN();
   evolution_less<double> before_{};
+  // Not serialized but rebuilt from the `TriggerRecord::next_check`s.
+  // Indices of the triggers due at `next_check_`, in increasing order
+  std::vector<size_t> due_triggers_{};
+  // Heap of the next checks of all other triggers, earliest on top
+  std::vector<std::pair<double, size_t>> scheduled_triggers_{};
 };
 
 template <typename DbTags>
@@ -189,10 +211,8 @@ EventsAndDenseTriggers::TriggeringState EventsAndDenseTriggers::is_ready(
   ASSERT(not events_and_triggers_.empty(),
          "Should not be calling is_ready with no triggers");
 
-  for (auto& trigger_entry : events_and_triggers_) {
-    if (trigger_entry.next_check != next_check_) {
-      continue;
-    }
+  for (const size_t trigger_index : due_triggers_) {
+    auto& trigger_entry = events_and_triggers_[trigger_index];
     if (not trigger_entry.is_triggered.has_value()) {
       const auto is_triggered = trigger_entry.trigger->is_triggered(
           box, cache, array_index, component);
@@ -216,7 +236,8 @@ EventsAndDenseTriggers::TriggeringState EventsAndDenseTriggers::is_ready(
     }
   }
 
-  for (auto& trigger_entry : events_and_triggers_) {
+  for (const size_t trigger_index : due_triggers_) {
+    const auto& trigger_entry = events_and_triggers_[trigger_index];
     if (trigger_entry.is_triggered != std::optional{true}) {
       continue;
     }
@@ -249,7 +270,8 @@ void EventsAndDenseTriggers::run_events(
   auto observation_box =
       make_observation_box<compute_tags>(make_not_null(&box));
 
-  for (auto& trigger_entry : events_and_triggers_) {
+  for (const size_t trigger_index : due_triggers_) {
+    auto& trigger_entry = events_and_triggers_[trigger_index];
     if (trigger_entry.is_triggered == std::optional{true}) {
       db::mutate<::Tags::PreviousTriggerTime>(
           [&trigger_entry](const gsl::not_null<std::optional<double>*>
@@ -258,6 +280,8 @@ void EventsAndDenseTriggers::run_events(
                 trigger_entry.trigger->previous_trigger_time();
           },
           make_not_null(&box));
+      observation_box.template reset_items_depending_on<
+          tmpl::list<::Tags::PreviousTriggerTime>>();
       for (const auto& event : trigger_entry.events) {
         event->run(make_not_null(&observation_box), cache, array_index,
                    component, observation_value);
@@ -269,6 +293,8 @@ void EventsAndDenseTriggers::run_events(
                 std::numeric_limits<double>::signaling_NaN();
           },
           make_not_null(&box));
+      observation_box.template reset_items_depending_on<
+          tmpl::list<::Tags::PreviousTriggerTime>>();
     }
     // Mark this trigger as handled so we will not reprocess it if
     // this method or is_ready is called again.
@@ -286,25 +312,25 @@ bool EventsAndDenseTriggers::reschedule(
   ASSERT(not events_and_triggers_.empty(),
          "Should not be calling run_events with no triggers");
 
-  double new_next_check = before_.infinity();
-  for (auto& trigger_entry : events_and_triggers_) {
-    if (trigger_entry.next_check == next_check_) {
-      const std::optional<double> next_check =
-          trigger_entry.trigger->next_check_time(box, cache, array_index,
-                                                 component);
-      if (not next_check.has_value()) {
-        return false;
-      }
-      trigger_entry.next_check = *next_check;
-      trigger_entry.num_events_ready = 0;
-    }
-    if (before_(trigger_entry.next_check, new_next_check)) {
-      new_next_check = trigger_entry.next_check;
+  // Triggers are removed from the due list once they are rescheduled, so a
+  // retry after a failure continues with the remaining ones.
+  while (not due_triggers_.empty()) {
+    const size_t trigger_index = due_triggers_.front();
+    auto& trigger_entry = events_and_triggers_[trigger_index];
+    const std::optional<double> next_check =
+        trigger_entry.trigger->next_check_time(box, cache, array_index,
+                                               component);
+    if (not next_check.has_value()) {
+      return false;
     }
+    trigger_entry.next_check = *next_check;
+    trigger_entry.num_events_ready = 0;
     trigger_entry.is_triggered.reset();
+    schedule(trigger_index);
+    due_triggers_.erase(due_triggers_.begin());
   }
 
-  next_check_ = new_next_check;
+  pop_due_triggers();
   return true;
 }
 
@@ -325,6 +351,7 @@ void EventsAndDenseTriggers::initialize(const db::DataBox<DbTags>& box) {
   for (auto& trigger_record : events_and_triggers_) {
     trigger_record.next_check = next_check_;
   }
+  rebuild_schedule();
 }
 
 template <>
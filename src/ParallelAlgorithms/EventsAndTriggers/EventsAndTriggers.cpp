@@ -4,6 +4,10 @@
 #include "ParallelAlgorithms/EventsAndTriggers/EventsAndTriggers.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <pup.h>
 #include <pup_stl.h>
 #include <utility>
@@ -20,9 +24,55 @@ void EventsAndTriggers::TriggerAndEvents::pup(PUP::er& p) {
   p | events;
 }
 
-EventsAndTriggers::EventsAndTriggers() = default;
+EventsAndTriggers::EventsAndTriggers()
+    : decision_cache_(std::make_unique<DecisionCache>()) {}
 
 EventsAndTriggers::EventsAndTriggers(Storage events_and_triggers)
-    : events_and_triggers_(std::move(events_and_triggers)) {}
+    : events_and_triggers_(std::move(events_and_triggers)),
+      decision_cache_(std::make_unique<DecisionCache>()) {
+  find_element_independent_triggers();
+}
+
+void EventsAndTriggers::pup(PUP::er& p) {
+  p | events_and_triggers_;
+  if (p.isUnpacking()) {
+    find_element_independent_triggers();
+    decision_cache_ = std::make_unique<DecisionCache>();
+  }
+}
+
+void EventsAndTriggers::find_element_independent_triggers() {
+  element_independent_.clear();
+  element_independent_.reserve(events_and_triggers_.size());
+  for (const auto& trigger_and_events : events_and_triggers_) {
+    element_independent_.push_back(
+        trigger_and_events.trigger->is_element_independent());
+  }
+}
+
+std::optional<bool> EventsAndTriggers::cached_decision(
+    const size_t trigger_index,
+    const Event::ObservationValue& observation_value) const {
+  const std::lock_guard lock(decision_cache_->mutex);
+  if (decision_cache_->observation_value.value != observation_value.value or
+      decision_cache_->observation_value.name != observation_value.name or
+      decision_cache_->decisions.empty()) {
+    return std::nullopt;
+  }
+  return decision_cache_->decisions[trigger_index];
+}
 
-void EventsAndTriggers::pup(PUP::er& p) { p | events_and_triggers_; }
+void EventsAndTriggers::cache_decision(
+    const size_t trigger_index,
+    const Event::ObservationValue& observation_value,
+    const bool decision) const {
+  const std::lock_guard lock(decision_cache_->mutex);
+  if (decision_cache_->observation_value.value != observation_value.value or
+      decision_cache_->observation_value.name != observation_value.name or
+      decision_cache_->decisions.empty()) {
+    decision_cache_->observation_value = observation_value;
+    decision_cache_->decisions.assign(events_and_triggers_.size(),
+                                      std::nullopt);
+  }
+  decision_cache_->decisions[trigger_index] = decision;
+}
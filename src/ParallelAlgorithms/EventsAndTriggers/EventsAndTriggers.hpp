@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <pup.h>
 #include <vector>
@@ -69,6 +71,15 @@ class EventsAndTriggers {
   /// method, but the last argument can be passed to override this.
   /// It must be a functor taking a `const Trigger&` and returning
   /// `bool`.
+  ///
+  /// Triggers that are `Trigger::is_element_independent()` are checked only
+  /// by the first element on the node that runs its events at a given
+  /// `observation_value`, and the other elements reuse the decision. This is
+  /// not done when the trigger check is overridden.
+  ///
+  /// All events that run share one `ObservationBox`, so each compute item
+  /// needed by the events is evaluated at most once, unless an event mutates
+  /// one of its arguments.
   template <typename DbTags, typename Metavariables, typename ArrayIndex,
             typename Component, typename CheckTrigger = std::nullptr_t>
   void run_events(const gsl::not_null<db::DataBox<DbTags>*> box,
@@ -84,13 +95,23 @@ class EventsAndTriggers {
         db::is_compute_tag<tmpl::_1>>>;
     std::optional<decltype(make_observation_box<compute_tags>(box))>
         observation_box{};
-    for (const auto& trigger_and_events : events_and_triggers_) {
-      const auto& trigger = trigger_and_events.trigger;
-      const auto& events = trigger_and_events.events;
+    for (size_t i = 0; i < events_and_triggers_.size(); ++i) {
+      const auto& trigger = events_and_triggers_[i].trigger;
+      const auto& events = events_and_triggers_[i].events;
       const bool is_triggered = [&]() {
         if constexpr (std::is_same_v<std::decay_t<CheckTrigger>,
                                      std::nullptr_t>) {
-          return trigger->is_triggered(*box);
+          if (not element_independent_[i]) {
+            return trigger->is_triggered(*box);
+          }
+          const std::optional<bool> cached =
+              cached_decision(i, observation_value);
+          if (cached.has_value()) {
+            return *cached;
+          }
+          const bool decision = trigger->is_triggered(*box);
+          cache_decision(i, observation_value, decision);
+          return decision;
         } else {
           return check_trigger(std::as_const(*trigger));
         }
@@ -120,10 +141,32 @@ class EventsAndTriggers {
   }
 
  private:
+  // Trigger decisions at the most recent observation value. Since the
+  // EventsAndTriggers live in the const global cache, the decisions are shared
+  // by all elements on the node.
+  struct DecisionCache {
+    std::mutex mutex{};
+    Event::ObservationValue observation_value{};
+    std::vector<std::optional<bool>> decisions{};
+  };
+
+  void find_element_independent_triggers();
+
+  std::optional<bool> cached_decision(
+      size_t trigger_index,
+      const Event::ObservationValue& observation_value) const;
+
+  void cache_decision(size_t trigger_index,
+                      const Event::ObservationValue& observation_value,
+                      bool decision) const;
+
   // The unique pointer contents *must* be treated as const everywhere
   // in order to make the const global cache behave sanely.  They are
   // only non-const to make pup work.
   Storage events_and_triggers_;
+  // Not serialized but recomputed from the triggers
+  std::vector<bool> element_independent_{};
+  std::unique_ptr<DecisionCache> decision_cache_{};
 };
 
 template <>
@@ -10,6 +10,7 @@
 #include "Options/Options.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Trigger.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -32,6 +33,8 @@ class Always : public Trigger {
   using argument_tags = tmpl::list<>;
 
   bool operator()() const { return true; }
+
+  bool is_element_independent() const override { return true; }
 };
 
 /// \ingroup EventsAndTriggersGroup
@@ -57,6 +60,10 @@ class Not : public Trigger {
     return not negated_trigger_->is_triggered(box);
   }
 
+  bool is_element_independent() const override {
+    return negated_trigger_->is_element_independent();
+  }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) { p | negated_trigger_; }
 
@@ -93,6 +100,12 @@ class And : public Trigger {
     return true;
   }
 
+  bool is_element_independent() const override {
+    return alg::all_of(combined_triggers_, [](const auto& trigger) {
+      return trigger->is_element_independent();
+    });
+  }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) { p | combined_triggers_; }
 
@@ -129,6 +142,12 @@ class Or : public Trigger {
     return false;
   }
 
+  bool is_element_independent() const override {
+    return alg::all_of(combined_triggers_, [](const auto& trigger) {
+      return trigger->is_element_independent();
+    });
+  }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) { p | combined_triggers_; }
 
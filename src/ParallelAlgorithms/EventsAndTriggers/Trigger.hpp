@@ -29,6 +29,14 @@ class Trigger : public PUP::able {
 
   WRAPPED_PUPable_abstract(Trigger);  // NOLINT
 
+  /// \brief Whether the trigger fires identically on all elements that run
+  /// their events at the same observation value, e.g. because it depends only
+  /// on the time or the slab number.
+  ///
+  /// `EventsAndTriggers` checks such triggers only once per node for each
+  /// observation value and shares the decision between the elements.
+  virtual bool is_element_independent() const { return false; }
+
   template <typename DbTags>
   bool is_triggered(const db::DataBox<DbTags>& box) const {
     using factory_classes =
@@ -6,15 +6,22 @@
 #include <algorithm>
 #include <cstddef>
 #include <deque>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Parallel/Printf/Printf.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolatorReceiveVolumeData.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeString.hpp"
+#include "Utilities/PrettyType.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
 
 /// \cond
 
@@ -39,12 +46,28 @@ struct HolderTag;
 
 namespace intrp {
 namespace Actions {
+namespace detail {
+CREATE_HAS_STATIC_MEMBER_VARIABLE(max_outstanding_temporal_ids)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(max_outstanding_temporal_ids)
+}  // namespace detail
 
 /// \ingroup ActionsGroup
 /// \brief Cleans up stored volume data that is no longer needed.
 ///
 /// Called by InterpolationTargetReceiveVars.
 ///
+/// The volume data at a `temporal_id` is held until all
+/// InterpolationTargets have interpolated at it, so a single target that
+/// falls behind (e.g. a horizon find that fails to converge) makes the memory
+/// of the Interpolator grow without bound. An InterpolationTargetTag can
+/// bound this by defining `static constexpr size_t
+/// max_outstanding_temporal_ids`. Whenever the Interpolator holds volume data
+/// at more `temporal_id`s that this target has not finished, the oldest ones
+/// are abandoned for this target: they are treated as if the target had
+/// finished them, so their volume data can be removed, and a warning is
+/// printed. The target never receives interpolated data at an abandoned
+/// `temporal_id`.
+///
 /// Uses:
 /// - Databox:
 ///   - `Tags::InterpolatedVarsHolders<Metavariables>`
@@ -67,65 +90,127 @@ struct CleanUpInterpolator {
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& /*array_index*/,
       const typename InterpolationTargetTag::temporal_id::type& temporal_id) {
-    // Signal that this InterpolationTarget is done at this time.
+    using TemporalId = typename InterpolationTargetTag::temporal_id::type;
+    using VolumeVarsInfoTag = Tags::VolumeVarsInfo<
+        Metavariables, typename InterpolationTargetTag::temporal_id>;
+    // The temporal_ids at which the volume data might no longer be needed
+    std::vector<TemporalId> temporal_ids_to_check{temporal_id};
+
+    // Signal that this InterpolationTarget is done at this time, and abandon
+    // the oldest temporal_ids of targets that have too many outstanding.
     db::mutate<Tags::InterpolatedVarsHolders<Metavariables>>(
-        [&temporal_id](
+        [&temporal_id, &temporal_ids_to_check,
+         &volume_vars_info = db::get<VolumeVarsInfoTag>(box)](
             const gsl::not_null<
                 typename Tags::InterpolatedVarsHolders<Metavariables>::type*>
                 holders) {
           get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(*holders)
               .temporal_ids_when_data_has_been_interpolated.push_back(
                   temporal_id);
+          tmpl::for_each<typename Metavariables::interpolation_target_tags>(
+              [&holders, &temporal_ids_to_check,
+               &volume_vars_info](auto tag) {
+                using Tag = typename decltype(tag)::type;
+                if constexpr (detail::using_interpolator_component_v<
+                                  Metavariables, Tag> and
+                              std::is_same_v<
+                                  typename InterpolationTargetTag::temporal_id,
+                                  typename Tag::temporal_id> and
+                              detail::has_max_outstanding_temporal_ids_v<
+                                  Tag, size_t>) {
+                  auto& holder =
+                      get<Vars::HolderTag<Tag, Metavariables>>(*holders);
+                  std::vector<TemporalId> outstanding_temporal_ids{};
+                  for (const auto& [held_temporal_id, unused_infos] :
+                       volume_vars_info) {
+                    (void)unused_infos;
+                    if (not alg::found(
+                            holder.temporal_ids_when_data_has_been_interpolated,
+                            held_temporal_id)) {
+                      outstanding_temporal_ids.push_back(held_temporal_id);
+                    }
+                  }
+                  if (outstanding_temporal_ids.size() >
+                      Tag::max_outstanding_temporal_ids) {
+                    alg::sort(outstanding_temporal_ids);
+                    const size_t num_to_abandon =
+                        outstanding_temporal_ids.size() -
+                        Tag::max_outstanding_temporal_ids;
+                    for (size_t i = 0; i < num_to_abandon; ++i) {
+                      const auto& abandoned_temporal_id =
+                          outstanding_temporal_ids[i];
+                      Parallel::printf(
+                          "Warning: The Interpolator abandons %s at "
+                          "temporal_id %s because the target has more than %zu "
+                          "outstanding temporal_ids.\n",
+                          pretty_type::name<Tag>(),
+                          std::string(MakeString{} << abandoned_temporal_id),
+                          Tag::max_outstanding_temporal_ids);
+                      holder.temporal_ids_when_data_has_been_interpolated
+                          .push_back(abandoned_temporal_id);
+                      holder.infos.erase(abandoned_temporal_id);
+                      temporal_ids_to_check.push_back(abandoned_temporal_id);
+                    }
+                  }
+                }
+              });
         },
         make_not_null(&box));
 
-    // If we don't need any of the volume data anymore for this
-    // temporal_id, we will remove them.
-    bool this_temporal_id_is_done = true;
+    // If we don't need any of the volume data anymore for these
+    // temporal_ids, we will remove them.
+    bool remove_any_temporal_id = false;
     const auto& holders =
         db::get<Tags::InterpolatedVarsHolders<Metavariables>>(box);
-    tmpl::for_each<typename Metavariables::interpolation_target_tags>(
-        [&holders, &this_temporal_id_is_done, &temporal_id](auto tag) {
-          using Tag = typename decltype(tag)::type;
-          // Here we decide whether this interpolation target is "done" (i.e. it
-          // does not need to interpolate) at this temporal_id. If it is "done",
-          // then we don't need to store the volume data. Usually "done" means
-          // that it has already done its interpolation at this temporal_id. But
-          // note that if an interpolation target is not using the Interpolator
-          // at all, it is considered "done", because we don't need any volume
-          // data for it and should not store it. Similarly, interpolation
-          // targets whose temporal_id has a different type than TemporalId are
-          // considered "done" because they too do not use the Interpolator and
-          // don't need volume data to be saved.
-          if constexpr (detail::using_interpolator_component_v<Metavariables,
-                                                               Tag> and
-                        std::is_same_v<
-                            typename InterpolationTargetTag::temporal_id,
-                            typename Tag::temporal_id>) {
-            const auto& finished_temporal_ids =
-                get<Vars::HolderTag<Tag, Metavariables>>(holders)
-                    .temporal_ids_when_data_has_been_interpolated;
-            if (not alg::found(finished_temporal_ids, temporal_id)) {
-              this_temporal_id_is_done = false;
+    for (const auto& temporal_id_to_check : temporal_ids_to_check) {
+      bool this_temporal_id_is_done = true;
+      tmpl::for_each<typename Metavariables::interpolation_target_tags>(
+          [&holders, &this_temporal_id_is_done,
+           &temporal_id_to_check](auto tag) {
+            using Tag = typename decltype(tag)::type;
+            // Here we decide whether this interpolation target is "done" (i.e.
+            // it does not need to interpolate) at this temporal_id. If it is
+            // "done", then we don't need to store the volume data. Usually
+            // "done" means that it has already done its interpolation at this
+            // temporal_id. But note that if an interpolation target is not
+            // using the Interpolator at all, it is considered "done", because
+            // we don't need any volume data for it and should not store it.
+            // Similarly, interpolation targets whose temporal_id has a
+            // different type than TemporalId are considered "done" because
+            // they too do not use the Interpolator and don't need volume data
+            // to be saved.
+            if constexpr (detail::using_interpolator_component_v<Metavariables,
+                                                                 Tag> and
+                          std::is_same_v<
+                              typename InterpolationTargetTag::temporal_id,
+                              typename Tag::temporal_id>) {
+              const auto& finished_temporal_ids =
+                  get<Vars::HolderTag<Tag, Metavariables>>(holders)
+                      .temporal_ids_when_data_has_been_interpolated;
+              if (not alg::found(finished_temporal_ids, temporal_id_to_check)) {
+                this_temporal_id_is_done = false;
+              }
             }
-          }
-        });
+          });
 
-    // We don't need any more volume data for this temporal_id, so
-    // remove it.  Note that the removal (and the computation of
-    // this_temporal_id_is_done above) loop over only those
-    // InterpolationTargets whose temporal_id type matches
-    // InterpolationTargetTag::temporal_id.
-    if (this_temporal_id_is_done) {
-      db::mutate<Tags::VolumeVarsInfo<
-          Metavariables, typename InterpolationTargetTag::temporal_id>>(
-          [&temporal_id](
-              const gsl::not_null<typename Tags::VolumeVarsInfo<
-                  Metavariables,
-                  typename InterpolationTargetTag::temporal_id>::type*>
-                  volume_vars_info) { volume_vars_info->erase(temporal_id); },
-          make_not_null(&box));
+      // We don't need any more volume data for this temporal_id, so
+      // remove it.  Note that the removal (and the computation of
+      // this_temporal_id_is_done above) loop over only those
+      // InterpolationTargets whose temporal_id type matches
+      // InterpolationTargetTag::temporal_id.
+      if (this_temporal_id_is_done) {
+        db::mutate<VolumeVarsInfoTag>(
+            [&temporal_id_to_check](
+                const gsl::not_null<typename VolumeVarsInfoTag::type*>
+                    volume_vars_info) {
+              volume_vars_info->erase(temporal_id_to_check);
+            },
+            make_not_null(&box));
+        remove_any_temporal_id = true;
+      }
+    }
 
+    if (remove_any_temporal_id) {
       // Clean up temporal_ids_when_data_has_been_interpolated, if
       // it is too large.
       [[maybe_unused]] constexpr size_t finished_temporal_ids_max_size = 1000;
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Domain/Tags.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/Observer/Actions/ObserverRegistration.hpp"
@@ -27,6 +28,7 @@
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -42,7 +44,10 @@ ElementVolumeData construct_element_volume_data(
                                                TemporalIdTag>::Info& info) {
   std::vector<TensorComponent> components{};
 
-  const auto& all_source_vars = info.source_vars_from_element;
+  Variables<typename Metavariables::interpolator_source_vars>
+      restored_source_vars{};
+  const auto& all_source_vars =
+      info.source_vars(make_not_null(&restored_source_vars));
   tmpl::for_each<typename Metavariables::interpolator_source_vars>(
       [&components, &all_source_vars](auto source_var_tag_v) {
         using source_var_tag =
@@ -5,11 +5,14 @@
 
 #include <cstddef>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -46,6 +49,7 @@ namespace Actions {
 ///   - `Tags::IndicesOfFilledInterpPoints`
 ///   - `Tags::IndicesOfInvalidInterpPoints`
 ///   - `Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>`
+///   - `Tags::PreviousBlockLogicalCoords<VolumeDim>` (if in the DataBox)
 ///
 /// For requirements on InterpolationTargetTag, see InterpolationTarget
 template <typename InterpolationTargetTag>
@@ -61,6 +65,16 @@ struct SendPointsToInterpolator {
         InterpolationTargetTag>(box, cache, temporal_id);
     InterpolationTarget_detail::set_up_interpolation<InterpolationTargetTag>(
         make_not_null(&box), temporal_id, coords);
+    using previous_coords_tag =
+        Tags::PreviousBlockLogicalCoords<Metavariables::volume_dim>;
+    if constexpr (db::tag_is_retrievable_v<previous_coords_tag,
+                                           db::DataBox<DbTags>>) {
+      // Keep the coordinates as an initial guess for the next points
+      db::mutate<previous_coords_tag>(
+          [&coords](const gsl::not_null<typename previous_coords_tag::type*>
+                        previous_coords) { *previous_coords = coords; },
+          make_not_null(&box));
+    }
 
     // If all target points are invalid, we need to notify the target as no
     // interpolation is done.
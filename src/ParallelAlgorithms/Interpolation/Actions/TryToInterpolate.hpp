@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
@@ -56,10 +58,18 @@ void interpolate_data(
               typename InterpolationTargetTag::temporal_id>::type*>
               volume_vars_info,
           const Domain<Metavariables::volume_dim>& domain) {
-        auto& interp_info =
+        auto& holder =
             get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
-                *holders)
-                .infos.at(temporal_id);
+                *holders);
+        auto& interp_info = holder.infos.at(temporal_id);
+
+        // Reuse the interpolants built for a previous temporal_id if the
+        // target points haven't changed
+        if (holder.cached_block_coord_holders !=
+            interp_info.block_coord_holders) {
+          holder.cached_block_coord_holders = interp_info.block_coord_holders;
+          holder.interpolants.clear();
+        }
 
         // Avoid compiler warning for unused variable in some 'if
         // constexpr' branches.
@@ -86,14 +96,51 @@ void interpolate_data(
             }
           }
 
-          // Get element logical coordinates.
+          // Get element logical coordinates of the elements that have no
+          // cached interpolant, or whose mesh has changed.
+          std::vector<ElementId<Metavariables::volume_dim>>
+              uncached_element_ids{};
+          for (const auto& element_id : element_ids) {
+            const auto cached_interpolant =
+                holder.interpolants.find(element_id);
+            if (cached_interpolant == holder.interpolants.end() or
+                cached_interpolant->second.mesh !=
+                    volume_info_outer.second.at(element_id).mesh) {
+              uncached_element_ids.push_back(element_id);
+            }
+          }
           const auto element_coord_holders = element_logical_coordinates(
-              element_ids, interp_info.block_coord_holders);
+              uncached_element_ids, interp_info.block_coord_holders);
+          for (const auto& element_id : uncached_element_ids) {
+            const auto& mesh = volume_info_outer.second.at(element_id).mesh;
+            const auto element_coord_holder =
+                element_coord_holders.find(element_id);
+            if (element_coord_holder == element_coord_holders.end()) {
+              holder.interpolants.insert_or_assign(
+                  element_id, Vars::ElementInterpolant<
+                                  Metavariables::volume_dim>{mesh, {}, {}});
+            } else {
+              holder.interpolants.insert_or_assign(
+                  element_id,
+                  Vars::ElementInterpolant<Metavariables::volume_dim>{
+                      mesh, element_coord_holder->second.offsets,
+                      intrp::Irregular<Metavariables::volume_dim>(
+                          mesh, element_coord_holder->second
+                                    .element_logical_coords)});
+            }
+          }
 
           // Construct local vars and interpolate.
-          for (const auto& element_coord_pair : element_coord_holders) {
-            const auto& element_id = element_coord_pair.first;
+          for (const auto& element_id : element_ids) {
+            const auto& element_interpolant =
+                holder.interpolants.at(element_id);
+            // Skip elements that contain none of the target points
+            if (element_interpolant.offsets.empty()) {
+              continue;
+            }
             auto& volume_info = volume_info_outer.second.at(element_id);
+            Variables<typename Metavariables::interpolator_source_vars>
+                restored_source_vars{};
             auto& vars_to_interpolate =
                 get<::intrp::Tags::VarsToInterpolateToTarget<
                     InterpolationTargetTag>>(volume_info.vars_to_interpolate);
@@ -101,25 +148,50 @@ void interpolate_data(
             if constexpr (InterpolationTarget_detail::
                               has_compute_vars_to_interpolate_v<
                                   InterpolationTargetTag>) {
+              if (InterpolationTarget_detail::
+                      compute_dest_vars_at_target_points<
+                          InterpolationTargetTag,
+                          typename Metavariables::interpolator_source_vars>(
+                          domain, element_id)) {
+                // Interpolate the source variables and compute the
+                // destination variables only at the target points in this
+                // element instead of at all grid points
+                const auto source_vars_at_target_points =
+                    element_interpolant.interpolant.interpolate(
+                        volume_info.source_vars(
+                            make_not_null(&restored_source_vars)));
+                Variables<typename InterpolationTargetTag::
+                              vars_to_interpolate_to_target>
+                    dest_vars_at_target_points(
+                        source_vars_at_target_points.number_of_grid_points());
+                InterpolationTarget_detail::compute_dest_vars_from_source_vars<
+                    InterpolationTargetTag>(
+                    make_not_null(&dest_vars_at_target_points),
+                    source_vars_at_target_points, domain, volume_info.mesh,
+                    element_id, cache, temporal_id);
+                interp_info.vars.emplace_back(
+                    std::move(dest_vars_at_target_points));
+                interp_info.global_offsets.emplace_back(
+                    element_interpolant.offsets);
+                continue;
+              }
               if (vars_to_interpolate.size() == 0) {
                 // vars_to_interpolate has not been filled for
                 // this element at this temporal_id.  So fill it.
                 vars_to_interpolate.initialize(
-                    volume_info.source_vars_from_element
-                        .number_of_grid_points());
+                    volume_info.mesh.number_of_grid_points());
 
                 InterpolationTarget_detail::compute_dest_vars_from_source_vars<
                     InterpolationTargetTag>(
                     make_not_null(&vars_to_interpolate),
-                    volume_info.source_vars_from_element, domain,
-                    volume_info.mesh, element_id, cache, temporal_id);
+                    volume_info.source_vars(
+                        make_not_null(&restored_source_vars)),
+                    domain, volume_info.mesh, element_id, cache, temporal_id);
               }
             }
 
             // Now interpolate.
-            const auto& element_coord_holder = element_coord_pair.second;
-            intrp::Irregular<Metavariables::volume_dim> interpolator(
-                volume_info.mesh, element_coord_holder.element_logical_coords);
+            const auto& interpolator = element_interpolant.interpolant;
             // This first branch is used if compute_vars_to_interpolate exists
             // or if the vars_to_interpolate_to_target is a subset of the
             // interpolator_source_vars.
@@ -140,11 +212,12 @@ void interpolate_data(
               // interpolator_source_vars, then
               // volume_info.source_vars_from_element is the same as
               // volume_info.vars_to_interpolate.
-              interp_info.vars.emplace_back(interpolator.interpolate(
-                  volume_info.source_vars_from_element));
+              interp_info.vars.emplace_back(
+                  interpolator.interpolate(volume_info.source_vars(
+                      make_not_null(&restored_source_vars))));
             }
             interp_info.global_offsets.emplace_back(
-                element_coord_holder.offsets);
+                element_interpolant.offsets);
           }
         }
       },
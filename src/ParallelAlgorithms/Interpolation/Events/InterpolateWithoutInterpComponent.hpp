@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <limits>
 #include <optional>
@@ -13,6 +14,7 @@
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
@@ -73,11 +75,22 @@ class InterpolateWithoutInterpComponent;
  * \brief Does an interpolation onto an InterpolationTargetTag by calling
  * Actions on the InterpolationTarget component.
  *
+ * Each element only interpolates to the target points it contains and sends
+ * just the interpolated values to the target, so the volume data isn't copied
+ * to an `intrp::Interpolator`. To find its target points each element maps
+ * only the target points in a bounding box around the element to the block
+ * logical frame, instead of all target points in all blocks.
+ *
  * \note The `intrp::TargetPoints::Sphere` target is handled specially because
  * it has the potential to be very slow due to it usually having the most points
- * out of all the stationary targets. An optimization for the future would be to
- * have each target be responsible for intelligently computing the
- * `block_logical_coordinates` for it's own points.
+ * out of all the stationary targets. Its bounding box is narrowed down further
+ * by the radii of the sphere.
+ *
+ * The `SourceVarTags` are retrieved from the `ObservationBox` only once the
+ * element knows it contains target points. Source variables that are compute
+ * items on the source, such as the Weyl scalar \f$\Psi_4\f$, are therefore
+ * only evaluated on the elements that contain points of the target, usually a
+ * few elements around a sphere, rather than in the whole volume.
  */
 template <size_t VolumeDim, typename InterpolationTargetTag,
           typename... SourceVarTags>
@@ -122,15 +135,17 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
                  // would be outside our bounding box, and thus wouldn't get
                  // interpolated to. We avoid this by always using DG coords,
                  // even if the mesh is FD.
-                 domain::Tags::Coordinates<VolumeDim, frame>, SourceVarTags...>;
+                 domain::Tags::Coordinates<VolumeDim, frame>,
+                 ::Tags::ObservationBox>;
 
-  template <typename ParallelComponent, typename Metavariables>
+  template <typename ComputeTagsList, typename DataBoxType,
+            typename ParallelComponent, typename Metavariables>
   void operator()(
       const typename InterpolationTargetTag::temporal_id::type& temporal_id,
       const typename Tags::InterpPointInfo<Metavariables>::type& point_infos,
       const Mesh<VolumeDim>& mesh,
-      const tnsr::I<DataVector, VolumeDim, frame> coordinates,
-      const typename SourceVarTags::type&... source_vars_input,
+      const tnsr::I<DataVector, VolumeDim, frame>& coordinates,
+      const ObservationBox<ComputeTagsList, DataBoxType>& box,
       Parallel::GlobalCache<Metavariables>& cache,
       const ElementId<VolumeDim>& array_index,
       const ParallelComponent* const /*meta*/,
@@ -283,9 +298,78 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
         }
       }
     } else {
-      (void)coordinates;
-      block_logical_coords = InterpolationTarget_detail::block_logical_coords<
-          InterpolationTargetTag>(cache, all_target_points, temporal_id);
+      // Only map the target points that lie in a bounding box around this
+      // element to the block logical frame, instead of searching all target
+      // points in all blocks. The bounding box is padded because curved
+      // element boundaries can bulge out between the grid points.
+      std::array<std::pair<double, double>, VolumeDim> min_max_coordinates{};
+      for (size_t i = 0; i < VolumeDim; i++) {
+        const auto [min, max] = alg::minmax_element(coordinates.get(i));
+        const double padding = 0.1 * (*max - *min);
+        gsl::at(min_max_coordinates, i) =
+            std::make_pair(*min - padding, *max + padding);
+      }
+      const Block<VolumeDim>& block =
+          Parallel::get<domain::Tags::Domain<VolumeDim>>(cache)
+              .blocks()[array_index.block_id()];
+      const size_t num_target_points = get<0>(all_target_points).size();
+      block_logical_coords.resize(num_target_points);
+      tnsr::I<double, VolumeDim, frame> target_point{};
+      for (size_t index = 0; index < num_target_points; index++) {
+        bool skip_point = false;
+        for (size_t i = 0; i < VolumeDim; i++) {
+          target_point.get(i) = all_target_points.get(i)[index];
+          if (target_point.get(i) < gsl::at(min_max_coordinates, i).first or
+              target_point.get(i) > gsl::at(min_max_coordinates, i).second) {
+            skip_point = true;
+            break;
+          }
+        }
+        if (skip_point) {
+          continue;
+        }
+        std::optional<tnsr::I<double, VolumeDim, ::Frame::BlockLogical>>
+            block_coords_of_target_point{};
+        if constexpr (Parallel::is_in_global_cache<
+                          Metavariables, domain::Tags::FunctionsOfTime>) {
+          block_coords_of_target_point = block_logical_coordinates_single_point(
+              target_point, block,
+              InterpolationTarget_detail::get_temporal_id_value(temporal_id),
+              Parallel::get<domain::Tags::FunctionsOfTime>(cache));
+        } else {
+          block_coords_of_target_point =
+              block_logical_coordinates_single_point(target_point, block);
+        }
+        if (not block_coords_of_target_point.has_value()) {
+          continue;
+        }
+        // A point on a block boundary must be assigned to the same block as
+        // `block_logical_coordinates` would assign it to, so it isn't
+        // interpolated by the elements of two blocks.
+        if (alg::any_of(*block_coords_of_target_point, [](const double xi) {
+              return std::abs(xi) >=
+                     1.0 - 100.0 * std::numeric_limits<double>::epsilon();
+            })) {
+          tnsr::I<DataVector, VolumeDim, frame> target_point_to_search{};
+          for (size_t i = 0; i < VolumeDim; i++) {
+            target_point_to_search.get(i) = DataVector{target_point.get(i)};
+          }
+          auto block_coords_of_boundary_point =
+              std::move(InterpolationTarget_detail::block_logical_coords<
+                        InterpolationTargetTag>(cache, target_point_to_search,
+                                                temporal_id)[0]);
+          if (block_coords_of_boundary_point.has_value() and
+              block_coords_of_boundary_point->id.get_index() ==
+                  array_index.block_id()) {
+            block_logical_coords[index] =
+                std::move(block_coords_of_boundary_point);
+          }
+          continue;
+        }
+        block_logical_coords[index] =
+            make_id_pair(domain::BlockId(array_index.block_id()),
+                         std::move(block_coords_of_target_point.value()));
+      }
     }
 
     const std::vector<ElementId<VolumeDim>> element_ids{{array_index}};
@@ -303,6 +387,25 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
     // in several steps:
     const auto& element_coord_holder = element_coord_holders.at(array_index);
 
+    const auto send_to_target =
+        [&cache, &block_logical_coords, &element_coord_holder, &temporal_id](
+            Variables<
+                typename InterpolationTargetTag::vars_to_interpolate_to_target>
+                interpolated_vars) {
+          auto& receiver_proxy = Parallel::get_parallel_component<
+              InterpolationTarget<Metavariables, InterpolationTargetTag>>(
+              cache);
+          Parallel::simple_action<Actions::InterpolationTargetVarsFromElement<
+              InterpolationTargetTag>>(
+              receiver_proxy,
+              std::vector<Variables<typename InterpolationTargetTag::
+                                        vars_to_interpolate_to_target>>(
+                  {std::move(interpolated_vars)}),
+              block_logical_coords,
+              std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
+              temporal_id);
+        };
+
     // 1. Get the list of variables
     Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
         interp_vars(mesh.number_of_grid_points());
@@ -327,12 +430,37 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
             return 0;
           };
       expand_pack(copy_to_variables(tmpl::type_<SourceVarTags>{},
-                                    source_vars_input)...);
+                                    get<SourceVarTags>(box))...);
+
+      const auto& volume_domain =
+          get<domain::Tags::Domain<VolumeDim>>(cache);
+      if (InterpolationTarget_detail::compute_dest_vars_at_target_points<
+              InterpolationTargetTag, tmpl::list<SourceVarTags...>>(
+              volume_domain, array_index)) {
+        // Interpolate the source variables and compute the destination
+        // variables only at the target points in this element instead of at
+        // all grid points
+        const auto source_vars_at_target_points =
+            intrp::Irregular<VolumeDim>(
+                mesh, element_coord_holder.element_logical_coords)
+                .interpolate(source_vars);
+        Variables<
+            typename InterpolationTargetTag::vars_to_interpolate_to_target>
+            dest_vars_at_target_points(
+                source_vars_at_target_points.number_of_grid_points());
+        InterpolationTarget_detail::compute_dest_vars_from_source_vars<
+            InterpolationTargetTag>(make_not_null(&dest_vars_at_target_points),
+                                    source_vars_at_target_points,
+                                    volume_domain, mesh, array_index, cache,
+                                    temporal_id);
+        send_to_target(std::move(dest_vars_at_target_points));
+        return;
+      }
 
       InterpolationTarget_detail::compute_dest_vars_from_source_vars<
           InterpolationTargetTag>(make_not_null(&interp_vars), source_vars,
-                                  get<domain::Tags::Domain<VolumeDim>>(cache),
-                                  mesh, array_index, cache, temporal_id);
+                                  volume_domain, mesh, array_index, cache,
+                                  temporal_id);
     } else {
       // 1b. There is no compute_vars_to_interpolate. So copy the
       // source vars directly into the variables.
@@ -355,7 +483,7 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
             return 0;
           };
       expand_pack(copy_to_variables(tmpl::type_<SourceVarTags>{},
-                                    source_vars_input)...);
+                                    get<SourceVarTags>(box))...);
     }
 
     // 2. Set up interpolator
@@ -363,17 +491,7 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
         mesh, element_coord_holder.element_logical_coords);
 
     // 3. Interpolate and send interpolated data to target
-    auto& receiver_proxy = Parallel::get_parallel_component<
-        InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
-    Parallel::simple_action<
-        Actions::InterpolationTargetVarsFromElement<InterpolationTargetTag>>(
-        receiver_proxy,
-        std::vector<Variables<
-            typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
-            {interpolator.interpolate(interp_vars)}),
-        block_logical_coords,
-        std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
-        temporal_id);
+    send_to_target(interpolator.interpolate(interp_vars));
   }
 
   using is_ready_argument_tags = tmpl::list<>;
@@ -16,6 +16,8 @@
 #include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/Structure/BlockId.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 
 namespace intrp {
 
@@ -91,6 +93,19 @@ void operator|(PUP::er& p, Info<VolumeDim, TagList>& t) {  // NOLINT
   pup(p, t);
 }
 
+/// \brief Holds the interpolant from an `Element` to the target points it
+/// contains, so it can be reused while the target points don't change.
+template <size_t VolumeDim>
+struct ElementInterpolant {
+  /// The mesh of the `Element` that the `interpolant` was built for
+  Mesh<VolumeDim> mesh{};
+  /// `offsets[i]` is the index into `Info::block_coord_holders` that
+  /// corresponds to the index `i` of the interpolated points. Empty if the
+  /// `Element` contains none of the target points.
+  std::vector<size_t> offsets{};
+  Irregular<VolumeDim> interpolant{};
+};
+
 /// Holds `Info`s at all `temporal_id`s for a given
 /// `InterpolationTargetTag`.  Also holds `temporal_id`s when data has
 /// been interpolated; this is used for cleanup purposes.  All
@@ -106,6 +121,19 @@ struct Holder {
       infos;
   std::deque<typename InterpolationTargetTag::temporal_id::type>
       temporal_ids_when_data_has_been_interpolated;
+  /// The `block_coord_holders` that the `interpolants` were built for.
+  ///
+  /// Targets whose points don't change in the block logical frame, e.g.
+  /// time-independent targets with time-independent maps, send the same
+  /// `block_coord_holders` at every `temporal_id`. Then the `interpolants`
+  /// are reused, and interpolating reduces to applying them. The cache is
+  /// cleared when `block_coord_holders` differ from the cached ones. It is
+  /// not serialized.
+  std::vector<BlockLogicalCoords<Metavariables::volume_dim>>
+      cached_block_coord_holders{};
+  std::unordered_map<ElementId<Metavariables::volume_dim>,
+                     ElementInterpolant<Metavariables::volume_dim>>
+      interpolants{};
 };
 
 template <typename Metavariables, typename InterpolationTargetTag,
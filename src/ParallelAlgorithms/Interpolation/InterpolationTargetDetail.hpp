@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <unordered_set>
@@ -18,6 +19,8 @@
 #include "Domain/CoordinateMaps/Composition.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/ElementToBlockLogicalMap.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/Structure/ElementId.hpp"
 #include "Domain/TagsTimeDependent.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
@@ -63,6 +66,8 @@ template <typename TemporalId>
 struct CurrentTemporalId;
 template <typename TemporalId>
 struct TemporalIds;
+template <size_t VolumeDim>
+struct PreviousBlockLogicalCoords;
 }  // namespace Tags
 namespace TargetPoints {
 template <typename InterpolationTargetTag, typename Frame>
@@ -521,6 +526,9 @@ void add_received_variables(
 /// and one Action indirectly calls this version of block_logical_coords:
 /// - SendPointsToInterpolator (called by AddTemporalIdsToInterpolationTarget
 ///                             and by FindApparentHorizon)
+///
+/// If `initial_guess` is given, it is used as an initial guess for the block
+/// logical coordinates of the `coords` (see `::block_logical_coordinates`).
 template <typename InterpolationTargetTag, typename Metavariables,
           typename TemporalId>
 auto block_logical_coords(
@@ -528,15 +536,27 @@ auto block_logical_coords(
     const tnsr::I<
         DataVector, Metavariables::volume_dim,
         typename InterpolationTargetTag::compute_target_points::frame>& coords,
-    const TemporalId& temporal_id) {
+    const TemporalId& temporal_id,
+    const std::vector<BlockLogicalCoords<Metavariables::volume_dim>>*
+        initial_guess = nullptr) {
   const auto& domain =
       get<domain::Tags::Domain<Metavariables::volume_dim>>(cache);
+  const auto find_coords = [&domain, &coords, &initial_guess](
+                               const double time,
+                               const domain::FunctionsOfTimeMap&
+                                   functions_of_time) {
+    return initial_guess == nullptr
+               ? ::block_logical_coordinates(domain, coords, time,
+                                             functions_of_time)
+               : ::block_logical_coordinates(domain, coords, *initial_guess,
+                                             time, functions_of_time);
+  };
   if constexpr (std::is_same_v<typename InterpolationTargetTag::
                                    compute_target_points::frame,
                                ::Frame::Grid>) {
     // Frame is grid frame, so don't need any FunctionsOfTime,
     // whether or not the maps are time_dependent.
-    return ::block_logical_coordinates(domain, coords);
+    return find_coords(std::numeric_limits<double>::signaling_NaN(), {});
   }
 
   if (domain.is_time_dependent()) {
@@ -546,8 +566,7 @@ auto block_logical_coords(
       // time-dependent is responsible for ensuring
       // that functions_of_time are up to date at temporal_id.
       const auto& functions_of_time = get<domain::Tags::FunctionsOfTime>(cache);
-      return ::block_logical_coordinates(
-          domain, coords,
+      return find_coords(
           InterpolationTarget_detail::get_temporal_id_value(temporal_id),
           functions_of_time);
     } else {
@@ -567,7 +586,7 @@ auto block_logical_coords(
   }
 
   // Time-independent case.
-  return ::block_logical_coordinates(domain, coords);
+  return find_coords(std::numeric_limits<double>::signaling_NaN(), {});
 }
 
 /// Version of block_logical_coords that computes the interpolation
@@ -581,16 +600,29 @@ auto block_logical_coords(
 /// Currently one Action directly calls this version of block_logical_coords:
 /// - SendPointsToInterpolator (called by AddTemporalIdsToInterpolationTarget
 ///                             and by FindApparentHorizon)
+///
+/// If the DataBox holds `Tags::PreviousBlockLogicalCoords` for the same number
+/// of points, these are used as an initial guess.
 template <typename InterpolationTargetTag, typename DbTags,
           typename Metavariables, typename TemporalId>
 auto block_logical_coords(const db::DataBox<DbTags>& box,
                           const Parallel::GlobalCache<Metavariables>& cache,
                           const TemporalId& temporal_id) {
-  return block_logical_coords<InterpolationTargetTag>(
-      cache,
-      InterpolationTargetTag::compute_target_points::points(
-          box, tmpl::type_<Metavariables>{}, temporal_id),
-      temporal_id);
+  constexpr size_t volume_dim = Metavariables::volume_dim;
+  const auto coords = InterpolationTargetTag::compute_target_points::points(
+      box, tmpl::type_<Metavariables>{}, temporal_id);
+  if constexpr (db::tag_is_retrievable_v<
+                    Tags::PreviousBlockLogicalCoords<volume_dim>,
+                    db::DataBox<DbTags>>) {
+    const auto& previous_coords =
+        db::get<Tags::PreviousBlockLogicalCoords<volume_dim>>(box);
+    if (previous_coords.size() == get<0>(coords).size()) {
+      return block_logical_coords<InterpolationTargetTag>(
+          cache, coords, temporal_id, &previous_coords);
+    }
+  }
+  return block_logical_coords<InterpolationTargetTag>(cache, coords,
+                                                      temporal_id);
 }
 
 /// Version of block_logical_coords for when the coords are
@@ -806,4 +838,48 @@ void compute_dest_vars_from_source_vars(
         make_not_null(&dest_vars_in_inertial_frame), source_vars, mesh);
   }
 }
+
+CREATE_HAS_STATIC_MEMBER_VARIABLE(is_pointwise)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(is_pointwise)
+
+template <typename InterpolationTargetTag, typename = std::void_t<>>
+constexpr bool compute_vars_to_interpolate_has_is_pointwise_v = false;
+
+template <typename InterpolationTargetTag>
+constexpr bool compute_vars_to_interpolate_has_is_pointwise_v<
+    InterpolationTargetTag,
+    std::void_t<typename InterpolationTargetTag::compute_vars_to_interpolate>> =
+    has_is_pointwise_v<
+        typename InterpolationTargetTag::compute_vars_to_interpolate>;
+
+/// Returns true if `compute_dest_vars_from_source_vars` may be called with the
+/// source variables interpolated to the target points of the element instead
+/// of with the volume data, so the destination variables are computed only at
+/// these points.
+///
+/// This is the case if the `compute_vars_to_interpolate` has a
+/// `static constexpr bool is_pointwise = true`, i.e. its overload without
+/// Jacobians doesn't take numerical derivatives, and if no frame
+/// transformation is needed in the element. Frame transformations take
+/// numerical derivatives of the Jacobians in the volume.
+template <typename InterpolationTargetTag, typename SourceTags, size_t Dim>
+bool compute_dest_vars_at_target_points(const Domain<Dim>& domain,
+                                        const ElementId<Dim>& element_id) {
+  if constexpr (compute_vars_to_interpolate_has_is_pointwise_v<
+                    InterpolationTargetTag>) {
+    using dest_vars_tags =
+        typename InterpolationTargetTag::vars_to_interpolate_to_target;
+    constexpr bool needs_frame_transformation =
+        any_index_in_frame_v<SourceTags, Frame::Inertial> and
+        (any_index_in_frame_v<dest_vars_tags, Frame::Grid> or
+         any_index_in_frame_v<dest_vars_tags, Frame::Distorted>);
+    return InterpolationTargetTag::compute_vars_to_interpolate::is_pointwise and
+           not(needs_frame_transformation and
+               domain.blocks()[element_id.block_id()].is_time_dependent());
+  } else {
+    (void)domain;
+    (void)element_id;
+    return false;
+  }
+}
 }  // namespace intrp::InterpolationTarget_detail
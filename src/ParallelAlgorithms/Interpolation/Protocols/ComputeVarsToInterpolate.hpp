@@ -55,6 +55,14 @@ namespace intrp::protocols {
  *   InterpolationTargetTag. The overload without Jacobians treats the case in
  *   which TargetFrame is the same as SrcFrame.
  *
+ * Optionally, the struct can have a `static constexpr bool is_pointwise`. If
+ * it is `true`, the overload without Jacobians must compute the destination
+ * variables at each point only from the source variables at that point, i.e.
+ * without numerical derivatives and independent of the `Mesh`. Elements that
+ * need no frame transformation then interpolate the source variables to the
+ * target points and compute the destination variables only there (see
+ * `intrp::InterpolationTarget_detail::compute_dest_vars_at_target_points`).
+ *
  * Here is an example of a class that conforms to this protocols:
  *
  * \snippet Helpers/ParallelAlgorithms/Interpolation/Examples.hpp ComputeVarsToInterpolate
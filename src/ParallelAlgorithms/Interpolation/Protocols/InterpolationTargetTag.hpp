@@ -81,6 +81,10 @@ constexpr bool if_alias_exists_assert_conforms_to_v =
  *   be interpolating to the interpolation target. Only needed when *not* using
  *   the Interpolator ParallelComponent.
  *
+ * - a `static constexpr size_t max_outstanding_temporal_ids` that bounds the
+ *   number of `temporal_id`s at which the Interpolator holds volume data for
+ *   this target. See `intrp::Actions::CleanUpInterpolator`.
+ *
  * An example of a struct that conforms to this protocol is
  *
  * \snippet Helpers/ParallelAlgorithms/Interpolation/Examples.hpp InterpolationTargetTag
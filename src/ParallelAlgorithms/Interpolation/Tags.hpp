@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <deque>
 #include <optional>
@@ -10,14 +11,18 @@
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
 
 /// \cond
 template <size_t VolumeDim>
@@ -26,6 +31,29 @@ class ElementId;
 
 namespace intrp {
 
+namespace detail {
+CREATE_HAS_STATIC_MEMBER_VARIABLE(interpolator_stores_source_vars_as_float)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(interpolator_stores_source_vars_as_float)
+}  // namespace detail
+
+/// \brief Whether the Interpolator holds the `interpolator_source_vars` it
+/// receives from the elements in single precision.
+///
+/// Set `static constexpr bool interpolator_stores_source_vars_as_float = true;`
+/// in the metavariables to halve the memory of the volume data that the
+/// Interpolator holds for pending temporal ids. The data are restored to
+/// double precision before they are interpolated, so only the rounding of the
+/// held data to single precision affects the interpolated values.
+template <typename Metavariables>
+constexpr bool stores_source_vars_as_float() {
+  if constexpr (detail::has_interpolator_stores_source_vars_as_float_v<
+                    Metavariables, bool>) {
+    return Metavariables::interpolator_stores_source_vars_as_float;
+  } else {
+    return false;
+  }
+}
+
 namespace OptionTags {
 /*!
  * \ingroup OptionGroupsGroup
@@ -120,6 +148,19 @@ struct CompletedTemporalIds : db::SimpleTag {
   using type = std::deque<TemporalId>;
 };
 
+/// The block logical coordinates of the points that a sequential target sent
+/// most recently.
+///
+/// If a target has this tag in its DataBox, the block logical coordinates of
+/// the next points it sends are found with these as an initial guess, provided
+/// the number of points hasn't changed. This is worthwhile when consecutive
+/// sets of points are close to each other, e.g. in the iterations of a horizon
+/// find, and between horizon finds at successive times.
+template <size_t VolumeDim>
+struct PreviousBlockLogicalCoords : db::SimpleTag {
+  using type = std::vector<BlockLogicalCoords<VolumeDim>>;
+};
+
 /// Holds interpolated variables on an InterpolationTarget.
 template <typename InterpolationTargetTag, typename TemporalId>
 struct InterpolatedVars : db::SimpleTag {
@@ -141,7 +182,9 @@ template <typename Metavariables, typename TemporalId>
 struct VolumeVarsInfo : db::SimpleTag {
   struct Info {
     Mesh<Metavariables::volume_dim> mesh;
-    // Variables that have been sent from the Elements.
+    // Variables that have been sent from the Elements. These are empty if
+    // they are held in single precision in `source_vars_as_float`, so
+    // retrieve them with `source_vars()`.
     Variables<typename Metavariables::interpolator_source_vars>
         source_vars_from_element;
     // Variables, for each InterpolationTargetTag, that have been
@@ -151,6 +194,9 @@ struct VolumeVarsInfo : db::SimpleTag {
         db::wrap_tags_in<VarsToInterpolateToTarget,
                          typename Metavariables::interpolation_target_tags>>
         vars_to_interpolate;
+    // The `source_vars_from_element` in single precision if
+    // `intrp::stores_source_vars_as_float<Metavariables>()`
+    std::vector<float> source_vars_as_float{};
     Info() = default;
     Info(
         Mesh<Metavariables::volume_dim> mesh_in,
@@ -162,12 +208,39 @@ struct VolumeVarsInfo : db::SimpleTag {
             vars_to_interpolate_in)
         : mesh(std::move(mesh_in)),
           source_vars_from_element(std::move(source_vars_from_element_in)),
-          vars_to_interpolate(std::move(vars_to_interpolate_in)) {}
+          vars_to_interpolate(std::move(vars_to_interpolate_in)) {
+      if constexpr (stores_source_vars_as_float<Metavariables>()) {
+        source_vars_as_float.assign(
+            source_vars_from_element.data(),
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            source_vars_from_element.data() + source_vars_from_element.size());
+        source_vars_from_element = {};
+      }
+    }
+
+    /// The source variables in double precision. If they are held in single
+    /// precision they are restored into the `buffer`.
+    const Variables<typename Metavariables::interpolator_source_vars>&
+    source_vars(const gsl::not_null<
+                Variables<typename Metavariables::interpolator_source_vars>*>
+                    buffer) const {
+      if constexpr (stores_source_vars_as_float<Metavariables>()) {
+        buffer->initialize(mesh.number_of_grid_points());
+        std::copy(source_vars_as_float.begin(), source_vars_as_float.end(),
+                  buffer->data());
+        return *buffer;
+      } else {
+        (void)buffer;
+        return source_vars_from_element;
+      }
+    }
+
     // NOLINTNEXTLINE(google-runtime-references)
     void pup(PUP::er& p) {
       p | mesh;
       p | source_vars_from_element;
       p | vars_to_interpolate;
+      p | source_vars_as_float;
     }
   };
   using type = std::unordered_map<
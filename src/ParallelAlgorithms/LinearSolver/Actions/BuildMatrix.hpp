@@ -3,8 +3,8 @@
 
 /// \file
 /// Functionality to build the explicit matrix representation of the linear
-/// operator column-by-column. This is useful for debugging and analysis only,
-/// not to actually solve the elliptic problem (that should happen iteratively).
+/// operator column-by-column. This is useful for debugging and analysis, and
+/// to solve small problems directly (see `LinearSolver::Actions::DirectSolve`).
 
 #pragma once
 
@@ -14,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/CompressedMatrix.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "Domain/Structure/ElementId.hpp"
@@ -25,6 +26,7 @@
 #include "IO/Observer/GetSectionObservationKey.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
 #include "IO/Observer/VolumeActions.hpp"
+#include "Options/Auto.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GetSection.hpp"
 #include "Parallel/Phase.hpp"
@@ -52,7 +54,7 @@ struct BuildMatrixOptionsGroup {
 };
 
 struct MatrixSubfileName {
-  using type = std::string;
+  using type = Options::Auto<std::string, Options::AutoLabel::None>;
   using group = BuildMatrixOptionsGroup;
   static constexpr Options::String help = {
       "Subfile name in the volume data H5 files where the matrix will be "
@@ -60,16 +62,17 @@ struct MatrixSubfileName {
       "row index is the order of elements defined by the ElementId in the "
       "volume data, by the order of tensor components encoded in the name of "
       "the components, and by the contiguous ordering of grid points for each "
-      "component."};
+      "component. Set to 'None' to only assemble the matrix in memory."};
 };
 
 }  // namespace OptionTags
 
 namespace Tags {
 
-/// Subfile name in the volume data H5 files where the matrix will be stored.
+/// Subfile name in the volume data H5 files where the matrix will be stored, or
+/// `std::nullopt` if the matrix is only assembled in memory.
 struct MatrixSubfileName : db::SimpleTag {
-  using type = std::string;
+  using type = std::optional<std::string>;
   using option_tags = tmpl::list<OptionTags::MatrixSubfileName>;
   static constexpr bool pass_metavariables = false;
   static type create_from_options(const type& value) { return value; }
@@ -85,12 +88,34 @@ struct LocalFirstIndex : db::SimpleTag {
   using type = size_t;
 };
 
+/// The element that holds the first points of the matrix
+template <size_t Dim>
+struct FirstElementId : db::SimpleTag {
+  using type = ElementId<Dim>;
+};
+
+/// The rows of the matrix that correspond to the points in this element. This
+/// is a block row of the block-sparse matrix, so only the non-zero entries are
+/// stored. Its columns are assembled one by one as the matrix is built.
+template <typename ValueType>
+struct LocalMatrixRows : db::SimpleTag {
+  using type = blaze::CompressedMatrix<ValueType, blaze::columnMajor>;
+};
+
 }  // namespace Tags
 
 namespace Actions {
 
 namespace detail {
 
+template <typename OperandTag>
+using local_matrix_rows_tag =
+    Tags::LocalMatrixRows<typename OperandTag::type::value_type>;
+
+template <typename CoordsTag>
+using first_element_id_tag =
+    Tags::FirstElementId<CoordsTag::type::index_dim(0)>;
+
 /// \brief The total number of grid points (size of the matrix) and the index of
 /// the first grid point in this element (the offset into the matrix
 /// corresponding to this element).
@@ -195,10 +220,10 @@ struct RegisterWithVolumeObserver {
            "The identifier 'Unused' is reserved to indicate that no "
            "observations with this key will be contributed. Use a different "
            "key, or change the identifier 'Unused' to something else.");
-    return {
-        observers::TypeOfObservation::Volume,
-        observers::ObservationKey(get<Tags::MatrixSubfileName>(box) +
-                                  section_observation_key.value_or("Unused"))};
+    return {observers::TypeOfObservation::Volume,
+            observers::ObservationKey(
+                get<Tags::MatrixSubfileName>(box).value_or("Unused") +
+                section_observation_key.value_or("Unused"))};
   }
 };
 
@@ -220,8 +245,11 @@ template <typename IterationIdTag, typename OperandTag,
           typename OperatorAppliedToOperandTag, typename CoordsTag,
           typename ArraySectionIdTag>
 struct CollectTotalNumPoints {
-  using simple_tags = tmpl::list<Tags::TotalNumPoints, Tags::LocalFirstIndex,
-                                 IterationIdTag, OperandTag>;
+  using simple_tags =
+      tmpl::list<Tags::TotalNumPoints, Tags::LocalFirstIndex,
+                 detail::first_element_id_tag<CoordsTag>,
+                 detail::local_matrix_rows_tag<OperandTag>, IterationIdTag,
+                 OperandTag>;
   using compute_tags = tmpl::list<>;
   using const_global_cache_tags =
       tmpl::list<logging::Tags::Verbosity<OptionTags::BuildMatrixOptionsGroup>>;
@@ -264,8 +292,9 @@ struct CollectTotalNumPoints {
         ArraySectionIdTag>>(
         Parallel::ReductionData<Parallel::ReductionDatum<
             std::map<ElementId<Dim>, size_t>, funcl::Merge<>>>{
-            std::map<ElementId<Dim>, size_t>{
-                std::make_pair(array_index, get<OperandTag>(box).size())}},
+            std::map<ElementId<Dim>, size_t>{std::make_pair(
+                array_index,
+                get<OperandTag>(box).number_of_grid_points())}},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
         Parallel::get_parallel_component<ParallelComponent>(cache),
         make_not_null(&section));
@@ -298,16 +327,27 @@ struct PrepareBuildMatrix {
           "Building explicit matrix representation of size %zu x %zu.\n",
           total_num_points, total_num_points);
     }
-    db::mutate<Tags::TotalNumPoints, Tags::LocalFirstIndex, IterationIdTag>(
+    db::mutate<Tags::TotalNumPoints, Tags::LocalFirstIndex,
+               Tags::FirstElementId<Dim>,
+               detail::local_matrix_rows_tag<OperandTag>, IterationIdTag>(
         [captured_total_num_points = total_num_points,
-         captured_local_first_index = local_first_index](
+         captured_local_first_index = local_first_index,
+         &num_points_per_element](
             const auto stored_total_num_points,
-            const auto stored_local_first_index, const auto iteration_id) {
+            const auto stored_local_first_index,
+            const gsl::not_null<ElementId<Dim>*> first_element_id,
+            const auto local_matrix_rows, const auto iteration_id,
+            const size_t local_size) {
           *stored_total_num_points = captured_total_num_points;
           *stored_local_first_index = captured_local_first_index;
+          // Elements are ordered by their ID in the matrix
+          *first_element_id = num_points_per_element.begin()->first;
+          local_matrix_rows->resize(local_size, captured_total_num_points,
+                                    false);
+          local_matrix_rows->reset();
           *iteration_id = 0;
         },
-        make_not_null(&box));
+        make_not_null(&box), get<OperandTag>(box).size());
     // Proceed with algorithm
     Parallel::get_parallel_component<ParallelComponent>(cache)[element_id]
         .perform_algorithm(true);
@@ -374,12 +414,33 @@ struct StoreMatrixColumn {
     // is a column of the operator matrix.
     const auto& operator_applied_to_operand =
         get<OperatorAppliedToOperandTag>(box);
+    // Store its non-zero entries in memory. Columns are assembled in order, so
+    // they can be appended.
+    db::mutate<detail::local_matrix_rows_tag<OperandTag>>(
+        [&operator_applied_to_operand,
+         &iteration_id](const auto local_matrix_rows) {
+          for (size_t row = 0; row < operator_applied_to_operand.size();
+               ++row) {
+            const auto& value = operator_applied_to_operand.data()[row];
+            // Most blocks of the matrix are exactly zero because the operator
+            // only couples nearest neighbors
+            if (value != 0.) {
+              local_matrix_rows->append(row, iteration_id, value);
+            }
+          }
+          local_matrix_rows->finalize(iteration_id);
+        },
+        make_not_null(&box));
     // Write it out to disk
-    detail::observe_matrix_column<ParallelComponent>(
-        iteration_id, operator_applied_to_operand, element_id,
-        get<domain::Tags::Mesh<Dim>>(box), get<CoordsTag>(box),
-        get<Tags::MatrixSubfileName>(box),
-        *observers::get_section_observation_key<ArraySectionIdTag>(box), cache);
+    const auto& subfile_name = get<Tags::MatrixSubfileName>(box);
+    if (subfile_name.has_value()) {
+      detail::observe_matrix_column<ParallelComponent>(
+          iteration_id, operator_applied_to_operand, element_id,
+          get<domain::Tags::Mesh<Dim>>(box), get<CoordsTag>(box),
+          *subfile_name,
+          *observers::get_section_observation_key<ArraySectionIdTag>(box),
+          cache);
+    }
     // Reset operand to zero
     const std::optional<size_t> local_unit_vector_index =
         detail::local_unit_vector_index(iteration_id, local_first_index,
@@ -410,22 +471,42 @@ template <typename IterationIdTag, typename OperandTag,
           typename OperatorAppliedToOperandTag, typename CoordsTag,
           typename ArraySectionIdTag>
 struct ProjectBuildMatrix : tt::ConformsTo<::amr::protocols::Projector> {
-  using return_tags = tmpl::list<Tags::TotalNumPoints, Tags::LocalFirstIndex,
-                                 IterationIdTag, OperandTag>;
+  using return_tags =
+      tmpl::list<Tags::TotalNumPoints, Tags::LocalFirstIndex,
+                 detail::first_element_id_tag<CoordsTag>,
+                 detail::local_matrix_rows_tag<OperandTag>, IterationIdTag,
+                 OperandTag>;
   using argument_tags = tmpl::list<>;
 
   template <typename... AmrData>
   static void apply(const gsl::not_null<size_t*> /*unused*/,
+                    const gsl::not_null<size_t*> /*unused*/,
+                    const gsl::not_null<typename detail::first_element_id_tag<
+                        CoordsTag>::type*> /*unused*/,
+                    const gsl::not_null<typename detail::local_matrix_rows_tag<
+                        OperandTag>::type*>
+                        local_matrix_rows,
+                    const gsl::not_null<typename IterationIdTag::type*>
+                    /*unused*/,
+                    const gsl::not_null<typename OperandTag::type*> /*unused*/,
                     const AmrData&... /*amr_data*/) {
-    // Nothing to do. Everything gets initialized at the start of the algorithm.
+    // Everything gets initialized at the start of the algorithm, but release
+    // the memory of the assembled matrix
+    local_matrix_rows->clear();
   }
 };
 
 /*!
  * \brief Build the explicit matrix representation of the linear operator.
  *
- * This is useful for debugging and analysis only, not to actually solve the
- * elliptic problem (that should happen iteratively).
+ * This is useful for debugging and analysis, and to solve small problems
+ * directly (see `LinearSolver::Actions::DirectSolve`). Large problems should be
+ * solved iteratively, because building the matrix takes one application of
+ * the linear operator per column.
+ *
+ * Each element stores the rows of the matrix that correspond to its points in
+ * `LinearSolver::Tags::LocalMatrixRows`, and optionally writes the columns to
+ * disk (see `LinearSolver::OptionTags::MatrixSubfileName`).
  *
  * Add the `actions` to the action list to build the matrix. The
  * `ApplyOperatorActions` template parameter are the actions that apply the
@@ -0,0 +1,100 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/LinearSolver/Actions/DirectSolve.hpp"
+
+#include <algorithm>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include "DataStructures/CompressedMatrix.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/DynamicMatrix.hpp"
+#include "DataStructures/DynamicVector.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace LinearSolver::Actions::detail {
+
+template <size_t Dim>
+std::map<ElementId<Dim>, DataVector> solve_assembled_matrix(
+    const std::map<ElementId<Dim>,
+                   blaze::CompressedMatrix<double, blaze::columnMajor>>&
+        matrix_rows,
+    const std::map<ElementId<Dim>, DataVector>& source_rows) {
+  ASSERT(matrix_rows.size() == source_rows.size(),
+         "Received the matrix rows of " << matrix_rows.size()
+                                        << " elements but the source of "
+                                        << source_rows.size() << ".");
+  size_t size = 0;
+  for (const auto& [element_id, rows] : matrix_rows) {
+    size += rows.rows();
+  }
+  // Assemble the block rows into one dense matrix
+  blaze::DynamicMatrix<double, blaze::columnMajor> matrix(size, size, 0.);
+  blaze::DynamicVector<double> solution(size);
+  size_t first_row = 0;
+  for (const auto& [element_id, rows] : matrix_rows) {
+    ASSERT(rows.columns() == size,
+           "The matrix rows of element " << element_id << " have "
+                                         << rows.columns()
+                                         << " columns, but the matrix has size "
+                                         << size << ".");
+    for (size_t j = 0; j < size; ++j) {
+      for (auto it = rows.begin(j); it != rows.end(j); ++it) {
+        matrix(first_row + it->index(), j) = it->value();
+      }
+    }
+    const auto& source = source_rows.at(element_id);
+    ASSERT(source.size() == rows.rows(),
+           "The source of element " << element_id << " has size "
+                                    << source.size() << " but its matrix has "
+                                    << rows.rows() << " rows.");
+    std::copy(source.begin(), source.end(), solution.begin() + first_row);
+    first_row += rows.rows();
+  }
+  // Solve with a dense LU factorization with partial pivoting
+  std::vector<blaze::blas_int_t> pivots(size);
+  blaze::getrf(matrix, pivots.data());
+  for (size_t i = 0; i < size; ++i) {
+    if (UNLIKELY(matrix(i, i) == 0.)) {
+      ERROR("Could not factorize the assembled matrix (size "
+            << size << "): it is singular.");
+    }
+  }
+  blaze::getrs(matrix, solution, 'N', pivots.data());
+  // Split the solution into the parts of all elements
+  std::map<ElementId<Dim>, DataVector> result{};
+  first_row = 0;
+  for (const auto& [element_id, rows] : matrix_rows) {
+    DataVector local_solution{rows.rows()};
+    std::copy(solution.begin() + first_row,
+              solution.begin() + first_row + rows.rows(),
+              local_solution.begin());
+    result.emplace(element_id, std::move(local_solution));
+    first_row += rows.rows();
+  }
+  return result;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                           \
+  template std::map<ElementId<DIM(data)>, DataVector>                    \
+  solve_assembled_matrix(                                                \
+      const std::map<ElementId<DIM(data)>,                               \
+                     blaze::CompressedMatrix<double, blaze::columnMajor>>& \
+          matrix_rows,                                                   \
+      const std::map<ElementId<DIM(data)>, DataVector>& source_rows);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+
+}  // namespace LinearSolver::Actions::detail
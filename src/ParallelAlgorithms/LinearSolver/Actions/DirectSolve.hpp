@@ -0,0 +1,222 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Actions to solve small linear problems directly by assembling the explicit
+/// matrix representation of the linear operator and factorizing it.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "DataStructures/CompressedMatrix.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "IO/Logging/Tags.hpp"
+#include "IO/Logging/Verbosity.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/GetSection.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Printf/Printf.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/Tags/Section.hpp"
+#include "ParallelAlgorithms/LinearSolver/Actions/BuildMatrix.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace LinearSolver::Actions {
+
+namespace detail {
+/// \brief Assemble the matrix from the `matrix_rows` of all elements and solve
+/// it for the `source_rows` with a dense LU factorization.
+///
+/// Elements are ordered by their ID in the matrix, as in
+/// `LinearSolver::Actions::BuildMatrix`. Returns the part of the solution
+/// that corresponds to the points of each element.
+template <size_t Dim>
+std::map<ElementId<Dim>, DataVector> solve_assembled_matrix(
+    const std::map<ElementId<Dim>,
+                   blaze::CompressedMatrix<double, blaze::columnMajor>>&
+        matrix_rows,
+    const std::map<ElementId<Dim>, DataVector>& source_rows);
+}  // namespace detail
+
+/// \cond
+template <typename FieldsTag, typename SourceTag, typename OperandTag,
+          typename ArraySectionIdTag>
+struct SolveAssembledMatrix;
+template <typename FieldsTag, typename ArraySectionIdTag>
+struct ReceiveDirectSolution;
+/// \endcond
+
+/// Send the rows of the matrix and of the source that correspond to
+/// this element to the element that solves the assembled matrix, and wait for
+/// the solution
+template <typename FieldsTag, typename SourceTag, typename OperandTag,
+          typename ArraySectionIdTag>
+struct GatherMatrix {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    // Skip everything on elements that are not part of the section
+    if constexpr (not std::is_same_v<ArraySectionIdTag, void>) {
+      if (not db::get<Parallel::Tags::Section<ParallelComponent,
+                                              ArraySectionIdTag>>(box)
+                  .has_value()) {
+        return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+      }
+    }
+    const auto& source = get<SourceTag>(box);
+    DataVector source_rows{source.size()};
+    std::copy(source.data(), source.data() + source.size(),
+              source_rows.begin());
+    auto& section = Parallel::get_section<ParallelComponent, ArraySectionIdTag>(
+        make_not_null(&box));
+    auto& array_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    Parallel::contribute_to_reduction<SolveAssembledMatrix<
+        FieldsTag, SourceTag, OperandTag, ArraySectionIdTag>>(
+        Parallel::ReductionData<
+            Parallel::ReductionDatum<
+                std::map<ElementId<Dim>,
+                         blaze::CompressedMatrix<double, blaze::columnMajor>>,
+                funcl::Merge<>>,
+            Parallel::ReductionDatum<std::map<ElementId<Dim>, DataVector>,
+                                     funcl::Merge<>>>{
+            std::map<ElementId<Dim>,
+                     blaze::CompressedMatrix<double, blaze::columnMajor>>{
+                std::make_pair(element_id,
+                               get<detail::local_matrix_rows_tag<OperandTag>>(
+                                   box))},
+            std::map<ElementId<Dim>, DataVector>{
+                std::make_pair(element_id, std::move(source_rows))}},
+        array_proxy[element_id],
+        array_proxy[get<Tags::FirstElementId<Dim>>(box)],
+        make_not_null(&section));
+    // Pause the algorithm until the solution is received
+    return {Parallel::AlgorithmExecution::Pause, std::nullopt};
+  }
+};
+
+/// Receive the matrix and the source, solve, and send the solution back to the
+/// elements
+template <typename FieldsTag, typename SourceTag, typename OperandTag,
+          typename ArraySectionIdTag>
+struct SolveAssembledMatrix {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, size_t Dim>
+  static void apply(
+      db::DataBox<DbTagsList>& box, Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& /*element_id*/,
+      const std::map<ElementId<Dim>,
+                     blaze::CompressedMatrix<double, blaze::columnMajor>>&
+          matrix_rows,
+      const std::map<ElementId<Dim>, DataVector>& source_rows) {
+    if (get<logging::Tags::Verbosity<OptionTags::BuildMatrixOptionsGroup>>(
+            box) >= Verbosity::Quiet) {
+      Parallel::printf("Solving the assembled matrix of size %zu x %zu.\n",
+                       get<Tags::TotalNumPoints>(box),
+                       get<Tags::TotalNumPoints>(box));
+    }
+    auto solution = detail::solve_assembled_matrix(matrix_rows, source_rows);
+    auto& array_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    for (auto& [element_id, local_solution] : solution) {
+      Parallel::simple_action<
+          ReceiveDirectSolution<FieldsTag, ArraySectionIdTag>>(
+          array_proxy[element_id], std::move(local_solution));
+    }
+  }
+};
+
+/// Store the solution in the `FieldsTag` and continue the algorithm
+template <typename FieldsTag, typename ArraySectionIdTag>
+struct ReceiveDirectSolution {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, size_t Dim>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ElementId<Dim>& element_id,
+                    const DataVector& local_solution) {
+    db::mutate<FieldsTag>(
+        [&local_solution](const auto fields) {
+          ASSERT(fields->size() == local_solution.size(),
+                 "The fields have size " << fields->size()
+                                         << " but the solution has size "
+                                         << local_solution.size() << ".");
+          std::copy(local_solution.begin(), local_solution.end(),
+                    fields->data());
+        },
+        make_not_null(&box));
+    Parallel::get_parallel_component<ParallelComponent>(cache)[element_id]
+        .perform_algorithm(true);
+  }
+};
+
+/*!
+ * \brief Solve the linear problem directly by assembling the explicit matrix
+ * representation of the linear operator and factorizing it.
+ *
+ * The matrix is built with `LinearSolver::Actions::BuildMatrix`, so each
+ * element ends up with the block row of the block-sparse matrix that
+ * corresponds to its points. These rows and the `SourceTag` are gathered on the
+ * element that holds the first points of the matrix, which solves the
+ * assembled matrix with a dense LU factorization and sends each element its
+ * part of the solution. The solution is stored in the `FieldsTag`.
+ *
+ * This can be faster than an iterative solve for small problems that need many
+ * iterations, each with global reductions. However, building the matrix takes
+ * one application of the linear operator per column, and the dense
+ * factorization takes memory quadratic and time cubic in the number of points.
+ * Blaze provides no sparse factorization, so only use this for problems with up
+ * to about \f$10^4\f$ points. Set the
+ * `LinearSolver::OptionTags::MatrixSubfileName` to `None` to avoid writing the
+ * matrix to disk.
+ *
+ * Add the `actions` to the action list, the `amr_projectors` to the list of AMR
+ * projectors and the `register_actions` to the register phase. The template
+ * parameters are the same as for `LinearSolver::Actions::BuildMatrix`, except:
+ *
+ * \tparam FieldsTag Where the solution is stored. Must have the same layout as
+ * the `OperandTag`.
+ * \tparam SourceTag The source of the linear problem. Must have the same layout
+ * as the `OperatorAppliedToOperandTag`.
+ */
+template <typename FieldsTag, typename SourceTag, typename IterationIdTag,
+          typename OperandTag, typename OperatorAppliedToOperandTag,
+          typename CoordsTag, typename ArraySectionIdTag = void>
+struct DirectSolve {
+  static_assert(
+      std::is_same_v<typename OperandTag::type::value_type, double>,
+      "Direct solves are only implemented for real-valued operators.");
+
+  using build_matrix =
+      BuildMatrix<IterationIdTag, OperandTag, OperatorAppliedToOperandTag,
+                  CoordsTag, ArraySectionIdTag>;
+
+  template <typename ApplyOperatorActions>
+  using actions = tmpl::push_back<
+      typename build_matrix::template actions<ApplyOperatorActions>,
+      GatherMatrix<FieldsTag, SourceTag, OperandTag, ArraySectionIdTag>>;
+
+  using amr_projectors = typename build_matrix::amr_projectors;
+
+  using register_actions = typename build_matrix::register_actions;
+};
+
+}  // namespace LinearSolver::Actions
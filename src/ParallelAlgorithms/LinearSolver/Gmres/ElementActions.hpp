@@ -4,11 +4,13 @@
 #pragma once
 
 #include <cstddef>
+#include <iterator>
 #include <limits>
 #include <optional>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -19,10 +21,12 @@
 #include "Parallel/GetSection.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/Printf/LogBuffer.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "Parallel/Reduction.hpp"
 #include "Parallel/Tags/Section.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/ResidualMonitorActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/Gmres/Tags/BatchOrthogonalization.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/Tags/InboxTags.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -57,6 +61,33 @@ struct CompleteStep;
 
 namespace LinearSolver::gmres::detail {
 
+// Move the vectors of the `basis` to the `storage`, so their memory can be
+// reused by the basis of the next solve
+template <typename VectorType>
+void retire_basis(const gsl::not_null<std::vector<VectorType>*> basis,
+                  const gsl::not_null<std::vector<VectorType>*> storage) {
+  storage->insert(storage->end(), std::make_move_iterator(basis->begin()),
+                  std::make_move_iterator(basis->end()));
+  basis->clear();
+}
+
+// Append a copy of the `vector` to the `basis`, reusing the memory of a vector
+// in the `storage` if one is available. Assigning to a vector of the same size
+// doesn't allocate, so once the storage holds as many vectors as the solves
+// take iterations, building the basis allocates no memory.
+template <typename VectorType>
+void append_to_basis(const gsl::not_null<std::vector<VectorType>*> basis,
+                     const gsl::not_null<std::vector<VectorType>*> storage,
+                     const VectorType& vector) {
+  if (storage->empty()) {
+    basis->push_back(vector);
+    return;
+  }
+  basis->push_back(std::move(storage->back()));
+  storage->pop_back();
+  basis->back() = vector;
+}
+
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
           typename Label, typename SourceTag, typename ArraySectionIdTag>
 struct PrepareSolve {
@@ -70,6 +101,8 @@ struct PrepareSolve {
       db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
   using basis_history_tag =
       LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
+  using basis_storage_tag =
+      LinearSolver::Tags::KrylovSubspaceBasisStorage<operand_tag>;
 
  public:
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -96,17 +129,19 @@ struct PrepareSolve {
 
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
                  ::Verbosity::Debug)) {
-      Parallel::printf("%s %s: Prepare solve\n", get_output(array_index),
-                       pretty_type::name<OptionsGroup>());
+      Parallel::log(pretty_type::name<OptionsGroup>(), "%s: Prepare solve\n",
+                    get_output(array_index));
     }
 
-    db::mutate<operand_tag, initial_fields_tag, basis_history_tag>(
+    db::mutate<operand_tag, initial_fields_tag, basis_history_tag,
+               basis_storage_tag>(
         [](const auto operand, const auto initial_fields,
-           const auto basis_history, const auto& source,
-           const auto& operator_applied_to_fields, const auto& fields) {
+           const auto basis_history, const auto basis_storage,
+           const auto& source, const auto& operator_applied_to_fields,
+           const auto& fields) {
           *operand = source - operator_applied_to_fields;
           *initial_fields = fields;
-          *basis_history = typename basis_history_tag::type{};
+          retire_basis(basis_history, basis_storage);
         },
         make_not_null(&box), get<source_tag>(box),
         get<operator_applied_to_fields_tag>(box), get<fields_tag>(box));
@@ -128,11 +163,16 @@ struct PrepareSolve {
           db::add_tag_prefix<LinearSolver::Tags::Preconditioned, operand_tag>;
       using preconditioned_basis_history_tag =
           LinearSolver::Tags::KrylovSubspaceBasis<preconditioned_operand_tag>;
+      using preconditioned_basis_storage_tag =
+          LinearSolver::Tags::KrylovSubspaceBasisStorage<
+              preconditioned_operand_tag>;
 
-      db::mutate<preconditioned_basis_history_tag>(
-          [](const auto preconditioned_basis_history) {
-            *preconditioned_basis_history =
-                typename preconditioned_basis_history_tag::type{};
+      db::mutate<preconditioned_basis_history_tag,
+                 preconditioned_basis_storage_tag>(
+          [](const auto preconditioned_basis_history,
+             const auto preconditioned_basis_storage) {
+            retire_basis(preconditioned_basis_history,
+                         preconditioned_basis_storage);
           },
           make_not_null(&box));
     }
@@ -150,6 +190,8 @@ struct NormalizeInitialOperand {
       db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
   using basis_history_tag =
       LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
+  using basis_storage_tag =
+      LinearSolver::Tags::KrylovSubspaceBasisStorage<operand_tag>;
 
  public:
   using const_global_cache_tags =
@@ -205,15 +247,16 @@ struct NormalizeInitialOperand {
 
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
                  ::Verbosity::Debug)) {
-      Parallel::printf("%s %s(%zu): Normalize initial operand\n",
-                       get_output(array_index),
-                       pretty_type::name<OptionsGroup>(), iteration_id);
+      Parallel::log(pretty_type::name<OptionsGroup>(),
+                    "%s(%zu): Normalize initial operand\n",
+                    get_output(array_index), iteration_id);
     }
 
-    db::mutate<operand_tag, basis_history_tag>(
-        [residual_magnitude](const auto operand, const auto basis_history) {
+    db::mutate<operand_tag, basis_history_tag, basis_storage_tag>(
+        [residual_magnitude](const auto operand, const auto basis_history,
+                             const auto basis_storage) {
           *operand /= residual_magnitude;
-          basis_history->push_back(*operand);
+          append_to_basis(basis_history, basis_storage, *operand);
         },
         make_not_null(&box));
 
@@ -250,10 +293,9 @@ struct PrepareStep {
 
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
                  ::Verbosity::Debug)) {
-      Parallel::printf(
-          "%s %s(%zu): Prepare step\n", get_output(array_index),
-          pretty_type::name<OptionsGroup>(),
-          db::get<Convergence::Tags::IterationId<OptionsGroup>>(box));
+      Parallel::log(pretty_type::name<OptionsGroup>(),
+                    "%s(%zu): Prepare step\n", get_output(array_index),
+                    db::get<Convergence::Tags::IterationId<OptionsGroup>>(box));
     }
 
     if constexpr (Preconditioned) {
@@ -306,7 +348,8 @@ struct PerformStep {
 
  public:
   using const_global_cache_tags =
-      tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
+      tmpl::list<logging::Tags::Verbosity<OptionsGroup>,
+                 gmres::Tags::BatchOrthogonalization<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -335,8 +378,9 @@ struct PerformStep {
         db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
                  ::Verbosity::Debug)) {
-      Parallel::printf("%s %s(%zu): Perform step\n", get_output(array_index),
-                       pretty_type::name<OptionsGroup>(), iteration_id);
+      Parallel::log(pretty_type::name<OptionsGroup>(),
+                    "%s(%zu): Perform step\n", get_output(array_index),
+                    iteration_id);
     }
 
     using operator_tag = db::add_tag_prefix<
@@ -352,11 +396,18 @@ struct PerformStep {
     if constexpr (Preconditioned) {
       using preconditioned_basis_history_tag =
           LinearSolver::Tags::KrylovSubspaceBasis<preconditioned_operand_tag>;
+      using preconditioned_basis_storage_tag =
+          LinearSolver::Tags::KrylovSubspaceBasisStorage<
+              preconditioned_operand_tag>;
 
-      db::mutate<preconditioned_basis_history_tag>(
+      db::mutate<preconditioned_basis_history_tag,
+                 preconditioned_basis_storage_tag>(
           [](const auto preconditioned_basis_history,
+             const auto preconditioned_basis_storage,
              const auto& preconditioned_operand) {
-            preconditioned_basis_history->push_back(preconditioned_operand);
+            append_to_basis(preconditioned_basis_history,
+                            preconditioned_basis_storage,
+                            preconditioned_operand);
           },
           make_not_null(&box), get<preconditioned_operand_tag>(box));
     }
@@ -372,6 +423,32 @@ struct PerformStep {
 
     auto& section = Parallel::get_section<ParallelComponent, ArraySectionIdTag>(
         make_not_null(&box));
+
+    // Compute the inner products with all basis vectors and the operand's
+    // magnitude at once, so they are reduced together
+    if (get<gmres::Tags::BatchOrthogonalization<OptionsGroup>>(box)) {
+      const auto& basis_history = get<basis_history_tag>(box);
+      const auto& operand = get<operand_tag>(box);
+      std::vector<ValueType> inner_products(iteration_id + 1);
+      for (size_t i = 0; i < iteration_id; ++i) {
+        inner_products[i] = inner_product(gsl::at(basis_history, i), operand);
+      }
+      inner_products[iteration_id] = inner_product(operand, operand);
+      Parallel::contribute_to_reduction<StoreBatchedOrthogonalization<
+          FieldsTag, OptionsGroup, ParallelComponent>>(
+          Parallel::ReductionData<
+              Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+              Parallel::ReductionDatum<std::vector<ValueType>,
+                                       funcl::ElementWise<funcl::Plus<>>>>{
+              iteration_id, std::move(inner_products)},
+          Parallel::get_parallel_component<ParallelComponent>(
+              cache)[array_index],
+          Parallel::get_parallel_component<
+              ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache),
+          make_not_null(&section));
+      return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+    }
+
     Parallel::contribute_to_reduction<
         StoreOrthogonalization<FieldsTag, OptionsGroup, ParallelComponent>>(
         Parallel::ReductionData<
@@ -407,8 +484,11 @@ struct OrthogonalizeOperand {
       tt::get_complex_or_fundamental_type_t<typename fields_tag::type>;
 
  public:
+  using const_global_cache_tags =
+      tmpl::list<gmres::Tags::BatchOrthogonalization<OptionsGroup>>;
   using inbox_tags =
-      tmpl::list<Tags::Orthogonalization<OptionsGroup, ValueType>>;
+      tmpl::list<Tags::Orthogonalization<OptionsGroup, ValueType>,
+                 Tags::BatchedOrthogonalization<OptionsGroup, ValueType>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -420,6 +500,35 @@ struct OrthogonalizeOperand {
       const ParallelComponent* const /*meta*/) {
     const size_t iteration_id =
         db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, OrthogonalizeOperand>::value;
+
+    // Subtract the projections on all basis vectors at once. The normalization
+    // was already computed from the same reduction, so no further reduction is
+    // needed.
+    if (get<gmres::Tags::BatchOrthogonalization<OptionsGroup>>(box)) {
+      auto& batched_inbox =
+          get<Tags::BatchedOrthogonalization<OptionsGroup, ValueType>>(
+              inboxes);
+      if (batched_inbox.find(iteration_id) == batched_inbox.end()) {
+        return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+      }
+      const auto orthogonalization =
+          std::move(batched_inbox.extract(iteration_id).mapped());
+      db::mutate<operand_tag, orthogonalization_iteration_id_tag>(
+          [&orthogonalization, iteration_id](
+              const auto operand,
+              const gsl::not_null<size_t*> orthogonalization_iteration_id,
+              const auto& basis_history) {
+            for (size_t i = 0; i < orthogonalization.size(); ++i) {
+              *operand -= orthogonalization[i] * gsl::at(basis_history, i);
+            }
+            *orthogonalization_iteration_id = iteration_id;
+          },
+          make_not_null(&box), get<basis_history_tag>(box));
+      return {Parallel::AlgorithmExecution::Continue, this_action_index + 1};
+    }
+
     auto& inbox =
         get<Tags::Orthogonalization<OptionsGroup, ValueType>>(inboxes);
     if (inbox.find(iteration_id) == inbox.end()) {
@@ -467,8 +576,6 @@ struct OrthogonalizeOperand {
         make_not_null(&section));
 
     // Repeat this action until orthogonalization is complete
-    constexpr size_t this_action_index =
-        tmpl::index_of<ActionList, OrthogonalizeOperand>::value;
     return {Parallel::AlgorithmExecution::Continue,
             orthogonalization_complete ? (this_action_index + 1)
                                        : this_action_index};
@@ -487,6 +594,8 @@ struct NormalizeOperandAndUpdateField {
       db::add_tag_prefix<LinearSolver::Tags::Preconditioned, operand_tag>;
   using basis_history_tag =
       LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
+  using basis_storage_tag =
+      LinearSolver::Tags::KrylovSubspaceBasisStorage<operand_tag>;
   using preconditioned_basis_history_tag =
       LinearSolver::Tags::KrylovSubspaceBasis<std::conditional_t<
           Preconditioned, preconditioned_operand_tag, operand_tag>>;
@@ -549,13 +658,15 @@ struct NormalizeOperandAndUpdateField {
 
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
                  ::Verbosity::Debug)) {
-      Parallel::printf("%s %s(%zu): Update field\n", get_output(array_index),
-                       pretty_type::name<OptionsGroup>(), iteration_id);
+      Parallel::log(pretty_type::name<OptionsGroup>(),
+                    "%s(%zu): Update field\n", get_output(array_index),
+                    iteration_id);
     }
 
-    db::mutate<operand_tag, basis_history_tag, fields_tag>(
+    db::mutate<operand_tag, basis_history_tag, basis_storage_tag, fields_tag>(
         [normalization, &minres](const auto operand, const auto basis_history,
-                                 const auto field, const auto& initial_field,
+                                 const auto basis_storage, const auto field,
+                                 const auto& initial_field,
                                  const auto& preconditioned_basis_history,
                                  const auto& has_converged) {
           // Avoid an FPE if the new operand norm is exactly zero. In that case
@@ -565,7 +676,7 @@ struct NormalizeOperandAndUpdateField {
           if (LIKELY(normalization > 0.)) {
             *operand /= normalization;
           }
-          basis_history->push_back(*operand);
+          append_to_basis(basis_history, basis_storage, *operand);
           // Don't update the solution if an error occurred
           if (not(has_converged and
                   has_converged.reason() == Convergence::Reason::Error)) {
@@ -604,10 +715,9 @@ struct CompleteStep {
       const ParallelComponent* const /*meta*/) {
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
                  ::Verbosity::Debug)) {
-      Parallel::printf(
-          "%s %s(%zu): Complete step\n", get_output(array_index),
-          pretty_type::name<OptionsGroup>(),
-          db::get<Convergence::Tags::IterationId<OptionsGroup>>(box));
+      Parallel::log(pretty_type::name<OptionsGroup>(),
+                    "%s(%zu): Complete step\n", get_output(array_index),
+                    db::get<Convergence::Tags::IterationId<OptionsGroup>>(box));
     }
 
     // Repeat steps until the solve has converged
@@ -78,6 +78,33 @@ namespace LinearSolver::gmres {
  * the new orthogonal vector and normalize. Use the residual vector and the set
  * of orthogonal vectors to determine the solution \f$x\f$.
  *
+ * \par Batched orthogonalization
+ * The modified Gram-Schmidt orthogonalization outlined above needs \f$k+1\f$
+ * consecutive global reductions in iteration \f$k\f$, each of which is a
+ * synchronization point across all elements. Set the
+ * `LinearSolver::gmres::OptionTags::BatchOrthogonalization` option to
+ * orthogonalize with classical Gram-Schmidt instead. Then `PerformStep`
+ * computes the inner products of \f$A(q)\f$ with all previous basis vectors
+ * and with itself, and reduces them together to
+ * `StoreBatchedOrthogonalization` on the `ResidualMonitor`. It computes the
+ * magnitude of the orthogonalized vector from the Pythagorean theorem,
+ * broadcasts the inner products to `OrthogonalizeOperand` and proceeds like
+ * step 4 above. This means each iteration needs only a single reduction.
+ * Classical Gram-Schmidt is numerically less stable than modified
+ * Gram-Schmidt, in particular for the magnitude of the orthogonalized vector
+ * when it is nearly in the span of the previous basis vectors, so the batched
+ * orthogonalization is best suited for well-conditioned (e.g. well
+ * preconditioned) problems that converge in few iterations.
+ *
+ * \par Basis memory
+ * Each element keeps the vectors of the Krylov basis of a finished solve in
+ * `LinearSolver::Tags::KrylovSubspaceBasisStorage` and reuses their memory for
+ * the basis of the next solve. Once an element has taken part in a solve with
+ * as many iterations as the current one, building the basis allocates no
+ * memory. This matters when the solver runs many times, e.g. as a
+ * preconditioner or in every nonlinear solver iteration. The element then
+ * holds the memory of the longest solve so far.
+ *
  * \par Array sections
  * This linear solver supports running over a subset of the elements in the
  * array parallel component (see `Parallel::Section`). Set the
@@ -52,6 +52,11 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
       LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
   using preconditioned_basis_history_tag =
       LinearSolver::Tags::KrylovSubspaceBasis<preconditioned_operand_tag>;
+  using basis_storage_tag =
+      LinearSolver::Tags::KrylovSubspaceBasisStorage<operand_tag>;
+  using preconditioned_basis_storage_tag =
+      LinearSolver::Tags::KrylovSubspaceBasisStorage<
+          preconditioned_operand_tag>;
 
  public:  // Iterable action
   using simple_tags = tmpl::append<
@@ -59,9 +64,11 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
                  initial_fields_tag, operator_applied_to_fields_tag,
                  operand_tag, operator_applied_to_operand_tag,
                  orthogonalization_iteration_id_tag, basis_history_tag,
+                 basis_storage_tag,
                  Convergence::Tags::HasConverged<OptionsGroup>>,
       tmpl::conditional_t<Preconditioned,
                           tmpl::list<preconditioned_basis_history_tag,
+                                     preconditioned_basis_storage_tag,
                                      preconditioned_operand_tag>,
                           tmpl::list<>>>;
   using compute_tags = tmpl::list<>;
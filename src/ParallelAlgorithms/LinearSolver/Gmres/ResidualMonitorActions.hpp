@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <complex>
 #include <cstddef>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -248,4 +251,69 @@ struct StoreOrthogonalization {
   }
 };
 
+// Receives the inner products of the new operand with all previous basis
+// vectors and with itself in a single reduction, i.e. the classical
+// Gram-Schmidt variant of the orthogonalization. The normalization of the
+// orthogonalized operand follows from the Pythagorean theorem.
+template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
+struct StoreBatchedOrthogonalization {
+ private:
+  using fields_tag = FieldsTag;
+  using orthogonalization_history_tag =
+      LinearSolver::Tags::OrthogonalizationHistory<fields_tag>;
+  using ValueType =
+      tt::get_complex_or_fundamental_type_t<typename fields_tag::type>;
+
+ public:
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            typename DataBox = db::DataBox<DbTagsList>>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index, const size_t iteration_id,
+                    const std::vector<ValueType>& inner_products) {
+    ASSERT(inner_products.size() == iteration_id + 1,
+           "Expected " << iteration_id + 1 << " inner products, but received "
+                       << inner_products.size() << ".");
+    // The last entry is the inner product of the operand with itself
+    blaze::DynamicVector<ValueType> orthogonalization(iteration_id);
+    double normalization_square = real(inner_products.back());
+    for (size_t i = 0; i < iteration_id; ++i) {
+      orthogonalization[i] = inner_products[i];
+      normalization_square -= std::norm(inner_products[i]);
+    }
+    // Roundoff can make the difference slightly negative when the operand is
+    // (almost) in the span of the basis vectors
+    normalization_square = std::max(normalization_square, 0.);
+
+    // Append a row and a column to the orthogonalization history and store the
+    // orthogonalization in the new column
+    db::mutate<orthogonalization_history_tag>(
+        [&orthogonalization,
+         iteration_id](const auto orthogonalization_history) {
+          orthogonalization_history->resize(iteration_id + 1, iteration_id);
+          for (size_t j = 0; j < iteration_id - 1; ++j) {
+            (*orthogonalization_history)(iteration_id, j) = 0.;
+          }
+          for (size_t i = 0; i < iteration_id; ++i) {
+            (*orthogonalization_history)(i, iteration_id - 1) =
+                orthogonalization[i];
+          }
+        },
+        make_not_null(&box));
+
+    Parallel::receive_data<
+        Tags::BatchedOrthogonalization<OptionsGroup, ValueType>>(
+        Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
+        std::move(orthogonalization));
+
+    // Store the normalization, check convergence and broadcast the result like
+    // the last step of the modified Gram-Schmidt orthogonalization does
+    StoreOrthogonalization<FieldsTag, OptionsGroup, BroadcastTarget>::
+        template apply<ParallelComponent>(box, cache, array_index,
+                                          iteration_id, iteration_id,
+                                          ValueType{normalization_square});
+  }
+};
+
 }  // namespace LinearSolver::gmres::detail
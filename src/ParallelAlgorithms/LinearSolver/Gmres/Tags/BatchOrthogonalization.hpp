@@ -0,0 +1,55 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <string>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Options/String.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace LinearSolver::gmres {
+
+/// Option tags for the `LinearSolver::gmres::Gmres` linear solver
+namespace OptionTags {
+
+template <typename OptionsGroup>
+struct BatchOrthogonalization {
+  using type = bool;
+  static constexpr Options::String help =
+      "Orthogonalize each new Krylov basis vector against all previous basis "
+      "vectors in a single global reduction (classical Gram-Schmidt) instead "
+      "of one reduction per basis vector (modified Gram-Schmidt). This "
+      "reduces communication from 'k + 1' reductions to one reduction in "
+      "iteration 'k', which pays off when many elements are distributed over "
+      "many nodes. Classical Gram-Schmidt loses orthogonality faster than "
+      "modified Gram-Schmidt, so keep this disabled for ill-conditioned "
+      "problems that need many iterations.";
+  using group = OptionsGroup;
+  static bool suggested_value() { return false; }
+};
+
+}  // namespace OptionTags
+
+/// DataBox tags for the `LinearSolver::gmres::Gmres` linear solver
+namespace Tags {
+
+/// Whether to orthogonalize each new Krylov basis vector in a single global
+/// reduction. See `LinearSolver::gmres::Gmres` for details.
+template <typename OptionsGroup>
+struct BatchOrthogonalization : db::SimpleTag {
+  using type = bool;
+  static constexpr bool pass_metavariables = false;
+  using option_tags =
+      tmpl::list<OptionTags::BatchOrthogonalization<OptionsGroup>>;
+  static type create_from_options(const type value) { return value; };
+  static std::string name() {
+    return "BatchOrthogonalization(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
+}  // namespace Tags
+
+}  // namespace LinearSolver::gmres
@@ -29,6 +29,14 @@ struct Orthogonalization : Parallel::InboxInserters::Value<
   using type = std::map<temporal_id, ValueType>;
 };
 
+template <typename OptionsGroup, typename ValueType>
+struct BatchedOrthogonalization
+    : Parallel::InboxInserters::Value<
+          BatchedOrthogonalization<OptionsGroup, ValueType>> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id, blaze::DynamicVector<ValueType>>;
+};
+
 template <typename OptionsGroup, typename ValueType>
 struct FinalOrthogonalization
     : Parallel::InboxInserters::Value<
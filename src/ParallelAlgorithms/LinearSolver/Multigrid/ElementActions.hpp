@@ -39,6 +39,7 @@
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TypeTraits/IsA.hpp"
 
 namespace LinearSolver::multigrid::detail {
@@ -69,7 +70,9 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
                  observers::Tags::ObservationKey<Tags::MultigridLevel>,
                  observers::Tags::ObservationKey<Tags::IsFinestGrid>,
                  Tags::ObservationId<OptionsGroup>,
-                 Tags::VolumeDataForOutput<OptionsGroup, FieldsTag>>;
+                 Tags::VolumeDataForOutput<OptionsGroup, FieldsTag>,
+                 Tags::PostSmoothingCountAtBottom<OptionsGroup>,
+                 Tags::CorrectionWaitStartTime<OptionsGroup>>;
   using compute_tags = tmpl::list<>;
   using const_global_cache_tags =
       tmpl::list<Tags::MaxLevels<OptionsGroup>,
@@ -104,6 +107,8 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
           observation_key_is_finest_grid,
       const gsl::not_null<size_t*> observation_id,
       const gsl::not_null<VolumeDataVars*> volume_data_for_output,
+      const gsl::not_null<size_t*> post_smoothing_count_at_bottom,
+      const gsl::not_null<double*> correction_wait_start_time,
       const gsl::not_null<std::vector<std::array<size_t, Dim>>*>
           children_refinement_levels,
       const gsl::not_null<std::vector<std::array<size_t, Dim>>*>
@@ -167,16 +172,56 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
     if (output_volume_data) {
       volume_data_for_output->initialize(mesh.number_of_grid_points());
     }
+
+    *post_smoothing_count_at_bottom = 0;
+    *correction_wait_start_time = 0.;
   }
 };
 
 // These two actions communicate and project the residual from the finer grid to
-// the coarser grid, storing it in the `SourceTag` on the coarser grid.
-template <typename FieldsTag, typename OptionsGroup,
+// the coarser grid, storing it in the `SourceTag` on the coarser grid. The
+// residual is sent either before or after pre-smoothing, depending on the
+// `AdditiveCycle` option, so the action appears twice in the action list.
+template <bool BeforePreSmoothing, typename FieldsTag, typename OptionsGroup,
           typename ResidualIsMassiveTag, typename SourceTag>
-using SendResidualToCoarserGrid = Actions::SendFieldsToCoarserGrid<
-    tmpl::list<db::add_tag_prefix<LinearSolver::Tags::Residual, FieldsTag>>,
-    OptionsGroup, ResidualIsMassiveTag, tmpl::list<SourceTag>>;
+struct SendResidualToCoarserGrid {
+ private:
+  using send_fields = Actions::SendFieldsToCoarserGrid<
+      tmpl::list<db::add_tag_prefix<LinearSolver::Tags::Residual, FieldsTag>>,
+      OptionsGroup, ResidualIsMassiveTag, tmpl::list<SourceTag>>;
+
+ public:
+  using const_global_cache_tags = tmpl::push_back<
+      typename send_fields::const_global_cache_tags,
+      LinearSolver::multigrid::Tags::EnablePreSmoothing<OptionsGroup>,
+      LinearSolver::multigrid::Tags::AdditiveCycle<OptionsGroup>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& inboxes,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList meta,
+      const ParallelComponent* const component) {
+    const bool send_before_pre_smoothing =
+        db::get<LinearSolver::multigrid::Tags::EnablePreSmoothing<
+            OptionsGroup>>(box) and
+        db::get<LinearSolver::multigrid::Tags::AdditiveCycle<OptionsGroup>>(
+            box);
+    if (send_before_pre_smoothing != BeforePreSmoothing or
+        not db::get<Tags::ParentId<Dim>>(box).has_value()) {
+      return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+    }
+    db::mutate<Tags::CorrectionWaitStartTime<OptionsGroup>>(
+        [](const gsl::not_null<double*> start_time) {
+          *start_time = sys::wall_time();
+        },
+        make_not_null(&box));
+    return send_fields::apply(box, inboxes, cache, element_id, meta,
+                              component);
+  }
+};
 
 template <size_t Dim, typename FieldsTag, typename OptionsGroup,
           typename SourceTag>
@@ -310,6 +355,13 @@ struct SkipPostSmoothingAtBottom {
           db::get<residual_tag>(box));
     }
 
+    // Start counting the post-smoothing steps on the coarsest grid
+    if (is_coarsest_grid) {
+      db::mutate<Tags::PostSmoothingCountAtBottom<OptionsGroup>>(
+          [](const gsl::not_null<size_t*> count) { *count = 0; },
+          make_not_null(&box));
+    }
+
     // Skip post-smoothing on the coarsest grid, if requested
     const size_t first_action_after_post_smoothing_index = tmpl::index_of<
         ActionList,
@@ -342,7 +394,9 @@ struct CorrectionInboxTag
 // finer grids runs after receiving this coarse-grid correction. Since the
 // post-smoother is skipped on the coarsest level, it directly sends the
 // solution of the pre-smoother to the finer grid, thus kicking off the
-// "ascending" branch of the V-cycle.
+// "ascending" branch of the V-cycle. If the post-smoother runs on the coarsest
+// level, it can be repeated to solve the coarsest grid more accurately before
+// sending the correction.
 template <typename FieldsTag, typename OptionsGroup, typename SourceTag>
 struct SendCorrectionToFinerGrid {
  private:
@@ -351,6 +405,11 @@ struct SendCorrectionToFinerGrid {
       db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
 
  public:
+  using const_global_cache_tags = tmpl::list<
+      LinearSolver::multigrid::Tags::EnablePostSmoothingAtBottom<OptionsGroup>,
+      LinearSolver::multigrid::Tags::PostSmoothingRepeatsAtBottom<
+          OptionsGroup>>;
+
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             size_t Dim, typename ActionList, typename ParallelComponent>
   static Parallel::iterable_action_return_t apply(
@@ -361,6 +420,34 @@ struct SendCorrectionToFinerGrid {
       const ParallelComponent* const /*meta*/) {
     const auto& child_ids = db::get<Tags::ChildIds<Dim>>(box);
 
+    // Repeat the post-smoothing on the coarsest grid, if requested. The
+    // smoother leaves the fields and the operator applied to them up-to-date,
+    // so it can run again directly.
+    if (not db::get<Tags::ParentId<Dim>>(box).has_value() and
+        db::get<LinearSolver::multigrid::Tags::EnablePostSmoothingAtBottom<
+            OptionsGroup>>(box)) {
+      db::mutate<Tags::PostSmoothingCountAtBottom<OptionsGroup>>(
+          [](const gsl::not_null<size_t*> count) { ++(*count); },
+          make_not_null(&box));
+      if (db::get<Tags::PostSmoothingCountAtBottom<OptionsGroup>>(box) <
+          db::get<LinearSolver::multigrid::Tags::PostSmoothingRepeatsAtBottom<
+              OptionsGroup>>(box)) {
+        if (UNLIKELY(db::get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                     ::Verbosity::Debug)) {
+          Parallel::printf(
+              "%s %s(%zu): Repeat post-smoothing on coarsest grid\n",
+              element_id, pretty_type::name<OptionsGroup>(),
+              db::get<Convergence::Tags::IterationId<OptionsGroup>>(box));
+        }
+        const size_t post_smoothing_begin_index =
+            tmpl::index_of<ActionList,
+                           ::Actions::Label<PostSmoothingBeginLabel>>::value +
+            1;
+        return {Parallel::AlgorithmExecution::Continue,
+                post_smoothing_begin_index};
+      }
+    }
+
     // Record post-smoothing result fields and residual
     if (db::get<Tags::OutputVolumeData<OptionsGroup>>(box)) {
       db::mutate<Tags::VolumeDataForOutput<OptionsGroup, FieldsTag>>(
@@ -438,11 +525,15 @@ struct ReceiveCorrectionFromCoarserGrid {
     }
     auto parent_correction = std::move(inbox.extract(iteration_id).mapped());
 
+    // The wait for the correction is the time this element sat idle while the
+    // coarser grids worked, unless other elements kept the core busy
     if (UNLIKELY(db::get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
                  ::Verbosity::Debug)) {
-      Parallel::printf("%s %s(%zu): Prolongate correction from parent\n",
-                       element_id, pretty_type::name<OptionsGroup>(),
-                       iteration_id);
+      Parallel::printf(
+          "%s %s(%zu): Prolongate correction from parent after waiting %es\n",
+          element_id, pretty_type::name<OptionsGroup>(), iteration_id,
+          sys::wall_time() -
+              db::get<Tags::CorrectionWaitStartTime<OptionsGroup>>(box));
     }
 
     // Apply prolongation operator
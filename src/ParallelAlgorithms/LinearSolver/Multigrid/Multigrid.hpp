@@ -106,11 +106,25 @@ struct VcycleUpLabel {};
  * coarsest grid (the "tip" of the V-cycle) may skip the post-smoothing, so the
  * result of the pre-smoother is immediately projected up to the finer grid
  * (controlled by the
- * `LinearSolver::multigrid::Tags::EnablePostSmoothingAtBottom` option). On the
+ * `LinearSolver::multigrid::Tags::EnablePostSmoothingAtBottom` option). If it
+ * runs, the post-smoothing on the coarsest grid can be repeated to solve the
+ * coarsest grid more accurately (controlled by the
+ * `LinearSolver::multigrid::Tags::PostSmoothingRepeatsAtBottom` option). On the
  * top-most finest grid (the "original" grid that represents the overall
  * solution) the algorithm applies the smoothing and the corrections from the
  * coarser grids directly to the solution fields.
  *
+ * \par Additive cycle
+ * In the V-cycle described above the finer grids sit idle while the coarser
+ * grids smooth, and the coarser grids have few elements, so most cores idle
+ * during coarse-grid work. With the
+ * `LinearSolver::multigrid::Tags::AdditiveCycle` option the residual is
+ * restricted to the coarser grid before pre-smoothing, so the pre-smoothing on
+ * all levels runs concurrently. The coarse-grid corrections are then added to
+ * the pre-smoothed fields and post-smoothing proceeds as before. With `Debug`
+ * verbosity every element reports how long it waited for the coarse-grid
+ * correction.
+ *
  * \par AMR
  * AMR is not yet fully supported by the multigrid solver. When AMR is enabled,
  * only a single multigrid level can be used (the finest grid). To support AMR
@@ -161,6 +175,8 @@ struct Multigrid {
       detail::ReceiveResidualFromFinerGrid<Dim, FieldsTag, OptionsGroup,
                                            SourceTag>,
       detail::PreparePreSmoothing<FieldsTag, OptionsGroup, SourceTag>,
+      detail::SendResidualToCoarserGrid<true, FieldsTag, OptionsGroup,
+                                        ResidualIsMassiveTag, SourceTag>,
       // No need to apply the linear operator here:
       // - On the finest grid, the operator applied to the fields should have
       //   already been computed at this point, either applied to the initial
@@ -170,7 +186,7 @@ struct Multigrid {
       //   applied to them is also zero.
       PreSmootherActions,
       detail::SkipPostSmoothingAtBottom<FieldsTag, OptionsGroup, SourceTag>,
-      detail::SendResidualToCoarserGrid<FieldsTag, OptionsGroup,
+      detail::SendResidualToCoarserGrid<false, FieldsTag, OptionsGroup,
                                         ResidualIsMassiveTag, SourceTag>,
       detail::ReceiveCorrectionFromCoarserGrid<Dim, FieldsTag, OptionsGroup,
                                                SourceTag>,
@@ -72,6 +72,34 @@ struct EnablePostSmoothingAtBottom {
   using group = OptionsGroup;
 };
 
+template <typename OptionsGroup>
+struct PostSmoothingRepeatsAtBottom {
+  using type = size_t;
+  static constexpr Options::String help =
+      "Number of times the post-smoother runs on the coarsest grid. Repeating "
+      "the post-smoothing solves the coarsest grid more accurately, which can "
+      "reduce the number of V-cycles when the coarsest grid has many elements "
+      "and a single smoothing step converges poorly. Only has an effect if "
+      "'PostSmoothingAtBottom' is enabled.";
+  static size_t lower_bound() { return 1; }
+  using group = OptionsGroup;
+  static size_t suggested_value() { return 1; }
+};
+
+template <typename OptionsGroup>
+struct AdditiveCycle {
+  using type = bool;
+  static constexpr Options::String help =
+      "Restrict the residual to the coarser grid before pre-smoothing instead "
+      "of after, so the pre-smoothing on every level runs concurrently with "
+      "the coarser levels instead of leaving their cores idle. The coarse-grid "
+      "correction then doesn't account for the pre-smoothing, which typically "
+      "needs more V-cycles but makes each of them cheaper on many cores. Only "
+      "has an effect if 'PreSmoothing' is enabled.";
+  using group = OptionsGroup;
+  static bool suggested_value() { return false; }
+};
+
 }  // namespace OptionTags
 
 /// DataBox tags for the `LinearSolver::multigrid::Multigrid` linear solver
@@ -159,6 +187,57 @@ struct EnablePostSmoothingAtBottom : db::SimpleTag {
   }
 };
 
+/// Number of times the post-smoother runs on the coarsest grid. Only has an
+/// effect if `EnablePostSmoothingAtBottom` is `true`.
+template <typename OptionsGroup>
+struct PostSmoothingRepeatsAtBottom : db::SimpleTag {
+  using type = size_t;
+  static constexpr bool pass_metavariables = false;
+  using option_tags =
+      tmpl::list<OptionTags::PostSmoothingRepeatsAtBottom<OptionsGroup>>;
+  static type create_from_options(const type value) { return value; };
+  static std::string name() {
+    return "PostSmoothingRepeatsAtBottom(" +
+           pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
+/// Restrict the residual to the coarser grid before pre-smoothing, so all
+/// levels pre-smooth concurrently. Only has an effect if `EnablePreSmoothing`
+/// is `true`.
+template <typename OptionsGroup>
+struct AdditiveCycle : db::SimpleTag {
+  using type = bool;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<OptionTags::AdditiveCycle<OptionsGroup>>;
+  static type create_from_options(const type value) { return value; };
+  static std::string name() {
+    return "AdditiveCycle(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
+/// The wall time at which the residual was sent to the coarser grid in the
+/// current V-cycle. Used to report how long the element waits for the
+/// coarse-grid correction.
+template <typename OptionsGroup>
+struct CorrectionWaitStartTime : db::SimpleTag {
+  using type = double;
+  static std::string name() {
+    return "CorrectionWaitStartTime(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
+/// The number of post-smoothing steps that have completed on the coarsest grid
+/// in the current V-cycle
+template <typename OptionsGroup>
+struct PostSmoothingCountAtBottom : db::SimpleTag {
+  using type = size_t;
+  static std::string name() {
+    return "PostSmoothingCountAtBottom(" + pretty_type::name<OptionsGroup>() +
+           ")";
+  }
+};
+
 /// The multigrid level. The finest grid is always level 0 and the coarsest grid
 /// has the highest level.
 struct MultigridLevel : db::SimpleTag {
@@ -56,11 +56,20 @@ namespace LinearSolver::Schwarz::Actions {
  * overall convergence of the solve is highly problem-dependent. A possible
  * optimization would be to decide at runtime whether or not to reset the
  * subdomain solver.
+ *
+ * As a compromise, the option
+ * `LinearSolver::Schwarz::Tags::SubdomainSolverResetInterval` resets the
+ * subdomain solver only every N-th time this action runs. For example, in a
+ * Newton-Raphson solve the subdomain solver then keeps using the linearization
+ * from N nonlinear iterations ago. Near convergence of the nonlinear solve the
+ * linearization changes very little, so this retains most of the
+ * preconditioning quality at a fraction of the re-initialization cost.
  */
 template <typename OptionsGroup>
 struct ResetSubdomainSolver {
   using const_global_cache_tags = tmpl::list<
       LinearSolver::Schwarz::Tags::SkipSubdomainSolverResets<OptionsGroup>,
+      LinearSolver::Schwarz::Tags::SubdomainSolverResetInterval<OptionsGroup>,
       logging::Tags::Verbosity<OptionsGroup>>;
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             size_t Dim, typename ActionList, typename ParallelComponent>
@@ -72,6 +81,20 @@ struct ResetSubdomainSolver {
       const ParallelComponent* const /*meta*/) {
     if (not get<LinearSolver::Schwarz::Tags::SkipSubdomainSolverResets<
             OptionsGroup>>(box)) {
+      // Skip the reset until the interval is reached
+      if (get<LinearSolver::Schwarz::Tags::SkippedSubdomainSolverResets<
+                  OptionsGroup>>(box) +
+              1 <
+          get<LinearSolver::Schwarz::Tags::SubdomainSolverResetInterval<
+              OptionsGroup>>(box)) {
+        db::mutate<LinearSolver::Schwarz::Tags::SkippedSubdomainSolverResets<
+            OptionsGroup>>(
+            [](const gsl::not_null<size_t*> skipped_resets) {
+              ++(*skipped_resets);
+            },
+            make_not_null(&box));
+        return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+      }
       if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
                    ::Verbosity::Debug)) {
         Parallel::printf("%s %s: Reset subdomain solver\n", element_id,
@@ -90,6 +113,12 @@ struct ResetSubdomainSolver {
             (*subdomain_solver)->reset();
           },
           make_not_null(&box));
+      db::mutate<LinearSolver::Schwarz::Tags::SkippedSubdomainSolverResets<
+          OptionsGroup>>(
+          [](const gsl::not_null<size_t*> skipped_resets) {
+            *skipped_resets = 0;
+          },
+          make_not_null(&box));
     }
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
@@ -33,9 +33,9 @@
 #include "IO/Observer/Tags.hpp"
 #include "IO/Observer/TypeOfObservation.hpp"
 #include "NumericalAlgorithms/Convergence/Tags.hpp"
-#include "NumericalAlgorithms/DiscontinuousGalerkin/HasReceivedFromAllMortars.hpp"
 #include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
 #include "NumericalAlgorithms/LinearSolver/Gmres.hpp"
+#include "NumericalAlgorithms/LinearSolver/LuFactorization.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
@@ -178,6 +178,21 @@ struct SubdomainDataBufferTag : db::SimpleTag {
   using type = SubdomainDataType;
 };
 
+template <size_t Dim, typename OptionsGroup, typename OverlapSolution>
+struct OverlapSolutionInboxTag
+    : public Parallel::InboxInserters::Map<
+          OverlapSolutionInboxTag<Dim, OptionsGroup, OverlapSolution>> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id, OverlapMap<Dim, OverlapSolution>>;
+};
+
+// Counts the overlap data moved out of the `InboxTag` during the current solve
+// to bound its staleness (see `has_received_overlap_data`)
+template <size_t Dim, typename InboxTag>
+struct NumConsumedOverlapDataTag : db::SimpleTag {
+  using type = OverlapMap<Dim, size_t>;
+};
+
 // Allow factory-creating any of these serial linear solvers for use as
 // subdomain solver
 template <typename FieldsTag, typename SubdomainOperator,
@@ -189,6 +204,8 @@ template <typename FieldsTag, typename SubdomainOperator,
 using subdomain_solver = LinearSolver::Serial::LinearSolver<tmpl::append<
     tmpl::list<::LinearSolver::Serial::Registrars::Gmres<SubdomainData>,
                ::LinearSolver::Serial::Registrars::ExplicitInverse<
+                   typename SubdomainData::value_type>,
+               ::LinearSolver::Serial::Registrars::LuFactorization<
                    typename SubdomainData::value_type>>,
     SubdomainPreconditioners>>;
 
@@ -206,6 +223,12 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
       subdomain_solver<FieldsTag, SubdomainOperator, SubdomainPreconditioners>;
   using subdomain_solver_tag =
       Tags::SubdomainSolver<std::unique_ptr<SubdomainSolver>, OptionsGroup>;
+  using num_consumed_overlap_residuals_tag = NumConsumedOverlapDataTag<
+      Dim, Actions::detail::OverlapFieldsTag<Dim, tmpl::list<residual_tag>,
+                                             OptionsGroup>>;
+  using num_consumed_overlap_solutions_tag = NumConsumedOverlapDataTag<
+      Dim, OverlapSolutionInboxTag<Dim, OptionsGroup,
+                                   typename SubdomainData::OverlapData>>;
 
  public:  // Iterable action
   using simple_tags_from_options = tmpl::list<subdomain_solver_tag>;
@@ -216,7 +239,10 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
       tmpl::list<Tags::IntrudingExtents<Dim, OptionsGroup>,
                  Tags::Weight<OptionsGroup>,
                  domain::Tags::Faces<Dim, Tags::Weight<OptionsGroup>>,
-                 SubdomainDataBufferTag<SubdomainData, OptionsGroup>>;
+                 SubdomainDataBufferTag<SubdomainData, OptionsGroup>,
+                 Tags::SkippedSubdomainSolverResets<OptionsGroup>,
+                 num_consumed_overlap_residuals_tag,
+                 num_consumed_overlap_solutions_tag>;
   using compute_tags = tmpl::list<>;
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ActionList, typename ParallelComponent>
@@ -244,6 +270,11 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
       const gsl::not_null<DirectionMap<Dim, Scalar<DataVector>>*>
           intruding_overlap_weights,
       const gsl::not_null<SubdomainData*> subdomain_data,
+      const gsl::not_null<size_t*> skipped_subdomain_solver_resets,
+      const gsl::not_null<OverlapMap<Dim, size_t>*>
+          num_consumed_overlap_residuals,
+      const gsl::not_null<OverlapMap<Dim, size_t>*>
+          num_consumed_overlap_solutions,
       [[maybe_unused]] const gsl::not_null<std::unique_ptr<SubdomainSolver>*>
           subdomain_solver,
       const Element<Dim>& element, const Mesh<Dim>& mesh,
@@ -295,8 +326,11 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
 
     // Subdomain data buffer
     *subdomain_data = SubdomainData{num_points};
+    num_consumed_overlap_residuals->clear();
+    num_consumed_overlap_solutions->clear();
 
     // Subdomain solver
+    *skipped_subdomain_solver_resets = 0;
     // The subdomain solver initially gets created from options on each element.
     // Then we have to copy it around during AMR.
     if constexpr (sizeof...(AmrData) == 1) {
@@ -320,14 +354,6 @@ using SendOverlapData = LinearSolver::Schwarz::Actions::SendOverlapFields<
     tmpl::list<db::add_tag_prefix<LinearSolver::Tags::Residual, FieldsTag>>,
     OptionsGroup, true>;
 
-template <size_t Dim, typename OptionsGroup, typename OverlapSolution>
-struct OverlapSolutionInboxTag
-    : public Parallel::InboxInserters::Map<
-          OverlapSolutionInboxTag<Dim, OptionsGroup, OverlapSolution>> {
-  using temporal_id = size_t;
-  using type = std::map<temporal_id, OverlapMap<Dim, OverlapSolution>>;
-};
-
 // Wait for the residual data on regions of this element's subdomain that
 // overlap with other elements. Once the residual data is available on all
 // overlaps, solve the restricted problem for this element-centered subdomain.
@@ -349,10 +375,14 @@ struct SolveSubdomain {
   using OverlapData = typename SubdomainData::OverlapData;
   using overlap_solution_inbox_tag =
       OverlapSolutionInboxTag<Dim, OptionsGroup, OverlapData>;
+  using num_consumed_tag =
+      NumConsumedOverlapDataTag<Dim, overlap_residuals_inbox_tag>;
 
  public:
   using const_global_cache_tags =
       tmpl::list<Tags::MaxOverlap<OptionsGroup>,
+                 Tags::MaxStaleness<OptionsGroup>,
+                 Convergence::Tags::Iterations<OptionsGroup>,
                  logging::Tags::Verbosity<OptionsGroup>,
                  Tags::ObservePerCoreReductions<OptionsGroup>>;
   using inbox_tags = tmpl::list<overlap_residuals_inbox_tag>;
@@ -369,12 +399,18 @@ struct SolveSubdomain {
     const auto& element = db::get<domain::Tags::Element<Dim>>(box);
     const size_t max_overlap = db::get<Tags::MaxOverlap<OptionsGroup>>(box);
 
-    // Wait for communicated overlap data
+    // Wait for communicated overlap data, tolerating stale data from neighbors
+    // that lag behind by at most `MaxStaleness` iterations
     const bool has_overlap_data =
         max_overlap > 0 and element.number_of_neighbors() > 0;
+    const bool last_iteration =
+        iteration_id + 1 >=
+        db::get<Convergence::Tags::Iterations<OptionsGroup>>(box);
     if (LIKELY(has_overlap_data) and
-        not dg::has_received_from_all_mortars<overlap_residuals_inbox_tag>(
-            iteration_id, element, inboxes)) {
+        not has_received_overlap_data(
+            tuples::get<overlap_residuals_inbox_tag>(inboxes),
+            db::get<num_consumed_tag>(box), element, iteration_id,
+            db::get<Tags::MaxStaleness<OptionsGroup>>(box), last_iteration)) {
       return {Parallel::AlgorithmExecution::Retry, std::nullopt};
     }
 
@@ -386,18 +422,29 @@ struct SolveSubdomain {
     }
 
     // Assemble the subdomain data from the data on the element and the
-    // communicated overlap data
-    db::mutate<SubdomainDataBufferTag<SubdomainData, OptionsGroup>>(
-        [&inboxes, &iteration_id, &has_overlap_data](
+    // communicated overlap data. The newest data received on each overlap
+    // replaces the data from earlier iterations.
+    db::mutate<SubdomainDataBufferTag<SubdomainData, OptionsGroup>,
+               num_consumed_tag>(
+        [&inboxes, &iteration_id, &has_overlap_data, &last_iteration](
             const gsl::not_null<SubdomainData*> subdomain_data,
+            const gsl::not_null<OverlapMap<Dim, size_t>*> num_consumed,
             const auto& residual) {
           subdomain_data->element_data = residual;
           // Nothing was communicated if the overlaps are empty
           if (LIKELY(has_overlap_data)) {
-            subdomain_data->overlap_data =
-                std::move(tuples::get<overlap_residuals_inbox_tag>(inboxes)
-                              .extract(iteration_id)
-                              .mapped());
+            consume_overlap_data(
+                make_not_null(
+                    &tuples::get<overlap_residuals_inbox_tag>(inboxes)),
+                num_consumed, iteration_id,
+                [&subdomain_data](const OverlapId<Dim>& overlap_id,
+                                  OverlapData&& overlap_residual) {
+                  subdomain_data->overlap_data[overlap_id] =
+                      std::move(overlap_residual);
+                });
+          }
+          if (last_iteration) {
+            num_consumed->clear();
           }
         },
         make_not_null(&box), db::get<residual_tag>(box));
@@ -503,9 +550,14 @@ struct ReceiveOverlapSolution {
   using OverlapSolution = typename SubdomainData::OverlapData;
   using overlap_solution_inbox_tag =
       OverlapSolutionInboxTag<Dim, OptionsGroup, OverlapSolution>;
+  using num_consumed_tag =
+      NumConsumedOverlapDataTag<Dim, overlap_solution_inbox_tag>;
 
  public:
-  using const_global_cache_tags = tmpl::list<Tags::MaxOverlap<OptionsGroup>>;
+  using const_global_cache_tags =
+      tmpl::list<Tags::MaxOverlap<OptionsGroup>,
+                 Tags::MaxStaleness<OptionsGroup>,
+                 Convergence::Tags::Iterations<OptionsGroup>>;
   using inbox_tags = tmpl::list<overlap_solution_inbox_tag>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -525,8 +577,15 @@ struct ReceiveOverlapSolution {
       return {Parallel::AlgorithmExecution::Continue, std::nullopt};
     }
 
-    if (not dg::has_received_from_all_mortars<overlap_solution_inbox_tag>(
-            iteration_id, element, inboxes)) {
+    // Overlap solutions that lag behind by at most `MaxStaleness` iterations
+    // are added once they arrive
+    const bool last_iteration =
+        iteration_id + 1 >=
+        db::get<Convergence::Tags::Iterations<OptionsGroup>>(box);
+    if (not has_received_overlap_data(
+            tuples::get<overlap_solution_inbox_tag>(inboxes),
+            db::get<num_consumed_tag>(box), element, iteration_id,
+            db::get<Tags::MaxStaleness<OptionsGroup>>(box), last_iteration)) {
       return {Parallel::AlgorithmExecution::Retry, std::nullopt};
     }
 
@@ -537,27 +596,34 @@ struct ReceiveOverlapSolution {
                        pretty_type::name<OptionsGroup>(), iteration_id);
     }
 
-    // Add solutions on overlaps to this element's solution in a weighted sum
-    const auto received_overlap_solutions =
-        std::move(tuples::get<overlap_solution_inbox_tag>(inboxes)
-                      .extract(iteration_id)
-                      .mapped());
-    db::mutate<fields_tag>(
-        [&received_overlap_solutions](
-            const auto fields, const Index<Dim>& full_extents,
+    // Add solutions on overlaps to this element's solution in a weighted sum.
+    // Every overlap solution is added exactly once, even if it is stale.
+    db::mutate<fields_tag, num_consumed_tag>(
+        [&inboxes, &iteration_id, &last_iteration](
+            const auto fields,
+            const gsl::not_null<OverlapMap<Dim, size_t>*> num_consumed,
+            const Index<Dim>& full_extents,
             const std::array<size_t, Dim>& all_intruding_extents,
             const DirectionMap<Dim, Scalar<DataVector>>&
                 all_intruding_overlap_weights) {
-          for (const auto& [overlap_id, overlap_solution] :
-               received_overlap_solutions) {
-            const auto& direction = overlap_id.direction();
-            const auto& intruding_extents =
-                gsl::at(all_intruding_extents, direction.dimension());
-            const auto& overlap_weight =
-                all_intruding_overlap_weights.at(direction);
-            LinearSolver::Schwarz::add_overlap_data(
-                fields, overlap_solution * get(overlap_weight), full_extents,
-                intruding_extents, direction);
+          consume_overlap_data(
+              make_not_null(&tuples::get<overlap_solution_inbox_tag>(inboxes)),
+              num_consumed, iteration_id,
+              [&fields, &full_extents, &all_intruding_extents,
+               &all_intruding_overlap_weights](
+                  const OverlapId<Dim>& overlap_id,
+                  OverlapSolution&& overlap_solution) {
+                const auto& direction = overlap_id.direction();
+                const auto& intruding_extents =
+                    gsl::at(all_intruding_extents, direction.dimension());
+                const auto& overlap_weight =
+                    all_intruding_overlap_weights.at(direction);
+                LinearSolver::Schwarz::add_overlap_data(
+                    fields, overlap_solution * get(overlap_weight),
+                    full_extents, intruding_extents, direction);
+              });
+          if (last_iteration) {
+            num_consumed->clear();
           }
         },
         make_not_null(&box), db::get<domain::Tags::Mesh<Dim>>(box).extents(),
@@ -5,7 +5,9 @@
 
 #include <cstddef>
 #include <limits>
+#include <map>
 #include <tuple>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -14,9 +16,11 @@
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionalId.hpp"
 #include "Domain/Structure/DirectionalIdMap.hpp"
+#include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace LinearSolver::Schwarz {
 
@@ -267,4 +271,76 @@ Variables<TagsList> extended_overlap_data(
 }
 /// @}
 
+/*!
+ * \brief Whether enough overlap data has been received to proceed with
+ * iteration `iteration_id` while tolerating data that is up to `max_staleness`
+ * iterations old
+ *
+ * The `inbox` holds the overlap data received from the neighbors of the
+ * `element`, indexed by the iteration ID it was sent at, and `num_consumed`
+ * counts the data that was already moved out of the `inbox` for each overlap
+ * (see `LinearSolver::Schwarz::consume_overlap_data`). Each overlap must have
+ * provided data for all but `max_staleness` of the iterations up to and
+ * including `iteration_id`, and at least once. In the `last_iteration` all data
+ * must have been received, so nothing is left over for the next solve. With
+ * `max_staleness = 0` this function waits for the data of `iteration_id`, just
+ * like `dg::has_received_from_all_mortars`.
+ */
+template <size_t Dim, typename OverlapData>
+bool has_received_overlap_data(
+    const std::map<size_t, OverlapMap<Dim, OverlapData>>& inbox,
+    const OverlapMap<Dim, size_t>& num_consumed, const Element<Dim>& element,
+    const size_t iteration_id, const size_t max_staleness,
+    const bool last_iteration) {
+  const size_t num_required =
+      last_iteration ? iteration_id + 1
+                     : (iteration_id < max_staleness
+                            ? 1
+                            : iteration_id + 1 - max_staleness);
+  const auto end = inbox.upper_bound(iteration_id);
+  for (const auto& [direction, neighbors] : element.neighbors()) {
+    for (const auto& neighbor_id : neighbors) {
+      const OverlapId<Dim> overlap_id{direction, neighbor_id};
+      const auto consumed = num_consumed.find(overlap_id);
+      size_t num_received =
+          consumed == num_consumed.end() ? 0 : consumed->second;
+      for (auto received = inbox.begin();
+           received != end and num_received < num_required; ++received) {
+        if (received->second.contains(overlap_id)) {
+          ++num_received;
+        }
+      }
+      if (num_received < num_required) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/*!
+ * \brief Move the overlap data sent at iterations up to and including
+ * `iteration_id` out of the `inbox`
+ *
+ * Invokes `process_data(overlap_id, std::move(data))` for every overlap data in
+ * order of increasing iteration ID, so the newest data for each overlap is
+ * processed last. Data sent at later iterations stays in the `inbox`. The
+ * `num_consumed` counts the data moved out of the inbox for each overlap, and
+ * should be cleared once all data of a solve has been consumed.
+ */
+template <size_t Dim, typename OverlapData, typename ProcessData>
+void consume_overlap_data(
+    const gsl::not_null<std::map<size_t, OverlapMap<Dim, OverlapData>>*> inbox,
+    const gsl::not_null<OverlapMap<Dim, size_t>*> num_consumed,
+    const size_t iteration_id, ProcessData&& process_data) {
+  const auto end = inbox->upper_bound(iteration_id);
+  for (auto received = inbox->begin(); received != end; ++received) {
+    for (auto& [overlap_id, data] : received->second) {
+      ++(*num_consumed)[overlap_id];
+      process_data(overlap_id, std::move(data));
+    }
+  }
+  inbox->erase(inbox->begin(), end);
+}
+
 }  // namespace LinearSolver::Schwarz
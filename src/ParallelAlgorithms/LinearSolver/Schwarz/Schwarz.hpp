@@ -136,6 +136,20 @@ namespace LinearSolver::Schwarz {
  * corner- and edge-neighbors when constructing the weights. See
  * `LinearSolver::Schwarz::intruding_weight` for a discussion.
  *
+ * \par Asynchronous iterations:
+ * By default each element waits for the overlap data of its neighbors in every
+ * iteration, so neighboring elements proceed in lockstep. With the
+ * `LinearSolver::Schwarz::OptionTags::MaxStaleness` option set to a positive
+ * value, elements instead proceed with the newest residuals their neighbors
+ * have sent, as long as they lag behind by at most that many iterations, and
+ * add the neighbors' overlap solutions once they arrive. This turns the solver
+ * into an asynchronous ("chaotic") additive Schwarz iteration that hides
+ * communication latency behind subdomain solves, at the cost of a possibly
+ * worse smoothing per iteration. All overlap solutions are added exactly once,
+ * and the last iteration of each solve waits for all overlap data so nothing
+ * is left over for the next solve. See
+ * `LinearSolver::Schwarz::has_received_overlap_data` for details.
+ *
  * \par Array sections
  * This linear solver requires no synchronization between elements, so it runs
  * on all elements in the array parallel component. Partitioning of the elements
@@ -33,6 +33,20 @@ struct MaxOverlap {
       "Number of points that subdomains can extend into neighbors";
 };
 
+template <typename OptionsGroup>
+struct MaxStaleness {
+  using type = size_t;
+  using group = OptionsGroup;
+  static constexpr Options::String help =
+      "Number of iterations that the overlap data from neighbors may lag "
+      "behind. With 0, every element waits for the overlap data of its "
+      "neighbors in each iteration. Larger values let elements proceed with "
+      "the newest overlap data they have received (asynchronous Schwarz), "
+      "which hides communication latency but can slow down convergence. All "
+      "overlap data is incorporated in the last iteration of each solve.";
+  static size_t suggested_value() { return 0; }
+};
+
 template <typename SolverType, typename OptionsGroup>
 struct SubdomainSolver {
   using type = SolverType;
@@ -54,6 +68,21 @@ struct SkipSubdomainSolverResets {
       "overall is highly problem-dependent.";
 };
 
+template <typename OptionsGroup>
+struct SubdomainSolverResetInterval {
+  static std::string name() { return "ResetInterval"; }
+  using type = size_t;
+  using group = OptionsGroup;
+  static constexpr Options::String help =
+      "Reset the subdomain solver only every N-th time the operator changes, "
+      "e.g. every N-th nonlinear-solver iteration. In between, the subdomain "
+      "solver keeps using the operator it was built for. This interpolates "
+      "between always resetting (N = 1) and 'SkipResets'. Only has an effect "
+      "if 'SkipResets' is disabled.";
+  static size_t lower_bound() { return 1; }
+  static size_t suggested_value() { return 1; }
+};
+
 template <typename OptionsGroup>
 struct ObservePerCoreReductions {
   using type = bool;
@@ -80,6 +109,20 @@ struct MaxOverlap : db::SimpleTag {
   static type create_from_options(const type& value) { return value; }
 };
 
+/// Number of iterations that the overlap data from neighbors may lag behind
+///
+/// \see LinearSolver::Schwarz::has_received_overlap_data
+template <typename OptionsGroup>
+struct MaxStaleness : db::SimpleTag {
+  static std::string name() {
+    return "MaxStaleness(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+  using type = size_t;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<OptionTags::MaxStaleness<OptionsGroup>>;
+  static type create_from_options(const type& value) { return value; }
+};
+
 /// The serial linear solver used to solve subdomain operators
 template <typename OptionsGroup>
 struct SubdomainSolverBase : db::BaseTag {
@@ -113,6 +156,31 @@ struct SkipSubdomainSolverResets : db::SimpleTag {
   static bool create_from_options(const bool value) { return value; }
 };
 
+/// Reset the subdomain solver only every N-th time the operator changes.
+///
+/// \see LinearSolver::Schwarz::Actions::ResetSubdomainSolver
+template <typename OptionsGroup>
+struct SubdomainSolverResetInterval : db::SimpleTag {
+  using type = size_t;
+  static constexpr bool pass_metavariables = false;
+  using option_tags =
+      tmpl::list<OptionTags::SubdomainSolverResetInterval<OptionsGroup>>;
+  static size_t create_from_options(const size_t value) { return value; }
+};
+
+/// The number of resets of the subdomain solver that were skipped since it was
+/// last reset, because of the `SubdomainSolverResetInterval`.
+///
+/// \see LinearSolver::Schwarz::Actions::ResetSubdomainSolver
+template <typename OptionsGroup>
+struct SkippedSubdomainSolverResets : db::SimpleTag {
+  using type = size_t;
+  static std::string name() {
+    return "SkippedSubdomainSolverResets(" + pretty_type::name<OptionsGroup>() +
+           ")";
+  }
+};
+
 /// Enable per-core reduction observations
 template <typename OptionsGroup>
 struct ObservePerCoreReductions : db::SimpleTag {
@@ -167,6 +167,20 @@ struct KrylovSubspaceBasis : db::PrefixTag, db::SimpleTag {
   using tag = Tag;
 };
 
+/*!
+ * \brief Storage for the vectors of a `LinearSolver::Tags::KrylovSubspaceBasis`
+ * that are no longer part of the basis
+ *
+ * \details Linear solvers that build a new basis in every solve move the basis
+ * vectors of a finished solve here, and reuse their memory for the basis
+ * vectors of the next solve instead of allocating new ones.
+ */
+template <typename Tag>
+struct KrylovSubspaceBasisStorage : db::PrefixTag, db::SimpleTag {
+  using type = std::vector<typename Tag::type>;
+  using tag = Tag;
+};
+
 /// Indicates the `Tag` is related to preconditioning of the linear solve
 template <typename Tag>
 struct Preconditioned : db::PrefixTag, db::SimpleTag {
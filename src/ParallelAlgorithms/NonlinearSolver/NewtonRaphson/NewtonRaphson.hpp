@@ -65,6 +65,14 @@ namespace newton_raphson {
  * sophisticated nonlinear preconditioning techniques (see e.g. \cite Brune2015
  * for an overview), are not currently implemented.
  *
+ * \par Reusing the linearization:
+ * The linearized operator is typically applied matrix-free, so it is always
+ * evaluated at the current iterate \f$x_k\f$. However, preconditioners for the
+ * linear solve may cache a representation of the linearization, e.g. the
+ * Schwarz subdomain solvers. Near convergence the linearization changes very
+ * little between nonlinear iterations, so these caches can be reused for a few
+ * iterations (see `LinearSolver::Schwarz::Actions::ResetSubdomainSolver`).
+ *
  * \par Array sections
  * This nonlinear solver supports running over a subset of the elements in the
  * array parallel component (see `Parallel::Section`). Set the
@@ -3,34 +3,69 @@
 
 #include "ParallelAlgorithms/SurfaceFinder/SurfaceFinder.hpp"
 
-#include <array>
+#include <cmath>
 #include <cstddef>
+#include <type_traits>
 #include <vector>
 
-#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
-#include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
-#include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace SurfaceFinder {
 namespace {
-// Wrapping for the interpolator for Toms748 rootfind.
+// Algorithm 30 in Kopriva, p. 75
+DataVector barycentric_weights(const DataVector& collocation_points) {
+  const size_t num_points = collocation_points.size();
+  DataVector bary_weights(num_points, 1.);
+  for (size_t j = 1; j < num_points; j++) {
+    for (size_t k = 0; k < j; k++) {
+      bary_weights[k] *= collocation_points[k] - collocation_points[j];
+      bary_weights[j] *= collocation_points[j] - collocation_points[k];
+    }
+  }
+  return 1. / bary_weights;
+}
+
+// Barycentric interpolation along the rays, wrapped for the Toms748 rootfind.
+// The `values` on the radial collocation points are stored with the ray index
+// varying fastest, so when `x` is a SIMD batch its lanes interpolate along the
+// consecutive rays starting at `first_ray`.
 struct RayInterpolant {
- public:
-  double operator()(double x) const {
-    std::array<Matrix, 1> interpolation_matrices{
-        Spectral::interpolation_matrix(mesh, x)};
-    return apply_matrices(interpolation_matrices, values, mesh.extents())[0];
+  template <typename T>
+  T operator()(const T x, const size_t first_ray) const {
+    T numerator = static_cast<T>(0.);
+    T denominator = static_cast<T>(0.);
+    T value_at_match = static_cast<T>(0.);
+    auto matches = static_cast<simd::mask_type_t<T>>(0);
+    for (size_t k = 0; k < collocation_points.size(); ++k) {
+      T values_at_point{};
+      if constexpr (std::is_same_v<T, double>) {
+        values_at_point = values[k * num_rays + first_ray];
+      } else {
+        values_at_point =
+            simd::load_unaligned(&values[k * num_rays + first_ray]);
+      }
+      const T difference = x - static_cast<T>(collocation_points[k]);
+      const auto match = difference == static_cast<T>(0.);
+      value_at_match = simd::select(match, values_at_point, value_at_match);
+      matches = matches or match;
+      const T term = static_cast<T>(bary_weights[k]) /
+                     simd::select(match, static_cast<T>(1.), difference);
+      numerator += term * values_at_point;
+      denominator += term;
+    }
+    return simd::select(matches, value_at_match, numerator / denominator);
   }
 
   const DataVector& values;
-  const Mesh<1>& mesh;
+  size_t num_rays;
+  const DataVector& collocation_points;
+  const DataVector& bary_weights;
 };
 }  // namespace
 
@@ -39,47 +74,82 @@ std::vector<std::optional<double>> find_radial_surface(
     const tnsr::I<DataVector, 2, Frame::ElementLogical>& angular_coords,
     const double relative_tolerance, const double absolute_tolerance) {
   const size_t num_rays = angular_coords[0].size();
-  const DataVector subtracted_data = get(data) - target;
-  // The third Matrix in this array is not initialised so it is skipped by
-  // apply_matrices()
-  std::array<Matrix, 3> interpolation_matrices;
-  std::vector<std::optional<double>> result(num_rays, std::nullopt);
-  const double ray_size = mesh.extents(2);
-  DataVector interpolated_data(ray_size);
-  const auto xi_mesh = mesh.slice_through(0);
-  const auto eta_mesh = mesh.slice_through(1);
+  const size_t num_xi = mesh.extents(0);
+  const size_t num_eta = mesh.extents(1);
+  const size_t ray_size = mesh.extents(2);
+  const auto radial_mesh = mesh.slice_through(2);
+  const DataVector& radial_points = Spectral::collocation_points(radial_mesh);
+  const DataVector radial_bary_weights = barycentric_weights(radial_points);
 
-  for (size_t i = 0; i < num_rays; i++) {
-    // Potential speed-up: Currently, the interpolation is done one ray at a
-    // time (i.e. the interpolation matrices are built to interpolate to one
-    // ray, and then applied to the data sequentially). Instead one could use
-    // something like irregular interpolant to do this all at once.
-    interpolation_matrices[0] =
-        Spectral::interpolation_matrix(xi_mesh, get<0>(angular_coords)[i]);
-    interpolation_matrices[1] =
-        Spectral::interpolation_matrix(eta_mesh, get<1>(angular_coords)[i]);
-
-    // Interpolate data onto the ray.
-    apply_matrices(make_not_null(&interpolated_data), interpolation_matrices,
-                   subtracted_data, mesh.extents());
-    const RayInterpolant data_interpolator{interpolated_data,
-                                           mesh.slice_through(2)};
+  // Interpolate data onto all rays at once. The rows of the interpolation
+  // matrices correspond to the rays.
+  const Matrix xi_interpolation_matrix = Spectral::interpolation_matrix(
+      mesh.slice_through(0), get<0>(angular_coords));
+  const Matrix eta_interpolation_matrix = Spectral::interpolation_matrix(
+      mesh.slice_through(1), get<1>(angular_coords));
+  DataVector ray_values(ray_size * num_rays, 0.);
+  for (size_t k = 0; k < ray_size; ++k) {
+    for (size_t j = 0; j < num_eta; ++j) {
+      for (size_t i = 0; i < num_xi; ++i) {
+        const double value =
+            get(data)[i + num_xi * (j + num_eta * k)] - target;
+        for (size_t ray = 0; ray < num_rays; ++ray) {
+          ray_values[k * num_rays + ray] += xi_interpolation_matrix(ray, i) *
+                                            eta_interpolation_matrix(ray, j) *
+                                            value;
+        }
+      }
+    }
+  }
+  const RayInterpolant all_rays_interpolator{
+      ray_values, num_rays, radial_points, radial_bary_weights};
 
-    // Perform root-find only if the element brackets a root.
+  // Perform root-find only on the rays where the element brackets a root.
+  std::vector<size_t> bracketing_rays{};
+  std::vector<double> lower_radial_bounds{};
+  std::vector<double> upper_radial_bounds{};
+  for (size_t ray = 0; ray < num_rays; ++ray) {
     const double lower_radial_bound =
         mesh.quadrature(2) == Spectral::Quadrature::GaussLobatto
-            ? interpolated_data[0]
-            : data_interpolator(-1.);
+            ? ray_values[ray]
+            : all_rays_interpolator(-1., ray);
     const double upper_radial_bound =
         mesh.quadrature(2) == Spectral::Quadrature::GaussLobatto
-            ? interpolated_data[mesh.extents(2) - 1]
-            : data_interpolator(1.);
+            ? ray_values[(ray_size - 1) * num_rays + ray]
+            : all_rays_interpolator(1., ray);
     if (std::signbit(lower_radial_bound) != std::signbit(upper_radial_bound)) {
-      result[i] = RootFinder::toms748(data_interpolator, -1., 1.,
-                                      lower_radial_bound, upper_radial_bound,
-                                      relative_tolerance, absolute_tolerance);
+      bracketing_rays.push_back(ray);
+      lower_radial_bounds.push_back(lower_radial_bound);
+      upper_radial_bounds.push_back(upper_radial_bound);
     }
   }
+
+  std::vector<std::optional<double>> result(num_rays, std::nullopt);
+  const size_t num_bracketing_rays = bracketing_rays.size();
+  if (num_bracketing_rays == 0) {
+    return result;
+  }
+  DataVector bracketing_ray_values(ray_size * num_bracketing_rays);
+  DataVector f_at_lower_bound(num_bracketing_rays);
+  DataVector f_at_upper_bound(num_bracketing_rays);
+  for (size_t b = 0; b < num_bracketing_rays; ++b) {
+    for (size_t k = 0; k < ray_size; ++k) {
+      bracketing_ray_values[k * num_bracketing_rays + b] =
+          ray_values[k * num_rays + bracketing_rays[b]];
+    }
+    f_at_lower_bound[b] = lower_radial_bounds[b];
+    f_at_upper_bound[b] = upper_radial_bounds[b];
+  }
+  const RayInterpolant data_interpolator{bracketing_ray_values,
+                                         num_bracketing_rays, radial_points,
+                                         radial_bary_weights};
+  const DataVector roots = RootFinder::toms748(
+      data_interpolator, DataVector(num_bracketing_rays, -1.),
+      DataVector(num_bracketing_rays, 1.), f_at_lower_bound, f_at_upper_bound,
+      absolute_tolerance, relative_tolerance);
+  for (size_t b = 0; b < num_bracketing_rays; ++b) {
+    result[bracketing_rays[b]] = roots[b];
+  }
   return result;
 }
 }  // namespace SurfaceFinder
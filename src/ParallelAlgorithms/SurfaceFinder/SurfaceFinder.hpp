@@ -27,6 +27,12 @@ namespace SurfaceFinder {
  * than a wedge if necessary by passing in which logical direction points
  * radially.
  *
+ * The data is interpolated onto all rays at once, and the root finds along
+ * all rays that bracket a root are done together by the vectorized
+ * `RootFinder::toms748`, so several rays are processed per SIMD instruction.
+ * Each function evaluation is a barycentric interpolation along the rays with
+ * weights that are computed once per call.
+ *
  * \param data data to find the contour in.
  * \param target target value for the contour level in the data.
  * \param mesh mesh for the element.
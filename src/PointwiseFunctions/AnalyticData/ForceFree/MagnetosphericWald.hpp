@@ -13,6 +13,7 @@
 #include "PointwiseFunctions/AnalyticData/AnalyticData.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/SphericalKerrSchild.hpp"
 #include "PointwiseFunctions/InitialDataUtilities/InitialData.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -135,7 +136,13 @@ class MagnetosphericWald : public evolution::initial_data::InitialData,
     static_assert(sizeof...(Tags) > 1,
                   "The generic template will recurse infinitely if only one "
                   "tag is being retrieved.");
-    return {get<Tags>(variables(x, tmpl::list<Tags>{}))...};
+    // Reuse the intermediate quantities of the background between the metric
+    // variables
+    gr::Solutions::SphericalKerrSchild::IntermediateVars<DataVector,
+                                                         Frame::Inertial>
+        spherical_kerr_schild_cache(0);
+    return {get<Tags>(variables(
+        x, tmpl::list<Tags>{}, make_not_null(&spherical_kerr_schild_cache)))...};
   }
 
   /// Retrieve the metric variables
@@ -147,6 +154,24 @@ class MagnetosphericWald : public evolution::initial_data::InitialData,
   }
 
  private:
+  template <typename Tag>
+  tuples::TaggedTuple<Tag> variables(
+      const tnsr::I<DataVector, 3>& x, tmpl::list<Tag> /*meta*/,
+      const gsl::not_null<gr::Solutions::SphericalKerrSchild::IntermediateVars<
+          DataVector, Frame::Inertial>*>
+          spherical_kerr_schild_cache) const {
+    if constexpr (tmpl::list_contains_v<
+                      gr::Solutions::SphericalKerrSchild::allowed_tags<
+                          DataVector>,
+                      Tag>) {
+      constexpr double dummy_time = 0.0;
+      return background_spacetime_.variables(
+          x, dummy_time, tmpl::list<Tag>{}, spherical_kerr_schild_cache);
+    } else {
+      return variables(x, tmpl::list<Tag>{});
+    }
+  }
+
   double spin_ = std::numeric_limits<double>::signaling_NaN();
   gr::Solutions::SphericalKerrSchild background_spacetime_{};
 
@@ -14,6 +14,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/PolytropicFluid.hpp"
 #include "PointwiseFunctions/Hydro/TagsDeclarations.hpp"
 #include "PointwiseFunctions/InitialDataUtilities/InitialData.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
@@ -220,7 +221,11 @@ class BondiHoyleAccretion : public virtual evolution::initial_data::InitialData,
     static_assert(sizeof...(Tags) > 1,
                   "The generic template will recurse infinitely if only one "
                   "tag is being retrieved.");
-    return {tuples::get<Tags>(variables(x, tmpl::list<Tags>{}))...};
+    // The metric variables share the intermediate quantities of the background
+    gr::Solutions::KerrSchild::IntermediateVars<DataType, Frame::Inertial>
+        kerr_schild_cache(0);
+    return {tuples::get<Tags>(variables(x, tmpl::list<Tags>{},
+                                        make_not_null(&kerr_schild_cache)))...};
   }
 
   /// Retrieve the metric variables at `x`
@@ -232,8 +237,7 @@ class BondiHoyleAccretion : public virtual evolution::initial_data::InitialData,
   tuples::TaggedTuple<Tag> variables(const tnsr::I<DataType, 3>& x,
                                      tmpl::list<Tag> /*meta*/) const {
     constexpr double dummy_time = 0.0;
-    return {std::move(get<Tag>(background_spacetime_.variables(
-        x, dummy_time, gr::Solutions::KerrSchild::tags<DataType>{})))};
+    return background_spacetime_.variables(x, dummy_time, tmpl::list<Tag>{});
   }
 
   // NOLINTNEXTLINE(google-runtime-references)
@@ -247,6 +251,22 @@ class BondiHoyleAccretion : public virtual evolution::initial_data::InitialData,
   friend bool operator==(const BondiHoyleAccretion& lhs,
                          const BondiHoyleAccretion& rhs);
 
+  template <typename DataType, typename Tag>
+  tuples::TaggedTuple<Tag> variables(
+      const tnsr::I<DataType, 3>& x, tmpl::list<Tag> /*meta*/,
+      const gsl::not_null<gr::Solutions::KerrSchild::IntermediateVars<
+          DataType, Frame::Inertial>*>
+          kerr_schild_cache) const {
+    if constexpr (tmpl::list_contains_v<
+                      gr::Solutions::KerrSchild::tags<DataType>, Tag>) {
+      constexpr double dummy_time = 0.0;
+      return background_spacetime_.variables(x, dummy_time, tmpl::list<Tag>{},
+                                             kerr_schild_cache);
+    } else {
+      return variables(x, tmpl::list<Tag>{});
+    }
+  }
+
   // compute the spatial velocity in spherical Kerr-Schild coordinates
   template <typename DataType>
   tnsr::I<DataType, 3, Frame::NoFrame> spatial_velocity(
@@ -80,6 +80,50 @@ ProgenitorProfile::ProgenitorProfile(const std::string& filename) {
   temperature_ *= c2g_temp_;
   fluid_velocity_ /= speed_of_light_cgs_;
   maximum_radius_ = max(radius_);
+  compute_radius_lookup_table();
+}
+
+void ProgenitorProfile::compute_radius_lookup_table() {
+  const auto first_positive_radius =
+      std::upper_bound(radius_.begin(), radius_.end(), 0.0);
+  if (UNLIKELY(first_positive_radius == radius_.end() or
+               *first_positive_radius >= maximum_radius_)) {
+    ERROR("The progenitor profile needs at least two distinct positive radii.");
+  }
+  min_lookup_radius_ = *first_positive_radius;
+  log_min_lookup_radius_ = log(min_lookup_radius_);
+  const size_t num_buckets = num_radial_points_;
+  inverse_log_lookup_spacing_ = static_cast<double>(num_buckets) /
+                                (log(maximum_radius_) - log_min_lookup_radius_);
+  radius_lookup_table_.resize(num_buckets + 1);
+  size_t radius_index = 0;
+  for (size_t bucket = 0; bucket <= num_buckets; ++bucket) {
+    const double lower_edge =
+        exp(log_min_lookup_radius_ +
+            static_cast<double>(bucket) / inverse_log_lookup_spacing_);
+    while (radius_index + 1 < num_radial_points_ and
+           radius_[radius_index + 1] <= lower_edge) {
+      ++radius_index;
+    }
+    radius_lookup_table_[bucket] = radius_index;
+  }
+}
+
+size_t ProgenitorProfile::lower_radius_index(
+    const double target_radius) const {
+  size_t radius_index = 0;
+  if (target_radius >= min_lookup_radius_) {
+    const auto bucket = std::min(
+        static_cast<size_t>((log(target_radius) - log_min_lookup_radius_) *
+                            inverse_log_lookup_spacing_),
+        radius_lookup_table_.size() - 1);
+    radius_index = radius_lookup_table_[bucket];
+  }
+  while (radius_index + 1 < num_radial_points_ and
+         radius_[radius_index + 1] <= target_radius) {
+    ++radius_index;
+  }
+  return radius_index;
 }
 
 void ProgenitorProfile::pup(PUP::er& p) {
@@ -97,6 +141,11 @@ void ProgenitorProfile::pup(PUP::er& p) {
   p | electron_fraction_;
   p | chi_;
   p | metric_potential_;
+
+  p | min_lookup_radius_;
+  p | log_min_lookup_radius_;
+  p | inverse_log_lookup_spacing_;
+  p | radius_lookup_table_;
 }
 
 namespace {
@@ -153,30 +202,12 @@ std::array<double, 6> ProgenitorProfile::interpolate(
   }
   using std::abs;
 
-  auto radius_index =
-      static_cast<size_t>(num_radial_points_ * target_radius / maximum_radius_);
-
-  if (const size_t grid_index = num_angular_points_ * radius_index;
-      UNLIKELY(grid_index > num_grid_points_)) {
-    ERROR("grid_index " << grid_index
-                        << " is larger than the number of grid points "
-                        << num_grid_points_
-                        << "\nnumber of angular points: " << num_angular_points_
-                        << "\nnumber of radial points: " << num_radial_points_
-                        << "\nradius index: " << radius_index);
-  }
-
-  if (UNLIKELY(radius_index >= num_radial_points_)) {
-    ERROR(
-        "radius_index " << radius_index
-                        << " is larger than the number of radial grid points: "
-                        << num_radial_points_);
-  }
-
-  // The radial index at which the stencil lies on the progenitor grid.
+  // The radial index at which the stencil lies on the progenitor grid, chosen
+  // so that the target radius lies between the two central points.
   const size_t radial_stencil_index = static_cast<size_t>(std::clamp(
-      static_cast<int>(radius_index) - static_cast<int>(stencil_size) / 2, 0,
-      static_cast<int>(num_radial_points_ - stencil_size)));
+      static_cast<int>(lower_radius_index(target_radius)) -
+          (static_cast<int>(stencil_size) / 2 - 1),
+      0, static_cast<int>(num_radial_points_ - stencil_size)));
 
   const size_t radial_index = radial_stencil_index;
   // Radial interpolation
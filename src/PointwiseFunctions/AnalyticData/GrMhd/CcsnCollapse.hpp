@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
@@ -24,6 +25,10 @@ namespace grmhd::AnalyticData {
 namespace detail {
 /*!
  * \brief Read a massive star supernova progenitor from file.
+ *
+ * The profile may be spaced non-uniformly in radius. The interpolation stencil
+ * of a radius is found in constant time from a table of the profile points
+ * bucketed uniformly in log(radius), which is built once on construction.
  */
 class ProgenitorProfile {
  public:
@@ -48,6 +53,15 @@ class ProgenitorProfile {
   void pup(PUP::er& p);
 
  private:
+  // Buckets the radii of the profile uniformly in log(radius), recording the
+  // last profile point below the lower edge of each bucket. Profiles are
+  // typically close to logarithmically spaced, so the bracketing points of
+  // any radius are found in a few steps from its bucket.
+  void compute_radius_lookup_table();
+
+  // The index of the last profile point at or below the `target_radius`
+  size_t lower_radius_index(double target_radius) const;
+
   double maximum_radius_{std::numeric_limits<double>::signaling_NaN()};
   double max_density_ratio_for_linear_interpolation_{
       std::numeric_limits<double>::signaling_NaN()};
@@ -101,6 +115,12 @@ class ProgenitorProfile {
   DataVector chi_;
   DataVector metric_potential_;
   DataVector temperature_;
+
+  double min_lookup_radius_{std::numeric_limits<double>::signaling_NaN()};
+  double log_min_lookup_radius_{std::numeric_limits<double>::signaling_NaN()};
+  double inverse_log_lookup_spacing_{
+      std::numeric_limits<double>::signaling_NaN()};
+  std::vector<size_t> radius_lookup_table_{};
 };
 }  // namespace detail
 
@@ -13,6 +13,7 @@
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/KerrSchild.hpp"
 #include "PointwiseFunctions/GeneralRelativity/KerrSchildCoords.hpp"
 #include "PointwiseFunctions/InitialDataUtilities/InitialData.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -150,7 +151,12 @@ class ExactWald : public evolution::initial_data::InitialData,
     static_assert(sizeof...(Tags) > 1,
                   "The generic template will recurse infinitely if only one "
                   "tag is being retrieved.");
-    return {get<Tags>(variables(x, t, tmpl::list<Tags>{}))...};
+    // The metric variables share the intermediate quantities of the background
+    // instead of recomputing them for every tag
+    gr::Solutions::KerrSchild::IntermediateVars<DataVector, Frame::Inertial>
+        kerr_schild_cache(0);
+    return {get<Tags>(variables(x, t, tmpl::list<Tags>{},
+                                make_not_null(&kerr_schild_cache)))...};
   }
 
   /// Retrieve the metric variables
@@ -161,6 +167,21 @@ class ExactWald : public evolution::initial_data::InitialData,
   }
 
  private:
+  template <typename Tag>
+  tuples::TaggedTuple<Tag> variables(
+      const tnsr::I<DataVector, 3>& x, const double t, tmpl::list<Tag> /*meta*/,
+      const gsl::not_null<gr::Solutions::KerrSchild::IntermediateVars<
+          DataVector, Frame::Inertial>*>
+          kerr_schild_cache) const {
+    if constexpr (tmpl::list_contains_v<
+                      gr::Solutions::KerrSchild::tags<DataVector>, Tag>) {
+      return background_spacetime_.variables(x, t, tmpl::list<Tag>{},
+                                             kerr_schild_cache);
+    } else {
+      return variables(x, t, tmpl::list<Tag>{});
+    }
+  }
+
   gr::Solutions::KerrSchild background_spacetime_{
       1.0, {{0.0, 0.0, 0.0}}, {{0.0, 0.0, 0.0}}};
   double magnetic_field_amplitude_ =
@@ -304,6 +304,26 @@ class KerrSchild : public AnalyticSolution<3_st>,
     return {cache.get_var(computer, Tags{})...};
   }
 
+  /// Same as above, but the intermediate quantities are stored in `cache` so
+  /// that later calls at the same points `x` reuse them. The `cache` must not
+  /// be used with different points.
+  template <typename DataType, typename Frame, typename... Tags>
+  tuples::TaggedTuple<Tags...> variables(
+      const tnsr::I<DataType, volume_dim, Frame>& x, double /*t*/,
+      tmpl::list<Tags...> /*meta*/,
+      gsl::not_null<IntermediateVars<DataType, Frame>*> cache) const {
+    static_assert(
+        tmpl2::flat_all_v<
+            tmpl::list_contains_v<tags<DataType, Frame>, Tags>...>,
+        "At least one of the requested tags is not supported. The requested "
+        "tags are listed as template parameters of the `variables` function.");
+    if (cache->number_of_grid_points() != get_size(*x.begin())) {
+      cache->reinitialize(get_size(*x.begin()));
+    }
+    IntermediateComputer<DataType, Frame> computer(*this, x);
+    return {cache->get_var(computer, Tags{})...};
+  }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p);
 
@@ -589,7 +589,7 @@ class SphericalKerrSchild : public AnalyticSolution<3_st>,
         "At least one of the requested tags is not supported. The requested "
         "tags are listed as template parameters of the `variables` function.");
     if (cache->number_of_grid_points() != get_size(*x.begin())) {
-      *cache = IntermediateVars<DataType, Frame>(get_size(*x.begin()));
+      cache->reinitialize(get_size(*x.begin()));
     }
     IntermediateComputer<DataType, Frame> computer(*this, x);
     return {cache->get_var(computer, Tags{})...};
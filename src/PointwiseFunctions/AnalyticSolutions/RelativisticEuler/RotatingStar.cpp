@@ -182,6 +182,36 @@ void hydro_interpolation(const gsl::not_null<double*> target_var,
         target_var, make_not_null(&error_y), target_coord, var_stencil, coords);
   }
 }
+
+// The weights of the Lagrange polynomial through the `coords` at the
+// `target_coord`. The metric variables share their stencils, so computing the
+// weights once and applying them to each variable is cheaper than
+// interpolating each variable with `intrp::polynomial_interpolation`.
+template <size_t StencilSize>
+std::array<double, StencilSize> lagrange_weights(
+    const double target_coord, const gsl::span<const double>& coords) {
+  std::array<double, StencilSize> weights{};
+  for (size_t i = 0; i < StencilSize; ++i) {
+    double weight = 1.0;
+    for (size_t j = 0; j < StencilSize; ++j) {
+      if (j != i) {
+        weight *= (target_coord - coords[j]) / (coords[i] - coords[j]);
+      }
+    }
+    gsl::at(weights, i) = weight;
+  }
+  return weights;
+}
+
+template <size_t StencilSize>
+double apply_lagrange_weights(const std::array<double, StencilSize>& weights,
+                              const gsl::span<const double>& var_stencil) {
+  double result = 0.0;
+  for (size_t i = 0; i < StencilSize; ++i) {
+    result += gsl::at(weights, i) * var_stencil[i];
+  }
+  return result;
+}
 }  // namespace
 
 std::array<double, 6> CstSolution::interpolate(
@@ -270,7 +300,6 @@ std::array<double, 6> CstSolution::interpolate(
     gsl::at(radius_for_stencil, stencil_rad_index) =
         radius_[radial_index + angular_stencil_index];
 
-    double error_y = 0.0;
     const auto cos_theta_span = gsl::make_span(
         &cos_theta_[radial_index + angular_stencil_index], stencil_size);
     // At the surface we want to do linear interpolation to avoid unphysical
@@ -295,34 +324,26 @@ std::array<double, 6> CstSolution::interpolate(
                          stencil_size),
           cos_theta_span);
     }
-    intrp::polynomial_interpolation<stencil_size - 1>(
-        make_not_null(&gsl::at(alpha_rad_stencil, stencil_rad_index)),
-        make_not_null(&error_y), target_abs_cos_theta,
-        gsl::make_span(&alpha_[radial_index + angular_stencil_index],
-                       stencil_size),
-        cos_theta_span);
-    intrp::polynomial_interpolation<stencil_size - 1>(
-        make_not_null(&gsl::at(rho_rad_stencil, stencil_rad_index)),
-        make_not_null(&error_y), target_abs_cos_theta,
-        gsl::make_span(&rho_[radial_index + angular_stencil_index],
-                       stencil_size),
-        cos_theta_span);
-    intrp::polynomial_interpolation<stencil_size - 1>(
-        make_not_null(&gsl::at(gamma_rad_stencil, stencil_rad_index)),
-        make_not_null(&error_y), target_abs_cos_theta,
-        gsl::make_span(&gamma_[radial_index + angular_stencil_index],
-                       stencil_size),
-        cos_theta_span);
-    intrp::polynomial_interpolation<stencil_size - 1>(
-        make_not_null(&gsl::at(omega_rad_stencil, stencil_rad_index)),
-        make_not_null(&error_y), target_abs_cos_theta,
-        gsl::make_span(&omega_[radial_index + angular_stencil_index],
-                       stencil_size),
-        cos_theta_span);
+    const auto angular_weights =
+        lagrange_weights<stencil_size>(target_abs_cos_theta, cos_theta_span);
+    const auto metric_var_at_cos_theta =
+        [&angular_weights, radial_index,
+         angular_stencil_index](const DataVector& metric_var) {
+          return apply_lagrange_weights<stencil_size>(
+              angular_weights,
+              gsl::make_span(&metric_var[radial_index + angular_stencil_index],
+                             stencil_size));
+        };
+    gsl::at(alpha_rad_stencil, stencil_rad_index) =
+        metric_var_at_cos_theta(alpha_);
+    gsl::at(rho_rad_stencil, stencil_rad_index) = metric_var_at_cos_theta(rho_);
+    gsl::at(gamma_rad_stencil, stencil_rad_index) =
+        metric_var_at_cos_theta(gamma_);
+    gsl::at(omega_rad_stencil, stencil_rad_index) =
+        metric_var_at_cos_theta(omega_);
   }
 
   // Do radial interpolation
-  double error_y = 0.0;
   double target_rest_mass_density{std::numeric_limits<double>::signaling_NaN()};
   double target_fluid_velocity{std::numeric_limits<double>::signaling_NaN()};
   double target_alpha{std::numeric_limits<double>::signaling_NaN()};
@@ -343,18 +364,16 @@ std::array<double, 6> CstSolution::interpolate(
         gsl::make_span(&fluid_velocity_rad_stencil[0], stencil_size),
         radius_span);
   }
-  intrp::polynomial_interpolation<stencil_size - 1>(
-      make_not_null(&target_alpha), make_not_null(&error_y), target_radius,
-      gsl::make_span(&alpha_rad_stencil[0], stencil_size), radius_span);
-  intrp::polynomial_interpolation<stencil_size - 1>(
-      make_not_null(&target_rho), make_not_null(&error_y), target_radius,
-      gsl::make_span(&rho_rad_stencil[0], stencil_size), radius_span);
-  intrp::polynomial_interpolation<stencil_size - 1>(
-      make_not_null(&target_gamma), make_not_null(&error_y), target_radius,
-      gsl::make_span(&gamma_rad_stencil[0], stencil_size), radius_span);
-  intrp::polynomial_interpolation<stencil_size - 1>(
-      make_not_null(&target_omega), make_not_null(&error_y), target_radius,
-      gsl::make_span(&omega_rad_stencil[0], stencil_size), radius_span);
+  const auto radial_weights =
+      lagrange_weights<stencil_size>(target_radius, radius_span);
+  target_alpha = apply_lagrange_weights<stencil_size>(
+      radial_weights, gsl::make_span(&alpha_rad_stencil[0], stencil_size));
+  target_rho = apply_lagrange_weights<stencil_size>(
+      radial_weights, gsl::make_span(&rho_rad_stencil[0], stencil_size));
+  target_gamma = apply_lagrange_weights<stencil_size>(
+      radial_weights, gsl::make_span(&gamma_rad_stencil[0], stencil_size));
+  target_omega = apply_lagrange_weights<stencil_size>(
+      radial_weights, gsl::make_span(&omega_rad_stencil[0], stencil_size));
 
   if (interpolate_hydro_vars) {
     if (UNLIKELY(target_rest_mass_density < 0.0)) {
@@ -10,6 +10,7 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace gr {
 template <size_t SpatialDim, typename Frame, IndexType Index, typename DataType>
@@ -116,6 +117,21 @@ GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3), (double, DataVector),
                          Frame::Spherical<Frame::Grid>),
                         (IndexType::Spatial, IndexType::Spacetime))
 
+#ifdef SPECTRE_USE_XSIMD
+#define INSTANTIATE_SIMD(_, data)                                            \
+  template void gr::christoffel_first_kind(                                  \
+      const gsl::not_null<                                                   \
+          tnsr::abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>*>  \
+          christoffel,                                                       \
+      const tnsr::abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>& \
+          d_metric);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_SIMD, (1, 2, 3), (simd::batch<double>),
+                        (Frame::Inertial), (IndexType::Spacetime))
+
+#undef INSTANTIATE_SIMD
+#endif  // SPECTRE_USE_XSIMD
+
 #undef DIM
 #undef DTYPE
 #undef FRAME
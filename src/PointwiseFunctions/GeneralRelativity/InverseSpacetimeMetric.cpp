@@ -11,6 +11,7 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace gr {
 template <typename DataType, size_t Dim, typename Frame>
@@ -70,6 +71,22 @@ void inverse_spacetime_metric(
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3), (double, DataVector),
                         (Frame::Grid, Frame::Distorted, Frame::Inertial))
 
+#ifdef SPECTRE_USE_XSIMD
+#define INSTANTIATE_SIMD(_, data)                                         \
+  template void gr::inverse_spacetime_metric(                             \
+      const gsl::not_null<tnsr::AA<DTYPE(data), DIM(data), FRAME(data)>*> \
+          inv_spacetime_metric,                                           \
+      const Scalar<DTYPE(data)>& lapse,                                   \
+      const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift,          \
+      const tnsr::II<DTYPE(data), DIM(data), FRAME(data)>&                \
+          inverse_spatial_metric);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_SIMD, (1, 2, 3), (simd::batch<double>),
+                        (Frame::Inertial))
+
+#undef INSTANTIATE_SIMD
+#endif  // SPECTRE_USE_XSIMD
+
 #undef DIM
 #undef DTYPE
 #undef FRAME
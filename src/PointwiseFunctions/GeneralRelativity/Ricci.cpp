@@ -22,18 +22,28 @@ void ricci_tensor(
     component = 0.0;
   }
   const auto dimensionality = index_dim<0>(*result);
+  // The contracted Christoffel symbols are computed once instead of for each
+  // component of the result
+  auto contracted_christoffel =
+      make_with_value<tnsr::a<DataType, SpatialDim, Frame, Index>>(
+          get<0, 0>(*result), 0.0);
+  for (size_t m = 0; m < dimensionality; ++m) {
+    for (size_t n = 0; n < dimensionality; ++n) {
+      contracted_christoffel.get(m) += christoffel_2nd_kind.get(n, n, m);
+    }
+  }
   for (size_t i = 0; i < dimensionality; ++i) {
     for (size_t j = i; j < dimensionality; ++j) {
       for (size_t m = 0; m < dimensionality; ++m) {
         result->get(i, j) += d_christoffel_2nd_kind.get(m, m, i, j) -
                              0.5 * (d_christoffel_2nd_kind.get(i, m, m, j) +
-                                    d_christoffel_2nd_kind.get(j, m, m, i));
+                                    d_christoffel_2nd_kind.get(j, m, m, i)) +
+                             christoffel_2nd_kind.get(m, i, j) *
+                                 contracted_christoffel.get(m);
 
         for (size_t n = 0; n < dimensionality; ++n) {
-          result->get(i, j) += christoffel_2nd_kind.get(m, i, j) *
-                                   christoffel_2nd_kind.get(n, n, m) -
-                               christoffel_2nd_kind.get(m, i, n) *
-                                   christoffel_2nd_kind.get(n, m, j);
+          result->get(i, j) -= christoffel_2nd_kind.get(m, i, n) *
+                               christoffel_2nd_kind.get(n, m, j);
         }
       }
     }
@@ -11,6 +11,7 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace gr {
 template <typename DataType, size_t SpatialDim, typename Frame>
@@ -56,6 +57,20 @@ void spacetime_normal_vector(
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3), (double, DataVector),
                         (Frame::Grid, Frame::Inertial))
 
+#ifdef SPECTRE_USE_XSIMD
+#define INSTANTIATE_SIMD(_, data)                                        \
+  template void gr::spacetime_normal_vector(                             \
+      const gsl::not_null<tnsr::A<DTYPE(data), DIM(data), FRAME(data)>*> \
+          spacetime_normal_vector,                                       \
+      const Scalar<DTYPE(data)>& lapse,                                  \
+      const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_SIMD, (1, 2, 3), (simd::batch<double>),
+                        (Frame::Inertial))
+
+#undef INSTANTIATE_SIMD
+#endif  // SPECTRE_USE_XSIMD
+
 #undef DIM
 #undef DTYPE
 #undef FRAME
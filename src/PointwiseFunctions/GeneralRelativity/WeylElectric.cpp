@@ -3,6 +3,7 @@
 
 #include "PointwiseFunctions/GeneralRelativity/WeylElectric.hpp"
 
+#include "DataStructures/Tensor/EagerMath/Trace.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/VectorImpl.hpp"
 #include "Utilities/ContainerHelpers.hpp"
@@ -30,16 +31,29 @@ void weyl_electric(
     const tnsr::ii<DataType, SpatialDim, Frame>& spatial_ricci,
     const tnsr::ii<DataType, SpatialDim, Frame>& extrinsic_curvature,
     const tnsr::II<DataType, SpatialDim, Frame>& inverse_spatial_metric) {
+  // The trace and the mixed extrinsic curvature are computed once instead of
+  // for each component of the result
+  const Scalar<DataType> trace_extrinsic_curvature =
+      trace(extrinsic_curvature, inverse_spatial_metric);
+  auto extrinsic_curvature_up_down =
+      make_with_value<tnsr::Ij<DataType, SpatialDim, Frame>>(
+          get<0, 0>(inverse_spatial_metric), 0.0);
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    for (size_t j = 0; j < SpatialDim; ++j) {
+      for (size_t k = 0; k < SpatialDim; ++k) {
+        extrinsic_curvature_up_down.get(i, j) +=
+            inverse_spatial_metric.get(i, k) * extrinsic_curvature.get(k, j);
+      }
+    }
+  }
   *weyl_electric_part = spatial_ricci;
   for (size_t i = 0; i < SpatialDim; ++i) {
     for (size_t j = i; j < SpatialDim; ++j) {
+      weyl_electric_part->get(i, j) +=
+          get(trace_extrinsic_curvature) * extrinsic_curvature.get(i, j);
       for (size_t k = 0; k < SpatialDim; ++k) {
-        for (size_t l = 0; l < SpatialDim; ++l) {
-          weyl_electric_part->get(i, j) +=
-              inverse_spatial_metric.get(k, l) *
-              (extrinsic_curvature.get(k, l) * extrinsic_curvature.get(i, j) -
-               extrinsic_curvature.get(i, l) * extrinsic_curvature.get(k, j));
-        }
+        weyl_electric_part->get(i, j) -= extrinsic_curvature.get(i, k) *
+                                         extrinsic_curvature_up_down.get(k, j);
       }
     }
   }
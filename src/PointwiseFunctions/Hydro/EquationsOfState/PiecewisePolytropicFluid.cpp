@@ -158,6 +158,10 @@ PiecewisePolytropicFluid<true>::rest_mass_density_from_enthalpy_impl(
   double polytropic_constant = std::numeric_limits<double>::signaling_NaN();
   double polytropic_exponent = std::numeric_limits<double>::signaling_NaN();
 
+  // The same for every point, so it is evaluated once per call
+  const double transition_density_factor =
+      pow(transition_density_, polytropic_exponent_lo_ - 1.0);
+
   auto result = make_with_value<Scalar<DataType>>(specific_enthalpy, 0.0);
 
   for (size_t i = 0; i < get_size(get(specific_enthalpy)); ++i) {
@@ -176,8 +180,7 @@ PiecewisePolytropicFluid<true>::rest_mass_density_from_enthalpy_impl(
                  (polytropic_exponent - polytropic_exponent_lo_) /
                      ((polytropic_exponent_hi_ - 1.0) *
                       (polytropic_exponent_lo_ - 1.0)) *
-                     polytropic_constant_lo_ *
-                     pow(transition_density_, polytropic_exponent_lo_ - 1.0)),
+                     polytropic_constant_lo_ * transition_density_factor),
             1.0 / (polytropic_exponent - 1.0));
   }
   return result;
@@ -195,6 +198,10 @@ PiecewisePolytropicFluid<false>::rest_mass_density_from_enthalpy_impl(
   double polytropic_constant = std::numeric_limits<double>::signaling_NaN();
   double polytropic_exponent = std::numeric_limits<double>::signaling_NaN();
 
+  // The same for every point, so it is evaluated once per call
+  const double transition_density_factor =
+      pow(transition_density_, polytropic_exponent_lo_ - 1.0);
+
   auto result = make_with_value<Scalar<DataType>>(specific_enthalpy, 0.0);
 
   for (size_t i = 0; i < get_size(get(specific_enthalpy)); ++i) {
@@ -213,8 +220,7 @@ PiecewisePolytropicFluid<false>::rest_mass_density_from_enthalpy_impl(
                  (polytropic_exponent - polytropic_exponent_lo_) /
                      ((polytropic_exponent_hi_ - 1.0) *
                       (polytropic_exponent_lo_ - 1.0)) *
-                     polytropic_constant_lo_ *
-                     pow(transition_density_, polytropic_exponent_lo_ - 1.0)),
+                     polytropic_constant_lo_ * transition_density_factor),
             1.0 / (polytropic_exponent - 1.0));
   }
   return result;
@@ -228,6 +234,10 @@ Scalar<DataType> PiecewisePolytropicFluid<IsRelativistic>::
   double polytropic_constant = std::numeric_limits<double>::signaling_NaN();
   double polytropic_exponent = std::numeric_limits<double>::signaling_NaN();
 
+  // The same for every point, so it is evaluated once per call
+  const double transition_density_factor =
+      pow(transition_density_, polytropic_exponent_lo_ - 1.0);
+
   auto result = make_with_value<Scalar<DataType>>(rest_mass_density, 0.0);
 
   for (size_t i = 0; i < get_size(get(rest_mass_density)); ++i) {
@@ -244,8 +254,7 @@ Scalar<DataType> PiecewisePolytropicFluid<IsRelativistic>::
         (polytropic_exponent - polytropic_exponent_lo_) /
             ((polytropic_exponent_hi_ - 1.0) *
              (polytropic_exponent_lo_ - 1.0)) *
-            polytropic_constant_lo_ *
-            pow(transition_density_, (polytropic_exponent_lo_ - 1.0));
+            polytropic_constant_lo_ * transition_density_factor;
   }
   return result;
 }
@@ -142,14 +142,18 @@ Scalar<DataType> Spectral::pressure_from_density_impl(
 template <class DataType>
 Scalar<DataType> Spectral::rest_mass_density_from_enthalpy_impl(
     const Scalar<DataType>& specific_enthalpy) const {
+  const double reference_enthalpy =
+      specific_enthalpy_from_density(reference_density_);
+  const double enthalpy_of_x_max =
+      specific_enthalpy_from_density(reference_density_ * exp(x_max_));
   if constexpr (std::is_same_v<DataType, double>) {
-    return Scalar<double>{
-        rest_mass_density_from_enthalpy(get(specific_enthalpy))};
+    return Scalar<double>{rest_mass_density_from_enthalpy(
+        get(specific_enthalpy), reference_enthalpy, enthalpy_of_x_max)};
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
     auto result = make_with_value<Scalar<DataVector>>(specific_enthalpy, 0.0);
     for (size_t i = 0; i < get(result).size(); ++i) {
-      get(result)[i] =
-          rest_mass_density_from_enthalpy(get(specific_enthalpy)[i]);
+      get(result)[i] = rest_mass_density_from_enthalpy(
+          get(specific_enthalpy)[i], reference_enthalpy, enthalpy_of_x_max);
     }
     return result;
   }
@@ -208,7 +212,12 @@ double Spectral::chi_from_density(const double rest_mass_density) const {
 
 double Spectral::specific_internal_energy_from_density(
     const double rest_mass_density) const {
-  const double x = log(rest_mass_density / reference_density_);
+  return specific_internal_energy_from_log_density(
+      log(rest_mass_density / reference_density_));
+}
+
+double Spectral::specific_internal_energy_from_log_density(
+    const double x) const {
   if (x <= 0.) {
     return reference_pressure_ / reference_density_ /
            (gamma_coefficients_[0] - 1.0) *
@@ -244,8 +253,10 @@ double Spectral::specific_internal_energy_from_density(
 
 double Spectral::specific_enthalpy_from_density(
     const double rest_mass_density) const {
-  return 1.0 + pressure_from_density(rest_mass_density) / rest_mass_density +
-         specific_internal_energy_from_density(rest_mass_density);
+  // Share the log of the density between the pressure and the energy
+  const double x = log(rest_mass_density / reference_density_);
+  return 1.0 + pressure_from_log_density(x) / rest_mass_density +
+         specific_internal_energy_from_log_density(x);
 }
 
 // P = P_0 exp(Int_0^x Gamma(xx) dxx)
@@ -269,12 +280,9 @@ double Spectral::pressure_from_density(const double rest_mass_density) const {
 
 // Solve for h(rho)=h0, which requires rootfinding for this EoS
 double Spectral::rest_mass_density_from_enthalpy(
-    const double specific_enthalpy) const {
-  const double reference_enthalpy =
-      specific_enthalpy_from_density(reference_density_);
+    const double specific_enthalpy, const double reference_enthalpy,
+    const double enthalpy_of_x_max) const {
   const double upper_density = reference_density_ * exp(x_max_);
-  const double enthalpy_of_x_max_ =
-      specific_enthalpy_from_density(upper_density);
   if (specific_enthalpy <= reference_enthalpy) {
     double rest_mass_density =
         (specific_enthalpy - 1.0) * (gamma_coefficients_[0] - 1.0) /
@@ -283,7 +291,7 @@ double Spectral::rest_mass_density_from_enthalpy(
     rest_mass_density =
         pow(rest_mass_density, 1.0 / (gamma_coefficients_[0] - 1.0));
     return rest_mass_density;
-  } else if (specific_enthalpy >= enthalpy_of_x_max_) {
+  } else if (specific_enthalpy >= enthalpy_of_x_max) {
     // Above maximum density, we also have an analytical expression
     // (h-1-eps_max)*(rho_max/P_max)+1/(Gamma_max-1) = Gamma_max / (Gamma_max-1)
     // * exp((Gamma_max-1)*(x-x_max)) [Can be derived by combining expressions
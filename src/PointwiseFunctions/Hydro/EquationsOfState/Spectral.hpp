@@ -151,10 +151,16 @@ class Spectral : public EquationOfState<true, 1> {
   double integral_of_gamma(const double x) const;
   double chi_from_density(const double density) const;
   double specific_internal_energy_from_density(const double density) const;
+  double specific_internal_energy_from_log_density(const double x) const;
   double specific_enthalpy_from_density(const double density) const;
   double pressure_from_density(const double density) const;
   double pressure_from_log_density(const double x) const;
-  double rest_mass_density_from_enthalpy(const double specific_enthalpy) const;
+  // The enthalpies at the reference and the upper density bound the
+  // root-finding region. They are the same for every point, so callers
+  // evaluating many points compute them once.
+  double rest_mass_density_from_enthalpy(const double specific_enthalpy,
+                                         const double reference_enthalpy,
+                                         const double enthalpy_of_x_max) const;
 
   double reference_density_ = std::numeric_limits<double>::signaling_NaN();
   double reference_pressure_ = std::numeric_limits<double>::signaling_NaN();
@@ -3,15 +3,114 @@
 
 #include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
 #include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace EquationsOfState {
+namespace detail {
+// A file mapped read-only into memory. The mapping is shared with all other
+// processes that map the same file.
+class MappedTable3D {
+ public:
+  explicit MappedTable3D(const std::string& filename) {
+    const int file_descriptor = open(filename.c_str(), O_RDONLY);
+    if (file_descriptor == -1) {
+      ERROR("Could not open the EOS table file '" << filename
+                                                  << "': " << strerror(errno));
+    }
+    struct stat file_status {};
+    if (fstat(file_descriptor, &file_status) != 0) {
+      close(file_descriptor);
+      ERROR("Could not determine the size of the EOS table file '"
+            << filename << "': " << strerror(errno));
+    }
+    size_ = static_cast<size_t>(file_status.st_size);
+    void* const data =
+        mmap(nullptr, size_, PROT_READ, MAP_SHARED, file_descriptor, 0);
+    // The mapping stays valid after closing the file
+    close(file_descriptor);
+    if (data == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+      ERROR("Could not map the EOS table file '" << filename
+                                                 << "': " << strerror(errno));
+    }
+    data_ = data;
+  }
+
+  MappedTable3D(const MappedTable3D&) = delete;
+  MappedTable3D& operator=(const MappedTable3D&) = delete;
+  MappedTable3D(MappedTable3D&&) = delete;
+  MappedTable3D& operator=(MappedTable3D&&) = delete;
+  ~MappedTable3D() { munmap(data_, size_); }
+
+  const char* data() const { return static_cast<const char*>(data_); }
+  size_t size() const { return size_; }
+
+ private:
+  void* data_ = nullptr;
+  size_t size_ = 0;
+};
+}  // namespace detail
+
+namespace {
+struct MappedTableHeader {
+  std::array<char, 8> magic;
+  uint64_t version;
+  uint64_t number_of_temperatures;
+  uint64_t number_of_densities;
+  uint64_t number_of_electron_fractions;
+  uint64_t number_of_vars;
+  double energy_shift;
+  double enthalpy_minimum;
+};
+static_assert(sizeof(MappedTableHeader) == 64);
+
+constexpr std::array<char, 8> mapped_table_magic{
+    {'S', 'p', 'T', 'a', 'b', '3', 'D', '\0'}};
+constexpr uint64_t mapped_table_version = 1;
+// Arrays in the mapped file start at multiples of this many bytes
+constexpr size_t mapped_table_alignment = 64;
+
+size_t aligned_size(const size_t number_of_bytes) {
+  return (number_of_bytes + mapped_table_alignment - 1) /
+         mapped_table_alignment * mapped_table_alignment;
+}
+
+// The table coordinates in the order used by the interpolator
+std::array<gsl::span<const double>, 3> table_coordinates(
+    const Scalar<DataVector>& log_temperature,
+    const Scalar<DataVector>& log_rest_mass_density,
+    const Scalar<DataVector>& electron_fraction) {
+  return {{gsl::make_span(get(log_temperature).data(),
+                          get(log_temperature).size()),
+           gsl::make_span(get(log_rest_mass_density).data(),
+                          get(log_rest_mass_density).size()),
+           gsl::make_span(get(electron_fraction).data(),
+                          get(electron_fraction).size())}};
+}
+
+gsl::span<double> span_of(const gsl::not_null<Scalar<DataVector>*> scalar) {
+  return gsl::make_span(get(*scalar).data(), get(*scalar).size());
+}
+}  // namespace
 
 EQUATION_OF_STATE_MEMBER_DEFINITIONS(template <bool IsRelativistic>,
                                      Tabulated3D<IsRelativistic>, double, 3)
@@ -87,7 +186,8 @@ Tabulated3D<IsRelativistic>::get_clone() const {
 }
 
 template <bool IsRelativistic>
-void Tabulated3D<IsRelativistic>::initialize(const h5::EosTable& spectre_eos) {
+void Tabulated3D<IsRelativistic>::initialize(const h5::EosTable& spectre_eos,
+                                             const intrp::TableLayout layout) {
   // STEP 0: Allocate intermediate data structures for initialization
 
   auto setup_index_variable = [&spectre_eos](const std::string& name) {
@@ -195,20 +295,25 @@ void Tabulated3D<IsRelativistic>::initialize(const h5::EosTable& spectre_eos) {
   }
 
   initialize(electron_fraction, log_density, log_temperature, table_data,
-             energy_shift, enthalpy_minimum);
+             energy_shift, enthalpy_minimum, layout);
 }
 
 template <bool IsRelativistic>
 void Tabulated3D<IsRelativistic>::initialize(
     std::vector<double> electron_fraction, std::vector<double> log_density,
     std::vector<double> log_temperature, std::vector<double> table_data,
-    double energy_shift, double enthalpy_minimum) {
+    double energy_shift, double enthalpy_minimum,
+    const intrp::TableLayout layout) {
   energy_shift_ = energy_shift;
   enthalpy_minimum_ = enthalpy_minimum;
+  table_layout_ = layout;
   table_electron_fraction_ = std::move(electron_fraction);
   table_log_density_ = std::move(log_density);
   table_log_temperature_ = std::move(log_temperature);
   table_data_ = std::move(table_data);
+  mapped_table_filename_.clear();
+  mapped_table_ = nullptr;
+  mapped_table_data_ = {};
 
   initialize_interpolator();
 }
@@ -233,9 +338,306 @@ void Tabulated3D<IsRelativistic>::initialize_interpolator() {
   independent_data_view[2] =
       gsl::span<double const>{table_electron_fraction_.data(), num_x_points[2]};
 
-  interpolator_ = intrp::UniformMultiLinearSpanInterpolation<3, NumberOfVars>(
-      independent_data_view, {table_data_.data(), table_data_.size()},
-      num_x_points);
+  if (table_layout_ == intrp::TableLayout::CellInterleaved) {
+    cell_table_data_ = intrp::make_cell_interleaved_table<3, NumberOfVars>(
+        table_data(), num_x_points);
+    interpolator_ =
+        intrp::UniformMultiLinearSpanInterpolation<3, NumberOfVars>(
+            independent_data_view,
+            {cell_table_data_.data(), cell_table_data_.size()}, num_x_points,
+            table_layout_);
+  } else {
+    cell_table_data_.clear();
+    interpolator_ =
+        intrp::UniformMultiLinearSpanInterpolation<3, NumberOfVars>(
+            independent_data_view, table_data(), num_x_points);
+  }
+  initialize_inverse_table();
+}
+
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::initialize_inverse_table() {
+  inverse_log_temperature_.clear();
+  column_log_energy_bounds_.clear();
+  const size_t num_temperatures = table_log_temperature_.size();
+  if (num_temperatures < 2 or table_log_density_.size() < 2 or
+      table_electron_fraction_.size() < 2) {
+    // Inverting falls back to root finding
+    return;
+  }
+  const size_t num_columns =
+      table_log_density_.size() * table_electron_fraction_.size();
+  const auto data = table_data();
+  const double delta_log_temperature =
+      (table_log_temperature_.back() - table_log_temperature_.front()) /
+      static_cast<double>(num_temperatures - 1);
+  inverse_log_temperature_.resize(num_temperatures * num_columns);
+  column_log_energy_bounds_.resize(2 * num_columns);
+  for (size_t column = 0; column < num_columns; ++column) {
+    const auto log_energy = [&data, &column,
+                             &num_temperatures](const size_t i) {
+      return data[Epsilon + NumberOfVars * (i + num_temperatures * column)];
+    };
+    bool is_monotonic = true;
+    for (size_t i = 1; i < num_temperatures and is_monotonic; ++i) {
+      is_monotonic = log_energy(i) > log_energy(i - 1);
+    }
+    if (not is_monotonic) {
+      column_log_energy_bounds_[2 * column] =
+          std::numeric_limits<double>::signaling_NaN();
+      column_log_energy_bounds_[2 * column + 1] =
+          std::numeric_limits<double>::signaling_NaN();
+      continue;
+    }
+    const double min_log_energy = log_energy(0);
+    const double max_log_energy = log_energy(num_temperatures - 1);
+    column_log_energy_bounds_[2 * column] = min_log_energy;
+    column_log_energy_bounds_[2 * column + 1] = max_log_energy;
+    size_t i = 0;
+    for (size_t m = 0; m < num_temperatures; ++m) {
+      const double target =
+          min_log_energy + (max_log_energy - min_log_energy) *
+                               static_cast<double>(m) /
+                               static_cast<double>(num_temperatures - 1);
+      while (i + 2 < num_temperatures and log_energy(i + 1) < target) {
+        ++i;
+      }
+      inverse_log_temperature_[m + num_temperatures * column] =
+          table_log_temperature_[i] +
+          delta_log_temperature *
+              std::clamp((target - log_energy(i)) /
+                             (log_energy(i + 1) - log_energy(i)),
+                         0.0, 1.0);
+    }
+  }
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::log_temperature_from_log_energy(
+    const double log_specific_internal_energy,
+    const double log_rest_mass_density, const double electron_fraction) const {
+  const auto root_find = [this, &log_specific_internal_energy,
+                          &log_rest_mass_density, &electron_fraction]() {
+    const auto f = [this, &log_specific_internal_energy,
+                    &log_rest_mass_density,
+                    &electron_fraction](const double log_T) {
+      const auto weights = interpolator_.get_weights(
+          log_T, log_rest_mass_density, electron_fraction);
+      const auto interpolated_values =
+          interpolator_.template interpolate<Epsilon>(weights);
+
+      return log_specific_internal_energy - interpolated_values[0];
+    };
+
+    // Check bounds to avoid error in TOMS748 if bracket is zero
+    if (fabs(f(table_log_temperature_.front())) <= 1.0e-14) {
+      return table_log_temperature_.front();
+    }
+    if (fabs(f(upper_bound_tolerance_ * table_log_temperature_.back())) <=
+        1.0e-14) {
+      return table_log_temperature_.back();
+    }
+    return RootFinder::toms748(
+        f, table_log_temperature_.front(),
+        upper_bound_tolerance_ * table_log_temperature_.back(), 1.0e-14,
+        1.0e-15);
+  };
+  if (inverse_log_temperature_.empty()) {
+    return root_find();
+  }
+
+  // The cell of the uniform table coordinates `x` containing `value`, and the
+  // position of `value` within that cell
+  const auto find_cell = [](const std::vector<double>& x, const double value) {
+    const double delta =
+        (x.back() - x.front()) / static_cast<double>(x.size() - 1);
+    const double position = std::clamp((value - x.front()) / delta, 0.0,
+                                       static_cast<double>(x.size() - 1));
+    const size_t index = std::min(static_cast<size_t>(position), x.size() - 2);
+    return std::pair{index, position - static_cast<double>(index)};
+  };
+  const size_t num_temperatures = table_log_temperature_.size();
+  const auto [density_index, density_fraction] =
+      find_cell(table_log_density_, log_rest_mass_density);
+  const auto [electron_fraction_index, electron_fraction_fraction] =
+      find_cell(table_electron_fraction_, electron_fraction);
+
+  // Blend the initial guesses of the four surrounding columns
+  std::array<size_t, 4> columns{};
+  std::array<double, 4> weights{};
+  double log_temperature_guess = 0.0;
+  for (size_t corner = 0; corner < 4; ++corner) {
+    const size_t density_offset = corner % 2;
+    const size_t electron_fraction_offset = corner / 2;
+    const size_t column =
+        density_index + density_offset +
+        table_log_density_.size() *
+            (electron_fraction_index + electron_fraction_offset);
+    const double min_log_energy = column_log_energy_bounds_[2 * column];
+    const double max_log_energy = column_log_energy_bounds_[2 * column + 1];
+    if (std::isnan(min_log_energy)) {
+      return root_find();
+    }
+    gsl::at(columns, corner) = column;
+    gsl::at(weights, corner) =
+        (density_offset == 1 ? density_fraction : 1.0 - density_fraction) *
+        (electron_fraction_offset == 1 ? electron_fraction_fraction
+                                       : 1.0 - electron_fraction_fraction);
+    const double position =
+        std::clamp((log_specific_internal_energy - min_log_energy) /
+                       (max_log_energy - min_log_energy),
+                   0.0, 1.0) *
+        static_cast<double>(num_temperatures - 1);
+    const size_t index =
+        std::min(static_cast<size_t>(position), num_temperatures - 2);
+    const double fraction = position - static_cast<double>(index);
+    const double* const inverse_column =
+        &inverse_log_temperature_[num_temperatures * column];
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    log_temperature_guess +=
+        gsl::at(weights, corner) * ((1.0 - fraction) * inverse_column[index] +
+                                    fraction * inverse_column[index + 1]);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  // Polish the guess. The interpolated log eps is linear in log T within each
+  // temperature cell and increases monotonically, so step to the cell that
+  // contains the root and solve for it there.
+  const auto data = table_data();
+  const auto blended_log_energy = [&data, &columns, &weights,
+                                   &num_temperatures](const size_t i) {
+    double result = 0.0;
+    for (size_t corner = 0; corner < 4; ++corner) {
+      const size_t column = gsl::at(columns, corner);
+      result += gsl::at(weights, corner) *
+                data[Epsilon + NumberOfVars * (i + num_temperatures * column)];
+    }
+    return result;
+  };
+  size_t index = find_cell(table_log_temperature_, log_temperature_guess).first;
+  double lower_log_energy = blended_log_energy(index);
+  double upper_log_energy = blended_log_energy(index + 1);
+  for (size_t step = 0; step < num_temperatures; ++step) {
+    if (log_specific_internal_energy < lower_log_energy and index > 0) {
+      --index;
+      upper_log_energy = lower_log_energy;
+      lower_log_energy = blended_log_energy(index);
+    } else if (log_specific_internal_energy > upper_log_energy and
+               index + 2 < num_temperatures) {
+      ++index;
+      lower_log_energy = upper_log_energy;
+      upper_log_energy = blended_log_energy(index + 1);
+    } else {
+      break;
+    }
+  }
+  const double delta_log_temperature =
+      (table_log_temperature_.back() - table_log_temperature_.front()) /
+      static_cast<double>(num_temperatures - 1);
+  return table_log_temperature_[index] +
+         delta_log_temperature *
+             std::clamp((log_specific_internal_energy - lower_log_energy) /
+                            (upper_log_energy - lower_log_energy),
+                        0.0, 1.0);
+}
+
+template <bool IsRelativistic>
+gsl::span<const double> Tabulated3D<IsRelativistic>::table_data() const {
+  if (mapped_table_ != nullptr) {
+    return mapped_table_data_;
+  }
+  return {table_data_.data(), table_data_.size()};
+}
+
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::write_mapped_table(
+    const std::string& filename) const {
+  const MappedTableHeader header{mapped_table_magic,
+                                 mapped_table_version,
+                                 table_log_temperature_.size(),
+                                 table_log_density_.size(),
+                                 table_electron_fraction_.size(),
+                                 NumberOfVars,
+                                 energy_shift_,
+                                 enthalpy_minimum_};
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  if (not file) {
+    ERROR("Could not open the EOS table file '" << filename
+                                                << "' for writing.");
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  const auto write_aligned = [&file](const gsl::span<const double> data) {
+    const size_t number_of_bytes = data.size() * sizeof(double);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    file.write(reinterpret_cast<const char*>(data.data()),
+               static_cast<std::streamsize>(number_of_bytes));
+    const std::vector<char> padding(
+        aligned_size(number_of_bytes) - number_of_bytes, '\0');
+    file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+  };
+  write_aligned(
+      {table_log_temperature_.data(), table_log_temperature_.size()});
+  write_aligned({table_log_density_.data(), table_log_density_.size()});
+  write_aligned(
+      {table_electron_fraction_.data(), table_electron_fraction_.size()});
+  write_aligned(table_data());
+  if (not file) {
+    ERROR("Failed to write the EOS table file '" << filename << "'.");
+  }
+}
+
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::initialize_from_mapped_table(
+    const std::string& filename) {
+  mapped_table_ = std::make_shared<const detail::MappedTable3D>(filename);
+  mapped_table_filename_ = filename;
+  const char* const data = mapped_table_->data();
+  const size_t size = mapped_table_->size();
+  MappedTableHeader header{};
+  if (size >= sizeof(header)) {
+    std::memcpy(&header, data, sizeof(header));
+  }
+  if (size < sizeof(header) or header.magic != mapped_table_magic or
+      header.version != mapped_table_version or
+      header.number_of_vars != NumberOfVars) {
+    ERROR("The file '" << filename
+                       << "' is not an EOS table written by "
+                          "Tabulated3D::write_mapped_table.");
+  }
+  size_t offset = sizeof(header);
+  const auto next_array = [&data, &size, &offset,
+                           &filename](const size_t number_of_values) {
+    const size_t number_of_bytes = number_of_values * sizeof(double);
+    if (offset + number_of_bytes > size) {
+      ERROR("The EOS table file '" << filename << "' is truncated.");
+    }
+    const gsl::span<const double> result{
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        reinterpret_cast<const double*>(
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            data + offset),
+        number_of_values};
+    offset += aligned_size(number_of_bytes);
+    return result;
+  };
+  const auto log_temperature = next_array(header.number_of_temperatures);
+  const auto log_density = next_array(header.number_of_densities);
+  const auto electron_fraction =
+      next_array(header.number_of_electron_fractions);
+  table_log_temperature_.assign(log_temperature.begin(),
+                                log_temperature.end());
+  table_log_density_.assign(log_density.begin(), log_density.end());
+  table_electron_fraction_.assign(electron_fraction.begin(),
+                                  electron_fraction.end());
+  mapped_table_data_ =
+      next_array(header.number_of_temperatures * header.number_of_densities *
+                 header.number_of_electron_fractions * NumberOfVars);
+  table_data_.clear();
+  energy_shift_ = header.energy_shift;
+  enthalpy_minimum_ = header.enthalpy_minimum;
+
+  initialize_interpolator();
 }
 
 template <bool IsRelativistic>
@@ -255,7 +657,10 @@ bool Tabulated3D<IsRelativistic>::operator==(
   result &= (rhs.table_electron_fraction_ == this->table_electron_fraction_);
   result &= (rhs.table_log_density_ == this->table_log_density_);
   result &= (rhs.table_log_temperature_ == this->table_log_temperature_);
-  result &= (rhs.table_data_ == this->table_data_);
+  const auto rhs_table_data = rhs.table_data();
+  const auto table_data = this->table_data();
+  result &= std::equal(rhs_table_data.begin(), rhs_table_data.end(),
+                       table_data.begin(), table_data.end());
 
   return result;
 }
@@ -346,14 +751,13 @@ Tabulated3D<IsRelativistic>::pressure_from_density_and_temperature_impl(
     get(pressure) = std::exp(interpolated_state[0]);
 
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<Pressure>(weights);
-      get(pressure)[s] = std::exp(interpolated_state[0]);
-    }
+    std::array<gsl::span<double>, 1> interpolated_state{
+        {span_of(make_not_null(&pressure))}};
+    interpolator_.template interpolate<Pressure>(
+        make_not_null(&interpolated_state),
+        table_coordinates(log_temperature, log_rest_mass_density,
+                          converted_electron_fraction));
+    get(pressure) = exp(get(pressure));
   }
 
   return pressure;
@@ -368,9 +772,15 @@ void Tabulated3D<IsRelativistic>::pup(PUP::er& p) {
   p | table_log_density_;
   p | table_log_temperature_;
   p | table_data_;
+  p | table_layout_;
+  p | mapped_table_filename_;
 
   if (p.isUnpacking()) {
-    initialize_interpolator();
+    if (mapped_table_filename_.empty()) {
+      initialize_interpolator();
+    } else {
+      initialize_from_mapped_table(mapped_table_filename_);
+    }
   }
 }
 
@@ -421,77 +831,14 @@ Tabulated3D<IsRelativistic>::temperature_from_density_and_energy_impl(
   get(log_specific_internal_energy) = log(get(log_specific_internal_energy));
 
   if constexpr (std::is_same_v<DataType, double>) {
-    const auto& log_eps = get(log_specific_internal_energy);
-    const auto& log_rho = get(log_rest_mass_density);
-    const auto& ye = get(converted_electron_fraction);
-
-    // Root-finding appropriate between reference density and maximum density
-    // We can use x=0 and x=x_max as bounds
-    const auto f = [this, log_eps, log_rho, ye](const double log_T) {
-      const auto weights = interpolator_.get_weights(log_T, log_rho, ye);
-      const auto interpolated_values =
-          interpolator_.template interpolate<Epsilon>(weights);
-
-      return log_eps - interpolated_values[0];
-    };
-
-    bool need_root_finding = true;
-    double root_from_lambda = table_log_temperature_.front();
-    if (fabs(f(table_log_temperature_.front())) <= 1.0e-14) {
-      need_root_finding = false;
-    }
-
-    if (fabs(f(upper_bound_tolerance_ * table_log_temperature_.back())) <=
-        1.0e-14) {
-      root_from_lambda = table_log_temperature_.back();
-      need_root_finding = false;
-    }
-
-    if (need_root_finding) {
-      root_from_lambda = RootFinder::toms748(
-          f, table_log_temperature_.front(),
-          upper_bound_tolerance_ * table_log_temperature_.back(), 1.0e-14,
-          1.0e-15);
-    }
-
-    get(temperature) = exp(root_from_lambda);
-
+    get(temperature) = exp(log_temperature_from_log_energy(
+        get(log_specific_internal_energy), get(log_rest_mass_density),
+        get(converted_electron_fraction)));
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
     for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      const auto& log_eps = get(log_specific_internal_energy)[s];
-      const auto& log_rho = get(log_rest_mass_density)[s];
-      const auto& ye = get(converted_electron_fraction)[s];
-
-      // Root-finding appropriate between reference density and maximum density
-      // We can use x=0 and x=x_max as bounds
-      const auto f = [this, log_eps, log_rho, ye](const double log_T) {
-        const auto weights = interpolator_.get_weights(log_T, log_rho, ye);
-        const auto interpolated_values =
-            interpolator_.template interpolate<Epsilon>(weights);
-
-        return log_eps - interpolated_values[0];
-      };
-
-      // Check bounds to avoid error in TOMS748 if bracket is zero
-      bool need_root_finding = true;
-      double root_from_lambda = table_log_temperature_.front();
-      if (fabs(f(table_log_temperature_.front())) <= 1.0e-14) {
-        need_root_finding = false;
-      }
-
-      if (fabs(f(upper_bound_tolerance_ * table_log_temperature_.back())) <=
-          1.0e-14) {
-        root_from_lambda = table_log_temperature_.back();
-        need_root_finding = false;
-      }
-      if (need_root_finding) {
-        root_from_lambda = RootFinder::toms748(
-            f, table_log_temperature_.front(),
-            upper_bound_tolerance_ * table_log_temperature_.back(), 1.0e-14,
-            1.0e-15);
-      }
-
-      get(temperature)[s] = exp(root_from_lambda);
+      get(temperature)[s] = exp(log_temperature_from_log_energy(
+          get(log_specific_internal_energy)[s], get(log_rest_mass_density)[s],
+          get(converted_electron_fraction)[s]));
     }
   }
   return temperature;
@@ -525,15 +872,14 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
     get(specific_internal_energy) =
         std::exp(interpolated_state[0]) + energy_shift_;
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<Epsilon>(weights);
-      get(specific_internal_energy)[s] =
-          std::exp(interpolated_state[0]) + energy_shift_;
-    }
+    std::array<gsl::span<double>, 1> interpolated_state{
+        {span_of(make_not_null(&specific_internal_energy))}};
+    interpolator_.template interpolate<Epsilon>(
+        make_not_null(&interpolated_state),
+        table_coordinates(log_temperature, log_rest_mass_density,
+                          converted_electron_fraction));
+    get(specific_internal_energy) =
+        exp(get(specific_internal_energy)) + energy_shift_;
   }
 
   return specific_internal_energy;
@@ -567,19 +913,51 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
     get(cs2) = interpolated_state[0];
 
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<CsSquared>(weights);
-      get(cs2)[s] = interpolated_state[0];
-    }
+    std::array<gsl::span<double>, 1> interpolated_state{
+        {span_of(make_not_null(&cs2))}};
+    interpolator_.template interpolate<CsSquared>(
+        make_not_null(&interpolated_state),
+        table_coordinates(log_temperature, log_rest_mass_density,
+                          converted_electron_fraction));
   }
 
   return cs2;
 }
 
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::
+    pressure_energy_and_sound_speed_squared_from_density_and_temperature(
+        const gsl::not_null<Scalar<DataVector>*> pressure,
+        const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+        const gsl::not_null<Scalar<DataVector>*> sound_speed_squared,
+        const Scalar<DataVector>& rest_mass_density,
+        const Scalar<DataVector>& temperature,
+        const Scalar<DataVector>& electron_fraction) const {
+  Scalar<DataVector> converted_electron_fraction;
+  Scalar<DataVector> log_rest_mass_density;
+  Scalar<DataVector> log_temperature;
+
+  convert_to_table_quantities(
+      make_not_null(&converted_electron_fraction),
+      make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
+      electron_fraction, rest_mass_density, temperature);
+
+  const size_t number_of_points = get(rest_mass_density).size();
+  get(*pressure).destructive_resize(number_of_points);
+  get(*specific_internal_energy).destructive_resize(number_of_points);
+  get(*sound_speed_squared).destructive_resize(number_of_points);
+  std::array<gsl::span<double>, 3> interpolated_state{
+      {span_of(pressure), span_of(specific_internal_energy),
+       span_of(sound_speed_squared)}};
+  interpolator_.template interpolate<Pressure, Epsilon, CsSquared>(
+      make_not_null(&interpolated_state),
+      table_coordinates(log_temperature, log_rest_mass_density,
+                        converted_electron_fraction));
+  get(*pressure) = exp(get(*pressure));
+  get(*specific_internal_energy) =
+      exp(get(*specific_internal_energy)) + energy_shift_;
+}
+
 template <bool IsRelativistic>
 double Tabulated3D<IsRelativistic>::specific_internal_energy_lower_bound(
     const double rest_mass_density, const double electron_fraction) const {
@@ -634,24 +1012,32 @@ Tabulated3D<IsRelativistic>::
         std::vector<double> log_temperature,
         // NOLINTNEXTLINE(performance-unnecessary-value-param)
         std::vector<double> table_data, double energy_shift,
-        double enthalpy_minimum) {
+        double enthalpy_minimum, const intrp::TableLayout layout) {
   initialize(std::move(electron_fraction), std::move(log_density),
              std::move(log_temperature), std::move(table_data), energy_shift,
-             enthalpy_minimum);
+             enthalpy_minimum, layout);
 }
 
 template <bool IsRelativistic>
-Tabulated3D<IsRelativistic>::Tabulated3D(const h5::EosTable& spectre_eos) {
-  initialize(spectre_eos);
+Tabulated3D<IsRelativistic>::Tabulated3D(const h5::EosTable& spectre_eos,
+                                         const intrp::TableLayout layout) {
+  initialize(spectre_eos, layout);
 }
 
 template <bool IsRelativistic>
-Tabulated3D<IsRelativistic>::Tabulated3D(const std::string& filename,
-                                         const std::string& subfilename) {
+Tabulated3D<IsRelativistic>::Tabulated3D(
+    const std::string& filename,
+    const std::optional<std::string>& subfilename,
+    const intrp::TableLayout layout) {
+  if (not subfilename.has_value()) {
+    table_layout_ = layout;
+    initialize_from_mapped_table(filename);
+    return;
+  }
   h5::H5File<h5::AccessType::ReadOnly> eos_file{filename};
-  const auto& spectre_eos = eos_file.get<h5::EosTable>("/" + subfilename);
+  const auto& spectre_eos = eos_file.get<h5::EosTable>("/" + *subfilename);
 
-  initialize(spectre_eos);
+  initialize(spectre_eos, layout);
 }
 
 }  // namespace EquationsOfState
@@ -11,21 +11,30 @@
 #include <boost/preprocessor/repetition/repeat.hpp>
 #include <boost/preprocessor/tuple/to_list.hpp>
 #include <limits>
+#include <memory>
+#include <optional>
 #include <pup.h>
+#include <string>
+#include <vector>
 
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "IO/H5/EosTable.hpp"
 #include "IO/H5/File.hpp"
 #include "NumericalAlgorithms/Interpolation/MultiLinearSpanInterpolation.hpp"
+#include "Options/Auto.hpp"
 #include "Options/String.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
 class DataVector;
+namespace EquationsOfState::detail {
+class MappedTable3D;
+}  // namespace EquationsOfState::detail
 /// \endcond
 
 namespace EquationsOfState {
@@ -42,6 +51,34 @@ namespace EquationsOfState {
  * where \f$\rho\f$ is the rest mass density, \f$T\f$ is the
  * temperature, and \f$Y_e\f$ is the electron fraction.
  * The temperature is given in units of MeV.
+ *
+ * The `DataVector` overloads interpolate all points at once using
+ * `intrp::MultiLinearSpanInterpolation::interpolate` with SIMD batches. By
+ * default the table is stored point by point. Passing
+ * `intrp::TableLayout::CellInterleaved` when loading the table additionally
+ * stores the 8 corners of every cell contiguously, which avoids scattered
+ * reads for large tables at the cost of 8 times the memory.
+ *
+ * Reading a large table from HDF5 and converting it costs startup time and
+ * memory on every process. `write_mapped_table()` writes the converted table
+ * to a binary file that can be loaded instead by passing `std::nullopt` (or
+ * `None` in the input file) as the subfile name. That file is memory-mapped
+ * read-only, so the table is loaded lazily and all processes on a node
+ * interpolate from the same pages of the operating system's page cache. The
+ * file must be accessible at the same path from all processes, and is
+ * remapped when the EOS is deserialized. The file has
+ * native byte order and is not portable between architectures.
+ *
+ * Inverting for the temperature, e.g. in
+ * `temperature_from_density_and_energy()` during primitive recovery, uses an
+ * inverse table that is built when the table is loaded. For each density and
+ * electron fraction of the table it holds \f$\log T\f$ at uniformly spaced
+ * \f$\log\epsilon\f$, which gives an initial guess for the temperature.
+ * Since the interpolated \f$\log\epsilon\f$ is linear in \f$\log T\f$
+ * within each cell of the table, the guess is then polished by stepping to
+ * the cell that contains the root and solving for it exactly. This avoids a
+ * root find over table lookups unless \f$\epsilon\f$ is not monotonic in
+ * the temperature in one of the cells.
  */
 template <bool IsRelativistic>
 class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
@@ -61,9 +98,11 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
   };
 
   struct TableSubFilename {
-    using type = std::string;
+    using type = Options::Auto<std::string, Options::AutoLabel::None>;
     static constexpr Options::String help{
-        "Subfile name of the EOS table, e.g., 'dd2'."};
+        "Subfile name of the EOS table, e.g., 'dd2'. Set to 'None' if the "
+        "TableFilename is a table written by 'write_mapped_table', which is "
+        "memory-mapped."};
   };
 
   using options = tmpl::list<TableFilename, TableSubFilename>;
@@ -78,16 +117,23 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
   Tabulated3D& operator=(Tabulated3D&&) = default;
   ~Tabulated3D() override = default;
 
-  explicit Tabulated3D(const std::string& filename,
-                       const std::string& subfilename);
+  /// Load the table from the `subfilename` of the HDF5 file `filename`, or
+  /// map the file `filename` written by `write_mapped_table()` if
+  /// `subfilename` is `std::nullopt`.
+  explicit Tabulated3D(
+      const std::string& filename,
+      const std::optional<std::string>& subfilename,
+      intrp::TableLayout layout = intrp::TableLayout::PointInterleaved);
 
-  explicit Tabulated3D(std::vector<double> electron_fraction,
-                       std::vector<double> log_density,
-                       std::vector<double> log_temperature,
-                       std::vector<double> table_data, double energy_shift,
-                       double enthalpy_minimum);
+  explicit Tabulated3D(
+      std::vector<double> electron_fraction, std::vector<double> log_density,
+      std::vector<double> log_temperature, std::vector<double> table_data,
+      double energy_shift, double enthalpy_minimum,
+      intrp::TableLayout layout = intrp::TableLayout::PointInterleaved);
 
-  explicit Tabulated3D(const h5::EosTable& spectre_eos);
+  explicit Tabulated3D(
+      const h5::EosTable& spectre_eos,
+      intrp::TableLayout layout = intrp::TableLayout::PointInterleaved);
 
   EQUATION_OF_STATE_FORWARD_DECLARE_MEMBERS(Tabulated3D, 3)
 
@@ -116,14 +162,47 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
   std::unique_ptr<EquationOfState<IsRelativistic, 3>> get_clone()
       const override;
 
-  void initialize(std::vector<double> electron_fraction,
-                  std::vector<double> log_density,
-                  std::vector<double> log_temperature,
-                  std::vector<double> table_data, double energy_shift,
-                  double enthalpy_minimum);
+  void initialize(
+      std::vector<double> electron_fraction, std::vector<double> log_density,
+      std::vector<double> log_temperature, std::vector<double> table_data,
+      double energy_shift, double enthalpy_minimum,
+      intrp::TableLayout layout = intrp::TableLayout::PointInterleaved);
 
+  void initialize(
+      const h5::EosTable& spectre_eos,
+      intrp::TableLayout layout = intrp::TableLayout::PointInterleaved);
+
+  intrp::TableLayout table_layout() const { return table_layout_; }
+
+  /// Whether the table is memory-mapped from a file written by
+  /// `write_mapped_table()`
+  bool is_mapped() const { return mapped_table_ != nullptr; }
+
+  /*!
+   * \brief Write the table to a binary file that can be memory-mapped.
+   *
+   * The file holds a 64-byte header with the table extents, the energy shift
+   * and the enthalpy minimum, followed by the logarithmic temperatures, the
+   * logarithmic densities, the electron fractions and the table data in
+   * `intrp::TableLayout::PointInterleaved` layout. Each array starts at a
+   * multiple of 64 bytes.
+   */
+  void write_mapped_table(const std::string& filename) const;
 
-  void initialize(const h5::EosTable& spectre_eos);
+  /*!
+   * \brief Computes the pressure, specific internal energy and sound speed
+   * squared with a single interpolation of the three quantities.
+   *
+   * This is cheaper than calling the three functions separately because the
+   * table indices and weights are computed once per point.
+   */
+  void pressure_energy_and_sound_speed_squared_from_density_and_temperature(
+      gsl::not_null<Scalar<DataVector>*> pressure,
+      gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      gsl::not_null<Scalar<DataVector>*> sound_speed_squared,
+      const Scalar<DataVector>& rest_mass_density,
+      const Scalar<DataVector>& temperature,
+      const Scalar<DataVector>& electron_fraction) const;
 
   bool is_equal(const EquationOfState<IsRelativistic, 3>& rhs) const override;
 
@@ -228,6 +307,18 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
 
   void initialize_interpolator();
 
+  void initialize_from_mapped_table(const std::string& filename);
+
+  /// The table data, either from `table_data_` or the mapped file
+  gsl::span<const double> table_data() const;
+
+  void initialize_inverse_table();
+
+  /// Invert the table for the log temperature, see the class documentation
+  double log_temperature_from_log_energy(double log_specific_internal_energy,
+                                         double log_rest_mass_density,
+                                         double electron_fraction) const;
+
   /// Energy shift used to account for negative specific internal energies,
   /// which are only stored logarithmically
   double energy_shift_ = 0.;
@@ -247,6 +338,21 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
   std::vector<double> table_log_temperature_{};
   /// Tabulate data. Entries are stated in the enum
   std::vector<double> table_data_{};
+  intrp::TableLayout table_layout_{intrp::TableLayout::PointInterleaved};
+  /// The table in `intrp::TableLayout::CellInterleaved` layout. Only
+  /// allocated if that layout is used.
+  std::vector<double> cell_table_data_{};
+  /// The log temperature at uniformly spaced log specific internal energies in
+  /// each column of the table at fixed density and electron fraction
+  std::vector<double> inverse_log_temperature_{};
+  /// The minimum and maximum log specific internal energy of each column, or
+  /// NaN if it is not monotonic in the temperature
+  std::vector<double> column_log_energy_bounds_{};
+  /// The file the table is mapped from, or empty if the table is held in
+  /// `table_data_`
+  std::string mapped_table_filename_{};
+  std::shared_ptr<const detail::MappedTable3D> mapped_table_{};
+  gsl::span<const double> mapped_table_data_{};
 
   /// Tolerance on upper bound for root finding
   static constexpr double upper_bound_tolerance_ = 0.9999;
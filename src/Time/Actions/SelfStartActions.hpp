@@ -7,6 +7,7 @@
 #include <optional>
 #include <string>
 #include <tuple>
+#include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -257,7 +258,11 @@ struct Initialize {
 /// DataBox changes:
 /// - Adds: nothing
 /// - Removes: nothing
-/// - Modifies: nothing
+/// - Modifies:
+///   - variables_tag and primitive_variables_tag if the current order is
+///     complete
+///   - SelfStart::Tags::InitialValue of these tags, which are moved from after
+///     the last order
 template <typename ExitTag, typename System>
 struct CheckForCompletion {
   template <typename DbTags, typename... InboxTags, typename Metavariables,
@@ -273,14 +278,26 @@ struct CheckForCompletion {
         db::get<::Tags::Next<::Tags::TimeStepId>>(box).is_at_slab_boundary();
 
     if (done_with_order) {
-      tmpl::for_each<detail::vars_to_save<System>>([&box](auto tag) {
+      // After the last order the initial values are not needed anymore, so
+      // they are moved into place instead of copied. This avoids a copy of
+      // the whole evolved state, and its memory is released right away.
+      const bool last_order =
+          db::get<::Tags::Next<::Tags::TimeStepId>>(box).slab_number() == 0;
+      tmpl::for_each<detail::vars_to_save<System>>([&box,
+                                                    &last_order](auto tag) {
         using Tag = tmpl::type_from<decltype(tag)>;
-        db::mutate<Tag>(
-            [](const gsl::not_null<typename Tag::type*> value,
-               const std::tuple<typename Tag::type>& initial_value) {
-              *value = get<0>(initial_value);
+        db::mutate<Tag, Tags::InitialValue<Tag>>(
+            [&last_order](
+                const gsl::not_null<typename Tag::type*> value,
+                const gsl::not_null<std::tuple<typename Tag::type>*>
+                    initial_value) {
+              if (last_order) {
+                *value = std::move(get<0>(*initial_value));
+              } else {
+                *value = get<0>(*initial_value);
+              }
             },
-            make_not_null(&box), db::get<Tags::InitialValue<Tag>>(box));
+            make_not_null(&box));
       });
     }
 
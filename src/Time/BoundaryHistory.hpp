@@ -115,6 +115,8 @@ class BoundaryHistory {
       return decltype(std::declval<ConstSideAccess>()
                           .parent_data())::max_size();
     }
+    /// The number of steps that can be stored without allocating.
+    size_t capacity() const { return parent_data().capacity(); }
 
     const TimeStepId& operator[](const size_t n) const override {
       return (*this)[{n, 0}];
@@ -286,6 +288,16 @@ class BoundaryHistory {
   /// used in coupling calculations are mutated.
   void clear_coupling_cache();
 
+  /// Preallocate storage for \p local_steps local and \p remote_steps
+  /// remote steps, including the coupling cache.
+  ///
+  /// The storage only grows to the size required by default, so with
+  /// large step ratios across the boundary the coupling cache for each
+  /// new remote step is otherwise reallocated every time a local step
+  /// is added.  Reserving space for the number of steps expected from
+  /// the integration order and step ratio avoids these allocations.
+  void reserve(size_t local_steps, size_t remote_steps);
+
   void pup(PUP::er& p);
 
   template <bool IncludeData>
@@ -486,6 +498,19 @@ void BoundaryHistory<LocalData, RemoteData,
   }
 }
 
+template <typename LocalData, typename RemoteData, typename CouplingResult>
+void BoundaryHistory<LocalData, RemoteData, CouplingResult>::reserve(
+    const size_t local_steps, const size_t remote_steps) {
+  local_data_.reserve(local_steps);
+  remote_data_.reserve(remote_steps);
+  couplings_.reserve(remote_steps);
+  for (auto& remote_step : couplings_) {
+    for (auto& remote_substep : remote_step) {
+      remote_substep.reserve(local_steps);
+    }
+  }
+}
+
 template <typename LocalData, typename RemoteData, typename CouplingResult>
 void BoundaryHistory<LocalData, RemoteData, CouplingResult>::pup(PUP::er& p) {
   p | local_data_;
@@ -561,6 +586,7 @@ void BoundaryHistory<LocalData, RemoteData, CouplingResult>::insert_remote(
   } else {
     couplings_.back().emplace_back();
   }
+  couplings_.back().back().reserve(local_data_.capacity());
   for (const auto& local_step : local_data_) {
     couplings_.back().back().emplace_back(local_step.substeps.size());
   }
@@ -586,6 +612,7 @@ void BoundaryHistory<LocalData, RemoteData, CouplingResult>::
   remote_data_.push_front({integration_order, {}});
   remote_data_.front().substeps.push_back({id, std::move(data)});
   couplings_.emplace_front(1_st);
+  couplings_.front().back().reserve(local_data_.capacity());
   for (const auto& local_step : local_data_) {
     couplings_.front().back().emplace_back(local_step.substeps.size());
   }
@@ -72,6 +72,20 @@ struct StoreNewSlabSize {
 /// integration.  With local time-stepping this controls the interval
 /// between times when the sequences of steps on all elements are
 /// forced to align.
+///
+/// With a nonzero `DelayChange`, the elements continue evolving with
+/// the previously agreed slab size while the reduction for the
+/// delayed change is in flight, so the reduction latency is hidden
+/// behind `DelayChange` slabs of evolution.  This applies to choosers
+/// using local data, such as `StepChoosers::ErrorControl`, as well.
+/// Slabs cannot be rejected, so a step chooser's request to reject the
+/// current step is ignored and the slabs taken before the change
+/// arrives are not rolled back.  When using error control, the delay
+/// should therefore be small compared to the number of slabs over
+/// which the error is expected to change significantly, and the
+/// `SafetyFactor` and `MaxFactor` options of the chooser can be used
+/// to reduce the chance of exceeding the tolerance before the change
+/// takes effect.
 class ChangeSlabSize : public Event {
   using ReductionData = Parallel::ReductionData<
       Parallel::ReductionDatum<int64_t, funcl::AssertEqual<>>,
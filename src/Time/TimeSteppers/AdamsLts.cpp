@@ -4,10 +4,16 @@
 #include "Time/TimeSteppers/AdamsLts.hpp"
 
 #include <algorithm>
+#include <boost/container/small_vector.hpp>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <optional>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/MathWrapper.hpp"
 #include "NumericalAlgorithms/Interpolation/LagrangePolynomial.hpp"
@@ -22,6 +28,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Rational.hpp"
 
 namespace TimeSteppers::adams_lts {
 Time exact_substep_time(const TimeStepId& id) {
@@ -301,16 +308,13 @@ LtsCoefficients lts_coefficients_for_gts(
   }
   return lts_coefficients;
 }
-}  // namespace
 
 template <typename TimeType>
-LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
-                                 const ConstBoundaryHistoryTimes& remote_times,
-                                 const Time& start_time,
-                                 const TimeType& end_time,
-                                 const AdamsScheme& local_scheme,
-                                 const AdamsScheme& remote_scheme,
-                                 const AdamsScheme& small_step_scheme) {
+LtsCoefficients lts_coefficients_impl(
+    const ConstBoundaryHistoryTimes& local_times,
+    const ConstBoundaryHistoryTimes& remote_times, const Time& start_time,
+    const TimeType& end_time, const AdamsScheme& local_scheme,
+    const AdamsScheme& remote_scheme, const AdamsScheme& small_step_scheme) {
   if (start_time == end_time) {
     return {};
   }
@@ -422,6 +426,192 @@ LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
   return step_coefficients;
 }
 
+// The coefficients for a step only depend on the times of the
+// history entries relative to the step, and with step sizes that are
+// power-of-two fractions of the slab only a few distinct patterns of
+// these times occur.  The coefficients are therefore cached on the
+// pattern, with each time stored as its offset from the start of the
+// step in units of the step size.
+constexpr size_t pattern_static_size = 2 * adams_coefficients::maximum_order;
+using PatternTimes =
+    boost::container::small_vector<Rational, pattern_static_size>;
+using PatternSubsteps =
+    boost::container::small_vector<size_t, pattern_static_size>;
+using PatternIds =
+    boost::container::small_vector<TimeStepId, pattern_static_size>;
+
+struct CoefficientPattern {
+  bool time_runs_forward{};
+  AdamsScheme local_scheme{};
+  AdamsScheme remote_scheme{};
+  AdamsScheme small_step_scheme{};
+  // The times of all substeps of all steps, and the number of
+  // substeps of each step.
+  PatternTimes local_times{};
+  PatternTimes remote_times{};
+  PatternSubsteps local_substeps{};
+  PatternSubsteps remote_substeps{};
+};
+
+bool operator==(const CoefficientPattern& a, const CoefficientPattern& b) {
+  return a.time_runs_forward == b.time_runs_forward and
+         a.local_scheme == b.local_scheme and
+         a.remote_scheme == b.remote_scheme and
+         a.small_step_scheme == b.small_step_scheme and
+         a.local_substeps == b.local_substeps and
+         a.remote_substeps == b.remote_substeps and
+         a.local_times == b.local_times and a.remote_times == b.remote_times;
+}
+
+struct CachedCoefficients {
+  CoefficientPattern pattern;
+  // Indices into the flattened local and remote substeps, and the
+  // coefficient divided by the step size.
+  boost::container::small_vector<std::tuple<size_t, size_t, double>,
+                                 lts_coefficients_static_size>
+      coefficients;
+};
+
+// Offset of `time` from `start_time` in units of `step`.  Times in
+// other slabs than the step are rounded to a dyadic fraction, so they
+// only match when the slabs have the same size up to roundoff.
+std::optional<Rational> pattern_time(const Time& time, const Time& start_time,
+                                     const TimeDelta& step) {
+  if (time.slab() == start_time.slab() and step.slab() == start_time.slab()) {
+    return (time.fraction() - start_time.fraction()) / step.fraction();
+  }
+  constexpr std::int32_t denominator = 1 << 16;
+  constexpr double max_offset = 1 << 14;
+  const double offset = (time.value() - start_time.value()) / step.value();
+  // Written so NaN offsets are rejected
+  if (not(std::abs(offset) < max_offset)) {
+    return std::nullopt;
+  }
+  const double rounded = std::round(offset * denominator);
+  if (std::abs(offset * denominator - rounded) >
+      1.0e-12 * denominator * std::max(1.0, std::abs(offset))) {
+    return std::nullopt;
+  }
+  return Rational(static_cast<std::int32_t>(rounded), denominator);
+}
+
+// Append the pattern of `times` to `pattern_times` and
+// `pattern_substeps` and their ids to `ids`.  Returns false if the
+// times cannot be represented.
+bool add_pattern(const gsl::not_null<PatternTimes*> pattern_times,
+                 const gsl::not_null<PatternSubsteps*> pattern_substeps,
+                 const gsl::not_null<PatternIds*> ids,
+                 const ConstBoundaryHistoryTimes& times, const Time& start_time,
+                 const TimeDelta& step) {
+  for (size_t step_index = 0; step_index < times.size(); ++step_index) {
+    const size_t number_of_substeps = times.number_of_substeps(step_index);
+    pattern_substeps->push_back(number_of_substeps);
+    for (size_t substep = 0; substep < number_of_substeps; ++substep) {
+      const TimeStepId& id = times[{step_index, substep}];
+      const auto offset =
+          pattern_time(exact_substep_time(id), start_time, step);
+      if (not offset.has_value()) {
+        return false;
+      }
+      pattern_times->push_back(*offset);
+      ids->push_back(id);
+    }
+  }
+  return true;
+}
+
+size_t pattern_index(const PatternIds& ids, const TimeStepId& id) {
+  const auto entry = alg::find(ids, id);
+  ASSERT(entry != ids.end(), "Coefficient for unknown id " << id);
+  return static_cast<size_t>(entry - ids.begin());
+}
+
+LtsCoefficients cached_lts_coefficients(
+    const ConstBoundaryHistoryTimes& local_times,
+    const ConstBoundaryHistoryTimes& remote_times, const Time& start_time,
+    const Time& end_time, const AdamsScheme& local_scheme,
+    const AdamsScheme& remote_scheme, const AdamsScheme& small_step_scheme) {
+  const TimeDelta step = end_time - start_time;
+  CoefficientPattern pattern{local_times.front().time_runs_forward(),
+                             local_scheme, remote_scheme, small_step_scheme};
+  PatternIds local_ids{};
+  PatternIds remote_ids{};
+  if (not(add_pattern(make_not_null(&pattern.local_times),
+                      make_not_null(&pattern.local_substeps),
+                      make_not_null(&local_ids), local_times, start_time,
+                      step) and
+          add_pattern(make_not_null(&pattern.remote_times),
+                      make_not_null(&pattern.remote_substeps),
+                      make_not_null(&remote_ids), remote_times, start_time,
+                      step))) {
+    return lts_coefficients_impl(local_times, remote_times, start_time,
+                                 end_time, local_scheme, remote_scheme,
+                                 small_step_scheme);
+  }
+
+  // The cache is per thread so that elements sharing it never have to
+  // wait for each other.  It is small enough to search linearly, and
+  // entries are replaced in insertion order once it is full.
+  constexpr size_t cache_size = 64;
+  thread_local std::vector<CachedCoefficients> cache{};
+  thread_local size_t next_replaced_entry = 0;
+
+  auto cached = alg::find_if(cache, [&pattern](const CachedCoefficients& c) {
+    return c.pattern == pattern;
+  });
+  if (cached == cache.end()) {
+    const LtsCoefficients coefficients = lts_coefficients_impl(
+        local_times, remote_times, start_time, end_time, local_scheme,
+        remote_scheme, small_step_scheme);
+    CachedCoefficients new_entry{std::move(pattern), {}};
+    for (const auto& [local_id, remote_id, coefficient] : coefficients) {
+      new_entry.coefficients.emplace_back(pattern_index(local_ids, local_id),
+                                          pattern_index(remote_ids, remote_id),
+                                          coefficient / step.value());
+    }
+    if (cache.size() < cache_size) {
+      cache.push_back(std::move(new_entry));
+    } else {
+      cache[next_replaced_entry] = std::move(new_entry);
+      next_replaced_entry = (next_replaced_entry + 1) % cache_size;
+    }
+    return coefficients;
+  }
+
+  LtsCoefficients coefficients{};
+  for (const auto& [local_index, remote_index, coefficient] :
+       cached->coefficients) {
+    coefficients.emplace_back(local_ids[local_index], remote_ids[remote_index],
+                              coefficient * step.value());
+  }
+  // Histories with the same pattern of times can still order their
+  // ids differently during self-start.
+  if (not std::is_sorted(coefficients.begin(), coefficients.end())) {
+    alg::sort(coefficients);
+  }
+  return coefficients;
+}
+}  // namespace
+
+template <typename TimeType>
+LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
+                                 const ConstBoundaryHistoryTimes& remote_times,
+                                 const Time& start_time,
+                                 const TimeType& end_time,
+                                 const AdamsScheme& local_scheme,
+                                 const AdamsScheme& remote_scheme,
+                                 const AdamsScheme& small_step_scheme) {
+  if constexpr (std::is_same_v<TimeType, Time>) {
+    if (start_time != end_time) {
+      return cached_lts_coefficients(local_times, remote_times, start_time,
+                                     end_time, local_scheme, remote_scheme,
+                                     small_step_scheme);
+    }
+  }
+  return lts_coefficients_impl(local_times, remote_times, start_time, end_time,
+                               local_scheme, remote_scheme, small_step_scheme);
+}
+
 #define MATH_WRAPPER_TYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(_, data)                          \
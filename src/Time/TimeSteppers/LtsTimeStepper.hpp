@@ -38,6 +38,17 @@ class TimeStepId;
 /// private section of the class body, and
 /// LTS_TIME_STEPPER_DEFINE_OVERLOADS(derived_class), which must be
 /// placed in the cpp file.
+///
+/// \note Only multistep methods (currently `TimeSteppers::AdamsBashforth`
+/// and `TimeSteppers::AdamsMoultonPc`) implement this interface. The boundary
+/// coupling is formed from the `TimeSteppers::BoundaryHistory` by evaluating
+/// the coupling on pairs of local and remote records at past times, which
+/// for a multistep method have fixed, known positions. The stages of a
+/// Runge-Kutta method lie at intermediate times that differ between elements
+/// with different step sizes, so a multirate Runge-Kutta method would need
+/// the remote data interpolated to the local stage times before evaluating
+/// the coupling. For shock-capturing schemes with local time stepping use
+/// `TimeSteppers::AdamsMoultonPc<true>`, whose dense output is monotonic.
 class LtsTimeStepper : public virtual TimeStepper {
  public:
   static constexpr bool local_time_stepping = true;
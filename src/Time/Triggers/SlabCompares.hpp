@@ -57,6 +57,8 @@ class SlabCompares : public Trigger {
                        slab_number_);
   }
 
+  bool is_element_independent() const override { return true; }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) {
     p | comparator_;
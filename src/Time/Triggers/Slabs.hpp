@@ -50,6 +50,8 @@ class Slabs : public Trigger {
     return slabs_->times_near(unsigned_slab)[1] == unsigned_slab;
   }
 
+  bool is_element_independent() const override { return true; }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) override { p | slabs_; }
 
@@ -52,6 +52,8 @@ class TimeCompares : public Trigger {
 
   bool operator()(const double& time) const { return comparator_(time, time_); }
 
+  bool is_element_independent() const override { return true; }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) {
     p | comparator_;
@@ -50,6 +50,8 @@ class Times : public Trigger {
     return times_->times_near(now)[1] == std::optional(now);
   }
 
+  bool is_element_independent() const override { return true; }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) override { p | times_; }
 
@@ -3,6 +3,11 @@
 
 #include "Utilities/Blas.hpp"
 
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
 extern "C" {
 #ifdef DISABLE_OPENBLAS_MULTITHREADING
 // Declaring this ourselves instead of including cblas.h because our `Blas`
@@ -12,6 +17,93 @@ void openblas_set_num_threads(int num_threads);
 #endif  // DISABLE_OPENBLAS_MULTITHREADING
 }  // extern "C"
 
+namespace blas_detail {
+namespace {
+template <typename T>
+T conjugate_if(const T value, const bool conjugate) {
+  if constexpr (std::is_same_v<T, double>) {
+    (void)conjugate;
+    return value;
+  } else {
+    return conjugate ? std::conj(value) : value;
+  }
+}
+
+bool is_transposed(const char trans) { return trans != 'N' and trans != 'n'; }
+bool is_conjugated(const char trans) { return trans == 'C' or trans == 'c'; }
+
+// Computes the result one column at a time. With an untransposed A the
+// innermost loop adds multiples of the contiguous columns of A, otherwise it
+// is a dot product of the contiguous rows of op(A) with the column of op(B).
+template <typename T>
+void small_gemm_impl(const char transa, const char transb, const size_t m,
+                     const size_t n, const size_t k, const T alpha,
+                     const T* const a, const size_t lda, const T* const b,
+                     const size_t ldb, const T beta, T* const c,
+                     const size_t ldc) {
+  const bool transpose_a = is_transposed(transa);
+  const bool conjugate_a = is_conjugated(transa);
+  const bool transpose_b = is_transposed(transb);
+  const bool conjugate_b = is_conjugated(transb);
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  const auto op_b = [&](const size_t l, const size_t j) {
+    return conjugate_if(transpose_b ? b[j + ldb * l] : b[l + ldb * j],
+                        conjugate_b);
+  };
+  for (size_t j = 0; j < n; ++j) {
+    T* const c_column = c + ldc * j;
+    // As in BLAS, C is not read if beta is zero
+    if (beta == T{0.0}) {
+      std::fill(c_column, c_column + m, T{0.0});
+    } else if (beta != T{1.0}) {
+      for (size_t i = 0; i < m; ++i) {
+        c_column[i] *= beta;
+      }
+    }
+    if (not transpose_a) {
+      for (size_t l = 0; l < k; ++l) {
+        const T factor = alpha * op_b(l, j);
+        const T* const a_column = a + lda * l;
+        for (size_t i = 0; i < m; ++i) {
+          c_column[i] += factor * a_column[i];
+        }
+      }
+    } else {
+      for (size_t i = 0; i < m; ++i) {
+        const T* const a_row = a + lda * i;
+        T sum{0.0};
+        for (size_t l = 0; l < k; ++l) {
+          sum += conjugate_if(a_row[l], conjugate_a) * op_b(l, j);
+        }
+        c_column[i] += alpha * sum;
+      }
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+}  // namespace
+
+void small_gemm(const char TRANSA, const char TRANSB, const size_t M,
+                const size_t N, const size_t K, const double ALPHA,
+                const double* const A, const size_t LDA, const double* const B,
+                const size_t LDB, const double BETA, double* const C,
+                const size_t LDC) {
+  small_gemm_impl(TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB, BETA, C,
+                  LDC);
+}
+
+void small_gemm(const char TRANSA, const char TRANSB, const size_t M,
+                const size_t N, const size_t K,
+                const std::complex<double> ALPHA,
+                const std::complex<double>* const A, const size_t LDA,
+                const std::complex<double>* const B, const size_t LDB,
+                const std::complex<double> BETA,
+                std::complex<double>* const C, const size_t LDC) {
+  small_gemm_impl(TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB, BETA, C,
+                  LDC);
+}
+}  // namespace blas_detail
+
 void disable_openblas_multithreading() {
 #ifdef DISABLE_OPENBLAS_MULTITHREADING
   openblas_set_num_threads(1);
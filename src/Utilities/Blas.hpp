@@ -10,6 +10,7 @@
 #pragma once
 
 #include <complex>
+#include <cstddef>
 
 #ifndef SPECTRE_DEBUG
 #include <libxsmm.h>
@@ -43,6 +44,25 @@ void dgemv_(const char& TRANS, const int& M, const int& N, const double& ALPHA,
             const double* A, const int& LDA, const double* X, const int& INCX,
             const double& BETA, double* Y, const int& INCY, size_t);
 }  // extern "C"
+
+/// The number of multiply-adds `M * N * K` up to which `dgemm_` and `zgemm_`
+/// call `small_gemm` instead of BLAS, whose call overhead dominates for the
+/// small matrices of DG operators.
+constexpr size_t small_gemm_max_size = 32 * 32 * 32;
+
+/// @{
+/// Matrix-matrix multiplication with the arguments and semantics of BLAS
+/// `dgemm` and `zgemm`, implemented with plain loops that the compiler
+/// vectorizes. Only intended for small matrices, see `small_gemm_max_size`.
+void small_gemm(char TRANSA, char TRANSB, size_t M, size_t N, size_t K,
+                double ALPHA, const double* A, size_t LDA, const double* B,
+                size_t LDB, double BETA, double* C, size_t LDC);
+void small_gemm(char TRANSA, char TRANSB, size_t M, size_t N, size_t K,
+                std::complex<double> ALPHA, const std::complex<double>* A,
+                size_t LDA, const std::complex<double>* B, size_t LDB,
+                std::complex<double> BETA, std::complex<double>* C,
+                size_t LDC);
+/// @}
 }  // namespace blas_detail
 
 /*!
@@ -123,7 +143,10 @@ inline std::complex<double> zdotc_(const size_t& N,
  * (transpose of \f$A\f$).
  *
  * LIBXSMM, which is much faster than BLAS for small matrices, can be called
- * instead of BLAS by passing the template parameter `true`.
+ * instead of BLAS by passing the template parameter `true`. Otherwise products
+ * with at most `blas_detail::small_gemm_max_size` multiply-adds, such as the
+ * application of a 5x5 DG operator to 25 columns, are computed by
+ * `blas_detail::small_gemm` to avoid the overhead of calling BLAS.
  *
  * \param TRANSA either 'N', 'T' or 'C', transposition of matrix A
  * \param TRANSB either 'N', 'T' or 'C', transposition of matrix B
@@ -154,6 +177,11 @@ inline void dgemm_(const char& TRANSA, const char& TRANSB, const size_t& M,
              'C' == TRANSB or 'c' == TRANSB,
          "TRANSB must be upper or lower case N, T, or C. See the BLAS "
          "documentation for help.");
+  if (M * N * K <= blas_detail::small_gemm_max_size) {
+    blas_detail::small_gemm(TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB,
+                            BETA, C, LDC);
+    return;
+  }
   blas_detail::dgemm_(
       TRANSA, TRANSB, gsl::narrow_cast<int>(M), gsl::narrow_cast<int>(N),
       gsl::narrow_cast<int>(K), ALPHA, A, gsl::narrow_cast<int>(LDA), B,
@@ -175,6 +203,11 @@ inline void zgemm_(const char& TRANSA, const char& TRANSB, const size_t& M,
              'C' == TRANSB or 'c' == TRANSB,
          "TRANSB must be upper or lower case N, T, or C. See the BLAS "
          "documentation for help.");
+  if (M * N * K <= blas_detail::small_gemm_max_size) {
+    blas_detail::small_gemm(TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB,
+                            BETA, C, LDC);
+    return;
+  }
   blas_detail::zgemm_(
       TRANSA, TRANSB, gsl::narrow_cast<int>(M), gsl::narrow_cast<int>(N),
       gsl::narrow_cast<int>(K), ALPHA, A, gsl::narrow_cast<int>(LDA), B,
@@ -3,8 +3,11 @@
 
 #include "Utilities/Rational.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <boost/functional/hash.hpp>
 #include <boost/integer/common_factor_rt.hpp>
+#include <cstdint>
 #include <ostream>
 #include <pup.h>
 #include <tuple>
@@ -30,12 +33,43 @@ std::tuple<std::int32_t, std::int32_t> reduce(IntType numerator,
          "Rational overflow: " << numerator << "/" << denominator);
   return std::make_tuple(numerator, denominator);
 }
+
+// Slab fractions almost always have power-of-two denominators since step
+// sizes are chosen by halving and doubling. Sums and products of such
+// fractions again have power-of-two denominators and can be reduced by a
+// shift instead of a gcd.
+bool is_power_of_two(const std::int64_t positive_n) {
+  return (positive_n & (positive_n - 1)) == 0;
+}
+
+std::tuple<std::int32_t, std::int32_t> reduce_power_of_two(
+    std::int64_t numerator, std::int64_t denominator) {
+  if (numerator == 0) {
+    return {0, 1};
+  }
+  // The trailing zeros of a negative number in two's complement are the same
+  // as those of its absolute value.
+  const int shift =
+      std::min(std::countr_zero(static_cast<std::uint64_t>(numerator)),
+               std::countr_zero(static_cast<std::uint64_t>(denominator)));
+  numerator >>= shift;
+  denominator >>= shift;
+  ASSERT(static_cast<std::int32_t>(numerator) == numerator and
+         static_cast<std::int32_t>(denominator) == denominator,
+         "Rational overflow: " << numerator << "/" << denominator);
+  return std::make_tuple(numerator, denominator);
+}
 }  // namespace
 
 Rational::Rational(const std::int32_t numerator,
                    const std::int32_t denominator) {
   ASSERT(denominator != 0, "Division by zero");
-  std::tie(numerator_, denominator_) = reduce(numerator, denominator);
+  if (denominator > 0 and is_power_of_two(denominator)) {
+    std::tie(numerator_, denominator_) =
+        reduce_power_of_two(numerator, denominator);
+  } else {
+    std::tie(numerator_, denominator_) = reduce(numerator, denominator);
+  }
 }
 
 double Rational::value() const {
@@ -56,6 +90,23 @@ Rational Rational::inverse() const {
 }
 
 Rational& Rational::operator+=(const Rational& other) {
+  // Denominators are positive in reduced form
+  if (is_power_of_two(denominator_) and is_power_of_two(other.denominator_)) {
+    // The larger denominator is a multiple of the smaller one, so it is the
+    // common denominator.
+    if (denominator_ >= other.denominator_) {
+      std::tie(numerator_, denominator_) = reduce_power_of_two(
+          to64(numerator_) +
+              to64(other.numerator_) * (denominator_ / other.denominator_),
+          denominator_);
+    } else {
+      std::tie(numerator_, denominator_) = reduce_power_of_two(
+          to64(numerator_) * (other.denominator_ / denominator_) +
+              to64(other.numerator_),
+          other.denominator_);
+    }
+    return *this;
+  }
   std::tie(numerator_, denominator_) =
       reduce(to64(numerator_) * to64(other.denominator_) +
              to64(denominator_) * to64(other.numerator_),
@@ -66,6 +117,12 @@ Rational& Rational::operator-=(const Rational& other) {
   return *this += -other;
 }
 Rational& Rational::operator*=(const Rational& other) {
+  if (is_power_of_two(denominator_) and is_power_of_two(other.denominator_)) {
+    std::tie(numerator_, denominator_) =
+        reduce_power_of_two(to64(numerator_) * to64(other.numerator()),
+                            to64(denominator_) * to64(other.denominator()));
+    return *this;
+  }
   std::tie(numerator_, denominator_) =
       reduce(to64(numerator_) * to64(other.numerator()),
              to64(denominator_) * to64(other.denominator()));
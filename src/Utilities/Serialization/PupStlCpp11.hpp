@@ -44,11 +44,13 @@ template <typename K, typename T, typename C>
 void pup_override(PUP::er& p, std::map<K, T, C>& m) {
   if (p.isUnpacking()) {
     size_t size;
-    std::pair<K, T> pair;
     p | size;
     for (size_t i = 0; i < size; ++i) {
+      std::pair<K, T> pair;
       p | pair;
-      m.insert(pair);
+      // The entries were packed in order, so each one goes at the end. Moving
+      // avoids copying the (possibly large) mapped values.
+      m.emplace_hint(m.end(), std::move(pair));
     }
   } else {
     size_t size = m.size();
@@ -47,6 +47,11 @@ struct CacheEnumeration {
 /// giving the enumeration type and an explicit set of every enum member to be
 /// cached.
 ///
+/// Each object is generated the first time it is accessed, so only the
+/// objects that are used take time to compute and memory to store. The
+/// generation is threadsafe: an object is generated exactly once and threads
+/// accessing it concurrently wait for it.
+///
 /// \example
 /// A cache with only numeric indices:
 /// \snippet Test_StaticCache.cpp static_cache
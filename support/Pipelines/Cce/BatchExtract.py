@@ -0,0 +1,300 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import logging
+import os
+import re
+import subprocess
+from concurrent.futures import ThreadPoolExecutor
+from dataclasses import dataclass
+from pathlib import Path
+from typing import List, Optional, Sequence, Union
+
+import click
+import yaml
+
+from spectre.support.Machines import this_machine
+from spectre.support.Schedule import _resolve_executable, _write_or_overwrite
+
+logger = logging.getLogger(__name__)
+
+
+@dataclass(frozen=True)
+class Extraction:
+    """A single CCE run in a batch
+
+    Attributes:
+      worldtube_file: The H5 file with the worldtube boundary data.
+      extraction_radius: The radius of the worldtube. 'None' if it is encoded
+        in the 'worldtube_file' name as 'NameOfFileRXXXX.h5'.
+      run_dir: The directory in which the executable runs.
+    """
+
+    worldtube_file: Path
+    extraction_radius: Optional[float]
+    run_dir: Path
+
+
+def _radius_from_filename(worldtube_file: Path) -> Optional[float]:
+    match = re.search(r"R(\d+)\.h5$", worldtube_file.name)
+    return float(match.group(1)) if match else None
+
+
+def batch_extractions(
+    worldtube_files: Sequence[Union[str, Path]],
+    output_dir: Union[str, Path],
+    extraction_radii: Optional[Sequence[float]] = None,
+) -> List[Extraction]:
+    """List the CCE runs of a batch
+
+    Each worldtube file is extracted at each of the 'extraction_radii', or at
+    the radius encoded in its file name if no radii are given. Every run gets
+    its own directory in the 'output_dir', so their output files don't collide.
+    """
+    output_dir = Path(output_dir)
+    extractions = []
+    for worldtube_file in worldtube_files:
+        worldtube_file = Path(worldtube_file).resolve()
+        radii = extraction_radii or [None]
+        if (
+            not extraction_radii
+            and _radius_from_filename(worldtube_file) is None
+        ):
+            raise ValueError(
+                f"The worldtube file '{worldtube_file}' does not encode the"
+                " extraction radius in its name as 'NameOfFileRXXXX.h5'."
+                " Specify the extraction radii explicitly."
+            )
+        for radius in radii:
+            run_name = worldtube_file.stem
+            if radius is not None:
+                run_name += f"_R{radius:g}"
+            extractions.append(
+                Extraction(
+                    worldtube_file=worldtube_file,
+                    extraction_radius=radius,
+                    run_dir=output_dir / run_name,
+                )
+            )
+    run_dirs = [extraction.run_dir for extraction in extractions]
+    if len(set(run_dirs)) != len(run_dirs):
+        raise ValueError(
+            "Some worldtube files have the same name, so their runs would "
+            "share a directory. Rename the files or run separate batches."
+        )
+    return extractions
+
+
+def configure_input_file(
+    input_file_template: Union[str, Path], extraction: Extraction
+) -> str:
+    """Set the worldtube file and extraction radius in a CCE input file
+
+    Returns the text of the input file for the 'extraction'. All other
+    options are taken from the 'input_file_template'.
+    """
+    metadata, input_file = yaml.safe_load_all(
+        Path(input_file_template).read_text()
+    )
+    cce_options = input_file["Cce"]
+    cce_options["BoundaryDataFilename"] = str(extraction.worldtube_file)
+    cce_options["ExtractionRadius"] = (
+        "Auto"
+        if extraction.extraction_radius is None
+        else extraction.extraction_radius
+    )
+    return yaml.safe_dump_all([metadata, input_file], sort_keys=False)
+
+
+def _run_extraction(
+    executable: Path, input_file_name: str, extraction: Extraction
+) -> int:
+    machine = this_machine(raise_exception=False)
+    run_command = (machine.launch_command if machine else []) + [
+        str(executable),
+        "--input-file",
+        str(extraction.run_dir / input_file_name),
+        "+p",
+        "1",
+    ]
+    logger.debug(f"Run command: {run_command}")
+    with open(extraction.run_dir / "spectre.out", "w") as out_file:
+        process = subprocess.run(
+            run_command,
+            cwd=extraction.run_dir,
+            stdout=out_file,
+            stderr=subprocess.STDOUT,
+        )
+    if process.returncode == 0:
+        logger.info(f"Finished CCE run in '{extraction.run_dir}'.")
+    else:
+        logger.error(
+            f"CCE run in '{extraction.run_dir}' failed with exit code "
+            f"{process.returncode}. See 'spectre.out' in that directory."
+        )
+    return process.returncode
+
+
+def batch_extract(
+    input_file_template: Union[str, Path],
+    worldtube_files: Sequence[Union[str, Path]],
+    output_dir: Union[str, Path],
+    extraction_radii: Optional[Sequence[float]] = None,
+    num_procs: Optional[int] = None,
+    executable: Optional[Union[str, Path]] = None,
+    force: bool = False,
+    submit: bool = True,
+) -> List[Extraction]:
+    """Run CCE on several worldtubes concurrently on this node
+
+    Each CCE evolution is a single singleton and runs on one core, so a batch
+    of waveforms is reprocessed by running independent extractions side by
+    side, one per core. Every worldtube file is extracted at each of the
+    'extraction_radii', or at the radius encoded in its name if no radii are
+    given. The runs are configured from the 'input_file_template' in
+    subdirectories of the 'output_dir', named after the worldtube file and
+    radius.
+
+    Arguments:
+      input_file_template: CCE input file. Its 'BoundaryDataFilename' and
+        'ExtractionRadius' are replaced for every run.
+      worldtube_files: H5 files with CCE worldtube boundary data.
+      output_dir: Directory in which the runs are configured.
+      extraction_radii: Radii of the worldtubes. Use when the radius is not
+        encoded in the file names or a file holds several worldtubes.
+      num_procs: Maximum number of runs at the same time. Defaults to the
+        number of cores.
+      executable: The CCE executable. Defaults to the 'Executable' listed in
+        the input file metadata.
+      force: Overwrite existing input files.
+      submit: Set to 'False' to only configure the run directories.
+
+    Returns:
+      The runs of the batch.
+    """
+    input_file_template = Path(input_file_template)
+    extractions = batch_extractions(
+        worldtube_files=worldtube_files,
+        output_dir=output_dir,
+        extraction_radii=extraction_radii,
+    )
+    input_file_name = input_file_template.name
+    for extraction in extractions:
+        extraction.run_dir.mkdir(parents=True, exist_ok=True)
+        _write_or_overwrite(
+            configure_input_file(input_file_template, extraction),
+            extraction.run_dir / input_file_name,
+            force=force,
+        )
+    if not submit:
+        return extractions
+
+    if executable is None:
+        metadata = next(yaml.safe_load_all(input_file_template.read_text()))
+        executable = metadata["Executable"]
+    executable = _resolve_executable(executable)
+    num_procs = min(num_procs or os.cpu_count() or 1, len(extractions))
+    logger.info(
+        f"Run {len(extractions)} CCE extraction"
+        f"{'s'[:len(extractions)!=1]} on {num_procs}"
+        f" core{'s'[:num_procs!=1]}."
+    )
+    with ThreadPoolExecutor(max_workers=num_procs) as pool:
+        return_codes = list(
+            pool.map(
+                lambda extraction: _run_extraction(
+                    executable, input_file_name, extraction
+                ),
+                extractions,
+            )
+        )
+    failed_runs = [
+        str(extraction.run_dir)
+        for extraction, return_code in zip(extractions, return_codes)
+        if return_code != 0
+    ]
+    if failed_runs:
+        raise RuntimeError(
+            f"{len(failed_runs)} of {len(extractions)} CCE runs failed: "
+            + ", ".join(failed_runs)
+        )
+    return extractions
+
+
+@click.command(name="cce-batch", help=batch_extract.__doc__)
+@click.argument(
+    "input_file_template",
+    type=click.Path(
+        exists=True,
+        file_okay=True,
+        dir_okay=False,
+        readable=True,
+        path_type=Path,
+    ),
+)
+@click.argument(
+    "worldtube_files",
+    nargs=-1,
+    required=True,
+    type=click.Path(
+        exists=True,
+        file_okay=True,
+        dir_okay=False,
+        readable=True,
+        path_type=Path,
+    ),
+)
+@click.option(
+    "--output-dir",
+    "-o",
+    type=click.Path(
+        writable=True,
+        file_okay=False,
+        dir_okay=True,
+        path_type=Path,
+    ),
+    required=True,
+    help="Directory in which the runs are configured.",
+)
+@click.option(
+    "--extraction-radius",
+    "-r",
+    "extraction_radii",
+    type=float,
+    multiple=True,
+    help=(
+        "Radius of the worldtubes. Repeat to extract each worldtube file at"
+        " several radii. Defaults to the radius encoded in the file names."
+    ),
+)
+@click.option(
+    "--num-procs",
+    "-j",
+    type=int,
+    help="Maximum number of runs at the same time. [default: all cores]",
+)
+@click.option(
+    "--executable",
+    "-E",
+    type=click.Path(path_type=Path),
+    help=(
+        "The CCE executable. [default: the 'Executable' in the input file"
+        " metadata]"
+    ),
+)
+@click.option(
+    "--force", "-f", is_flag=True, help="Overwrite existing input files."
+)
+@click.option(
+    "--submit/--no-submit",
+    default=True,
+    show_default=True,
+    help="Run the extractions, or only configure the run directories.",
+)
+def batch_extract_command(**kwargs):
+    _rich_traceback_guard = True  # Hide traceback until here
+    batch_extract(**kwargs)
+
+
+if __name__ == "__main__":
+    batch_extract_command(help_option_names=["-h", "--help"])
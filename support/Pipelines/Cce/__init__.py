@@ -0,0 +1,7 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+from .BatchExtract import batch_extract_command
+
+if __name__ == "__main__":
+    batch_extract_command(help_option_names=["-h", "--help"])
@@ -0,0 +1,425 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import logging
+import math
+from dataclasses import asdict, dataclass
+from pathlib import Path
+from typing import List, Optional, Sequence, Union
+
+import click
+import h5py
+import numpy as np
+import pandas as pd
+import rich.console
+import rich.table
+import yaml
+
+from spectre.support.Schedule import schedule, scheduler_options
+from spectre.Visualization.ReadH5 import to_dataframe
+
+logger = logging.getLogger(__name__)
+
+SCALAR_WAVE_INPUT_FILE_TEMPLATE = Path(__file__).parent / "ScalarWave.yaml"
+STUDY_FILE_NAME = "ScalingStudy.yaml"
+
+
+@dataclass(frozen=True)
+class ScalingRun:
+    """A single run of a scaling study
+
+    Attributes:
+      num_nodes: Number of nodes the run uses.
+      refinement: Initial refinement level in each dimension of the domain.
+      run_dir: The directory in which the executable runs.
+    """
+
+    num_nodes: int
+    refinement: List[int]
+    run_dir: Path
+
+
+def refinement_for_nodes(
+    base_refinement: Sequence[int],
+    num_nodes: int,
+    base_num_nodes: int,
+    weak: bool,
+) -> List[int]:
+    """Refinement levels of the domain for a run on 'num_nodes' nodes
+
+    For strong scaling the domain is the same for all runs. For weak scaling
+    the number of elements grows with the number of nodes, so every doubling
+    of the nodes refines the domain once more in one of the dimensions, going
+    round-robin through the dimensions. The number of nodes must be a power of
+    two multiple of the 'base_num_nodes' for weak scaling.
+    """
+    refinement = list(base_refinement)
+    if not weak:
+        return refinement
+    num_doublings = math.log2(num_nodes / base_num_nodes)
+    if num_doublings < 0 or not num_doublings.is_integer():
+        raise ValueError(
+            "Weak scaling needs node counts that are power of two multiples"
+            f" of the smallest node count {base_num_nodes}, but got"
+            f" {num_nodes}."
+        )
+    for i in range(int(num_doublings)):
+        refinement[i % len(refinement)] += 1
+    return refinement
+
+
+def scaling_runs(
+    num_nodes: Union[int, Sequence[int]],
+    base_refinement: Sequence[int],
+    study_dir: Union[str, Path],
+    weak: bool,
+) -> List[ScalingRun]:
+    """List the runs of a scaling study
+
+    The runs get their own directories in the 'study_dir', named after the
+    number of nodes.
+    """
+    if isinstance(num_nodes, int):
+        num_nodes = [num_nodes]
+    base_num_nodes = min(num_nodes)
+    return [
+        ScalingRun(
+            num_nodes=nodes,
+            refinement=refinement_for_nodes(
+                base_refinement,
+                num_nodes=nodes,
+                base_num_nodes=base_num_nodes,
+                weak=weak,
+            ),
+            run_dir=Path(study_dir) / f"N{nodes}",
+        )
+        for nodes in sorted(set(num_nodes))
+    ]
+
+
+def schedule_scaling_study(
+    study_dir: Union[str, Path],
+    num_nodes: Union[int, Sequence[int]],
+    weak: bool,
+    input_file_template: Union[str, Path] = SCALAR_WAVE_INPUT_FILE_TEMPLATE,
+    executable: Optional[Union[str, Path]] = None,
+    refinement: int = 2,
+    polynomial_order: int = 5,
+    num_slabs: int = 100,
+    **scheduler_kwargs,
+) -> List[ScalingRun]:
+    """Schedule a strong or weak scaling study
+
+    Schedules one run per number of nodes in subdirectories of the
+    'study_dir'. For strong scaling all runs evolve the same domain. For weak
+    scaling the domain is refined once more for every doubling of the nodes,
+    so the work per node stays the same. Each run observes the wall time of
+    every slab with the 'ObserveTimeStep' event. Evaluate the study with
+    'spectre scaling table' once the runs have finished. To compare the array
+    and the nodegroup ('DgElementCollection') parallelization, schedule a
+    study for an executable built with each and pass both study directories
+    to 'spectre scaling table'.
+
+    The input file template must have the placeholders 'L0', 'L1' and 'L2'
+    (the refinement level in each dimension), 'P' (the polynomial order) and
+    'num_slabs' (the number of slabs to evolve), and must observe the time
+    steps in the subfile 'TimeSteps'. By default, a 3D scalar wave on a
+    periodic cube is evolved.
+
+    Arguments:
+      study_dir: Directory in which the runs are configured.
+      num_nodes: Number of nodes of the runs.
+      weak: Run a weak scaling study if 'True', or a strong scaling study if
+        'False'.
+      input_file_template: Input file of the runs.
+      executable: The executable to run. Defaults to the 'Executable' listed
+        in the input file metadata.
+      refinement: Initial refinement level in each dimension of the run on the
+        fewest nodes.
+      polynomial_order: Polynomial order of the elements.
+      num_slabs: Number of slabs to evolve.
+      scheduler_kwargs: Additional arguments passed to the 'schedule' function.
+
+    Returns:
+      The runs of the study.
+    """
+    study_dir = Path(study_dir)
+    input_file_template = Path(input_file_template)
+    if executable is None:
+        metadata = next(yaml.safe_load_all(input_file_template.read_text()))
+        executable = metadata["Executable"]
+    runs = scaling_runs(
+        num_nodes=num_nodes,
+        base_refinement=[refinement] * 3,
+        study_dir=study_dir,
+        weak=weak,
+    )
+    study_dir.mkdir(parents=True, exist_ok=True)
+    with open(study_dir / STUDY_FILE_NAME, "w") as open_study_file:
+        yaml.safe_dump(
+            dict(
+                Executable=Path(executable).name,
+                Scaling="Weak" if weak else "Strong",
+                Runs=[
+                    dict(asdict(run), run_dir=str(run.run_dir.resolve()))
+                    for run in runs
+                ],
+            ),
+            open_study_file,
+            sort_keys=False,
+        )
+    for run in runs:
+        schedule(
+            input_file_template,
+            executable=executable,
+            run_dir=run.run_dir,
+            num_nodes=run.num_nodes,
+            # Lists would schedule a run per entry, so pass the refinement in
+            # each dimension separately
+            **{f"L{d}": level for d, level in enumerate(run.refinement)},
+            P=polynomial_order,
+            num_slabs=num_slabs,
+            **scheduler_kwargs,
+        )
+    return runs
+
+
+def wall_time_per_slab(
+    reductions_file: Union[str, Path],
+    subfile_name: str = "TimeSteps.dat",
+    num_discarded_slabs: int = 1,
+) -> float:
+    """Average wall time per slab in seconds
+
+    Computed from the maximum wall time over all cores written by the
+    'ObserveTimeStep' event. The first 'num_discarded_slabs' observations are
+    not included, so startup and self-start don't count toward the average.
+    """
+    with h5py.File(reductions_file, "r") as open_h5_file:
+        time_steps = to_dataframe(open_h5_file[subfile_name])
+    time_steps = time_steps.iloc[num_discarded_slabs:]
+    if len(time_steps) < 2:
+        raise ValueError(
+            f"Need at least two time step observations after discarding the"
+            f" first {num_discarded_slabs} in '{reductions_file}', but got"
+            f" {len(time_steps)}."
+        )
+    elapsed_time = time_steps["Time"].iloc[-1] - time_steps["Time"].iloc[0]
+    num_slabs = np.round(elapsed_time / time_steps["Slab size"].mean())
+    elapsed_wall_time = (
+        time_steps["Maximum Walltime"].iloc[-1]
+        - time_steps["Maximum Walltime"].iloc[0]
+    )
+    return elapsed_wall_time / num_slabs
+
+
+def _reductions_file(run_dir: Path) -> Path:
+    input_files = [
+        input_file
+        for input_file in run_dir.glob("*.yaml")
+        if input_file.name not in [STUDY_FILE_NAME, "SchedulerContext.yaml"]
+    ]
+    if len(input_files) != 1:
+        raise ValueError(f"Expected one input file in '{run_dir}'.")
+    _, input_file = yaml.safe_load_all(input_files[0].read_text())
+    return run_dir / (input_file["Observers"]["ReductionFileName"] + ".h5")
+
+
+def scaling_table(
+    study_dirs: Union[str, Path, Sequence[Union[str, Path]]],
+    num_discarded_slabs: int = 1,
+) -> pd.DataFrame:
+    """Parallel efficiency of the runs of scaling studies
+
+    The efficiency of each run is measured relative to the run of the same
+    study on the fewest nodes. For strong scaling it is (T_0 N_0) / (T N), and
+    for weak scaling it is T_0 / T, where T is the wall time per slab and N the
+    number of nodes. Runs that haven't written enough time step observations
+    yet are skipped.
+
+    Arguments:
+      study_dirs: Directories of scaling studies scheduled with
+        'spectre scaling schedule'.
+      num_discarded_slabs: Number of slabs at the start of each run that
+        aren't included in the timings.
+
+    Returns:
+      A table with one row per run.
+    """
+    if isinstance(study_dirs, (str, Path)):
+        study_dirs = [study_dirs]
+    rows = []
+    for study_dir in study_dirs:
+        study = yaml.safe_load((Path(study_dir) / STUDY_FILE_NAME).read_text())
+        for run in study["Runs"]:
+            run_dir = Path(run["run_dir"])
+            try:
+                time_per_slab = wall_time_per_slab(
+                    _reductions_file(run_dir),
+                    num_discarded_slabs=num_discarded_slabs,
+                )
+            except (OSError, KeyError, ValueError) as err:
+                logger.warning(f"Skipping run in '{run_dir}': {err}")
+                continue
+            rows.append(
+                dict(
+                    Study=str(study_dir),
+                    Executable=study["Executable"],
+                    Scaling=study["Scaling"],
+                    NumNodes=run["num_nodes"],
+                    Elements=2 ** sum(run["refinement"]),
+                    WalltimePerSlab=time_per_slab,
+                )
+            )
+    columns = [
+        "Study",
+        "Executable",
+        "Scaling",
+        "NumNodes",
+        "Elements",
+        "WalltimePerSlab",
+    ]
+    table = pd.DataFrame(rows, columns=columns)
+    table["Efficiency"] = np.nan
+    for _, runs in table.groupby("Study", sort=False):
+        reference = runs.loc[runs["NumNodes"].idxmin()]
+        efficiency = reference["WalltimePerSlab"] / runs["WalltimePerSlab"]
+        if reference["Scaling"] == "Strong":
+            efficiency *= reference["NumNodes"] / runs["NumNodes"]
+        table.loc[runs.index, "Efficiency"] = efficiency
+    return table
+
+
+@click.group(name="scaling")
+def scaling_command():
+    """Measure the strong and weak scaling of evolutions."""
+    pass
+
+
+@scaling_command.command(name="schedule", help=schedule_scaling_study.__doc__)
+@click.argument(
+    "study_dir",
+    type=click.Path(
+        writable=True,
+        file_okay=False,
+        dir_okay=True,
+        path_type=Path,
+    ),
+)
+@click.option(
+    "--weak/--strong",
+    required=True,
+    help="Keep the work per node or the total work fixed.",
+)
+@click.option(
+    "--input-file-template",
+    "-i",
+    type=click.Path(
+        exists=True,
+        file_okay=True,
+        dir_okay=False,
+        readable=True,
+        path_type=Path,
+    ),
+    default=SCALAR_WAVE_INPUT_FILE_TEMPLATE,
+    help="Input file of the runs. [default: 3D scalar wave]",
+)
+@click.option(
+    "--refinement",
+    "-L",
+    type=int,
+    default=2,
+    show_default=True,
+    help="Initial refinement level of the run on the fewest nodes.",
+)
+@click.option(
+    "--polynomial-order",
+    "-P",
+    type=int,
+    default=5,
+    show_default=True,
+    help="Polynomial order of the elements.",
+)
+@click.option(
+    "--num-slabs",
+    type=int,
+    default=100,
+    show_default=True,
+    help="Number of slabs to evolve.",
+)
+@scheduler_options
+def schedule_scaling_study_command(run_dir, segments_dir, num_nodes, **kwargs):
+    _rich_traceback_guard = True  # Hide traceback until here
+    if run_dir or segments_dir:
+        raise click.UsageError(
+            "The runs of a scaling study are configured in subdirectories of"
+            " the 'STUDY_DIR'."
+        )
+    if not num_nodes:
+        raise click.UsageError(
+            "Specify the number of nodes of the runs with '--num-nodes' /"
+            " '-N', e.g. '-N 2**0...6' for 1 to 64 nodes."
+        )
+    if kwargs.get("num_procs"):
+        raise click.UsageError(
+            "The runs of a scaling study are set up by the number of nodes."
+        )
+    schedule_scaling_study(num_nodes=num_nodes, **kwargs)
+
+
+@scaling_command.command(name="table", help=scaling_table.__doc__)
+@click.argument(
+    "study_dirs",
+    nargs=-1,
+    required=True,
+    type=click.Path(
+        exists=True,
+        file_okay=False,
+        dir_okay=True,
+        readable=True,
+        path_type=Path,
+    ),
+)
+@click.option(
+    "--num-discarded-slabs",
+    type=int,
+    default=1,
+    show_default=True,
+    help="Number of slabs at the start of each run to leave out of timings.",
+)
+@click.option(
+    "--output",
+    "-o",
+    type=click.Path(writable=True, dir_okay=False, path_type=Path),
+    help="Write the table to this CSV file.",
+)
+def scaling_table_command(study_dirs, num_discarded_slabs, output):
+    _rich_traceback_guard = True  # Hide traceback until here
+    table = scaling_table(study_dirs, num_discarded_slabs=num_discarded_slabs)
+    if output:
+        table.to_csv(output, index=False)
+    rich_table = rich.table.Table(
+        "Study",
+        "Executable",
+        "Scaling",
+        "Nodes",
+        "Elements",
+        "Walltime per slab [s]",
+        "Efficiency",
+        box=None,
+    )
+    for _, row in table.iterrows():
+        rich_table.add_row(
+            row["Study"],
+            row["Executable"],
+            row["Scaling"],
+            str(row["NumNodes"]),
+            str(row["Elements"]),
+            f"{row['WalltimePerSlab']:.4g}",
+            f"{row['Efficiency']:.1%}",
+        )
+    rich.console.Console().print(rich_table)
+
+
+if __name__ == "__main__":
+    scaling_command(help_option_names=["-h", "--help"])
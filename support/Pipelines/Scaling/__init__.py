@@ -0,0 +1,7 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+from .ScalingStudy import scaling_command
+
+if __name__ == "__main__":
+    scaling_command(help_option_names=["-h", "--help"])
@@ -22,6 +22,7 @@ class Cli(click.MultiCommand):
     def list_commands(self, ctx):
         return [
             "bbh",
+            "cce-batch",
             "clean-output",
             "combine-h5",
             "delete-subfiles",
@@ -37,6 +38,7 @@ class Cli(click.MultiCommand):
             "render-3d",
             "resubmit",
             "run-next",
+            "scaling",
             "schedule",
             "simplify-traces",
             "status",
@@ -49,6 +51,10 @@ class Cli(click.MultiCommand):
             from spectre.Pipelines.Bbh import bbh_pipeline
 
             return bbh_pipeline
+        if name == "cce-batch":
+            from spectre.Pipelines.Cce import batch_extract_command
+
+            return batch_extract_command
         if name == "clean-output":
             from spectre.tools.CleanOutput import clean_output_command
 
@@ -120,6 +126,10 @@ class Cli(click.MultiCommand):
             from spectre.support.RunNext import run_next_command
 
             return run_next_command
+        elif name == "scaling":
+            from spectre.Pipelines.Scaling import scaling_command
+
+            return scaling_command
         elif name in ["schedule", "run"]:
             from spectre.support.Schedule import schedule_command
 
@@ -286,6 +286,31 @@ SPECTRE_TEST_CASE("Unit.ControlSystem.FindTwoCenters",
   CHECK(mass_b == 2.5);
   CHECK(first_moment_a == std::array<double, 3>{8.0, 4.5, 3.0});
   CHECK(first_moment_b == std::array<double, 3>{-2.5, 2.5, 0.0});
+  {
+    INFO("Elements on one side of x = 0");
+    double one_sided_mass_a = -1.;
+    double one_sided_mass_b = -1.;
+    std::array<double, 3> one_sided_moment_a = {-1., -1., -1.};
+    std::array<double, 3> one_sided_moment_b = {-1., -1., -1.};
+    const tnsr::I<DataVector, 3, Frame::Grid> x_grid_a{
+        {x_coord + 1.0, y_coord, z_coord}};
+    control_system::measurements::center_of_mass_integral_on_element(
+        &one_sided_mass_a, &one_sided_mass_b, &one_sided_moment_a,
+        &one_sided_moment_b, mesh, inv_det_jacobian, tilde_d, x_grid_a);
+    CHECK(one_sided_mass_a == 10.5);
+    CHECK(one_sided_mass_b == 0.0);
+    CHECK(one_sided_moment_a == std::array<double, 3>{16.0, 7.0, 3.0});
+    CHECK(one_sided_moment_b == std::array<double, 3>{0.0, 0.0, 0.0});
+    const tnsr::I<DataVector, 3, Frame::Grid> x_grid_b{
+        {x_coord - 3.0, y_coord, z_coord}};
+    control_system::measurements::center_of_mass_integral_on_element(
+        &one_sided_mass_a, &one_sided_mass_b, &one_sided_moment_a,
+        &one_sided_moment_b, mesh, inv_det_jacobian, tilde_d, x_grid_b);
+    CHECK(one_sided_mass_a == 0.0);
+    CHECK(one_sided_mass_b == 10.5);
+    CHECK(one_sided_moment_a == std::array<double, 3>{0.0, 0.0, 0.0});
+    CHECK(one_sided_moment_b == std::array<double, 3>{-26.0, 7.0, 3.0});
+  }
 
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
   using control_system_component = MockControlSystemComponent<Metavariables>;
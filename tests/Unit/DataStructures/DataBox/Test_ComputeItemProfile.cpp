@@ -0,0 +1,73 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include "DataStructures/DataBox/ComputeItemProfile.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Base : db::SimpleTag {
+  using type = double;
+};
+
+struct Doubled : db::SimpleTag {
+  using type = double;
+};
+
+struct DoubledCompute : Doubled, db::ComputeTag {
+  using base = Doubled;
+  using return_type = double;
+  using argument_tags = tmpl::list<Base>;
+  static void function(const gsl::not_null<double*> result,
+                       const double base_value) {
+    *result = 2. * base_value;
+  }
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.DataBox.ComputeItemProfile",
+                  "[Unit][DataStructures]") {
+  db::clear_compute_item_profile();
+  db::detail::record_compute_item_evaluation("Expensive", 2.);
+  db::detail::record_compute_item_evaluation("Expensive", 1.);
+  db::detail::record_compute_item_evaluation("Cheap", 0.5);
+  db::detail::record_compute_item_reset("Cheap");
+  auto profile = db::compute_item_profile();
+  CHECK(profile.size() == 2);
+  CHECK(profile.at("Expensive").evaluations == 2);
+  CHECK(profile.at("Expensive").evaluation_time == 3.);
+  CHECK(profile.at("Expensive").resets == 0);
+  CHECK(profile.at("Cheap").evaluations == 1);
+  CHECK(profile.at("Cheap").evaluation_time == 0.5);
+  CHECK(profile.at("Cheap").resets == 1);
+  const std::string summary = db::compute_item_profile_summary();
+  // Sorted by evaluation time
+  CHECK(summary.find("Expensive") < summary.find("Cheap"));
+  db::clear_compute_item_profile();
+  CHECK(db::compute_item_profile().empty());
+
+  auto box = db::create<db::AddSimpleTags<Base>,
+                        db::AddComputeTags<DoubledCompute>>(1.);
+  CHECK(db::get<Doubled>(box) == 2.);
+  // Resetting an item that wasn't retrieved since the last reset isn't counted
+  for (size_t i = 0; i < 2; ++i) {
+    db::mutate<Base>([](const gsl::not_null<double*> base) { *base += 1.; },
+                     make_not_null(&box));
+  }
+  CHECK(db::get<Doubled>(box) == 6.);
+  profile = db::compute_item_profile();
+#ifdef SPECTRE_PROFILING
+  REQUIRE(profile.size() == 1);
+  CHECK(profile.begin()->second.evaluations == 2);
+  CHECK(profile.begin()->second.resets == 1);
+#else
+  CHECK(profile.empty());
+#endif  // SPECTRE_PROFILING
+}
@@ -172,6 +172,17 @@ struct MutateAndReturnApply {
   }
 };
 
+// Mutates an item that no compute tag depends on
+struct MutatePointer {
+  using return_tags = tmpl::list<Pointer>;
+  using argument_tags = tmpl::list<Tag3>;
+
+  void operator()(const gsl::not_null<std::unique_ptr<double>*> pointed,
+                  const double tag3) const {
+    **pointed = tag3;
+  }
+};
+
 struct MutateAndReturnWithoutLists {
   double operator()(
       const gsl::not_null<double*> tag0,
@@ -235,6 +246,20 @@ SPECTRE_TEST_CASE("Unit.DataStructures.DataBox.ObservationBox",
   CHECK(Tag3Compute::times_called == 3);
   CHECK(get<Tag3>(obs_box) == (5.0 + 2.0 * 5.0 + 2.0 * 2.0 * 5.0));
   CHECK(Tag3Compute::times_called == 4);
+
+  // Only the compute items that depend on the mutated tags are reset
+  mutate_apply(MutatePointer{}, make_not_null(&obs_box));
+  CHECK(get<Pointer>(obs_box) == (5.0 + 2.0 * 5.0 + 2.0 * 2.0 * 5.0));
+  CHECK(get<Tag3>(obs_box) == (5.0 + 2.0 * 5.0 + 2.0 * 2.0 * 5.0));
+  CHECK(Tag3Compute::times_called == 4);
+  db::mutate<Tag0>([](const gsl::not_null<double*> tag0) { *tag0 = 1.0; },
+                   make_not_null(&db_box));
+  obs_box.reset_items_depending_on<tmpl::list<Pointer>>();
+  CHECK(Tag3Compute::times_called == 4);
+  obs_box.reset_items_depending_on<tmpl::list<Tag0>>();
+  CHECK(get<Tag2>(obs_box) == 4.0);
+  CHECK(get<Tag3>(obs_box) == (1.0 + 2.0 * 1.0 + 2.0 * 2.0 * 1.0));
+  CHECK(Tag3Compute::times_called == 5);
 }
 
 }  // namespace
@@ -3,12 +3,14 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
 #include <type_traits>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Expressions/Evaluate.hpp"
 #include "DataStructures/Tensor/Expressions/TensorIndex.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank0.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank1.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank2.hpp"
@@ -32,11 +34,42 @@ void test_contains_indices_to_contract() {
   test_contains_indices_to_contract_impl<ti::j, ti::c, ti::J, ti::A, ti::a>(
       true);
 }
+
+// Components longer than `tenex::detail::evaluation_block_size` are evaluated
+// one block of grid points at a time
+void test_evaluate_in_blocks() {
+  const size_t num_points = 3 * tenex::detail::evaluation_block_size + 7;
+  tnsr::ab<DataVector, 3> R(num_points);
+  tnsr::ab<DataVector, 3> S(num_points);
+  for (size_t i = 0; i < R.size(); ++i) {
+    for (size_t k = 0; k < num_points; ++k) {
+      R[i][k] = static_cast<double>(i) + 0.01 * static_cast<double>(k);
+    }
+  }
+  for (size_t i = 0; i < S.size(); ++i) {
+    for (size_t k = 0; k < num_points; ++k) {
+      S[i][k] = 2. - static_cast<double>(i * k) * 1.e-3;
+    }
+  }
+  const tnsr::ab<DataVector, 3> L =
+      tenex::evaluate<ti::b, ti::a>(3. * R(ti::a, ti::b) - S(ti::b, ti::a));
+  tnsr::ab<DataVector, 3> L_not_null{};
+  tenex::evaluate<ti::b, ti::a>(make_not_null(&L_not_null),
+                                3. * R(ti::a, ti::b) - S(ti::b, ti::a));
+  for (size_t a = 0; a < 4; ++a) {
+    for (size_t b = 0; b < 4; ++b) {
+      const DataVector expected = 3. * R.get(b, a) - S.get(a, b);
+      CHECK_ITERABLE_APPROX(L.get(a, b), expected);
+      CHECK_ITERABLE_APPROX(L_not_null.get(a, b), expected);
+    }
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.Evaluate",
                   "[DataStructures][Unit]") {
   test_contains_indices_to_contract();
+  test_evaluate_in_blocks();
 
   // Rank 0: double
   TestHelpers::tenex::test_evaluate_rank_0<double>(-7.31);
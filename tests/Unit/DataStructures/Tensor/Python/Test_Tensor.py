@@ -47,6 +47,11 @@ class TestTensor(unittest.TestCase):
             npt.assert_equal(xyz, coords.get(d))
             self.assertEqual(coords.multiplicity(d), 1)
             self.assertEqual(coords.component_suffix(d), ["_x", "_y", "_z"][d])
+        # Components are views into the tensor data
+        component_view = np.asarray(coords[0])
+        component_view[1] = 5.0
+        self.assertEqual(coords[0][1], 5.0)
+        self.assertEqual(coords.get(0)[1], 5.0)
 
     def test_construct_from_list(self):
         data = [DataVector(xyz) for xyz in np.random.rand(3, 4)]
@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/ApplyMatrixInFirstDimension.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+void test(const gsl::not_null<std::mt19937*> gen, const size_t rows,
+          const size_t columns) {
+  CAPTURE(rows);
+  CAPTURE(columns);
+  UniformCustomDistribution<double> dist{-1.0, 1.0};
+  const size_t number_of_columns = 7;
+  Matrix matrix(rows, columns);
+  for (size_t i = 0; i < rows; ++i) {
+    for (size_t k = 0; k < columns; ++k) {
+      matrix(i, k) = dist(*gen);
+    }
+  }
+  const auto data = make_with_random_values<DataVector>(
+      gen, make_not_null(&dist), DataVector(columns * number_of_columns));
+  const auto initial_result = make_with_random_values<DataVector>(
+      gen, make_not_null(&dist), DataVector(rows * number_of_columns));
+
+  DataVector expected(rows * number_of_columns, 0.0);
+  for (size_t n = 0; n < number_of_columns; ++n) {
+    for (size_t i = 0; i < rows; ++i) {
+      for (size_t k = 0; k < columns; ++k) {
+        expected[i + rows * n] += matrix(i, k) * data[k + columns * n];
+      }
+    }
+  }
+
+  for (const bool add_to_result : {false, true}) {
+    CAPTURE(add_to_result);
+    const DataVector expected_result =
+        add_to_result ? DataVector{expected + initial_result} : expected;
+    DataVector fixed_size_result = initial_result;
+    apply_matrix_in_first_dimension(make_not_null(fixed_size_result.data()),
+                                    matrix, data.data(), number_of_columns,
+                                    add_to_result);
+    CHECK_ITERABLE_APPROX(fixed_size_result, expected_result);
+    DataVector general_result = initial_result;
+    apply_matrix_in_first_dimension<false>(
+        make_not_null(general_result.data()), matrix, data.data(),
+        number_of_columns, add_to_result);
+    CHECK_ITERABLE_APPROX(general_result, expected_result);
+  }
+
+  // Apply the matrix along the middle index of `data[s + stride * (k +
+  // columns * b)]`
+  const size_t stride = 3;
+  const size_t number_of_blocks = 2;
+  const auto strided_data = make_with_random_values<DataVector>(
+      gen, make_not_null(&dist),
+      DataVector(stride * columns * number_of_blocks));
+  const auto initial_strided_result = make_with_random_values<DataVector>(
+      gen, make_not_null(&dist), DataVector(stride * rows * number_of_blocks));
+  DataVector expected_strided(stride * rows * number_of_blocks, 0.0);
+  for (size_t b = 0; b < number_of_blocks; ++b) {
+    for (size_t i = 0; i < rows; ++i) {
+      for (size_t k = 0; k < columns; ++k) {
+        for (size_t st = 0; st < stride; ++st) {
+          expected_strided[st + stride * (i + rows * b)] +=
+              matrix(i, k) * strided_data[st + stride * (k + columns * b)];
+        }
+      }
+    }
+  }
+  for (const bool add_to_result : {false, true}) {
+    CAPTURE(add_to_result);
+    const DataVector expected_result =
+        add_to_result ? DataVector{expected_strided + initial_strided_result}
+                      : expected_strided;
+    DataVector fixed_size_result = initial_strided_result;
+    apply_matrix_in_strided_dimension(
+        make_not_null(fixed_size_result.data()), matrix, strided_data.data(),
+        stride, number_of_blocks, add_to_result);
+    CHECK_ITERABLE_APPROX(fixed_size_result, expected_result);
+    DataVector general_result = initial_strided_result;
+    apply_matrix_in_strided_dimension<false>(
+        make_not_null(general_result.data()), matrix, strided_data.data(),
+        stride, number_of_blocks, add_to_result);
+    CHECK_ITERABLE_APPROX(general_result, expected_result);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.ApplyMatrixInFirstDimension",
+                  "[DataStructures][Unit]") {
+  MAKE_GENERATOR(gen);
+  // Covers the extents with fixed-size kernels for the default range as well
+  // as the general path on either side of it, and non-square matrices
+  for (size_t rows = 1; rows < 13; ++rows) {
+    for (const size_t columns : {rows, rows + 1, rows + 3}) {
+      test(make_not_null(&gen), rows, columns);
+    }
+  }
+  CHECK_FALSE(has_fixed_size_kernel(Matrix(1, 1)));
+  CHECK_FALSE(has_fixed_size_kernel(Matrix(20, 20)));
+}
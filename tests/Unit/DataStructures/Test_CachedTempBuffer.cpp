@@ -5,6 +5,8 @@
 
 #include <cstddef>
 #include <limits>
+#include <type_traits>
+#include <utility>
 
 #include "DataStructures/CachedTempBuffer.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
@@ -133,6 +135,18 @@ void test_cached_temp_buffer(const DataType& used_for_size) {
 
   CHECK(get_size(get(cache.get_var(computer, Tags::Scalar1<DataType>{}))) ==
         get_size(used_for_size));
+
+  // A cache can be stored and reused for a different number of points
+  cache.reinitialize(get_size(used_for_size) + 2);
+  CHECK(cache.number_of_grid_points() ==
+        (std::is_same_v<DataType, double> ? 1 : get_size(used_for_size) + 2));
+  CHECK(get<0>(cache.get_var(computer, Tags::Vector2<DataType>{})) == 110.0);
+  check_counts(1, 2, 2, 2);
+  cache.reinitialize(0);
+  Cache<DataType> moved_cache = std::move(cache);
+  moved_cache.reinitialize(get_size(used_for_size));
+  CHECK(get(moved_cache.get_var(computer, Tags::Scalar1<DataType>{})) == 7.0);
+  check_counts(2, 2, 2, 2);
 }
 }  // namespace
 
@@ -4,12 +4,15 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <array>
+#include <cstddef>
+#include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/ExtractPoint.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/Literals.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace {
@@ -143,10 +146,37 @@ void test_extract_point() {
   CHECK(reconstructed_variables == variables);
 }
 
+void test_for_each_simd_batch() {
+  // Use a size that is not a multiple of any SIMD width so the scalar
+  // remainder is exercised.
+  const size_t number_of_points = 19;
+  tnsr::I<DataVector, 2> source(number_of_points);
+  for (size_t i = 0; i < number_of_points; ++i) {
+    get<0>(source)[i] = static_cast<double>(i);
+    get<1>(source)[i] = 2.0 * static_cast<double>(i) + 1.0;
+  }
+  Scalar<DataVector> result(number_of_points, 0.0);
+  std::vector<size_t> visited(number_of_points, 0);
+  for_each_simd_batch(
+      number_of_points, [&](const size_t index, const auto use_simd) {
+        using T = tmpl::conditional_t<decltype(use_simd)::value,
+                                      simd::batch<double>, double>;
+        tnsr::I<T, 2> point{};
+        extract_point(make_not_null(&point), source, index);
+        const Scalar<T> dot{get<0>(point) * get<1>(point)};
+        overwrite_point(make_not_null(&result), dot, index);
+        for (size_t i = 0; i < simd::size<T>(); ++i) {
+          ++visited[index + i];
+        }
+      });
+  CHECK(visited == std::vector<size_t>(number_of_points, 1));
+  CHECK(get(result) == DataVector(get<0>(source) * get<1>(source)));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DataStructures.ExtractPoint",
                   "[DataStructures][Unit]") {
   test_extract_point<DataVector>();
   test_extract_point<ComplexDataVector>();
+  test_for_each_simd_batch();
 }
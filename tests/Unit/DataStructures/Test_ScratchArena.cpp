@@ -0,0 +1,108 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+void test_allocation() {
+  ScratchArena::reset_statistics();
+  {
+    const ScratchArena::Allocation<double> empty{};
+    CHECK(empty.data() == nullptr);
+    CHECK(empty.size() == 0);
+  }
+  // The first round of allocations may come from the heap if this thread has
+  // not requested enough scratch memory yet, but it sizes the arena so that the
+  // later rounds do not allocate.
+  for (size_t round = 0; round < 3; ++round) {
+    CAPTURE(round);
+    ScratchArena::Allocation<double> a{10};
+    ScratchArena::Allocation<std::complex<double>> b{7};
+    CHECK(a.size() == 10);
+    CHECK(b.size() == 7);
+    CHECK(reinterpret_cast<std::uintptr_t>(a.data()) % 64 == 0);
+    CHECK(reinterpret_cast<std::uintptr_t>(b.data()) % 64 == 0);
+    if (round > 0) {
+      CHECK(a.from_arena());
+      CHECK(b.from_arena());
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+      a[i] = static_cast<double>(i);
+    }
+    for (size_t i = 0; i < b.size(); ++i) {
+      b[i] = std::complex<double>(1.0, static_cast<double>(i));
+    }
+    // Allocations must not overlap
+    for (size_t i = 0; i < a.size(); ++i) {
+      CHECK(a[i] == static_cast<double>(i));
+    }
+
+    ScratchArena::Allocation<double> moved{std::move(a)};
+    CHECK(moved.size() == 10);
+    CHECK(moved[3] == 3.0);
+    CHECK(a.data() == nullptr);  // NOLINT(bugprone-use-after-move)
+  }
+
+  const auto statistics = ScratchArena::statistics();
+  CHECK(statistics.allocations_from_heap + statistics.allocations_from_arena ==
+        6);
+  CHECK(statistics.allocations_from_arena >= 4);
+  CHECK(statistics.bytes_from_heap + statistics.bytes_from_arena ==
+        3 * (10 * sizeof(double) + 7 * sizeof(std::complex<double>)));
+
+  ScratchArena::reset_statistics();
+  CHECK(ScratchArena::statistics().bytes_from_arena == 0);
+  CHECK(ScratchArena::statistics().allocations_from_heap == 0);
+}
+
+void test_threads() {
+  ScratchArena::reset_statistics();
+  // An arena used on another thread is independent of this thread's.
+  std::thread thread{[]() {
+    const ScratchArena::Allocation<double> a{100};
+    CHECK(not a.from_arena());
+  }};
+  thread.join();
+  // The counters of exited threads are kept
+  CHECK(ScratchArena::statistics().allocations_from_heap == 1);
+  CHECK(ScratchArena::statistics().bytes_from_heap == 100 * sizeof(double));
+}
+
+void test_temp_buffer() {
+  using tags = tmpl::list<::Tags::TempI<0, 3>, ::Tags::TempScalar<1>>;
+  // Make sure the arena is large enough
+  { const TempBuffer<tags> buffer(5); }
+  ScratchArena::reset_statistics();
+  {
+    TempBuffer<tags> buffer(5, 2.0);
+    CHECK(buffer.number_of_grid_points() == 5);
+    CHECK(get(get<::Tags::TempScalar<1>>(buffer)) == DataVector(5, 2.0));
+    get<2>(get<::Tags::TempI<0, 3>>(buffer)) = 4.0;
+    CHECK(get<2>(get<::Tags::TempI<0, 3>>(buffer)) == DataVector(5, 4.0));
+    CHECK(get(get<::Tags::TempScalar<1>>(buffer)) == DataVector(5, 2.0));
+  }
+  CHECK(ScratchArena::statistics().allocations_from_arena == 1);
+  CHECK(ScratchArena::statistics().bytes_from_arena == 20 * sizeof(double));
+  CHECK(ScratchArena::statistics().allocations_from_heap == 0);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.ScratchArena",
+                  "[DataStructures][Unit]") {
+  test_allocation();
+  test_threads();
+  test_temp_buffer();
+}
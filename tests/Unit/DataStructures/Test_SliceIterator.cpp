@@ -4,10 +4,13 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <numeric>
+#include <vector>
 
 #include "DataStructures/Index.hpp"
 #include "DataStructures/SliceIterator.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 
 namespace {
 void check_slice_iterator_helper(SliceIterator si) {
@@ -51,6 +54,34 @@ void check_slice_and_volume_indices(const Index<Dim>& extents) {
     }
   }
 }
+
+template <size_t Dim>
+void check_copy_volume_to_slice(const Index<Dim>& extents) {
+  const size_t number_of_components = 3;
+  const size_t volume_size = extents.product();
+  std::vector<double> volume_data(number_of_components * volume_size);
+  std::iota(volume_data.begin(), volume_data.end(), 1.0);
+  for (size_t d = 0; d < Dim; ++d) {
+    const size_t slice_size = extents.slice_away(d).product();
+    for (const size_t fixed_index : {0_st, extents[d] - 1}) {
+      std::vector<double> slice_data(number_of_components * slice_size, 0.0);
+      copy_volume_to_slice(slice_data.data(), volume_data.data(), extents, d,
+                           fixed_index, number_of_components);
+      std::vector<double> expected_volume_data = volume_data;
+      std::vector<double> added_volume_data = volume_data;
+      add_slice_to_volume(added_volume_data.data(), slice_data.data(), extents,
+                          d, fixed_index, number_of_components);
+      for (size_t i = 0; i < number_of_components; ++i) {
+        for (SliceIterator si(extents, d, fixed_index); si; ++si) {
+          CHECK(slice_data[si.slice_offset() + i * slice_size] ==
+                volume_data[si.volume_offset() + i * volume_size]);
+          expected_volume_data[si.volume_offset() + i * volume_size] *= 2.0;
+        }
+      }
+      CHECK(added_volume_data == expected_volume_data);
+    }
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DataStructures.SliceIterator",
@@ -81,4 +112,10 @@ SPECTRE_TEST_CASE("Unit.DataStructures.SliceIterator",
     check_slice_and_volume_indices(Index<3>{6, 4, 5});
     check_slice_and_volume_indices(Index<3>{3, 4, 5});
   }
+  SECTION("copy_volume_to_slice and add_slice_to_volume functions") {
+    check_copy_volume_to_slice(Index<1>{3});
+    check_copy_volume_to_slice(Index<2>{5, 4});
+    check_copy_volume_to_slice(Index<3>{6, 4, 3});
+    check_copy_volume_to_slice(Index<3>{3, 4, 5});
+  }
 }
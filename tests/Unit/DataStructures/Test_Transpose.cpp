@@ -12,6 +12,7 @@
 #include "DataStructures/Transpose.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/TMPL.hpp"
 
 template <typename TagsList>
@@ -143,4 +144,27 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Transpose", "[DataStructures][Unit]") {
             partial_vars.data()[i + chunk_size_vars * j]);    // NOLINT
     }
   }
+
+  // Wide matrices are transposed in several tiles of columns. Check all
+  // combinations of excess rows and columns beyond the SIMD blocks.
+  for (const size_t wide_chunk_size : {1_st, 3_st, 33_st, 64_st, 101_st}) {
+    for (const size_t wide_number_of_chunks :
+         {1_st, 2_st, 5_st, 35_st, 67_st}) {
+      CAPTURE(wide_chunk_size);
+      CAPTURE(wide_number_of_chunks);
+      DataVector wide_data(wide_chunk_size * wide_number_of_chunks);
+      for (size_t i = 0; i < wide_data.size(); ++i) {
+        wide_data[i] = static_cast<double>(i);
+      }
+      DataVector wide_transpose(wide_data.size());
+      raw_transpose(make_not_null(wide_transpose.data()), wide_data.data(),
+                    wide_chunk_size, wide_number_of_chunks);
+      for (size_t i = 0; i < wide_chunk_size; ++i) {
+        for (size_t j = 0; j < wide_number_of_chunks; ++j) {
+          CHECK(wide_transpose[j + wide_number_of_chunks * i] ==
+                wide_data[i + wide_chunk_size * j]);
+        }
+      }
+    }
+  }
 }
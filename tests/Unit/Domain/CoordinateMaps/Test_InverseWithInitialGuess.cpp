@@ -0,0 +1,58 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/CoordinateMaps/InverseWithInitialGuess.hpp"
+#include "Domain/CoordinateMaps/Wedge.hpp"
+#include "Domain/Structure/OrientationMap.hpp"
+#include "Utilities/Gsl.hpp"
+
+SPECTRE_TEST_CASE("Unit.Domain.CoordinateMaps.InverseWithInitialGuess",
+                  "[Domain][Unit]") {
+  const auto map =
+      domain::make_coordinate_map_base<Frame::BlockLogical, Frame::Inertial>(
+          domain::CoordinateMaps::Wedge<3>{1., 3., 1., 1.,
+                                           OrientationMap<3>::create_aligned(),
+                                           true});
+  const tnsr::I<DataVector, 3, Frame::BlockLogical> logical_coords{
+      {{{-0.5, 0., 0.9, 1.}, {0.3, 0., -0.2, -1.}, {-1., 0.1, 0.5, 1.}}}};
+  const auto target_coords = (*map)(logical_coords);
+  const auto perturbed_logical_coords = [&logical_coords]() {
+    auto result = logical_coords;
+    get<0>(result) += 0.05;
+    get<1>(result) -= 0.1;
+    get<2>(result) += DataVector{0.1, -0.1, 0.05, -0.05};
+    return result;
+  }();
+
+  // Converge to the inverse from a nearby initial guess, e.g. of points that
+  // moved only a little
+  auto source_coords = perturbed_logical_coords;
+  CHECK(domain::inverse_with_initial_guess(make_not_null(&source_coords), *map,
+                                           target_coords) ==
+        std::vector<bool>(4, true));
+  CHECK_ITERABLE_APPROX(source_coords, logical_coords);
+
+  // Report which points haven't converged
+  source_coords = perturbed_logical_coords;
+  for (size_t d = 0; d < 3; ++d) {
+    source_coords.get(d)[1] = logical_coords.get(d)[1];
+  }
+  CHECK(domain::inverse_with_initial_guess(make_not_null(&source_coords), *map,
+                                           target_coords, 0., {}, 0) ==
+        std::vector<bool>{false, true, false, false});
+  source_coords = perturbed_logical_coords;
+  get<0>(source_coords)[2] = std::numeric_limits<double>::quiet_NaN();
+  CHECK(domain::inverse_with_initial_guess(make_not_null(&source_coords), *map,
+                                           target_coords) ==
+        std::vector<bool>{true, true, false, true});
+}
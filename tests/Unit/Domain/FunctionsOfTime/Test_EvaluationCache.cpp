@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/EvaluationCache.hpp"
+#include "Utilities/Gsl.hpp"
+
+SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.EvaluationCache",
+                  "[Domain][Unit]") {
+  using Cache = domain::FunctionsOfTime::FunctionOfTimeHelpers::EvaluationCache<
+      9, 2>;
+  Cache cache{};
+  std::array<DataVector, 2> func_and_deriv{};
+  std::array<DataVector, 3> func_and_2_derivs{};
+  CHECK_FALSE(cache.get(make_not_null(&func_and_deriv), 1.));
+
+  const std::array<DataVector, 3> values{DataVector{1., 2., 3.},
+                                         DataVector{4., 5., 6.},
+                                         DataVector{7., 8., 9.}};
+  cache.store(1., values);
+  CHECK(cache.get(make_not_null(&func_and_2_derivs), 1.));
+  CHECK(func_and_2_derivs == values);
+  // Fewer derivatives are served from the cached ones
+  CHECK(cache.get(make_not_null(&func_and_deriv), 1.));
+  CHECK(func_and_deriv == std::array{values[0], values[1]});
+  CHECK_FALSE(cache.get(make_not_null(&func_and_deriv), 1.5));
+
+  // More derivatives are not cached
+  const std::array<DataVector, 2> other_values{DataVector{-1.},
+                                               DataVector{-2.}};
+  cache.store(2., other_values);
+  CHECK(cache.get(make_not_null(&func_and_deriv), 2.));
+  CHECK(func_and_deriv == other_values);
+  CHECK_FALSE(cache.get(make_not_null(&func_and_2_derivs), 2.));
+
+  // Too many values to cache
+  cache.store(3., std::array<DataVector, 2>{DataVector(5, 1.),
+                                            DataVector(5, 2.)});
+  CHECK_FALSE(cache.get(make_not_null(&func_and_deriv), 3.));
+
+  // Copies start empty
+  cache.store(1., values);
+  CHECK(cache.get(make_not_null(&func_and_2_derivs), 1.));
+  // NOLINTNEXTLINE(performance-unnecessary-copy-initialization)
+  const Cache copied_cache = cache;
+  CHECK_FALSE(copied_cache.get(make_not_null(&func_and_2_derivs), 1.));
+  Cache moved_cache = std::move(cache);
+  CHECK_FALSE(moved_cache.get(make_not_null(&func_and_2_derivs), 1.));
+  moved_cache.store(1., values);
+  CHECK(moved_cache.get(make_not_null(&func_and_2_derivs), 1.));
+  moved_cache.clear();
+  CHECK_FALSE(moved_cache.get(make_not_null(&func_and_2_derivs), 1.));
+}
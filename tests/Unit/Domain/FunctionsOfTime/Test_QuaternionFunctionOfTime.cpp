@@ -13,6 +13,7 @@
 #include "Domain/FunctionsOfTime/QuaternionFunctionOfTime.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/Utilities/Serialization/Versioning.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
@@ -495,6 +496,47 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.QuaternionFunctionOfTime",
     }
   }
 
+  {
+    INFO("QuaternionFunctionOfTime: Fits agree with ODE solution");
+    // A rapidly varying omega needs several segments per interval
+    const double omega_z = 1.3;
+    const double dtomega_z = 0.4;
+    domain::FunctionsOfTime::QuaternionFunctionOfTime<2> qfot{
+        0.0, std::array<DataVector, 1>{DataVector{{1.0, 0.0, 0.0, 0.0}}},
+        std::array<DataVector, 3>{DataVector{3, 0.0},
+                                  DataVector{{0.0, 0.0, omega_z}},
+                                  DataVector{{0.0, 0.0, dtomega_z}}},
+        4.0};
+    for (size_t i = 1; i < 4; ++i) {
+      qfot.update(4.0 * static_cast<double>(i), DataVector{3, 0.0},
+                  4.0 * static_cast<double>(i + 1));
+    }
+    // After deserializing, only the latest interval is fitted, so earlier
+    // intervals are evaluated with the ODE solve
+    const auto deserialized_qfot = serialize_and_deserialize(qfot);
+    CHECK(deserialized_qfot == qfot);
+
+    Approx custom_approx = Approx::custom().epsilon(1.0e-11).scale(1.0);
+    for (const double check_time : {0.0, 1.7, 4.0, 6.3, 9.9, 13.1, 16.0}) {
+      CAPTURE(check_time);
+      // phi(t) = omega t + dtomega t^2 / 2 up to t = 4, then linear in t
+      const double angle =
+          check_time <= 4.0
+              ? omega_z * check_time + 0.5 * dtomega_z * square(check_time)
+              : (omega_z + 4.0 * dtomega_z) * check_time - 8.0 * dtomega_z;
+      const DataVector expected_quat{
+          {cos(0.5 * angle), 0.0, 0.0, sin(0.5 * angle)}};
+      CHECK_ITERABLE_CUSTOM_APPROX(qfot.quat_func(check_time)[0],
+                                   expected_quat, custom_approx);
+      CHECK_ITERABLE_CUSTOM_APPROX(deserialized_qfot.quat_func(check_time)[0],
+                                   qfot.quat_func(check_time)[0],
+                                   custom_approx);
+      CHECK_ITERABLE_CUSTOM_APPROX(
+          deserialized_qfot.quat_func_and_2_derivs(check_time),
+          qfot.quat_func_and_2_derivs(check_time), custom_approx);
+    }
+  }
+
   test_serialization_versioning();
   test_out_of_order_update();
 }
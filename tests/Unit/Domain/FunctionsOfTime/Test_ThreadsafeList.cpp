@@ -3,6 +3,9 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <limits>
 #include <utility>
 
@@ -198,6 +201,39 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.ThreadsafeList",
     CHECK(truncate_list.initial_time() == 3.0);
   }
 
+  {
+    INFO("Lookups of earlier intervals");
+    ThreadsafeList<int> long_list(0.0);
+    for (int i = 0; i < 1000; ++i) {
+      long_list.insert(i, i, i + 1);
+    }
+    // Repeated lookups of the same interval are served by the hint, and
+    // lookups of other intervals and at boundaries still search the list
+    for (size_t repeat = 0; repeat < 2; ++repeat) {
+      for (const double time : {10.5, 10.5, 500.25, 10.5, 11.0, 0.0, 999.5}) {
+        CAPTURE(time);
+        const auto entry = long_list(time);
+        CHECK(entry.data == std::max(static_cast<int>(std::ceil(time)) - 1, 0));
+        CHECK(entry.update == entry.data);
+        CHECK(entry.expiration == entry.data + 1);
+      }
+      CHECK(long_list.expiration_after(10.0) == 11.0);
+      CHECK(long_list.expiration_after(10.5) == 11.0);
+    }
+    // Truncation resets the hint and keeps the remaining lookups valid
+    long_list.truncate_at_time(600.0);
+    CHECK(long_list.initial_time() == 599.0);
+    CHECK(long_list(700.5).data == 700);
+    CHECK(long_list(700.5).data == 700);
+    long_list.truncate_at_time(800.0);
+    CHECK(long_list.initial_time() == 799.0);
+    CHECK(long_list(799.5).data == 799);
+    const auto copy = serialize_and_deserialize(long_list);
+    CHECK(copy == long_list);
+    CHECK(copy(799.5).update == 799.0);
+    CHECK(copy(799.0).update == 799.0);
+  }
+
   {
     ThreadsafeList<int> infinite_list(0.0);
     infinite_list.insert(0.0, 1, std::numeric_limits<double>::infinity());
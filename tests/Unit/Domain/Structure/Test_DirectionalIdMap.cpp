@@ -0,0 +1,167 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/FixedHashMap.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionalId.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/MaxNumberOfNeighbors.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+
+namespace {
+// All neighbors of an element with 2-to-1 refinement, where the neighbors are
+// finer than the element in every direction
+template <size_t Dim>
+std::vector<DirectionalId<Dim>> all_neighbors() {
+  std::vector<DirectionalId<Dim>> neighbors{};
+  for (const auto& direction : Direction<Dim>::all_directions()) {
+    for (size_t face_index = 0;
+         face_index < maximum_number_of_neighbors_per_direction(Dim);
+         ++face_index) {
+      std::array<SegmentId, Dim> segment_ids{};
+      for (size_t d = 0, j = 0; d < Dim; ++d) {
+        if (d == direction.dimension()) {
+          gsl::at(segment_ids, d) = SegmentId{2, 1};
+        } else {
+          gsl::at(segment_ids, d) = SegmentId{2, 2 + ((face_index >> j) & 1)};
+          ++j;
+        }
+      }
+      neighbors.emplace_back(direction, ElementId<Dim>{0, segment_ids});
+    }
+  }
+  return neighbors;
+}
+
+template <size_t Dim>
+void test_directional_id_index() {
+  const auto neighbors = all_neighbors<Dim>();
+  REQUIRE(neighbors.size() == maximum_number_of_neighbors(Dim));
+  std::set<size_t> indices{};
+  for (const auto& neighbor : neighbors) {
+    indices.insert(domain::directional_id_index(neighbor));
+  }
+  // The index is a perfect hash of the neighbors
+  CHECK(indices.size() == neighbors.size());
+  CHECK(*indices.rbegin() == maximum_number_of_neighbors(Dim) - 1);
+}
+
+template <size_t Dim>
+void test_map() {
+  const auto neighbors = all_neighbors<Dim>();
+  DirectionalIdMap<Dim, std::string> map{};
+  CHECK(map.empty());
+  CHECK(map.begin() == map.end());
+
+  for (size_t i = 0; i < neighbors.size(); ++i) {
+    const auto [it, inserted] =
+        map.insert({neighbors[i], "Neighbor " + std::to_string(i)});
+    CHECK(inserted);
+    CHECK(it->first == neighbors[i]);
+    CHECK(map.size() == i + 1);
+  }
+  test_iterators(map);
+  // Entries are stored in insertion order
+  for (size_t i = 0; i < neighbors.size(); ++i) {
+    CHECK(map.begin()[i].first == neighbors[i]);
+    CHECK(map.contains(neighbors[i]));
+    CHECK(map.count(neighbors[i]) == 1);
+    CHECK(map.at(neighbors[i]) == "Neighbor " + std::to_string(i));
+    CHECK(map.find(neighbors[i]) == map.begin() + i);
+  }
+  CHECK_FALSE(map.insert({neighbors[0], "Other"}).second);
+  CHECK(map.at(neighbors[0]) == "Neighbor 0");
+  CHECK_FALSE(map.insert_or_assign(neighbors[0], "Other").second);
+  CHECK(map.at(neighbors[0]) == "Other");
+  map[neighbors[0]] = "Neighbor 0";
+  CHECK(map.at(neighbors[0]) == "Neighbor 0");
+  CHECK_THROWS_WITH(map.insert({DirectionalId<Dim>{Direction<Dim>::lower_xi(),
+                                                   ElementId<Dim>{1}},
+                                "Too many"}),
+                    Catch::Matchers::ContainsSubstring("because it is full"));
+
+  test_copy_semantics(map);
+  const auto copied_map = map;
+  test_move_semantics(std::move(map), copied_map);
+  CHECK(serialize_and_deserialize(copied_map) == copied_map);
+  CHECK(get_output(copied_map) ==
+        get_output(serialize_and_deserialize(copied_map)));
+
+  // Erasing moves the last entry into the erased place
+  auto erased_map = copied_map;
+  CHECK(erased_map.erase(neighbors[0]) == 1);
+  CHECK(erased_map.erase(neighbors[0]) == 0);
+  CHECK(erased_map.size() == neighbors.size() - 1);
+  CHECK(erased_map.begin()->first == neighbors.back());
+  CHECK_FALSE(erased_map.contains(neighbors[0]));
+  for (size_t i = 1; i < neighbors.size(); ++i) {
+    CHECK(erased_map.at(neighbors[i]) == "Neighbor " + std::to_string(i));
+  }
+  CHECK(erased_map != copied_map);
+  for (auto it = erased_map.begin(); it != erased_map.end();) {
+    it = erased_map.erase(it);
+  }
+  CHECK(erased_map.empty());
+  CHECK_THROWS_AS(erased_map.at(neighbors[0]), std::out_of_range);
+
+  // Keys that share an index are resolved by probing
+  const DirectionalId<Dim> first{Direction<Dim>::upper_xi(),
+                                 ElementId<Dim>{0}};
+  const DirectionalId<Dim> second{Direction<Dim>::upper_xi(),
+                                  ElementId<Dim>{1}};
+  REQUIRE(domain::directional_id_index(first) ==
+          domain::directional_id_index(second));
+  DirectionalIdMap<Dim, std::string> colliding_map{{first, "First"},
+                                                   {second, "Second"}};
+  CHECK(colliding_map.size() == 2);
+  CHECK(colliding_map.at(first) == "First");
+  CHECK(colliding_map.at(second) == "Second");
+  colliding_map.erase(first);
+  CHECK(colliding_map.at(second) == "Second");
+  CHECK_FALSE(colliding_map.contains(first));
+}
+
+template <size_t Dim>
+void test_legacy_serialization() {
+  // Data written when `DirectionalIdMap` was a `FixedHashMap`
+  const auto neighbors = all_neighbors<Dim>();
+  FixedHashMap<maximum_number_of_neighbors(Dim), DirectionalId<Dim>,
+               std::string>
+      legacy_map{};
+  DirectionalIdMap<Dim, std::string> expected_map{};
+  for (size_t i = 0; i < neighbors.size(); i += 2) {
+    legacy_map.emplace(neighbors[i], std::to_string(i));
+    expected_map.emplace(neighbors[i], std::to_string(i));
+  }
+  CHECK(deserialize<DirectionalIdMap<Dim, std::string>>(
+            serialize(legacy_map).data()) == expected_map);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.Structure.DirectionalIdMap",
+                  "[Domain][Unit]") {
+  test_directional_id_index<1>();
+  test_directional_id_index<2>();
+  test_directional_id_index<3>();
+  test_map<1>();
+  test_map<2>();
+  test_map<3>();
+  test_legacy_serialization<1>();
+  test_legacy_serialization<2>();
+  test_legacy_serialization<3>();
+}
@@ -817,6 +817,100 @@ void test_block_logical_coordinates_with_roundoff_error() {
   CHECK(get<1>(block_logical_coords[5]->data) < 1.0);
   CHECK(get<0>(block_logical_coords[6]->data) < 1.0);
 }
+
+template <size_t Dim, typename Fr>
+void check_block_logical_coordinates_with_initial_guess(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Fr>& x,
+    const std::vector<BlockLogicalCoords<Dim>>& initial_guess,
+    const double time = std::numeric_limits<double>::signaling_NaN(),
+    const domain::FunctionsOfTimeMap& functions_of_time = {}) {
+  const auto expected =
+      block_logical_coordinates(domain, x, time, functions_of_time);
+  const auto result = block_logical_coordinates(domain, x, initial_guess, time,
+                                                functions_of_time);
+  REQUIRE(result.size() == expected.size());
+  for (size_t s = 0; s < result.size(); ++s) {
+    CAPTURE(s);
+    CAPTURE(initial_guess[s]);
+    REQUIRE(result[s].has_value() == expected[s].has_value());
+    if (expected[s].has_value()) {
+      CHECK(result[s]->id == expected[s]->id);
+      CHECK_ITERABLE_APPROX(result[s]->data, expected[s]->data);
+    }
+  }
+}
+
+void test_block_logical_coordinates_with_initial_guess() {
+  const auto shell = domain::creators::Sphere(
+      1., 3., domain::creators::Sphere::Excision{}, 0_st, 3_st, true);
+  const auto domain = shell.create_domain();
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<double> radius_dist{1., 3.};
+  std::uniform_real_distribution<double> angle_dist{0., M_PI};
+  const size_t num_points = 200;
+  tnsr::I<DataVector, 3> x{num_points};
+  for (size_t s = 0; s < num_points; ++s) {
+    const double r = radius_dist(gen);
+    const double theta = angle_dist(gen);
+    const double phi = 2. * angle_dist(gen);
+    get<0>(x)[s] = r * cos(phi) * sin(theta);
+    get<1>(x)[s] = r * sin(phi) * sin(theta);
+    get<2>(x)[s] = r * cos(theta);
+  }
+  // The search for many points narrows down the blocks before inverting maps,
+  // which should find the same blocks as trying every block in turn
+  const auto block_logical_coords = block_logical_coordinates(domain, x);
+  for (size_t s = 0; s < num_points; ++s) {
+    CAPTURE(s);
+    const tnsr::I<double, 3> x_point{{{get<0>(x)[s], get<1>(x)[s],
+                                       get<2>(x)[s]}}};
+    for (const auto& block : domain.blocks()) {
+      const auto x_logical =
+          block_logical_coordinates_single_point(x_point, block);
+      if (x_logical.has_value()) {
+        REQUIRE(block_logical_coords[s].has_value());
+        CHECK(block_logical_coords[s]->id.get_index() == block.id());
+        CHECK_ITERABLE_APPROX(block_logical_coords[s]->data, *x_logical);
+        break;
+      }
+    }
+  }
+
+  // Points that moved a little since they were last found. Some may have
+  // moved across block boundaries or out of the domain.
+  auto previous_x = x;
+  get<0>(previous_x) += 0.05;
+  get<2>(previous_x) -= 0.02;
+  auto initial_guess = block_logical_coordinates(domain, previous_x);
+  check_block_logical_coordinates_with_initial_guess(domain, x, initial_guess);
+  // Guesses in the wrong block, or without a block
+  initial_guess[0] = make_id_pair(
+      domain::BlockId((block_logical_coords[0]->id.get_index() + 1) % 6),
+      tnsr::I<double, 3, Frame::BlockLogical>{0.});
+  initial_guess[1] = std::nullopt;
+  check_block_logical_coordinates_with_initial_guess(domain, x, initial_guess);
+  // A point in the excised region
+  get<0>(x)[2] = 0.;
+  get<1>(x)[2] = 0.;
+  get<2>(x)[2] = 0.5;
+  check_block_logical_coordinates_with_initial_guess(domain, x, initial_guess);
+
+  // Points in a translating brick
+  const auto uniform_translation =
+      domain::creators::time_dependence::UniformTranslation<3>(
+          0.0, {{0.1, 0.2, 0.3}});
+  const domain::creators::Brick brick(
+      {{-1., -1., -1.}}, {{1., 1., 1.}}, {{0, 0, 0}}, {{3, 3, 3}},
+      {{false, false, false}}, {}, uniform_translation.get_clone());
+  const auto brick_domain = brick.create_domain();
+  const auto functions_of_time = uniform_translation.functions_of_time();
+  const tnsr::I<DataVector, 3> brick_x{
+      {{{0.1, 0.5, -0.3}, {0.2, -0.7, 1.1}, {0.3, 0.4, 1.25}}}};
+  const auto brick_initial_guess = block_logical_coordinates(
+      brick_domain, brick_x, 0.9, functions_of_time);
+  check_block_logical_coordinates_with_initial_guess(
+      brick_domain, brick_x, brick_initial_guess, 1., functions_of_time);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.BlockAndElementLogicalCoords",
@@ -834,4 +928,5 @@ SPECTRE_TEST_CASE("Unit.Domain.BlockAndElementLogicalCoords",
   test_block_logical_coordinates1fail();
   test_element_ids_are_uniquely_determined();
   test_block_logical_coordinates_with_roundoff_error();
+  test_block_logical_coordinates_with_initial_guess();
 }
@@ -0,0 +1,113 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/BlockSearchTree.hpp"
+#include "Domain/Creators/Rectilinear.hpp"
+#include "Domain/Creators/Sphere.hpp"
+#include "Domain/Creators/TimeDependence/UniformTranslation.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+void test_shell() {
+  const auto shell = domain::creators::Sphere(
+      1.5, 2.5, domain::creators::Sphere::Excision{}, 0_st, 3_st, true);
+  const auto domain = shell.create_domain();
+  const domain::BlockSearchTree<3, Frame::Inertial> search_tree{domain};
+
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<double> radius_dist{1.5, 2.5};
+  std::uniform_real_distribution<double> angle_dist{0., M_PI};
+  std::vector<size_t> candidate_block_ids{};
+  for (size_t i = 0; i < 100; ++i) {
+    const double radius = radius_dist(gen);
+    const double theta = angle_dist(gen);
+    const double phi = 2. * angle_dist(gen);
+    const tnsr::I<double, 3, Frame::Inertial> point{
+        {{radius * sin(theta) * cos(phi), radius * sin(theta) * sin(phi),
+          radius * cos(theta)}}};
+    CAPTURE(point);
+    search_tree.candidate_blocks(make_not_null(&candidate_block_ids), point);
+    CAPTURE(candidate_block_ids);
+    CHECK(std::is_sorted(candidate_block_ids.begin(),
+                         candidate_block_ids.end()));
+    // The candidates narrow down the six wedges of the shell
+    CHECK(candidate_block_ids.size() < 6);
+    for (const auto& block : domain.blocks()) {
+      if (block_logical_coordinates_single_point(point, block).has_value()) {
+        CHECK(std::find(candidate_block_ids.begin(), candidate_block_ids.end(),
+                        block.id()) != candidate_block_ids.end());
+      }
+    }
+  }
+
+  // Points in the excision and outside the shell
+  search_tree.candidate_blocks(
+      make_not_null(&candidate_block_ids),
+      tnsr::I<double, 3, Frame::Inertial>{{{0., 0., 0.}}});
+  CHECK(candidate_block_ids.empty());
+  search_tree.candidate_blocks(
+      make_not_null(&candidate_block_ids),
+      tnsr::I<double, 3, Frame::Inertial>{{{10., 0., 0.}}});
+  CHECK(candidate_block_ids.empty());
+}
+
+void test_time_dependent_brick() {
+  const auto uniform_translation =
+      domain::creators::time_dependence::UniformTranslation<3>(
+          0.0, {{0.1, 0.2, 0.3}});
+  const domain::creators::Brick brick(
+      {{-0.1, -0.2, -0.3}}, {{0.1, 0.2, 0.3}}, {{0, 0, 0}}, {{3, 3, 3}},
+      {{false, false, false}}, {}, uniform_translation.get_clone());
+  const auto domain = brick.create_domain();
+  const auto functions_of_time = uniform_translation.functions_of_time();
+  const tnsr::I<double, 3, Frame::Grid> grid_point{{{0.05, 0.1, -0.2}}};
+  const tnsr::I<double, 3, Frame::Inertial> inertial_point{{{1.05, 2.1, 2.8}}};
+  std::vector<size_t> candidate_block_ids{};
+
+  // The grid frame doesn't move
+  const domain::BlockSearchTree<3, Frame::Grid> grid_search_tree{
+      domain, 10., functions_of_time};
+  grid_search_tree.candidate_blocks(make_not_null(&candidate_block_ids),
+                                    grid_point);
+  CHECK(candidate_block_ids == std::vector<size_t>{0});
+
+  // The inertial boxes are computed at the given time
+  const domain::BlockSearchTree<3, Frame::Inertial> inertial_search_tree{
+      domain, 10., functions_of_time};
+  inertial_search_tree.candidate_blocks(make_not_null(&candidate_block_ids),
+                                        inertial_point);
+  CHECK(candidate_block_ids == std::vector<size_t>{0});
+  const domain::BlockSearchTree<3, Frame::Inertial> initial_search_tree{
+      domain, 0., functions_of_time};
+  initial_search_tree.candidate_blocks(make_not_null(&candidate_block_ids),
+                                       inertial_point);
+  CHECK(candidate_block_ids.empty());
+
+  // The brick has no distorted frame
+  const domain::BlockSearchTree<3, Frame::Distorted> distorted_search_tree{
+      domain, 10., functions_of_time};
+  distorted_search_tree.candidate_blocks(
+      make_not_null(&candidate_block_ids),
+      tnsr::I<double, 3, Frame::Distorted>{{{0.05, 0.1, -0.2}}});
+  CHECK(candidate_block_ids.empty());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.BlockSearchTree", "[Domain][Unit]") {
+  test_shell();
+  test_time_dependent_brick();
+}
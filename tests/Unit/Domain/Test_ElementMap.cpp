@@ -213,6 +213,8 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementMap", "[Unit][Domain]") {
             make_coordinate_map_base<Frame::BlockLogical, Frame::Grid>(
                 block_map)};
         CHECK(element_map(xi) == expected_element_map(xi));
+        CHECK(&element_map.block_map() ==
+              block.element_block_map<Frame::Grid>().get());
       }
       {
         INFO("Inertial frame");
@@ -222,6 +224,8 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementMap", "[Unit][Domain]") {
             make_coordinate_map_base<Frame::BlockLogical, Frame::Inertial>(
                 block_map)};
         CHECK(element_map(xi) == expected_element_map(xi));
+        CHECK(&element_map.block_map() ==
+              block.element_block_map<Frame::Inertial>().get());
       }
     }
     {
@@ -256,6 +260,24 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementMap", "[Unit][Domain]") {
         CHECK(element_map(xi, time, functions_of_time) ==
               expected_element_map(xi, time, functions_of_time));
         CHECK(get<0>(element_map(xi, time, functions_of_time)) == 10.);
+
+        // Elements of the same block share the block map, and own it once
+        // deserialized
+        const ElementMap<1, Frame::Inertial> other_element_map{
+            ElementId<1>{0, {{{2, 1}}}}, block};
+        CHECK(&other_element_map.block_map() == &element_map.block_map());
+        CHECK(&element_map.block_map() ==
+              block.element_block_map<Frame::Inertial>().get());
+        const auto deserialized_element_map =
+            serialize_and_deserialize(element_map);
+        CHECK(&deserialized_element_map.block_map() !=
+              &element_map.block_map());
+        CHECK(deserialized_element_map(xi, time, functions_of_time) ==
+              element_map(xi, time, functions_of_time));
+        const auto deserialized_block = serialize_and_deserialize(block);
+        CHECK(ElementMap<1, Frame::Inertial>{element_id, deserialized_block}(
+                  xi, time, functions_of_time) ==
+              element_map(xi, time, functions_of_time));
       }
     }
   }
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <random>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"
@@ -110,6 +111,27 @@ void test_strahlkorper_in_different_frame() {
                         strahlkorper_dest.physical_center());
   CHECK_ITERABLE_APPROX(strahlkorper_expected->coefficients(),
                         strahlkorper_dest.coefficients());
+
+  if constexpr (not Aligned) {
+    // Transforming a series of surfaces at once gives the same result as
+    // transforming them one at a time
+    const double later_time = 0.6;
+    ylm::Strahlkorper<DestFrame> later_strahlkorper_dest{};
+    strahlkorper_in_different_frame(make_not_null(&later_strahlkorper_dest),
+                                    strahlkorper_src, domain, functions_of_time,
+                                    later_time);
+    std::vector<ylm::Strahlkorper<DestFrame>> strahlkorpers_dest{};
+    strahlkorpers_in_different_frame(
+        make_not_null(&strahlkorpers_dest),
+        std::vector<ylm::Strahlkorper<SrcFrame>>{strahlkorper_src,
+                                                 strahlkorper_src},
+        std::vector<double>{time, later_time}, domain, functions_of_time);
+    REQUIRE(strahlkorpers_dest.size() == 2);
+    CHECK_ITERABLE_APPROX(strahlkorpers_dest[0].coefficients(),
+                          strahlkorper_dest.coefficients());
+    CHECK_ITERABLE_APPROX(strahlkorpers_dest[1].coefficients(),
+                          later_strahlkorper_dest.coefficients());
+  }
 }
 
 template <bool IsTimeDependent, typename SrcFrame>
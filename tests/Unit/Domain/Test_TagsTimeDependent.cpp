@@ -19,6 +19,7 @@
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
 #include "Domain/CoordinateMaps/Tags.hpp"
+#include "Domain/CoordinateMaps/TimeDependent/Rotation.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/Translation.hpp"
 #include "Domain/Creators/Tags/FunctionsOfTime.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
@@ -337,6 +338,51 @@ void test() {
   check_helper(4.5);
 }
 
+void test_uniform_jacobian() {
+  using UniformMap =
+      domain::CoordinateMap<Frame::Grid, Frame::Inertial,
+                            domain::CoordinateMaps::TimeDependent::Rotation<2>,
+                            TranslationMap2d>;
+  const UniformMap grid_to_inertial_map{
+      domain::CoordinateMaps::TimeDependent::Rotation<2>{"Rotation"},
+      TranslationMap2d{"Translation"}};
+  CHECK(grid_to_inertial_map.jacobian_is_spatially_uniform());
+  CHECK_FALSE(
+      create_coord_map<2>("Translation").jacobian_is_spatially_uniform());
+
+  std::unordered_map<std::string,
+                     std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
+      functions_of_time{};
+  functions_of_time["Rotation"] =
+      std::make_unique<domain::FunctionsOfTime::PiecewisePolynomial<2>>(
+          0., std::array<DataVector, 3>{{{0.3}, {1.1}, {-0.2}}}, 5.);
+  functions_of_time["Translation"] =
+      std::make_unique<domain::FunctionsOfTime::PiecewisePolynomial<2>>(
+          0., std::array<DataVector, 3>{{{0.5, -1.}, {1.2, 0.4}, {0., 0.3}}},
+          5.);
+
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<double> dist(-10.0, 10.0);
+  const auto grid_coords = make_with_random_values<
+      tnsr::I<DataVector, 2, Frame::Grid>>(make_not_null(&gen),
+                                           make_not_null(&dist), DataVector(8));
+  const double time = 2.5;
+  domain::Tags::CoordinatesMeshVelocityAndJacobians<2>::type result{};
+  domain::Tags::CoordinatesMeshVelocityAndJacobiansCompute<
+      domain::CoordinateMaps::Tags::CoordinateMap<
+          2, Frame::Grid, Frame::Inertial>>::function(make_not_null(&result),
+                                                      grid_to_inertial_map,
+                                                      grid_coords, time,
+                                                      functions_of_time);
+  REQUIRE(result.has_value());
+  const auto expected = grid_to_inertial_map.coords_frame_velocity_jacobians(
+      grid_coords, time, functions_of_time);
+  CHECK_ITERABLE_APPROX(std::get<0>(*result), std::get<0>(expected));
+  CHECK_ITERABLE_APPROX(std::get<1>(*result), std::get<1>(expected));
+  CHECK_ITERABLE_APPROX(std::get<2>(*result), std::get<2>(expected));
+  CHECK_ITERABLE_APPROX(std::get<3>(*result), std::get<3>(expected));
+}
+
 SPECTRE_TEST_CASE("Unit.Domain.TagsTimeDependent", "[Unit][Actions]") {
   test_tags<1>();
   test_tags<2>();
@@ -349,5 +395,7 @@ SPECTRE_TEST_CASE("Unit.Domain.TagsTimeDependent", "[Unit][Actions]") {
   test<1, false>();
   test<2, false>();
   test<3, false>();
+
+  test_uniform_jacobian();
 }
 }  // namespace
@@ -430,6 +430,8 @@ SPECTRE_TEST_CASE("Unit.Elliptic.SubdomainPreconditioners.MinusLaplacian",
             "  Solver:\n"
             "    ExplicitInverse:\n"
             "      WriteMatrixToFile: None\n"
+            "      SinglePrecision: False\n"
+            "      ShareInverses: None\n"
             "  BoundaryConditions: Auto");
     const auto serialized = serialize_and_deserialize(created);
     const auto cloned = serialized->get_clone();
@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <optional>
+#include <random>
 #include <string>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -20,6 +21,7 @@
 #include "Elliptic/Systems/Xcts/Tags.hpp"
 #include "Framework/CheckWithRandomValues.hpp"
 #include "Framework/SetupLocalPythonEnvironment.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Elliptic/FirstOrderSystem.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
@@ -287,10 +289,59 @@ void test_computers(const DataVector& used_for_size) {
 
 }  // namespace
 
+template <int ConformalMatterScale>
+void test_linearized_hamiltonian_coefficient(const DataVector& used_for_size) {
+  CAPTURE(ConformalMatterScale);
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist(-0.5, 0.5);
+  const auto make_random_scalar = [&generator, &dist, &used_for_size]() {
+    return make_with_random_values<Scalar<DataVector>>(
+        make_not_null(&generator), make_not_null(&dist), used_for_size);
+  };
+  const auto conformal_energy_density = make_random_scalar();
+  const auto extrinsic_curvature_trace = make_random_scalar();
+  const auto longitudinal_shift_over_lapse_square = make_random_scalar();
+  const auto conformal_factor_minus_one = make_random_scalar();
+  const auto conformal_factor_correction = make_random_scalar();
+
+  auto expected = make_with_value<Scalar<DataVector>>(used_for_size, 1.);
+  Xcts::add_linearized_hamiltonian_sources<ConformalMatterScale>(
+      make_not_null(&expected), conformal_energy_density,
+      extrinsic_curvature_trace, conformal_factor_minus_one,
+      conformal_factor_correction);
+  Xcts::add_linearized_distortion_hamiltonian_sources(
+      make_not_null(&expected), longitudinal_shift_over_lapse_square,
+      conformal_factor_minus_one, conformal_factor_correction);
+
+  auto fused = make_with_value<Scalar<DataVector>>(used_for_size, 1.);
+  Xcts::add_linearized_hamiltonian_and_distortion_sources<
+      ConformalMatterScale>(make_not_null(&fused), conformal_energy_density,
+                            extrinsic_curvature_trace,
+                            longitudinal_shift_over_lapse_square,
+                            conformal_factor_minus_one,
+                            conformal_factor_correction);
+  CHECK_ITERABLE_APPROX(fused, expected);
+
+  Scalar<DataVector> coefficient{};
+  Xcts::linearized_hamiltonian_sources_coefficient<ConformalMatterScale>(
+      make_not_null(&coefficient), conformal_energy_density,
+      extrinsic_curvature_trace, longitudinal_shift_over_lapse_square,
+      conformal_factor_minus_one);
+  auto from_coefficient =
+      make_with_value<Scalar<DataVector>>(used_for_size, 1.);
+  Xcts::add_linearized_hamiltonian_sources_from_coefficient(
+      make_not_null(&from_coefficient), coefficient,
+      conformal_factor_correction);
+  CHECK_ITERABLE_APPROX(from_coefficient, expected);
+}
+
 SPECTRE_TEST_CASE("Unit.Elliptic.Systems.Xcts", "[Unit][Elliptic]") {
   pypp::SetupLocalPythonEnvironment local_python_env{"Elliptic/Systems/Xcts"};
   GENERATE_UNINITIALIZED_DATAVECTOR;
   test_equations(dv);
+  test_linearized_hamiltonian_coefficient<0>(dv);
+  test_linearized_hamiltonian_coefficient<6>(dv);
+  test_linearized_hamiltonian_coefficient<8>(dv);
   CHECK_FOR_DATAVECTORS(
       test_computers,
       (Xcts::Equations::Hamiltonian, Xcts::Equations::HamiltonianAndLapse,
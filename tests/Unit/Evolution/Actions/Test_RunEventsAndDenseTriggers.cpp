@@ -553,6 +553,17 @@ void test(const bool time_runs_forward) {
         {{step_center, center_vars},
          {second_trigger, initial_vars + 0.75 * step_size * deriv_vars}});
   }
+
+  // Multiple triggers at the same time share the dense output
+  {
+    MockRuntimeSystem runner{
+        {std::make_unique<TimeSteppers::AdamsBashforth>(1)}};
+    set_up_component(&runner, {{step_center, true, done_time, true},
+                               {step_center, true, done_time, true}});
+    TestCase::check_dense(
+        &runner, true,
+        {{step_center, center_vars}, {step_center, center_vars}});
+  }
 }
 
 namespace test_postprocessors {
@@ -0,0 +1,100 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Evolution/Ader/Predictor.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+void test_linear_ode() {
+  // Solve dq/dt = lambda q for several lambdas at once
+  const DataVector lambda{-1.0, 0.5, 2.0};
+  const DataVector initial_vars{1.0, 2.0, -0.5};
+  const double time_step = 0.05;
+  const size_t num_temporal_points = 6;
+  size_t number_of_evaluations = 0;
+  const auto time_derivative = [&lambda, &number_of_evaluations](
+                                   const gsl::not_null<DataVector*> dt_vars,
+                                   const DataVector& vars,
+                                   const double /*time_offset*/) {
+    *dt_vars = lambda * vars;
+    ++number_of_evaluations;
+  };
+
+  std::vector<DataVector> predicted_vars{};
+  ader::dg::spacetime_predictor<DataVector>(
+      make_not_null(&predicted_vars), initial_vars, time_step,
+      num_temporal_points, time_derivative, 20);
+  CHECK(predicted_vars.size() == num_temporal_points);
+  CHECK(number_of_evaluations == 20 * num_temporal_points);
+
+  Approx custom_approx = Approx::custom().epsilon(1.0e-12).scale(1.0);
+  const DataVector expected_final_vars =
+      initial_vars * exp(lambda * time_step);
+  CHECK_ITERABLE_CUSTOM_APPROX(predicted_vars.back(), expected_final_vars,
+                               custom_approx);
+
+  // The corrector with the time-averaged predictor reproduces the end of the
+  // predictor for linear systems
+  DataVector averaged_vars{};
+  ader::dg::time_average(make_not_null(&averaged_vars), predicted_vars);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      DataVector(initial_vars + time_step * lambda * averaged_vars),
+      predicted_vars.back(), custom_approx);
+  const DataVector expected_averaged_vars =
+      initial_vars * (exp(lambda * time_step) - 1.0) / (lambda * time_step);
+  CHECK_ITERABLE_CUSTOM_APPROX(averaged_vars, expected_averaged_vars,
+                               custom_approx);
+
+  // Each iteration gains one order of accuracy
+  const auto error_after = [&](const size_t iterations, const double dt) {
+    std::vector<DataVector> local_predicted_vars{};
+    ader::dg::spacetime_predictor<DataVector>(
+        make_not_null(&local_predicted_vars), initial_vars, dt,
+        num_temporal_points, time_derivative, iterations);
+    return max(abs(local_predicted_vars.back() -
+                   initial_vars * exp(lambda * dt)));
+  };
+  for (size_t iterations = 1; iterations < 4; ++iterations) {
+    CAPTURE(iterations);
+    const double convergence_order =
+        log2(error_after(iterations, 0.02) / error_after(iterations, 0.01));
+    CHECK(convergence_order > static_cast<double>(iterations) + 0.5);
+  }
+}
+
+void test_time_dependent_source() {
+  // dq/dt = cos(t), with the time offset from the start of the step
+  const double time_step = 0.1;
+  std::vector<DataVector> predicted_vars{};
+  ader::dg::spacetime_predictor<DataVector>(
+      make_not_null(&predicted_vars), DataVector{1, 0.0}, time_step, 8,
+      [](const gsl::not_null<DataVector*> dt_vars, const DataVector& vars,
+         const double time_offset) {
+        *dt_vars = DataVector{vars.size(), cos(time_offset)};
+      },
+      2);
+  const DataVector& temporal_points =
+      Spectral::collocation_points<Spectral::Basis::Legendre,
+                                   Spectral::Quadrature::GaussLobatto>(8);
+  Approx custom_approx = Approx::custom().epsilon(1.0e-10).scale(1.0);
+  for (size_t a = 0; a < 8; ++a) {
+    CHECK(predicted_vars[a][0] ==
+          custom_approx(sin(0.5 * (1.0 + temporal_points[a]) * time_step)));
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Ader.Dg.Predictor", "[Unit][Ader]") {
+  test_linear_ode();
+  test_time_dependent_source();
+}
@@ -0,0 +1,119 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "Evolution/Deadlock/Heartbeat.hpp"
+#include "Evolution/Deadlock/HeartbeatRegistration.hpp"
+#include "Framework/TestHelpers.hpp"
+
+namespace {
+void test_heartbeat() {
+  using Heartbeat = deadlock::Heartbeat<size_t>;
+  Heartbeat heartbeat{};
+  CHECK(heartbeat.stalled_elements(0.0).empty());
+  CHECK_FALSE(heartbeat.report(0.0).has_value());
+
+  // Element 0 takes 1s per step, element 1 takes 30s per step
+  for (size_t step = 0; step < 4; ++step) {
+    heartbeat.beat(0, 0.1 * static_cast<double>(step), 0,
+                   static_cast<double>(step));
+    heartbeat.pause(0, static_cast<double>(step) + 1.0);
+    heartbeat.beat(1, 0.1 * static_cast<double>(step), 2,
+                   30.0 * static_cast<double>(step));
+    heartbeat.pause(1, 30.0 * static_cast<double>(step) + 30.0);
+  }
+  heartbeat.beat(0, 0.4, 0, 4.0);
+  heartbeat.beat(1, 0.4, 2, 120.0);
+  const auto stats = heartbeat.statistics();
+  CHECK(stats.number_of_elements == 2);
+  CHECK(stats.earliest_time == approx(0.4));
+  CHECK(stats.latest_time == approx(0.4));
+  REQUIRE(stats.slowest_element.has_value());
+  CHECK(*stats.slowest_element == 1);
+  CHECK(stats.slowest_average_step_wall_time == approx(30.0));
+
+  // Element 0 stalls after the minimum stall time, element 1 after 20 of its
+  // steps
+  CHECK(heartbeat.stalled_elements(300.0).empty());
+  const auto stalled = heartbeat.stalled_elements(400.0);
+  REQUIRE(stalled.size() == 1);
+  CHECK(stalled[0].first == 0);
+  CHECK(stalled[0].second.inbox_size == 0);
+  CHECK(heartbeat.stalled_elements(800.0).size() == 2);
+
+  const auto report = heartbeat.report(400.0);
+  REQUIRE(report.has_value());
+  CHECK(report->find("1 of 2 elements stalled") != std::string::npos);
+  CHECK(report->find("Element 0 at time") != std::string::npos);
+  // Stalled elements are reported once
+  CHECK_FALSE(heartbeat.report(500.0).has_value());
+  const auto second_report = heartbeat.report(800.0);
+  REQUIRE(second_report.has_value());
+  CHECK(second_report->find("Element 1 at time") != std::string::npos);
+  CHECK(second_report->find("Element 0 at time") == std::string::npos);
+
+  // A new beat resets the stall
+  heartbeat.beat(0, 0.5, 1, 801.0);
+  CHECK(heartbeat.stalled_elements(802.0).size() == 1);
+  CHECK_FALSE(heartbeat.report(802.0).has_value());
+
+  // Paused elements, e.g. elements that halted for a phase change, are not
+  // monitored
+  heartbeat.pause(0, 802.0);
+  heartbeat.pause(1, 802.0);
+  CHECK(heartbeat.stalled_elements(1.0e5).empty());
+  CHECK_FALSE(heartbeat.report(1.0e5).has_value());
+  // Pausing twice has no effect on the average
+  heartbeat.pause(0, 1.0e5);
+  CHECK(heartbeat.statistics().slowest_average_step_wall_time < 1.0e3);
+
+  // Forgotten elements, e.g. elements removed by AMR, are not monitored and
+  // don't enter the statistics
+  heartbeat.beat(1, 0.6, 0, 1.0e5);
+  heartbeat.forget(0);
+  heartbeat.forget(1);
+  heartbeat.forget(2);
+  CHECK(heartbeat.statistics().number_of_elements == 0);
+  CHECK(heartbeat.stalled_elements(1.0e6).empty());
+}
+
+void test_registration() {
+  auto& heartbeat = deadlock::Heartbeat<size_t>::local();
+  heartbeat.beat(3, 1.0, 0, 0.0);
+  heartbeat.beat(4, 1.0, 0, 0.0);
+  {
+    deadlock::HeartbeatRegistration registration{};
+    CHECK_FALSE(registration.is_registered());
+    registration.register_element(size_t{3});
+    CHECK(registration.is_registered());
+
+    // Copies, e.g. of the items of a parent that AMR sends to its children,
+    // and deserialized registrations are not registered
+    const auto copy = registration;
+    CHECK_FALSE(copy.is_registered());
+    CHECK_FALSE(serialize_and_deserialize(registration).is_registered());
+
+    auto moved = std::move(registration);
+    CHECK(moved.is_registered());
+    CHECK(heartbeat.statistics().number_of_elements == 2);
+
+    deadlock::HeartbeatRegistration other{};
+    other.register_element(size_t{4});
+    // Assigning releases the registration
+    other = deadlock::HeartbeatRegistration{};
+    CHECK_FALSE(other.is_registered());
+    CHECK(heartbeat.statistics().number_of_elements == 1);
+  }
+  CHECK(heartbeat.statistics().number_of_elements == 0);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Deadlock.Heartbeat", "[Unit][Evolution]") {
+  test_heartbeat();
+  test_registration();
+}
@@ -41,6 +41,7 @@
 #include "Evolution/DgSubcell/Tags/GhostDataForReconstruction.hpp"
 #include "Evolution/DgSubcell/Tags/Jacobians.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
+#include "Evolution/DgSubcell/Tags/RdmpProjections.hpp"
 #include "Evolution/DgSubcell/Tags/ReconstructionOrder.hpp"
 #include "Evolution/DgSubcell/Tags/StepsSinceTciCall.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
@@ -556,6 +557,12 @@ void test(const bool always_use_subcell, const bool interior_element,
   CHECK(ActionTesting::get_databox_tag<
             comp, evolution::dg::subcell::Tags::StepsSinceTciCall>(
             runner, self_id) == 0);
+  CHECK(ActionTesting::get_databox_tag<
+            comp, evolution::dg::subcell::Tags::RdmpProjectionsEvaluated>(
+            runner, self_id) == 0);
+  CHECK(ActionTesting::get_databox_tag<
+            comp, evolution::dg::subcell::Tags::RdmpProjectionsSkipped>(
+            runner, self_id) == 0);
   CHECK(ActionTesting::get_databox_tag<
             comp, evolution::dg::subcell::Tags::NeighborTciDecisions<Dim>>(
             runner, self_id)
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <deque>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -37,6 +38,7 @@
 #include "Evolution/DgSubcell/Tags/DataForRdmpTci.hpp"
 #include "Evolution/DgSubcell/Tags/GhostDataForReconstruction.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
+#include "Evolution/DgSubcell/Tags/RdmpProjections.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciGridHistory.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
@@ -105,6 +107,8 @@ struct component {
           evolution::dg::subcell::Tags::DidRollback,
           evolution::dg::subcell::Tags::GhostDataForReconstruction<Dim>,
           evolution::dg::subcell::Tags::TciDecision,
+          evolution::dg::subcell::Tags::RdmpProjectionsEvaluated,
+          evolution::dg::subcell::Tags::RdmpProjectionsSkipped,
           evolution::dg::subcell::Tags::DataForRdmpTci,
           domain::Tags::NeighborMesh<Dim>, ::Tags::Variables<tmpl::list<Var1>>,
           ::Tags::HistoryEvolvedVariables<::Tags::Variables<tmpl::list<Var1>>>,
@@ -147,6 +151,8 @@ struct Metavariables {
   static bool tci_invoked;
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
   static bool expected_evolve_on_dg_after_tci_failure;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static bool expected_rdmp_needs_projection;
 
   struct SubcellOptions {
     static constexpr bool subcell_enabled_at_external_boundary = false;
@@ -166,29 +172,37 @@ struct Metavariables {
         const evolution::dg::subcell::RdmpTciData& past_rdmp_data,
         const evolution::dg::subcell::SubcellOptions& subcell_options,
         const double persson_exponent,
-        const bool evolve_on_dg_after_tci_failure) {
+        const bool evolve_on_dg_after_tci_failure,
+        const bool rdmp_needs_projection) {
       // match with global static variable in metavariables
 
       // assign value of passed in variable
       using metavars = Metavariables<Dim, HasPrims>;
 
-      Variables<tmpl::list<Var1>> projected_vars{
-          subcell_mesh.number_of_grid_points()};
-      evolution::dg::subcell::fd::project(
-          make_not_null(&projected_vars), dg_vars, dg_mesh,
-          evolution::dg::subcell::fd::mesh(dg_mesh).extents());
       // Set RDMP TCI data
       using std::max;
       using std::min;
       evolution::dg::subcell::RdmpTciData rdmp_data{};
-      rdmp_data.max_variables_values = DataVector{max(
-          max(get(get<Var1>(dg_vars))), max(get(get<Var1>(projected_vars))))};
-      rdmp_data.min_variables_values = DataVector{min(
-          min(get(get<Var1>(dg_vars))), min(get(get<Var1>(projected_vars))))};
+      rdmp_data.max_variables_values = DataVector{max(get(get<Var1>(dg_vars)))};
+      rdmp_data.min_variables_values = DataVector{min(get(get<Var1>(dg_vars)))};
+      if (rdmp_needs_projection) {
+        Variables<tmpl::list<Var1>> projected_vars{
+            subcell_mesh.number_of_grid_points()};
+        evolution::dg::subcell::fd::project(
+            make_not_null(&projected_vars), dg_vars, dg_mesh,
+            evolution::dg::subcell::fd::mesh(dg_mesh).extents());
+        rdmp_data.max_variables_values[0] =
+            max(rdmp_data.max_variables_values[0],
+                max(get(get<Var1>(projected_vars))));
+        rdmp_data.min_variables_values[0] =
+            min(rdmp_data.min_variables_values[0],
+                min(get(get<Var1>(projected_vars))));
+      }
 
       CHECK(approx(persson_exponent) == 4.0);
       CHECK(evolve_on_dg_after_tci_failure ==
             metavars::expected_evolve_on_dg_after_tci_failure);
+      CHECK(rdmp_needs_projection == metavars::expected_rdmp_needs_projection);
       tci_invoked = true;
       const bool rdmp_result =
           static_cast<bool>(evolution::dg::subcell::rdmp_tci(
@@ -215,6 +229,9 @@ template <size_t Dim, bool HasPrims>
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 bool Metavariables<Dim, HasPrims>::expected_evolve_on_dg_after_tci_failure =
     false;
+template <size_t Dim, bool HasPrims>
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+bool Metavariables<Dim, HasPrims>::expected_rdmp_needs_projection = true;
 
 template <size_t Dim>
 Element<Dim> create_element(const bool with_neighbors) {
@@ -256,7 +273,8 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
                const bool always_use_subcell, const bool self_starting,
                const bool with_neighbors, const bool use_halo,
                const bool neighbor_is_troubled,
-               const bool disable_subcell_in_block) {
+               const bool disable_subcell_in_block,
+               const bool use_projection_threshold = false) {
   CAPTURE(Dim);
   CAPTURE(rdmp_fails);
   CAPTURE(tci_fails);
@@ -266,6 +284,7 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
   CAPTURE(use_halo);
   CAPTURE(neighbor_is_troubled);
   CAPTURE(disable_subcell_in_block);
+  CAPTURE(use_projection_threshold);
 
   using Interps = DirectionalIdMap<Dim, std::optional<intrp::Irregular<Dim>>>;
   using metavars = Metavariables<Dim, HasPrims>;
@@ -285,7 +304,9 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
               disable_subcell_in_block
                   ? std::optional{std::vector<std::string>{"Block1"}}
                   : std::optional<std::vector<std::string>>{},
-              ::fd::DerivativeOrder::Two, 1, 1, 1},
+              ::fd::DerivativeOrder::Two, 1, 1, 1,
+              use_projection_threshold ? std::optional{1.0e-3}
+                                       : std::optional<double>{}},
           TestCreator<Dim>{}};
 
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
@@ -345,6 +366,9 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
   // assign value of passed in variable.  Used as a test in apply() above
   metavars::expected_evolve_on_dg_after_tci_failure =
       bordering_dg_block or self_block_dg_only;
+  // Var1 is linear unless the RDMP fails, so its highest mode vanishes.
+  metavars::expected_rdmp_needs_projection =
+      not use_projection_threshold or rdmp_fails;
 
   const int tci_decision{-1};
 
@@ -413,7 +437,8 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
         &runner, ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{0}, 0,
         {std::make_unique<DummyReconstructor>(), time_step_id, dg_mesh,
          subcell_mesh, element, active_grid, did_rollback, ghost_data,
-         tci_decision, rdmp_tci_data, neighbor_meshes, evolved_vars,
+         tci_decision, 0_st, 0_st, rdmp_tci_data, neighbor_meshes,
+         evolved_vars,
          time_stepper_history, initial_value_evolved_vars, neighbor_decisions,
          Interps{}, prim_vars, initial_value_prim_vars});
   } else {
@@ -423,7 +448,8 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
         &runner, ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{0}, 0,
         {std::make_unique<DummyReconstructor>(), time_step_id, dg_mesh,
          subcell_mesh, element, active_grid, did_rollback, ghost_data,
-         tci_decision, rdmp_tci_data, neighbor_meshes, evolved_vars,
+         tci_decision, 0_st, 0_st, rdmp_tci_data, neighbor_meshes,
+         evolved_vars,
          time_stepper_history, initial_value_evolved_vars, neighbor_decisions,
          Interps{}});
   }
@@ -538,14 +564,20 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
     CHECK(active_grid_from_box == evolution::dg::subcell::ActiveGrid::Dg);
     CHECK_FALSE(did_rollback_from_box);
 
-    const auto subcell_vars = evolution::dg::subcell::fd::project(
-        evolved_vars, dg_mesh,
-        evolution::dg::subcell::fd::mesh(dg_mesh).extents());
-    const evolution::dg::subcell::RdmpTciData expected_rdmp_data{
-        {std::max(max(get(get<Var1>(evolved_vars))),
-                  max(get(get<Var1>(subcell_vars))))},
-        {std::min(min(get(get<Var1>(evolved_vars))),
-                  min(get(get<Var1>(subcell_vars))))}};
+    evolution::dg::subcell::RdmpTciData expected_rdmp_data{
+        {max(get(get<Var1>(evolved_vars)))},
+        {min(get(get<Var1>(evolved_vars)))}};
+    if (metavars::expected_rdmp_needs_projection) {
+      const auto subcell_vars = evolution::dg::subcell::fd::project(
+          evolved_vars, dg_mesh,
+          evolution::dg::subcell::fd::mesh(dg_mesh).extents());
+      expected_rdmp_data.max_variables_values[0] =
+          std::max(expected_rdmp_data.max_variables_values[0],
+                   max(get(get<Var1>(subcell_vars))));
+      expected_rdmp_data.min_variables_values[0] =
+          std::min(expected_rdmp_data.min_variables_values[0],
+                   min(get(get<Var1>(subcell_vars))));
+    }
 
     CHECK(ActionTesting::get_databox_tag<
               comp, evolution::dg::subcell::Tags::DataForRdmpTci>(runner, 0) ==
@@ -585,6 +617,14 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
   CHECK(ActionTesting::get_databox_tag<
             comp, evolution::dg::subcell::Tags::TciDecision>(runner, 0) ==
         (metavars::tci_invoked ? (rdmp_fails ? 10 : (tci_fails ? 5 : 0)) : -1));
+  CHECK(ActionTesting::get_databox_tag<
+            comp, evolution::dg::subcell::Tags::RdmpProjectionsEvaluated>(
+            runner, 0) ==
+        (metavars::expected_rdmp_needs_projection ? 1_st : 0_st));
+  CHECK(ActionTesting::get_databox_tag<
+            comp, evolution::dg::subcell::Tags::RdmpProjectionsSkipped>(
+            runner, 0) ==
+        (metavars::expected_rdmp_needs_projection ? 0_st : 1_st));
 }
 
 template <size_t Dim>
@@ -603,6 +643,14 @@ void test() {
                           self_starting, have_neighbors, use_halo,
                           neighbor_is_troubled, disable_subcell_in_block);
   }
+  // Only project to the subcells for the RDMP TCI if the candidate solution
+  // isn't smooth.
+  for (const auto& [rdmp_fails, tci_fails, have_neighbors] :
+       cartesian_product(make_array(false, true), make_array(false, true),
+                         make_array(false, true))) {
+    test_impl<Dim, false>(rdmp_fails, tci_fails, false, false, have_neighbors,
+                          false, false, false, true);
+  }
 }
 
 // [[TimeOut, 10]]
@@ -612,6 +660,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Actions.TciAndRollback",
   // 1. Test RDMP passes/fails (check TciMutator not called on failure)
   // 2. Test always_use_subcells
   // 3. Test TciMutator passes/fails
+  // 4. Test the projection for the RDMP TCI is skipped for smooth solutions
   //
   // Below is a list of quantities to verify were handled/set correctly by the
   // action:
@@ -0,0 +1,80 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/DgSubcell/HighestModesIndicator.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+
+namespace {
+template <size_t Dim>
+void test(const size_t num_pts_1d) {
+  CAPTURE(Dim);
+  CAPTURE(num_pts_1d);
+  const Mesh<Dim> dg_mesh{num_pts_1d, Spectral::Basis::Legendre,
+                          Spectral::Quadrature::GaussLobatto};
+  const auto logical_coords = logical_coordinates(dg_mesh);
+  const auto basis_function = [&logical_coords](const size_t mode,
+                                                const size_t d) {
+    return Spectral::compute_basis_function_value<Spectral::Basis::Legendre>(
+        mode, logical_coords.get(d));
+  };
+  DataVector smooth{dg_mesh.number_of_grid_points(), 2.0};
+  for (size_t d = 0; d < Dim; ++d) {
+    smooth += basis_function(1, d);
+  }
+  // The number of lines of grid points through the element along any
+  // dimension
+  const double number_of_lines =
+      static_cast<double>(dg_mesh.number_of_grid_points() / num_pts_1d);
+
+  CHECK(evolution::dg::subcell::highest_modes_indicator(
+            DataVector{dg_mesh.number_of_grid_points(), 0.0}, dg_mesh, 1) ==
+        0.0);
+  for (const size_t num_highest_modes : {1_st, 2_st}) {
+    CHECK(evolution::dg::subcell::highest_modes_indicator(
+              smooth, dg_mesh, num_highest_modes) == approx(0.0));
+  }
+
+  for (size_t d = 0; d < Dim; ++d) {
+    CAPTURE(d);
+    const DataVector highest_mode_excited =
+        smooth + 0.05 * basis_function(num_pts_1d - 1, d);
+    const double expected_highest =
+        0.05 * sqrt(number_of_lines) / l2Norm(highest_mode_excited);
+    CHECK(evolution::dg::subcell::highest_modes_indicator(
+              highest_mode_excited, dg_mesh, 1) == approx(expected_highest));
+    CHECK(evolution::dg::subcell::highest_modes_indicator(
+              highest_mode_excited, dg_mesh, 2) == approx(expected_highest));
+
+    // Only the second highest mode is excited, so only an indicator looking at
+    // the two highest modes sees it.
+    const DataVector second_highest_mode_excited =
+        smooth + 0.05 * basis_function(num_pts_1d - 2, d);
+    CHECK(evolution::dg::subcell::highest_modes_indicator(
+              second_highest_mode_excited, dg_mesh, 1) == approx(0.0));
+    CHECK(evolution::dg::subcell::highest_modes_indicator(
+              second_highest_mode_excited, dg_mesh, 2) ==
+          approx(0.05 * sqrt(number_of_lines) /
+                 l2Norm(second_highest_mode_excited)));
+  }
+}
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.HighestModesIndicator",
+                  "[Evolution][Unit]") {
+  for (size_t num_pts_1d = 4; num_pts_1d < 8; ++num_pts_1d) {
+    test<1>(num_pts_1d);
+    test<2>(num_pts_1d);
+    test<3>(num_pts_1d);
+  }
+}
+}  // namespace
@@ -5,7 +5,9 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
+#include <functional>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -229,6 +231,58 @@ void reconstruction_matrix(const double eps) {
   }
 }
 
+template <size_t MaxPts, size_t Dim, Spectral::Quadrature QuadratureType>
+void reconstruction_matrix_factors() {
+  CAPTURE(Dim);
+  CAPTURE(QuadratureType);
+  for (size_t num_pts_1d = std::max(
+           static_cast<size_t>(2),
+           Spectral::minimum_number_of_points<Spectral::Basis::Legendre,
+                                              QuadratureType>);
+       num_pts_1d < MaxPts + 1; ++num_pts_1d) {
+    CAPTURE(num_pts_1d);
+    const Mesh<Dim> dg_mesh{num_pts_1d, Spectral::Basis::Legendre,
+                            QuadratureType};
+    const Index<Dim> subcell_extents{2 * num_pts_1d - 1};
+    DataVector subcell_values{subcell_extents.product()};
+    for (size_t i = 0; i < subcell_values.size(); ++i) {
+      subcell_values[i] = sin(0.7 * static_cast<double>(i)) + 2.0;
+    }
+
+    const Matrix& recons =
+        subcell::fd::reconstruction_matrix(dg_mesh, subcell_extents);
+    DataVector expected(dg_mesh.number_of_grid_points());
+    dgemv_('N', recons.rows(), recons.columns(), 1.0, recons.data(),
+           recons.spacing(), subcell_values.data(), 1, 0.0, expected.data(),
+           1);
+
+    // Apply the factors dimension by dimension
+    const Matrix empty{};
+    auto least_squares = make_array<Dim>(std::cref(empty));
+    auto constraint_correction = make_array<Dim>(std::cref(empty));
+    auto dg_weights = make_array<Dim>(std::cref(empty));
+    auto subcell_weights = make_array<Dim>(std::cref(empty));
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto& factors = subcell::fd::reconstruction_matrix_factors(
+          dg_mesh.slice_through(d), subcell_extents[d]);
+      gsl::at(least_squares, d) = std::cref(factors.least_squares);
+      gsl::at(constraint_correction, d) =
+          std::cref(factors.constraint_correction);
+      gsl::at(dg_weights, d) = std::cref(factors.dg_weights);
+      gsl::at(subcell_weights, d) = std::cref(factors.subcell_weights);
+    }
+    DataVector reconstructed =
+        apply_matrices(least_squares, subcell_values, subcell_extents);
+    const double residual =
+        apply_matrices(subcell_weights, subcell_values, subcell_extents)[0] -
+        apply_matrices(dg_weights, reconstructed, dg_mesh.extents())[0];
+    reconstructed += residual * apply_matrices(constraint_correction,
+                                               DataVector{1.0}, Index<Dim>{1});
+    Approx local_approx = Approx::custom().epsilon(1.0e-10).scale(1.);
+    CHECK_ITERABLE_CUSTOM_APPROX(reconstructed, expected, local_approx);
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Fd.ProjectionMatrix",
                   "[Evolution][Unit]") {
   test_projection_matrix<10, 1, Spectral::Basis::Legendre,
@@ -284,6 +338,13 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Fd.ReconstructionMatrix",
                         Spectral::Quadrature::GaussLobatto>(1.0e-11);
   reconstruction_matrix<4, 3, Spectral::Basis::Legendre,
                         Spectral::Quadrature::Gauss>(1.0e-11);
+
+  reconstruction_matrix_factors<10, 1, Spectral::Quadrature::GaussLobatto>();
+  reconstruction_matrix_factors<10, 1, Spectral::Quadrature::Gauss>();
+  reconstruction_matrix_factors<8, 2, Spectral::Quadrature::GaussLobatto>();
+  reconstruction_matrix_factors<8, 2, Spectral::Quadrature::Gauss>();
+  reconstruction_matrix_factors<5, 3, Spectral::Quadrature::GaussLobatto>();
+  reconstruction_matrix_factors<4, 3, Spectral::Quadrature::Gauss>();
 }
 }  // namespace
 }  // namespace evolution::dg::subcell::fd
@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -115,6 +116,15 @@ void test_impl(const std::vector<double>& expected_values,
                   expected_values[0], static_cast<size_t>(expected_values[1]),
                   expected_values[2], expected_values[3], false, recons_method,
                   false, std::nullopt, ::fd::DerivativeOrder::Two, 1, 1, 1));
+  CHECK_FALSE(SubcellOptions(
+                  expected_values[0], static_cast<size_t>(expected_values[1]),
+                  expected_values[2], expected_values[3], false, recons_method,
+                  false, std::nullopt, ::fd::DerivativeOrder::Two, 1, 1, 1,
+                  1.0e-3) ==
+              SubcellOptions(
+                  expected_values[0], static_cast<size_t>(expected_values[1]),
+                  expected_values[2], expected_values[3], false, recons_method,
+                  false, std::nullopt, ::fd::DerivativeOrder::Two, 1, 1, 1));
 }
 
 SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
@@ -129,7 +139,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
       expected_values[0], static_cast<size_t>(expected_values[1]),
       expected_values[2], expected_values[3], true,
       fd::ReconstructionMethod::DimByDim, true, std::nullopt,
-      ::fd::DerivativeOrder::Four, 1, 1, 1);
+      ::fd::DerivativeOrder::Four, 1, 1, 1, 1.0e-3);
+  CHECK(options.rdmp_projection_threshold() == std::optional{1.0e-3});
   const SubcellOptions deserialized_options =
       serialize_and_deserialize(options);
   CHECK(options == deserialized_options);
@@ -142,6 +153,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
                        "  RdmpTci:\n"
                        "    Delta0: 2.0e-3\n"
                        "    Epsilon: 2.0e-4\n"
+                       "    ProjectionThreshold: 1.0e-3\n"
                        "  FdToDgTci:\n"
                        "    NumberOfStepsBetweenTciCalls: 1\n"
                        "    MinTciCallsAfterRollback: 1\n"
@@ -163,6 +175,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
       "  RdmpTci:\n"
       "    Delta0: 2.0e-3\n"
       "    Epsilon: 2.0e-4\n"
+      "    ProjectionThreshold: None\n"
       "  FdToDgTci:\n"
       "    NumberOfStepsBetweenTciCalls: 1\n"
       "    MinTciCallsAfterRollback: 1\n"
@@ -37,6 +37,7 @@
 #include "Evolution/DgSubcell/Tags/ObserverMeshVelocity.hpp"
 #include "Evolution/DgSubcell/Tags/OnSubcellFaces.hpp"
 #include "Evolution/DgSubcell/Tags/OnSubcells.hpp"
+#include "Evolution/DgSubcell/Tags/RdmpProjections.hpp"
 #include "Evolution/DgSubcell/Tags/ReconstructionOrder.hpp"
 #include "Evolution/DgSubcell/Tags/Reconstructor.hpp"
 #include "Evolution/DgSubcell/Tags/StepsSinceTciCall.hpp"
@@ -122,6 +123,10 @@ void test(const bool moving_mesh) {
       "TciCallsSinceRollback");
   TestHelpers::db::test_simple_tag<subcell::Tags::StepsSinceTciCall>(
       "StepsSinceTciCall");
+  TestHelpers::db::test_simple_tag<subcell::Tags::RdmpProjectionsEvaluated>(
+      "RdmpProjectionsEvaluated");
+  TestHelpers::db::test_simple_tag<subcell::Tags::RdmpProjectionsSkipped>(
+      "RdmpProjectionsSkipped");
 
   TestHelpers::db::test_compute_tag<
       subcell::Tags::LogicalCoordinatesCompute<Dim>>(
@@ -165,6 +170,9 @@ void test(const bool moving_mesh) {
       "Variables(DetInvJacobian(Grid,Inertial),Jacobian(Grid,Inertial))");
   TestHelpers::db::test_compute_tag<subcell::Tags::TciStatusCompute<Dim>>(
       "TciStatus");
+  TestHelpers::db::test_compute_tag<
+      subcell::Tags::SkippedRdmpProjectionFractionCompute<Dim>>(
+      "SkippedRdmpProjectionFraction");
   TestHelpers::db::test_compute_tag<subcell::Tags::MethodOrderCompute<Dim>>(
       "MethodOrder");
   TestHelpers::db::test_compute_tag<
@@ -197,6 +205,8 @@ void test(const bool moving_mesh) {
                         domain::Tags::FunctionsOfTimeInitialize, ::Tags::Time,
                         ::domain::Tags::Mesh<Dim>, subcell::Tags::ActiveGrid,
                         subcell::Tags::TciDecision,
+                        subcell::Tags::RdmpProjectionsEvaluated,
+                        subcell::Tags::RdmpProjectionsSkipped,
                         subcell::Tags::ReconstructionOrder<Dim>,
                         subcell::Tags::SubcellOptions<Dim>>,
       db::AddComputeTags<
@@ -240,6 +250,7 @@ void test(const bool moving_mesh) {
           subcell::Tags::ObserverJacobianAndDetInvJacobianCompute<
               Dim, Frame::Grid, Frame::Inertial>,
           subcell::Tags::TciStatusCompute<Dim>,
+          subcell::Tags::SkippedRdmpProjectionFractionCompute<Dim>,
           subcell::Tags::MethodOrderCompute<Dim>,
           subcell::Tags::ObserverMeshVelocityCompute<Dim>>>(
       ElementMap<Dim, Frame::Grid>{
@@ -247,7 +258,8 @@ void test(const bool moving_mesh) {
           domain::make_coordinate_map_base<Frame::BlockLogical, Frame::Grid>(
               domain::CoordinateMaps::Identity<Dim>{})},
       grid_to_inertial_map->get_clone(), clone_unique_ptrs(functions_of_time),
-      time, dg_mesh, subcell::ActiveGrid::Dg, tci_decision, ReconsOrder{},
+      time, dg_mesh, subcell::ActiveGrid::Dg, tci_decision, 3_st, 1_st,
+      ReconsOrder{},
       evolution::dg::subcell::SubcellOptions{
           4.0,
           1_st,
@@ -355,6 +367,9 @@ void test(const bool moving_mesh) {
     CHECK(db::get<subcell::Tags::TciStatus>(active_coords_box) ==
           Scalar<DataVector>(expected_mesh.number_of_grid_points(),
                              static_cast<double>(tci_decision)));
+    CHECK(db::get<subcell::Tags::SkippedRdmpProjectionFraction>(
+              active_coords_box) ==
+          Scalar<DataVector>(expected_mesh.number_of_grid_points(), 0.25));
     if (db::get<subcell::Tags::ActiveGrid>(active_coords_box) ==
         subcell::ActiveGrid::Dg) {
       REQUIRE(db::get<subcell::Tags::MethodOrder<Dim>>(active_coords_box)
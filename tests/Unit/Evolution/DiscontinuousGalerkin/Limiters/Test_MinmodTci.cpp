@@ -550,6 +550,23 @@ void test_tvb_minmod_tci_several_tensors() {
   CHECK(trigger_vector_z);
 }
 
+void test_thread_local_buffer() {
+  INFO("Testing thread-local buffer reuse");
+  const Mesh<2> mesh(3, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto);
+  const auto& buffer = Limiters::Minmod_detail::thread_local_buffer(mesh);
+  CHECK(&Limiters::Minmod_detail::thread_local_buffer(mesh) == &buffer);
+  CHECK(buffer.boundary_buffers[0].size() == 3);
+  CHECK(buffer.boundary_buffers[1].size() == 3);
+
+  const Mesh<2> other_mesh({{4, 5}}, Spectral::Basis::Legendre,
+                           Spectral::Quadrature::GaussLobatto);
+  const auto& other_buffer =
+      Limiters::Minmod_detail::thread_local_buffer(other_mesh);
+  CHECK(other_buffer.boundary_buffers[0].size() == 5);
+  CHECK(other_buffer.boundary_buffers[1].size() == 4);
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.MinmodTci", "[Limiters][Unit]") {
@@ -558,4 +575,6 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.MinmodTci", "[Limiters][Unit]") {
   test_tvb_minmod_tci_3d();
 
   test_tvb_minmod_tci_several_tensors();
+
+  test_thread_local_buffer();
 }
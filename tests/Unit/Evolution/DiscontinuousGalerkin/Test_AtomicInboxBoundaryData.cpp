@@ -5,12 +5,20 @@
 
 #include <atomic>
 #include <cstddef>
+#include <utility>
 
+#include "DataStructures/DataVector.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionalId.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Evolution/DiscontinuousGalerkin/AtomicInboxBoundaryData.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
 #include "Framework/TestHelpers.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace evolution::dg {
 namespace {
@@ -173,12 +181,49 @@ void test_serialization() {
   check_all_empty(data_map_out.at(0));
 }
 
+// Sends between elements on the same node must hand the sender's buffers to
+// the receiver rather than copy them, since the face data is the bulk of the
+// per-step memory traffic.
+template <size_t Dim>
+void test_insert_transfers_ownership() {
+  using inbox_tag = Tags::BoundaryCorrectionAndGhostCellsInbox<Dim, true>;
+  AtomicInboxBoundaryData<Dim> inbox{};
+  const TimeStepId time_step_id{true, 0, Slab{0.0, 1.0}.start()};
+  const DirectionalId<Dim> neighbor_id{Direction<Dim>::lower_xi(),
+                                       ElementId<Dim>{0}};
+
+  BoundaryData<Dim> data{};
+  data.ghost_cell_data = DataVector(12, 1.0);
+  data.boundary_correction_data = DataVector(7, 2.0);
+  const double* const ghost_cell_ptr = data.ghost_cell_data->data();
+  const double* const boundary_correction_ptr =
+      data.boundary_correction_data->data();
+
+  CHECK(inbox_tag::insert_into_inbox(make_not_null(&inbox), time_step_id,
+                                     std::make_pair(neighbor_id,
+                                                    std::move(data))) == 1);
+  auto& queue = gsl::at(inbox.boundary_data_in_directions,
+                        AtomicInboxBoundaryData<Dim>::index(neighbor_id));
+  auto* const received = queue.front();
+  REQUIRE(received != nullptr);
+  CHECK(get<0>(*received) == time_step_id);
+  CHECK(get<2>(*received) == neighbor_id);
+  const auto& received_data = get<1>(*received);
+  CHECK(received_data.ghost_cell_data->data() == ghost_cell_ptr);
+  CHECK(received_data.boundary_correction_data->data() ==
+        boundary_correction_ptr);
+  CHECK(*received_data.boundary_correction_data == DataVector(7, 2.0));
+  queue.pop();
+  CHECK(queue.empty());
+}
+
 template <size_t Dim>
 void test() {
   static_assert(Dim < 4);
   static_assert(evolution::dg::is_atomic_inbox_boundary_data_v<
                 AtomicInboxBoundaryData<Dim>>);
   CAPTURE(Dim);
+  test_insert_transfers_ownership<Dim>();
   if constexpr (Dim == 1) {
     CHECK(AtomicInboxBoundaryData<Dim>::index(DirectionalId<Dim>{
               Direction<Dim>::lower_xi(), ElementId<Dim>{2}}) == 0);
@@ -16,6 +16,7 @@
 #include "Evolution/Imex/Mode.hpp"
 #include "Evolution/Imex/Tags/ImplicitHistory.hpp"
 #include "Evolution/Imex/Tags/Mode.hpp"
+#include "Evolution/Imex/Tags/JacobianEvaluations.hpp"
 #include "Evolution/Imex/Tags/SolveFailures.hpp"
 #include "Evolution/Imex/Tags/SolveTolerance.hpp"
 #include "Framework/ActionTesting.hpp"
@@ -73,7 +74,11 @@ void test_basic_functionality() {
       tmpl::list<imex::Tags::ImplicitHistory<helpers::Sector<helpers::Var1>>,
                  imex::Tags::ImplicitHistory<helpers::Sector<helpers::Var2>>,
                  imex::Tags::SolveFailures<helpers::Sector<helpers::Var1>>,
-                 imex::Tags::SolveFailures<helpers::Sector<helpers::Var2>>>>;
+                 imex::Tags::SolveFailures<helpers::Sector<helpers::Var2>>,
+                 imex::Tags::JacobianEvaluations<
+                     helpers::Sector<helpers::Var1>>,
+                 imex::Tags::JacobianEvaluations<
+                     helpers::Sector<helpers::Var2>>>>;
   using component = Component<metavariables>;
 
   const size_t number_of_grid_points = 5;
@@ -94,6 +99,10 @@ void test_basic_functionality() {
                   -get(get<helpers::Var2>(initial_vars)));
   Scalar<DataVector> solve_failures1(DataVector(number_of_grid_points, 0.0));
   Scalar<DataVector> solve_failures2(DataVector(number_of_grid_points, 0.0));
+  Scalar<DataVector> jacobian_evaluations1(
+      DataVector(number_of_grid_points, 0.0));
+  Scalar<DataVector> jacobian_evaluations2(
+      DataVector(number_of_grid_points, 0.0));
 
   const double tolerance = 1.0e-10;
 
@@ -106,7 +115,8 @@ void test_basic_functionality() {
        TimeSteppers::Heun2{}.next_time_id(time_step_id, time_step),
        initial_vars, imex::Mode::Implicit, tolerance, std::move(history1),
        std::move(history2), std::move(solve_failures1),
-       std::move(solve_failures2)});
+       std::move(solve_failures2), std::move(jacobian_evaluations1),
+       std::move(jacobian_evaluations2)});
   ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
   runner.next_action<component>(0);
 
@@ -129,7 +139,8 @@ void test_nonautonomous() {
   using history_tag = imex::Tags::ImplicitHistory<sector>;
   using metavariables =
       Metavariables<helpers::NonautonomousSystem,
-                    tmpl::list<history_tag, imex::Tags::SolveFailures<sector>>>;
+                    tmpl::list<history_tag, imex::Tags::SolveFailures<sector>,
+                               imex::Tags::JacobianEvaluations<sector>>>;
   using component = Component<metavariables>;
 
   const size_t number_of_grid_points = 5;
@@ -151,6 +162,8 @@ void test_nonautonomous() {
                  make_with_value<history_tag::type::DerivVars>(
                      initial_vars, time_step_id.substep_time()));
   Scalar<DataVector> solve_failures(DataVector(number_of_grid_points, 0.0));
+  Scalar<DataVector> jacobian_evaluations(
+      DataVector(number_of_grid_points, 0.0));
 
   const double tolerance = 1.0e-10;
 
@@ -162,7 +175,7 @@ void test_nonautonomous() {
        time_step_id.substep_time(),
        TimeSteppers::Heun2{}.next_time_id(time_step_id, time_step),
        initial_vars, imex::Mode::Implicit, tolerance, std::move(history),
-       std::move(solve_failures)});
+       std::move(solve_failures), std::move(jacobian_evaluations)});
   ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
   runner.next_action<component>(0);
 
@@ -16,6 +16,7 @@
 #include "Evolution/Imex/Protocols/ImexSystem.hpp"
 #include "Evolution/Imex/Protocols/ImplicitSector.hpp"
 #include "Evolution/Imex/Tags/ImplicitHistory.hpp"
+#include "Evolution/Imex/Tags/JacobianEvaluations.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
@@ -92,4 +93,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Imex.Initialize", "[Unit][Evolution]") {
         Scalar<DataVector>(DataVector(5, 0.0)));
   CHECK(db::get<imex::Tags::SolveFailures<Sector<Var2>>>(box) ==
         Scalar<DataVector>(DataVector(5, 0.0)));
+  CHECK(db::get<imex::Tags::JacobianEvaluations<Sector<Var1>>>(box) ==
+        Scalar<DataVector>(DataVector(5, 0.0)));
+  CHECK(db::get<imex::Tags::JacobianEvaluations<Sector<Var2>>>(box) ==
+        Scalar<DataVector>(DataVector(5, 0.0)));
 }
@@ -28,6 +28,7 @@
 #include "Evolution/Imex/SolveImplicitSector.tpp"
 #include "Evolution/Imex/Tags/ImplicitHistory.hpp"
 #include "Evolution/Imex/Tags/Jacobian.hpp"
+#include "Evolution/Imex/Tags/JacobianEvaluations.hpp"
 #include "Evolution/Imex/Tags/Mode.hpp"
 #include "Evolution/Imex/Tags/SolveFailures.hpp"
 #include "Evolution/Imex/Tags/SolveTolerance.hpp"
@@ -437,12 +438,14 @@ void test_solve_implicit_sector(const imex::Mode solve_mode) {
                         Tags::ConcreteTimeStepper<ImexTimeStepper>,
                         Tags::TimeStep, history_tag, imex::Tags::Mode,
                         imex::Tags::SolveFailures<sector>,
+                        imex::Tags::JacobianEvaluations<sector>,
                         imex::Tags::SolveTolerance>,
       time_stepper_ref_tags<ImexTimeStepper>>(
       initial_vars, non_tensor, VariablesFromEvolution::type{},
       static_cast<std::unique_ptr<ImexTimeStepper>>(
           std::make_unique<TimeSteppers::Heun2>()),
       time_step, typename history_tag::type{2}, solve_mode,
+      Scalar<DataVector>(DataVector(number_of_grid_points, 0.0)),
       Scalar<DataVector>(DataVector(number_of_grid_points, 0.0)), 1.0e-10);
 
   simulate_explicit_step(make_not_null(&box), initial_time_step_id);
@@ -641,13 +644,15 @@ void test_point_reseting() {
           Var2, variables_tag, imex::Tags::ImplicitHistory<ResettingTestSector>,
           imex::Tags::Mode, Tags::ConcreteTimeStepper<ImexTimeStepper>,
           Tags::TimeStep, imex::Tags::SolveFailures<ResettingTestSector>,
+          imex::Tags::JacobianEvaluations<ResettingTestSector>,
           imex::Tags::SolveTolerance>,
       time_stepper_ref_tags<ImexTimeStepper>>(
       var2, std::move(initial_value), std::move(history),
       imex::Mode::SemiImplicit,
       static_cast<std::unique_ptr<ImexTimeStepper>>(
           std::make_unique<TimeSteppers::Heun2>()),
-      time_step, Scalar<DataVector>(DataVector(2, 0.0)), 1.0e-10);
+      time_step, Scalar<DataVector>(DataVector(2, 0.0)),
+      Scalar<DataVector>(DataVector(2, 0.0)), 1.0e-10);
   db::mutate_apply<
       imex::SolveImplicitSector<variables_tag, ResettingTestSector>>(
       make_not_null(&box));
@@ -730,14 +735,15 @@ void test_fallback() {
       db::AddSimpleTags<
           DesiredLevel, variables_tag, history_tag, imex::Tags::Mode,
           Tags::ConcreteTimeStepper<ImexTimeStepper>, Tags::TimeStep,
-          imex::Tags::SolveFailures<sector>, imex::Tags::SolveTolerance>,
+          imex::Tags::SolveFailures<sector>,
+          imex::Tags::JacobianEvaluations<sector>, imex::Tags::SolveTolerance>,
       time_stepper_ref_tags<ImexTimeStepper>>(
       desired_level, std::move(initial_value), std::move(history),
       imex::Mode::SemiImplicit,
       static_cast<std::unique_ptr<ImexTimeStepper>>(
           std::make_unique<TimeSteppers::Heun2>()),
       time_step, Scalar<DataVector>(DataVector(number_of_grid_points, 0.0)),
-      1.0e-10);
+      Scalar<DataVector>(DataVector(number_of_grid_points, 0.0)), 1.0e-10);
 
   // Jacobian is only right when the template parameter and DataVector
   // agree.  (This is also a test of test_sector will fallbacks.)
@@ -753,6 +759,9 @@ void test_fallback() {
   CHECK_ITERABLE_APPROX(get(get<Var1>(box)), get(desired_level));
   CHECK(get(get<imex::Tags::SolveFailures<sector>>(box)) ==
         4.0 - get(desired_level));
+  // Each semi-implicit attempt evaluates the Jacobian once.
+  CHECK(get(get<imex::Tags::JacobianEvaluations<sector>>(box)) ==
+        5.0 - get(desired_level));
 }
 }  // namespace
 
@@ -3,6 +3,9 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
+#include <vector>
+
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Particles/MonteCarlo/EvolvePackets.hpp"
@@ -74,9 +77,32 @@ void check_packet() {
   CHECK(packet.number_of_neutrinos == 2.0);
 }
 
+void check_sort_packets_by_cell() {
+  const auto make_packet = [](const size_t cell, const double time) {
+    return Particles::MonteCarlo::Packet{0,   1.0, cell, time, 0.0, 0.0,
+                                         0.0, 1.0, 1.0,  0.0,  0.0};
+  };
+  std::vector<Particles::MonteCarlo::Packet> packets{
+      make_packet(3, 0.0), make_packet(0, 1.0), make_packet(3, 2.0),
+      make_packet(1, 3.0), make_packet(0, 4.0)};
+  Particles::MonteCarlo::sort_packets_by_cell(make_not_null(&packets));
+  const std::vector<Particles::MonteCarlo::Packet> expected_packets{
+      make_packet(0, 1.0), make_packet(0, 4.0), make_packet(1, 3.0),
+      make_packet(3, 0.0), make_packet(3, 2.0)};
+  CHECK(packets == expected_packets);
+  // Sorting again does not change the order
+  Particles::MonteCarlo::sort_packets_by_cell(make_not_null(&packets));
+  CHECK(packets == expected_packets);
+
+  std::vector<Particles::MonteCarlo::Packet> no_packets{};
+  Particles::MonteCarlo::sort_packets_by_cell(make_not_null(&no_packets));
+  CHECK(no_packets.empty());
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.Particles.MonteCarloPacket",
                   "[Unit][Evolution]") {
   check_packet();
+  check_sort_packets_by_cell();
 }
@@ -14,13 +14,17 @@
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/CartesianProduct.hpp"
+#include "Utilities/MakeArray.hpp"
 
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.Burgers.Subcell.TciOnDgGrid",
                   "[Unit][Evolution]") {
   enum class TestThis { AllGood, PerssonU, RdmpU };
 
-  for (const auto test_this :
-       {TestThis::AllGood, TestThis::PerssonU, TestThis::RdmpU}) {
+  for (const auto& [test_this, rdmp_needs_projection] : cartesian_product(
+           make_array(TestThis::AllGood, TestThis::PerssonU, TestThis::RdmpU),
+           make_array(true, false))) {
+    CAPTURE(rdmp_needs_projection);
     const Mesh<1> dg_mesh{5, Spectral::Basis::Legendre,
                           Spectral::Quadrature::GaussLobatto};
     const Mesh<1> subcell_mesh = evolution::dg::subcell::fd::mesh(dg_mesh);
@@ -41,7 +45,12 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Burgers.Subcell.TciOnDgGrid",
         {min(min(get(u)), min(evolution::dg::subcell::fd::project(
                               get(u), dg_mesh, subcell_mesh.extents())))}};
 
-    const auto expected_rdmp_data = past_rdmp_tci_data;
+    // Without the projection only the values on the DG grid are used.
+    const auto expected_rdmp_data =
+        rdmp_needs_projection
+            ? past_rdmp_tci_data
+            : evolution::dg::subcell::RdmpTciData{{max(get(u))},
+                                                  {min(get(u))}};
 
     if (test_this == TestThis::RdmpU) {
       // Assumes min is positive, increase it so we fail the TCI
@@ -68,7 +77,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Burgers.Subcell.TciOnDgGrid",
     const std::tuple<bool, evolution::dg::subcell::RdmpTciData> result =
         Burgers::subcell::TciOnDgGrid::apply(
             u, dg_mesh, subcell_mesh, past_rdmp_tci_data, subcell_options,
-            persson_exponent, element_stays_on_dg);
+            persson_exponent, element_stays_on_dg, rdmp_needs_projection);
 
     CHECK(std::get<1>(result) == expected_rdmp_data);
 
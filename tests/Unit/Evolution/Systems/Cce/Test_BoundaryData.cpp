@@ -148,6 +148,30 @@ void test_trigonometric_function_identities(
       }
     }
   }
+  {
+    INFO("Cached angular geometry");
+    const auto& geometry =
+        cached_worldtube_angular_geometry(l_max, extraction_radius);
+    CHECK(geometry.l_max == l_max);
+    CHECK(geometry.extraction_radius == extraction_radius);
+    CHECK(geometry.cos_phi == cos_phi);
+    CHECK(geometry.cos_theta == cos_theta);
+    CHECK(geometry.sin_phi == sin_phi);
+    CHECK(geometry.sin_theta == sin_theta);
+    CHECK(geometry.unit_cartesian_coords == cartesian_coords);
+    CHECK(geometry.cartesian_to_spherical_jacobian ==
+          cartesian_to_angular_jacobian);
+    CHECK(geometry.inverse_cartesian_to_spherical_jacobian ==
+          inverse_cartesian_to_angular_jacobian);
+    CHECK(&cached_worldtube_angular_geometry(l_max, extraction_radius) ==
+          &geometry);
+    const auto& other_geometry =
+        cached_worldtube_angular_geometry(l_max, 2.0 * extraction_radius);
+    CHECK(&other_geometry != &geometry);
+    CHECK(other_geometry.extraction_radius == 2.0 * extraction_radius);
+    CHECK(&cached_worldtube_angular_geometry(l_max, extraction_radius) ==
+          &geometry);
+  }
 }
 
 template <typename Generator>
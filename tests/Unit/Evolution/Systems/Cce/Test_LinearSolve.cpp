@@ -16,6 +16,7 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/Systems/Cce/CceComputationTestHelpers.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/VectorAlgebra.hpp"
 
 namespace Cce {
@@ -465,6 +466,22 @@ void test_pole_integration_with_linear_operator(
   CHECK_ITERABLE_CUSTOM_APPROX(expected,
                                get(db::get<BondiValueTag>(box)).data(),
                                numerical_differentiation_approximation);
+
+  // The independent solves at each angular point may be split across threads
+  for (const size_t number_of_threads : {2_st, 3_st, 1000_st}) {
+    typename BondiValueTag::type threaded_result{
+        get(db::get<BondiValueTag>(box)).size()};
+    RadialIntegrateBondi<Tags::BoundaryValue, BondiValueTag>::apply(
+        make_not_null(&threaded_result),
+        db::get<Tags::PoleOfIntegrand<BondiValueTag>>(box),
+        db::get<Tags::RegularIntegrand<BondiValueTag>>(box),
+        db::get<Tags::LinearFactor<BondiValueTag>>(box),
+        db::get<Tags::LinearFactorForConjugate<BondiValueTag>>(box),
+        db::get<Tags::BoundaryValue<BondiValueTag>>(box),
+        db::get<Tags::OneMinusY>(box), l_max, number_of_radial_grid_points,
+        number_of_threads);
+    CHECK(threaded_result == db::get<BondiValueTag>(box));
+  }
 }
 
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.LinearSolve", "[Unit][Cce]") {
@@ -1165,6 +1165,61 @@ void test_kerrschild(const Ccz4::EvolveShift evolve_shift,
       field_p, d_a_tilde, d_trace_extrinsic_curvature, d_theta, d_gamma_hat,
       d_b, d_field_a, d_field_b, d_field_d, d_field_p);
 
+  // Evaluating in blocks of points gives the same time derivatives. The mesh
+  // has more points than a block, and they are not a multiple of the block.
+  static_assert(num_points_3d > Ccz4::TimeDerivative<SpatialDim>::block_size and
+                num_points_3d % Ccz4::TimeDerivative<SpatialDim>::block_size !=
+                    0);
+  tnsr::ii<DataVector, SpatialDim> dt_conformal_spatial_metric_in_blocks(
+      used_for_size);
+  Scalar<DataVector> dt_ln_lapse_in_blocks(used_for_size);
+  tnsr::I<DataVector, SpatialDim> dt_shift_in_blocks(used_for_size);
+  Scalar<DataVector> dt_ln_conformal_factor_in_blocks(used_for_size);
+  tnsr::ii<DataVector, SpatialDim> dt_a_tilde_in_blocks(used_for_size);
+  Scalar<DataVector> dt_trace_extrinsic_curvature_in_blocks(used_for_size);
+  Scalar<DataVector> dt_theta_in_blocks(used_for_size);
+  tnsr::I<DataVector, SpatialDim> dt_gamma_hat_in_blocks(used_for_size);
+  tnsr::I<DataVector, SpatialDim> dt_b_in_blocks(used_for_size);
+  tnsr::i<DataVector, SpatialDim> dt_field_a_in_blocks(used_for_size);
+  tnsr::iJ<DataVector, SpatialDim> dt_field_b_in_blocks(used_for_size);
+  tnsr::ijj<DataVector, SpatialDim> dt_field_d_in_blocks(used_for_size);
+  tnsr::i<DataVector, SpatialDim> dt_field_p_in_blocks(used_for_size);
+  ::Ccz4::TimeDerivative<SpatialDim>::apply_in_blocks(
+      make_not_null(&dt_conformal_spatial_metric_in_blocks),
+      make_not_null(&dt_ln_lapse_in_blocks),
+      make_not_null(&dt_shift_in_blocks),
+      make_not_null(&dt_ln_conformal_factor_in_blocks),
+      make_not_null(&dt_a_tilde_in_blocks),
+      make_not_null(&dt_trace_extrinsic_curvature_in_blocks),
+      make_not_null(&dt_theta_in_blocks),
+      make_not_null(&dt_gamma_hat_in_blocks), make_not_null(&dt_b_in_blocks),
+      make_not_null(&dt_field_a_in_blocks),
+      make_not_null(&dt_field_b_in_blocks),
+      make_not_null(&dt_field_d_in_blocks),
+      make_not_null(&dt_field_p_in_blocks), c, cleaning_speed, eta, f, k_0,
+      d_k_0, kappa_1, kappa_2, kappa_3, mu, one_over_relaxation_time,
+      evolve_shift, slicing_condition_type, conformal_spatial_metric, ln_lapse,
+      shift, ln_conformal_factor, a_tilde, trace_extrinsic_curvature, theta,
+      gamma_hat, b, field_a, field_b, field_d, field_p, d_a_tilde,
+      d_trace_extrinsic_curvature, d_theta, d_gamma_hat, d_b, d_field_a,
+      d_field_b, d_field_d, d_field_p);
+  CHECK_ITERABLE_APPROX(dt_conformal_spatial_metric_in_blocks,
+                        dt_conformal_spatial_metric_actual);
+  CHECK_ITERABLE_APPROX(dt_ln_lapse_in_blocks, dt_ln_lapse_actual);
+  CHECK_ITERABLE_APPROX(dt_shift_in_blocks, dt_shift_actual);
+  CHECK_ITERABLE_APPROX(dt_ln_conformal_factor_in_blocks,
+                        dt_ln_conformal_factor_actual);
+  CHECK_ITERABLE_APPROX(dt_a_tilde_in_blocks, dt_a_tilde_actual);
+  CHECK_ITERABLE_APPROX(dt_trace_extrinsic_curvature_in_blocks,
+                        dt_trace_extrinsic_curvature_actual);
+  CHECK_ITERABLE_APPROX(dt_theta_in_blocks, dt_theta_actual);
+  CHECK_ITERABLE_APPROX(dt_gamma_hat_in_blocks, dt_gamma_hat_actual);
+  CHECK_ITERABLE_APPROX(dt_b_in_blocks, dt_b_actual);
+  CHECK_ITERABLE_APPROX(dt_field_a_in_blocks, dt_field_a_actual);
+  CHECK_ITERABLE_APPROX(dt_field_b_in_blocks, dt_field_b_actual);
+  CHECK_ITERABLE_APPROX(dt_field_d_in_blocks, dt_field_d_actual);
+  CHECK_ITERABLE_APPROX(dt_field_p_in_blocks, dt_field_p_actual);
+
   const auto zero = DataVector(used_for_size.size(), 0.0);
 
   // Check time derivatives eq (12a) - (12m)
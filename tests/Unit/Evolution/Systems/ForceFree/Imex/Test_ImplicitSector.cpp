@@ -0,0 +1,123 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Imex/GuessResult.hpp"
+#include "Evolution/Systems/ForceFree/ElectricCurrentDensity.hpp"
+#include "Evolution/Systems/ForceFree/Imex/ImplicitSector.hpp"
+#include "Evolution/Systems/ForceFree/Tags.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Helpers/Evolution/Imex/TestSector.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+using Vector = tnsr::I<DataVector, 3, Frame::Inertial>;
+
+tnsr::ii<DataVector, 3, Frame::Inertial> spatial_metric(
+    const size_t number_of_points) {
+  tnsr::ii<DataVector, 3, Frame::Inertial> result{number_of_points, 0.1};
+  for (size_t i = 0; i < 3; ++i) {
+    result.get(i, i) = 1.0 + 0.2 * static_cast<double>(i);
+  }
+  return result;
+}
+
+void test_sector(const double parallel_conductivity,
+                 const std::array<double, 3>& tilde_e) {
+  CAPTURE(parallel_conductivity);
+  CAPTURE(tilde_e);
+  Variables<tmpl::list<ForceFree::Tags::TildeE>> explicit_values(1);
+  for (size_t i = 0; i < 3; ++i) {
+    get<ForceFree::Tags::TildeE>(explicit_values).get(i) = gsl::at(tilde_e, i);
+  }
+  Vector tilde_b{1_st};
+  get<0>(tilde_b) = 0.3;
+  get<1>(tilde_b) = -0.5;
+  get<2>(tilde_b) = 0.4;
+  TestHelpers::imex::test_sector<ForceFree::Imex::ParallelCurrentSector>(
+      1.0e-3, 1.0e-10, explicit_values,
+      {std::move(tilde_b), Scalar<DataVector>{1_st, 0.7},
+       parallel_conductivity, Scalar<DataVector>{1_st, 0.8},
+       Scalar<DataVector>{1_st, 1.1}, spatial_metric(1)});
+}
+
+void test_random_points() {
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist{-1.0, 1.0};
+  const size_t number_of_points = 50;
+  const DataVector used_for_size{number_of_points};
+  const auto tilde_b = make_with_random_values<Vector>(
+      make_not_null(&generator), make_not_null(&dist), used_for_size);
+  Variables<tmpl::list<ForceFree::Tags::TildeE>> inhomogeneous_terms{
+      number_of_points};
+  get<ForceFree::Tags::TildeE>(inhomogeneous_terms) =
+      make_with_random_values<Vector>(make_not_null(&generator),
+                                      make_not_null(&dist), used_for_size);
+  const auto& x = get<ForceFree::Tags::TildeE>(inhomogeneous_terms);
+  const Scalar<DataVector> tilde_q{number_of_points, 0.3};
+  std::uniform_real_distribution<> lapse_dist{0.5, 1.5};
+  const auto lapse = make_with_random_values<Scalar<DataVector>>(
+      make_not_null(&generator), make_not_null(&lapse_dist), used_for_size);
+  const Scalar<DataVector> sqrt_det_spatial_metric{number_of_points, 1.2};
+  const auto metric = spatial_metric(number_of_points);
+  const double implicit_weight = 0.3;
+
+  // Both regimes must be present for the test to be meaningful
+  const auto b_squared = dot_product(tilde_b, tilde_b, metric);
+  const auto x_squared = dot_product(x, x, metric);
+  CHECK(min(get(x_squared) - get(b_squared)) < 0.0);
+  CHECK(max(get(x_squared) - get(b_squared)) > 0.0);
+
+  for (const double parallel_conductivity : {0.1, 10.0, 100.0}) {
+    CAPTURE(parallel_conductivity);
+    Vector tilde_e{number_of_points};
+    const auto guess_result =
+        ForceFree::Imex::ParallelCurrentImplicitSolve::apply(
+            make_not_null(&tilde_e), tilde_b, parallel_conductivity, lapse,
+            metric, inhomogeneous_terms, implicit_weight);
+    CHECK(guess_result ==
+          std::vector<imex::GuessResult>(number_of_points,
+                                         imex::GuessResult::ExactSolution));
+
+    Vector source{number_of_points};
+    ForceFree::Imex::ParallelCurrentSource::apply(
+        make_not_null(&source), tilde_e, tilde_b, tilde_q,
+        parallel_conductivity, lapse, sqrt_det_spatial_metric, metric);
+    Vector parallel_tilde_j{number_of_points};
+    ForceFree::ComputeParallelTildeJ::apply(
+        make_not_null(&parallel_tilde_j), tilde_q, tilde_e, tilde_b,
+        parallel_conductivity, lapse, sqrt_det_spatial_metric, metric);
+    Approx custom_approx = Approx::custom().epsilon(1.0e-9).scale(1.0);
+    for (size_t i = 0; i < 3; ++i) {
+      CHECK_ITERABLE_CUSTOM_APPROX(source.get(i), -parallel_tilde_j.get(i),
+                                   custom_approx);
+      const DataVector step_result = x.get(i) + implicit_weight * source.get(i);
+      CHECK_ITERABLE_CUSTOM_APPROX(tilde_e.get(i), step_result, custom_approx);
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Systems.ForceFree.Imex.ImplicitSector",
+                  "[Unit][Evolution]") {
+  for (const double parallel_conductivity : {0.0, 1.0, 100.0}) {
+    // Magnetically and electrically dominated after the implicit step
+    test_sector(parallel_conductivity, {{0.1, 0.2, -0.1}});
+    test_sector(parallel_conductivity, {{1.5, 0.4, -2.0}});
+  }
+  test_random_points();
+}
@@ -41,9 +41,11 @@ enum class TestThis {
   RdmpMagTildeB
 };
 
-void test(const TestThis test_this, const int expected_tci_status) {
+void test(const TestThis test_this, const int expected_tci_status,
+          const bool rdmp_needs_projection) {
   CAPTURE(test_this);
   CAPTURE(expected_tci_status);
+  CAPTURE(rdmp_needs_projection);
 
   const Mesh<3> dg_mesh{6, Spectral::Basis::Legendre,
                         Spectral::Quadrature::GaussLobatto};
@@ -162,8 +164,13 @@ void test(const TestThis test_this, const int expected_tci_status) {
       DataVector{min(min(dg_mag_tilde_e), min(subcell_mag_tilde_e)),
                  min(min(dg_mag_tilde_b), min(subcell_mag_tilde_b))};
 
+  // Without the projection only the values on the DG grid are used.
   const evolution::dg::subcell::RdmpTciData expected_rdmp_tci_data =
-      past_rdmp_tci_data;
+      rdmp_needs_projection
+          ? past_rdmp_tci_data
+          : evolution::dg::subcell::RdmpTciData{
+                {max(dg_mag_tilde_e), max(dg_mag_tilde_b)},
+                {min(dg_mag_tilde_e), min(dg_mag_tilde_b)}};
 
   // Modify past data if we are expecting an RDMP TCI failure.
   db::mutate<evolution::dg::subcell::Tags::DataForRdmpTci>(
@@ -181,7 +188,8 @@ void test(const TestThis test_this, const int expected_tci_status) {
   const bool element_stays_on_dg = false;
   const std::tuple<int, evolution::dg::subcell::RdmpTciData> result =
       db::mutate_apply<ForceFree::subcell::TciOnDgGrid>(
-          make_not_null(&box), persson_exponent, element_stays_on_dg);
+          make_not_null(&box), persson_exponent, element_stays_on_dg,
+          rdmp_needs_projection);
 
   CHECK(get<1>(result) == expected_rdmp_tci_data);
 
@@ -195,12 +203,14 @@ void test(const TestThis test_this, const int expected_tci_status) {
 
 SPECTRE_TEST_CASE("Unit.Evolution.ForceFree.Systems.Subcell.TciOnDgGrid",
                   "[Unit][Evolution]") {
-  test(TestThis::AllGood, 0);
-  test(TestThis::PerssonMagTildeE, -1);
-  test(TestThis::PerssonMagTildeB, -2);
-  test(TestThis::PerssonTildeQ, -3);
-  test(TestThis::PerssonTildeQBelowCutoff, 0);
-  test(TestThis::PerssonTildeQDoNotCheck, 0);
-  test(TestThis::RdmpMagTildeE, -4);
-  test(TestThis::RdmpMagTildeB, -5);
+  for (const bool rdmp_needs_projection : {true, false}) {
+    test(TestThis::AllGood, 0, rdmp_needs_projection);
+    test(TestThis::PerssonMagTildeE, -1, rdmp_needs_projection);
+    test(TestThis::PerssonMagTildeB, -2, rdmp_needs_projection);
+    test(TestThis::PerssonTildeQ, -3, rdmp_needs_projection);
+    test(TestThis::PerssonTildeQBelowCutoff, 0, rdmp_needs_projection);
+    test(TestThis::PerssonTildeQDoNotCheck, 0, rdmp_needs_projection);
+    test(TestThis::RdmpMagTildeE, -4, rdmp_needs_projection);
+    test(TestThis::RdmpMagTildeB, -5, rdmp_needs_projection);
+  }
 }
@@ -15,6 +15,7 @@
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
+#include "DataStructures/Tensor/EagerMath/Norms.hpp"
 #include "DataStructures/Tensor/EagerMath/Trace.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
@@ -71,6 +72,22 @@ void test_three_index_constraint(const DataType& used_for_size) {
       "numpy", "subtract", {{{-1.0, 1.0}}}, used_for_size);
 }
 
+template <typename DataType, size_t SpatialDim, typename Frame>
+void test_three_index_constraint_pointwise_l2_norm(
+    const DataType& used_for_size) {
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist(-1., 1.);
+  const auto d_spacetime_metric =
+      make_with_random_values<tnsr::iaa<DataType, SpatialDim, Frame>>(
+          make_not_null(&generator), make_not_null(&dist), used_for_size);
+  const auto phi =
+      make_with_random_values<tnsr::iaa<DataType, SpatialDim, Frame>>(
+          make_not_null(&generator), make_not_null(&dist), used_for_size);
+  CHECK_ITERABLE_APPROX(
+      gh::three_index_constraint_pointwise_l2_norm(d_spacetime_metric, phi),
+      pointwise_l2_norm(gh::three_index_constraint(d_spacetime_metric, phi)));
+}
+
 // Test the return-by-value gauge constraint function using random values
 template <typename DataType, size_t SpatialDim, typename Frame>
 void test_gauge_constraint_random(const DataType& used_for_size) {
@@ -823,6 +840,10 @@ void test_constraint_compute_items(const Solution& solution,
   TestHelpers::db::test_compute_tag<
       gh::Tags::ThreeIndexConstraintCompute<3, Frame::Inertial>>(
       "ThreeIndexConstraint");
+  TestHelpers::db::test_compute_tag<
+      gh::Tags::ThreeIndexConstraintPointwiseL2NormCompute<3,
+                                                           Frame::Inertial>>(
+      "PointwiseL2Norm(ThreeIndexConstraint)");
   TestHelpers::db::test_compute_tag<
       gh::Tags::FourIndexConstraintCompute<3, Frame::Inertial>>(
       "FourIndexConstraint");
@@ -1140,6 +1161,17 @@ void three_index_constraint() {
       std::numeric_limits<double>::signaling_NaN());
   test_three_index_constraint<double, 3, Frame::Inertial>(
       std::numeric_limits<double>::signaling_NaN());
+
+  test_three_index_constraint_pointwise_l2_norm<DataVector, 1,
+                                                Frame::Inertial>(
+      DataVector(4, std::numeric_limits<double>::signaling_NaN()));
+  test_three_index_constraint_pointwise_l2_norm<DataVector, 2, Frame::Grid>(
+      DataVector(4, std::numeric_limits<double>::signaling_NaN()));
+  test_three_index_constraint_pointwise_l2_norm<DataVector, 3,
+                                                Frame::Inertial>(
+      DataVector(4, std::numeric_limits<double>::signaling_NaN()));
+  test_three_index_constraint_pointwise_l2_norm<double, 3, Frame::Inertial>(
+      std::numeric_limits<double>::signaling_NaN());
 }
 
 void gauge_constraint() {
@@ -32,7 +32,9 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/PolytropicFluid.hpp"
 #include "PointwiseFunctions/Hydro/Tags.hpp"
+#include "Utilities/CartesianProduct.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
 namespace {
 enum class TestThis {
   AllGood,
@@ -52,10 +54,11 @@ enum class TestThis {
 };
 
 void test(const TestThis test_this, const int expected_tci_status,
-          const bool element_stays_on_dg) {
+          const bool element_stays_on_dg, const bool rdmp_needs_projection) {
   CAPTURE(test_this);
   CAPTURE(expected_tci_status);
   CAPTURE(element_stays_on_dg);
+  CAPTURE(rdmp_needs_projection);
   const EquationsOfState::Barotropic3D eos{
       EquationsOfState::PolytropicFluid<true>{100.0, 2.0}};
   const Mesh<3> mesh{6, Spectral::Basis::Legendre,
@@ -295,8 +298,27 @@ void test(const TestThis test_this, const int expected_tci_status,
           min(evolution::dg::subcell::fd::project(get(magnitude_tilde_b), mesh,
                                                   subcell_mesh.extents())))};
 
+  // Without the projection only the values on the DG grid are used.
   const evolution::dg::subcell::RdmpTciData expected_rdmp_tci_data =
-      past_rdmp_tci_data;
+      rdmp_needs_projection
+          ? past_rdmp_tci_data
+          : evolution::dg::subcell::RdmpTciData{
+                DataVector{
+                    max(get(db::get<grmhd::ValenciaDivClean::Tags::TildeD>(
+                        box))),
+                    max(get(db::get<grmhd::ValenciaDivClean::Tags::TildeYe>(
+                        box))),
+                    max(get(db::get<grmhd::ValenciaDivClean::Tags::TildeTau>(
+                        box))),
+                    max(get(magnitude_tilde_b))},
+                DataVector{
+                    min(get(db::get<grmhd::ValenciaDivClean::Tags::TildeD>(
+                        box))),
+                    min(get(db::get<grmhd::ValenciaDivClean::Tags::TildeYe>(
+                        box))),
+                    min(get(db::get<grmhd::ValenciaDivClean::Tags::TildeTau>(
+                        box))),
+                    min(get(magnitude_tilde_b))}};
 
   // Modify past data if we are expecting an RDMP TCI failure.
   db::mutate<evolution::dg::subcell::Tags::DataForRdmpTci>(
@@ -318,7 +340,8 @@ void test(const TestThis test_this, const int expected_tci_status,
   const std::tuple<int, evolution::dg::subcell::RdmpTciData> result =
       db::mutate_apply<grmhd::ValenciaDivClean::subcell::TciOnDgGrid<
           grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>>(
-          make_not_null(&box), persson_exponent, element_stays_on_dg);
+          make_not_null(&box), persson_exponent, element_stays_on_dg,
+          rdmp_needs_projection);
 
   CHECK(get<1>(result) == expected_rdmp_tci_data);
 
@@ -362,20 +385,31 @@ void test(const TestThis test_this, const int expected_tci_status,
 
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.ValenciaDivClean.Subcell.TciOnDgGrid",
                   "[Unit][Evolution]") {
-  for (const auto& element_stays_on_dg : make_array(false, true)) {
-    test(TestThis::AllGood, 0, element_stays_on_dg);
-    test(TestThis::InAtmosphere, 0, element_stays_on_dg);
-    test(TestThis::SmallTildeD, -1, element_stays_on_dg);
-    test(TestThis::NegativeTildeDSubcell, -1, element_stays_on_dg);
-    test(TestThis::NegativeTildeTau, -2, element_stays_on_dg);
-    test(TestThis::NegativeTildeTauSubcell, -2, element_stays_on_dg);
-    test(TestThis::TildeB2TooBig, -3, element_stays_on_dg);
-    test(TestThis::PrimRecoveryFailed, -4, element_stays_on_dg);
-    test(TestThis::PerssonTildeD, -5, element_stays_on_dg);
-    test(TestThis::PerssonPressure, -7, element_stays_on_dg);
-    test(TestThis::PerssonTildeB, -8, element_stays_on_dg);
-    test(TestThis::RdmpTildeD, -9, element_stays_on_dg);
-    test(TestThis::RdmpTildeTau, -10, element_stays_on_dg);
-    test(TestThis::RdmpMagnitudeTildeB, -11, element_stays_on_dg);
-  }  // end for loop over element_stays_on_dg
+  for (const auto& [element_stays_on_dg, rdmp_needs_projection] :
+       cartesian_product(make_array(false, true), make_array(true, false))) {
+    test(TestThis::AllGood, 0, element_stays_on_dg, rdmp_needs_projection);
+    test(TestThis::InAtmosphere, 0, element_stays_on_dg, rdmp_needs_projection);
+    test(TestThis::SmallTildeD, -1, element_stays_on_dg, rdmp_needs_projection);
+    test(TestThis::NegativeTildeDSubcell, -1, element_stays_on_dg,
+         rdmp_needs_projection);
+    test(TestThis::NegativeTildeTau, -2, element_stays_on_dg,
+         rdmp_needs_projection);
+    test(TestThis::NegativeTildeTauSubcell, -2, element_stays_on_dg,
+         rdmp_needs_projection);
+    test(TestThis::TildeB2TooBig, -3, element_stays_on_dg,
+         rdmp_needs_projection);
+    test(TestThis::PrimRecoveryFailed, -4, element_stays_on_dg,
+         rdmp_needs_projection);
+    test(TestThis::PerssonTildeD, -5, element_stays_on_dg,
+         rdmp_needs_projection);
+    test(TestThis::PerssonPressure, -7, element_stays_on_dg,
+         rdmp_needs_projection);
+    test(TestThis::PerssonTildeB, -8, element_stays_on_dg,
+         rdmp_needs_projection);
+    test(TestThis::RdmpTildeD, -9, element_stays_on_dg, rdmp_needs_projection);
+    test(TestThis::RdmpTildeTau, -10, element_stays_on_dg,
+         rdmp_needs_projection);
+    test(TestThis::RdmpMagnitudeTildeB, -11, element_stays_on_dg,
+         rdmp_needs_projection);
+  }  // end for loop over element_stays_on_dg and rdmp_needs_projection
 }
@@ -0,0 +1,125 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/FixPrimitivesAndComputeConservatives.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/System.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"
+#include "Evolution/VariableFixing/FixToAtmosphere.hpp"
+#include "Evolution/VariableFixing/LimitLorentzFactor.hpp"
+#include "Evolution/VariableFixing/Tags.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Barotropic3D.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/PolytropicFluid.hpp"
+#include "PointwiseFunctions/Hydro/Tags.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+
+SPECTRE_TEST_CASE(
+    "Unit.Evolution.Systems.ValenciaDivClean.FixPrimsAndComputeCons",
+    "[Unit][Evolution]") {
+  using System = grmhd::ValenciaDivClean::System;
+  using PrimVars = typename System::primitive_variables_tag::type;
+
+  // One point each in the atmosphere, in the transition region, with a
+  // Lorentz factor above the cap, and one that needs no fixing
+  const size_t num_pts = 4;
+  tnsr::ii<DataVector, 3, Frame::Inertial> spatial_metric{num_pts, 0.0};
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_metric.get(i, i) = 1.0;
+  }
+  const Scalar<DataVector> sqrt_det_spatial_metric{num_pts, 1.0};
+  const EquationsOfState::Barotropic3D eos{
+      EquationsOfState::PolytropicFluid<true>{100.0, 2.0}};
+  const VariableFixing::FixToAtmosphere<3> fix_to_atmosphere{1.0e-10, 1.0e-10,
+                                                             1.0e-9, 1.0e-4};
+  const VariableFixing::LimitLorentzFactor limit_lorentz_factor{1.0e-3, 10.0,
+                                                                true};
+
+  PrimVars prims{num_pts, 0.0};
+  get(get<hydro::Tags::RestMassDensity<DataVector>>(prims)) =
+      DataVector{1.0e-12, 5.0e-10, 1.0e-5, 1.0};
+  const DataVector velocity{0.5, 0.1, 0.999, 0.5};
+  get<hydro::Tags::SpatialVelocity<DataVector, 3>>(prims).get(0) = velocity;
+  get(get<hydro::Tags::LorentzFactor<DataVector>>(prims)) =
+      1.0 / sqrt(1.0 - square(velocity));
+  get(get<hydro::Tags::ElectronFraction<DataVector>>(prims)) = 0.1;
+  get(get<hydro::Tags::Pressure<DataVector>>(prims)) =
+      100.0 * square(get(get<hydro::Tags::RestMassDensity<DataVector>>(prims)));
+  get(get<hydro::Tags::SpecificInternalEnergy<DataVector>>(prims)) =
+      100.0 * get(get<hydro::Tags::RestMassDensity<DataVector>>(prims));
+  get<hydro::Tags::MagneticField<DataVector, 3>>(prims).get(2) = 1.0e-3;
+
+  auto box = db::create<db::AddSimpleTags<
+      typename System::variables_tag, typename System::primitive_variables_tag,
+      ::Tags::VariableFixer<VariableFixing::FixToAtmosphere<3>>,
+      ::Tags::VariableFixer<VariableFixing::LimitLorentzFactor>,
+      hydro::Tags::GrmhdEquationOfState, gr::Tags::SpatialMetric<DataVector, 3>,
+      gr::Tags::SqrtDetSpatialMetric<DataVector>>>(
+      typename System::variables_tag::type{num_pts, 0.0}, prims,
+      fix_to_atmosphere, limit_lorentz_factor, eos.get_clone(), spatial_metric,
+      sqrt_det_spatial_metric);
+  db::mutate_apply<
+      grmhd::ValenciaDivClean::FixPrimitivesAndComputeConservatives>(
+      make_not_null(&box));
+
+  // Apply the fixes and compute the conservatives one after another
+  fix_to_atmosphere(
+      make_not_null(&get<hydro::Tags::RestMassDensity<DataVector>>(prims)),
+      make_not_null(
+          &get<hydro::Tags::SpecificInternalEnergy<DataVector>>(prims)),
+      make_not_null(&get<hydro::Tags::SpatialVelocity<DataVector, 3>>(prims)),
+      make_not_null(&get<hydro::Tags::LorentzFactor<DataVector>>(prims)),
+      make_not_null(&get<hydro::Tags::Pressure<DataVector>>(prims)),
+      make_not_null(&get<hydro::Tags::Temperature<DataVector>>(prims)),
+      get<hydro::Tags::ElectronFraction<DataVector>>(prims), spatial_metric,
+      eos);
+  limit_lorentz_factor(
+      make_not_null(&get<hydro::Tags::LorentzFactor<DataVector>>(prims)),
+      make_not_null(&get<hydro::Tags::SpatialVelocity<DataVector, 3>>(prims)),
+      get<hydro::Tags::RestMassDensity<DataVector>>(prims));
+  typename System::variables_tag::type expected_cons{num_pts};
+  grmhd::ValenciaDivClean::ConservativeFromPrimitive::apply(
+      make_not_null(&get<grmhd::ValenciaDivClean::Tags::TildeD>(expected_cons)),
+      make_not_null(
+          &get<grmhd::ValenciaDivClean::Tags::TildeYe>(expected_cons)),
+      make_not_null(
+          &get<grmhd::ValenciaDivClean::Tags::TildeTau>(expected_cons)),
+      make_not_null(
+          &get<grmhd::ValenciaDivClean::Tags::TildeS<>>(expected_cons)),
+      make_not_null(
+          &get<grmhd::ValenciaDivClean::Tags::TildeB<>>(expected_cons)),
+      make_not_null(
+          &get<grmhd::ValenciaDivClean::Tags::TildePhi>(expected_cons)),
+      get<hydro::Tags::RestMassDensity<DataVector>>(prims),
+      get<hydro::Tags::ElectronFraction<DataVector>>(prims),
+      get<hydro::Tags::SpecificInternalEnergy<DataVector>>(prims),
+      get<hydro::Tags::Pressure<DataVector>>(prims),
+      get<hydro::Tags::SpatialVelocity<DataVector, 3>>(prims),
+      get<hydro::Tags::LorentzFactor<DataVector>>(prims),
+      get<hydro::Tags::MagneticField<DataVector, 3>>(prims),
+      sqrt_det_spatial_metric, spatial_metric,
+      get<hydro::Tags::DivergenceCleaningField<DataVector>>(prims));
+
+  CHECK_VARIABLES_APPROX(db::get<typename System::primitive_variables_tag>(box),
+                         prims);
+  CHECK_VARIABLES_APPROX(db::get<typename System::variables_tag>(box),
+                         expected_cons);
+  // Check that the fixes were actually applied
+  const auto& fixed_lorentz_factor =
+      get(db::get<hydro::Tags::LorentzFactor<DataVector>>(box));
+  CHECK(fixed_lorentz_factor[0] == 1.0);
+  CHECK(fixed_lorentz_factor[2] == approx(10.0));
+  CHECK(fixed_lorentz_factor[3] == approx(1.0 / sqrt(0.75)));
+}
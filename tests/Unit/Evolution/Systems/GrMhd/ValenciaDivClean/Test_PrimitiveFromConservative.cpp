@@ -7,10 +7,12 @@
 #include <cstddef>
 #include <limits>
 #include <random>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Conservative/RoundTrip.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAlHydro.hpp"
@@ -387,6 +389,54 @@ void test_primitive_from_conservative_known(const DataVector& used_for_size) {
   CHECK_ITERABLE_APPROX(expected_divergence_cleaning_field,
                         divergence_cleaning_field);
 
+  {
+    INFO("Primitives that reproduce the conservatives are kept in place");
+    auto& statistics = evolution::conservative::RecoveryStatistics::local();
+    statistics.reset();
+    rest_mass_density = expected_rest_mass_density;
+    specific_internal_energy = expected_specific_internal_energy;
+    spatial_velocity = expected_spatial_velocity;
+    lorentz_factor = expected_lorentz_factor;
+    pressure = expected_pressure;
+    grmhd::ValenciaDivClean::
+        PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes>::apply(
+            make_not_null(&rest_mass_density),
+            make_not_null(&electron_fraction),
+            make_not_null(&specific_internal_energy),
+            make_not_null(&spatial_velocity), make_not_null(&magnetic_field),
+            make_not_null(&divergence_cleaning_field),
+            make_not_null(&lorentz_factor), make_not_null(&pressure),
+            make_not_null(&temperature), tilde_d, tilde_ye, tilde_tau, tilde_s,
+            tilde_b, tilde_phi, spatial_metric, inv_spatial_metric,
+            sqrt_det_spatial_metric, ideal_fluid,
+            primitive_from_conservative_options);
+    CHECK(statistics.number_of_calls() == 1);
+    CHECK(statistics.number_of_points() == number_of_points);
+    CHECK(statistics.number_of_recovered_points() == 0);
+    CHECK(rest_mass_density == expected_rest_mass_density);
+    CHECK(spatial_velocity == expected_spatial_velocity);
+    CHECK(pressure == expected_pressure);
+
+    // A changed conserved variable is recovered again
+    const auto perturbed_tilde_tau =
+        Scalar<DataVector>{get(tilde_tau) * (1.0 + 1.0e-6)};
+    statistics.reset();
+    grmhd::ValenciaDivClean::
+        PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes>::apply(
+            make_not_null(&rest_mass_density),
+            make_not_null(&electron_fraction),
+            make_not_null(&specific_internal_energy),
+            make_not_null(&spatial_velocity), make_not_null(&magnetic_field),
+            make_not_null(&divergence_cleaning_field),
+            make_not_null(&lorentz_factor), make_not_null(&pressure),
+            make_not_null(&temperature), tilde_d, tilde_ye, perturbed_tilde_tau,
+            tilde_s, tilde_b, tilde_phi, spatial_metric, inv_spatial_metric,
+            sqrt_det_spatial_metric, ideal_fluid,
+            primitive_from_conservative_options);
+    CHECK(statistics.number_of_recovered_points() == number_of_points);
+    CHECK(pressure != expected_pressure);
+  }
+
   if constexpr (not UseMagneticField) {
     // Test KastaunHydro for FPE safety
     tilde_tau = make_with_value<Scalar<DataVector>>(used_for_size, -10.);
@@ -407,6 +457,110 @@ void test_primitive_from_conservative_known(const DataVector& used_for_size) {
   }
 }
 
+void test_kastaun_warm_start(const DataVector& used_for_size) {
+  INFO("Warm start of KastaunEtAl from the previous pressure");
+  // Without magnetic field the guess for the master function root computed
+  // from the exact pressure is exact
+  const auto expected_rest_mass_density =
+      make_with_value<Scalar<DataVector>>(used_for_size, 2.0);
+  const auto expected_electron_fraction =
+      make_with_value<Scalar<DataVector>>(used_for_size, 0.1);
+  const auto expected_lorentz_factor =
+      make_with_value<Scalar<DataVector>>(used_for_size, 1.25);
+  auto expected_spatial_velocity =
+      make_with_value<tnsr::I<DataVector, 3>>(used_for_size, 0.0);
+  get<0>(expected_spatial_velocity) = 0.6;
+  const auto expected_specific_internal_energy =
+      make_with_value<Scalar<DataVector>>(used_for_size, 3.0);
+  const auto expected_pressure =
+      make_with_value<Scalar<DataVector>>(used_for_size, 2.0);
+  const auto expected_magnetic_field =
+      make_with_value<tnsr::I<DataVector, 3>>(used_for_size, 0.0);
+  const auto expected_divergence_cleaning_field =
+      make_with_value<Scalar<DataVector>>(used_for_size, 0.0);
+  auto spatial_metric =
+      make_with_value<tnsr::ii<DataVector, 3>>(used_for_size, 0.0);
+  auto inv_spatial_metric =
+      make_with_value<tnsr::II<DataVector, 3>>(used_for_size, 0.0);
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_metric.get(i, i) = 1.0;
+    inv_spatial_metric.get(i, i) = 1.0;
+  }
+  const auto sqrt_det_spatial_metric =
+      make_with_value<Scalar<DataVector>>(used_for_size, 1.0);
+
+  const size_t number_of_points = used_for_size.size();
+  Scalar<DataVector> tilde_d(number_of_points);
+  Scalar<DataVector> tilde_ye(number_of_points);
+  Scalar<DataVector> tilde_tau(number_of_points);
+  tnsr::i<DataVector, 3> tilde_s(number_of_points);
+  tnsr::I<DataVector, 3> tilde_b(number_of_points);
+  Scalar<DataVector> tilde_phi(number_of_points);
+  grmhd::ValenciaDivClean::ConservativeFromPrimitive::apply(
+      make_not_null(&tilde_d), make_not_null(&tilde_ye),
+      make_not_null(&tilde_tau), make_not_null(&tilde_s),
+      make_not_null(&tilde_b), make_not_null(&tilde_phi),
+      expected_rest_mass_density, expected_electron_fraction,
+      expected_specific_internal_energy, expected_pressure,
+      expected_spatial_velocity, expected_lorentz_factor,
+      expected_magnetic_field, sqrt_det_spatial_metric, spatial_metric,
+      expected_divergence_cleaning_field);
+
+  const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions
+      primitive_from_conservative_options(0.0, 0.0, 1.0e4);
+  EquationsOfState::Equilibrium3D ideal_fluid{
+      EquationsOfState::IdealFluid<true>{4.0 / 3.0}};
+  using Scheme = grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl;
+  // Returns the number of warm starts and master function evaluations
+  const auto recover = [&](const double initial_guess_pressure) {
+    Scalar<DataVector> rest_mass_density(number_of_points);
+    Scalar<DataVector> electron_fraction(number_of_points);
+    Scalar<DataVector> specific_internal_energy(number_of_points);
+    Scalar<DataVector> temperature(number_of_points);
+    tnsr::I<DataVector, 3> spatial_velocity(number_of_points);
+    tnsr::I<DataVector, 3> magnetic_field(number_of_points);
+    Scalar<DataVector> divergence_cleaning_field(number_of_points);
+    Scalar<DataVector> lorentz_factor(number_of_points);
+    Scalar<DataVector> pressure(number_of_points, initial_guess_pressure);
+    const auto statistics_before = Scheme::statistics();
+    grmhd::ValenciaDivClean::PrimitiveFromConservative<tmpl::list<Scheme>>::
+        apply(make_not_null(&rest_mass_density),
+              make_not_null(&electron_fraction),
+              make_not_null(&specific_internal_energy),
+              make_not_null(&spatial_velocity), make_not_null(&magnetic_field),
+              make_not_null(&divergence_cleaning_field),
+              make_not_null(&lorentz_factor), make_not_null(&pressure),
+              make_not_null(&temperature), tilde_d, tilde_ye, tilde_tau,
+              tilde_s, tilde_b, tilde_phi, spatial_metric, inv_spatial_metric,
+              sqrt_det_spatial_metric, ideal_fluid,
+              primitive_from_conservative_options);
+    const auto& statistics_after = Scheme::statistics();
+    CHECK(statistics_after.number_of_recoveries -
+              statistics_before.number_of_recoveries ==
+          number_of_points);
+    CHECK_ITERABLE_APPROX(expected_rest_mass_density, rest_mass_density);
+    CHECK_ITERABLE_APPROX(expected_specific_internal_energy,
+                          specific_internal_energy);
+    CHECK_ITERABLE_APPROX(expected_lorentz_factor, lorentz_factor);
+    CHECK_ITERABLE_APPROX(expected_pressure, pressure);
+    CHECK_ITERABLE_APPROX(expected_spatial_velocity, spatial_velocity);
+    return std::pair{statistics_after.number_of_warm_starts -
+                         statistics_before.number_of_warm_starts,
+                     statistics_after.number_of_evaluations -
+                         statistics_before.number_of_evaluations};
+  };
+  const auto [cold_warm_starts, cold_evaluations] =
+      recover(std::numeric_limits<double>::quiet_NaN());
+  CHECK(cold_warm_starts == 0);
+  const auto [warm_warm_starts, warm_evaluations] =
+      recover(get(expected_pressure)[0] * (1.0 + 1.0e-6));
+  CHECK(warm_warm_starts == number_of_points);
+  CHECK(warm_evaluations < cold_evaluations);
+  // A poor guess falls back to the robust bracket
+  const auto [poor_warm_starts, poor_evaluations] = recover(1.0e6);
+  CHECK(poor_warm_starts == 0);
+  CHECK(poor_evaluations > cold_evaluations);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
@@ -431,6 +585,7 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
       false>(dv);
   test_primitive_from_conservative_known<tmpl::list<
       grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>>(dv);
+  test_kastaun_warm_start(dv);
   test_primitive_from_conservative_random<
       tmpl::list<
           grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>,
@@ -491,6 +646,17 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
       tmpl::list<
           grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>,
       false>(&generator, wrapped_3d_polytrope, dv);
+  {
+    INFO("Palenzuela on SIMD batches");
+    // Enough points for several full batches and a partial one
+    const DataVector many_points(23);
+    test_primitive_from_conservative_random<tmpl::list<
+        grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>>(
+        &generator, wrapped_ideal_fluid, many_points);
+    test_primitive_from_conservative_random<tmpl::list<
+        grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>>(
+        &generator, wrapped_3d_polytrope, many_points);
+  }
 
   test_potentially_eos_dependent_primitive_corrections<tmpl::list<
       grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl>>(
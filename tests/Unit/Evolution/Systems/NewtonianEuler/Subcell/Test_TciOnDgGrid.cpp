@@ -37,7 +37,8 @@ enum class TestThis {
 };
 
 template <size_t Dim>
-void test(const TestThis test_this) {
+void test(const TestThis test_this, const bool rdmp_needs_projection) {
+  CAPTURE(rdmp_needs_projection);
   using MassDensityCons = NewtonianEuler::Tags::MassDensityCons;
   using EnergyDensity = NewtonianEuler::Tags::EnergyDensity;
   using MomentumDensity = NewtonianEuler::Tags::MomentumDensity<Dim>;
@@ -126,8 +127,15 @@ void test(const TestThis test_this) {
                                                    dg_mesh,
                                                    subcell_mesh.extents())))}};
 
+  // Without the projection only the values on the DG grid are used.
   const evolution::dg::subcell::RdmpTciData expected_rdmp_tci_data =
-      past_rdmp_tci_data;
+      rdmp_needs_projection
+          ? past_rdmp_tci_data
+          : evolution::dg::subcell::RdmpTciData{
+                {max(get(get<MassDensityCons>(box))),
+                 max(get(get<EnergyDensity>(box)))},
+                {min(get(get<MassDensityCons>(box))),
+                 min(get(get<EnergyDensity>(box)))}};
 
   // Modify past data if we are expected an RDMP TCI failure.
   db::mutate<evolution::dg::subcell::Tags::DataForRdmpTci>(
@@ -146,7 +154,8 @@ void test(const TestThis test_this) {
   const bool element_stays_on_dg = false;
   const std::tuple<bool, evolution::dg::subcell::RdmpTciData> result =
       db::mutate_apply<NewtonianEuler::subcell::TciOnDgGrid<Dim>>(
-          make_not_null(&box), persson_exponent, element_stays_on_dg);
+          make_not_null(&box), persson_exponent, element_stays_on_dg,
+          rdmp_needs_projection);
 
   CHECK_ITERABLE_APPROX(get<1>(result).max_variables_values,
                         expected_rdmp_tci_data.max_variables_values);
@@ -166,8 +175,10 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.NewtonianEuler.Subcell.TciOnDgGrid",
        {TestThis::AllGood, TestThis::SmallDensity, TestThis::SmallPressure,
         TestThis::PerssonDensity, TestThis::PerssonEnergyDensity,
         TestThis::RdmpMassDensity, TestThis::RdmpEnergyDensity}) {
-    test<1>(test_this);
-    test<2>(test_this);
-    test<3>(test_this);
+    for (const bool rdmp_needs_projection : {true, false}) {
+      test<1>(test_this, rdmp_needs_projection);
+      test<2>(test_this, rdmp_needs_projection);
+      test<3>(test_this, rdmp_needs_projection);
+    }
   }
 }
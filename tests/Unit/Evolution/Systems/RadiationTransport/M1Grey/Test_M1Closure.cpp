@@ -356,6 +356,33 @@ void check_random() {
       momentum_density, closure_factor, comoving_energy_density,
       comoving_momentum_density_spatial, comoving_momentum_density_normal,
       pressure_tensor);
+
+  // The input closure factor only changes where the root is searched for
+  // first. Starting from the closure factor just found, or from guesses that
+  // do not bracket the root, gives the same closure.
+  for (const double guess_offset : {0.0, 0.3, -0.3}) {
+    Scalar<DataVector> closure_factor2{get(closure_factor) + guess_offset};
+    tnsr::II<DataVector, 3, Frame::Inertial> pressure_tensor2(used_for_size);
+    Scalar<DataVector> comoving_energy_density2(used_for_size);
+    Scalar<DataVector> comoving_momentum_density_normal2(used_for_size);
+    tnsr::i<DataVector, 3, Frame::Inertial> comoving_momentum_density_spatial2(
+        used_for_size);
+    closure::apply(make_not_null(&closure_factor2),
+                   make_not_null(&pressure_tensor2),
+                   make_not_null(&comoving_energy_density2),
+                   make_not_null(&comoving_momentum_density_normal2),
+                   make_not_null(&comoving_momentum_density_spatial2),
+                   energy_density, momentum_density, fluid_velocity,
+                   fluid_lorentz_factor, spatial_metric, inv_spatial_metric);
+    Approx warm_start_approx = Approx::custom().epsilon(1.0e-5).scale(1.0);
+    CHECK_ITERABLE_CUSTOM_APPROX(closure_factor, closure_factor2,
+                                 warm_start_approx);
+    check_closure_consistency(
+        spatial_metric, fluid_velocity, fluid_lorentz_factor, energy_density,
+        momentum_density, closure_factor2, comoving_energy_density2,
+        comoving_momentum_density_spatial2, comoving_momentum_density_normal2,
+        pressure_tensor2);
+  }
 }
 }  // namespace
 
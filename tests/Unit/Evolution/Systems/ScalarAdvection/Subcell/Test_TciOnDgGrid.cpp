@@ -20,7 +20,8 @@ namespace {
 enum class TestThis { AllGood, PerssonU, BelowCutoff, RdmpU };
 
 template <size_t Dim>
-void test(const TestThis& test_this) {
+void test(const TestThis& test_this, const bool rdmp_needs_projection) {
+  CAPTURE(rdmp_needs_projection);
   // create DG mesh
   const Mesh<Dim> dg_mesh{5, Spectral::Basis::Legendre,
                           Spectral::Quadrature::GaussLobatto};
@@ -50,7 +51,11 @@ void test(const TestThis& test_this) {
       {min(min(get(u)), min(evolution::dg::subcell::fd::project(
                             get(u), dg_mesh, subcell_mesh.extents())))}};
 
-  const auto expected_rdmp_data = past_rdmp_tci_data;
+  // Without the projection only the values on the DG grid are used.
+  const auto expected_rdmp_data =
+      rdmp_needs_projection ? past_rdmp_tci_data
+                            : evolution::dg::subcell::RdmpTciData{
+                                  {max(get(u))}, {min(get(u))}};
 
   if (test_this == TestThis::RdmpU) {
     // Assumes min is positive, increase it so we fail the TCI
@@ -77,7 +82,8 @@ void test(const TestThis& test_this) {
   const std::tuple<bool, evolution::dg::subcell::RdmpTciData> result =
       ScalarAdvection::subcell::TciOnDgGrid<Dim>::apply(
           u, dg_mesh, subcell_mesh, past_rdmp_tci_data, subcell_options,
-          tci_options, persson_exponent, element_stays_on_dg);
+          tci_options, persson_exponent, element_stays_on_dg,
+          rdmp_needs_projection);
 
   CHECK(std::get<1>(result) == expected_rdmp_data);
 
@@ -93,7 +99,9 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ScalarAdvection.Subcell.TciOnDgGrid",
                   "[Unit][Evolution]") {
   for (const auto test_this : {TestThis::AllGood, TestThis::PerssonU,
                                TestThis::RdmpU, TestThis::BelowCutoff}) {
-    test<1>(test_this);
-    test<2>(test_this);
+    for (const bool rdmp_needs_projection : {true, false}) {
+      test<1>(test_this, rdmp_needs_projection);
+      test<2>(test_this, rdmp_needs_projection);
+    }
   }
 }
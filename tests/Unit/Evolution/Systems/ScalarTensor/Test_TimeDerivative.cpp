@@ -8,6 +8,7 @@
 #include <random>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/CurvedScalarWave/System.hpp"
@@ -24,6 +25,9 @@
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/ExtrinsicCurvature.hpp"
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/SpatialDerivOfLapse.hpp"
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/SpatialDerivOfShift.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Lapse.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Shift.hpp"
+#include "PointwiseFunctions/GeneralRelativity/SpatialMetric.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
@@ -103,6 +107,19 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ScalarTensor.TimeDerivative",
       metric.get(i + 1, i + 1) += 4.0;
       metric.get(i + 1, 0) *= 0.01;
     }
+    // The combined system reuses the background quantities the GH time
+    // derivative computes from the metric, so the scalar arguments must be
+    // consistent with it, as they are in the DataBox
+    auto& inverse_spatial_metric =
+        tuples::get<gr::Tags::InverseSpatialMetric<DataVector, 3>>(
+            arg_variables);
+    auto& shift = tuples::get<gr::Tags::Shift<DataVector, 3>>(arg_variables);
+    inverse_spatial_metric =
+        determinant_and_inverse(gr::spatial_metric(metric)).second;
+    gr::shift(make_not_null(&shift), metric, inverse_spatial_metric);
+    gr::lapse(make_not_null(&tuples::get<gr::Tags::Lapse<DataVector>>(
+                  arg_variables)),
+              shift, metric);
   }
 
   // The logic of the test is the following:
@@ -529,7 +529,8 @@ class MockDistributedObjectProxy : public CProxyElement_ArrayElement {
       const CacheProxy& /*global_cache_proxy*/,
       Parallel::Phase /*current_phase*/,
       const std::unordered_map<Parallel::Phase, size_t>& /*phase_bookmarks*/,
-      const std::unique_ptr<Parallel::Callback>& callback) {
+      const std::unique_ptr<Parallel::Callback>& callback,
+      const int /*on_proc*/ = -1) {
     callback->invoke();
   }
 
@@ -667,6 +668,10 @@ class MockCollectionOfDistributedObjectsProxy
                : nullptr;
   }
 
+  // Actions may call this, but since tests step through actions manually it
+  // has no effect.
+  void perform_algorithm() {}
+
   template <typename Action, typename... Args>
   void simple_action(std::tuple<Args...> args) {
     alg::for_each(*mock_distributed_objects_,
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
@@ -22,6 +23,7 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "Framework/ActionTesting.hpp"
+#include "IO/H5/LossyCompression.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
 #include "Options/Protocols/FactoryCreation.hpp"
@@ -224,7 +226,10 @@ struct ScalarSystem {
       "  CoordinatesFloatingPointType: Double\n"
       "  VariablesToObserve: [Scalar, ScalarVarTimesTwo, ScalarVarTimesThree, "
       "Error(Scalar)]\n"
-      "  FloatingPointTypes: [Double]\n";
+      "  FloatingPointTypes: [Double]\n"
+      "  LossyCompression: None\n"
+      "  BlocksToObserve: All\n"
+      "  SliceAt: None\n";
   static ObserveEvent make_test_object(
       const std::optional<Mesh<volume_dim>>& interpolating_mesh) {
     return ObserveEvent{
@@ -346,7 +351,14 @@ struct ComplicatedSystem {
       "                       Vector, Tensor, Tensor2,"
       "                       Error(Vector), Error(Tensor2)]\n"
       "  FloatingPointTypes: [Double, Double, Double, Double, Float, Float,"
-      "                       Double, Float]\n";
+      "                       Double, Float]\n"
+      "  LossyCompression:\n"
+      "    Vector:\n"
+      "      Method: BitRounding\n"
+      "      AbsoluteError: None\n"
+      "      RelativeError: 1.0e-4\n"
+      "  BlocksToObserve: All\n"
+      "  SliceAt: None\n";
 
   static ObserveEvent make_test_object(
       const std::optional<Mesh<volume_dim>>& interpolating_mesh) {
@@ -358,7 +370,14 @@ struct ComplicatedSystem {
          FloatingPointType::Double, FloatingPointType::Float},
         {"Scalar", "ScalarVarTimesTwo", "ScalarVarTimesThree", "Vector",
          "Tensor", "Tensor2", "Error(Vector)", "Error(Tensor2)"},
-        interpolating_mesh);
+        interpolating_mesh,
+        std::unordered_map<std::string, h5::LossyCompression>{
+            {"Vector", lossy_compression_for_test()}});
+  }
+
+  // Components of `Vector` are compressed lossily with this
+  static h5::LossyCompression lossy_compression_for_test() {
+    return {h5::LossyCompressionMethod::BitRounding, std::nullopt, 1.0e-4};
   }
 };
 }  // namespace TestHelpers::dg::Events::ObserveFields
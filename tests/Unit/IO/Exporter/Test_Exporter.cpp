@@ -49,6 +49,28 @@ SPECTRE_TEST_CASE("Unit.IO.Exporter", "[Unit]") {
     CHECK(phi_y[1] == approx(0.6741524090220188));
     CHECK(phi_y[2] == approx(0.2629752479142838));
   }
+  {
+    INFO("Interpolate batches of points");
+    Interpolator<3> interpolator{
+        unit_test_src_path() + "/Visualization/Python/VolTestData*.h5",
+        "element_data",
+        ObservationStep{0},
+        {"Psi", "Phi_y"}};
+    const auto first_batch =
+        interpolator.interpolate({{{0.0, 1.0}, {0.0, 0.0}, {0.0, 0.0}}});
+    CHECK(first_batch.size() == 2);
+    CHECK(first_batch[0].size() == 2);
+    CHECK(first_batch[0][0] == approx(-0.07059806932542323));
+    CHECK(first_batch[1][0] == approx(1.0569673471948728));
+    CHECK(first_batch[0][1] == approx(0.7869554122196492));
+    // The second batch reuses the data read for the first batch
+    const auto second_batch =
+        interpolator.interpolate({{{0.0}, {1.0}, {0.0}}});
+    CHECK(second_batch[0].size() == 1);
+    CHECK(second_batch[0][0] == approx(0.9876185584100299));
+    CHECK(second_batch[1][0] == approx(0.2629752479142838));
+    CHECK(interpolator.interpolate({{{}, {}, {}}})[0].empty());
+  }
   {
     INFO("Single-precision volume data");
     const domain::creators::Rectangle domain_creator{
@@ -16,6 +16,7 @@ from spectre.Informer import unit_test_src_path
 from spectre.IO.H5.IterElements import (
     include_element,
     iter_elements,
+    map_elements,
     stripped_element_name,
 )
 from spectre.Spectral import Basis, Mesh, Quadrature, logical_coordinates
@@ -161,6 +162,76 @@ class TestIterElements(unittest.TestCase):
                 1,
             )
 
+    def test_chunked_reads(self):
+        with spectre_h5.H5File(self.volfile_name, "r") as open_h5_file:
+            volfile = open_h5_file.get_vol(self.subfile_name)
+            obs_id = volfile.list_observation_ids()[0]
+            tensor_components = ["InertialCoordinates_x", "Psi"]
+            all_data = np.asarray(
+                [
+                    np.asarray(
+                        volfile.get_tensor_component(obs_id, component).data
+                    )
+                    for component in tensor_components
+                ]
+            )
+            # Reading one element at a time, and only the selected elements,
+            # gives the same data
+            for max_points_per_read in [None, 1, 4**3, 2 * 4**3]:
+                for element_patterns in [None, ["B0,(L1I1*)"]]:
+                    elements = list(
+                        iter_elements(
+                            volfile,
+                            obs_id,
+                            tensor_components,
+                            element_patterns=element_patterns,
+                            max_points_per_read=max_points_per_read,
+                        )
+                    )
+                    self.assertEqual(
+                        len(elements), 2 if element_patterns is None else 1
+                    )
+                    for element, data in elements:
+                        npt.assert_equal(
+                            data, all_data[:, element.data_slice]
+                        )
+
+    def test_map_elements(self):
+        with spectre_h5.H5File(self.volfile_name, "r") as open_h5_file:
+            volfile = open_h5_file.get_vol(self.subfile_name)
+            obs_id = volfile.list_observation_ids()[0]
+            tensor_components = ["Psi", "Error(Psi)"]
+            expected = [
+                (element.id, np.sum(data[0] * data[1]))
+                for element, data in iter_elements(
+                    volfile, obs_id, tensor_components
+                )
+            ]
+            for num_threads in [None, 1, 3]:
+                results = list(
+                    map_elements(
+                        lambda element, data: (
+                            element.id,
+                            np.sum(data[0] * data[1]),
+                        ),
+                        volfile,
+                        obs_id,
+                        tensor_components,
+                        num_threads=num_threads,
+                    )
+                )
+                self.assertEqual(len(results), len(expected))
+                for (element_id, result), (expected_id, expected_result) in zip(
+                    results, expected
+                ):
+                    self.assertEqual(element_id, expected_id)
+                    self.assertEqual(result, expected_result)
+            # Without tensor components the kernel only gets the element
+            self.assertEqual(
+                list(map_elements(lambda element: element.id, volfile, obs_id)),
+                [element.id for element in iter_elements(volfile, obs_id)],
+            )
+
 
 if __name__ == "__main__":
     unittest.main(verbosity=2)
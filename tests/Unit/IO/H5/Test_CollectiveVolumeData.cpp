@@ -0,0 +1,129 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#ifdef SPECTRE_PARALLEL_HDF5
+#include <cstddef>
+#include <mpi.h>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/CollectiveVolumeData.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+std::vector<ElementVolumeData> make_elements(const double offset) {
+  std::vector<ElementVolumeData> elements{};
+  elements.emplace_back(
+      "[B0,(L0I0,L0I0)]",
+      std::vector<TensorComponent>{
+          {"Psi", DataVector{offset, offset + 1.0, offset + 2.0, offset + 3.0}},
+          {"Phi", std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f}}},
+      std::vector<size_t>{2, 2},
+      std::vector<Spectral::Basis>{Spectral::Basis::Legendre,
+                                   Spectral::Basis::Legendre},
+      std::vector<Spectral::Quadrature>{Spectral::Quadrature::GaussLobatto,
+                                        Spectral::Quadrature::GaussLobatto});
+  elements.emplace_back(
+      "[B1,(L0I0,L0I0)]",
+      std::vector<TensorComponent>{
+          {"Psi", DataVector{offset + 4.0, offset + 5.0, offset + 6.0,
+                             offset + 7.0, offset + 8.0, offset + 9.0}},
+          {"Phi", std::vector<float>{5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f}}},
+      std::vector<size_t>{3, 2},
+      std::vector<Spectral::Basis>{Spectral::Basis::Legendre,
+                                   Spectral::Basis::Legendre},
+      std::vector<Spectral::Quadrature>{Spectral::Quadrature::Gauss,
+                                        Spectral::Quadrature::GaussLobatto});
+  return elements;
+}
+
+void test_collective_write() {
+  const std::string collective_file_name =
+      "./Unit.IO.H5.CollectiveVolumeData.h5";
+  const std::string serial_file_name =
+      "./Unit.IO.H5.CollectiveVolumeDataSerial.h5";
+  for (const auto& file_name : {collective_file_name, serial_file_name}) {
+    if (file_system::check_if_file_exists(file_name)) {
+      file_system::rm(file_name, true);
+    }
+  }
+  const std::vector<char> serialized_domain{'a', 'b', 'c'};
+  for (size_t observation_id = 0; observation_id < 2; ++observation_id) {
+    const double observation_value = 1.5 * static_cast<double>(observation_id);
+    const auto elements = make_elements(observation_value);
+    // Only this rank takes part, so the collective write must produce the
+    // same file contents as a serial write.
+    h5::write_volume_data_collectively(
+        MPI_COMM_SELF, collective_file_name, "input", "/element_data", 0,
+        observation_id, observation_value, elements, serialized_domain);
+    h5::H5File<h5::AccessType::ReadWrite> serial_file(serial_file_name, true,
+                                                      "input");
+    serial_file.try_insert<h5::VolumeData>("/element_data", 0)
+        .write_volume_data(observation_id, observation_value, elements,
+                           serialized_domain);
+  }
+  // Nothing is written when no rank has elements
+  h5::write_volume_data_collectively(
+      MPI_COMM_SELF, collective_file_name, "input", "/element_data", 0, 2, 3.0,
+      std::vector<ElementVolumeData>{}, serialized_domain);
+
+  const h5::H5File<h5::AccessType::ReadOnly> collective_file(
+      collective_file_name);
+  const h5::H5File<h5::AccessType::ReadOnly> serial_file(serial_file_name);
+  const auto& collective_volume =
+      collective_file.get<h5::VolumeData>("/element_data");
+  const auto& serial_volume = serial_file.get<h5::VolumeData>("/element_data");
+  CHECK(collective_volume.get_dimension() == 2);
+  const auto observation_ids = serial_volume.list_observation_ids();
+  CHECK(collective_volume.list_observation_ids() == observation_ids);
+  for (const size_t observation_id : observation_ids) {
+    CHECK(collective_volume.get_observation_value(observation_id) ==
+          serial_volume.get_observation_value(observation_id));
+    CHECK(collective_volume.get_grid_names(observation_id) ==
+          serial_volume.get_grid_names(observation_id));
+    CHECK(collective_volume.get_extents(observation_id) ==
+          serial_volume.get_extents(observation_id));
+    CHECK(collective_volume.get_bases(observation_id) ==
+          serial_volume.get_bases(observation_id));
+    CHECK(collective_volume.get_quadratures(observation_id) ==
+          serial_volume.get_quadratures(observation_id));
+    CHECK(collective_volume.get_domain(observation_id) ==
+          serial_volume.get_domain(observation_id));
+    CHECK(collective_volume.list_tensor_components(observation_id) ==
+          serial_volume.list_tensor_components(observation_id));
+    CHECK(std::get<DataVector>(
+              collective_volume.get_tensor_component(observation_id, "Psi")
+                  .data) ==
+          std::get<DataVector>(
+              serial_volume.get_tensor_component(observation_id, "Psi").data));
+    CHECK(std::get<std::vector<float>>(
+              collective_volume.get_tensor_component(observation_id, "Phi")
+                  .data) ==
+          std::get<std::vector<float>>(
+              serial_volume.get_tensor_component(observation_id, "Phi").data));
+  }
+
+  for (const auto& file_name : {collective_file_name, serial_file_name}) {
+    if (file_system::check_if_file_exists(file_name)) {
+      file_system::rm(file_name, true);
+    }
+  }
+}
+}  // namespace
+#endif  // SPECTRE_PARALLEL_HDF5
+
+SPECTRE_TEST_CASE("Unit.IO.H5.CollectiveVolumeData", "[Unit][IO][H5]") {
+#ifdef SPECTRE_PARALLEL_HDF5
+  test_collective_write();
+#endif  // SPECTRE_PARALLEL_HDF5
+}
@@ -262,6 +262,21 @@ void test_core_functionality() {
     }();
     CHECK(subset == answer);
   }
+  {
+    // A run of consecutive columns together with a separate column
+    const auto subset = error_file.get_data_subset({0, 2, 3}, 2, 2);
+    const Matrix answer = []() {
+      Matrix result(2, 3);
+      result(0, 0) = 0.22;
+      result(0, 1) = 0.6;
+      result(0, 2) = 0.8;
+      result(1, 0) = 0.33;
+      result(1, 1) = 0.77;
+      result(1, 2) = 0.9;
+      return result;
+    }();
+    CHECK(subset == answer);
+  }
   {
     const auto subset = error_file.get_data_subset({}, 0, 2);
     const Matrix answer(2, 0, 0.0);
@@ -399,6 +414,37 @@ void test_dat_read() {
     file_system::rm(h5_file_name, true);
   }
 }
+
+void test_rows_per_chunk() {
+  const std::string h5_file_name("Unit.IO.H5.DatRowsPerChunk.h5");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const std::vector<std::string> legend{"Time", "Value"};
+  Matrix expected(5, 2);
+  {
+    h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+    auto& dat_file = my_file.insert<h5::Dat>("/Values", legend, 1, 3);
+    for (size_t i = 0; i < 5; ++i) {
+      expected(i, 0) = static_cast<double>(i);
+      expected(i, 1) = 0.5 * static_cast<double>(i);
+      dat_file.append(std::vector<double>{expected(i, 0), expected(i, 1)});
+    }
+  }
+  {
+    const h5::H5File<h5::AccessType::ReadOnly> my_file(h5_file_name);
+    const auto& dat_file = my_file.get<h5::Dat>("/Values");
+    CHECK(dat_file.get_data() == expected);
+    // Rows spanning two chunks
+    const Matrix subset = dat_file.get_data_subset({0, 1}, 2, 2);
+    CHECK(subset(0, 1) == expected(2, 1));
+    CHECK(subset(1, 1) == expected(3, 1));
+  }
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
 }  // namespace
 
 // [[TimeOut, 10]]
@@ -406,4 +452,5 @@ SPECTRE_TEST_CASE("Unit.IO.H5.Dat", "[Unit][IO][H5]") {
   test_errors();
   test_core_functionality();
   test_dat_read();
+  test_rows_per_chunk();
 }
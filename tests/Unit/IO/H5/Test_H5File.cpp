@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <hdf5.h>
 #include <memory>
 #include <regex>
@@ -107,6 +108,32 @@ void test_core_functionality() {
   }
 }
 
+void test_external_source_archive() {
+  const std::string h5_file_name("Unit.IO.H5.File.ExternalArchive.h5");
+  const std::string archive_directory("Unit.IO.H5.File.ExternalArchive");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  if (file_system::check_if_dir_exists(archive_directory)) {
+    file_system::rm(archive_directory, true);
+  }
+  file_system::create_directory(archive_directory);
+  setenv("SPECTRE_SOURCE_ARCHIVE_DIRECTORY", archive_directory.c_str(), 1);
+  {
+    h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+    // The archive is not embedded in the file
+    CHECK(my_file.groups().empty());
+  }
+  unsetenv("SPECTRE_SOURCE_ARCHIVE_DIRECTORY");
+  CHECK(file_system::ls(archive_directory).size() == 1);
+  const h5::H5File<h5::AccessType::ReadOnly> my_file(h5_file_name);
+  CHECK(my_file.get<h5::SourceArchive>("/src").get_archive() ==
+        formaline::get_archive());
+
+  file_system::rm(h5_file_name, true);
+  file_system::rm(archive_directory, true);
+}
+
 void test_file_move() {
   const std::string h5_file_name("Unit.IO.H5.FileMove.h5");
   const std::string h5_file_name2("Unit.IO.H5.FileMove2.h5");
@@ -251,5 +278,6 @@ SPECTRE_TEST_CASE("Unit.IO.H5.File", "[Unit][IO][H5]") {
   test_access_type();
   test_core_functionality();
   test_error_messages();
+  test_external_source_archive();
   test_file_move();
 }
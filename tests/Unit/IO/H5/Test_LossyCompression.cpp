@@ -0,0 +1,176 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <hdf5.h>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Helpers.hpp"
+#include "IO/H5/LossyCompression.hpp"
+#include "IO/H5/OpenGroup.hpp"
+#include "IO/H5/Wrappers.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/GetOutput.hpp"
+
+namespace {
+template <typename T>
+std::vector<T> make_data() {
+  std::vector<T> data(1000);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<T>(std::sin(0.1 * static_cast<double>(i)) *
+                             std::pow(10.0, static_cast<double>(i % 7) - 3.0));
+  }
+  data[0] = 0.0;
+  return data;
+}
+
+template <typename T>
+void test_round_mantissa() {
+  for (const double relative_error : {0.5, 1.0e-2, 1.0e-4, 1.0e-6}) {
+    CAPTURE(relative_error);
+    for (const T value : make_data<T>()) {
+      const T rounded = h5::detail::round_mantissa(value, relative_error);
+      CHECK(std::abs(static_cast<double>(rounded) -
+                     static_cast<double>(value)) <=
+            relative_error * std::abs(static_cast<double>(value)));
+    }
+  }
+  // Values are unchanged if the error bound is below the precision of `T`
+  CHECK(h5::detail::round_mantissa(static_cast<T>(1.0 / 3.0), 1.0e-20) ==
+        static_cast<T>(1.0 / 3.0));
+  // A carry out of the mantissa increments the exponent
+  CHECK(h5::detail::round_mantissa(static_cast<T>(1.99999), 1.0e-2) ==
+        static_cast<T>(2.0));
+  CHECK(h5::detail::round_mantissa(std::numeric_limits<T>::max(), 1.0e-2) ==
+        std::numeric_limits<T>::max());
+  CHECK(std::isinf(h5::detail::round_mantissa(
+      std::numeric_limits<T>::infinity(), 1.0e-2)));
+}
+
+template <typename T>
+void test_write(const hid_t group_id) {
+  const auto data = make_data<T>();
+  const double relative_error = 1.0e-3;
+  const h5::LossyCompression bit_rounding{
+      h5::LossyCompressionMethod::BitRounding, std::nullopt, relative_error};
+  h5::write_data(group_id, data, "bit_rounding", bit_rounding);
+  CHECK_THROWS_WITH(
+      h5::write_data(group_id, data, "bit_rounding", bit_rounding),
+      Catch::Matchers::ContainsSubstring("already exists"));
+  h5::write_data(group_id, data, "bit_rounding", bit_rounding, true);
+  const auto data_from_file =
+      h5::read_data<1, std::vector<T>>(group_id, "bit_rounding");
+  REQUIRE(data_from_file.size() == data.size());
+  for (size_t i = 0; i < data.size(); ++i) {
+    CHECK(std::abs(static_cast<double>(data_from_file[i]) -
+                   static_cast<double>(data[i])) <=
+          relative_error * std::abs(static_cast<double>(data[i])));
+  }
+  const hid_t dataset_id =
+      H5Dopen2(group_id, "bit_rounding", h5::h5p_default());
+  CHECK_H5(dataset_id, "Failed to open dataset");
+  CHECK(h5::read_value_attribute<std::string>(dataset_id,
+                                              "lossy_compression") ==
+        "BitRounding(RelativeError=0.001)");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+
+  const h5::LossyCompression zfp{h5::LossyCompressionMethod::Zfp, 1.0e-4,
+                                 std::nullopt};
+  if (H5Zfilter_avail(32013) > 0) {
+    h5::write_data(group_id, data, "zfp", zfp);
+    const auto zfp_data_from_file =
+        h5::read_data<1, std::vector<T>>(group_id, "zfp");
+    REQUIRE(zfp_data_from_file.size() == data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+      CHECK(std::abs(static_cast<double>(zfp_data_from_file[i]) -
+                     static_cast<double>(data[i])) <= 1.0e-4);
+    }
+  } else {
+    CHECK_THROWS_WITH(
+        h5::write_data(group_id, data, "zfp", zfp),
+        Catch::Matchers::ContainsSubstring("H5Z-ZFP filter plugin"));
+  }
+}
+
+void test_options() {
+  CHECK(get_output(h5::LossyCompressionMethod::BitRounding) == "BitRounding");
+  CHECK(get_output(h5::LossyCompressionMethod::Zfp) == "Zfp");
+  CHECK(TestHelpers::test_creation<h5::LossyCompressionMethod>("Zfp") ==
+        h5::LossyCompressionMethod::Zfp);
+  const auto created = TestHelpers::test_creation<h5::LossyCompression>(
+      "Method: BitRounding\n"
+      "AbsoluteError: None\n"
+      "RelativeError: 1.0e-3\n");
+  const h5::LossyCompression expected{h5::LossyCompressionMethod::BitRounding,
+                                      std::nullopt, 1.0e-3};
+  CHECK(created == expected);
+  CHECK(created != h5::LossyCompression{h5::LossyCompressionMethod::Zfp,
+                                        std::nullopt, 1.0e-3});
+  CHECK(serialize_and_deserialize(created) == expected);
+  CHECK(get_output(h5::LossyCompression{h5::LossyCompressionMethod::Zfp, 0.5,
+                                        std::nullopt}) ==
+        "Zfp(AbsoluteError=0.5)");
+
+  CHECK_THROWS_WITH(
+      TestHelpers::test_creation<h5::LossyCompressionMethod>("Sz"),
+      Catch::Matchers::ContainsSubstring(
+          "Failed to convert \"Sz\" to LossyCompressionMethod"));
+  CHECK_THROWS_WITH(TestHelpers::test_creation<h5::LossyCompression>(
+                        "Method: Zfp\n"
+                        "AbsoluteError: 1.0e-3\n"
+                        "RelativeError: 1.0e-3\n"),
+                    Catch::Matchers::ContainsSubstring("exactly one of"));
+  CHECK_THROWS_WITH(TestHelpers::test_creation<h5::LossyCompression>(
+                        "Method: Zfp\n"
+                        "AbsoluteError: None\n"
+                        "RelativeError: None\n"),
+                    Catch::Matchers::ContainsSubstring("exactly one of"));
+  CHECK_THROWS_WITH(TestHelpers::test_creation<h5::LossyCompression>(
+                        "Method: Zfp\n"
+                        "AbsoluteError: -1.0\n"
+                        "RelativeError: None\n"),
+                    Catch::Matchers::ContainsSubstring("must be positive"));
+  CHECK_THROWS_WITH(TestHelpers::test_creation<h5::LossyCompression>(
+                        "Method: BitRounding\n"
+                        "AbsoluteError: 1.0e-3\n"
+                        "RelativeError: None\n"),
+                    Catch::Matchers::ContainsSubstring(
+                        "BitRounding only supports a 'RelativeError'"));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.LossyCompression", "[Unit][IO][H5]") {
+  test_options();
+  test_round_mantissa<float>();
+  test_round_mantissa<double>();
+
+  const std::string h5_file_name("Unit.IO.H5.LossyCompression.h5");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const hid_t file_id = H5Fcreate(h5_file_name.c_str(), h5::h5f_acc_trunc(),
+                                  h5::h5p_default(), h5::h5p_default());
+  CHECK_H5(file_id, "Failed to open file: " << h5_file_name);
+  {
+    const h5::detail::OpenGroup float_group(file_id, "Float",
+                                            h5::AccessType::ReadWrite);
+    test_write<float>(float_group.id());
+    const h5::detail::OpenGroup double_group(file_id, "Double",
+                                             h5::AccessType::ReadWrite);
+    test_write<double>(double_group.id());
+  }
+  CHECK_H5(H5Fclose(file_id), "Failed to close file: '" << h5_file_name << "'");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
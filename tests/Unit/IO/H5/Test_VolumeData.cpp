@@ -337,6 +337,38 @@ void test() {
                                Spectral::Quadrature::GaussLobatto));
   }
 
+  {
+    INFO("get_tensor_component for a subset of the points");
+    const size_t observation_id = observation_ids.front();
+    CHECK(get<DataType>(
+              volume_file.get_tensor_component(observation_id, "U", {{8, 8}})
+                  .data) ==
+          DataType{9., 10., 11., 12., 13., 14., 15., 16.});
+    CHECK(get<DataType>(volume_file
+                            .get_tensor_component(observation_id, "U",
+                                                  {{1, 2}, {3, 0}, {10, 3}})
+                            .data) == DataType{2., 3., 11., 12., 13.});
+    CHECK(get<DataType>(
+              volume_file.get_tensor_component(observation_id, "U", {}).data)
+              .empty());
+    CHECK_THROWS_WITH(
+        volume_file.get_tensor_component(observation_id, "U", {{10, 7}}),
+        Catch::Matchers::ContainsSubstring("with only 16 points"));
+  }
+
+  {
+    INFO("read_tensor_component for a subset of the points");
+    const size_t observation_id = observation_ids.front();
+    std::vector<double> buffer(5);
+    volume_file.read_tensor_component(buffer, observation_id, "U",
+                                      {{1, 2}, {3, 0}, {10, 3}});
+    CHECK(buffer == std::vector<double>{2., 3., 11., 12., 13.});
+    CHECK_THROWS_WITH(
+        volume_file.read_tensor_component(buffer, observation_id, "U",
+                                          {{8, 8}}),
+        Catch::Matchers::ContainsSubstring("but the buffer has size 5"));
+  }
+
   if (file_system::check_if_file_exists(h5_file_name)) {
     file_system::rm(h5_file_name, true);
   }
@@ -189,6 +189,38 @@ class TestVolumeData(unittest.TestCase):
                 )[0:8],
                 expected_tensor_component_data,
             )
+        # Read directly into a preallocated buffer
+        for i, expected_tensor_component_data in enumerate(
+            self.tensor_component_data[:2]
+        ):
+            expected = np.asarray(
+                self.vol_file.get_tensor_component(
+                    observation_id=obs_id,
+                    tensor_component=expected_tensor_component_names[i],
+                ).data
+            )
+            buffer = np.zeros((2, len(expected)))
+            self.vol_file.read_tensor_component(
+                buffer[1], obs_id, expected_tensor_component_names[i]
+            )
+            npt.assert_equal(buffer[1], expected)
+            npt.assert_equal(buffer[0], 0.0)
+            # Read only a subset of the points
+            subset = np.zeros(5)
+            self.vol_file.read_tensor_component(
+                subset,
+                obs_id,
+                expected_tensor_component_names[i],
+                offsets_and_lengths=[(1, 2), (4, 3)],
+            )
+            npt.assert_equal(
+                subset, np.concatenate([expected[1:3], expected[4:7]])
+            )
+        with self.assertRaises(TypeError):
+            # A strided view would be read into a copy
+            self.vol_file.read_tensor_component(
+                np.zeros((len(expected), 2))[:, 0], obs_id, "field_1"
+            )
 
     def test_get_data_by_element(self):
         obs_id = 0
@@ -0,0 +1,70 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Creators/Rectilinear.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Importers/InterpolationPlan.hpp"
+
+SPECTRE_TEST_CASE("Unit.IO.Importers.InterpolationPlan", "[Unit][IO]") {
+  const domain::creators::Rectangle domain_creator{
+      {{0., 0.}}, {{2., 1.}}, {{1, 0}}, {{3, 3}}};
+  const auto domain = domain_creator.create_domain();
+  const ElementId<2> left_element_id{0, {{SegmentId{1, 0}, SegmentId{0, 0}}}};
+  const ElementId<2> right_element_id{0, {{SegmentId{1, 1}, SegmentId{0, 0}}}};
+  tnsr::I<DataVector, 2, Frame::Inertial> target_points{};
+  get<0>(target_points) = DataVector{0.5, 1.5, 0.25};
+  get<1>(target_points) = DataVector{0.5, 0.5, 0.};
+
+  const importers::InterpolationPlan<2> plan{
+      target_points, domain, 0., {}, {left_element_id, right_element_id}};
+  CHECK(plan.target_points == target_points);
+  REQUIRE(plan.source_elements.size() == 2);
+  for (const auto& source_element : plan.source_elements) {
+    CAPTURE(source_element.grid_name);
+    if (source_element.grid_name == "[B0,(L1I0,L0I0)]") {
+      CHECK(source_element.target_offsets == std::vector<size_t>{0, 2});
+      CHECK_ITERABLE_APPROX(get<0>(source_element.target_logical_coords),
+                            (DataVector{0., -0.5}));
+      CHECK_ITERABLE_APPROX(get<1>(source_element.target_logical_coords),
+                            (DataVector{0., -1.}));
+    } else {
+      CHECK(source_element.grid_name == "[B0,(L1I1,L0I0)]");
+      CHECK(source_element.target_offsets == std::vector<size_t>{1});
+      CHECK_ITERABLE_APPROX(get<0>(source_element.target_logical_coords),
+                            DataVector{0.});
+      CHECK_ITERABLE_APPROX(get<1>(source_element.target_logical_coords),
+                            DataVector{0.});
+    }
+  }
+
+  // Only the source elements in the volume data file are considered
+  const importers::InterpolationPlan<2> partial_plan{
+      target_points, domain, 0., {}, {right_element_id}};
+  REQUIRE(partial_plan.source_elements.size() == 1);
+  CHECK(partial_plan.source_elements[0].target_offsets ==
+        std::vector<size_t>{1});
+  const importers::InterpolationPlan<2> empty_plan{target_points, domain, 0.,
+                                                   {}, {}};
+  CHECK(empty_plan.target_points == target_points);
+  CHECK(empty_plan.source_elements.empty());
+
+  const auto deserialized_plan = serialize_and_deserialize(partial_plan);
+  CHECK(deserialized_plan.target_points == target_points);
+  REQUIRE(deserialized_plan.source_elements.size() == 1);
+  CHECK(deserialized_plan.source_elements[0].grid_name == "[B0,(L1I1,L0I0)]");
+  CHECK(deserialized_plan.source_elements[0].target_offsets ==
+        std::vector<size_t>{1});
+  CHECK(deserialized_plan.source_elements[0].target_logical_coords ==
+        partial_plan.source_elements[0].target_logical_coords);
+}
@@ -26,6 +26,10 @@ SPECTRE_TEST_CASE("Unit.IO.Importers.Tags", "[Unit][IO]") {
       "RegisteredElements");
   TestHelpers::db::test_simple_tag<importers::Tags::ElementDataAlreadyRead>(
       "ElementDataAlreadyRead");
+  TestHelpers::db::test_simple_tag<importers::Tags::VolumeFileCache>(
+      "VolumeFileCache");
+  TestHelpers::db::test_simple_tag<importers::Tags::InterpolationPlans<3>>(
+      "InterpolationPlans");
   TestHelpers::db::test_simple_tag<
       importers::Tags::ImporterOptions<ExampleVolumeData>>("VolumeData");
 
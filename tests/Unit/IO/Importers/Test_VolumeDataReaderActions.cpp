@@ -271,6 +271,9 @@ void test_actions(const std::variant<double, importers::ObservationSelector>&
           get<TensorTag>(all_sample_data.at(id)));
     first_invocation = false;
   }
+  // The files stay open for subsequent reads
+  CHECK(get_reader_tag(importers::Tags::VolumeFileCache{})
+            .number_of_open_files() == 2);
 
   for (size_t i = 0; i < all_element_data.size(); ++i) {
     const std::string h5_file_name =
@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/Importers/VolumeFileCache.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/FileSystem.hpp"
+
+SPECTRE_TEST_CASE("Unit.IO.Importers.VolumeFileCache", "[Unit][IO]") {
+  const std::string h5_file_name = "Unit.IO.Importers.VolumeFileCache.h5";
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const std::vector<std::string> grid_names{"[B0,(L0I0,L0I0)]",
+                                            "[B0,(L1I0,L0I0)]",
+                                            "[B0,(L1I1,L0I0)]"};
+  const std::vector<std::vector<size_t>> extents{{2, 2}, {3, 2}, {4, 3}};
+  const std::vector<std::vector<Spectral::Basis>> bases{
+      {2, Spectral::Basis::Legendre},
+      {2, Spectral::Basis::Chebyshev},
+      {2, Spectral::Basis::Legendre}};
+  const std::vector<std::vector<Spectral::Quadrature>> quadratures{
+      {2, Spectral::Quadrature::GaussLobatto},
+      {2, Spectral::Quadrature::Gauss},
+      {2, Spectral::Quadrature::GaussLobatto}};
+  {
+    std::vector<ElementVolumeData> elements{};
+    for (size_t i = 0; i < grid_names.size(); ++i) {
+      const size_t num_points = extents[i][0] * extents[i][1];
+      elements.push_back({grid_names[i],
+                          {TensorComponent{
+                              "U", DataVector(num_points,
+                                              static_cast<double>(i))}},
+                          extents[i],
+                          bases[i],
+                          quadratures[i]});
+    }
+    h5::H5File<h5::AccessType::ReadWrite> h5_file{h5_file_name};
+    auto& volume_data = h5_file.insert<h5::VolumeData>("/element_data", 0);
+    volume_data.write_volume_data(3, 1.5, elements);
+    volume_data.write_volume_data(4, 2.5, {elements.front()});
+  }
+
+  importers::VolumeFileCache cache{};
+  CHECK(cache.number_of_open_files() == 0);
+  const auto& volume_file = cache.volume_file(h5_file_name, "/element_data");
+  CHECK(cache.number_of_open_files() == 1);
+  CHECK(&cache.volume_file(h5_file_name, "/element_data") == &volume_file);
+  CHECK(volume_file.list_observation_ids() == std::vector<size_t>{3, 4});
+  CHECK(get<DataVector>(volume_file.get_tensor_component(3, "U", {{10, 6}})
+                            .data) == DataVector(6, 2.));
+
+  const auto check_index = [&grid_names, &extents](
+                               const importers::VolumeFileIndex& index) {
+    CHECK(index.observation_id() == 3);
+    CHECK(index.observation_value() == 1.5);
+    CHECK(index.grid_names() == grid_names);
+    for (const auto& grid_name : grid_names) {
+      CHECK(index.contains(grid_name));
+      CHECK(index.offset_and_length(grid_name) ==
+            h5::offset_and_length_for_grid(grid_name, grid_names, extents));
+    }
+    CHECK_FALSE(index.contains("[B1,(L0I0,L0I0)]"));
+    CHECK(index.mesh<2>(grid_names[1]) ==
+          Mesh<2>{{{3, 2}},
+                  Spectral::Basis::Chebyshev,
+                  Spectral::Quadrature::Gauss});
+    CHECK(index.mesh<2>(grid_names[2]) ==
+          Mesh<2>{{{4, 3}},
+                  Spectral::Basis::Legendre,
+                  Spectral::Quadrature::GaussLobatto});
+    CHECK_THROWS_WITH(index.offset_and_length("[B1,(L0I0,L0I0)]"),
+                      Catch::Matchers::ContainsSubstring(
+                          "Found no grid named '[B1,(L0I0,L0I0)]'"));
+  };
+  const auto& index = cache.index(h5_file_name, "/element_data", 3);
+  check_index(index);
+  CHECK(&cache.index(h5_file_name, "/element_data", 3) == &index);
+  const auto& other_index = cache.index(h5_file_name, "/element_data", 4);
+  CHECK(other_index.grid_names() == std::vector<std::string>{grid_names[0]});
+  CHECK(other_index.offset_and_length(grid_names[0]) ==
+        std::pair<size_t, size_t>{0, 4});
+  CHECK(cache.number_of_open_files() == 1);
+
+  // Only the indices are serialized, and they don't need the file to be open
+  auto deserialized_cache = serialize_and_deserialize(cache);
+  CHECK(deserialized_cache.number_of_open_files() == 0);
+  check_index(deserialized_cache.index(h5_file_name, "/element_data", 3));
+  CHECK(deserialized_cache.number_of_open_files() == 0);
+  deserialized_cache.volume_file(h5_file_name, "/element_data");
+  CHECK(deserialized_cache.number_of_open_files() == 1);
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
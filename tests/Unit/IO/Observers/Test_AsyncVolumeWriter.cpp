@@ -0,0 +1,135 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+observers::VolumeWriteRequest make_request(const std::string& file_name,
+                                           const size_t observation_hash,
+                                           const double observation_value) {
+  observers::VolumeWriteRequest request{};
+  request.file_name = file_name;
+  request.subfile_name = "/element_data";
+  request.observation_hash = observation_hash;
+  request.observation_value = observation_value;
+  request.volume_data.emplace_back(
+      "[B0,(L0I0)]",
+      std::vector<TensorComponent>{
+          {"Scalar", DataVector{observation_value, 2.0 * observation_value}}},
+      std::vector<size_t>{2},
+      std::vector<Spectral::Basis>{Spectral::Basis::Legendre},
+      std::vector<Spectral::Quadrature>{Spectral::Quadrature::GaussLobatto});
+  return request;
+}
+
+void check_file(const std::string& file_name,
+                const std::vector<double>& observation_values) {
+  REQUIRE(file_system::check_if_file_exists(file_name));
+  const h5::H5File<h5::AccessType::ReadOnly> file(file_name);
+  const auto& volume_file = file.get<h5::VolumeData>("/element_data");
+  const auto observation_ids = volume_file.list_observation_ids();
+  REQUIRE(observation_ids.size() == observation_values.size());
+  for (size_t i = 0; i < observation_values.size(); ++i) {
+    CHECK(volume_file.get_observation_value(observation_ids[i]) ==
+          observation_values[i]);
+    const auto component =
+        volume_file.get_tensor_component(observation_ids[i], "Scalar");
+    CHECK(std::get<DataVector>(component.data) ==
+          DataVector{observation_values[i], 2.0 * observation_values[i]});
+  }
+}
+
+void test_writes(const size_t number_of_buffers) {
+  const std::string file_name = "./Unit.IO.Observers.AsyncVolumeWriter" +
+                                std::to_string(number_of_buffers) + ".h5";
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  Parallel::NodeLock h5_file_lock{};
+  std::vector<double> observation_values{};
+  {
+    observers::AsyncVolumeWriter writer{number_of_buffers};
+    CHECK(writer.number_of_buffers() == number_of_buffers);
+    // Queue more observations than there are buffers so that `write` has to
+    // wait for the I/O thread.
+    for (size_t i = 0; i < 5; ++i) {
+      observation_values.push_back(static_cast<double>(i) + 0.5);
+      const double blocked_time =
+          writer.write(make_not_null(&h5_file_lock),
+                       make_request(file_name, i, observation_values.back()));
+      CHECK(blocked_time >= 0.0);
+    }
+    writer.wait_until_written();
+    const auto statistics = writer.statistics();
+    CHECK(statistics.writes == 5);
+    CHECK(statistics.blocked_writes <= 5);
+    CHECK(statistics.blocked_time >= 0.0);
+    CHECK(statistics.write_time > 0.0);
+    CHECK(writer.wait_until_written(0.0));
+    check_file(file_name, observation_values);
+
+    // Only one waiter is armed at a time, and it is disarmed once the data is
+    // on disk
+    CHECK(writer.arm_waiter());
+    CHECK_FALSE(writer.arm_waiter());
+    CHECK(writer.wait_until_written_and_disarm(1.0));
+    CHECK(writer.arm_waiter());
+    CHECK(writer.wait_until_written_and_disarm(1.0));
+
+    // The destructor writes the pending data
+    observation_values.push_back(10.0);
+    writer.write(make_not_null(&h5_file_lock),
+                 make_request(file_name, 10, observation_values.back()));
+  }
+  check_file(file_name, observation_values);
+
+  // Serializing waits for the data to be written
+  {
+    observers::AsyncVolumeWriter writer{number_of_buffers};
+    observation_values.push_back(11.0);
+    writer.write(make_not_null(&h5_file_lock),
+                 make_request(file_name, 11, observation_values.back()));
+    const auto deserialized_writer = serialize_and_deserialize(writer);
+    CHECK(deserialized_writer.number_of_buffers() == number_of_buffers);
+    CHECK(deserialized_writer.statistics().writes == 0);
+    check_file(file_name, observation_values);
+
+    // A moved writer keeps its I/O thread
+    observers::AsyncVolumeWriter moved_writer = std::move(writer);
+    observation_values.push_back(12.0);
+    moved_writer.write(make_not_null(&h5_file_lock),
+                       make_request(file_name, 12, observation_values.back()));
+    moved_writer.wait_until_written();
+    CHECK(moved_writer.statistics().writes == 2);
+  }
+  check_file(file_name, observation_values);
+
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.AsyncVolumeWriter", "[Unit][Observers]") {
+  test_writes(1);
+  test_writes(2);
+}
@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+#include "IO/Observer/CollectiveVolumeWrites.hpp"
+#include "IO/Observer/ObservationId.hpp"
+
+namespace {
+observers::VolumeWriteRequest make_request(
+    const observers::ObservationId& observation_id) {
+  observers::VolumeWriteRequest request{};
+  request.file_name = "Volume.h5";
+  request.subfile_name = "/element_data";
+  request.observation_hash = observation_id.hash();
+  request.observation_value = observation_id.value();
+  request.collective = true;
+  return request;
+}
+
+std::vector<double> observation_values(
+    const std::vector<observers::VolumeWriteRequest>& requests) {
+  std::vector<double> result{};
+  for (const auto& request : requests) {
+    result.push_back(request.observation_value);
+  }
+  return result;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.CollectiveVolumeWrites",
+                  "[Unit][Observers]") {
+  const observers::ObservationId first{1.0, "ObserveFields"};
+  const observers::ObservationId second{2.0, "ObserveFields"};
+  const int number_of_nodes = 3;
+
+  // Node 0 agrees on the order of the writes with all nodes
+  observers::CollectiveVolumeWrites node_zero{};
+  auto readiness = node_zero.node_is_ready(second, 1, number_of_nodes);
+  CHECK(readiness.first_node);
+  CHECK_FALSE(readiness.sequence_number.has_value());
+  readiness = node_zero.node_is_ready(first, 2, number_of_nodes);
+  CHECK(readiness.first_node);
+  CHECK_FALSE(readiness.sequence_number.has_value());
+  readiness = node_zero.node_is_ready(second, 0, number_of_nodes);
+  CHECK_FALSE(readiness.first_node);
+  CHECK_FALSE(readiness.sequence_number.has_value());
+  CHECK_THROWS_WITH(node_zero.node_is_ready(second, 0, number_of_nodes),
+                    Catch::Matchers::ContainsSubstring(
+                        "Node 0 is already ready for the collective write"));
+  node_zero = serialize_and_deserialize(node_zero);
+  readiness = node_zero.node_is_ready(second, 2, number_of_nodes);
+  CHECK_FALSE(readiness.first_node);
+  CHECK(readiness.sequence_number == std::optional<size_t>{0});
+  readiness = node_zero.node_is_ready(first, 1, number_of_nodes);
+  CHECK_FALSE(readiness.sequence_number.has_value());
+  readiness = node_zero.node_is_ready(first, 0, number_of_nodes);
+  CHECK(readiness.sequence_number == std::optional<size_t>{1});
+
+  // The writes are handed out in the order of the sequence numbers, however
+  // the messages with the sequence numbers arrive
+  observers::CollectiveVolumeWrites node{};
+  node.stage(first, make_request(first));
+  node.stage(second, make_request(second));
+  CHECK_THROWS_WITH(node.stage(second, make_request(second)),
+                    Catch::Matchers::ContainsSubstring(
+                        "Already staged volume data for a collective write"));
+  CHECK(node.schedule(1, first).empty());
+  node = serialize_and_deserialize(node);
+  CHECK(observation_values(node.schedule(0, second)) ==
+        std::vector<double>{2.0, 1.0});
+  CHECK_THROWS_WITH(node.schedule(0, second),
+                    Catch::Matchers::ContainsSubstring("was already scheduled"));
+
+  // A write that was not staged can't be handed out
+  CHECK_THROWS_WITH(node.schedule(2, first),
+                    Catch::Matchers::ContainsSubstring(
+                        "No volume data was staged for the collective write"));
+}
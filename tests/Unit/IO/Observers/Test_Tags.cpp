@@ -33,9 +33,15 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   TestHelpers::db::test_simple_tag<ReductionDataNames<double>>(
       "ReductionDataNames");
   TestHelpers::db::test_simple_tag<H5FileLock>("H5FileLock");
+  TestHelpers::db::test_simple_tag<AsyncVolumeWriter>("AsyncVolumeWriter");
+  TestHelpers::db::test_simple_tag<CollectiveVolumeWrites>(
+      "CollectiveVolumeWrites");
   TestHelpers::db::test_simple_tag<ObservationKey<TestTag>>(
       "ObservationKey(TestTag)");
   TestHelpers::db::test_simple_tag<VolumeFileName>("VolumeFileName");
+  TestHelpers::db::test_simple_tag<CollectiveVolumeOutput>(
+      "CollectiveVolumeOutput");
+  CHECK_FALSE(CollectiveVolumeOutput::create_from_options(false));
   TestHelpers::db::test_simple_tag<ReductionFileName>("ReductionFileName");
   TestHelpers::db::test_simple_tag<SurfaceFileName>("SurfaceFileName");
   static_assert(
@@ -245,7 +245,17 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
   // Invoke the simple action 'ContributeVolumeDataToWriter'
   // to move the volume data to the Writer parallel component.
   runner.invoke_queued_threaded_action<obs_writer>(0);
-  CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
+  // The data is written by the I/O thread of the node, and
+  // 'WaitForVolumeWrites' is queued until it is on disk.
+  while (not ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner,
+                                                                       0)) {
+    runner.invoke_queued_threaded_action<obs_writer>(0);
+  }
+  CHECK(ActionTesting::get_databox_tag<obs_writer,
+                                       observers::Tags::AsyncVolumeWriter>(
+            runner, 0)
+            .statistics()
+            .writes == 1);
 
   REQUIRE(file_system::check_if_file_exists(h5_file_name));
   // Check that the H5 file was written correctly.
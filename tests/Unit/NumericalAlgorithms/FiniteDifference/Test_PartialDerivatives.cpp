@@ -168,6 +168,35 @@ void test(const gsl::not_null<std::mt19937*> generator,
     }
   }
 
+  // The upwinded derivative has order fd_order - 1, so it is also exact for
+  // the polynomial. Use a velocity with both signs and zeros.
+  std::array<DataVector, Dim> logical_velocity{};
+  std::array<gsl::span<const double>, Dim> logical_velocity_view{};
+  for (size_t i = 0; i < Dim; ++i) {
+    gsl::at(logical_velocity, i) = make_with_random_values<DataVector>(
+        generator, dist, DataVector{mesh.number_of_grid_points()});
+    gsl::at(logical_velocity, i)[0] = 0.0;
+    gsl::at(logical_velocity_view, i) =
+        gsl::make_span(gsl::at(logical_velocity, i).data(),
+                       gsl::at(logical_velocity, i).size());
+  }
+  ::fd::logical_upwind_partial_derivatives(
+      make_not_null(&logical_derivative_view),
+      gsl::make_span(volume_vars.data(), volume_vars.size()), ghost_cell_vars,
+      mesh, number_of_vars, fd_order, logical_velocity_view);
+  for (size_t i = 0; i < Dim; ++i) {
+    CAPTURE(i);
+    const DataVector fd_d_var1(&gsl::at(logical_derivative_view, i)[0],
+                               mesh.number_of_grid_points());
+    CHECK_ITERABLE_CUSTOM_APPROX(fd_d_var1, gsl::at(expected_d_var1, i),
+                                 custom_approx);
+    const DataVector fd_d_var2(
+        &gsl::at(logical_derivative_view, i)[mesh.number_of_grid_points()],
+        mesh.number_of_grid_points());
+    CHECK_ITERABLE_CUSTOM_APPROX(fd_d_var2, gsl::at(expected_d_var2, i),
+                                 custom_approx);
+  }
+
   // Test partial derivative with random Jacobian. We know we calculated the
   // logical partial derivatives correctly, just need to make sure we forward to
   // the other functions correctly.
@@ -210,6 +239,57 @@ void test(const gsl::not_null<std::mt19937*> generator,
                                get<d_var2_tag>(expected_partial_derivatives),
                                custom_approx);
 }
+// Check that the upwinded derivative does not depend on the point farthest
+// downwind of the stencil, while the centered derivative does.
+void test_upwind_stencil(const gsl::not_null<std::mt19937*> generator,
+                         const gsl::not_null<std::uniform_real_distribution<>*>
+                             dist,
+                         const size_t fd_order) {
+  CAPTURE(fd_order);
+  const Mesh<1> mesh{2 * fd_order + 2, Spectral::Basis::FiniteDifference,
+                     Spectral::Quadrature::CellCentered};
+  const size_t number_of_points = mesh.number_of_grid_points();
+  const size_t ghost_size = fd_order / 2 + 1;
+  const auto volume_vars = make_with_random_values<DataVector>(
+      generator, dist, DataVector{number_of_points});
+  const auto lower_ghost = make_with_random_values<DataVector>(
+      generator, dist, DataVector{ghost_size});
+  const auto upper_ghost = make_with_random_values<DataVector>(
+      generator, dist, DataVector{ghost_size});
+  DirectionMap<1, gsl::span<const double>> ghost_cell_vars{};
+  ghost_cell_vars[Direction<1>::lower_xi()] =
+      gsl::make_span(lower_ghost.data(), lower_ghost.size());
+  ghost_cell_vars[Direction<1>::upper_xi()] =
+      gsl::make_span(upper_ghost.data(), upper_ghost.size());
+
+  const auto derivative_at = [&mesh, &ghost_cell_vars, &fd_order,
+                              &number_of_points](const DataVector& vars,
+                                                 const double velocity,
+                                                 const size_t point) {
+    const DataVector velocities{number_of_points, velocity};
+    DataVector result{number_of_points};
+    std::array<gsl::span<double>, 1> result_view{
+        {gsl::make_span(result.data(), result.size())}};
+    ::fd::logical_upwind_partial_derivatives(
+        make_not_null(&result_view), gsl::make_span(vars.data(), vars.size()),
+        ghost_cell_vars, mesh, 1, fd_order,
+        {{gsl::make_span(velocities.data(), velocities.size())}});
+    return result[point];
+  };
+
+  const size_t point = number_of_points / 2;
+  for (const double velocity : {1.0, -1.0}) {
+    CAPTURE(velocity);
+    auto perturbed_vars = volume_vars;
+    const size_t downwind_point =
+        velocity > 0.0 ? point + fd_order / 2 : point - fd_order / 2;
+    perturbed_vars[downwind_point] += 1.0;
+    CHECK(derivative_at(perturbed_vars, velocity, point) ==
+          approx(derivative_at(volume_vars, velocity, point)));
+    CHECK(derivative_at(perturbed_vars, 0.0, point) !=
+          approx(derivative_at(volume_vars, 0.0, point)));
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.FiniteDifference.PartialDerivatives",
@@ -223,5 +303,7 @@ SPECTRE_TEST_CASE("Unit.FiniteDifference.PartialDerivatives",
             fd_order);
     test<3>(make_not_null(&generator), make_not_null(&dist), fd_order + 2,
             fd_order);
+    test_upwind_stencil(make_not_null(&generator), make_not_null(&dist),
+                        fd_order);
   }
 }
@@ -4,11 +4,13 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "NumericalAlgorithms/Interpolation/MultiLinearSpanInterpolation.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 
 namespace {
 template <size_t Dim, size_t NumVar>
@@ -144,6 +146,54 @@ void test() {
     CHECK(std::abs(gsl::at(y_expected, nv) - gsl::at(y_interpolated_gen, nv)) <
           epsilon * std::abs(gsl::at(y_expected, nv)));
   }
+
+  // Interpolate the first and last variable to many points at once, using
+  // both table layouts. The number of points is not a multiple of any SIMD
+  // width.
+  const auto cell_interleaved_table =
+      intrp::make_cell_interleaved_table<Dim, NumVar>(
+          {dependent_variables.data(), total_num_points}, num_x_points);
+  intrp::UniformMultiLinearSpanInterpolation<Dim, NumVar> cell_intp(
+      independent_data_view,
+      {cell_interleaved_table.data(), cell_interleaved_table.size()},
+      num_x_points, intrp::TableLayout::CellInterleaved);
+  CHECK(cell_intp.layout() == intrp::TableLayout::CellInterleaved);
+  CHECK(uniform_intp.layout() == intrp::TableLayout::PointInterleaved);
+  for (size_t d = 0; d < Dim; ++d) {
+    cell_intp.extrapolate_above_data(d, true);
+    cell_intp.extrapolate_below_data(d, true);
+  }
+  for (const size_t number_of_points : {1_st, 3_st, 21_st}) {
+    CAPTURE(number_of_points);
+    std::array<DataVector, Dim> points{};
+    std::array<gsl::span<const double>, Dim> points_view{};
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(points, d) = DataVector(number_of_points);
+      for (double& x : gsl::at(points, d)) {
+        x = dist_func(gen);
+      }
+      gsl::at(points_view, d) = gsl::make_span(gsl::at(points, d).data(),
+                                               number_of_points);
+    }
+    for (const auto& interpolator : {uniform_intp, cell_intp}) {
+      DataVector first_var(number_of_points);
+      DataVector last_var(number_of_points);
+      std::array<gsl::span<double>, 2> result{
+          {gsl::make_span(first_var.data(), number_of_points),
+           gsl::make_span(last_var.data(), number_of_points)}};
+      interpolator.template interpolate<0, NumVar - 1>(make_not_null(&result),
+                                                       points_view);
+      for (size_t s = 0; s < number_of_points; ++s) {
+        std::array<double, Dim> point_s{};
+        for (size_t d = 0; d < Dim; ++d) {
+          gsl::at(point_s, d) = gsl::at(points, d)[s];
+        }
+        const auto expected = mock_function(point_s);
+        CHECK(first_var[s] == approx(expected[0]));
+        CHECK(last_var[s] == approx(expected[NumVar - 1]));
+      }
+    }
+  }
 }
 }  // namespace
 
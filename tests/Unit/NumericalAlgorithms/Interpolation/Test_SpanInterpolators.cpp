@@ -82,6 +82,49 @@ void test_interpolator_approximate_fidelity(
                                interpolator_approx);
 }
 
+// The complex interpolation must agree with interpolating the real and
+// imaginary parts separately, whether or not the interpolator overrides it.
+template <typename Generator>
+void test_complex_matches_components(const gsl::not_null<Generator*> gen,
+                                     const SpanInterpolator& interpolator) {
+  UniformCustomDistribution<double> value_dist{0.1, 1.0};
+  const size_t number_of_points =
+      2 * interpolator.required_number_of_points_before_and_after() + 2;
+  DataVector interpolator_points{number_of_points};
+  for (size_t i = 0; i < number_of_points; ++i) {
+    interpolator_points[i] = 0.1 * (i + value_dist(*gen));
+  }
+  const auto complex_values = make_with_random_values<ComplexDataVector>(
+      gen, value_dist, number_of_points);
+  const DataVector real_values = real(complex_values);
+  const DataVector imag_values = imag(complex_values);
+  const gsl::span<const double> points_span{interpolator_points.data(),
+                                            number_of_points};
+  const double target_point = 0.1 * number_of_points * value_dist(*gen);
+  const std::complex<double> complex_result = interpolator.interpolate(
+      points_span,
+      gsl::span<const std::complex<double>>{complex_values.data(),
+                                            number_of_points},
+      target_point);
+  CHECK(real(complex_result) ==
+        approx(interpolator.interpolate(
+            points_span,
+            gsl::span<const double>{real_values.data(), number_of_points},
+            target_point)));
+  CHECK(imag(complex_result) ==
+        approx(interpolator.interpolate(
+            points_span,
+            gsl::span<const double>{imag_values.data(), number_of_points},
+            target_point)));
+  // at a source point the interpolation returns the value there
+  CHECK_ITERABLE_APPROX(
+      interpolator.interpolate(points_span,
+                               gsl::span<const std::complex<double>>{
+                                   complex_values.data(), number_of_points},
+                               interpolator_points[1]),
+      complex_values[1]);
+}
+
 SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolation.SpanInterpolators",
                   "[Unit][NumericalAlgorithms]") {
   MAKE_GENERATOR(gen);
@@ -187,6 +230,13 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolation.SpanInterpolators",
         make_not_null(&gen),
         serialize_and_deserialize(BarycentricRationalSpanInterpolator{5u, 6u}),
         interpolator_approx);
+
+    test_complex_matches_components(
+        make_not_null(&gen), BarycentricRationalSpanInterpolator{5u, 6u});
+    test_complex_matches_components(
+        make_not_null(&gen), BarycentricRationalSpanInterpolator{2u, 10u});
   }
+  test_complex_matches_components(make_not_null(&gen),
+                                  LinearSpanInterpolator{});
 }
 }  // namespace intrp
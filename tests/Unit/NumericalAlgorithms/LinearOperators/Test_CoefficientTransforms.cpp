@@ -8,12 +8,16 @@
 #include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/IndexIterator.hpp"
 #include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Tags.hpp"
 #include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
@@ -22,6 +26,7 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
 
@@ -166,11 +171,57 @@ void test_3d(const gsl::not_null<Generator*> generator) {
       mesh,
       {{{order, order - 1, order - 2}}, {{order / 3, order / 3, order / 3}}});
 }
+
+struct Vector : db::SimpleTag {
+  using type = tnsr::I<DataVector, 2>;
+};
+
+void test_modal_coefficients_tags() {
+  TestHelpers::db::test_prefix_tag<Tags::ModalCoefficients<Vector>>(
+      "ModalCoefficients(Vector)");
+  TestHelpers::db::test_compute_tag<Tags::ModalCoefficientsCompute<Vector, 2>>(
+      "ModalCoefficients(Vector)");
+
+  const Mesh<2> mesh{{{3, 4}},
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, 2> vector{};
+  get<0>(vector) = square(get<0>(logical_coords)) + get<1>(logical_coords);
+  get<1>(vector) = 2.0 * get<1>(logical_coords);
+  auto box = db::create<
+      db::AddSimpleTags<domain::Tags::Mesh<2>, Vector>,
+      db::AddComputeTags<Tags::ModalCoefficientsCompute<Vector, 2>>>(mesh,
+                                                                     vector);
+
+  // The coefficients are computed once and then shared by all consumers
+  const size_t transforms_before = number_of_modal_transforms();
+  const auto& modal_coefficients =
+      db::get<Tags::ModalCoefficients<Vector>>(box);
+  CHECK(number_of_modal_transforms() == transforms_before + 2);
+  REQUIRE(modal_coefficients.size() == 2);
+  for (size_t i = 0; i < 2; ++i) {
+    CHECK(modal_coefficients[i] == to_modal_coefficients(vector[i], mesh));
+  }
+  const size_t transforms_after_check = number_of_modal_transforms();
+  db::get<Tags::ModalCoefficients<Vector>>(box);
+  CHECK(number_of_modal_transforms() == transforms_after_check);
+
+  // Changing the tensor recomputes the coefficients
+  db::mutate<Vector>(
+      [](const gsl::not_null<tnsr::I<DataVector, 2>*> local_vector) {
+        get<1>(*local_vector) = 3.0;
+      },
+      make_not_null(&box));
+  CHECK(db::get<Tags::ModalCoefficients<Vector>>(box)[1] ==
+        to_modal_coefficients(get<1>(db::get<Vector>(box)), mesh));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.CoefficientTransforms",
                   "[NumericalAlgorithms][LinearOperators][Unit]") {
   MAKE_GENERATOR(generator);
+  test_modal_coefficients_tags();
   test_1d<ModalVector, DataVector, Spectral::Basis::Legendre,
           Spectral::Quadrature::GaussLobatto>(make_not_null(&generator));
   test_1d<ModalVector, DataVector, Spectral::Basis::Legendre,
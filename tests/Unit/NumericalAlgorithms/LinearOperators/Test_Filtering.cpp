@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <optional>
 #include <string>
 #include <unordered_set>
 
@@ -39,6 +40,8 @@
 #include "ParallelAlgorithms/Actions/FilterAction.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
@@ -278,6 +281,35 @@ void invoke_test_exponential_filter_action(const double alpha,
                                  FilterIndividually>(alpha, half_power, enable);
 }
 
+template <size_t Dim>
+void test_filter_matrices() {
+  // Use filter indices not used by the action tests since the matrices are
+  // cached for each index
+  const Filters::Exponential<2> filter{10.0, 16, true, std::nullopt};
+  std::array<size_t, Dim> extents = make_array<Dim>(5_st);
+  gsl::at(extents, Dim - 1) = 1;
+  const Mesh<Dim> mesh{extents, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::Gauss};
+  const auto matrices = filter.filter_matrices(mesh);
+  for (size_t d = 0; d < Dim - 1; ++d) {
+    CHECK(&gsl::at(matrices, d).get() ==
+          &filter.filter_matrix(mesh.slice_through(d)));
+  }
+  // The filter is the identity in the dimension with a single point
+  CHECK(gsl::at(matrices, Dim - 1).get() == Matrix{});
+  CHECK(filter.is_identity(mesh) == (Dim == 1));
+  CHECK_FALSE(filter.is_identity(
+      Mesh<Dim>{5, Spectral::Basis::Legendre, Spectral::Quadrature::Gauss}));
+
+  const Filters::Exponential<3> no_filter{0.0, 16, true, std::nullopt};
+  const Mesh<Dim> uniform_mesh{5, Spectral::Basis::Chebyshev,
+                               Spectral::Quadrature::GaussLobatto};
+  CHECK(no_filter.is_identity(uniform_mesh));
+  for (const auto& matrix : no_filter.filter_matrices(uniform_mesh)) {
+    CHECK(matrix.get() == Matrix{});
+  }
+}
+
 template <size_t Dim>
 class TestCreator : public DomainCreator<Dim> {
  public:
@@ -445,6 +477,12 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.Filter",
           invoke_test_exponential_filter_action<Dim, false>(alpha, half_power,
                                                             enable);
         }
+        // A vanishing alpha skips filtering without computing the matrices
+        invoke_test_exponential_filter_action<Dim, true>(0.0, half_power,
+                                                         true);
+        invoke_test_exponential_filter_action<Dim, false>(0.0, half_power,
+                                                          true);
+        test_filter_matrices<Dim>();
       });
 
   test_exponential_filter_creation<1>();
@@ -7,9 +7,11 @@
 #include <cmath>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <pup.h>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -402,6 +404,10 @@ void test_partial_derivatives_1d(const Mesh<1>& mesh) {
                         logical_partial_derivatives<GradientTags>(u, mesh),
                         inverse_jacobian);
     CHECK_VARIABLES_CUSTOM_APPROX(du, expected_du, local_approx);
+    vars_type du_diagonal{};
+    partial_derivatives(make_not_null(&du_diagonal), u, mesh,
+                        std::array{2.0});
+    CHECK_VARIABLES_CUSTOM_APPROX(du_diagonal, expected_du, local_approx);
     // We've checked that du is correct, now test that taking derivatives of
     // individual tensors gets the matching result.
     test_partial_derivative_per_tensor(expected_du, u, mesh, inverse_jacobian);
@@ -452,6 +458,11 @@ void test_partial_derivatives_2d(const Mesh<2>& mesh) {
                           inverse_jacobian);
       CHECK_VARIABLES_CUSTOM_APPROX(du_with_logical, expected_du, local_approx);
 
+      vars_type du_diagonal{};
+      partial_derivatives(make_not_null(&du_diagonal), u, mesh,
+                          std::array{2.0, 8.0});
+      CHECK_VARIABLES_CUSTOM_APPROX(du_diagonal, expected_du, local_approx);
+
       // We've checked that du is correct, now test that taking derivatives of
       // individual tensors gets the matching result.
       test_partial_derivative_per_tensor(du, u, mesh, inverse_jacobian);
@@ -507,6 +518,11 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
         CHECK_VARIABLES_CUSTOM_APPROX(du_with_logical, expected_du,
                                       local_approx);
 
+        vars_type du_diagonal{};
+        partial_derivatives(make_not_null(&du_diagonal), u, mesh,
+                            std::array{2.0, 8.0, 4.0});
+        CHECK_VARIABLES_CUSTOM_APPROX(du_diagonal, expected_du, local_approx);
+
         // We've checked that du is correct, now test that taking derivatives of
         // individual tensors gets the matching result.
         test_partial_derivative_per_tensor(du, u, mesh, inverse_jacobian);
@@ -514,6 +530,121 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
     }
   }
 }
+
+void test_constant_diagonal() {
+  InverseJacobian<DataVector, 2, Frame::ElementLogical, Frame::Grid>
+      inverse_jacobian(5, 0.0);
+  inverse_jacobian.get(0, 0) = 2.0;
+  inverse_jacobian.get(1, 1) = 8.0;
+  CHECK(partial_derivatives_detail::constant_diagonal(inverse_jacobian) ==
+        std::optional{std::array{2.0, 8.0}});
+  auto varying_diagonal = inverse_jacobian;
+  varying_diagonal.get(1, 1)[3] = 7.0;
+  CHECK_FALSE(partial_derivatives_detail::constant_diagonal(varying_diagonal)
+                  .has_value());
+  auto off_diagonal = inverse_jacobian;
+  off_diagonal.get(0, 1)[4] = 1.0e-3;
+  CHECK_FALSE(
+      partial_derivatives_detail::constant_diagonal(off_diagonal).has_value());
+  CHECK_FALSE(partial_derivatives_detail::constant_diagonal(
+                  InverseJacobian<DataVector, 2, Frame::ElementLogical,
+                                  Frame::Grid>{})
+                  .has_value());
+}
+
+void test_factored_partial_derivatives(const Mesh<3>& mesh) {
+  using VariableTags =
+      tmpl::list<Var1<DataVector, 3, Frame::Inertial>, Var2<DataVector>>;
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  const auto prod_map3d =
+      domain::make_coordinate_map<Frame::ElementLogical, Frame::Grid>(
+          Affine3D{Affine{-1.0, 1.0, -0.3, 0.7}, Affine{-1.0, 1.0, 0.3, 0.55},
+                   Affine{-1.0, 1.0, 2.3, 2.8}});
+  const auto x_grid = prod_map3d(logical_coordinates(mesh));
+  InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Grid>
+      logical_to_grid_inverse_jacobian(number_of_grid_points, 0.0);
+  logical_to_grid_inverse_jacobian.get(0, 0) = 2.0;
+  logical_to_grid_inverse_jacobian.get(1, 1) = 8.0;
+  logical_to_grid_inverse_jacobian.get(2, 2) = 4.0;
+
+  // A rotation about the z-axis combined with a uniform expansion and a
+  // translation, x = s R X + T
+  const double angle = 0.7;
+  const double scale = 1.3;
+  const std::array<double, 3> translation{{0.2, -0.4, 0.1}};
+  tnsr::I<DataVector, 3, Frame::Inertial> x{number_of_grid_points};
+  get<0>(x) =
+      scale * (cos(angle) * get<0>(x_grid) - sin(angle) * get<1>(x_grid)) +
+      translation[0];
+  get<1>(x) =
+      scale * (sin(angle) * get<0>(x_grid) + cos(angle) * get<1>(x_grid)) +
+      translation[1];
+  get<2>(x) = scale * get<2>(x_grid) + translation[2];
+  InverseJacobian<double, 3, Frame::Grid, Frame::Inertial>
+      grid_to_inertial_inverse_jacobian{0.0};
+  grid_to_inertial_inverse_jacobian.get(0, 0) = cos(angle) / scale;
+  grid_to_inertial_inverse_jacobian.get(0, 1) = sin(angle) / scale;
+  grid_to_inertial_inverse_jacobian.get(1, 0) = -sin(angle) / scale;
+  grid_to_inertial_inverse_jacobian.get(1, 1) = cos(angle) / scale;
+  grid_to_inertial_inverse_jacobian.get(2, 2) = 1.0 / scale;
+
+  // The full inverse Jacobian is not diagonal, so it is contracted with the
+  // logical derivatives
+  InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Inertial>
+      inverse_jacobian(number_of_grid_points, 0.0);
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t k = 0; k < 3; ++k) {
+      for (size_t j = 0; j < 3; ++j) {
+        inverse_jacobian.get(i, k) +=
+            logical_to_grid_inverse_jacobian.get(i, j) *
+            grid_to_inertial_inverse_jacobian.get(j, k);
+      }
+    }
+  }
+  CHECK_FALSE(
+      partial_derivatives_detail::constant_diagonal(inverse_jacobian)
+          .has_value());
+
+  Variables<VariableTags> u(number_of_grid_points);
+  Variables<db::wrap_tags_in<Tags::deriv, VariableTags, tmpl::size_t<3>,
+                             Frame::Inertial>>
+      expected_du(number_of_grid_points);
+  Approx local_approx = Approx::custom().epsilon(1e-9).scale(1.0);
+  for (size_t a = 0; a < mesh.extents(0) / 2; ++a) {
+    for (size_t b = 0; b < mesh.extents(1) / 2; ++b) {
+      for (size_t c = 0; c < mesh.extents(2) / 2; ++c) {
+        tmpl::for_each<VariableTags>([&a, &b, &c, &x, &u, &expected_du](
+                                         auto tag) {
+          using Tag = typename decltype(tag)::type;
+          using DerivativeTag =
+              Tags::deriv<Tag, tmpl::size_t<3>, Frame::Inertial>;
+          get<Tag>(u) = Tag::f({{a, b, c}}, x);
+          get<DerivativeTag>(expected_du) = Tag::df({{a, b, c}}, x);
+        });
+        decltype(expected_du) du{};
+        partial_derivatives(make_not_null(&du), u, mesh,
+                            logical_to_grid_inverse_jacobian,
+                            grid_to_inertial_inverse_jacobian);
+        CHECK_VARIABLES_CUSTOM_APPROX(du, expected_du, local_approx);
+        decltype(expected_du) du_contracted{};
+        partial_derivatives(make_not_null(&du_contracted), u, mesh,
+                            inverse_jacobian);
+        CHECK_VARIABLES_CUSTOM_APPROX(du_contracted, expected_du,
+                                      local_approx);
+        // Differentiating one component at a time gives the same result as
+        // the blocks chosen for the cache
+        decltype(expected_du) du_per_component(number_of_grid_points);
+        std::vector<double> buffer(3 * number_of_grid_points);
+        partial_derivatives_detail::fused_partial_derivatives_impl(
+            make_not_null(du_per_component.data()),
+            make_not_null(buffer.data()), u.data(),
+            Variables<VariableTags>::number_of_independent_components, 1, mesh,
+            inverse_jacobian);
+        CHECK_VARIABLES_APPROX(du_per_component, du_contracted);
+      }
+    }
+  }
+}
 }  // namespace
 
 // [[Timeout, 60]]
@@ -606,6 +737,8 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PartialDerivs",
       mesh_3d);
   test_partial_derivatives_3d<two_vars<ComplexDataVector, 3>,
                               one_var<ComplexDataVector, 3>>(mesh_3d);
+  test_factored_partial_derivatives(mesh_3d);
+  test_constant_diagonal();
 
   TestHelpers::db::test_prefix_tag<
       Tags::deriv<Var1<DataVector, 3>, tmpl::size_t<3>, Frame::Grid>>(
@@ -5,7 +5,9 @@
 
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <complex>
 #include <functional>
+#include <optional>
 #include <utility>
 
 #include "DataStructures/ApplyMatrices.hpp"
@@ -99,6 +101,93 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.ExplicitInverse",
                            std::istreambuf_iterator<char>());
     CHECK(matrix_csv == "(1,2) (2,-1)\n(3,4) (4,1)\n");
   }
+  {
+    INFO("Solve in single precision");
+    const blaze::DynamicMatrix<double> matrix{{4., 1.}, {3., 1.}};
+    const helpers::ApplyMatrix<double> linear_operator{matrix};
+    const blaze::DynamicVector<double> source{1., 2.};
+    const blaze::DynamicVector<double> expected_solution{-1., 5.};
+    blaze::DynamicVector<double> solution(2);
+    const ExplicitInverse<double> solver{std::nullopt, true};
+    CHECK(solver.single_precision());
+    const auto has_converged =
+        solver.solve(make_not_null(&solution), linear_operator, source);
+    REQUIRE(has_converged);
+    Approx single_precision_approx = Approx::custom().epsilon(1.e-6).scale(1.);
+    CHECK_ITERABLE_CUSTOM_APPROX(solution, expected_solution,
+                                 single_precision_approx);
+    const auto deserialized_solver = serialize_and_deserialize(solver);
+    CHECK(deserialized_solver.single_precision());
+    CHECK(deserialized_solver.size() == 2);
+    blaze::DynamicVector<double> deserialized_solution(2);
+    deserialized_solver.solve(make_not_null(&deserialized_solution),
+                              linear_operator, source);
+    CHECK(deserialized_solution == solution);
+
+    INFO("Solve a complex matrix in single precision");
+    const blaze::DynamicMatrix<std::complex<double>> complex_matrix{
+        {std::complex<double>(1., 2.), std::complex<double>(2., -1.)},
+        {std::complex<double>(3., 4.), std::complex<double>(4., 1.)}};
+    const helpers::ApplyMatrix<std::complex<double>> complex_linear_operator{
+        complex_matrix};
+    const blaze::DynamicVector<std::complex<double>> complex_source{
+        std::complex<double>(1., 1.), std::complex<double>(2., -3.)};
+    const blaze::DynamicVector<std::complex<double>> complex_expected_solution{
+        std::complex<double>(0.45, -1.4), std::complex<double>(-1.2, 0.15)};
+    blaze::DynamicVector<std::complex<double>> complex_solution(2);
+    const ExplicitInverse<std::complex<double>> complex_solver{std::nullopt,
+                                                               true};
+    complex_solver.solve(make_not_null(&complex_solution),
+                         complex_linear_operator, complex_source);
+    CHECK_ITERABLE_CUSTOM_APPROX(complex_solution, complex_expected_solution,
+                                 single_precision_approx);
+  }
+  {
+    INFO("Share the inverse of identical operators");
+    const blaze::DynamicMatrix<double> matrix{{4., 1.}, {3., 1.}};
+    const helpers::ApplyMatrix<double> linear_operator{matrix};
+    const blaze::DynamicMatrix<double> perturbed_matrix{{4., 1. + 1.e-14},
+                                                        {3., 1.}};
+    const helpers::ApplyMatrix<double> perturbed_linear_operator{
+        perturbed_matrix};
+    const blaze::DynamicMatrix<double> other_matrix{{4., 1.}, {1., 3.}};
+    const helpers::ApplyMatrix<double> other_linear_operator{other_matrix};
+    const blaze::DynamicVector<double> source{1., 2.};
+    blaze::DynamicVector<double> solution(2);
+    const auto& shared_inverses =
+        detail::SharedExplicitInverses<double>::local();
+    {
+      const ExplicitInverse<double> solver{std::nullopt, false, 1.e-12};
+      const ExplicitInverse<double> identical_solver{std::nullopt, false,
+                                                     1.e-12};
+      const ExplicitInverse<double> other_solver{std::nullopt, false, 1.e-12};
+      const ExplicitInverse<double> unshared_solver{};
+      solver.solve(make_not_null(&solution), linear_operator, source);
+      CHECK_FALSE(solver.shares_inverse());
+      CHECK(shared_inverses.size() == 1);
+      identical_solver.solve(make_not_null(&solution),
+                             perturbed_linear_operator, source);
+      CHECK(solver.shares_inverse());
+      CHECK(identical_solver.shares_inverse());
+      CHECK(&identical_solver.matrix_representation() ==
+            &solver.matrix_representation());
+      CHECK_ITERABLE_APPROX(solution, (blaze::DynamicVector<double>{-1., 5.}));
+      other_solver.solve(make_not_null(&solution), other_linear_operator,
+                         source);
+      CHECK_FALSE(other_solver.shares_inverse());
+      CHECK_ITERABLE_APPROX(other_solver.matrix_representation(),
+                            blaze::inv(other_matrix));
+      unshared_solver.solve(make_not_null(&solution), linear_operator, source);
+      CHECK_FALSE(unshared_solver.shares_inverse());
+      CHECK(shared_inverses.size() == 2);
+      const auto deserialized_solver = serialize_and_deserialize(solver);
+      CHECK(deserialized_solver.share_tolerance() == std::optional{1.e-12});
+      CHECK(&deserialized_solver.matrix_representation() ==
+            &solver.matrix_representation());
+    }
+    // Inverses are released when no solver uses them anymore
+    CHECK(shared_inverses.size() == 0);
+  }
   {
     INFO("Solve a heterogeneous data structure");
     using SubdomainData = ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
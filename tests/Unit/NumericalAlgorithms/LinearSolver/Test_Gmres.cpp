@@ -130,6 +130,51 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
       check_second_solve(copied_gmres);
     }
   }
+  {
+    INFO("Subspace recycling");
+    blaze::DynamicMatrix<double> matrix{{4., 1.}, {1., 3.}};
+    const helpers::ApplyMatrix<double> linear_operator{std::move(matrix)};
+    const blaze::DynamicVector<double> source{1., 2.};
+    const blaze::DynamicVector<double> expected_solution{0.0909090909090909,
+                                                         0.6363636363636364};
+    const Convergence::Criteria convergence_criteria{2, 1.e-14, 0.};
+    Gmres<blaze::DynamicVector<double>> gmres{
+        convergence_criteria, ::Verbosity::Verbose, std::nullopt, 1};
+    CHECK(gmres.recycled_vectors() == 1);
+    blaze::DynamicVector<double> initial_guess_in_solution_out{0., 0.};
+    const auto has_converged = gmres.solve(
+        make_not_null(&initial_guess_in_solution_out), linear_operator, source);
+    REQUIRE(has_converged);
+    CHECK(has_converged.num_iterations() == 2);
+    // Two iterations and one operator application to recycle the correction
+    CHECK(linear_operator.invocations == 3);
+    CHECK_ITERABLE_APPROX(initial_guess_in_solution_out, expected_solution);
+    {
+      INFO("Check that the recycled solution solves the same source");
+      linear_operator.invocations = 0;
+      initial_guess_in_solution_out = {0., 0.};
+      const auto second_has_converged =
+          gmres.solve(make_not_null(&initial_guess_in_solution_out),
+                      linear_operator, source);
+      REQUIRE(second_has_converged);
+      CHECK(second_has_converged.num_iterations() == 0);
+      CHECK(second_has_converged.initial_residual_magnitude() ==
+            approx(sqrt(5.)));
+      CHECK(linear_operator.invocations == 0);
+      CHECK_ITERABLE_APPROX(initial_guess_in_solution_out, expected_solution);
+    }
+    {
+      INFO("Check that resetting discards the recycled subspace");
+      gmres.reset();
+      initial_guess_in_solution_out = {0., 0.};
+      const auto reset_has_converged =
+          gmres.solve(make_not_null(&initial_guess_in_solution_out),
+                      linear_operator, source);
+      REQUIRE(reset_has_converged);
+      CHECK(reset_has_converged.num_iterations() == 2);
+      CHECK_ITERABLE_APPROX(initial_guess_in_solution_out, expected_solution);
+    }
+  }
   {
     INFO("Solve a non-symmetric 2x2 matrix");
     blaze::DynamicMatrix<double> matrix{{4., 1.}, {3., 1.}};
@@ -301,7 +346,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
       const Gmres<blaze::DynamicVector<double>,
                   helpers::ExactInversePreconditioner>
           preconditioned_gmres{convergence_criteria, ::Verbosity::Verbose,
-                               std::nullopt, std::move(preconditioner)};
+                               std::nullopt, 0, std::move(preconditioner)};
       check_solve(preconditioned_gmres, 1);
       // Check a second solve with the same solver and preconditioner works
       check_solve(preconditioned_gmres, 1);
@@ -324,7 +369,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
       helpers::JacobiPreconditioner preconditioner{};
       const Gmres<blaze::DynamicVector<double>, helpers::JacobiPreconditioner>
           preconditioned_gmres{convergence_criteria, ::Verbosity::Verbose,
-                               std::nullopt, std::move(preconditioner)};
+                               std::nullopt, 0, std::move(preconditioner)};
       check_solve(preconditioned_gmres, 2);
     }
     {
@@ -340,7 +385,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
       const Gmres<blaze::DynamicVector<double>,
                   helpers::RichardsonPreconditioner>
           preconditioned_gmres{convergence_criteria, ::Verbosity::Verbose,
-                               std::nullopt, std::move(preconditioner)};
+                               std::nullopt, 0, std::move(preconditioner)};
       check_solve(preconditioned_gmres, 1);
     }
     {
@@ -353,6 +398,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
           preconditioned_gmres{convergence_criteria,
                                ::Verbosity::Verbose,
                                std::nullopt,
+                               0,
                                {{{2, 0., 0.}, ::Verbosity::Verbose}}};
       check_solve(preconditioned_gmres, 1);
     }
@@ -366,7 +412,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
       const Gmres<blaze::DynamicVector<double>, LinearSolverFactory,
                   LinearSolverRegistrars>
           preconditioned_gmres{
-              convergence_criteria, ::Verbosity::Verbose, std::nullopt,
+              convergence_criteria, ::Verbosity::Verbose, std::nullopt, 0,
               std::make_unique<
                   Gmres<blaze::DynamicVector<double>, LinearSolverFactory,
                         LinearSolverRegistrars>>(
@@ -398,6 +444,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
               "  AbsoluteResidual: 0.1\n"
               "  RelativeResidual: 0.5\n"
               "Restart: 50\n"
+              "RecycledVectors: 0\n"
               "Verbosity: Verbose\n");
       CHECK(solver.convergence_criteria() ==
             Convergence::Criteria{2, 0.1, 0.5});
@@ -413,6 +460,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
           "  AbsoluteResidual: 0.1\n"
           "  RelativeResidual: 0.5\n"
           "Restart: None\n"
+          "RecycledVectors: 0\n"
           "Verbosity: Verbose\n"
           "Preconditioner: None\n");
       CHECK(solver.convergence_criteria() ==
@@ -429,6 +477,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
           "  AbsoluteResidual: 0.1\n"
           "  RelativeResidual: 0.5\n"
           "Restart: None\n"
+          "RecycledVectors: 0\n"
           "Verbosity: Verbose\n"
           "Preconditioner:\n");
       CHECK(solver.convergence_criteria() ==
@@ -449,6 +498,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
               "    AbsoluteResidual: 0.1\n"
               "    RelativeResidual: 0.5\n"
               "  Restart: 50\n"
+              "  RecycledVectors: 0\n"
               "  Verbosity: Verbose\n"
               "  Preconditioner:\n"
               "    Gmres:\n"
@@ -457,6 +507,7 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.Gmres",
               "        AbsoluteResidual: 0.5\n"
               "        RelativeResidual: 0.9\n"
               "      Restart: None\n"
+              "      RecycledVectors: 0\n"
               "      Verbosity: Verbose\n"
               "      Preconditioner: None\n");
       REQUIRE(solver);
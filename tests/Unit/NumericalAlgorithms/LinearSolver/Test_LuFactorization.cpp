@@ -0,0 +1,150 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <complex>
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/NumericalAlgorithms/LinearSolver/TestHelpers.hpp"
+#include "NumericalAlgorithms/LinearSolver/LuFactorization.hpp"
+#include "ParallelAlgorithms/LinearSolver/Schwarz/ElementCenteredSubdomainData.hpp"
+#include "ParallelAlgorithms/LinearSolver/Schwarz/OverlapHelpers.hpp"
+#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace helpers = TestHelpers::LinearSolver;
+
+namespace {
+struct ScalarFieldTag : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+}  // namespace
+
+namespace LinearSolver::Serial {
+
+SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.LuFactorization",
+                  "[Unit][NumericalAlgorithms][LinearSolver]") {
+  {
+    INFO("Solve a simple matrix");
+    // Needs pivoting
+    const blaze::DynamicMatrix<double> matrix{
+        {0., 1., 2.}, {3., 1., 0.}, {1., 2., 4.}};
+    const helpers::ApplyMatrix<double> linear_operator{matrix};
+    const blaze::DynamicVector<double> source{1., 2., 3.};
+    const blaze::DynamicVector<double> expected_solution =
+        blaze::inv(matrix) * source;
+    blaze::DynamicVector<double> solution(3);
+    LuFactorization<double> solver{};
+    CHECK(solver.size() == std::numeric_limits<size_t>::max());
+    const auto has_converged =
+        solver.solve(make_not_null(&solution), linear_operator, source);
+    REQUIRE(has_converged);
+    CHECK(solver.size() == 3);
+    CHECK_ITERABLE_APPROX(solution, expected_solution);
+    {
+      INFO("Serialization");
+      const auto deserialized_solver = serialize_and_deserialize(solver);
+      CHECK(deserialized_solver.size() == 3);
+      // Solve a different operator to check the stored factors are used
+      const helpers::ApplyMatrix<double> unused_operator{
+          blaze::DynamicMatrix<double>{
+              {1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}}};
+      blaze::DynamicVector<double> deserialized_solution(3);
+      deserialized_solver.solve(make_not_null(&deserialized_solution),
+                                unused_operator, source);
+      CHECK_ITERABLE_APPROX(deserialized_solution, expected_solution);
+    }
+    {
+      INFO("Resetting");
+      const blaze::DynamicMatrix<double> matrix2{
+          {4., 1., 0.}, {1., 3., 1.}, {0., 1., 2.}};
+      const helpers::ApplyMatrix<double> linear_operator2{matrix2};
+      const blaze::DynamicVector<double> expected_solution2 =
+          blaze::inv(matrix2) * source;
+      // Without resetting, the solver keeps applying the cached factorization
+      solver.solve(make_not_null(&solution), linear_operator2, source);
+      CHECK_ITERABLE_APPROX(solution, expected_solution);
+      // Solving a different operator after resetting should work
+      solver.reset();
+      solver.solve(make_not_null(&solution), linear_operator2, source);
+      CHECK_ITERABLE_APPROX(solution, expected_solution2);
+    }
+  }
+  {
+    INFO("Solve a complex matrix");
+    const blaze::DynamicMatrix<std::complex<double>> matrix{
+        {std::complex<double>(1., 2.), std::complex<double>(2., -1.)},
+        {std::complex<double>(3., 4.), std::complex<double>(4., 1.)}};
+    const helpers::ApplyMatrix<std::complex<double>> linear_operator{matrix};
+    const blaze::DynamicVector<std::complex<double>> source{
+        std::complex<double>(1., 1.), std::complex<double>(2., -3.)};
+    const blaze::DynamicVector<std::complex<double>> expected_solution{
+        std::complex<double>(0.45, -1.4), std::complex<double>(-1.2, 0.15)};
+    blaze::DynamicVector<std::complex<double>> solution(2);
+    const LuFactorization<std::complex<double>> solver{};
+    const auto has_converged =
+        solver.solve(make_not_null(&solution), linear_operator, source);
+    REQUIRE(has_converged);
+    CHECK_ITERABLE_APPROX(solution, expected_solution);
+  }
+  {
+    INFO("Solve a heterogeneous data structure");
+    using SubdomainData = ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
+        1, tmpl::list<ScalarFieldTag>>;
+
+    const Matrix matrix_element{{4., 1., 1.}, {1., 1., 3.}, {0., 2., 0.}};
+    const Matrix matrix_overlap{{4., 1.}, {3., 1.}};
+    const ::LinearSolver::Schwarz::OverlapId<1> overlap_id{
+        Direction<1>::lower_xi(), ElementId<1>{0}};
+    const std::array<std::reference_wrapper<const Matrix>, 1> matrices_element{
+        matrix_element};
+    const std::array<std::reference_wrapper<const Matrix>, 1> matrices_overlap{
+        matrix_overlap};
+    const auto linear_operator = [&matrices_element, &matrices_overlap,
+                                  &overlap_id](
+                                     const gsl::not_null<SubdomainData*> result,
+                                     const SubdomainData& operand) {
+      apply_matrices(make_not_null(&result->element_data), matrices_element,
+                     operand.element_data, Index<1>{3});
+      apply_matrices(make_not_null(&result->overlap_data.at(overlap_id)),
+                     matrices_overlap, operand.overlap_data.at(overlap_id),
+                     Index<1>{2});
+    };
+
+    SubdomainData source{3};
+    get(get<ScalarFieldTag>(source.element_data)) = DataVector{1., 2., 1.};
+    source.overlap_data.emplace(overlap_id,
+                                typename SubdomainData::OverlapData{2});
+    get(get<ScalarFieldTag>(source.overlap_data.at(overlap_id))) =
+        DataVector{1., 2.};
+    auto expected_solution = make_with_value<SubdomainData>(source, 0.);
+    get(get<ScalarFieldTag>(expected_solution.element_data)) =
+        DataVector{0., 0.5, 0.5};
+    get(get<ScalarFieldTag>(expected_solution.overlap_data.at(overlap_id))) =
+        DataVector{-1., 5.};
+
+    const LuFactorization<double> solver{};
+    auto solution = make_with_value<SubdomainData>(source, 0.);
+    solver.solve(make_not_null(&solution), linear_operator, source);
+    CHECK(solver.size() == 5);
+    CHECK_VARIABLES_APPROX(solution.element_data,
+                           expected_solution.element_data);
+    CHECK_VARIABLES_APPROX(solution.overlap_data.at(overlap_id),
+                           expected_solution.overlap_data.at(overlap_id));
+  }
+}
+
+}  // namespace LinearSolver::Serial
@@ -18,6 +18,7 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/Blas.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/Math.hpp"
@@ -547,6 +548,27 @@ void test_double_instantiation() {
   CHECK_ITERABLE_APPROX(double_matrix, vector_matrix);
 }
 
+void test_cached_quantities() {
+  const auto is_cached = [](const Spectral::CachedQuantity& quantity) {
+    return alg::count(Spectral::cached_quantities(), quantity) == 1;
+  };
+  const Spectral::CachedQuantity differentiation_matrix{
+      "DifferentiationMatrix", Spectral::Basis::Chebyshev,
+      Spectral::Quadrature::Gauss, 11};
+  CHECK(get_output(differentiation_matrix) ==
+        "DifferentiationMatrix(Chebyshev, Gauss, 11)");
+  // Other tests may have computed the quantity already, but each quantity is
+  // computed only once
+  Spectral::differentiation_matrix<Spectral::Basis::Chebyshev,
+                                   Spectral::Quadrature::Gauss>(11);
+  CHECK(is_cached(differentiation_matrix));
+  Spectral::differentiation_matrix<Spectral::Basis::Chebyshev,
+                                   Spectral::Quadrature::Gauss>(11);
+  CHECK(is_cached(differentiation_matrix));
+  CHECK(is_cached({"CollocationPointsAndWeights", Spectral::Basis::Chebyshev,
+                   Spectral::Quadrature::Gauss, 11}));
+}
+
 void test_fd_interpolation_fails() {
   CHECK_THROWS_WITH(
       ([]() {
@@ -571,5 +593,6 @@ SPECTRE_TEST_CASE("Unit.Numerical.Spectral",
   test_spectral_quantities_for_mesh();
   test_gauss_points_boundary_interpolation_and_lifting();
   test_double_instantiation();
+  test_cached_quantities();
   test_fd_interpolation_fails();
 }
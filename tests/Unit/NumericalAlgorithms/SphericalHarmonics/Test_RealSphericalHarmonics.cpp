@@ -10,6 +10,7 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/RealSphericalHarmonics.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshInterpolation.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 
 namespace ylm {
 SPECTRE_TEST_CASE("Unit.SphericalHarmonics.RealSphericalHarmonics",
@@ -59,5 +60,30 @@ SPECTRE_TEST_CASE("Unit.SphericalHarmonics.RealSphericalHarmonics",
       }
     }
   }
+
+  {
+    INFO("All modes at once");
+    const auto all_spherical_harmonics =
+        real_spherical_harmonics(thetas, phis, l_max);
+    REQUIRE(all_spherical_harmonics.size() == square(l_max + 1) * num_points);
+    DataVector buffer{};
+    real_spherical_harmonics(make_not_null(&buffer), thetas, phis, l_max);
+    CHECK(buffer == all_spherical_harmonics);
+    size_t index = 0;
+    for (size_t l = 0; l <= l_max; ++l) {
+      // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+      for (int m = -l; m <= static_cast<int>(l); ++m, ++index) {
+        CAPTURE(l);
+        CAPTURE(m);
+        const DataVector spherical_harmonic{};
+        make_const_view(make_not_null(&spherical_harmonic),
+                        all_spherical_harmonics, index * num_points,
+                        num_points);
+        CHECK_ITERABLE_CUSTOM_APPROX(
+            spherical_harmonic, real_spherical_harmonic(thetas, phis, l, m),
+            custom_approx);
+      }
+    }
+  }
 }
 }  // namespace ylm
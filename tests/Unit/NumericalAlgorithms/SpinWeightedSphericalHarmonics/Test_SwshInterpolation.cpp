@@ -235,6 +235,38 @@ void test_interpolation(const gsl::not_null<Generator*> generator) {
 
   CHECK_ITERABLE_CUSTOM_APPROX(clenshaw_interpolation, expected,
                                factorial_approx);
+
+  {
+    INFO("Updating the target points");
+    CHECK_FALSE(interpolator.update_target_points(target_theta, target_phi,
+                                                  l_max));
+    CHECK_FALSE(interpolator.update_target_points(
+        DataVector{target_theta + 1.0e-3}, target_phi, l_max, 1.0e-2));
+    const auto new_target_phi = make_with_random_values<DataVector>(
+        generator, make_not_null(&phi_dist), number_of_target_points + 2);
+    const auto new_target_theta = make_with_random_values<DataVector>(
+        generator, make_not_null(&theta_dist), number_of_target_points + 2);
+    for (const size_t new_l_max : {l_max, l_max - 2}) {
+      CHECK(interpolator.update_target_points(new_target_theta,
+                                              new_target_phi, new_l_max));
+      const SwshInterpolator new_interpolator{new_target_theta,
+                                              new_target_phi, new_l_max};
+      SpinWeighted<ComplexDataVector, spin> updated_harmonic;
+      SpinWeighted<ComplexDataVector, spin> new_harmonic;
+      for (int m = -static_cast<int>(new_l_max);
+           m <= static_cast<int>(new_l_max); ++m) {
+        interpolator.direct_evaluation_swsh_at_l_min(
+            make_not_null(&updated_harmonic), m);
+        new_interpolator.direct_evaluation_swsh_at_l_min(
+            make_not_null(&new_harmonic), m);
+        CHECK(updated_harmonic == new_harmonic);
+      }
+      CHECK(interpolator.update_target_points(target_theta, target_phi,
+                                              l_max));
+    }
+    auto deserialized = serialize_and_deserialize(interpolator);
+    CHECK(deserialized.update_target_points(target_theta, target_phi, l_max));
+  }
 }
 
 SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Spectral.SwshInterpolation",
@@ -0,0 +1,149 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/ArrayCollection/ElementWorkQueues.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel {
+namespace {
+void test_pop_and_steal() {
+  ElementWorkQueues<2> queues{3};
+  CHECK(queues.number_of_cores() == 3);
+  ElementId<2> id{};
+  CHECK_FALSE(queues.try_pop(make_not_null(&id), 0));
+
+  const ElementId<2> id_a{0};
+  const ElementId<2> id_b{1};
+  const ElementId<2> id_c{2};
+  queues.push(1, id_a);
+  queues.push(1, id_b);
+  queues.push(1, id_c);
+
+  // Core 1 takes its most recently pushed element
+  CHECK(queues.try_pop(make_not_null(&id), 1));
+  CHECK(id == id_c);
+  // Core 2 steals the element that has waited longest
+  CHECK(queues.try_pop(make_not_null(&id), 2));
+  CHECK(id == id_a);
+  CHECK(queues.try_pop(make_not_null(&id), 0));
+  CHECK(id == id_b);
+  CHECK_FALSE(queues.try_pop(make_not_null(&id), 1));
+
+  queues.add_busy_time(2, 0.5);
+  queues.add_busy_time(2, 0.25);
+  const auto statistics = queues.statistics();
+  REQUIRE(statistics.size() == 3);
+  CHECK(statistics[0].elements_stolen == 1);
+  CHECK(statistics[1].elements_stolen == 0);
+  CHECK(statistics[2].elements_stolen == 1);
+  CHECK(statistics[2].elements_run == 2);
+  CHECK(statistics[2].busy_time == 0.75);
+  CHECK(statistics[0].elements_run == 0);
+  CHECK(statistics[0].busy_time == 0.0);
+  CHECK(statistics[0].idle_time >= 0.0);
+
+  queues.reset_statistics();
+  for (const auto& core_statistics : queues.statistics()) {
+    CHECK(core_statistics.elements_run == 0);
+    CHECK(core_statistics.elements_stolen == 0);
+    CHECK(core_statistics.busy_time == 0.0);
+  }
+}
+
+void test_priority() {
+  ElementWorkQueues<1> queues{2};
+  const ElementId<1> id_a{0};
+  const ElementId<1> id_b{1};
+  const ElementId<1> id_c{2};
+  queues.set_priority_elements({id_a, id_b});
+  CHECK(queues.priority_elements() ==
+        std::unordered_set<ElementId<1>>{id_a, id_b});
+  // Priority elements are taken before all others, also when stealing
+  queues.push(0, id_a);
+  queues.push(0, id_c);
+  queues.push(1, id_b);
+  ElementId<1> id{};
+  CHECK(queues.try_pop(make_not_null(&id), 0));
+  CHECK(id == id_a);
+  CHECK(queues.try_pop(make_not_null(&id), 0));
+  CHECK(id == id_b);
+  CHECK(queues.try_pop(make_not_null(&id), 0));
+  CHECK(id == id_c);
+  CHECK_FALSE(queues.try_pop(make_not_null(&id), 1));
+  CHECK(queues.statistics()[0].elements_stolen == 1);
+
+  CHECK(serialize_and_deserialize(queues).priority_elements() ==
+        queues.priority_elements());
+}
+
+void test_concurrent() {
+  // Each thread pushes elements onto its own queue and then pops once per
+  // push, as ReceiveDataForElement does for each message. Every element must
+  // be popped exactly once.
+  constexpr size_t number_of_threads = 4;
+  constexpr size_t pushes_per_thread = 1000;
+  ElementWorkQueues<1> queues{number_of_threads};
+  std::vector<std::vector<size_t>> popped(number_of_threads);
+  std::vector<std::thread> threads{};
+  for (size_t core = 0; core < number_of_threads; ++core) {
+    threads.emplace_back([&queues, &popped, core]() {
+      for (size_t i = 0; i < pushes_per_thread; ++i) {
+        const size_t index = core * pushes_per_thread + i;
+        queues.push(core, ElementId<1>{0, {{SegmentId{12, index}}}});
+      }
+      for (size_t i = 0; i < pushes_per_thread; ++i) {
+        ElementId<1> id{};
+        while (not queues.try_pop(make_not_null(&id), core)) {
+        }
+        popped[core].push_back(id.segment_id(0).index());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  std::vector<size_t> count(number_of_threads * pushes_per_thread, 0);
+  for (const auto& popped_on_core : popped) {
+    for (const size_t index : popped_on_core) {
+      ++count[index];
+    }
+  }
+  for (const size_t c : count) {
+    CHECK(c == 1);
+  }
+  ElementId<1> id{};
+  CHECK_FALSE(queues.try_pop(make_not_null(&id), 0));
+}
+
+void test_serialization() {
+  ElementWorkQueues<3> queues{5};
+  const auto deserialized = serialize_and_deserialize(queues);
+  CHECK(deserialized.number_of_cores() == 5);
+
+  queues.set_priority_elements({ElementId<3>{1}});
+  queues.push(3, ElementId<3>{1});
+  CHECK_THROWS_WITH(serialize_and_deserialize(queues),
+                    Catch::Matchers::ContainsSubstring(
+                        "Can only serialize ElementWorkQueues if all queues "
+                        "are empty"));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.ElementWorkQueues",
+                  "[Unit][Parallel]") {
+  test_pop_and_steal();
+  test_priority();
+  test_concurrent();
+  test_serialization();
+}
+}  // namespace Parallel
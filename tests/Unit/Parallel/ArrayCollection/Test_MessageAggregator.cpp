@@ -0,0 +1,148 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/ArrayCollection/MessageAggregator.hpp"
+
+namespace {
+struct MetavariablesWithPolicy {
+  static constexpr Parallel::AggregationPolicy message_aggregation_policy{
+      false, 3};
+};
+
+struct MetavariablesWithoutPolicy {};
+}  // namespace
+
+namespace Parallel {
+namespace {
+using Aggregator = MessageAggregator<1, size_t, std::string>;
+
+void test_policy() {
+  static_assert(not aggregation_policy<MetavariablesWithPolicy>().enabled);
+  static_assert(
+      aggregation_policy<MetavariablesWithPolicy>().max_messages_per_batch ==
+      3);
+  static_assert(aggregation_policy<MetavariablesWithoutPolicy>().enabled);
+  const AggregationPolicy policy{};
+  CHECK(serialize_and_deserialize(policy).max_messages_per_batch ==
+        policy.max_messages_per_batch);
+}
+
+void test_batches() {
+  Aggregator aggregator{2, AggregationPolicy{true, 3}};
+  CHECK(aggregator.number_of_nodes() == 2);
+  CHECK(aggregator.policy().max_messages_per_batch == 3);
+  CHECK(aggregator.flush(0).empty());
+
+  CHECK_FALSE(aggregator.add(1, {ElementId<1>{0}, 1, "a"}).has_value());
+  CHECK_FALSE(aggregator.add(0, {ElementId<1>{1}, 1, "b"}).has_value());
+  CHECK_FALSE(aggregator.add(1, {ElementId<1>{2}, 2, "c"}).has_value());
+  // The third message to node 1 fills its batch
+  const auto full_batch = aggregator.add(1, {ElementId<1>{3}, 2, "d"});
+  REQUIRE(full_batch.has_value());
+  REQUIRE(full_batch->size() == 3);
+  CHECK((*full_batch)[0].element_id == ElementId<1>{0});
+  CHECK((*full_batch)[0].instance == 1);
+  CHECK((*full_batch)[0].data == "a");
+  CHECK((*full_batch)[1].data == "c");
+  CHECK((*full_batch)[2].data == "d");
+  CHECK(aggregator.flush(1).empty());
+
+  const auto batch = aggregator.flush(0);
+  REQUIRE(batch.size() == 1);
+  CHECK(batch[0].element_id == ElementId<1>{1});
+  CHECK(batch[0].data == "b");
+  CHECK(serialize_and_deserialize(batch[0]).data == "b");
+  CHECK(aggregator.flush(0).empty());
+
+  const auto statistics = aggregator.statistics();
+  CHECK(statistics.number_of_messages == 4);
+  CHECK(statistics.number_of_batches == 2);
+  CHECK(statistics.number_of_full_batches == 1);
+  CHECK(statistics.elapsed_time >= 0.0);
+  aggregator.reset_statistics();
+  CHECK(aggregator.statistics().number_of_messages == 0);
+  CHECK(aggregator.statistics().number_of_batches == 0);
+  CHECK(aggregator.statistics().number_of_full_batches == 0);
+}
+
+void test_concurrent() {
+  // Each thread adds messages and flushes after every few, as the elements
+  // do after sending to all their neighbors. Every message must be sent
+  // exactly once.
+  constexpr size_t number_of_threads = 4;
+  constexpr size_t messages_per_thread = 1000;
+  Aggregator aggregator{3, AggregationPolicy{true, 16}};
+  std::vector<std::vector<size_t>> sent(number_of_threads);
+  std::vector<std::thread> threads{};
+  for (size_t thread = 0; thread < number_of_threads; ++thread) {
+    threads.emplace_back([&aggregator, &sent, thread]() {
+      const auto send = [&sent, thread](const Aggregator::Batch& batch) {
+        for (const auto& message : batch) {
+          sent[thread].push_back(message.instance);
+        }
+      };
+      for (size_t i = 0; i < messages_per_thread; ++i) {
+        const size_t index = thread * messages_per_thread + i;
+        const auto batch =
+            aggregator.add(index % 3, {ElementId<1>{0}, index, ""});
+        if (batch.has_value()) {
+          send(*batch);
+        }
+        if (i % 5 == 4) {
+          for (size_t node = 0; node < 3; ++node) {
+            send(aggregator.flush(node));
+          }
+        }
+      }
+      for (size_t node = 0; node < 3; ++node) {
+        send(aggregator.flush(node));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  std::vector<size_t> count(number_of_threads * messages_per_thread, 0);
+  for (const auto& sent_by_thread : sent) {
+    for (const size_t index : sent_by_thread) {
+      ++count[index];
+    }
+  }
+  for (const size_t c : count) {
+    CHECK(c == 1);
+  }
+  CHECK(aggregator.statistics().number_of_messages ==
+        number_of_threads * messages_per_thread);
+}
+
+void test_serialization() {
+  Aggregator aggregator{5, AggregationPolicy{true, 7}};
+  const auto deserialized = serialize_and_deserialize(aggregator);
+  CHECK(deserialized.number_of_nodes() == 5);
+  CHECK(deserialized.policy().max_messages_per_batch == 7);
+
+  aggregator.add(3, {ElementId<1>{0}, 0, "a"});
+  CHECK_THROWS_WITH(serialize_and_deserialize(aggregator),
+                    Catch::Matchers::ContainsSubstring(
+                        "Can only serialize a MessageAggregator if all "
+                        "buffers are empty"));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.MessageAggregator",
+                  "[Unit][Parallel]") {
+  test_policy();
+  test_batches();
+  test_concurrent();
+  test_serialization();
+}
+}  // namespace Parallel
@@ -0,0 +1,122 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Framework/TestCreation.hpp"
+#include "Options/Context.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/ExitCode.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseControl/LoadBalanceStragglers.hpp"
+#include "Parallel/PhaseControl/PhaseControlTags.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/LogicalTriggers.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Trigger.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Metavariables {
+  using component_list = tmpl::list<>;
+
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<
+        tmpl::pair<PhaseChange,
+                   tmpl::list<PhaseControl::LoadBalanceStragglers>>,
+        tmpl::pair<Trigger, tmpl::list<Triggers::Always>>>;
+  };
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.PhaseControl.LoadBalanceStragglers",
+                  "[Unit][Parallel]") {
+  // The `contribute_phase_data_impl` function is untested, because we do not
+  // have good support for reductions in the action testing framework.
+  TestHelpers::test_option_tag<PhaseControl::OptionTags::PhaseChangeAndTriggers,
+                               Metavariables>(
+      " - Trigger: Always\n"
+      "   PhaseChanges:\n"
+      "     - LoadBalanceStragglers:\n"
+      "         MaximumThroughputLoss: 0.1");
+
+  {
+    INFO("Combine busy times");
+    PhaseControl::Tags::BusyTimePerCoreOnNodes::combine_method combine{};
+    CHECK(combine({}, {1.0, 2.0}) == std::vector<double>{1.0, 2.0});
+    CHECK(combine({1.0, 2.0}, {}) == std::vector<double>{1.0, 2.0});
+    CHECK(combine({1.0, 2.0}, {0.5, 4.0}) == std::vector<double>{1.5, 6.0});
+  }
+
+  Parallel::GlobalCache<Metavariables> cache{};
+  using PhaseChangeDecisionData = tuples::tagged_tuple_from_typelist<
+      PhaseControl::get_phase_change_tags<Metavariables>>;
+  const PhaseControl::LoadBalanceStragglers phase_change{0.1};
+  const auto busy_times = [](const PhaseChangeDecisionData& data) {
+    return tuples::get<PhaseControl::Tags::BusyTimePerCoreOnNodes>(data);
+  };
+  const auto return_phase = [](const PhaseChangeDecisionData& data) {
+    return tuples::get<PhaseControl::Tags::StragglerReturnPhase>(data);
+  };
+  {
+    INFO("Initialize phase change decision data");
+    PhaseChangeDecisionData data{std::vector<double>{1.0, 2.0},
+                                 Parallel::Phase::Evolve, true,
+                                 Parallel::ExitCode::Complete};
+    phase_change.initialize_phase_data<Metavariables>(make_not_null(&data));
+    CHECK(busy_times(data).empty());
+    CHECK_FALSE(return_phase(data).has_value());
+  }
+  {
+    INFO("No data contributed");
+    PhaseChangeDecisionData data{std::vector<double>{}, std::nullopt, true,
+                                 Parallel::ExitCode::Complete};
+    CHECK_FALSE(phase_change
+                    .arbitrate_phase_change(make_not_null(&data),
+                                            Parallel::Phase::Evolve, cache)
+                    .has_value());
+  }
+  {
+    INFO("Balanced nodes");
+    // Throughput loss is 1 - 1.05 / 1.1 < 0.1
+    PhaseChangeDecisionData data{std::vector<double>{1.0, 1.1}, std::nullopt,
+                                 true, Parallel::ExitCode::Complete};
+    CHECK_FALSE(phase_change
+                    .arbitrate_phase_change(make_not_null(&data),
+                                            Parallel::Phase::Evolve, cache)
+                    .has_value());
+    CHECK(busy_times(data).empty());
+    CHECK_FALSE(return_phase(data).has_value());
+  }
+  {
+    INFO("Straggler");
+    // Throughput loss is 1 - 1.5 / 2 > 0.1
+    PhaseChangeDecisionData data{std::vector<double>{1.0, 2.0, 1.0, 2.0},
+                                 std::nullopt, true,
+                                 Parallel::ExitCode::Complete};
+    CHECK((phase_change.arbitrate_phase_change(
+               make_not_null(&data), Parallel::Phase::Evolve, cache) ==
+           std::make_pair(
+               Parallel::Phase::LoadBalancing,
+               PhaseControl::ArbitrationStrategy::RunPhaseImmediately)));
+    CHECK(busy_times(data).empty());
+    CHECK(return_phase(data) == Parallel::Phase::Evolve);
+
+    INFO("Return after balancing the load");
+    CHECK((phase_change.arbitrate_phase_change(
+               make_not_null(&data), Parallel::Phase::LoadBalancing, cache) ==
+           std::make_pair(
+               Parallel::Phase::Evolve,
+               PhaseControl::ArbitrationStrategy::PermitAdditionalJumps)));
+    CHECK_FALSE(return_phase(data).has_value());
+  }
+  CHECK_THROWS_WITH(
+      PhaseControl::LoadBalanceStragglers(1.5, Options::Context{}),
+      Catch::Matchers::ContainsSubstring("must be in [0, 1]"));
+}
@@ -0,0 +1,122 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Parallel/Printf/LogBuffer.hpp"
+#include "Parallel/Printf/Printf.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+std::string to_string(const std::vector<char>& messages) {
+  return messages.empty() ? std::string{} : std::string{messages.data()};
+}
+
+void test_append() {
+  Parallel::LogBuffer log_buffer{};
+  CHECK(log_buffer.capacity() == Parallel::LogBuffer::default_capacity);
+  CHECK(log_buffer.extract().empty());
+  CHECK(log_buffer.append("Solver", Parallel::detail::format_message(
+                                        "Iteration %zu\n", size_t{3}),
+                          1.5));
+  CHECK(log_buffer.append("Element", Parallel::detail::format_message("done\n"),
+                          2.25));
+  CHECK(log_buffer.size() > 0);
+  CHECK(to_string(log_buffer.extract()) ==
+        "[1.500s Node0 Solver] Iteration 3\n[2.250s Node0 Element] done\n");
+  CHECK(log_buffer.size() == 0);
+  CHECK(log_buffer.extract().empty());
+}
+
+void test_overflow() {
+  Parallel::LogBuffer log_buffer{};
+  // Fits exactly one message with its prefix
+  log_buffer.set_capacity(std::string{"[1.000s Node0 A] abc\n"}.size());
+  const auto message = Parallel::detail::format_message("abc\n");
+  CHECK(log_buffer.append("A", message, 1.0));
+  CHECK_FALSE(log_buffer.append("A", message, 2.0));
+  CHECK_FALSE(log_buffer.append("A", message, 3.0));
+  CHECK(log_buffer.number_of_dropped_messages() == 2);
+  CHECK(to_string(log_buffer.extract()) ==
+        "[1.000s Node0 A] abc\n"
+        "[Node0 LogBuffer] Dropped 2 messages because the buffer was full.\n");
+  CHECK(log_buffer.number_of_dropped_messages() == 0);
+  // The space is available again after the buffer was emptied
+  CHECK(log_buffer.append("A", message, 4.0));
+  CHECK(to_string(log_buffer.extract()) == "[4.000s Node0 A] abc\n");
+}
+
+void test_flush_to_file() {
+  const std::string file_prefix = "Test_LogBuffer";
+  const std::string test_file = file_prefix + "Node0.log";
+  file_system::rm(test_file, true);
+  Parallel::LogBuffer log_buffer{};
+  CHECK_FALSE(log_buffer.file_name().has_value());
+  log_buffer.set_file_prefix(file_prefix);
+  CHECK(log_buffer.file_name() == test_file);
+  log_buffer.append("A", Parallel::detail::format_message("first\n"), 1.0);
+  log_buffer.flush();
+  CHECK(log_buffer.size() == 0);
+  // Flushing an empty buffer doesn't touch the file
+  log_buffer.flush();
+  log_buffer.append("B", Parallel::detail::format_message("second\n"), 2.0);
+  log_buffer.flush();
+  {
+    std::ifstream file_stream(test_file);
+    std::ostringstream ss{};
+    file_stream >> ss.rdbuf();
+    CHECK(ss.str() == "[1.000s Node0 A] first\n[2.000s Node0 B] second\n");
+  }
+  file_system::rm(test_file, true);
+  file_system::create_directory(test_file);
+  log_buffer.append("A", Parallel::detail::format_message("lost\n"), 3.0);
+  CHECK_THROWS_WITH(
+      log_buffer.flush(),
+      Catch::Matchers::ContainsSubstring("Could not open '" + test_file + "'"));
+  file_system::rm(test_file, true);
+  log_buffer.set_file_prefix(std::nullopt);
+  CHECK_FALSE(log_buffer.file_name().has_value());
+}
+
+void test_configure() {
+  // The command-line options of Main reach the buffer of each node through
+  // `LogBuffer::configure`
+  Parallel::LogBuffer log_buffer{};
+  log_buffer.configure("Test_LogBufferConfigure", 8);
+  CHECK(log_buffer.file_name() == "Test_LogBufferConfigureNode0.log");
+  CHECK(log_buffer.capacity() == 8);
+  const std::string message = Parallel::detail::format_message("abcdefghi\n");
+  CHECK_FALSE(log_buffer.append("A", message, 1.0));
+  CHECK(log_buffer.number_of_dropped_messages() == 1);
+  log_buffer.configure("", Parallel::LogBuffer::default_capacity);
+  CHECK_FALSE(log_buffer.file_name().has_value());
+  CHECK(log_buffer.capacity() == Parallel::LogBuffer::default_capacity);
+  CHECK(log_buffer.append("A", message, 2.0));
+  CHECK(to_string(log_buffer.extract()) ==
+        "[2.000s Node0 A] abcdefghi\n"
+        "[Node0 LogBuffer] Dropped 1 messages because the buffer was full.\n");
+}
+
+void test_log() {
+  auto& log_buffer = Parallel::LogBuffer::local();
+  log_buffer.extract();
+  Parallel::log("Test", "%d %s\n", 42, "logged");
+  const std::string messages = to_string(log_buffer.extract());
+  CHECK(messages.find("Node0 Test] 42 logged\n") != std::string::npos);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.LogBuffer", "[Unit][Parallel]") {
+  test_append();
+  test_overflow();
+  test_flush_to_file();
+  test_configure();
+  test_log();
+}
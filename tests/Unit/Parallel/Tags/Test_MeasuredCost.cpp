@@ -0,0 +1,12 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Parallel/Tags/MeasuredCost.hpp"
+
+SPECTRE_TEST_CASE("Unit.Parallel.Tags.MeasuredCost", "[Unit][Parallel]") {
+  TestHelpers::db::test_simple_tag<Parallel::Tags::MeasuredCost>(
+      "MeasuredCost");
+}
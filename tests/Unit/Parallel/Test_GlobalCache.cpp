@@ -429,6 +429,49 @@ void Test_GlobalCache<Metavariables>::run_single_core_test() {
   Parallel::mutate<email, modify_value<std::string>>(
       cache, std::string("isaac@newton.com"));
   SPECTRE_PARALLEL_REQUIRE("isaac@newton.com" == Parallel::get<email>(cache));
+  // Nobody waited for the items and there are no other threads
+  const auto statistics = cache.mutable_cache_statistics();
+  SPECTRE_PARALLEL_REQUIRE(statistics.callbacks_registered == 0);
+  SPECTRE_PARALLEL_REQUIRE(statistics.callbacks_invoked == 0);
+  SPECTRE_PARALLEL_REQUIRE(statistics.contended_locks == 0);
+  SPECTRE_PARALLEL_REQUIRE(statistics.lock_wait_time == 0.0);
+  // Wait for a change of the email, which registers a callback. Asking again
+  // for the same element doesn't register another one.
+  const auto array_component_id =
+      Parallel::make_array_component_id<TestArrayChare<Metavariables>>(0);
+  const auto wait_for_planck =
+      [](const std::string& email_l) -> std::unique_ptr<Parallel::Callback> {
+    return email_l == "max@planck.de"
+               ? std::unique_ptr<Parallel::Callback>{}
+               : std::unique_ptr<Parallel::Callback>(
+                     new UseCkCallbackAsCallback(
+                         CkCallback(CkCallback::ignore)));
+  };
+  for (size_t i = 0; i < 2; ++i) {
+    SPECTRE_PARALLEL_REQUIRE(not Parallel::mutable_cache_item_is_ready<email>(
+        cache, array_component_id, wait_for_planck));
+    SPECTRE_PARALLEL_REQUIRE(
+        cache.mutable_cache_statistics().callbacks_registered == 1);
+    SPECTRE_PARALLEL_REQUIRE(
+        cache.mutable_cache_statistics().callbacks_invoked == 0);
+  }
+  // Mutating the email invokes the callback
+  Parallel::mutate<email, modify_value<std::string>>(
+      cache, std::string("max@planck.de"));
+  SPECTRE_PARALLEL_REQUIRE(
+      cache.mutable_cache_statistics().callbacks_registered == 1);
+  SPECTRE_PARALLEL_REQUIRE(
+      cache.mutable_cache_statistics().callbacks_invoked == 1);
+  SPECTRE_PARALLEL_REQUIRE(Parallel::mutable_cache_item_is_ready<email>(
+      cache, array_component_id, wait_for_planck));
+  // The callback was removed when it was invoked, so further mutations don't
+  // invoke it again
+  Parallel::mutate<email, modify_value<std::string>>(
+      cache, std::string("isaac@newton.com"));
+  SPECTRE_PARALLEL_REQUIRE(
+      cache.mutable_cache_statistics().callbacks_registered == 1);
+  SPECTRE_PARALLEL_REQUIRE(
+      cache.mutable_cache_statistics().callbacks_invoked == 1);
   // Make the arthropod into a spider.
   Parallel::mutate<animal, modify_number_of_legs>(cache, 8_st);
   SPECTRE_PARALLEL_REQUIRE(8 == Parallel::get<animal>(cache).number_of_legs());
@@ -500,7 +543,8 @@ Test_GlobalCache<Metavariables>::Test_GlobalCache(CkArgMsg*
       std::move(const_data_to_be_cached), std::move(mutable_data_to_be_cached),
       std::nullopt);
 
-  Parallel::ResourceInfo<TestMetavariables> resource_info{false};
+  Parallel::ResourceInfo<TestMetavariables> resource_info{
+      false, std::nullopt, false};
 
   const auto local_cache = Parallel::local_branch(global_cache_proxy_);
 
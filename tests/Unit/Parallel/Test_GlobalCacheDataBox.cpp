@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -79,7 +80,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.GlobalCacheDataBox", "[Unit][Parallel]") {
   tuples::get<Tags::UniquePtrIntegerList>(tuple) =
       std::make_unique<std::array<int, 3>>(std::array<int, 3>{{1, 5, -8}});
   GlobalCache<Metavars> cache{std::move(tuple)};
-  Parallel::ResourceInfo<Metavars> resource_info{false};
+  Parallel::ResourceInfo<Metavars> resource_info{false, std::nullopt, false};
   resource_info.build_singleton_map(cache);
   cache.set_resource_info(resource_info);
   auto box = db::create<
@@ -0,0 +1,64 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/MeasuredCost.hpp"
+#include "Utilities/GetOutput.hpp"
+
+SPECTRE_TEST_CASE("Unit.Parallel.MeasuredCost", "[Unit][Parallel]") {
+  Parallel::MeasuredCost cost{};
+  CHECK(cost.wall_time() == 0.0);
+  CHECK(cost.number_of_iterations() == 0);
+  CHECK(cost.wall_time_per_iteration() == 0.0);
+
+  cost.add_wall_time(1.5);
+  CHECK(cost.wall_time() == 1.5);
+  CHECK(cost.wall_time_per_iteration() == 0.0);
+  cost.add_iteration();
+  cost.add_wall_time(0.5);
+  cost.add_iteration();
+  CHECK(cost.wall_time() == 2.0);
+  CHECK(cost.number_of_iterations() == 2);
+  CHECK(cost.wall_time_per_iteration() == 1.0);
+  CHECK(get_output(cost) == "(2s, 2 iterations)");
+
+  CHECK(cost != Parallel::MeasuredCost{});
+  test_serialization(cost);
+  test_copy_semantics(cost);
+
+  cost.reset();
+  CHECK(cost.wall_time() == 0.0);
+  CHECK(cost.number_of_iterations() == 0);
+  CHECK(cost.wall_time_since_load_balancing() == 2.0);
+  CHECK(cost != Parallel::MeasuredCost{});
+  cost.add_wall_time(1.0);
+  CHECK(cost.wall_time() == 1.0);
+  CHECK(cost.wall_time_since_load_balancing() == 3.0);
+  cost.reset_wall_time_since_load_balancing();
+  CHECK(cost.wall_time_since_load_balancing() == 0.0);
+  CHECK(cost.wall_time() == 1.0);
+  cost.reset();
+  CHECK(cost == Parallel::MeasuredCost{});
+
+  Parallel::MeasuredCost parent_cost{};
+  parent_cost.add_wall_time(3.0);
+  parent_cost.add_iteration();
+  parent_cost.add_iteration();
+  const auto child_cost = parent_cost.split(4);
+  CHECK(child_cost.wall_time() == 0.75);
+  CHECK(child_cost.number_of_iterations() == 2);
+  CHECK(child_cost.wall_time_since_load_balancing() == 0.75);
+  CHECK(parent_cost.split(1) == parent_cost);
+
+  Parallel::MeasuredCost joined_cost{};
+  joined_cost.join(child_cost);
+  Parallel::MeasuredCost other_child_cost{};
+  other_child_cost.add_wall_time(0.25);
+  other_child_cost.add_iteration();
+  joined_cost.join(other_child_cost);
+  CHECK(joined_cost.wall_time() == 1.0);
+  CHECK(joined_cost.number_of_iterations() == 2);
+  CHECK(joined_cost.wall_time_since_load_balancing() == 1.0);
+}
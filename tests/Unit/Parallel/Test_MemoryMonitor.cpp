@@ -3,6 +3,8 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
+#include <map>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -22,7 +24,9 @@
 #include "Parallel/Phase.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ContributeMemoryData.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ContributeScratchArenaData.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessDataBox.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
@@ -430,6 +434,112 @@ void test_process_array(const gsl::not_null<Gen*> gen) {
   check_output<array_comp<metavars>>(runner, time, num_nodes, size_per_node);
 }
 
+void test_process_databox() {
+  INFO("Test ProcessDataBox");
+
+  // 4 mock nodes, 3 mock cores per node
+  const size_t num_nodes = 4;
+  const size_t num_procs_per_node = 3;
+  ActionTesting::MockRuntimeSystem<metavars> runner{
+      {}, {}, std::vector<size_t>(num_nodes, num_procs_per_node)};
+
+  setup_runner(make_not_null(&runner));
+
+  auto& cache = ActionTesting::cache<mem_mon_comp<metavars>>(runner, 0);
+  auto& mem_monitor_proxy =
+      Parallel::get_parallel_component<mem_mon_comp<metavars>>(cache);
+
+  const double time = 0.5;
+  const std::map<std::string, size_t> item_sizes{
+      {"Mortars", 3000000}, {"History", 5000000}, {"Element", 1000}};
+  Parallel::simple_action<mem_monitor::ProcessDataBox<array_comp<metavars>>>(
+      mem_monitor_proxy, time, item_sizes);
+  ActionTesting::invoke_queued_simple_action<mem_mon_comp<metavars>>(
+      make_not_null(&runner), 0);
+  CHECK(ActionTesting::number_of_queued_threaded_actions<
+            obs_writer_comp<metavars>>(runner, 0) == 1);
+  ActionTesting::invoke_queued_threaded_action<obs_writer_comp<metavars>>(
+      make_not_null(&runner), 0);
+
+  auto& read_file = ActionTesting::get_databox_tag<
+      obs_writer_comp<metavars>, TestHelpers::observers::MockReductionFileTag>(
+      runner, 0);
+  const auto& dataset = read_file.get_dat(
+      mem_monitor::subfile_name<array_comp<metavars>>() + "DataBox");
+  const std::vector<std::string> expected_legend{
+      "Time", "Element (MB)", "History (MB)", "Mortars (MB)",
+      "Largest item (MB)", "Total (MB)"};
+  CHECK(dataset.get_legend() == expected_legend);
+
+  const Matrix data = dataset.get_data();
+  CHECK(data.rows() == 1);
+  CHECK(data(0, 0) == time);
+  CHECK(data(0, 1) == approx(0.001));
+  CHECK(data(0, 2) == approx(5.0));
+  CHECK(data(0, 3) == approx(3.0));
+  CHECK(data(0, 4) == approx(5.0));
+  CHECK(data(0, 5) == approx(8.001));
+}
+
+void test_contribute_scratch_arena_data() {
+  INFO("Test ContributeScratchArenaData");
+
+  // 4 mock nodes, 3 mock cores per node
+  const size_t num_nodes = 4;
+  const size_t num_procs_per_node = 3;
+  ActionTesting::MockRuntimeSystem<metavars> runner{
+      {}, {}, std::vector<size_t>(num_nodes, num_procs_per_node)};
+
+  setup_runner(make_not_null(&runner));
+
+  auto& cache = ActionTesting::cache<mem_mon_comp<metavars>>(runner, 0);
+  auto& mem_monitor_proxy =
+      Parallel::get_parallel_component<mem_mon_comp<metavars>>(cache);
+
+  const double time = 0.5;
+  // Contribute out of order to make sure the columns are sorted by node
+  for (const int node : {2, 0, 3, 1}) {
+    Parallel::simple_action<mem_monitor::ContributeScratchArenaData>(
+        mem_monitor_proxy, time, node, 3.0 * node, 1.0);
+  }
+  for (size_t i = 0; i < num_nodes; ++i) {
+    ActionTesting::invoke_queued_simple_action<mem_mon_comp<metavars>>(
+        make_not_null(&runner), 0);
+    // Only the last contribution writes data
+    CHECK(ActionTesting::number_of_queued_threaded_actions<
+              obs_writer_comp<metavars>>(runner, 0) ==
+          (i == num_nodes - 1 ? 1 : 0));
+  }
+  ActionTesting::invoke_queued_threaded_action<obs_writer_comp<metavars>>(
+      make_not_null(&runner), 0);
+
+  const auto& memory_holder =
+      ActionTesting::get_databox_tag<mem_mon_comp<metavars>,
+                                     mem_monitor::Tags::MemoryHolder>(runner,
+                                                                      0);
+  CHECK(memory_holder.at("ScratchArena/Arena").empty());
+  CHECK(memory_holder.at("ScratchArena/Heap").empty());
+
+  auto& read_file = ActionTesting::get_databox_tag<
+      obs_writer_comp<metavars>, TestHelpers::observers::MockReductionFileTag>(
+      runner, 0);
+  const auto& dataset = read_file.get_dat("/MemoryMonitors/ScratchArena");
+  const std::vector<std::string>& legend = dataset.get_legend();
+  CHECK(legend.size() == 2 * num_nodes + 2);
+  CHECK(legend[1] == "Arena on node 0 (MB)");
+  CHECK(legend[2] == "Heap on node 0 (MB)");
+  CHECK(legend.back() == "Fraction from arena");
+
+  const Matrix data = dataset.get_data();
+  CHECK(data.rows() == 1);
+  CHECK(data(0, 0) == time);
+  for (size_t node = 0; node < num_nodes; ++node) {
+    CHECK(data(0, 2 * node + 1) == 3.0 * static_cast<double>(node));
+    CHECK(data(0, 2 * node + 2) == 1.0);
+  }
+  CHECK(data(0, 2 * num_nodes + 1) == approx(18.0 / 22.0));
+}
+
 void test_process_singleton() {
   INFO("Test ProcessSingleton");
 
@@ -539,7 +649,10 @@ void test_monitor_memory_event() {
 
   // Run the event. This will queue a lot of actions
   const double time = 1.4;
-  monitor_memory(element, cache, 0,
+  monitor_memory(element,
+                 ActionTesting::get_databox<dg_elem_comp<event_metavars>>(
+                     runner, 0),
+                 cache, 0,
                  std::add_pointer_t<dg_elem_comp<event_metavars>>{},
                  {"TimeName", time});
 
@@ -660,6 +773,8 @@ SPECTRE_TEST_CASE("Unit.Parallel.MemoryMonitor", "[Unit][Parallel]") {
   // Then test the Process(Node)Group actions (second arg true)
   test_contribute_memory_data(make_not_null(&gen), true);
   test_process_array(make_not_null(&gen));
+  test_process_databox();
+  test_contribute_scratch_arena_data();
   test_process_singleton();
   test_event_construction();
   test_monitor_memory_event();
@@ -0,0 +1,77 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Parallel/MpscQueue.hpp"
+
+namespace {
+void test_single_thread() {
+  Parallel::MpscQueue<std::unique_ptr<int>> queue{};
+  CHECK(queue.empty());
+  CHECK(queue.consume_all([](std::unique_ptr<int>&& /*value*/) {}) == 0);
+  queue.push(std::make_unique<int>(3));
+  queue.emplace(std::make_unique<int>(5));
+  queue.push(std::make_unique<int>(7));
+  CHECK_FALSE(queue.empty());
+
+  auto moved_queue = std::move(queue);
+  // NOLINTNEXTLINE(clang-analyzer-cplusplus.Move,bugprone-use-after-move)
+  CHECK(queue.empty());
+  CHECK_FALSE(moved_queue.empty());
+
+  std::vector<int> values{};
+  CHECK(moved_queue.consume_all([&values](std::unique_ptr<int>&& value) {
+    values.push_back(*value);
+  }) == 3);
+  CHECK(values == std::vector<int>{3, 5, 7});
+  CHECK(moved_queue.empty());
+
+  // Values left in the queue are destroyed with it
+  moved_queue.push(std::make_unique<int>(9));
+  queue = std::move(moved_queue);
+  CHECK_FALSE(queue.empty());
+}
+
+void test_multiple_producers() {
+  constexpr size_t number_of_producers = 4;
+  constexpr size_t number_of_pushes = 1000;
+  Parallel::MpscQueue<std::pair<size_t, size_t>> queue{};
+  std::vector<std::thread> producers{};
+  for (size_t producer = 0; producer < number_of_producers; ++producer) {
+    producers.emplace_back([&queue, producer]() {
+      for (size_t i = 0; i < number_of_pushes; ++i) {
+        queue.emplace(producer, i);
+      }
+    });
+  }
+  // Consume while the producers are pushing. The values of each producer must
+  // arrive in the order they were pushed.
+  std::vector<size_t> next_value(number_of_producers, 0);
+  size_t number_consumed = 0;
+  const auto consume = [&next_value](std::pair<size_t, size_t>&& value) {
+    CHECK(value.second == next_value[value.first]);
+    ++next_value[value.first];
+  };
+  while (number_consumed < number_of_producers * number_of_pushes) {
+    number_consumed += queue.consume_all(consume);
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  CHECK(queue.empty());
+  CHECK(next_value == std::vector<size_t>(number_of_producers,
+                                          number_of_pushes));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.MpscQueue", "[Unit][Parallel]") {
+  test_single_thread();
+  test_multiple_producers();
+}
@@ -3,6 +3,8 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
+
 #include "Framework/TestHelpers.hpp"
 #include "Parallel/NodeLock.hpp"
 
@@ -167,6 +169,41 @@ void test_serialization() {
   CHECK(destroyed.is_destroyed());
   CHECK(serialized_destroyed.is_destroyed());
 }
+
+void test_statistics() {
+  const auto check_statistics = [](const Parallel::NodeLock& lock,
+                                   const size_t expected_acquisitions,
+                                   const size_t expected_contended_locks,
+                                   const size_t expected_failed_try_locks) {
+    const auto statistics = lock.statistics();
+    CHECK(statistics.number_of_acquisitions == expected_acquisitions);
+    CHECK(statistics.number_of_contended_locks == expected_contended_locks);
+    CHECK(statistics.number_of_failed_try_locks == expected_failed_try_locks);
+  };
+  Parallel::NodeLock lock{};
+  check_statistics(lock, 0, 0, 0);
+  lock.lock();
+  check_statistics(lock, 1, 0, 0);
+  CHECK_FALSE(lock.try_lock());
+  CHECK_FALSE(lock.try_lock());
+  check_statistics(lock, 1, 0, 2);
+  lock.unlock();
+  CHECK(lock.try_lock());
+  check_statistics(lock, 2, 0, 2);
+  lock.unlock();
+
+  Parallel::NodeLock moved_lock{std::move(lock)};
+  check_statistics(moved_lock, 2, 0, 2);
+  // NOLINTNEXTLINE(clang-analyzer-cplusplus.Move,bugprone-use-after-move)
+  check_statistics(lock, 0, 0, 0);
+  Parallel::NodeLock move_assigned_lock{};
+  move_assigned_lock = std::move(moved_lock);
+  check_statistics(move_assigned_lock, 2, 0, 2);
+  // The counters are not serialized
+  check_statistics(serialize_and_deserialize(move_assigned_lock), 0, 0, 0);
+  move_assigned_lock.reset_statistics();
+  check_statistics(move_assigned_lock, 0, 0, 0);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Parallel.NodeLock", "[Unit][Parallel]") {
@@ -174,6 +211,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.NodeLock", "[Unit][Parallel]") {
   test_move_semantics();
   test_move_assign_semantics();
   test_serialization();
+  test_statistics();
 
   CHECK_THROWS_WITH(
       ([]() {
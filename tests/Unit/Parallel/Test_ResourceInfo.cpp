@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -140,7 +141,8 @@ void test_tags() {
   Parallel::GlobalCache<metavars> cache{};
   const SingletonInfoHolder<FakeSingleton<metavars, 0>> info_holder{{0}, false};
 
-  ResourceInfo<metavars> resource_info{false, std::optional{info_holder}};
+  ResourceInfo<metavars> resource_info{false, std::nullopt, false,
+                                       std::optional{info_holder}};
   resource_info.build_singleton_map(cache);
 }
 
@@ -153,6 +155,8 @@ void test_single_core() {
     auto resource_info_0 =
         TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
             "AvoidGlobalProc0: false\n"
+            "ReservedProcs: None\n"
+            "ReportSingletonUtilization: false\n"
             "Singletons:\n"
             "  FakeSingleton0:\n"
             "    Proc: 0\n"
@@ -160,6 +164,8 @@ void test_single_core() {
     auto resource_info_auto =
         TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
             "AvoidGlobalProc0: false\n"
+            "ReservedProcs: None\n"
+            "ReportSingletonUtilization: false\n"
             "Singletons:\n"
             "  FakeSingleton0: Auto\n");
 
@@ -171,6 +177,7 @@ void test_single_core() {
 
     CHECK_FALSE(resource_info_0.avoid_global_proc_0());
     CHECK_FALSE(resource_info_auto.avoid_global_proc_0());
+    CHECK_FALSE(resource_info_0.report_singleton_utilization());
 
     const size_t proc_0 =
         resource_info_0.template proc_for<FakeSingleton<metavars, 0>>();
@@ -209,6 +216,8 @@ void test_single_core() {
     auto resource_info =
         TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
             "AvoidGlobalProc0: false\n"
+            "ReservedProcs: None\n"
+            "ReportSingletonUtilization: false\n"
             "Singletons: Auto\n");
     Parallel::GlobalCache<metavars> cache{};
     resource_info.build_singleton_map(cache);
@@ -242,6 +251,8 @@ void test_errors() {
         const auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: false\n"
+                "ReservedProcs: None\n"
+                "ReportSingletonUtilization: false\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: -2\n"
@@ -255,6 +266,8 @@ void test_errors() {
         const auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: true\n"
+                "ReservedProcs: None\n"
+                "ReportSingletonUtilization: false\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -269,6 +282,8 @@ void test_errors() {
         const auto resource_info = TestHelpers::test_option_tag<
             OptionTags::ResourceInfo<Metavariables<0, 1>>>(
             "AvoidGlobalProc0: false\n"
+            "ReservedProcs: None\n"
+            "ReportSingletonUtilization: false\n"
             "Singletons:\n"
             "  FakeSingleton0:\n"
             "    Proc: 0\n"
@@ -286,6 +301,8 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: false\n"
+                "ReservedProcs: None\n"
+                "ReportSingletonUtilization: false\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 2\n"
@@ -299,6 +316,8 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: false\n"
+                "ReservedProcs: None\n"
+                "ReportSingletonUtilization: false\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -314,6 +333,8 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: true\n"
+                "ReservedProcs: None\n"
+                "ReportSingletonUtilization: false\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -330,6 +351,8 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: true\n"
+                "ReservedProcs: None\n"
+                "ReportSingletonUtilization: false\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -346,6 +369,8 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: true\n"
+                "ReservedProcs: None\n"
+                "ReportSingletonUtilization: false\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -362,6 +387,8 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: true\n"
+                "ReservedProcs: None\n"
+                "ReportSingletonUtilization: false\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -380,6 +407,8 @@ Parallel::ResourceInfo<Metavariables> create_resource_info(
     const std::vector<std::pair<bool, int>>& singletons) {
   std::string option_str =
       "AvoidGlobalProc0: " + (avoid_global_proc_0 ? "true"s : "false"s) + "\n";
+  option_str += "ReservedProcs: None\n";
+  option_str += "ReportSingletonUtilization: false\n";
   option_str += "Singletons:\n";
   for (size_t i = 0; i < singletons.size(); i++) {
     const bool exclusive = singletons[i].first;
@@ -903,6 +932,112 @@ void test_multi_node_multi_core_large(const gsl::not_null<Gen*> gen) {
     check_resource_info(cache, true, singletons, expected);
   }
 }
+
+void test_reserved_procs() {
+  const auto reserved_procs_info =
+      TestHelpers::test_creation<ReservedProcsInfo>(
+          "Nodes: [1]\n"
+          "ProcsPerNode: 2\n");
+  CHECK(reserved_procs_info.nodes() == std::vector<size_t>{1});
+  CHECK(reserved_procs_info.procs_per_node() == 2);
+  CHECK(serialize_and_deserialize(reserved_procs_info) == reserved_procs_info);
+  const auto reserved_procs_on_all_nodes =
+      TestHelpers::test_creation<ReservedProcsInfo>(
+          "Nodes: All\n"
+          "ProcsPerNode: 1\n");
+  CHECK_FALSE(reserved_procs_on_all_nodes.nodes().has_value());
+  CHECK(reserved_procs_on_all_nodes != reserved_procs_info);
+
+  using reserved_metavars = Metavariables<0, 1, 2>;
+  // 2 nodes, 4 procs per node
+  Parallel::GlobalCache<reserved_metavars> cache{{}, {}, {4, 4}};
+  const auto create = [](const std::string& reserved_procs,
+                         const bool avoid_global_proc_0) {
+    const std::string option_str =
+        "AvoidGlobalProc0: "s + (avoid_global_proc_0 ? "true"s : "false"s) +
+        "\nReservedProcs:" + reserved_procs +
+        "ReportSingletonUtilization: true\n"
+        "Singletons:\n"
+        "  FakeSingleton0:\n"
+        "    Proc: Auto\n"
+        "    Exclusive: true\n"
+        "  FakeSingleton1: Auto\n"
+        "  FakeSingleton2: Auto\n";
+    return serialize_and_deserialize(
+        TestHelpers::test_option_tag<
+            OptionTags::ResourceInfo<reserved_metavars>>(option_str));
+  };
+  {
+    INFO("Reserve procs on one node");
+    auto resource_info = create(
+        "\n"
+        "  Nodes: [1]\n"
+        "  ProcsPerNode: 2\n",
+        false);
+    resource_info.build_singleton_map(cache);
+    CHECK(resource_info.reserved_procs() == std::set<size_t>{6, 7});
+    CHECK(resource_info.report_singleton_utilization());
+    CHECK(resource_info.procs_to_ignore() ==
+          std::unordered_set<size_t>{6, 7});
+    CHECK(resource_info.procs_available_for_elements() ==
+          std::set<size_t>{0, 1, 2, 3, 4, 5});
+    // The exclusive singleton gets a reserved proc to itself and the others
+    // share the remaining one
+    CHECK(resource_info.proc_for<FakeSingleton<reserved_metavars, 0>>() == 6);
+    CHECK(resource_info.proc_for<FakeSingleton<reserved_metavars, 1>>() == 7);
+    CHECK(resource_info.proc_for<FakeSingleton<reserved_metavars, 2>>() == 7);
+    CHECK(serialize_and_deserialize(resource_info) == resource_info);
+  }
+  {
+    INFO("Reserve procs on all nodes");
+    auto resource_info = create(
+        "\n"
+        "  Nodes: All\n"
+        "  ProcsPerNode: 2\n",
+        true);
+    resource_info.build_singleton_map(cache);
+    CHECK(resource_info.reserved_procs() == std::set<size_t>{2, 3, 6, 7});
+    CHECK(resource_info.procs_to_ignore() ==
+          std::unordered_set<size_t>{0, 2, 3, 6, 7});
+    CHECK(resource_info.procs_available_for_elements() ==
+          std::set<size_t>{1, 4, 5});
+    CHECK(resource_info.proc_for<FakeSingleton<reserved_metavars, 0>>() == 2);
+    CHECK(resource_info.proc_for<FakeSingleton<reserved_metavars, 1>>() == 3);
+    CHECK(resource_info.proc_for<FakeSingleton<reserved_metavars, 2>>() == 6);
+  }
+  {
+    INFO("No reserved procs");
+    auto resource_info = create(" None\n", false);
+    resource_info.build_singleton_map(cache);
+    CHECK(resource_info.reserved_procs().empty());
+    CHECK(resource_info.procs_to_ignore().size() == 1);
+  }
+  CHECK_THROWS_WITH(create(
+                        "\n"
+                        "  Nodes: [2]\n"
+                        "  ProcsPerNode: 1\n",
+                        false)
+                        .build_singleton_map(cache),
+                    Catch::Matchers::ContainsSubstring(
+                        "Can't reserve procs on node 2 because there are 2 "
+                        "nodes."));
+  CHECK_THROWS_WITH(create(
+                        "\n"
+                        "  Nodes: [0]\n"
+                        "  ProcsPerNode: 5\n",
+                        false)
+                        .build_singleton_map(cache),
+                    Catch::Matchers::ContainsSubstring(
+                        "because it only has 4 procs"));
+  CHECK_THROWS_WITH(create(
+                        "\n"
+                        "  Nodes: All\n"
+                        "  ProcsPerNode: 4\n",
+                        false)
+                        .build_singleton_map(cache),
+                    Catch::Matchers::ContainsSubstring(
+                        "No cores are left for array elements"));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Parallel.ResourceInfo", "[Unit][Parallel]") {
@@ -914,6 +1049,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.ResourceInfo", "[Unit][Parallel]") {
   test_single_node_multi_core(make_not_null(&gen));
   test_multi_node_multi_core(make_not_null(&gen));
   test_multi_node_multi_core_large(make_not_null(&gen));
+  test_reserved_procs();
   test_errors();
 }
 }  // namespace Parallel
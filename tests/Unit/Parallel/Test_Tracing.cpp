@@ -0,0 +1,62 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+
+#include "Parallel/Phase.hpp"
+#include "Parallel/Tracing.hpp"
+#include "Utilities/PrettyType.hpp"
+
+namespace {
+struct SomeAction {};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.Tracing", "[Unit][Parallel]") {
+  Parallel::tracing::clear();
+  CHECK(Parallel::tracing::number_of_spans() == 0);
+  CHECK(Parallel::tracing::span_name<SomeAction>() ==
+        pretty_type::get_name<SomeAction>());
+  CHECK(&Parallel::tracing::span_name<SomeAction>() ==
+        &Parallel::tracing::span_name<SomeAction>());
+
+  {
+    const Parallel::tracing::ScopedSpan span{
+        Parallel::tracing::span_name<SomeAction>()};
+  }
+  CHECK(Parallel::tracing::number_of_spans() == 1);
+  Parallel::tracing::record_phase(Parallel::Phase::Evolve, 1.5);
+  CHECK(Parallel::tracing::number_of_spans() == 2);
+  static const std::string quoted_name = "Quoted \"name\"";
+  std::thread other_thread{[]() {
+    const auto now = std::chrono::steady_clock::now();
+    Parallel::tracing::record_span(quoted_name, now, now);
+  }};
+  other_thread.join();
+  CHECK(Parallel::tracing::number_of_spans() == 3);
+
+  const std::string trace = Parallel::tracing::chrome_trace_json(3);
+  CHECK(trace.find("{\"traceEvents\":[") == 0);
+  CHECK(trace.find("SomeAction\",\"ph\":\"X\"") != std::string::npos);
+  CHECK(trace.find("\"name\":\"Phase Evolve\"") != std::string::npos);
+  CHECK(trace.find("\"dur\":1500000.000,\"pid\":3") != std::string::npos);
+  CHECK(trace.find("\"name\":\"Quoted \\\"name\\\"\"") != std::string::npos);
+
+  // Only the most recent spans are kept
+  for (size_t i = 0; i < Parallel::tracing::spans_per_thread; ++i) {
+    const auto now = std::chrono::steady_clock::now();
+    Parallel::tracing::record_span(quoted_name, now, now);
+  }
+  CHECK(Parallel::tracing::number_of_spans() ==
+        Parallel::tracing::spans_per_thread + 1);
+  CHECK(Parallel::tracing::chrome_trace_json(0).find("SomeAction") ==
+        std::string::npos);
+
+  Parallel::tracing::clear();
+  CHECK(Parallel::tracing::number_of_spans() == 0);
+  CHECK(Parallel::tracing::chrome_trace_json(0) == "{\"traceEvents\":[\n]}\n");
+}
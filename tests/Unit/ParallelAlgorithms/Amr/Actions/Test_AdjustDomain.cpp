@@ -35,6 +35,7 @@
 #include "ParallelAlgorithms/Amr/Actions/CreateParent.hpp"
 #include "ParallelAlgorithms/Amr/Projectors/DefaultInitialize.hpp"
 #include "ParallelAlgorithms/Amr/Protocols/AmrMetavariables.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/StdHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -66,20 +67,14 @@ struct MockCreateChild {
       const int /*array_index*/, ElementProxy /*element_proxy*/,
       ElementId<Metavariables::volume_dim> parent_id,
       std::vector<ElementId<Metavariables::volume_dim>> children_ids,
-      const size_t index_of_child_id,
+      const int parent_proc,
       const std::unordered_map<Parallel::Phase, size_t>&
           parent_phase_bookmarks) {
     CHECK(parent_id == ElementId<1>{0, std::array{SegmentId{1, 1}}});
-    if (index_of_child_id == 0) {
-      CHECK(children_ids ==
-            std::vector{ElementId<1>{0, std::array{SegmentId{2, 2}}},
-                        ElementId<1>{0, std::array{SegmentId{2, 3}}}});
-    } else {
-      CHECK(index_of_child_id == 1);
-      CHECK(children_ids ==
-            std::vector{ElementId<1>{0, std::array{SegmentId{2, 2}}},
-                        ElementId<1>{0, std::array{SegmentId{2, 3}}}});
-    }
+    CHECK(children_ids ==
+          std::vector{ElementId<1>{0, std::array{SegmentId{2, 2}}},
+                      ElementId<1>{0, std::array{SegmentId{2, 3}}}});
+    CHECK(parent_proc == 0);
     CHECK(parent_phase_bookmarks.empty());
   }
 };
@@ -27,7 +27,6 @@
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "ParallelAlgorithms/Amr/Actions/CreateChild.hpp"
-#include "Utilities/Literals.hpp"
 
 namespace {
 
@@ -135,28 +134,16 @@ void test() {
   auto& element_proxy =
       Parallel::get_parallel_component<array_component>(cache);
 
-  // Call CreateChild, creating the first child and queueing CreateChild on
-  // the singleton component in order to create the second child
+  // Call CreateChild, creating both children at once and queueing
+  // SendDataToChildren on the parent element in order to send data to the
+  // children
   ActionTesting::simple_action<singleton_component, amr::Actions::CreateChild>(
-      make_not_null(&runner), 0, element_proxy, parent_id, children_ids, 0_st,
+      make_not_null(&runner), 0, element_proxy, parent_id, children_ids, 0,
       std::unordered_map<Parallel::Phase, size_t>{});
   for (const auto& child_id : children_ids) {
     CHECK(ActionTesting::is_simple_action_queue_empty<array_component>(
         runner, child_id));
   }
-  CHECK(ActionTesting::number_of_queued_simple_actions<singleton_component>(
-            runner, 0) == 1);
-  CHECK(ActionTesting::is_simple_action_queue_empty<array_component>(
-      runner, parent_id));
-
-  // Call CreateChild, creating the second child and queueing SendDataToChildren
-  // on the parent element in order to send data to the first child
-  ActionTesting::invoke_queued_simple_action<singleton_component>(
-      make_not_null(&runner), 0);
-  for (const auto& child_id : children_ids) {
-    CHECK(ActionTesting::is_simple_action_queue_empty<array_component>(
-        runner, child_id));
-  }
   CHECK(ActionTesting::is_simple_action_queue_empty<singleton_component>(runner,
                                                                          0));
   CHECK(ActionTesting::number_of_queued_simple_actions<array_component>(
@@ -12,7 +12,9 @@
 #include "Domain/Amr/Tags/Flags.hpp"
 #include "Domain/Amr/Tags/NeighborFlags.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Parallel/Phase.hpp"
 #include "ParallelAlgorithms/Amr/Actions/Initialize.hpp"
+#include "ParallelAlgorithms/Amr/Tags.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
 
@@ -28,6 +30,15 @@ void test() {
   CHECK(db::get<amr::Tags::Info<Dim>>(box).new_mesh == Mesh<Dim>{});
   CHECK(db::get<amr::Tags::NeighborInfo<Dim>>(box).empty());
 }
+
+void test_component() {
+  auto box = db::create<db::AddSimpleTags<amr::Tags::PhaseStartTimes>>(
+      std::unordered_map<Parallel::Phase, double>{
+          {Parallel::Phase::AdjustDomain, 1.0}});
+  db::mutate_apply<amr::Initialization::InitializeComponent>(
+      make_not_null(&box));
+  CHECK(db::get<amr::Tags::PhaseStartTimes>(box).empty());
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.ParallelAmr.Actions.Initialize",
@@ -35,4 +46,5 @@ SPECTRE_TEST_CASE("Unit.ParallelAmr.Actions.Initialize",
   test<1>();
   test<2>();
   test<3>();
+  test_component();
 }
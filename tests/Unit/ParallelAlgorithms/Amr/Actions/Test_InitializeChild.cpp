@@ -28,9 +28,11 @@
 #include "Framework/MockRuntimeSystemFreeFunctions.hpp"
 #include "Helpers/Domain/Amr/RegistrationHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Parallel/MeasuredCost.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "Parallel/Protocols/RegistrationMetavariables.hpp"
+#include "Parallel/Tags/MeasuredCost.hpp"
 #include "ParallelAlgorithms/Amr/Actions/InitializeChild.hpp"
 #include "ParallelAlgorithms/Amr/Protocols/AmrMetavariables.hpp"
 #include "Utilities/Gsl.hpp"
@@ -50,7 +52,7 @@ struct Component {
   using simple_tags = tmpl::list<
       domain::Tags::Element<volume_dim>, domain::Tags::Mesh<volume_dim>,
       domain::Tags::NeighborMesh<volume_dim>, amr::Tags::Info<volume_dim>,
-      amr::Tags::NeighborInfo<volume_dim>>;
+      amr::Tags::NeighborInfo<volume_dim>, Parallel::Tags::MeasuredCost>;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       Parallel::Phase::Initialization,
       tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
@@ -106,10 +108,16 @@ void test() {
       parent_upper_neighbor_id,
       amr::Info<2>{std::array{amr::Flag::DoNothing, amr::Flag::Split},
                    neighbor_mesh});
+  Parallel::MeasuredCost parent_cost{};
+  parent_cost.add_wall_time(3.0);
+  parent_cost.add_iteration();
+  parent_cost.add_iteration();
   const tuples::TaggedTuple<domain::Tags::Element<2>, domain::Tags::Mesh<2>,
-                            amr::Tags::Info<2>, amr::Tags::NeighborInfo<2>>
+                            amr::Tags::Info<2>, amr::Tags::NeighborInfo<2>,
+                            Parallel::Tags::MeasuredCost>
       parent_items{std::move(parent), std::move(parent_mesh),
-                   std::move(parent_info), std::move(parent_neighbor_info)};
+                   std::move(parent_info), std::move(parent_neighbor_info),
+                   parent_cost};
 
   const ElementId<2> child_id{0, std::array{SegmentId{3, 3}, SegmentId{0, 0}}};
   const ElementId<2> expected_child_upper_neighbor_id_0{
@@ -172,6 +180,14 @@ void test() {
   CHECK(ActionTesting::get_databox_tag<array_component,
                                        amr::Tags::NeighborInfo<2>>(
             runner, child_id) == expected_child_neighbor_info);
+  // The parent is split into two children
+  const auto& child_cost =
+      ActionTesting::get_databox_tag<array_component,
+                                     Parallel::Tags::MeasuredCost>(runner,
+                                                                   child_id);
+  CHECK(child_cost.wall_time() == 1.5);
+  CHECK(child_cost.wall_time_since_load_balancing() == 1.5);
+  CHECK(child_cost.number_of_iterations() == 2);
   CHECK(ActionTesting::get_databox_tag<registrar,
                                        TestHelpers::amr::RegisteredElements<2>>(
             runner, 0)
@@ -26,9 +26,11 @@
 #include "Framework/MockRuntimeSystemFreeFunctions.hpp"
 #include "Helpers/Domain/Amr/RegistrationHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Parallel/MeasuredCost.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "Parallel/Protocols/RegistrationMetavariables.hpp"
+#include "Parallel/Tags/MeasuredCost.hpp"
 #include "ParallelAlgorithms/Amr/Actions/InitializeParent.hpp"
 #include "ParallelAlgorithms/Amr/Protocols/AmrMetavariables.hpp"
 #include "Utilities/Gsl.hpp"
@@ -48,7 +50,7 @@ struct Component {
   using simple_tags = tmpl::list<
       domain::Tags::Element<volume_dim>, domain::Tags::Mesh<volume_dim>,
       domain::Tags::NeighborMesh<volume_dim>, amr::Tags::Info<volume_dim>,
-      amr::Tags::NeighborInfo<volume_dim>>;
+      amr::Tags::NeighborInfo<volume_dim>, Parallel::Tags::MeasuredCost>;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       Parallel::Phase::Initialization,
       tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
@@ -265,27 +267,37 @@ void test() {
                           Parallel::Tags::GlobalCacheImpl<Metavariables>,
                           domain::Tags::Element<3>, domain::Tags::Mesh<3>,
                           domain::Tags::NeighborMesh<3>, amr::Tags::Info<3>,
-                          amr::Tags::NeighborInfo<3>>;
+                          amr::Tags::NeighborInfo<3>,
+                          Parallel::Tags::MeasuredCost>;
   std::unordered_map<ElementId<3>, TaggedTupleType> children_items;
   DirectionalIdMap<3, Mesh<3>> unused_child_neighbor_mesh{};
+  // Child i spent i seconds in i + 1 iterations
+  const auto child_cost = [](const size_t i) {
+    Parallel::MeasuredCost cost{};
+    cost.add_wall_time(static_cast<double>(i));
+    for (size_t j = 0; j < i + 1; ++j) {
+      cost.add_iteration();
+    }
+    return cost;
+  };
   children_items.emplace(
       child_1_id,
       TaggedTupleType{Metavariables{}, child_1_id, nullptr, std::move(child_1),
                       std::move(child_1_mesh), unused_child_neighbor_mesh,
                       std::move(child_1_info),
-                      std::move(child_1_neighbor_info)});
+                      std::move(child_1_neighbor_info), child_cost(1)});
   children_items.emplace(
       child_2_id,
       TaggedTupleType{Metavariables{}, child_2_id, nullptr, std::move(child_2),
                       std::move(child_2_mesh), unused_child_neighbor_mesh,
                       std::move(child_2_info),
-                      std::move(child_2_neighbor_info)});
+                      std::move(child_2_neighbor_info), child_cost(2)});
   children_items.emplace(
       child_3_id,
       TaggedTupleType{Metavariables{}, child_3_id, nullptr, std::move(child_3),
                       std::move(child_3_mesh), unused_child_neighbor_mesh,
                       std::move(child_3_info),
-                      std::move(child_3_neighbor_info)});
+                      std::move(child_3_neighbor_info), child_cost(3)});
 
   DirectionMap<3, Neighbors<3>> expected_parent_neighbors{};
   expected_parent_neighbors.emplace(
@@ -359,6 +371,13 @@ void test() {
   CHECK(ActionTesting::get_databox_tag<array_component,
                                        amr::Tags::NeighborInfo<3>>(
             runner, parent_id) == expected_parent_neighbor_info);
+  const auto& parent_cost =
+      ActionTesting::get_databox_tag<array_component,
+                                     Parallel::Tags::MeasuredCost>(runner,
+                                                                   parent_id);
+  CHECK(parent_cost.wall_time() == 6.0);
+  CHECK(parent_cost.wall_time_since_load_balancing() == 6.0);
+  CHECK(parent_cost.number_of_iterations() == 4);
   CHECK(ActionTesting::get_databox_tag<registrar,
                                        TestHelpers::amr::RegisteredElements<3>>(
             runner, 0)
@@ -0,0 +1,61 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <unordered_map>
+
+#include "Framework/ActionTesting.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Amr/Actions/RecordPhaseStartTime.hpp"
+#include "ParallelAlgorithms/Amr/Tags.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+template <typename Metavariables>
+struct Component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockSingletonChare;
+  using array_index = int;
+  using const_global_cache_tags = tmpl::list<>;
+  using simple_tags = tmpl::list<amr::Tags::PhaseStartTimes>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<Component<Metavariables>>;
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAmr.Actions.RecordPhaseStartTime",
+                  "[ParallelAlgorithms][Unit]") {
+  using component = Component<Metavariables>;
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_singleton_component_and_initialize<component>(
+      &runner, ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{0},
+      {std::unordered_map<Parallel::Phase, double>{}});
+  const auto& phase_start_times =
+      ActionTesting::get_databox_tag<component, amr::Tags::PhaseStartTimes>(
+          runner, 0);
+
+  ActionTesting::simple_action<component, amr::Actions::RecordPhaseStartTime>(
+      make_not_null(&runner), 0, Parallel::Phase::EvaluateAmrCriteria);
+  CHECK(phase_start_times.size() == 1);
+  ActionTesting::simple_action<component, amr::Actions::RecordPhaseStartTime>(
+      make_not_null(&runner), 0, Parallel::Phase::AdjustDomain);
+  CHECK(phase_start_times.size() == 2);
+  CHECK(phase_start_times.at(Parallel::Phase::AdjustDomain) >=
+        phase_start_times.at(Parallel::Phase::EvaluateAmrCriteria));
+
+  // Starting a phase again overwrites its start time
+  const double first_adjust_domain_start_time =
+      phase_start_times.at(Parallel::Phase::AdjustDomain);
+  ActionTesting::simple_action<component, amr::Actions::RecordPhaseStartTime>(
+      make_not_null(&runner), 0, Parallel::Phase::AdjustDomain);
+  CHECK(phase_start_times.size() == 2);
+  CHECK(phase_start_times.at(Parallel::Phase::AdjustDomain) >=
+        first_adjust_domain_start_time);
+}
@@ -13,6 +13,7 @@
 #include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Protocols/FactoryCreation.hpp"
@@ -59,7 +60,8 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.TruncationError",
       "  AbsoluteTarget: 1.e-3\n"
       "  RelativeTarget: 1.e-3\n");
 
-  const auto evaluate_criterion = [&criterion](const size_t num_points) {
+  const auto evaluate_criterion = [&criterion](const size_t num_points,
+                                               const bool with_modal_tag) {
     const Mesh<Dim> mesh{num_points, Spectral::Basis::Legendre,
                          Spectral::Quadrature::GaussLobatto};
     const auto logical_coords = logical_coordinates(mesh);
@@ -73,6 +75,23 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.TruncationError",
         exp(sin(M_PI * get<0>(logical_coords))) + 2. * get<1>(logical_coords);
 
     Parallel::GlobalCache<Metavariables<Dim>> empty_cache{};
+    if (with_modal_tag) {
+      // The criterion reads the modal coefficients from the DataBox, so
+      // evaluating it again doesn't transform the data again
+      auto databox = db::create<
+          db::AddSimpleTags<::domain::Tags::Mesh<Dim>, TestVector<Dim>>,
+          db::AddComputeTags<
+              ::Tags::ModalCoefficientsCompute<TestVector<Dim>, Dim>>>(
+          mesh, std::move(test_data));
+      auto box = make_observation_box<db::AddComputeTags<>>(
+          make_not_null(&databox));
+      const auto flags =
+          criterion.evaluate(box, empty_cache, ElementId<Dim>{0});
+      const size_t transforms = number_of_modal_transforms();
+      CHECK(criterion.evaluate(box, empty_cache, ElementId<Dim>{0}) == flags);
+      CHECK(number_of_modal_transforms() == transforms);
+      return flags;
+    }
     auto databox =
         db::create<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>(
             mesh, std::move(test_data));
@@ -94,21 +113,27 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.TruncationError",
   //   by symmetry. So we need 4 modes in this dimension.
   {
     INFO("3 modes");
-    const auto flags = evaluate_criterion(3);
-    CHECK(flags[0] == amr::Flag::IncreaseResolution);
-    CHECK(flags[1] == amr::Flag::IncreaseResolution);
+    for (const bool with_modal_tag : {false, true}) {
+      const auto flags = evaluate_criterion(3, with_modal_tag);
+      CHECK(flags[0] == amr::Flag::IncreaseResolution);
+      CHECK(flags[1] == amr::Flag::IncreaseResolution);
+    }
   }
   {
     INFO("4 modes");
-    const auto flags = evaluate_criterion(4);
-    CHECK(flags[0] == amr::Flag::IncreaseResolution);
-    CHECK(flags[1] == amr::Flag::DoNothing);
+    for (const bool with_modal_tag : {false, true}) {
+      const auto flags = evaluate_criterion(4, with_modal_tag);
+      CHECK(flags[0] == amr::Flag::IncreaseResolution);
+      CHECK(flags[1] == amr::Flag::DoNothing);
+    }
   }
   {
     INFO("5 modes");
-    const auto flags = evaluate_criterion(5);
-    CHECK(flags[0] == amr::Flag::IncreaseResolution);
-    CHECK(flags[1] == amr::Flag::DecreaseResolution);
+    for (const bool with_modal_tag : {false, true}) {
+      const auto flags = evaluate_criterion(5, with_modal_tag);
+      CHECK(flags[0] == amr::Flag::IncreaseResolution);
+      CHECK(flags[1] == amr::Flag::DecreaseResolution);
+    }
   }
 }
 
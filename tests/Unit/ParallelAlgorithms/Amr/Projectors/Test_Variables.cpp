@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <unordered_map>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
@@ -123,6 +124,54 @@ void test_h_refine() {
   CHECK_VARIABLES_APPROX(db::get<VariablesTag<0>>(box), child_var_0);
   CHECK_VARIABLES_APPROX(db::get<VariablesTag<1>>(box), child_var_1);
 }
+
+template <size_t Dim>
+void test_h_coarsen() {
+  const ElementId<Dim> parent_element_id{0};
+  const Element<Dim> parent_element{parent_element_id,
+                                    DirectionMap<Dim, Neighbors<Dim>>{}};
+  const Mesh<Dim> parent_mesh{4, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::GaussLobatto};
+  const auto parent_logical_coords = logical_coordinates(parent_mesh);
+  const auto expected_var_0 = make_vars(parent_logical_coords, 1.0);
+  const auto expected_var_1 = make_vars(parent_logical_coords, 2.0);
+
+  // The lower child has fewer points than the parent to test that its data is
+  // projected to a finer mesh before the restriction
+  using ChildItems =
+      tuples::TaggedTuple<domain::Tags::Element<Dim>, domain::Tags::Mesh<Dim>,
+                          VariablesTag<0>, VariablesTag<1>>;
+  std::unordered_map<ElementId<Dim>, ChildItems> children_items{};
+  for (const auto side : {Side::Lower, Side::Upper}) {
+    const auto child_element_id = parent_element_id.id_of_child(0, side);
+    const Element<Dim> child_element{child_element_id,
+                                     DirectionMap<Dim, Neighbors<Dim>>{}};
+    const Mesh<Dim> child_mesh{side == Side::Lower ? 3_st : 5_st,
+                               Spectral::Basis::Legendre,
+                               Spectral::Quadrature::GaussLobatto};
+    auto child_logical_coords = logical_coordinates(child_mesh);
+    get<0>(child_logical_coords) =
+        0.5 * (get<0>(child_logical_coords) + (side == Side::Lower ? -1.0
+                                                                     : 1.0));
+    children_items.emplace(
+        child_element_id,
+        ChildItems{child_element, child_mesh,
+                   make_vars(child_logical_coords, 1.0),
+                   make_vars(child_logical_coords, 2.0)});
+  }
+
+  auto box = db::create<
+      db::AddSimpleTags<domain::Tags::Mesh<Dim>, domain::Tags::Element<Dim>,
+                        VariablesTag<0>, VariablesTag<1>>>(
+      parent_mesh, parent_element, VariablesType{}, VariablesType{});
+
+  db::mutate_apply<amr::projectors::ProjectVariables<
+      Dim, tmpl::list<VariablesTag<0>, VariablesTag<1>>>>(make_not_null(&box),
+                                                          children_items);
+
+  CHECK_VARIABLES_APPROX(db::get<VariablesTag<0>>(box), expected_var_0);
+  CHECK_VARIABLES_APPROX(db::get<VariablesTag<1>>(box), expected_var_1);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Amr.Projectors.Variables",
@@ -137,4 +186,7 @@ SPECTRE_TEST_CASE("Unit.Amr.Projectors.Variables",
   test_h_refine<1>();
   test_h_refine<2>();
   test_h_refine<3>();
+  test_h_coarsen<1>();
+  test_h_coarsen<2>();
+  test_h_coarsen<3>();
 }
@@ -0,0 +1,233 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/Actions/RegisterEvents.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/Tags/Metavariables.hpp"
+#include "Parallel/Tracing.hpp"
+#include "ParallelAlgorithms/Events/ObserveActionProfile.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+namespace observers::Actions {
+struct ContributeReductionData;
+}  // namespace observers::Actions
+
+namespace {
+struct MockContributeReductionData {
+  using ReductionData = tmpl::wrap<
+      tmpl::front<Events::ObserveActionProfile::observed_reduction_data_tags>,
+      Parallel::ReductionData>;
+  struct Results {
+    observers::ObservationId observation_id;
+    std::string subfile_name;
+    std::vector<std::string> reduction_names;
+    ReductionData reduction_data;
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::optional<Results> results;
+
+  template <typename ParallelComponent, typename... DbTags,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationId& observation_id,
+                    Parallel::ArrayComponentId /*sender_array_id*/,
+                    const std::string& subfile_name,
+                    const std::vector<std::string>& reduction_names,
+                    ReductionData&& reduction_data) {
+    if (results) {
+      CHECK(results->observation_id == observation_id);
+      CHECK(results->subfile_name == subfile_name);
+      CHECK(results->reduction_names == reduction_names);
+      results->reduction_data.combine(std::move(reduction_data));
+    } else {
+      results.emplace();
+      *results = {observation_id, subfile_name, reduction_names,
+                  std::move(reduction_data)};
+    }
+  }
+};
+
+std::optional<MockContributeReductionData::Results>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    MockContributeReductionData::results{};
+
+struct FirstAction {};
+struct SecondAction {};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization,
+                             tmpl::list<FirstAction>>,
+      Parallel::PhaseActions<Parallel::Phase::Evolve,
+                             tmpl::list<FirstAction, SecondAction>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverComponent {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeReductionData>;
+  using with_these_simple_actions = tmpl::list<MockContributeReductionData>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockGroupChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverComponent<Metavariables>>;
+  using const_global_cache_tags = tmpl::list<>;
+
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes =
+        tmpl::map<tmpl::pair<Event, tmpl::list<Events::ObserveActionProfile>>>;
+  };
+};
+
+template <typename Observer>
+void test_observe(const Observer& observer, const double observation_time) {
+  using element_component = ElementComponent<Metavariables>;
+  using observer_component = MockObserverComponent<Metavariables>;
+
+  auto& results = MockContributeReductionData::results;
+  results.reset();
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_group_component<observer_component>(&runner);
+
+  using tag_list = tmpl::list<Parallel::Tags::MetavariablesImpl<Metavariables>>;
+  std::vector<db::compute_databox_type<tag_list>> element_boxes;
+  for (size_t index = 0; index < 3; ++index) {
+    auto box = db::create<tag_list>(Metavariables{});
+    const auto ids_to_register =
+        observers::get_registration_observation_type_and_key(observer, box);
+    CHECK(ids_to_register->first == observers::TypeOfObservation::Reduction);
+    CHECK(ids_to_register->second == observers::ObservationKey("/Profile.dat"));
+    element_boxes.push_back(std::move(box));
+    ActionTesting::emplace_component<element_component>(&runner, index);
+  }
+
+  for (size_t index = 0; index < element_boxes.size(); ++index) {
+    auto obs_box = make_observation_box<db::AddComputeTags<>>(
+        make_not_null(&element_boxes[index]));
+    observer.run(make_not_null(&obs_box),
+                 ActionTesting::cache<element_component>(runner, index),
+                 static_cast<element_component::array_index>(index),
+                 std::add_pointer_t<element_component>{},
+                 {"TimeName", observation_time});
+  }
+
+  for (size_t i = 0; i < element_boxes.size(); ++i) {
+    REQUIRE(
+        not runner.template is_simple_action_queue_empty<observer_component>(
+            0));
+    runner.template invoke_queued_simple_action<observer_component>(0);
+  }
+  CHECK(runner.template is_simple_action_queue_empty<observer_component>(0));
+
+  REQUIRE(results);
+  auto& reduction_data = results->reduction_data;
+  reduction_data.finalize();
+
+  CHECK(results->observation_id.value() == observation_time);
+  CHECK(results->subfile_name == "/Profile");
+  const std::string& first_name = Parallel::tracing::span_name<FirstAction>();
+  const std::string& second_name = Parallel::tracing::span_name<SecondAction>();
+  CHECK(results->reduction_names ==
+        std::vector<std::string>{"TimeName", first_name + " time",
+                                 second_name + " time", first_name + " calls",
+                                 second_name + " calls",
+                                 first_name + " max time",
+                                 second_name + " max time",
+                                 "Modal transforms"});
+  // The statistics of the process are only counted once
+  CHECK(std::get<0>(reduction_data.data()) == observation_time);
+  CHECK(std::get<1>(reduction_data.data()) == std::vector<double>{3.0, 0.5});
+  CHECK(std::get<2>(reduction_data.data()) == std::vector<double>{4.0, 1.0});
+  CHECK(std::get<3>(reduction_data.data()) == std::vector<double>{2.0, 0.5});
+  CHECK(std::get<4>(reduction_data.data()) ==
+        static_cast<double>(number_of_modal_transforms()));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Events.ObserveActionProfile",
+                  "[Unit][ParallelAlgorithms]") {
+  register_factory_classes_with_charm<Metavariables>();
+
+  CHECK(Events::detail::is_first_action_profile_contribution("/A", 1.0));
+  CHECK_FALSE(Events::detail::is_first_action_profile_contribution("/A", 1.0));
+  CHECK(Events::detail::is_first_action_profile_contribution("/B", 1.0));
+  CHECK(Events::detail::is_first_action_profile_contribution("/A", 2.0));
+  CHECK_FALSE(Events::detail::is_first_action_profile_contribution("/A", 2.0));
+
+  auto& first_statistics = Parallel::tracing::action_statistics<FirstAction>();
+  first_statistics.calls.store(4);
+  first_statistics.total_nanoseconds.store(3'000'000'000);
+  first_statistics.max_nanoseconds.store(2'000'000'000);
+  auto& second_statistics =
+      Parallel::tracing::action_statistics<SecondAction>();
+  second_statistics.calls.store(1);
+  second_statistics.total_nanoseconds.store(500'000'000);
+  second_statistics.max_nanoseconds.store(500'000'000);
+
+  {
+    const Events::ObserveActionProfile observer("Profile");
+    CHECK(not observer.needs_evolved_variables());
+    test_observe(observer, 1.0);
+    test_observe(serialize_and_deserialize(observer), 2.0);
+  }
+  {
+    const auto event =
+        TestHelpers::test_creation<std::unique_ptr<Event>, Metavariables>(
+            "ObserveActionProfile:\n"
+            "  SubfileName: Profile");
+    test_observe(*event, 3.0);
+    test_observe(*serialize_and_deserialize(event), 4.0);
+  }
+}
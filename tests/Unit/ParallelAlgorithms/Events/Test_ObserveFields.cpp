@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -21,6 +22,12 @@
 #include "DataStructures/FloatingPointType.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "Framework/ActionTesting.hpp"
@@ -28,6 +35,7 @@
 #include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/ParallelAlgorithms/Events/ObserveFields.hpp"
+#include "IO/H5/LossyCompression.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/Observer/Actions/RegisterEvents.hpp"
 #include "IO/Observer/ObservationId.hpp"
@@ -46,6 +54,7 @@
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeVector.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
@@ -96,7 +105,8 @@ void test_observe(
     const std::unique_ptr<ObserveEvent> observe,
     const std::optional<Mesh<System::volume_dim>>& interpolating_mesh,
     const bool has_analytic_solutions,
-    const std::optional<std::string>& section = std::nullopt) {
+    const std::optional<std::string>& section = std::nullopt,
+    const std::optional<std::pair<size_t, double>>& slice = std::nullopt) {
   using metavariables = Metavariables<System, false>;
   constexpr size_t volume_dim = System::volume_dim;
   using DataType = typename System::data_type;
@@ -110,7 +120,25 @@ void test_observe(
   const Mesh<volume_dim> mesh(5, Spectral::Basis::Legendre,
                               Spectral::Quadrature::GaussLobatto);
 
-  const intrp::RegularGrid interpolant(mesh, interpolating_mesh.value_or(mesh));
+  // The element covers the whole block, so its logical coordinates are the
+  // block-logical coordinates
+  const Mesh<volume_dim> target_mesh = interpolating_mesh.value_or(mesh);
+  std::array<DataVector, volume_dim> target_logical_coords{};
+  std::vector<size_t> expected_extents(target_mesh.extents().begin(),
+                                       target_mesh.extents().end());
+  std::vector<Spectral::Basis> expected_basis(target_mesh.basis().begin(),
+                                              target_mesh.basis().end());
+  std::vector<Spectral::Quadrature> expected_quadrature(
+      target_mesh.quadrature().begin(), target_mesh.quadrature().end());
+  if (slice.has_value()) {
+    gsl::at(target_logical_coords, slice->first) = DataVector(1, slice->second);
+    const auto sliced_dim = static_cast<std::ptrdiff_t>(slice->first);
+    expected_extents.erase(expected_extents.begin() + sliced_dim);
+    expected_basis.erase(expected_basis.begin() + sliced_dim);
+    expected_quadrature.erase(expected_quadrature.begin() + sliced_dim);
+  }
+  const intrp::RegularGrid interpolant(mesh, target_mesh,
+                                       target_logical_coords);
   const double observation_time = 2.0;
   Variables<typename System::variables_tag::tags_list> vars(
       mesh.number_of_grid_points());
@@ -160,12 +188,13 @@ void test_observe(
 
   auto box = db::create<db::AddSimpleTags<
       Parallel::Tags::MetavariablesImpl<metavariables>,
-      domain::Tags::Mesh<volume_dim>,
+      domain::Tags::Mesh<volume_dim>, domain::Tags::Element<volume_dim>,
       ::Tags::Variables<typename decltype(vars)::tags_list>,
       ::Tags::Variables<typename decltype(prim_vars)::tags_list>,
       coordinates_tag, ::Tags::AnalyticSolutions<solution_variables>,
       observers::Tags::ObservationKey<ArraySectionIdTag>>>(
-      metavariables{}, mesh, vars, prim_vars,
+      metavariables{}, mesh, Element<volume_dim>{element_id, {}}, vars,
+      prim_vars,
       get<coordinates_tag>(coordinate_vars),
       [&solutions, &has_analytic_solutions]() {
         return has_analytic_solutions ? std::make_optional(solutions)
@@ -214,16 +243,9 @@ void test_observe(
   CHECK(results.subfile_name == expected_subfile_name);
   CHECK(results.array_component_id ==
         Parallel::make_array_component_id<element_component>(array_index));
-  CHECK(results.received_volume_data.extents.size() == volume_dim);
-  CHECK(std::equal(results.received_volume_data.extents.begin(),
-                   results.received_volume_data.extents.end(),
-                   interpolating_mesh.value_or(mesh).extents().begin()));
-  CHECK(std::equal(results.received_volume_data.basis.begin(),
-                   results.received_volume_data.basis.end(),
-                   interpolating_mesh.value_or(mesh).basis().begin()));
-  CHECK(std::equal(results.received_volume_data.quadrature.begin(),
-                   results.received_volume_data.quadrature.end(),
-                   interpolating_mesh.value_or(mesh).quadrature().begin()));
+  CHECK(results.received_volume_data.extents == expected_extents);
+  CHECK(results.received_volume_data.basis == expected_basis);
+  CHECK(results.received_volume_data.quadrature == expected_quadrature);
 
   size_t num_components_observed = 0;
   // gcc 6.4.0 gets confused if we try to capture tensor_data by
@@ -252,6 +274,13 @@ void test_observe(
     } else {
       CHECK(std::get<DataVector>(it->data) == interpolated_expected);
     }
+    if (component.substr(0, 6) == "Vector") {
+      CHECK(it->compression ==
+            std::optional{ComplicatedSystem<
+                dg::Events::ObserveFields>::lossy_compression_for_test()});
+    } else {
+      CHECK_FALSE(it->compression.has_value());
+    }
     ++num_components_observed;
   };
   const auto check_component = [&check_component_impl](
@@ -340,9 +369,134 @@ void test_system(
         section);
   }
 }
+
+void test_blocks_to_observe() {
+  using System = ScalarSystem<dg::Events::ObserveFields>;
+  using metavariables = Metavariables<System, false>;
+  const auto make_block_map = [](const double lower, const double upper) {
+    return domain::make_coordinate_map_base<Frame::BlockLogical,
+                                            Frame::Inertial>(
+        domain::CoordinateMaps::Affine{-1.0, 1.0, lower, upper});
+  };
+  const Domain<1> domain{
+      make_vector(make_block_map(0.0, 1.0), make_block_map(1.0, 2.0),
+                  make_block_map(2.0, 3.0)),
+      {},
+      {"Inner", "Middle", "Outer"},
+      {{"Shell", {"Middle", "Outer"}}}};
+  const typename System::ObserveEvent observe{
+      "element_data",
+      FloatingPointType::Double,
+      {FloatingPointType::Double},
+      {"Scalar"},
+      std::nullopt,
+      std::nullopt,
+      std::vector<std::string>{"Inner", "Outer"}};
+  const auto serialized_observe = serialize_and_deserialize(observe);
+  const typename System::ObserveEvent observe_group{
+      "element_data",
+      FloatingPointType::Double,
+      {FloatingPointType::Double},
+      {"Scalar"},
+      std::nullopt,
+      std::nullopt,
+      std::vector<std::string>{"Shell"}};
+  for (size_t block_id = 0; block_id < 3; ++block_id) {
+    CAPTURE(block_id);
+    const auto box = db::create<db::AddSimpleTags<
+        Parallel::Tags::MetavariablesImpl<metavariables>,
+        domain::Tags::Domain<1>, domain::Tags::Element<1>>>(
+        metavariables{}, serialize_and_deserialize(domain),
+        Element<1>{ElementId<1>{block_id}, {}});
+    CHECK(observers::get_registration_observation_type_and_key(
+              serialized_observe, box)
+              .has_value() == (block_id != 1));
+    CHECK(observers::get_registration_observation_type_and_key(observe_group,
+                                                               box)
+              .has_value() == (block_id != 0));
+  }
+}
+
+void test_slice() {
+  using System = ComplicatedSystem<dg::Events::ObserveFields>;
+  using metavariables = Metavariables<System, false>;
+  const auto make_observe = [](const size_t dim, const double coordinate) {
+    return std::make_unique<typename System::ObserveEvent>(
+        "element_data", FloatingPointType::Double,
+        std::vector<FloatingPointType>{
+            FloatingPointType::Double, FloatingPointType::Double,
+            FloatingPointType::Double, FloatingPointType::Double,
+            FloatingPointType::Float, FloatingPointType::Float,
+            FloatingPointType::Double, FloatingPointType::Float},
+        std::vector<std::string>{"Scalar", "ScalarVarTimesTwo",
+                                 "ScalarVarTimesThree", "Vector", "Tensor",
+                                 "Tensor2", "Error(Vector)", "Error(Tensor2)"},
+        std::nullopt,
+        std::unordered_map<std::string, h5::LossyCompression>{
+            {"Vector", System::lossy_compression_for_test()}},
+        std::nullopt, std::pair<size_t, double>{dim, coordinate});
+  };
+  {
+    INFO("Observe slices");
+    const Mesh<2> interpolating_mesh{8, Spectral::Basis::Legendre,
+                                     Spectral::Quadrature::GaussLobatto};
+    test_observe<System>(make_observe(0, 0.3), std::nullopt, true,
+                         std::nullopt, std::pair<size_t, double>{0, 0.3});
+    test_observe<System>(make_observe(1, -1.), std::nullopt, true,
+                         std::nullopt, std::pair<size_t, double>{1, -1.});
+    test_observe<System>(std::make_unique<typename System::ObserveEvent>(
+                             serialize_and_deserialize(*make_observe(1, 1.))),
+                         interpolating_mesh, true, std::nullopt,
+                         std::pair<size_t, double>{1, 1.});
+  }
+  {
+    INFO("Elements that intersect the slice");
+    const auto observe = make_observe(1, 0.5);
+    // Elements own the lower boundary of their segment, and the upper one only
+    // at the upper boundary of the block
+    const auto observe_upper = make_observe(1, 1.);
+    for (size_t index = 0; index < 4; ++index) {
+      CAPTURE(index);
+      const ElementId<2> element_id{0, {{{1, 0}, {2, index}}}};
+      const auto box = db::create<db::AddSimpleTags<
+          Parallel::Tags::MetavariablesImpl<metavariables>,
+          domain::Tags::Element<2>>>(metavariables{},
+                                     Element<2>{element_id, {}});
+      CHECK(observers::get_registration_observation_type_and_key(*observe, box)
+                .has_value() == (index == 3));
+      CHECK(observers::get_registration_observation_type_and_key(
+                *observe_upper, box)
+                .has_value() == (index == 3));
+    }
+    for (size_t index = 0; index < 4; ++index) {
+      CAPTURE(index);
+      const ElementId<2> element_id{0, {{{2, index}, {1, 1}}}};
+      const auto box = db::create<db::AddSimpleTags<
+          Parallel::Tags::MetavariablesImpl<metavariables>,
+          domain::Tags::Element<2>>>(metavariables{},
+                                     Element<2>{element_id, {}});
+      CHECK(observers::get_registration_observation_type_and_key(*observe, box)
+                .has_value());
+    }
+  }
+  CHECK_THROWS_WITH(
+      TestHelpers::test_creation<typename System::ObserveEvent>(
+          "SubfileName: VolumeData\n"
+          "CoordinatesFloatingPointType: Double\n"
+          "VariablesToObserve: [Scalar]\n"
+          "FloatingPointTypes: [Double]\n"
+          "InterpolateToMesh: None\n"
+          "LossyCompression: None\n"
+          "BlocksToObserve: All\n"
+          "SliceAt: [2, 0.]\n"),
+      Catch::Matchers::ContainsSubstring(
+          "The slice must be in a dimension smaller than 2"));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields", "[Unit][Evolution]") {
+  test_blocks_to_observe();
+  test_slice();
   {
     INFO("No Interpolation");
     const std::string interpolating_mesh_str = "  InterpolateToMesh: None";
@@ -475,7 +629,10 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields", "[Unit][Evolution]") {
           "CoordinatesFloatingPointType: Double\n"
           "VariablesToObserve: [NotAVar]\n"
           "FloatingPointTypes: [Double]\n"
-          "InterpolateToMesh: None\n"),
+          "InterpolateToMesh: None\n"
+          "LossyCompression: None\n"
+          "BlocksToObserve: All\n"
+          "SliceAt: None\n"),
       Catch::Matchers::ContainsSubstring("Invalid selection: NotAVar"));
 
   CHECK_THROWS_WITH(
@@ -485,6 +642,45 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields", "[Unit][Evolution]") {
           "CoordinatesFloatingPointType: Double\n"
           "VariablesToObserve: [Scalar, Scalar]\n"
           "FloatingPointTypes: [Double]\n"
-          "InterpolateToMesh: None\n"),
+          "InterpolateToMesh: None\n"
+          "LossyCompression: None\n"
+          "BlocksToObserve: All\n"
+          "SliceAt: None\n"),
       Catch::Matchers::ContainsSubstring("Scalar specified multiple times"));
+
+  CHECK_THROWS_WITH(
+      TestHelpers::test_creation<
+          typename ScalarSystem<dg::Events::ObserveFields>::ObserveEvent>(
+          "SubfileName: VolumeData\n"
+          "CoordinatesFloatingPointType: Double\n"
+          "VariablesToObserve: [Scalar]\n"
+          "FloatingPointTypes: [Double]\n"
+          "InterpolateToMesh: None\n"
+          "LossyCompression:\n"
+          "  InertialCoordinates:\n"
+          "    Method: Zfp\n"
+          "    AbsoluteError: 1.0e-6\n"
+          "    RelativeError: None\n"
+          "BlocksToObserve: All\n"
+          "SliceAt: None\n"),
+      Catch::Matchers::ContainsSubstring(
+          "coordinates must be written losslessly"));
+
+  CHECK_THROWS_WITH(
+      TestHelpers::test_creation<
+          typename ScalarSystem<dg::Events::ObserveFields>::ObserveEvent>(
+          "SubfileName: VolumeData\n"
+          "CoordinatesFloatingPointType: Double\n"
+          "VariablesToObserve: [Scalar]\n"
+          "FloatingPointTypes: [Double]\n"
+          "InterpolateToMesh: None\n"
+          "LossyCompression:\n"
+          "  ScalarVarTimesTwo:\n"
+          "    Method: Zfp\n"
+          "    AbsoluteError: 1.0e-6\n"
+          "    RelativeError: None\n"
+          "BlocksToObserve: All\n"
+          "SliceAt: None\n"),
+      Catch::Matchers::ContainsSubstring("is not listed in "
+                                         "'VariablesToObserve'"));
 }
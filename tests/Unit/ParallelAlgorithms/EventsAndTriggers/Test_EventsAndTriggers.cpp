@@ -6,6 +6,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -98,6 +99,43 @@ struct TestEvent : public Event {
 
 PUP::able::PUP_ID TestEvent::my_PUP_ID = 0;  // NOLINT
 
+// Counts how often it is checked
+template <bool ElementIndependent>
+class CountingTrigger : public Trigger {
+ public:
+  explicit CountingTrigger(CkMigrateMessage* /*unused*/) {}
+  using PUP::able::register_constructor;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+  WRAPPED_PUPable_decl_template(CountingTrigger);  // NOLINT
+#pragma GCC diagnostic pop
+
+  static std::string name() {
+    return ElementIndependent ? "ElementIndependentCounter" : "Counter";
+  }
+  using options = tmpl::list<>;
+  static constexpr Options::String help = "";
+
+  CountingTrigger() = default;
+
+  using argument_tags = tmpl::list<>;
+
+  bool operator()() const {
+    ++number_of_checks;
+    return true;
+  }
+
+  bool is_element_independent() const override { return ElementIndependent; }
+
+  static size_t number_of_checks;
+};
+
+template <bool ElementIndependent>
+size_t CountingTrigger<ElementIndependent>::number_of_checks = 0;
+
+template <bool ElementIndependent>
+PUP::able::PUP_ID CountingTrigger<ElementIndependent>::my_PUP_ID = 0;  // NOLINT
+
 struct Component {};
 
 struct Metavariables {
@@ -106,7 +144,10 @@ struct Metavariables {
       : tt::ConformsTo<Options::protocols::FactoryCreation> {
     using factory_classes =
         tmpl::map<tmpl::pair<Event, tmpl::list<TestEvent>>,
-                  tmpl::pair<Trigger, Triggers::logical_triggers>>;
+                  tmpl::pair<Trigger,
+                             tmpl::push_back<Triggers::logical_triggers,
+                                             CountingTrigger<false>,
+                                             CountingTrigger<true>>>>;
   };
 };
 
@@ -292,6 +333,63 @@ void test_custom_check_trigger() {
                        [](const Trigger& /*trigger*/) { return true; });
   CHECK(db::get<Tags::RunCount>(box) == 1);
 }
+
+void test_element_independent_triggers() {
+  auto box = db::create<
+      db::AddSimpleTags<Parallel::Tags::MetavariablesImpl<Metavariables>,
+                        Tags::Data, Tags::RunCount>>(Metavariables{}, 2, 0);
+  Parallel::GlobalCache<Metavariables> cache{};
+  Component* const component_ptr = nullptr;
+
+  const auto events_and_triggers =
+      TestHelpers::test_creation<EventsAndTriggers, Metavariables>(
+          "- Trigger: Counter\n"
+          "  Events:\n"
+          "    - TestEvent\n"
+          "- Trigger: ElementIndependentCounter\n"
+          "  Events:\n"
+          "    - TestEvent\n"
+          "- Trigger:\n"
+          "    Not: ElementIndependentCounter\n"
+          "  Events:\n"
+          "    - TestEvent\n"
+          "- Trigger:\n"
+          "    And:\n"
+          "      - ElementIndependentCounter\n"
+          "      - Counter\n"
+          "  Events:\n"
+          "    - TestEvent\n");
+  CHECK_FALSE(CountingTrigger<false>{}.is_element_independent());
+  CHECK(Triggers::Not(std::make_unique<CountingTrigger<true>>())
+            .is_element_independent());
+  CHECK_FALSE(Triggers::Not(std::make_unique<CountingTrigger<false>>())
+                  .is_element_independent());
+
+  const auto run = [&]() {
+    events_and_triggers.run_events(make_not_null(&box), cache, 0,
+                                   component_ptr, {"Name", 1234.5});
+  };
+  CountingTrigger<false>::number_of_checks = 0;
+  CountingTrigger<true>::number_of_checks = 0;
+  // Only the first "element" at an observation value checks the
+  // element-independent triggers. The `And` trigger depends on an
+  // element-dependent trigger, so it is checked every time.
+  run();
+  CHECK(CountingTrigger<false>::number_of_checks == 2);
+  CHECK(CountingTrigger<true>::number_of_checks == 3);
+  CHECK(db::get<Tags::RunCount>(box) == 3);
+  run();
+  CHECK(CountingTrigger<false>::number_of_checks == 4);
+  CHECK(CountingTrigger<true>::number_of_checks == 4);
+  CHECK(db::get<Tags::RunCount>(box) == 6);
+  // Overriding the trigger check bypasses the cached decisions
+  events_and_triggers.run_events(
+      make_not_null(&box), cache, 0, component_ptr, {"Name", 1234.5},
+      [&box](const Trigger& trigger) { return trigger.is_triggered(box); });
+  CHECK(CountingTrigger<false>::number_of_checks == 6);
+  CHECK(CountingTrigger<true>::number_of_checks == 7);
+  CHECK(db::get<Tags::RunCount>(box) == 9);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.EventsAndTriggers",
@@ -301,4 +399,5 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.EventsAndTriggers",
   test_basic_triggers();
   test_factory();
   test_custom_check_trigger();
+  test_element_independent_triggers();
 }
@@ -100,6 +100,27 @@ struct MockMetavariables {
                                     mock_element_array<MockMetavariables>>;
 };
 
+struct MockMetavariablesWithBoundedTarget {
+  struct InterpolationTagA {
+    using temporal_id = ::Tags::Time;
+    using vars_to_interpolate_to_target =
+        tmpl::list<gr::Tags::Lapse<DataVector>>;
+  };
+  struct InterpolationTagB {
+    using temporal_id = ::Tags::Time;
+    using vars_to_interpolate_to_target =
+        tmpl::list<gr::Tags::Lapse<DataVector>>;
+    static constexpr size_t max_outstanding_temporal_ids = 1;
+  };
+  static constexpr size_t volume_dim = 3;
+  using interpolator_source_vars = tmpl::list<gr::Tags::Lapse<DataVector>>;
+  using interpolation_target_tags =
+      tmpl::list<InterpolationTagA, InterpolationTagB>;
+
+  using component_list =
+      tmpl::list<mock_interpolator<MockMetavariablesWithBoundedTarget>>;
+};
+
 template <typename interp_component, typename InterpolationTargetTag,
           typename Metavariables, typename TemporalId>
 bool temporal_ids_when_data_has_been_interpolated_contains(
@@ -362,4 +383,57 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.CleanUp", "[Unit]") {
       finished_temporal_ids_max_size);
 }
 
+SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.CleanUpBounded",
+                  "[Unit]") {
+  using metavars = MockMetavariablesWithBoundedTarget;
+  using interp_component = mock_interpolator<metavars>;
+  using volume_vars_info_tag =
+      intrp::Tags::VolumeVarsInfo<metavars, ::Tags::Time>;
+
+  ActionTesting::MockRuntimeSystem<metavars> runner{{}};
+  ActionTesting::emplace_component_and_initialize<interp_component>(
+      &runner, 0,
+      {0_st,
+       typename intrp::Tags::VolumeVarsInfo<metavars,
+                                            ::Tags::TimeStepId>::type{},
+       typename volume_vars_info_tag::type{{1.0, {}}, {2.0, {}}, {3.0, {}}},
+       typename intrp::Tags::InterpolatedVarsHolders<metavars>::type{}});
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
+  const auto& volume_vars_info =
+      ActionTesting::get_databox_tag<interp_component, volume_vars_info_tag>(
+          runner, 0);
+
+  // Target B has not finished any of the three temporal_ids, so the two
+  // oldest are abandoned for it. Target A has only finished the first.
+  runner.simple_action<
+      interp_component,
+      intrp::Actions::CleanUpInterpolator<metavars::InterpolationTagA>>(0, 1.0);
+  CHECK(volume_vars_info.size() == 2);
+  CHECK(volume_vars_info.count(2.0) == 1);
+  CHECK(volume_vars_info.count(3.0) == 1);
+  CHECK(temporal_ids_when_data_has_been_interpolated_contains<
+        interp_component, metavars::InterpolationTagB>(runner, 1.0));
+  CHECK(temporal_ids_when_data_has_been_interpolated_contains<
+        interp_component, metavars::InterpolationTagB>(runner, 2.0));
+  CHECK_FALSE(temporal_ids_when_data_has_been_interpolated_contains<
+              interp_component, metavars::InterpolationTagB>(runner, 3.0));
+
+  // Target B is within its bound now
+  runner.simple_action<
+      interp_component,
+      intrp::Actions::CleanUpInterpolator<metavars::InterpolationTagA>>(0, 2.0);
+  CHECK(volume_vars_info.size() == 1);
+  CHECK(volume_vars_info.count(3.0) == 1);
+  CHECK_FALSE(temporal_ids_when_data_has_been_interpolated_contains<
+              interp_component, metavars::InterpolationTagB>(runner, 3.0));
+
+  runner.simple_action<
+      interp_component,
+      intrp::Actions::CleanUpInterpolator<metavars::InterpolationTagB>>(0, 3.0);
+  CHECK(volume_vars_info.size() == 1);
+  runner.simple_action<
+      interp_component,
+      intrp::Actions::CleanUpInterpolator<metavars::InterpolationTagA>>(0, 3.0);
+  CHECK(volume_vars_info.empty());
+}
 }  // namespace
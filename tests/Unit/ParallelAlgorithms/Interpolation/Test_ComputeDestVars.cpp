@@ -96,6 +96,20 @@ struct MockInterpolationTargetTag {
   using compute_vars_to_interpolate = MockComputeVarsToInterpolate<Frame>;
 };
 
+template <typename Frame>
+struct MockPointwiseComputeVarsToInterpolate
+    : MockComputeVarsToInterpolate<Frame> {
+  static constexpr bool is_pointwise = true;
+};
+
+template <typename Frame>
+struct MockPointwiseInterpolationTargetTag {
+  using temporal_id = ::Tags::Time;
+  using vars_to_interpolate_to_target = tmpl::list<FakeVars<Frame>>;
+  using compute_vars_to_interpolate =
+      MockPointwiseComputeVarsToInterpolate<Frame>;
+};
+
 struct Metavars {
   static constexpr size_t volume_dim = 3;
   using const_global_cache_tags =
@@ -136,6 +150,20 @@ void test() {
   intrp::InterpolationTarget_detail::compute_dest_vars_from_source_vars<tag>(
       make_not_null(&dest_vars), source_vars, domain, mesh, element_id, cache,
       time);
+
+  using source_tags = tmpl::list<FakeVars<::Frame::Inertial>>;
+  CHECK_FALSE(intrp::InterpolationTarget_detail::
+                  compute_dest_vars_at_target_points<tag, source_tags>(
+                      domain, element_id));
+  // The maps are time-dependent, so transforming to the target frame needs
+  // the volume data
+  CHECK_FALSE(intrp::InterpolationTarget_detail::
+                  compute_dest_vars_at_target_points<
+                      MockPointwiseInterpolationTargetTag<Frame>, source_tags>(
+                      domain, element_id));
+  CHECK(intrp::InterpolationTarget_detail::compute_dest_vars_at_target_points<
+        MockPointwiseInterpolationTargetTag<::Frame::Inertial>, source_tags>(
+      domain, element_id));
 }
 
 SPECTRE_TEST_CASE(
@@ -318,6 +318,7 @@ struct MockComputeTargetPoints : public OriginalComputeTargetPoints {
   using is_sequential = std::true_type;
 };
 
+template <bool StoreSourceVarsAsFloat>
 struct MockMetavariables {
   struct InterpolationTargetA
       : tt::ConformsTo<intrp::protocols::InterpolationTargetTag> {
@@ -348,6 +349,8 @@ struct MockMetavariables {
       tmpl::list<InterpolationTargetA, InterpolationTargetB>;
   using observed_reduction_data_tags = tmpl::list<>;
   static constexpr size_t volume_dim = 3;
+  static constexpr bool interpolator_stores_source_vars_as_float =
+      StoreSourceVarsAsFloat;
   using component_list = tmpl::list<
       mock_interpolation_target<MockMetavariables, InterpolationTargetA>,
       mock_interpolation_target<MockMetavariables, InterpolationTargetB>,
@@ -391,16 +394,19 @@ void create_volume_data_and_send_it_to_interpolator(
   }
 }
 
+template <bool StoreSourceVarsAsFloat>
 void test(const bool dump_vol_data) {
+  CAPTURE(StoreSourceVarsAsFloat);
   domain::creators::register_derived_with_charm();
 
-  using metavars = MockMetavariables;
-  using temporal_id_type =
-      typename metavars::InterpolationTargetA::temporal_id::type;
-  using target_component =
-      mock_interpolation_target<metavars, metavars::InterpolationTargetA>;
-  using unused_target_component =
-      mock_interpolation_target<metavars, metavars::InterpolationTargetB>;
+  using metavars = MockMetavariables<StoreSourceVarsAsFloat>;
+  static_assert(intrp::stores_source_vars_as_float<metavars>() ==
+                StoreSourceVarsAsFloat);
+  using target_a = typename metavars::InterpolationTargetA;
+  using target_b = typename metavars::InterpolationTargetB;
+  using temporal_id_type = typename target_a::temporal_id::type;
+  using target_component = mock_interpolation_target<metavars, target_a>;
+  using unused_target_component = mock_interpolation_target<metavars, target_b>;
   using interp_component = mock_interpolator<metavars>;
   using observer_writer = mock_observer_writer<metavars>;
 
@@ -423,13 +429,10 @@ void test(const bool dump_vol_data) {
         vars_holders_l{};
     // Only need to setup A because B isn't using the interpolator
     auto& vars_infos =
-        get<intrp::Vars::HolderTag<metavars::InterpolationTargetA, metavars>>(
-            vars_holders_l)
-            .infos;
+        get<intrp::Vars::HolderTag<target_a, metavars>>(vars_holders_l).infos;
     vars_infos.emplace(std::make_pair(
         temporal_id,
-        intrp::Vars::Info<3, typename metavars::InterpolationTargetA::
-                                 vars_to_interpolate_to_target>{
+        intrp::Vars::Info<3, typename target_a::vars_to_interpolate_to_target>{
             std::move(coords)}));
     return vars_holders_l;
   }();
@@ -475,7 +478,8 @@ void test(const bool dump_vol_data) {
   // Tell the interpolator how many elements there are by registering
   // each one.
   for (size_t i = 0; i < element_ids.size(); ++i) {
-    runner.simple_action<interp_component, intrp::Actions::RegisterElement>(0);
+    runner.template simple_action<interp_component,
+                                  intrp::Actions::RegisterElement>(0);
   }
 
   // Register interpolator with observer writer
@@ -494,11 +498,9 @@ void test(const bool dump_vol_data) {
 
   // Should be done with this temporal id for TargetA. TargetB doesn't use the
   // interpolator so it should also have this be empty
-  CHECK(get<intrp::Vars::HolderTag<metavars::InterpolationTargetA, metavars>>(
-            holders)
+  CHECK(get<intrp::Vars::HolderTag<target_a, metavars>>(holders)
             .temporal_ids_when_data_has_been_interpolated.empty());
-  CHECK(get<intrp::Vars::HolderTag<metavars::InterpolationTargetB, metavars>>(
-            holders)
+  CHECK(get<intrp::Vars::HolderTag<target_b, metavars>>(holders)
             .temporal_ids_when_data_has_been_interpolated.empty());
 
   // Should be no temporal_id in the target box, since we never
@@ -509,7 +511,7 @@ void test(const bool dump_vol_data) {
                 .has_value());
 
   // Should be one queued simple action, MockInterpolationTargetReceiveVars.
-  runner.invoke_queued_simple_action<target_component>(0);
+  runner.template invoke_queued_simple_action<target_component>(0);
 
   // Make sure that MockInterpolationTargetReceiveVars was called,
   // by looking for a funny temporal_id that it inserts for the specific
@@ -521,7 +523,7 @@ void test(const bool dump_vol_data) {
         TimeStepId(true, 0, Time(Slab(0.0, 1.0), Rational(111, 135))));
 
   // No more queued simple actions.
-  CHECK(runner.is_simple_action_queue_empty<target_component>(0));
+  CHECK(runner.template is_simple_action_queue_empty<target_component>(0));
 
   // VolumeVarsInfo should be full now, since we didn't actually
   // do interpolation for this test.
@@ -532,6 +534,18 @@ void test(const bool dump_vol_data) {
       runner, 0);
   CHECK(volume_vars_info.size() == 1);
   CHECK(volume_vars_info.at(temporal_id).size() == element_ids.size());
+  for (const auto& [element_id, info] : volume_vars_info.at(temporal_id)) {
+    CAPTURE(element_id);
+    CHECK(info.source_vars_from_element.size() ==
+          (StoreSourceVarsAsFloat ? 0 : info.mesh.number_of_grid_points()));
+    CHECK(info.source_vars_as_float.size() ==
+          (StoreSourceVarsAsFloat ? info.mesh.number_of_grid_points() : 0));
+    Variables<typename metavars::interpolator_source_vars> buffer{};
+    const auto& source_vars = info.source_vars(make_not_null(&buffer));
+    CHECK(source_vars.number_of_grid_points() ==
+          info.mesh.number_of_grid_points());
+    CHECK((&source_vars == &buffer) == StoreSourceVarsAsFloat);
+  }
 
   // Now that VolumeVarsInfo is full, test dumping the data
   // Go to the post failure cleanup phase just for now so we can run the action
@@ -600,14 +614,11 @@ void test(const bool dump_vol_data) {
   // 4) Check that volume_vars_info is still empty, and that no simple_actions
   //    are queued.
   //
-  runner
-      .simple_action<interp_component,
-                     ClearVolumeVarsInfo<
-                         typename metavars::InterpolationTargetA::temporal_id>>(
-          0);
-  runner.simple_action<interp_component,
-                       AddToTemporalIdsWhenDataHasBeenInterpolated<
-                           metavars::InterpolationTargetA>>(0, temporal_id);
+  runner.template simple_action<
+      interp_component, ClearVolumeVarsInfo<typename target_a::temporal_id>>(0);
+  runner.template simple_action<
+      interp_component, AddToTemporalIdsWhenDataHasBeenInterpolated<target_a>>(
+      0, temporal_id);
 
   create_volume_data_and_send_it_to_interpolator<interp_component>(
       make_not_null(&runner), domain_creator, domain, element_ids, temporal_id);
@@ -616,7 +627,7 @@ void test(const bool dump_vol_data) {
   CHECK(volume_vars_info.empty());
 
   // No more queued simple actions.
-  CHECK(runner.is_simple_action_queue_empty<target_component>(0));
+  CHECK(runner.template is_simple_action_queue_empty<target_component>(0));
 
   // Remove file
   if (file_system::check_if_file_exists(filename + "0.h5")) {
@@ -627,8 +638,9 @@ void test(const bool dump_vol_data) {
 SPECTRE_TEST_CASE(
     "Unit.NumericalAlgorithms.Interpolator.ReceiveAndDumpVolumeData",
     "[Unit]") {
-  test(true);
-  test(false);
+  test<false>(true);
+  test<false>(false);
+  test<true>(true);
 }
 
 }  // namespace
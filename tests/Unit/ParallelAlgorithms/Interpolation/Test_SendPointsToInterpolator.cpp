@@ -0,0 +1,224 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/IdPair.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/Creators/AlignedLattice.hpp"
+#include "Domain/Creators/RegisterDerivedWithCharm.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/Structure/BlockId.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Helpers/ParallelAlgorithms/Interpolation/InterpolationTargetTestHelpers.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InitializeInterpolationTarget.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/SendPointsToInterpolator.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
+#include "ParallelAlgorithms/Interpolation/Protocols/ComputeTargetPoints.hpp"
+#include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags/TimeStepId.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/Rational.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct TestPoints : db::SimpleTag {
+  using type = tnsr::I<DataVector, 3, Frame::Inertial>;
+};
+
+// Returns the points in the DataBox, so the test can move them
+struct ComputeTargetPointsFromBox
+    : tt::ConformsTo<intrp::protocols::ComputeTargetPoints> {
+  using is_sequential = std::true_type;
+  using frame = ::Frame::Inertial;
+  using simple_tags = tmpl::list<TestPoints,
+                                 intrp::Tags::PreviousBlockLogicalCoords<3>>;
+  template <typename Metavariables, typename DbTags, typename TemporalId>
+  static tnsr::I<DataVector, 3, Frame::Inertial> points(
+      const db::DataBox<DbTags>& box,
+      const tmpl::type_<Metavariables>& /*meta*/,
+      const TemporalId& /*temporal_id*/) {
+    return db::get<TestPoints>(box);
+  }
+};
+
+template <typename Metavariables, typename InterpolationTargetTag>
+struct mock_interpolation_target {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = size_t;
+  using component_being_mocked =
+      intrp::InterpolationTarget<Metavariables, InterpolationTargetTag>;
+  using const_global_cache_tags =
+      tmpl::list<domain::Tags::Domain<Metavariables::volume_dim>>;
+  using simple_tags = typename intrp::Actions::InitializeInterpolationTarget<
+      Metavariables, InterpolationTargetTag>::simple_tags;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          Parallel::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>,
+      Parallel::PhaseActions<Parallel::Phase::Testing, tmpl::list<>>>;
+};
+
+struct Metavariables {
+  struct InterpolationTargetA
+      : tt::ConformsTo<intrp::protocols::InterpolationTargetTag> {
+    using temporal_id = ::Tags::TimeStepId;
+    using vars_to_interpolate_to_target =
+        tmpl::list<gr::Tags::Lapse<DataVector>>;
+    using compute_items_on_target = tmpl::list<>;
+    using compute_target_points = ComputeTargetPointsFromBox;
+    using post_interpolation_callbacks = tmpl::list<>;
+  };
+  using interpolator_source_vars = tmpl::list<gr::Tags::Lapse<DataVector>>;
+  using interpolation_target_tags = tmpl::list<InterpolationTargetA>;
+  static constexpr size_t volume_dim = 3;
+
+  using component_list = tmpl::list<
+      mock_interpolation_target<Metavariables, InterpolationTargetA>,
+      InterpTargetTestHelpers::mock_interpolator<Metavariables>>;
+};
+
+SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.InterpolationTarget.SendPoints",
+                  "[Unit]") {
+  domain::creators::register_derived_with_charm();
+  using metavars = Metavariables;
+  using target_tag = metavars::InterpolationTargetA;
+  using target_component = mock_interpolation_target<metavars, target_tag>;
+  using interp_component = InterpTargetTestHelpers::mock_interpolator<metavars>;
+  using previous_coords_tag = intrp::Tags::PreviousBlockLogicalCoords<3>;
+
+  // Two blocks that share the face at x = 0
+  const domain::creators::AlignedLattice<3> domain_creator(
+      {{{{-1.0, 0.0, 1.0}}, {{-1.0, 1.0}}, {{-1.0, 1.0}}}}, {{0, 0, 0}},
+      {{3, 3, 3}}, {}, {}, {});
+  const auto domain = domain_creator.create_domain();
+  // The first point is on the shared face, so a search in all blocks finds it
+  // in the block with the smaller ID, but a guess in the other block is kept
+  tnsr::I<DataVector, 3, Frame::Inertial> points{
+      {{{0.0, 0.5}, {0.2, 0.1}, {-0.3, 0.4}}}};
+  const auto searched_coords = block_logical_coordinates(domain, points);
+  REQUIRE(searched_coords[0].has_value());
+  REQUIRE(searched_coords[0]->id == domain::BlockId(0));
+  REQUIRE(searched_coords[1].has_value());
+  REQUIRE(searched_coords[1]->id == domain::BlockId(1));
+
+  ActionTesting::MockRuntimeSystem<metavars> runner{
+      {domain_creator.create_domain()}};
+  using temporal_id_type = TimeStepId;
+  ActionTesting::emplace_component<interp_component>(&runner, 0);
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::next_action<interp_component>(make_not_null(&runner), 0);
+  }
+  ActionTesting::emplace_component_and_initialize<target_component>(
+      &runner, 0,
+      {std::unordered_map<temporal_id_type, std::unordered_set<size_t>>{},
+       std::unordered_map<temporal_id_type, std::unordered_set<size_t>>{},
+       std::deque<temporal_id_type>{}, std::optional<temporal_id_type>{},
+       std::deque<temporal_id_type>{},
+       std::unordered_map<
+           temporal_id_type,
+           Variables<typename target_tag::vars_to_interpolate_to_target>>{},
+       Variables<typename target_tag::vars_to_interpolate_to_target>{1},
+       points, std::vector<BlockLogicalCoords<3>>{}});
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
+
+  const Slab slab(0.0, 1.0);
+  const auto send_points_and_get_coords = [&runner, &slab](
+                                              const size_t step) {
+    const TimeStepId temporal_id(
+        true, 0, Time(slab, Rational(static_cast<int>(step), 4)));
+    ActionTesting::simple_action<
+        target_component, intrp::Actions::SendPointsToInterpolator<target_tag>>(
+        make_not_null(&runner), 0, temporal_id);
+    CHECK(ActionTesting::number_of_queued_simple_actions<interp_component>(
+              runner, 0) == 1);
+    ActionTesting::invoke_queued_simple_action<interp_component>(
+        make_not_null(&runner), 0);
+    const auto& sent_coords =
+        get<intrp::Vars::HolderTag<target_tag, metavars>>(
+            ActionTesting::get_databox_tag<
+                interp_component,
+                intrp::Tags::InterpolatedVarsHolders<metavars>>(runner, 0))
+            .infos.at(temporal_id)
+            .block_coord_holders;
+    // The sent coordinates are kept as the next initial guess
+    const auto& previous_coords =
+        ActionTesting::get_databox_tag<target_component, previous_coords_tag>(
+            runner, 0);
+    REQUIRE(previous_coords.size() == sent_coords.size());
+    for (size_t s = 0; s < sent_coords.size(); ++s) {
+      REQUIRE(previous_coords[s].has_value() == sent_coords[s].has_value());
+      if (sent_coords[s].has_value()) {
+        CHECK(previous_coords[s]->id == sent_coords[s]->id);
+        CHECK_ITERABLE_APPROX(previous_coords[s]->data, sent_coords[s]->data);
+      }
+    }
+    return sent_coords;
+  };
+  const auto set_previous_coords =
+      [&runner](const std::vector<BlockLogicalCoords<3>>& previous_coords) {
+        auto& box = ActionTesting::get_databox<target_component>(
+            make_not_null(&runner), 0);
+        db::mutate<previous_coords_tag>(
+            [&previous_coords](const gsl::not_null<
+                               std::vector<BlockLogicalCoords<3>>*>
+                                   stored_coords) {
+              *stored_coords = previous_coords;
+            },
+            make_not_null(&box));
+      };
+  const auto check_coords = [](const std::vector<BlockLogicalCoords<3>>& coords,
+                               const std::vector<BlockLogicalCoords<3>>&
+                                   expected_coords) {
+    REQUIRE(coords.size() == expected_coords.size());
+    for (size_t s = 0; s < coords.size(); ++s) {
+      CAPTURE(s);
+      REQUIRE(coords[s].has_value());
+      REQUIRE(expected_coords[s].has_value());
+      CHECK(coords[s]->id == expected_coords[s]->id);
+      CHECK_ITERABLE_APPROX(coords[s]->data, expected_coords[s]->data);
+    }
+  };
+
+  // Without previous coordinates the points are searched for in all blocks
+  check_coords(send_points_and_get_coords(0), searched_coords);
+
+  // With a guess for each point the guess is used, so the point on the shared
+  // face stays in the guessed block
+  const tnsr::I<double, 3, Frame::BlockLogical> logical_on_face{
+      {{-1.0, 0.2, -0.3}}};
+  const std::vector<BlockLogicalCoords<3>> guess{
+      make_id_pair(domain::BlockId(1), logical_on_face), searched_coords[1]};
+  set_previous_coords(guess);
+  check_coords(send_points_and_get_coords(1), guess);
+
+  // The coordinates stored by the last send are the guess for the next one
+  check_coords(send_points_and_get_coords(2), guess);
+
+  // A guess for a different number of points is ignored
+  set_previous_coords({guess[0]});
+  check_coords(send_points_and_get_coords(3), searched_coords);
+}
+}  // namespace
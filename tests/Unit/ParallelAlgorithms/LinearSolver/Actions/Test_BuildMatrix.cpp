@@ -70,6 +70,24 @@ struct TestResult {
       }
       SPECTRE_PARALLEL_REQUIRE(row == linear_operator.rows());
     }
+    // Check the rows of the matrix assembled in memory
+    const auto& local_matrix_rows =
+        get<LinearSolver::Tags::LocalMatrixRows<double>>(box);
+    const auto& all_linear_operators =
+        get<helpers_distributed::LinearOperator>(box);
+    SPECTRE_PARALLEL_REQUIRE(local_matrix_rows.rows() == num_points);
+    SPECTRE_PARALLEL_REQUIRE(local_matrix_rows.columns() ==
+                             all_linear_operators.size() * num_points);
+    for (size_t i = 0; i < all_linear_operators.size(); ++i) {
+      for (size_t col = 0; col < num_points; ++col) {
+        for (size_t row = 0; row < num_points; ++row) {
+          SPECTRE_PARALLEL_REQUIRE(
+              local_matrix_rows(row, i * num_points + col) ==
+              gsl::at(all_linear_operators, i)(element_index * num_points + row,
+                                               col));
+        }
+      }
+    }
     return {Parallel::AlgorithmExecution::Pause, std::nullopt};
   }
 };
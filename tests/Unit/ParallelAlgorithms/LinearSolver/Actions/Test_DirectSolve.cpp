@@ -0,0 +1,56 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <map>
+
+#include "DataStructures/CompressedMatrix.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "ParallelAlgorithms/LinearSolver/Actions/DirectSolve.hpp"
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.DirectSolve",
+                  "[Unit][ParallelAlgorithms][LinearSolver]") {
+  // A block-tridiagonal matrix distributed over two elements with two points
+  // each. The solution is [1, 2, 3, 4].
+  const ElementId<1> left_id{0, {{SegmentId{1, 0}}}};
+  const ElementId<1> right_id{0, {{SegmentId{1, 1}}}};
+  blaze::CompressedMatrix<double, blaze::columnMajor> left_rows(2, 4);
+  left_rows(0, 0) = 4.;
+  left_rows(0, 1) = 1.;
+  left_rows(1, 0) = 1.;
+  left_rows(1, 1) = 4.;
+  left_rows(1, 2) = 1.;
+  blaze::CompressedMatrix<double, blaze::columnMajor> right_rows(2, 4);
+  right_rows(0, 1) = 1.;
+  right_rows(0, 2) = 4.;
+  right_rows(0, 3) = 1.;
+  right_rows(1, 2) = 1.;
+  right_rows(1, 3) = 4.;
+  // Insert in reverse order to test that the elements are ordered by their ID
+  std::map<ElementId<1>, blaze::CompressedMatrix<double, blaze::columnMajor>>
+      matrix_rows{};
+  matrix_rows.emplace(right_id, right_rows);
+  matrix_rows.emplace(left_id, left_rows);
+  const std::map<ElementId<1>, DataVector> source_rows{
+      {left_id, DataVector{6., 12.}}, {right_id, DataVector{18., 19.}}};
+
+  const auto solution =
+      LinearSolver::Actions::detail::solve_assembled_matrix(matrix_rows,
+                                                            source_rows);
+  REQUIRE(solution.size() == 2);
+  CHECK_ITERABLE_APPROX(solution.at(left_id), (DataVector{1., 2.}));
+  CHECK_ITERABLE_APPROX(solution.at(right_id), (DataVector{3., 4.}));
+
+  CHECK_THROWS_WITH(
+      LinearSolver::Actions::detail::solve_assembled_matrix(
+          std::map<ElementId<1>,
+                   blaze::CompressedMatrix<double, blaze::columnMajor>>{
+              {left_id,
+               blaze::CompressedMatrix<double, blaze::columnMajor>(2, 2)}},
+          std::map<ElementId<1>, DataVector>{{left_id, DataVector{1., 1.}}}),
+      Catch::Matchers::ContainsSubstring("it is singular"));
+}
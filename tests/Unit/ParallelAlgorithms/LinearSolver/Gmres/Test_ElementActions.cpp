@@ -50,6 +50,10 @@ using orthogonalization_iteration_id_tag =
 using basis_history_tag = LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
 using preconditioned_basis_history_tag =
     LinearSolver::Tags::KrylovSubspaceBasis<preconditioned_operand_tag>;
+using basis_storage_tag =
+    LinearSolver::Tags::KrylovSubspaceBasisStorage<operand_tag>;
+using preconditioned_basis_storage_tag =
+    LinearSolver::Tags::KrylovSubspaceBasisStorage<preconditioned_operand_tag>;
 
 template <typename Metavariables, bool Preconditioned>
 struct ElementArray {
@@ -131,7 +135,8 @@ void test_element_actions() {
         std::conditional_t<Preconditioned,
                            operator_applied_to_preconditioned_operand_tag,
                            operator_applied_to_operand_tag>,
-        orthogonalization_iteration_id_tag, basis_history_tag>>(
+        orthogonalization_iteration_id_tag, basis_history_tag,
+        basis_storage_tag>>(
         [&tag_is_retrievable](auto tag_v) {
           using tag = tmpl::type_from<decltype(tag_v)>;
           CAPTURE(db::tag_name<tag>());
@@ -140,6 +145,8 @@ void test_element_actions() {
     CHECK(tag_is_retrievable(preconditioned_operand_tag{}) == Preconditioned);
     CHECK(tag_is_retrievable(preconditioned_basis_history_tag{}) ==
           Preconditioned);
+    CHECK(tag_is_retrievable(preconditioned_basis_storage_tag{}) ==
+          Preconditioned);
     CHECK_FALSE(get_tag(Convergence::Tags::HasConverged<DummyOptionsGroup>{}));
   }
 
@@ -194,6 +201,10 @@ void test_element_actions() {
         set_tag(basis_history_tag{}, std::vector<blaze::DynamicVector<double>>{
                                          blaze::DynamicVector<double>(3, 0.5),
                                          blaze::DynamicVector<double>(3, 1.5)});
+        // A vector left over from a previous solve is reused for the new
+        // basis vector
+        set_tag(basis_storage_tag{}, std::vector<blaze::DynamicVector<double>>{
+                                         blaze::DynamicVector<double>(3, 7.)});
         if constexpr (Preconditioned) {
           set_tag(preconditioned_basis_history_tag{},
                   get_tag(basis_history_tag{}));
@@ -219,6 +230,7 @@ void test_element_actions() {
                               blaze::DynamicVector<double>(3, 0.5));
         CHECK(get_tag(basis_history_tag{}).size() == 3);
         CHECK(get_tag(basis_history_tag{})[2] == get_tag(operand_tag{}));
+        CHECK(get_tag(basis_storage_tag{}).empty());
         // minres * basis_history - initial = 2 * 0.5 + 4 * 1.5 - 1 = 6
         CHECK_ITERABLE_APPROX(get_tag(VectorTag{}),
                               blaze::DynamicVector<double>(3, 6.));
@@ -84,6 +84,8 @@ struct MockElementArray {
                      TestLinearSolver>,
                  LinearSolver::gmres::detail::Tags::Orthogonalization<
                      TestLinearSolver, double>,
+                 LinearSolver::gmres::detail::Tags::BatchedOrthogonalization<
+                     TestLinearSolver, double>,
                  LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
                      TestLinearSolver, double>>;
 };
@@ -265,6 +267,45 @@ SPECTRE_TEST_CASE(
           approx(residual_magnitude));
   }
 
+  SECTION("StoreBatchedOrthogonalization") {
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::gmres::detail::InitializeResidualMagnitude<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 2.);
+    ActionTesting::invoke_queued_threaded_action<observer_writer>(
+        make_not_null(&runner), 0);
+    // Same orthogonalization as in the section above, but reduced at once:
+    // <w, w> = 3^2 + 2^2 = 13
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::gmres::detail::StoreBatchedOrthogonalization<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1_st, std::vector<double>{3., 13.});
+    ActionTesting::invoke_queued_threaded_action<observer_writer>(
+        make_not_null(&runner), 0);
+    // Test residual monitor state
+    CHECK_ITERABLE_APPROX(
+        get_residual_monitor_tag(orthogonalization_history_tag{}),
+        blaze::DynamicMatrix<double>({{3.}, {2.}}));
+    // Test element state
+    CHECK(get_element_inbox_tag(
+              LinearSolver::gmres::detail::Tags::BatchedOrthogonalization<
+                  TestLinearSolver, double>{})
+              .at(1) == blaze::DynamicVector<double>({3.}));
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
+                TestLinearSolver, double>{})
+            .at(1);
+    CHECK(get<0>(element_inbox) == approx(2.));
+    CHECK_ITERABLE_APPROX(get<1>(element_inbox),
+                          blaze::DynamicVector<double>({0.4615384615384615}));
+    CHECK_FALSE(get<2>(element_inbox));
+    CHECK(get<2>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          approx(1.1094003924504583));
+  }
+
   SECTION("ConvergeByAbsoluteResidual") {
     ActionTesting::simple_action<
         residual_monitor,
@@ -30,6 +30,10 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.Multigrid.Tags",
       "MaxLevels(TestSolver)");
   TestHelpers::db::test_simple_tag<Tags::OutputVolumeData<TestSolver>>(
       "OutputVolumeData(TestSolver)");
+  TestHelpers::db::test_simple_tag<Tags::AdditiveCycle<TestSolver>>(
+      "AdditiveCycle(TestSolver)");
+  TestHelpers::db::test_simple_tag<Tags::CorrectionWaitStartTime<TestSolver>>(
+      "CorrectionWaitStartTime(TestSolver)");
   TestHelpers::db::test_simple_tag<Tags::MultigridLevel>("MultigridLevel");
   TestHelpers::db::test_simple_tag<Tags::IsFinestGrid>("IsFinestGrid");
   TestHelpers::db::test_simple_tag<Tags::ParentId<1>>("ParentId");
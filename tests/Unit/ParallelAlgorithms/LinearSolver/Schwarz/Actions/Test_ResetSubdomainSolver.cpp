@@ -32,6 +32,21 @@ struct SubdomainSolver {
   void pup(PUP::er& p) { p | is_reset; }
 };
 
+struct ClearResetFlag {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/) {
+    db::mutate<
+        LinearSolver::Schwarz::Tags::SubdomainSolverBase<DummyOptionsGroup>>(
+        [](const auto subdomain_solver) {
+          (*subdomain_solver)->is_reset = false;
+        },
+        make_not_null(&box));
+  }
+};
+
 template <typename Metavariables>
 struct ElementArray {
   using metavariables = Metavariables;
@@ -40,9 +55,11 @@ struct ElementArray {
   using phase_dependent_action_list = tmpl::list<
       Parallel::PhaseActions<
           Parallel::Phase::Initialization,
-          tmpl::list<ActionTesting::InitializeDataBox<
-              tmpl::list<LinearSolver::Schwarz::Tags::SubdomainSolver<
-                  std::unique_ptr<SubdomainSolver>, DummyOptionsGroup>>>>>,
+          tmpl::list<ActionTesting::InitializeDataBox<tmpl::list<
+              LinearSolver::Schwarz::Tags::SubdomainSolver<
+                  std::unique_ptr<SubdomainSolver>, DummyOptionsGroup>,
+              LinearSolver::Schwarz::Tags::SkippedSubdomainSolverResets<
+                  DummyOptionsGroup>>>>>,
       Parallel::PhaseActions<
           Parallel::Phase::Testing,
           tmpl::list<LinearSolver::Schwarz::Actions::ResetSubdomainSolver<
@@ -54,38 +71,50 @@ struct Metavariables {
   using component_list = tmpl::list<element_array>;
 };
 
-void test_reset_subdomain_solver(const bool skip_resets) {
+void test_reset_subdomain_solver(const bool skip_resets,
+                                 const size_t reset_interval) {
   CAPTURE(skip_resets);
+  CAPTURE(reset_interval);
 
   using element_array = typename Metavariables::element_array;
   ActionTesting::MockRuntimeSystem<Metavariables> runner{tuples::TaggedTuple<
       LinearSolver::Schwarz::Tags::SkipSubdomainSolverResets<DummyOptionsGroup>,
-      logging::Tags::Verbosity<DummyOptionsGroup>>{skip_resets,
+      LinearSolver::Schwarz::Tags::SubdomainSolverResetInterval<
+          DummyOptionsGroup>,
+      logging::Tags::Verbosity<DummyOptionsGroup>>{skip_resets, reset_interval,
                                                    Verbosity::Verbose}};
   const ElementId<1> element_id{0};
   ActionTesting::emplace_component_and_initialize<element_array>(
       make_not_null(&runner), element_id,
-      {std::make_unique<SubdomainSolver>()});
+      {std::make_unique<SubdomainSolver>(), size_t{0}});
   ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
-  REQUIRE_FALSE(
-      ActionTesting::get_databox_tag<
-          element_array,
-          LinearSolver::Schwarz::Tags::SubdomainSolverBase<DummyOptionsGroup>>(
-          runner, element_id)
-          .is_reset);
-  ActionTesting::next_action<element_array>(make_not_null(&runner), element_id);
-  CHECK(
-      ActionTesting::get_databox_tag<
-          element_array,
-          LinearSolver::Schwarz::Tags::SubdomainSolverBase<DummyOptionsGroup>>(
-          runner, element_id)
-          .is_reset != skip_resets);
+  const auto is_reset = [&runner, &element_id]() {
+    return ActionTesting::get_databox_tag<
+               element_array, LinearSolver::Schwarz::Tags::SubdomainSolverBase<
+                                  DummyOptionsGroup>>(runner, element_id)
+        .is_reset;
+  };
+  REQUIRE_FALSE(is_reset());
+  for (size_t i = 1; i <= 2 * reset_interval; ++i) {
+    CAPTURE(i);
+    ActionTesting::next_action<element_array>(make_not_null(&runner),
+                                              element_id);
+    CHECK(is_reset() == (not skip_resets and i % reset_interval == 0));
+    // Un-flag the reset to detect the next one
+    ActionTesting::simple_action<element_array, ClearResetFlag>(
+        make_not_null(&runner), element_id);
+    // Run the action again
+    ActionTesting::set_phase(make_not_null(&runner),
+                             Parallel::Phase::Testing);
+  }
 }
 
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.ParallelSchwarz.Action.ResetSubdomainSolver",
                   "[Unit][ParallelAlgorithms][LinearSolver][Actions]") {
-  test_reset_subdomain_solver(false);
-  test_reset_subdomain_solver(true);
+  test_reset_subdomain_solver(false, 1);
+  test_reset_subdomain_solver(true, 1);
+  test_reset_subdomain_solver(false, 3);
+  test_reset_subdomain_solver(true, 3);
 }
@@ -3,12 +3,19 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
+#include <map>
+#include <vector>
+
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/OrientationMap.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/OverlapHelpers.hpp"
@@ -133,6 +140,72 @@ void test_overlap_iterator(const Index<Dim>& volume_extents,
   CHECK_FALSE(overlap_iterator);
 }
 
+void test_bounded_staleness() {
+  const ElementId<1> self_id{1};
+  const ElementId<1> left_id{0};
+  const ElementId<1> right_id{2};
+  const Element<1> element{
+      self_id,
+      {{Direction<1>::lower_xi(),
+        {{left_id}, OrientationMap<1>::create_aligned()}},
+       {Direction<1>::upper_xi(),
+        {{right_id}, OrientationMap<1>::create_aligned()}}}};
+  const OverlapId<1> left_overlap{Direction<1>::lower_xi(), left_id};
+  const OverlapId<1> right_overlap{Direction<1>::upper_xi(), right_id};
+  std::map<size_t, OverlapMap<1, double>> inbox{};
+  OverlapMap<1, size_t> num_consumed{};
+  std::vector<double> consumed_data{};
+  const auto consume = [&inbox, &num_consumed,
+                        &consumed_data](const size_t iteration_id) {
+    consumed_data.clear();
+    consume_overlap_data(make_not_null(&inbox), make_not_null(&num_consumed),
+                         iteration_id,
+                         [&consumed_data](const OverlapId<1>& /*overlap_id*/,
+                                          double&& data) {
+                           consumed_data.push_back(data);
+                         });
+  };
+  // Three iterations with a staleness of one iteration
+  CHECK_FALSE(
+      has_received_overlap_data(inbox, num_consumed, element, 0, 1, false));
+  inbox[0][left_overlap] = 1.;
+  // Data sent at a later iteration doesn't count
+  inbox[1][right_overlap] = 3.;
+  CHECK_FALSE(
+      has_received_overlap_data(inbox, num_consumed, element, 0, 1, false));
+  inbox[0][right_overlap] = 2.;
+  CHECK(has_received_overlap_data(inbox, num_consumed, element, 0, 1, false));
+  consume(0);
+  CHECK(consumed_data.size() == 2);
+  CHECK(inbox.size() == 1);
+  CHECK(num_consumed.at(left_overlap) == 1);
+  CHECK(num_consumed.at(right_overlap) == 1);
+  // The left neighbor may lag behind by one iteration, but not without
+  // staleness
+  CHECK(has_received_overlap_data(inbox, num_consumed, element, 1, 1, false));
+  CHECK_FALSE(
+      has_received_overlap_data(inbox, num_consumed, element, 1, 0, false));
+  consume(1);
+  CHECK(consumed_data == std::vector<double>{3.});
+  CHECK(inbox.empty());
+  CHECK(num_consumed.at(left_overlap) == 1);
+  CHECK(num_consumed.at(right_overlap) == 2);
+  // All data must be received in the last iteration
+  inbox[2][left_overlap] = 5.;
+  inbox[2][right_overlap] = 6.;
+  CHECK_FALSE(
+      has_received_overlap_data(inbox, num_consumed, element, 2, 1, true));
+  CHECK(has_received_overlap_data(inbox, num_consumed, element, 2, 1, false));
+  inbox[1][left_overlap] = 4.;
+  CHECK(has_received_overlap_data(inbox, num_consumed, element, 2, 1, true));
+  consume(2);
+  // Stale data is consumed first, so the newest data is consumed last
+  CHECK(consumed_data == std::vector<double>{4., 5., 6.});
+  CHECK(inbox.empty());
+  CHECK(num_consumed.at(left_overlap) == 3);
+  CHECK(num_consumed.at(right_overlap) == 3);
+}
+
 SPECTRE_TEST_CASE("Unit.ParallelSchwarz.OverlapHelpers",
                   "[Unit][ParallelAlgorithms][LinearSolver]") {
   {
@@ -356,6 +429,8 @@ SPECTRE_TEST_CASE("Unit.ParallelSchwarz.OverlapHelpers",
     }
   }
 
+  test_bounded_staleness();
+
 #ifdef SPECTRE_DEBUG
   CHECK_THROWS_WITH((overlap_num_points(Index<1>{{{3}}}, 4, 0)),
                     Catch::Matchers::ContainsSubstring(
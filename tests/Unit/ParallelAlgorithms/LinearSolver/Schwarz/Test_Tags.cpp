@@ -28,6 +28,8 @@ SPECTRE_TEST_CASE("Unit.ParallelSchwarz.Tags",
                   "[Unit][ParallelAlgorithms][LinearSolver]") {
   TestHelpers::db::test_simple_tag<Tags::MaxOverlap<DummyOptionsGroup>>(
       "MaxOverlap(DummyOptionsGroup)");
+  TestHelpers::db::test_simple_tag<Tags::MaxStaleness<DummyOptionsGroup>>(
+      "MaxStaleness(DummyOptionsGroup)");
   TestHelpers::db::test_base_tag<Tags::SubdomainSolverBase<DummyOptionsGroup>>(
       "SubdomainSolver(DummyOptionsGroup)");
   TestHelpers::db::test_simple_tag<
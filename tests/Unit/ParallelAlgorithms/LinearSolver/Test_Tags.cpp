@@ -40,6 +40,9 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.Tags",
       "LinearOrthogonalizationHistory(Tag)");
   TestHelpers::db::test_prefix_tag<
       LinearSolver::Tags::KrylovSubspaceBasis<Tag>>("KrylovSubspaceBasis(Tag)");
+  TestHelpers::db::test_prefix_tag<
+      LinearSolver::Tags::KrylovSubspaceBasisStorage<Tag>>(
+      "KrylovSubspaceBasisStorage(Tag)");
   TestHelpers::db::test_prefix_tag<LinearSolver::Tags::Preconditioned<Tag>>(
       "Preconditioned(Tag)");
 
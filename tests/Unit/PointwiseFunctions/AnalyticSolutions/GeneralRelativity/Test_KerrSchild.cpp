@@ -35,6 +35,7 @@
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "PointwiseFunctions/SpecialRelativity/LorentzBoostMatrix.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -324,6 +325,21 @@ void test_tag_retrieval(const DataType& used_for_size) {
   TestHelpers::AnalyticSolutions::test_tag_retrieval(solution, x, t,
                                                      regular_tags{});
 
+  // Tags retrieved one at a time through a shared cache agree with the tags
+  // retrieved together
+  using cached_tags = tmpl::list<gr::Tags::Lapse<DataType>,
+                                 gr::Tags::Shift<DataType, 3, Frame>,
+                                 gr::Tags::SpatialMetric<DataType, 3, Frame>>;
+  const auto expected_vars = solution.variables(x, t, cached_tags{});
+  gr::Solutions::KerrSchild::IntermediateVars<DataType, Frame> cache(0);
+  tmpl::for_each<cached_tags>([&solution, &x, &t, &cache,
+                               &expected_vars](auto tag_v) {
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    CHECK(get<tag>(solution.variables(x, t, tmpl::list<tag>{},
+                                      make_not_null(&cache))) ==
+          get<tag>(expected_vars));
+  });
+
   const gr::Solutions::KerrSchild solution_zero_boost(mass, spin, center);
   TestHelpers::AnalyticSolutions::test_tag_retrieval(solution_zero_boost, x, t,
                                                      tags_for_zero_boost{});
@@ -11,6 +11,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ExtractPoint.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
 #include "DataStructures/Tensor/EagerMath/Trace.hpp"
@@ -29,6 +30,7 @@
 #include "PointwiseFunctions/GeneralRelativity/SpatialMetric.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace Tags {
@@ -188,6 +190,26 @@ SPECTRE_TEST_CASE("Unit.PointwiseFunctions.GeneralRelativity.Christoffel",
   CHECK_ITERABLE_APPROX(expected_spacetime_christoffel_second_kind,
                         spacetime_christoffel_second_kind_test);
 
+  // Evaluating on SIMD batches of points must match the DataVector result
+  {
+    tnsr::abb<DataVector, 3, Frame::Inertial> batched_christoffel(
+        used_for_size.size());
+    for_each_simd_batch(
+        used_for_size.size(), [&](const size_t index, const auto use_simd) {
+          using T = tmpl::conditional_t<decltype(use_simd)::value,
+                                        simd::batch<double>, double>;
+          tnsr::abb<T, 3, Frame::Inertial> d_metric{};
+          extract_point(make_not_null(&d_metric),
+                        derivatives_of_spacetime_metric, index);
+          tnsr::abb<T, 3, Frame::Inertial> christoffel{};
+          gr::christoffel_first_kind(make_not_null(&christoffel), d_metric);
+          overwrite_point(make_not_null(&batched_christoffel), christoffel,
+                          index);
+        });
+    CHECK_ITERABLE_APPROX(batched_christoffel,
+                          expected_spacetime_christoffel_first_kind);
+  }
+
   const auto box = db::create<
       db::AddSimpleTags<gr::Tags::InverseSpatialMetric<DataVector, 3>,
                         ::Tags::deriv<gr::Tags::SpatialMetric<DataVector, 3>,
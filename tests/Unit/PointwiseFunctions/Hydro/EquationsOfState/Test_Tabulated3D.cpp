@@ -4,8 +4,10 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <limits>
+#include <optional>
 #include <pup.h>
 #include <random>
+#include <string>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -28,6 +30,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/Factory.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
+#include "Utilities/FileSystem.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 
 SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
@@ -282,4 +285,97 @@ SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
   CHECK(deserialized_eos == eos);
 
   test_against_reference_values(deserialized_eos);
+
+  // The cell-by-cell layout must give the same results
+  const TEoS cell_eos{compose_eos, intrp::TableLayout::CellInterleaved};
+  CHECK(cell_eos.table_layout() == intrp::TableLayout::CellInterleaved);
+  CHECK(eos.table_layout() == intrp::TableLayout::PointInterleaved);
+  test_against_reference_values(cell_eos);
+  const auto deserialized_cell_eos = serialize_and_deserialize(cell_eos);
+  CHECK(deserialized_cell_eos.table_layout() ==
+        intrp::TableLayout::CellInterleaved);
+  test_against_reference_values(deserialized_cell_eos);
+
+  // A table mapped from a converted file must match the HDF5 table
+  const std::string mapped_file_name{"Unit.EquationsOfState.Tabulated3D.dat"};
+  if (file_system::check_if_file_exists(mapped_file_name)) {
+    file_system::rm(mapped_file_name, true);
+  }
+  CHECK_FALSE(eos.is_mapped());
+  eos.write_mapped_table(mapped_file_name);
+  {
+    const TEoS mapped_eos{mapped_file_name, std::nullopt};
+    CHECK(mapped_eos.is_mapped());
+    CHECK(mapped_eos == eos);
+    test_against_reference_values(mapped_eos);
+    const auto deserialized_mapped_eos = serialize_and_deserialize(mapped_eos);
+    CHECK(deserialized_mapped_eos.is_mapped());
+    CHECK(deserialized_mapped_eos == eos);
+    test_against_reference_values(deserialized_mapped_eos);
+    TestHelpers::EquationsOfState::test_get_clone(mapped_eos);
+
+    const auto created_mapped_eos = TestHelpers::test_creation<
+        std::unique_ptr<EoS::EquationOfState<true, 3>>>(
+        "Tabulated3D:\n"
+        "  TableFilename: " +
+        mapped_file_name +
+        "\n"
+        "  TableSubFilename: None");
+    CHECK(dynamic_cast<const TEoS&>(*created_mapped_eos) == eos);
+
+    const TEoS mapped_cell_eos{mapped_file_name, std::nullopt,
+                               intrp::TableLayout::CellInterleaved};
+    CHECK(mapped_cell_eos.table_layout() ==
+          intrp::TableLayout::CellInterleaved);
+    test_against_reference_values(mapped_cell_eos);
+  }
+  file_system::rm(mapped_file_name, true);
+
+  // Interpolate pressure, specific internal energy and sound speed together
+  // at a different state at each point
+  const Scalar<DataVector> rest_mass_density{
+      DataVector{1.e-5, 2.e-5, 5.e-5, 1.e-4, 2.e-4, 4.e-4, 8.e-4}};
+  const Scalar<DataVector> temperature{
+      DataVector{0.5, 1.0, 2.0, 1.5, 0.8, 1.2, 3.0}};
+  const Scalar<DataVector> electron_fraction{
+      DataVector{0.1, 0.2, 0.3, 0.25, 0.15, 0.35, 0.4}};
+  for (const auto* this_eos : {&eos, &cell_eos}) {
+    Scalar<DataVector> pressure{};
+    Scalar<DataVector> specific_internal_energy{};
+    Scalar<DataVector> sound_speed_squared{};
+    this_eos
+        ->pressure_energy_and_sound_speed_squared_from_density_and_temperature(
+            make_not_null(&pressure), make_not_null(&specific_internal_energy),
+            make_not_null(&sound_speed_squared), rest_mass_density,
+            temperature, electron_fraction);
+    for (size_t s = 0; s < get(rest_mass_density).size(); ++s) {
+      const Scalar<double> rho{get(rest_mass_density)[s]};
+      const Scalar<double> temp{get(temperature)[s]};
+      const Scalar<double> ye{get(electron_fraction)[s]};
+      CHECK(get(pressure)[s] ==
+            approx(get(eos.pressure_from_density_and_temperature(rho, temp,
+                                                                 ye))));
+      CHECK(get(specific_internal_energy)[s] ==
+            approx(get(eos.specific_internal_energy_from_density_and_temperature(
+                rho, temp, ye))));
+      CHECK(get(sound_speed_squared)[s] ==
+            approx(get(eos.sound_speed_squared_from_density_and_temperature(
+                rho, temp, ye))));
+    }
+    CHECK_ITERABLE_APPROX(pressure, eos.pressure_from_density_and_temperature(
+                                        rest_mass_density, temperature,
+                                        electron_fraction));
+
+    // Inverting for the temperature between the table points must recover it
+    const auto temperature_from_energy =
+        this_eos->temperature_from_density_and_energy(
+            rest_mass_density, specific_internal_energy, electron_fraction);
+    CHECK_ITERABLE_APPROX(temperature_from_energy, temperature);
+    for (size_t s = 0; s < get(rest_mass_density).size(); ++s) {
+      CHECK(get(this_eos->temperature_from_density_and_energy(
+                Scalar<double>{get(rest_mass_density)[s]},
+                Scalar<double>{get(specific_internal_energy)[s]},
+                Scalar<double>{get(electron_fraction)[s]})) ==
+            approx(get(temperature)[s]));
+    }
 }
@@ -711,6 +711,40 @@ void test_for_each() {
   check_not_null<false, true, false>(history.remote(), remote_size);
   check_reference<false, false>(const_history.remote(), remote_size);
 }
+
+void test_reserve() {
+  BoundaryHistoryType history{};
+  history.reserve(8, 3);
+  CHECK(history.local().capacity() >= 8);
+  CHECK(history.remote().capacity() >= 3);
+
+  for (size_t step = 0; step < 3; ++step) {
+    history.remote().insert(make_time_id(static_cast<double>(step)), 2,
+                            std::vector{static_cast<int>(step)});
+  }
+  for (size_t step = 0; step < 8; ++step) {
+    history.local().insert(make_time_id(static_cast<double>(step)), 2,
+                           get_output(step));
+  }
+  CHECK(history.local().capacity() == 8);
+  CHECK(history.remote().capacity() == 3);
+
+  // Reserving doesn't affect the contents or the cached couplings
+  size_t coupling_calls = 0;
+  const auto coupling = [&coupling_calls](const std::string& local,
+                                          const std::vector<int>& remote) {
+    ++coupling_calls;
+    return static_cast<double>(local.size()) + remote.front();
+  };
+  const auto evaluator = history.evaluator(coupling);
+  CHECK(*evaluator(make_time_id(7.), make_time_id(2.)) == 3.);
+  history.reserve(16, 4);
+  CHECK(history.local().size() == 8);
+  CHECK(history.remote().size() == 3);
+  CHECK(history.local().data(7) == get_output(7));
+  CHECK(*evaluator(make_time_id(7.), make_time_id(2.)) == 3.);
+  CHECK(coupling_calls == 1);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Time.BoundaryHistory", "[Unit][Time]") {
@@ -719,4 +753,5 @@ SPECTRE_TEST_CASE("Unit.Time.BoundaryHistory", "[Unit][Time]") {
   test_substeps<false>();
   test_substeps<true>();
   test_for_each();
+  test_reserve();
 }
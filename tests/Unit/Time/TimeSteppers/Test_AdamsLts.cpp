@@ -12,6 +12,7 @@
 #include <map>
 #include <optional>
 #include <ostream>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -749,11 +750,58 @@ void test_lts_coefficients() {
   }
 }
 
+void test_lts_coefficients_cache() {
+  // Steps with the same pattern of history times relative to the step
+  // reuse cached coefficients.  Compare these with a fresh calculation
+  // on another thread, which doesn't share the cache.
+  const adams_lts::AdamsScheme ab3{adams_lts::SchemeType::Explicit, 3};
+  const auto coefficients_on_slab = [&ab3](const Slab& slab) {
+    TimeSteppers::BoundaryHistory<double, double, double> history{};
+    const size_t history_order = 3;
+    // The remote times are in earlier slabs
+    history.remote().insert(
+        TimeStepId(true, -2, slab.retreat().retreat().start()), history_order,
+        0.0);
+    history.remote().insert(TimeStepId(true, -1, slab.retreat().start()),
+                            history_order, 0.0);
+    history.remote().insert(TimeStepId(true, 0, slab.start()), history_order,
+                            0.0);
+    for (int32_t i = 0; i < 3; ++i) {
+      history.local().insert(
+          TimeStepId(true, 0, slab.start() + slab.duration() * Rational(i, 4)),
+          history_order, 0.0);
+    }
+    return adams_lts::lts_coefficients(
+        history.local(), history.remote(),
+        slab.start() + slab.duration() / 2,
+        slab.start() + slab.duration() * Rational(3, 4), ab3, ab3, ab3);
+  };
+
+  const auto first = coefficients_on_slab(Slab(0.0, 1.0));
+  const Slab slab(3.7, 5.1);
+  const auto cached = coefficients_on_slab(slab);
+  adams_lts::LtsCoefficients fresh{};
+  std::thread thread{[&fresh, &coefficients_on_slab, &slab]() {
+    fresh = coefficients_on_slab(slab);
+  }};
+  thread.join();
+
+  REQUIRE(first.size() == fresh.size());
+  REQUIRE(cached.size() == fresh.size());
+  for (size_t i = 0; i < fresh.size(); ++i) {
+    CHECK(get<0>(cached[i]) == get<0>(fresh[i]));
+    CHECK(get<1>(cached[i]) == get<1>(fresh[i]));
+    CHECK(get<2>(cached[i]) == approx(get<2>(fresh[i])));
+    CHECK(get<2>(first[i]) == approx(get<2>(fresh[i]) / 1.4));
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsLts", "[Unit][Time]") {
   test_exact_substep_time();
   test_lts_coefficients_struct();
   test_apply_coefficients(0.0);
   test_apply_coefficients(DataVector(5, 0.0));
   test_lts_coefficients();
+  test_lts_coefficients_cache();
 }
 }  // namespace
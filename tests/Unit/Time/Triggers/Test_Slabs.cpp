@@ -47,6 +47,7 @@ SPECTRE_TEST_CASE("Unit.Time.Triggers.Slabs", "[Unit][Time]") {
           "    Values: [3, 6, 8]");
 
   const auto sent_trigger = serialize_and_deserialize(trigger);
+  CHECK(sent_trigger->is_element_independent());
 
   const Slab slab(0., 1.);
   auto box = db::create<db::AddSimpleTags<
@@ -3,8 +3,103 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/Blas.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Test_Blas.hpp"
 
+namespace {
+// Compares `dgemm_`/`zgemm_` to a direct evaluation of the product for all
+// transpositions. Small products use `blas_detail::small_gemm`, large ones
+// BLAS.
+template <typename T>
+void test_gemm(const gsl::not_null<std::mt19937*> gen, const size_t m,
+               const size_t n, const size_t k) {
+  CAPTURE(m);
+  CAPTURE(n);
+  CAPTURE(k);
+  std::uniform_real_distribution<double> dist{-1.0, 1.0};
+  const auto random_vector = [&gen, &dist](const size_t size) {
+    std::vector<T> result(size);
+    for (auto& value : result) {
+      if constexpr (std::is_same_v<T, double>) {
+        value = dist(*gen);
+      } else {
+        value = T{dist(*gen), dist(*gen)};
+      }
+    }
+    return result;
+  };
+  // Leading dimensions with padding
+  const size_t lda = std::max(m, k) + 1;
+  const size_t ldb = std::max(n, k) + 2;
+  const size_t ldc = m + 3;
+  const auto a = random_vector(lda * std::max(m, k));
+  const auto b = random_vector(ldb * std::max(n, k));
+  const auto initial_c = random_vector(ldc * n);
+  const T alpha = random_vector(1)[0];
+  const T beta = random_vector(1)[0];
+  const auto op = [](const std::vector<T>& matrix, const size_t ld,
+                     const char trans, const size_t row, const size_t column) {
+    if (trans == 'N') {
+      return matrix[row + ld * column];
+    }
+    const T value = matrix[column + ld * row];
+    if constexpr (std::is_same_v<T, double>) {
+      return value;
+    } else {
+      return trans == 'C' ? std::conj(value) : value;
+    }
+  };
+  for (const char transa : {'N', 'T', 'C'}) {
+    for (const char transb : {'N', 'T', 'C'}) {
+      CAPTURE(transa);
+      CAPTURE(transb);
+      auto c = initial_c;
+      if constexpr (std::is_same_v<T, double>) {
+        dgemm_(transa, transb, m, n, k, alpha, a.data(), lda, b.data(), ldb,
+               beta, c.data(), ldc);
+      } else {
+        zgemm_(transa, transb, m, n, k, alpha, a.data(), lda, b.data(), ldb,
+               beta, c.data(), ldc);
+      }
+      for (size_t j = 0; j < n; ++j) {
+        for (size_t i = 0; i < m; ++i) {
+          T expected = beta * initial_c[i + ldc * j];
+          for (size_t l = 0; l < k; ++l) {
+            expected +=
+                alpha * op(a, lda, transa, i, l) * op(b, ldb, transb, l, j);
+          }
+          if constexpr (std::is_same_v<T, double>) {
+            CHECK(c[i + ldc * j] == approx(expected));
+          } else {
+            CHECK(real(c[i + ldc * j]) == approx(real(expected)));
+            CHECK(imag(c[i + ldc * j]) == approx(imag(expected)));
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Utilities.Blas.Gemm", "[Unit][Utilities]") {
+  MAKE_GENERATOR(gen);
+  for (const auto& [m, n, k] : std::vector<std::array<size_t, 3>>{
+           {{1, 1, 1}}, {{5, 25, 5}}, {{7, 3, 4}}, {{40, 40, 40}}}) {
+    test_gemm<double>(make_not_null(&gen), m, n, k);
+    test_gemm<std::complex<double>>(make_not_null(&gen), m, n, k);
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Utilities.Blas", "[Unit][Utilities]") {
 #ifdef SPECTRE_DEBUG
   CHECK_THROWS_WITH(
@@ -49,6 +49,20 @@ SPECTRE_TEST_CASE("Unit.Utilities.Rational", "[Unit][Utilities]") {
   CHECK_OP(Rational(3, 4), /, Rational(2, 5), Rational(15, 8));
   CHECK_OP(Rational(3, 4), /, Rational(3, 2), Rational(1, 2));
 
+  // Power-of-two denominators are reduced without a gcd
+  CHECK_OP(Rational(3, 8), +, Rational(1, 8), Rational(1, 2));
+  CHECK_OP(Rational(-3, 8), -, Rational(1, 8), Rational(-1, 2));
+  CHECK_OP(Rational(1, 2), +, Rational(3, 32), Rational(19, 32));
+  CHECK_OP(Rational(3, 32), +, Rational(-3, 32), Rational(0));
+  CHECK_OP(Rational(3, 32), -, Rational(1, 2), Rational(-13, 32));
+  CHECK_OP(Rational(3, 8), *, Rational(4, 3), Rational(1, 2));
+  CHECK_OP(Rational(-1, 4), *, Rational(8), Rational(-2));
+  CHECK_OP(Rational(5, 16), /, Rational(5, 2), Rational(1, 8));
+  CHECK(Rational(12, 8).numerator() == 3);
+  CHECK(Rational(12, 8).denominator() == 2);
+  CHECK(Rational(12, -8).numerator() == -3);
+  CHECK(Rational(12, -8).denominator() == 2);
+
   CHECK(abs(Rational(3, 4)) == Rational(3, 4));
   CHECK(abs(Rational(-3, 4)) == Rational(3, 4));
   CHECK(abs(Rational(0)) == Rational(0));
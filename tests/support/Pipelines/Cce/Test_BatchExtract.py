@@ -0,0 +1,143 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import logging
+import shutil
+import unittest
+from pathlib import Path
+
+import yaml
+from click.testing import CliRunner
+
+from spectre.Informer import unit_test_build_path, unit_test_src_path
+from spectre.Pipelines.Cce.BatchExtract import (
+    batch_extract,
+    batch_extract_command,
+    batch_extractions,
+)
+from spectre.support.Logging import configure_logging
+
+
+class TestBatchExtract(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(
+            unit_test_build_path(), "support/Pipelines/Cce/BatchExtract"
+        )
+        shutil.rmtree(self.test_dir, ignore_errors=True)
+        self.test_dir.mkdir(parents=True, exist_ok=True)
+        self.input_file_template = Path(
+            unit_test_src_path(), "../InputFiles/Cce/CharacteristicExtract.yaml"
+        ).resolve()
+        self.worldtube_files = [
+            self.test_dir / "WaveformA_CceR0100.h5",
+            self.test_dir / "WaveformB_CceR0250.h5",
+        ]
+        for worldtube_file in self.worldtube_files:
+            worldtube_file.touch()
+
+    def tearDown(self):
+        shutil.rmtree(self.test_dir, ignore_errors=True)
+
+    def load_input_file(self, run_dir):
+        return list(
+            yaml.safe_load_all(
+                (run_dir / self.input_file_template.name).read_text()
+            )
+        )[1]
+
+    def test_batch_extractions(self):
+        extractions = batch_extractions(
+            self.worldtube_files, output_dir=self.test_dir / "Runs"
+        )
+        self.assertEqual(len(extractions), 2)
+        self.assertEqual(
+            extractions[0].worldtube_file, self.worldtube_files[0].resolve()
+        )
+        self.assertIsNone(extractions[0].extraction_radius)
+        self.assertEqual(
+            extractions[1].run_dir,
+            self.test_dir / "Runs" / "WaveformB_CceR0250",
+        )
+        extractions = batch_extractions(
+            self.worldtube_files[:1],
+            output_dir=self.test_dir / "Runs",
+            extraction_radii=[100.0, 150.5],
+        )
+        self.assertEqual(
+            [extraction.extraction_radius for extraction in extractions],
+            [100.0, 150.5],
+        )
+        self.assertEqual(
+            extractions[1].run_dir,
+            self.test_dir / "Runs" / "WaveformA_CceR0100_R150.5",
+        )
+        no_radius_file = self.test_dir / "Worldtube.h5"
+        no_radius_file.touch()
+        with self.assertRaisesRegex(ValueError, "does not encode"):
+            batch_extractions([no_radius_file], output_dir=self.test_dir)
+        with self.assertRaisesRegex(ValueError, "share a directory"):
+            batch_extractions(
+                [self.worldtube_files[0], self.worldtube_files[0]],
+                output_dir=self.test_dir,
+            )
+
+    def test_batch_extract(self):
+        extractions = batch_extract(
+            self.input_file_template,
+            self.worldtube_files,
+            output_dir=self.test_dir / "Runs",
+            submit=False,
+        )
+        for extraction in extractions:
+            cce_options = self.load_input_file(extraction.run_dir)["Cce"]
+            self.assertEqual(
+                cce_options["BoundaryDataFilename"],
+                str(extraction.worldtube_file),
+            )
+            self.assertEqual(cce_options["ExtractionRadius"], "Auto")
+            self.assertEqual(cce_options["LMax"], 20)
+        # Modified input files are only overwritten with 'force'
+        input_file_path = (
+            extractions[0].run_dir / self.input_file_template.name
+        )
+        input_file_path.write_text("Modified")
+        with self.assertRaises(OSError):
+            batch_extract(
+                self.input_file_template,
+                self.worldtube_files[:1],
+                output_dir=self.test_dir / "Runs",
+                submit=False,
+            )
+        batch_extract(
+            self.input_file_template,
+            self.worldtube_files[:1],
+            output_dir=self.test_dir / "Runs",
+            force=True,
+            submit=False,
+        )
+        self.assertNotEqual(input_file_path.read_text(), "Modified")
+
+    def test_cli(self):
+        result = CliRunner().invoke(
+            batch_extract_command,
+            [
+                str(self.input_file_template),
+                str(self.worldtube_files[0]),
+                "-o",
+                str(self.test_dir / "Runs"),
+                "-r",
+                "120",
+                "--no-submit",
+            ],
+            catch_exceptions=False,
+        )
+        self.assertEqual(result.exit_code, 0, result.output)
+        cce_options = self.load_input_file(
+            self.test_dir / "Runs" / "WaveformA_CceR0100_R120"
+        )["Cce"]
+        self.assertEqual(cce_options["ExtractionRadius"], 120.0)
+
+
+if __name__ == "__main__":
+    configure_logging(log_level=logging.DEBUG)
+    unittest.main(verbosity=2)
@@ -0,0 +1,172 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import logging
+import shutil
+import unittest
+from pathlib import Path
+
+import h5py
+import numpy as np
+import yaml
+
+from spectre.Informer import unit_test_build_path
+from spectre.Pipelines.Scaling.ScalingStudy import (
+    STUDY_FILE_NAME,
+    refinement_for_nodes,
+    scaling_runs,
+    scaling_table,
+    wall_time_per_slab,
+)
+from spectre.support.Logging import configure_logging
+
+
+class TestScalingStudy(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(
+            unit_test_build_path(), "support/Pipelines/Scaling/ScalingStudy"
+        )
+        shutil.rmtree(self.test_dir, ignore_errors=True)
+        self.test_dir.mkdir(parents=True, exist_ok=True)
+
+    def tearDown(self):
+        shutil.rmtree(self.test_dir, ignore_errors=True)
+
+    def write_study(self, name, scaling, wall_times_per_slab):
+        study_dir = self.test_dir / name
+        runs = scaling_runs(
+            num_nodes=list(wall_times_per_slab.keys()),
+            base_refinement=[1, 1, 1],
+            study_dir=study_dir,
+            weak=(scaling == "Weak"),
+        )
+        for run in runs:
+            run.run_dir.mkdir(parents=True)
+            (run.run_dir / "Input.yaml").write_text(
+                yaml.safe_dump_all(
+                    [
+                        dict(Executable="EvolveScalarWave3D"),
+                        dict(Observers=dict(ReductionFileName="Reductions")),
+                    ]
+                )
+            )
+            slab_size = 0.1
+            num_slabs = 5
+            wall_times = 10.0 + wall_times_per_slab[
+                run.num_nodes
+            ] * np.arange(num_slabs)
+            # The first slab includes the startup
+            wall_times[1:] += 100.0
+            with h5py.File(run.run_dir / "Reductions.h5", "w") as open_h5_file:
+                subfile = open_h5_file.create_dataset(
+                    "TimeSteps.dat",
+                    data=np.column_stack(
+                        [
+                            slab_size * np.arange(num_slabs),
+                            np.ones(num_slabs),
+                            np.full(num_slabs, slab_size),
+                            np.full(num_slabs, slab_size),
+                            np.full(num_slabs, slab_size),
+                            np.full(num_slabs, slab_size),
+                            wall_times,
+                            wall_times,
+                        ]
+                    ),
+                )
+                subfile.attrs["Legend"] = [
+                    "Time",
+                    "NumberOfPoints",
+                    "Slab size",
+                    "Minimum time step",
+                    "Maximum time step",
+                    "Effective time step",
+                    "Minimum Walltime",
+                    "Maximum Walltime",
+                ]
+        (study_dir / STUDY_FILE_NAME).write_text(
+            yaml.safe_dump(
+                dict(
+                    Executable="EvolveScalarWave3D",
+                    Scaling=scaling,
+                    Runs=[
+                        dict(
+                            num_nodes=run.num_nodes,
+                            refinement=run.refinement,
+                            run_dir=str(run.run_dir),
+                        )
+                        for run in runs
+                    ],
+                )
+            )
+        )
+        return study_dir
+
+    def test_refinement_for_nodes(self):
+        self.assertEqual(
+            refinement_for_nodes([1, 2, 3], 8, base_num_nodes=1, weak=False),
+            [1, 2, 3],
+        )
+        self.assertEqual(
+            refinement_for_nodes([1, 1, 1], 1, base_num_nodes=1, weak=True),
+            [1, 1, 1],
+        )
+        self.assertEqual(
+            refinement_for_nodes([1, 1, 1], 4, base_num_nodes=1, weak=True),
+            [2, 2, 1],
+        )
+        self.assertEqual(
+            refinement_for_nodes([1, 1, 1], 32, base_num_nodes=2, weak=True),
+            [3, 2, 2],
+        )
+        with self.assertRaisesRegex(ValueError, "power of two"):
+            refinement_for_nodes([1, 1, 1], 3, base_num_nodes=1, weak=True)
+
+    def test_scaling_runs(self):
+        runs = scaling_runs(
+            num_nodes=[4, 1, 2],
+            base_refinement=[1, 1, 1],
+            study_dir=self.test_dir,
+            weak=True,
+        )
+        self.assertEqual([run.num_nodes for run in runs], [1, 2, 4])
+        self.assertEqual(runs[2].refinement, [2, 2, 1])
+        self.assertEqual(runs[1].run_dir, self.test_dir / "N2")
+        runs = scaling_runs(
+            num_nodes=2,
+            base_refinement=[1, 1, 1],
+            study_dir=self.test_dir,
+            weak=False,
+        )
+        self.assertEqual(len(runs), 1)
+
+    def test_wall_time_per_slab(self):
+        study_dir = self.write_study("Strong", "Strong", {1: 2.0})
+        reductions_file = study_dir / "N1" / "Reductions.h5"
+        self.assertAlmostEqual(wall_time_per_slab(reductions_file), 2.0)
+        self.assertAlmostEqual(
+            wall_time_per_slab(reductions_file, num_discarded_slabs=0), 27.0
+        )
+        with self.assertRaisesRegex(ValueError, "at least two"):
+            wall_time_per_slab(reductions_file, num_discarded_slabs=4)
+
+    def test_scaling_table(self):
+        strong_study = self.write_study(
+            "Strong", "Strong", {1: 4.0, 2: 2.0, 4: 1.25}
+        )
+        weak_study = self.write_study("Weak", "Weak", {1: 1.0, 2: 1.0, 4: 1.25})
+        table = scaling_table([strong_study, weak_study])
+        self.assertEqual(len(table), 6)
+        self.assertEqual(list(table["NumNodes"]), [1, 2, 4, 1, 2, 4])
+        self.assertEqual(list(table["Elements"]), [8, 8, 8, 8, 16, 32])
+        np.testing.assert_allclose(
+            table["Efficiency"], [1.0, 1.0, 0.8, 1.0, 1.0, 0.8]
+        )
+        # Runs without observations are skipped
+        (strong_study / "N4" / "Reductions.h5").unlink()
+        table = scaling_table(strong_study)
+        self.assertEqual(list(table["NumNodes"]), [1, 2])
+
+
+if __name__ == "__main__":
+    configure_logging(log_level=logging.DEBUG)
+    unittest.main(verbosity=2)